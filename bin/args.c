@@ -8,6 +8,7 @@
  */
 #include <stdio.h>
 #include <stdlib.h>
+#include <strings.h>
 #include "charsets.h"
 #include "bibutils.h"
 #include "args.h"
@@ -33,7 +34,7 @@ args_match( const char *check, const char *shortarg, const char *longarg )
 char *
 args_next( int argc, char *argv[], int n, const char *progname, const char *shortarg, const char *longarg )
 {
-	if ( n>=argc ) {
+	if ( n+1>=argc ) {
 		fprintf( stderr, "%s: option ", progname );
 		if ( shortarg ) fprintf( stderr, "%s", shortarg );
 		if ( shortarg && longarg ) fprintf( stderr, "/" );
@@ -87,6 +88,37 @@ args_encoding( int argc, char *argv[], int i, int *charset,
 	}
 }
 
+/* args_inputcharset(), args_outputcharset()
+ *
+ * Set the input or output character set of p from argv[i+1].
+ */
+void
+args_inputcharset( int argc, char *argv[], int i, param *p )
+{
+	args_encoding( argc, argv, i, &(p->charsetin), 
+			&(p->utf8in), p->progname, 0 );
+	if ( p->charsetin!=BIBL_CHARSET_UNICODE )
+		p->utf8in = 0;
+	p->charsetin_src = BIBL_SRC_USER;
+}
+
+void
+args_outputcharset( int argc, char *argv[], int i, param *p )
+{
+	args_encoding( argc, argv, i, &(p->charsetout),
+			&(p->utf8out), p->progname, 1 );
+	if ( p->charsetout==BIBL_CHARSET_UNICODE ) {
+		p->utf8out = 1;
+		p->utf8bom = 1;
+	} else if ( p->charsetout==BIBL_CHARSET_GB18030 ) {
+		p->latexout = 0;
+	} else {
+		p->utf8out = 0;
+		p->utf8bom = 0;
+	}
+	p->charsetout_src = BIBL_SRC_USER;
+}
+
 /* Must process charset info first so switches are order independent */
 void
 process_charsets( int *argc, char *argv[], param *p )
@@ -96,25 +128,10 @@ process_charsets( int *argc, char *argv[], param *p )
 	while ( i<*argc ) {
 		subtract = 0;
 		if ( args_match( argv[i], "-i", "--input-encoding" ) ) {
-			args_encoding( *argc, argv, i, &(p->charsetin), 
-					&(p->utf8in), p->progname, 0 );
-			if ( p->charsetin!=BIBL_CHARSET_UNICODE )
-				p->utf8in = 0;
-			p->charsetin_src = BIBL_SRC_USER;
+			args_inputcharset( *argc, argv, i, p );
 			subtract = 2;
 		} else if ( args_match( argv[i], "-o", "--output-encoding" ) ) {
-			args_encoding( *argc, argv, i, &(p->charsetout),
-					&(p->utf8out), p->progname, 1 );
-			if ( p->charsetout==BIBL_CHARSET_UNICODE ) {
-				p->utf8out = 1;
-				p->utf8bom = 1;
-			} else if ( p->charsetout==BIBL_CHARSET_GB18030 ) {
-				p->latexout = 0;
-			} else {
-				p->utf8out = 0;
-				p->utf8bom = 0;
-			}
-			p->charsetout_src = BIBL_SRC_USER;
+			args_outputcharset( *argc, argv, i, p );
 			subtract = 2;
 		}
 		if ( subtract ) {
@@ -125,3 +142,66 @@ process_charsets( int *argc, char *argv[], param *p )
 	}
 }
 
+
+/* args_informat(), args_outformat()
+ *
+ * Return the BIBL_ mode for a format name, as given to the programs
+ * that take formats by name, or list the valid names and exit.
+ */
+typedef struct args_format { char *name; int code; } args_format;
+
+static args_format informats[] = {
+	{ "bibtex",      BIBL_BIBTEXIN },
+	{ "biblatex",    BIBL_BIBLATEXIN },
+	{ "copac",       BIBL_COPACIN },
+	{ "ebi",         BIBL_EBIIN },
+	{ "endnote",     BIBL_ENDNOTEIN },
+	{ "endnote-xml", BIBL_ENDNOTEXMLIN },
+	{ "isi",         BIBL_ISIIN },
+	{ "medline",     BIBL_MEDLINEIN },
+	{ "mods",        BIBL_MODSIN },
+	{ "nbib",        BIBL_NBIBIN },
+	{ "ris",         BIBL_RISIN },
+	{ "word2007",    BIBL_WORDIN },
+};
+
+static args_format outformats[] = {
+	{ "ads",         BIBL_ADSABSOUT },
+	{ "bibtex",      BIBL_BIBTEXOUT },
+	{ "biblatex",    BIBL_BIBLATEXOUT },
+	{ "endnote",     BIBL_ENDNOTEOUT },
+	{ "isi",         BIBL_ISIOUT },
+	{ "mods",        BIBL_MODSOUT },
+	{ "nbib",        BIBL_NBIBOUT },
+	{ "ris",         BIBL_RISOUT },
+	{ "word2007",    BIBL_WORD2007OUT },
+};
+
+static int
+args_lookupformat( const char *progname, const char *format, args_format *formats, int nformats )
+{
+	int i;
+
+	for ( i=0; i<nformats; ++i ) {
+		if ( !strcasecmp( format, formats[i].name ) ) return formats[i].code;
+	}
+
+	fprintf( stderr, "%s: Cannot recognize format '%s'.\n", progname, format );
+	fprintf( stderr, "%s: Valid format specifiers are", progname );
+	for ( i=0; i<nformats; ++i )
+		fprintf( stderr, "%s '%s'", ( i ) ? "," : "", formats[i].name );
+	fprintf( stderr, "\n%s: Exiting.\n", progname );
+	exit( EXIT_FAILURE );
+}
+
+int
+args_informat( const char *progname, const char *format )
+{
+	return args_lookupformat( progname, format, informats, sizeof( informats ) / sizeof( informats[0] ) );
+}
+
+int
+args_outformat( const char *progname, const char *format )
+{
+	return args_lookupformat( progname, format, outformats, sizeof( outformats ) / sizeof( outformats[0] ) );
+}
@@ -13,5 +13,9 @@ void  args_tellversion( const char *progname );
 int   args_match( const char *check, const char *shortarg, const char *longarg );
 char *args_next( int argc, char *argv[], int n, const char *progname, const char *shortarg, const char *longarg );
 void  process_charsets( int *argc, char *argv[], param *p );
+void  args_inputcharset( int argc, char *argv[], int i, param *p );
+void  args_outputcharset( int argc, char *argv[], int i, param *p );
+int   args_informat( const char *progname, const char *format );
+int   args_outformat( const char *progname, const char *format );
 
 #endif
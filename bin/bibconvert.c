@@ -0,0 +1,225 @@
+/*
+ * bibconvert.c
+ *
+ * Copyright (c) Chris Putnam 2021
+ *
+ * Program and source code released under the GPL version 2
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bibutils.h"
+#include "args.h"
+#include "bibprog.h"
+
+char progname[] = "bibconvert";
+
+typedef struct {
+	param **ps;
+	FILE  **fps;
+	char  **names;
+	int   n, max;
+} outputs;
+
+void
+version( void )
+{
+	args_tellversion( progname );
+	exit( EXIT_FAILURE );
+}
+
+void
+help( void )
+{
+	args_tellversion( progname );
+	fprintf( stderr, "Reads references once and writes them in several formats\n\n" );
+
+	fprintf( stderr, "usage: %s [-f FORMAT] -t FORMAT FILE [-t FORMAT FILE ...] ref_file(s)\n\n", progname );
+	fprintf( stderr, "  ref_file(s) can be omitted to read standard input\n\n" );
+
+	fprintf( stderr, "-h, --help                display this help\n" );
+	fprintf( stderr, "-v, --version             display version\n" );
+	fprintf( stderr, "-f, --format FORMAT       specify input format (default mods)\n" );
+	fprintf( stderr, "-t, --to FORMAT FILE      write FORMAT to FILE ('-' for standard output)\n" );
+	fprintf( stderr, "-i, --input-encoding      input character encoding\n" );
+	fprintf( stderr, "-o, --output-encoding     character encoding of the preceding --to output\n" );
+	fprintf( stderr, "-j, --threads N           write up to N outputs at once\n" );
+	fprintf( stderr, "--verbose                 report all warnings\n" );
+	fprintf( stderr, "\n" );
+
+	fprintf( stderr, "Valid input formats are 'bibtex', 'biblatex', 'copac', 'ebi', 'endnote', "
+		"'endnote-xml', 'isi', 'medline', 'mods', 'nbib', 'ris', 'word2007'\n" );
+	fprintf( stderr, "Valid output formats are 'ads', 'bibtex', 'biblatex', 'endnote', 'isi', "
+		"'mods', 'nbib', 'ris', 'word2007'\n\n" );
+
+	exit( EXIT_FAILURE );
+}
+
+static void
+memerr( void )
+{
+	fprintf( stderr, "%s: Memory error. Exiting.\n", progname );
+	exit( EXIT_FAILURE );
+}
+
+void
+add_output( outputs *o, const char *format, char *filename )
+{
+	int mode, alloc;
+	param *p;
+
+	mode = args_outformat( progname, format );
+
+	if ( o->n == o->max ) {
+		alloc = ( o->max ) ? o->max * 2 : 8;
+		o->ps    = ( param ** ) realloc( o->ps, sizeof( param * ) * alloc );
+		o->fps   = ( FILE ** ) realloc( o->fps, sizeof( FILE * ) * alloc );
+		o->names = ( char ** ) realloc( o->names, sizeof( char * ) * alloc );
+		if ( !o->ps || !o->fps || !o->names ) memerr();
+		o->max = alloc;
+	}
+
+	p = ( param * ) calloc( 1, sizeof( param ) );
+	if ( !p || bibl_initparams( p, BIBL_MODSIN, mode, progname )!=BIBL_OK ) memerr();
+
+	o->ps[ o->n ]    = p;
+	o->fps[ o->n ]   = NULL;
+	o->names[ o->n ] = filename;
+	o->n++;
+}
+
+/* process_args()
+ *
+ * The input format is found first, so that the input and output
+ * switches can follow in any order; -o applies to the last --to.
+ */
+void
+process_args( int *argc, char *argv[], param *pin, outputs *o, int *nthreads )
+{
+	int i, j, subtract, format = BIBL_MODSIN, verbose = 0;
+
+	for ( i=0; i<*argc; ++i )
+		if ( args_match( argv[i], "-h", "--help" ) ) help();
+
+	for ( i=0; i<*argc; ++i )
+		if ( args_match( argv[i], "-v", "--version" ) ) version();
+
+	for ( i=1; i<*argc; ++i )
+		if ( args_match( argv[i], "-f", "--format" ) )
+			format = args_informat( progname, args_next( *argc, argv, i, progname, "-f", "--format" ) );
+
+	if ( bibl_initparams( pin, format, BIBL_MODSOUT, progname )!=BIBL_OK ) memerr();
+
+	i = 1;
+	while ( i < *argc ) {
+		subtract = 0;
+		if ( args_match( argv[i], "-f", "--format" ) ) {
+			subtract = 2;
+		} else if ( args_match( argv[i], "-t", "--to" ) ) {
+			if ( i+2 >= *argc ) {
+				fprintf( stderr, "%s: option -t/--to takes a format and a file. Exiting.\n", progname );
+				exit( EXIT_FAILURE );
+			}
+			add_output( o, argv[i+1], argv[i+2] );
+			subtract = 3;
+		} else if ( args_match( argv[i], "-i", "--input-encoding" ) ) {
+			args_inputcharset( *argc, argv, i, pin );
+			subtract = 2;
+		} else if ( args_match( argv[i], "-o", "--output-encoding" ) ) {
+			if ( o->n==0 ) {
+				fprintf( stderr, "%s: option -o/--output-encoding must follow a -t/--to output. Exiting.\n", progname );
+				exit( EXIT_FAILURE );
+			}
+			args_outputcharset( *argc, argv, i, o->ps[ o->n - 1 ] );
+			subtract = 2;
+		} else if ( args_match( argv[i], "-j", "--threads" ) ) {
+			*nthreads = atoi( args_next( *argc, argv, i, progname, "-j", "--threads" ) );
+			subtract = 2;
+		} else if ( args_match( argv[i], "--verbose", "" ) ) {
+			verbose = 1;
+			subtract = 1;
+		} else if ( !strcmp( argv[i], "--" ) ) {
+			subtract = 1;
+			for ( j=i+subtract; j<*argc; ++j )
+				argv[j-subtract] = argv[j];
+			*argc -= subtract;
+			break;
+		} else if ( argv[i][0]=='-' && argv[i][1]!='\0' ) {
+			fprintf( stderr, "%s: Unrecognized command-line switch '%s'. Exiting.\n", progname, argv[i] );
+			exit( EXIT_FAILURE );
+		}
+		if ( subtract ) {
+			for ( j=i+subtract; j<*argc; ++j )
+				argv[j-subtract] = argv[j];
+			*argc -= subtract;
+		} else i++;
+	}
+
+	if ( verbose ) {
+		pin->verbose = 1;
+		for ( i=0; i<o->n; ++i )
+			o->ps[i]->verbose = 1;
+	}
+}
+
+int
+main( int argc, char *argv[] )
+{
+	outputs o = { NULL, NULL, NULL, 0, 0 };
+	int i, status, nthreads = 0, failed = 0;
+	param pin;
+	FILE *fp;
+	bibl b;
+
+	process_args( &argc, argv, &pin, &o, &nthreads );
+
+	if ( o.n==0 ) help();
+
+	for ( i=0; i<o.n; ++i ) {
+		if ( !strcmp( o.names[i], "-" ) ) o.fps[i] = stdout;
+		else o.fps[i] = fopen( o.names[i], "w" );
+		if ( !o.fps[i] ) {
+			fprintf( stderr, "%s: Cannot open %s. Exiting.\n", progname, o.names[i] );
+			return EXIT_FAILURE;
+		}
+	}
+
+	bibl_init( &b );
+	if ( argc<2 ) {
+		status = bibl_read( &b, stdin, "stdin", &pin );
+		if ( status ) bibl_reporterr( status );
+	} else {
+		for ( i=1; i<argc; ++i ) {
+			fp = fopen( argv[i], "r" );
+			if ( fp ) bibprog_read( &b, fp, argv[i], &pin );
+			else fprintf( stderr, "%s: Cannot open %s\n", progname, argv[i] );
+		}
+	}
+
+	status = bibl_writemany( &b, o.n, o.fps, o.ps, nthreads );
+	if ( status!=BIBL_OK ) {
+		bibl_reporterr( status );
+		failed = 1;
+	}
+
+	for ( i=0; i<o.n; ++i ) {
+		if ( o.fps[i]==stdout ) fflush( stdout );
+		else if ( fclose( o.fps[i] ) ) {
+			fprintf( stderr, "%s: Error writing %s\n", progname, o.names[i] );
+			failed = 1;
+		}
+		bibl_freeparams( o.ps[i] );
+		free( o.ps[i] );
+	}
+
+	fprintf( stderr, "%s: Processed %ld references into %d outputs.\n", progname, b.n, o.n );
+
+	free( o.ps );
+	free( o.fps );
+	free( o.names );
+	bibl_free( &b );
+	bibl_freeparams( &pin );
+
+	return ( failed ) ? EXIT_FAILURE : EXIT_SUCCESS;
+}
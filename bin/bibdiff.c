@@ -8,128 +8,501 @@
  */
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#ifndef BIBL_NO_THREADS
+#include <pthread.h>
+#endif
 #include "bibutils.h"
-#include "intlist.h"
+#include "hash.h"
+#include "sink.h"
+#include "slist.h"
+#include "strhash.h"
 #include "args.h"
 
 char progname[] = "bibdiff";
 
-/* find_tag_level_matches()
+static void
+memerr( void )
+{
+	fprintf( stderr, "%s: Memory error. Exiting.\n", progname );
+	exit( EXIT_FAILURE );
+}
+
+/* Fields are compared as multisets of (tag, level, value): each field
+ * of the first reference in turn claims the first unclaimed equal field
+ * of the second. The second reference's fields are hashed into chains
+ * kept in field order, and claimed fields are unlinked, so each lookup
+ * only walks fields that are still candidates.
  *
- * Find all possible matches for tag/level combinations
+ * The arrays are reused from reference to reference by one thread.
  */
+typedef struct matcher {
+	int *found1, *found2;  /* index of the matching field, or -1 */
+	int *head, *next;      /* hash chains over the second reference */
+	int max1, max2, maxhead, nhead;
+} matcher;
+
+static void
+matcher_init( matcher *m )
+{
+	m->found1 = m->found2 = m->head = m->next = NULL;
+	m->max1 = m->max2 = m->maxhead = m->nhead = 0;
+}
 
-int
-find_tag_level_matches( fields *f, char *tag, int level, intlist *matchs )
+static void
+matcher_free( matcher *m )
 {
-	int i, n = 0;
-	char *ftag;
-
-	for ( i=0; i<f->n; ++i )
-		intlist_set( matchs, i, 0 );
-
-	for ( i=0; i<f->n; ++i ) {
-		if ( fields_level( f, i ) != level ) continue;
-		ftag = fields_tag( f, i, FIELDS_CHRP_NOLEN );
-		if ( !strcmp( tag, ftag ) ) {
-			intlist_set( matchs, i, 1 );
-			n++;
-		}
-	}
+	free( m->found1 );
+	free( m->found2 );
+	free( m->head );
+	free( m->next );
+	matcher_init( m );
+}
 
-	return n;
+static int *
+resize( int *p, int n )
+{
+	p = ( int * ) realloc( p, sizeof( int ) * n );
+	if ( !p ) memerr();
+	return p;
 }
 
-int
-compare_references( fields *f1, const char *fname1, fields *f2, const char *fname2, long n )
+static void
+matcher_size( matcher *m, int n1, int n2 )
 {
-	int i, j, cnt, cnt1, cnt2, level, diff = 0;
-	intlist found1, found2, matches;
-	char *tag, *data;
+	int nhead = 16;
 
-	intlist_init_fill( &found1, f1->n, -1 );
-	intlist_init_fill( &found2, f2->n, -1 );
-	intlist_init_fill( &matches, f2->n, 0 );
+	while ( nhead < 2*n2 ) nhead *= 2;
 
-	for ( i=0; i<f1->n; ++i ) {
+	if ( n1 > m->max1 ) {
+		m->found1 = resize( m->found1, n1 );
+		m->max1 = n1;
+	}
+	if ( n2 > m->max2 ) {
+		m->found2 = resize( m->found2, n2 );
+		m->next   = resize( m->next, n2 );
+		m->max2 = n2;
+	}
+	if ( nhead > m->maxhead ) {
+		m->head = resize( m->head, nhead );
+		m->maxhead = nhead;
+	}
+	m->nhead = nhead;
+}
 
-		tag   = fields_tag(   f1, i, FIELDS_CHRP_NOLEN );
-		data  = fields_value( f1, i, FIELDS_CHRP_NOLEN );
-		level = fields_level( f1, i );
+static unsigned int
+field_hash( fields *f, int i )
+{
+	char *tag   = fields_tag(   f, i, FIELDS_CHRP_NOLEN );
+	char *value = fields_value( f, i, FIELDS_CHRP_NOLEN );
+	unsigned int h;
+
+	h = calculate_hash_strn( tag, strlen( tag ), 0 );
+	h = h * 31 + calculate_hash_strn( value, strlen( value ), 0 );
+	h = h * 31 + ( unsigned int ) fields_level( f, i );
 
-		cnt = find_tag_level_matches( f2, tag, level, &matches );
+	return h;
+}
 
-		/* ...no matches */
-		if ( cnt==0 ) continue;
+static int
+field_equal( fields *f1, int i, fields *f2, int j )
+{
+	if ( fields_level( f1, i ) != fields_level( f2, j ) ) return 0;
+	if ( strcmp( fields_tag( f1, i, FIELDS_CHRP_NOLEN ), fields_tag( f2, j, FIELDS_CHRP_NOLEN ) ) ) return 0;
+	if ( strcmp( fields_value( f1, i, FIELDS_CHRP_NOLEN ), fields_value( f2, j, FIELDS_CHRP_NOLEN ) ) ) return 0;
+	return 1;
+}
+
+/* compare_references()
+ *
+ * Print the fields found in only one of the two references to out,
+ * under a line naming them; returns 1 if there were any
+ */
+static int
+compare_references( matcher *m, sink *out, fields *f1, const char *fname1, long n1,
+		fields *f2, const char *fname2, long n2 )
+{
+	int i, j, prev, bucket, cnt1 = 0, cnt2 = 0;
+	unsigned int mask;
+
+	matcher_size( m, f1->n, f2->n );
+	mask = ( unsigned int ) m->nhead - 1;
+
+	for ( i=0; i<m->nhead; ++i ) m->head[i] = -1;
+	for ( j=f2->n-1; j>=0; --j ) {
+		bucket = field_hash( f2, j ) & mask;
+		m->next[j] = m->head[bucket];
+		m->head[bucket] = j;
+		m->found2[j] = -1;
+	}
 
-		for ( j=0; j<f2->n; ++j ) {
-			if ( intlist_get( &matches, j ) == 0 ) continue; /* not a potential match */
-			if ( intlist_get( &found2, j ) != -1 ) continue; /* already claimed */
-			if ( strcmp( data, fields_value( f2, j, FIELDS_CHRP_NOLEN ) ) ) continue; /* values don't match */
-			intlist_set( &found1, i, j );
-			intlist_set( &found2, j, i );
+	for ( i=0; i<f1->n; ++i ) {
+		m->found1[i] = -1;
+		bucket = field_hash( f1, i ) & mask;
+		prev = -1;
+		for ( j=m->head[bucket]; j!=-1; prev=j, j=m->next[j] ) {
+			if ( !field_equal( f1, i, f2, j ) ) continue;
+			if ( prev==-1 ) m->head[bucket] = m->next[j];
+			else m->next[prev] = m->next[j];
+			m->found1[i] = j;
+			m->found2[j] = i;
+			cnt1++;
+			cnt2++;
 			break;
 		}
 	}
 
-	cnt1 = 0;
-	for ( i=0; i<f1->n; ++i )
-		if ( intlist_get( &found1, i ) != -1 ) cnt1++;
+	if ( cnt1==f1->n && cnt2==f2->n ) return 0;
+
+	if ( n1==n2 ) sink_printf( out, "reference %ld < %s > %s\n", n1, fname1, fname2 );
+	else sink_printf( out, "reference %ld < %s, reference %ld > %s\n", n1, fname1, n2, fname2 );
+
+	for ( i=0; i<f1->n; ++i ) {
+		if ( m->found1[i] != -1 ) continue;
+		sink_printf( out, "< '%s' '%s' %d\n", fields_tag( f1, i, FIELDS_CHRP_NOLEN ),
+			fields_value( f1, i, FIELDS_CHRP_NOLEN ), fields_level( f1, i ) );
+	}
+
+	for ( j=0; j<f2->n; ++j ) {
+		if ( m->found2[j] != -1 ) continue;
+		sink_printf( out, "> '%s' '%s' %d\n", fields_tag( f2, j, FIELDS_CHRP_NOLEN ),
+			fields_value( f2, j, FIELDS_CHRP_NOLEN ), fields_level( f2, j ) );
+	}
+
+	return 1;
+}
+
+/* References are paired up by what identifies them rather than by
+ * position: first by citekey, then by DOI, then by title, each pass
+ * only looking at references the earlier ones left unpaired. The k-th
+ * unpaired reference of the first file with a key is paired with the
+ * k-th of the second with the same key. References still unpaired are
+ * finally paired by position unless they differ in DOI or title, which
+ * keeps the old behavior for files that line up.
+ */
+#define ALIGN_CITEKEY (0)
+#define ALIGN_DOI     (1)
+#define ALIGN_TITLE   (2)
+
+static void
+add_letters( str *key, const char *p )
+{
+	for ( ; *p; ++p )
+		if ( !isascii( (unsigned char)*p ) || isalnum( (unsigned char)*p ) )
+			str_addchar( key, tolower( (unsigned char)*p ) );
+}
 
-	cnt2 = 0;
-	for ( i=0; i<f2->n; ++i )
-		if ( intlist_get( &found2, i ) != -1 ) cnt2++;
+static void
+identity_key( fields *f, int type, str *key )
+{
+	char *v;
 
-	if ( cnt1!=f1->n || cnt2!=f2->n ) {
+	str_empty( key );
 
-		printf( "reference %ld < %s > %s\n", n, fname1, fname2 );
+	if ( type==ALIGN_CITEKEY ) {
+		v = ( char * ) fields_findv( f, LEVEL_MAIN, FIELDS_CHRP_NOLEN, "REFNUM" );
+		if ( v ) str_strcpyc( key, v );
+	}
 
-		for ( i=0; i<f1->n; ++i ) {
-			if ( intlist_get( &found1, i ) != -1 ) continue;
-			tag = fields_tag( f1, i, FIELDS_CHRP_NOLEN );
-			data = fields_value( f1, i, FIELDS_CHRP_NOLEN );
-			level = fields_level( f1, i );
-			printf( "< '%s' '%s' %d\n", tag, data, level );
+	else if ( type==ALIGN_DOI ) {
+		v = ( char * ) fields_findv( f, LEVEL_ANY, FIELDS_CHRP_NOLEN, "DOI" );
+		if ( v ) {
+			str_strcpyc( key, v );
+			str_tolower( key );
 		}
+	}
+
+	/* titles are matched on their letters and digits only, ignoring
+	 * case, so a change of punctuation or brace protection doesn't
+	 * break the pairing */
+	else {
+		v = ( char * ) fields_findv( f, LEVEL_MAIN, FIELDS_CHRP_NOLEN, "TITLE" );
+		if ( !v ) return;
+		add_letters( key, v );
+		v = ( char * ) fields_findv( f, LEVEL_MAIN, FIELDS_CHRP_NOLEN, "SUBTITLE" );
+		if ( !v ) return;
+		add_letters( key, v );
+	}
 
-		for ( i=0; i<f2->n; ++i ) {
-			if ( intlist_get( &found2, i ) != -1 ) continue;
-			tag = fields_tag( f2, i, FIELDS_CHRP_NOLEN );
-			data = fields_value( f2, i, FIELDS_CHRP_NOLEN );
-			level = fields_level( f2, i );
-			printf( "> '%s' '%s' %d\n", tag, data, level );
+	if ( str_memerr( key ) ) memerr();
+}
+
+static void
+align_by( bibl *b1, bibl *b2, long *match1, long *match2, int type )
+{
+	slist keys2;
+	strhash index;
+	long i, *next;
+	str key, *k;
+	int j;
+
+	next = ( long * ) malloc( sizeof( long ) * ( b2->n + 1 ) );
+	if ( !next ) memerr();
+
+	slist_init( &keys2 );
+	strhash_init( &index, STRHASH_CASE );
+	str_init( &key );
+
+	for ( i=0; i<b2->n; ++i ) {
+		if ( match2[i]==-1 ) identity_key( b2->ref[i], type, &key );
+		else str_empty( &key );
+		if ( slist_add( &keys2, &key ) != SLIST_OK ) memerr();
+	}
+
+	/* chains of equal keys, in file order, headed from the index */
+	for ( i=b2->n-1; i>=0; --i ) {
+		k = slist_str( &keys2, i );
+		if ( str_is_empty( k ) ) continue;
+		j = strhash_findn( &index, str_cstr( k ), k->len );
+		next[i] = j;
+		if ( strhash_setn( &index, str_cstr( k ), k->len, ( int ) i ) != STRHASH_OK ) memerr();
+	}
+
+	for ( i=0; i<b1->n; ++i ) {
+		if ( match1[i]!=-1 ) continue;
+		identity_key( b1->ref[i], type, &key );
+		if ( str_is_empty( &key ) ) continue;
+		j = strhash_findn( &index, str_cstr( &key ), key.len );
+		if ( j==-1 ) continue;
+		match1[i] = j;
+		match2[j] = i;
+		k = slist_str( &keys2, j );
+		if ( next[j]==-1 ) strhash_removen( &index, str_cstr( k ), k->len );
+		else if ( strhash_setn( &index, str_cstr( k ), k->len, ( int ) next[j] ) != STRHASH_OK ) memerr();
+	}
+
+	str_free( &key );
+	strhash_free( &index );
+	slist_free( &keys2 );
+	free( next );
+}
+
+/* citekeys are often regenerated, so only a differing DOI or title
+ * keeps two references at the same position apart */
+static int
+conflicting( fields *f1, fields *f2 )
+{
+	int type, ret = 0;
+	str key1, key2;
+
+	strs_init( &key1, &key2, NULL );
+	for ( type=ALIGN_DOI; type<=ALIGN_TITLE && !ret; ++type ) {
+		identity_key( f1, type, &key1 );
+		identity_key( f2, type, &key2 );
+		if ( str_is_empty( &key1 ) || str_is_empty( &key2 ) ) continue;
+		ret = strcmp( str_cstr( &key1 ), str_cstr( &key2 ) );
+	}
+	strs_free( &key1, &key2, NULL );
+
+	return ret;
+}
+
+static void
+align_bibliographies( bibl *b1, bibl *b2, long *match1, long *match2 )
+{
+	long i;
+
+	for ( i=0; i<b1->n; ++i ) match1[i] = -1;
+	for ( i=0; i<b2->n; ++i ) match2[i] = -1;
+
+	align_by( b1, b2, match1, match2, ALIGN_CITEKEY );
+	align_by( b1, b2, match1, match2, ALIGN_DOI );
+	align_by( b1, b2, match1, match2, ALIGN_TITLE );
+
+	for ( i=0; i<b1->n && i<b2->n; ++i ) {
+		if ( match1[i]!=-1 || match2[i]!=-1 ) continue;
+		if ( conflicting( b1->ref[i], b2->ref[i] ) ) continue;
+		match1[i] = i;
+		match2[i] = i;
+	}
+}
+
+/* find_moved()
+ *
+ * A paired reference has moved if it is out of order with respect to
+ * the others; the largest set that is in the same order in both files
+ * (the longest increasing subsequence of second-file positions, taken
+ * in first-file order) stays, everything else paired is reported as
+ * moved. O(n log n).
+ */
+static char *
+find_moved( long *match1, long n1 )
+{
+	long i, lo, hi, mid, len = 0, *tails, *prev;
+	char *moved;
+
+	moved = ( char * ) calloc( n1 + 1, sizeof( char ) );
+	tails = ( long * ) malloc( sizeof( long ) * ( n1 + 1 ) );
+	prev  = ( long * ) malloc( sizeof( long ) * ( n1 + 1 ) );
+	if ( !moved || !tails || !prev ) memerr();
+
+	for ( i=0; i<n1; ++i ) {
+		if ( match1[i]==-1 ) continue;
+		lo = 0;
+		hi = len;
+		while ( lo < hi ) {
+			mid = ( lo + hi ) / 2;
+			if ( match1[ tails[mid] ] < match1[i] ) lo = mid + 1;
+			else hi = mid;
 		}
+		prev[i] = ( lo > 0 ) ? tails[lo-1] : -1;
+		tails[lo] = i;
+		if ( lo==len ) len++;
+		moved[i] = 1;
+	}
 
+	for ( i = ( len > 0 ) ? tails[len-1] : -1; i!=-1; i=prev[i] )
+		moved[i] = 0;
+
+	free( tails );
+	free( prev );
+
+	return moved;
+}
+
+static const char *
+reference_label( fields *f )
+{
+	char *v;
+
+	v = ( char * ) fields_findv( f, LEVEL_MAIN, FIELDS_CHRP_NOLEN, "REFNUM" );
+	if ( v ) return v;
+	v = ( char * ) fields_findv( f, LEVEL_MAIN, FIELDS_CHRP_NOLEN, "TITLE" );
+	if ( v ) return v;
+	return "";
+}
+
+/* The report for the first file's references [begin,end), in order;
+ * ranges are independent so they can be made in parallel and printed
+ * one after the other.
+ */
+typedef struct diffjob {
+	bibl *b1, *b2;
+	const char *fname1, *fname2;
+	long *match1;
+	char *moved;
+	long begin, end;
+	str out;
+} diffjob;
+
+static void *
+diff_range( void *arg )
+{
+	diffjob *job = ( diffjob * ) arg;
+	matcher m;
+	sink out;
+	long i, j;
+
+	matcher_init( &m );
+	sink_init_str( &out, &(job->out) );
+
+	for ( i=job->begin; i<job->end; ++i ) {
+		j = job->match1[i];
+		if ( j==-1 ) {
+			sink_printf( &out, "reference %ld < %s only: %s\n", i+1, job->fname1,
+				reference_label( job->b1->ref[i] ) );
+			continue;
+		}
+		if ( job->moved[i] )
+			sink_printf( &out, "reference %ld < %s, reference %ld > %s moved: %s\n", i+1, job->fname1,
+				j+1, job->fname2, reference_label( job->b1->ref[i] ) );
+		compare_references( &m, &out, job->b1->ref[i], job->fname1, i+1,
+				job->b2->ref[j], job->fname2, j+1 );
 	}
 
-	intlist_free( &found1 );
-	intlist_free( &found2 );
-	intlist_free( &matches );
+	if ( sink_free( &out ) != SINK_OK ) memerr();
+	matcher_free( &m );
+
+	return NULL;
+}
 
-	return diff;
+static void
+diff_ranges( diffjob *jobs, int njobs )
+{
+#ifndef BIBL_NO_THREADS
+	pthread_t *threads;
+	int i;
+
+	if ( njobs > 1 ) {
+		threads = ( pthread_t * ) malloc( sizeof( pthread_t ) * njobs );
+		if ( !threads ) memerr();
+		for ( i=0; i<njobs; ++i ) {
+			if ( pthread_create( &(threads[i]), NULL, diff_range, &(jobs[i]) ) ) {
+				fprintf( stderr, "%s: Cannot start thread. Exiting.\n", progname );
+				exit( EXIT_FAILURE );
+			}
+		}
+		for ( i=0; i<njobs; ++i )
+			pthread_join( threads[i], NULL );
+		free( threads );
+		return;
+	}
+#endif
+	diff_range( &(jobs[0]) );
 }
 
 int
-compare_bibliographies( bibl *b1, const char *fname1, bibl *b2, const char *fname2 )
+compare_bibliographies( bibl *b1, const char *fname1, bibl *b2, const char *fname2, int nthreads )
 {
-	fields *f1, *f2;
-	long i;
+	long i, *match1, *match2, per;
+	diffjob *jobs;
+	char *moved;
+	int njobs;
 
 	if ( b1->n != b2->n ) {
 		printf( "%s: %s has %ld references and %s has %ld references\n", progname,
 			fname1, b1->n, fname2, b2->n );
-		return 1;
 	}
 
-	for ( i=0; i<b1->n; ++i ) {
-		f1 = b1->ref[i];
-		f2 = b2->ref[i];
-		if ( compare_references( f1, fname1, f2, fname2, i+1 ) ) return 1;
+	match1 = ( long * ) malloc( sizeof( long ) * ( b1->n + 1 ) );
+	match2 = ( long * ) malloc( sizeof( long ) * ( b2->n + 1 ) );
+	if ( !match1 || !match2 ) memerr();
+
+	align_bibliographies( b1, b2, match1, match2 );
+	moved = find_moved( match1, b1->n );
+
+#ifdef BIBL_NO_THREADS
+	nthreads = 1;
+#endif
+	njobs = ( nthreads < 1 ) ? 1 : nthreads;
+	if ( njobs > b1->n ) njobs = ( b1->n > 0 ) ? b1->n : 1;
+	per = ( b1->n + njobs - 1 ) / njobs;
+
+	jobs = ( diffjob * ) malloc( sizeof( diffjob ) * njobs );
+	if ( !jobs ) memerr();
+
+	for ( i=0; i<njobs; ++i ) {
+		jobs[i].b1     = b1;
+		jobs[i].b2     = b2;
+		jobs[i].fname1 = fname1;
+		jobs[i].fname2 = fname2;
+		jobs[i].match1 = match1;
+		jobs[i].moved  = moved;
+		jobs[i].begin  = ( i*per < b1->n ) ? i*per : b1->n;
+		jobs[i].end    = ( (i+1)*per < b1->n ) ? (i+1)*per : b1->n;
+		str_init( &(jobs[i].out) );
+	}
+
+	diff_ranges( jobs, njobs );
+
+	for ( i=0; i<njobs; ++i ) {
+		if ( jobs[i].out.len ) fwrite( str_cstr( &(jobs[i].out) ), 1, jobs[i].out.len, stdout );
+		str_free( &(jobs[i].out) );
+	}
+
+	for ( i=0; i<b2->n; ++i ) {
+		if ( match2[i]!=-1 ) continue;
+		printf( "reference %ld > %s only: %s\n", i+1, fname2, reference_label( b2->ref[i] ) );
 	}
 
+	free( jobs );
+	free( moved );
+	free( match1 );
+	free( match2 );
+
 	return 0;
 }
-
 void
 version( void )
 {
@@ -141,7 +514,9 @@ void
 help( void )
 {
 	args_tellversion( progname );
-	fprintf( stderr, "Compares references after reading them from their native formats\n\n" );
+	fprintf( stderr, "Compares references after reading them from their native formats\n" );
+	fprintf( stderr, "References are paired by citekey, DOI or title; unpaired ones are\n" );
+	fprintf( stderr, "reported as only in one file, and paired ones out of order as moved\n\n" );
 
 	fprintf( stderr, "usage: %s ref1_file ref2_file\n\n", progname );
 
@@ -149,6 +524,7 @@ help( void )
 	fprintf( stderr, "-v,  --version            display version\n" );
 	fprintf( stderr, "-f1, --format1 FORMAT     specify input format for ref1_file\n" );
 	fprintf( stderr, "-f2, --format2 FORMAT     specify input format for ref1_file\n" );
+	fprintf( stderr, "-j,  --threads N          compare references with N threads\n" );
 	fprintf( stderr, "\n" );
 
 	fprintf( stderr, "Valid format specifiers are 'bibtex', 'biblatex', 'copac', 'ebi', "
@@ -188,7 +564,7 @@ lookup_format( const char *format )
 }
 
 void
-process_args( int *argc, char *argv[], int *format1, int *format2 )
+process_args( int *argc, char *argv[], int *format1, int *format2, int *nthreads )
 {
 	int i, j, done, subtract;
 	char *f1, *f2;
@@ -213,6 +589,10 @@ process_args( int *argc, char *argv[], int *format1, int *format2 )
 			*format2 = lookup_format( f2 );
 			subtract = 2;
 		}
+		else if ( args_match( argv[i], "-j", "--threads" ) ) {
+			*nthreads = atoi( args_next( *argc, argv, i, progname, "-j", "--threads" ) );
+			subtract = 2;
+		}
 		else if ( !strcmp( argv[i], "--" ) ) {
 			done = 1;
 			subtract = 1;
@@ -235,12 +615,13 @@ main( int argc, char *argv[] )
 {
 	int format1 = BIBL_MODSIN;
 	int format2 = BIBL_MODSIN;
+	int nthreads = 1;
 	param p1, p2;
 	bibl b1, b2;
 	int status;
 	FILE *fp;
 
-	process_args( &argc, argv, &format1, &format2 );
+	process_args( &argc, argv, &format1, &format2, &nthreads );
 
 	if ( argc < 2 ) help();
 
@@ -275,7 +656,10 @@ main( int argc, char *argv[] )
 		return EXIT_FAILURE;
 	}
 
-	compare_bibliographies( &b1, argv[1], &b2, argv[2] );
+	compare_bibliographies( &b1, argv[1], &b2, argv[2], nthreads );
+
+	bibl_free( &b1 );
+	bibl_free( &b2 );
 
 	bibl_freeparams( &p1 );
 	bibl_freeparams( &p2 );
@@ -0,0 +1,324 @@
+/*
+ * bibindex.c
+ *
+ * Copyright (c) Chris Putnam 2021
+ *
+ * Program and source code released under the GPL version 2
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bibutils.h"
+#include "bibindex.h"
+#include "args.h"
+
+char progname[] = "bibindex";
+
+void
+version( void )
+{
+	args_tellversion( progname );
+	exit( EXIT_FAILURE );
+}
+
+void
+help( void )
+{
+	args_tellversion( progname );
+	fprintf( stderr, "Indexes a reference file by citekey, DOI and PubMed id, and reads\n"
+		"single references from it through the index\n\n" );
+
+	fprintf( stderr, "usage: %s [-f FORMAT] ref_file            write ref_file.bibindex\n", progname );
+	fprintf( stderr, "       %s -x [-t FORMAT] ref_file KEY...  write the references named by KEYs\n\n", progname );
+
+	fprintf( stderr, "-h, --help                display this help\n" );
+	fprintf( stderr, "-v, --version             display version\n" );
+	fprintf( stderr, "-f, --format FORMAT       specify input format when indexing (default mods)\n" );
+	fprintf( stderr, "-x, --extract             write references instead of indexing\n" );
+	fprintf( stderr, "-t, --to FORMAT           specify output format when extracting (default mods)\n" );
+	fprintf( stderr, "-k, --keys FILE           read further KEYs from FILE, one per line\n" );
+	fprintf( stderr, "--index FILE              use FILE for the index (default ref_file.bibindex)\n" );
+	fprintf( stderr, "-i, --input-encoding      input character encoding\n" );
+	fprintf( stderr, "-o, --output-encoding     output character encoding\n" );
+	fprintf( stderr, "--verbose                 report all warnings\n" );
+	fprintf( stderr, "\n" );
+
+	fprintf( stderr, "Valid input formats are 'bibtex', 'biblatex', 'copac', 'ebi', 'endnote', "
+		"'endnote-xml', 'isi', 'medline', 'mods', 'nbib', 'ris', 'word2007'\n" );
+	fprintf( stderr, "Valid output formats are 'ads', 'bibtex', 'biblatex', 'endnote', 'isi', "
+		"'mods', 'nbib', 'ris', 'word2007'\n\n" );
+
+	exit( EXIT_FAILURE );
+}
+
+static void
+memerr( void )
+{
+	fprintf( stderr, "%s: Memory error. Exiting.\n", progname );
+	exit( EXIT_FAILURE );
+}
+
+typedef struct {
+	int   extract;
+	int   informat, outformat;
+	char  *index;
+	char  *keyfile;
+	char  *charsetin;
+	char  *charsetout;
+	int   verbose;
+} options;
+
+void
+process_args( int *argc, char *argv[], options *o )
+{
+	int i, j, subtract;
+
+	i = 1;
+	while ( i < *argc ) {
+		subtract = 0;
+		if ( args_match( argv[i], "-h", "--help" ) ) {
+			help();
+		} else if ( args_match( argv[i], "-v", "--version" ) ) {
+			version();
+		} else if ( args_match( argv[i], "-f", "--format" ) ) {
+			o->informat = args_informat( progname, args_next( *argc, argv, i, progname, "-f", "--format" ) );
+			subtract = 2;
+		} else if ( args_match( argv[i], "-t", "--to" ) ) {
+			o->outformat = args_outformat( progname, args_next( *argc, argv, i, progname, "-t", "--to" ) );
+			subtract = 2;
+		} else if ( args_match( argv[i], "-x", "--extract" ) ) {
+			o->extract = 1;
+			subtract = 1;
+		} else if ( args_match( argv[i], "-k", "--keys" ) ) {
+			o->keyfile = args_next( *argc, argv, i, progname, "-k", "--keys" );
+			subtract = 2;
+		} else if ( args_match( argv[i], "--index", "" ) ) {
+			o->index = args_next( *argc, argv, i, progname, "--index", "" );
+			subtract = 2;
+		} else if ( args_match( argv[i], "-i", "--input-encoding" ) ) {
+			o->charsetin = args_next( *argc, argv, i, progname, "-i", "--input-encoding" );
+			subtract = 2;
+		} else if ( args_match( argv[i], "-o", "--output-encoding" ) ) {
+			o->charsetout = args_next( *argc, argv, i, progname, "-o", "--output-encoding" );
+			subtract = 2;
+		} else if ( args_match( argv[i], "--verbose", "" ) ) {
+			o->verbose = 1;
+			subtract = 1;
+		} else if ( !strcmp( argv[i], "--" ) ) {
+			subtract = 1;
+			for ( j=i+subtract; j<*argc; ++j )
+				argv[j-subtract] = argv[j];
+			*argc -= subtract;
+			break;
+		} else if ( argv[i][0]=='-' && argv[i][1]!='\0' ) {
+			fprintf( stderr, "%s: Unrecognized command-line switch '%s'. Exiting.\n", progname, argv[i] );
+			exit( EXIT_FAILURE );
+		}
+		if ( subtract ) {
+			for ( j=i+subtract; j<*argc; ++j )
+				argv[j-subtract] = argv[j];
+			*argc -= subtract;
+		} else i++;
+	}
+}
+
+/* init_params()
+ *
+ * The encoding switches are applied through the usual args_*charset()
+ * calls, which take them from an argument vector.
+ */
+static void
+init_params( param *p, int informat, int outformat, options *o )
+{
+	char *argv[2];
+
+	if ( bibl_initparams( p, informat, outformat, progname )!=BIBL_OK ) memerr();
+
+	if ( o->charsetin ) {
+		argv[0] = "-i";
+		argv[1] = o->charsetin;
+		args_inputcharset( 2, argv, 0, p );
+	}
+	if ( o->charsetout ) {
+		argv[0] = "-o";
+		argv[1] = o->charsetout;
+		args_outputcharset( 2, argv, 0, p );
+	}
+	if ( o->verbose ) p->verbose = 1;
+}
+
+static char *
+index_name( options *o, char *filename, str *name )
+{
+	if ( o->index ) return o->index;
+	str_strcpyc( name, filename );
+	str_strcatc( name, ".bibindex" );
+	if ( str_memerr( name ) ) memerr();
+	return str_cstr( name );
+}
+
+static int
+build( options *o, char *filename )
+{
+	char *indexname;
+	bibindex x;
+	int status;
+	param p;
+	str name;
+	FILE *fp;
+
+	str_init( &name );
+	bibindex_init( &x );
+	init_params( &p, o->informat, BIBL_MODSOUT, o );
+
+	indexname = index_name( o, filename, &name );
+
+	status = bibindex_buildfile( &x, filename, &p );
+	if ( status==BIBL_OK ) {
+		fp = fopen( indexname, "wb" );
+		if ( fp ) {
+			status = bibindex_save( &x, fp );
+			if ( fclose( fp ) && status==BIBL_OK ) status = BIBL_ERR_CANTOPEN;
+		} else status = BIBL_ERR_CANTOPEN;
+		if ( status!=BIBL_OK )
+			fprintf( stderr, "%s: Cannot write %s\n", progname, indexname );
+	} else if ( status==BIBL_ERR_CANTOPEN ) {
+		fprintf( stderr, "%s: Cannot open %s\n", progname, filename );
+	} else bibl_reporterr( status );
+
+	if ( status==BIBL_OK )
+		fprintf( stderr, "%s: Indexed %ld records and %d keys of %s in %s.\n",
+			progname, x.n, x.keys.n, filename, indexname );
+
+	bibl_freeparams( &p );
+	bibindex_free( &x );
+	str_free( &name );
+
+	return status;
+}
+
+static int
+find_key( bibindex *x, const char *key, intlist *recs )
+{
+	int n;
+
+	n = bibindex_find( x, key, recs );
+	if ( n==BIBL_ERR_MEMERR ) memerr();
+	if ( n==0 ) fprintf( stderr, "%s: No reference for '%s'\n", progname, key );
+
+	return ( n>0 );
+}
+
+static int
+find_keyfile( bibindex *x, const char *keyfile, intlist *recs )
+{
+	int found = 1;
+	str line;
+	FILE *fp;
+
+	fp = fopen( keyfile, "r" );
+	if ( !fp ) {
+		fprintf( stderr, "%s: Cannot open %s\n", progname, keyfile );
+		return 0;
+	}
+
+	str_init( &line );
+	while ( str_fgetline( &line, fp ) ) {
+		str_trimstartingws( &line );
+		str_trimendingws( &line );
+		if ( line.len==0 ) continue;
+		if ( !find_key( x, str_cstr( &line ), recs ) ) found = 0;
+	}
+	str_free( &line );
+	fclose( fp );
+
+	return found;
+}
+
+static int
+extract( options *o, char *filename, int nkeys, char *keys[] )
+{
+	int i, found = 1, status;
+	FILE *ifp, *fp;
+	char *indexname;
+	intlist recs;
+	bibindex x;
+	param p;
+	str name;
+	bibl b;
+
+	str_init( &name );
+	bibindex_init( &x );
+	intlist_init( &recs );
+	bibl_init( &b );
+
+	indexname = index_name( o, filename, &name );
+
+	ifp = fopen( indexname, "rb" );
+	if ( !ifp ) {
+		fprintf( stderr, "%s: Cannot open %s; build it with %s %s\n", progname, indexname, progname, filename );
+		exit( EXIT_FAILURE );
+	}
+	status = bibindex_load( &x, ifp );
+	fclose( ifp );
+	if ( status!=BIBL_OK ) {
+		fprintf( stderr, "%s: %s is not a usable index\n", progname, indexname );
+		exit( EXIT_FAILURE );
+	}
+
+	for ( i=0; i<nkeys; ++i )
+		if ( !find_key( &x, keys[i], &recs ) ) found = 0;
+	if ( o->keyfile && !find_keyfile( &x, o->keyfile, &recs ) ) found = 0;
+
+	/* the index knows the format of the file */
+	init_params( &p, x.format, o->outformat, o );
+
+	fp = fopen( filename, "rb" );
+	if ( !fp ) {
+		fprintf( stderr, "%s: Cannot open %s\n", progname, filename );
+		exit( EXIT_FAILURE );
+	}
+	status = bibindex_read( &x, fp, &recs, &b, filename, &p );
+	fclose( fp );
+
+	if ( status==BIBL_ERR_BADINPUT )
+		fprintf( stderr, "%s: %s has changed since %s was built\n", progname, filename, indexname );
+	else if ( status!=BIBL_OK )
+		bibl_reporterr( status );
+	else {
+		status = bibl_write( &b, stdout, &p );
+		if ( status!=BIBL_OK ) bibl_reporterr( status );
+	}
+
+	if ( status==BIBL_OK && !found ) status = BIBL_ERR_BADINPUT;
+
+	bibl_free( &b );
+	bibl_freeparams( &p );
+	intlist_free( &recs );
+	bibindex_free( &x );
+	str_free( &name );
+
+	return status;
+}
+
+int
+main( int argc, char *argv[] )
+{
+	options o = { 0, BIBL_MODSIN, BIBL_MODSOUT, NULL, NULL, NULL, NULL, 0 };
+	int status;
+
+	process_args( &argc, argv, &o );
+
+	if ( argc<2 ) help();
+
+	if ( o.extract ) {
+		if ( argc<3 && !o.keyfile ) help();
+		status = extract( &o, argv[1], argc-2, argv+2 );
+	} else {
+		if ( argc!=2 ) help();
+		status = build( &o, argv[1] );
+	}
+
+	return ( status==BIBL_OK ) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
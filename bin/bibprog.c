@@ -7,9 +7,296 @@
  *
  */
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
 #include "bibutils.h"
+#include "bibsock.h"
 #include "bibprog.h"
 
+static const char *savefile = NULL;
+static const char *server = NULL;
+static const char *incfile = NULL;
+
+/* bibprog_save()
+ *
+ * Also write the references read to filename with bibl_save(); any
+ * of the programs can then take that file as input in place of the
+ * original, skipping the parsing.
+ */
+void
+bibprog_save( const char *filename )
+{
+	savefile = filename;
+}
+
+/* bibprog_server()
+ *
+ * Hand the conversion to a bibserve listening on the Unix socket at
+ * path, rather than converting here. The program falls back to
+ * converting itself when there is no server, or when the server could
+ * not do the same job: with --save, -s, asis/corps lists, or saved
+ * input.
+ */
+void
+bibprog_server( const char *path )
+{
+	server = path;
+}
+
+/* bibprog_incremental()
+ *
+ * Keep the converted references in filename between runs, so that a
+ * run only converts the records changed since the last; the output
+ * is the same as without. Not used with --save, -s, or saved input.
+ */
+void
+bibprog_incremental( const char *filename )
+{
+	incfile = filename;
+}
+
+/* bibprog_read()
+ *
+ * Read fp, opened on filename, into b, loading it instead if it was
+ * written by bibl_save(); fp is closed.
+ */
+void
+bibprog_read( bibl *b, FILE *fp, char *filename, param *p )
+{
+	int err;
+
+	if ( fp!=stdin && bibl_issaved( fp ) ) {
+		fp = freopen( filename, "rb", fp );
+		if ( !fp ) {
+			if ( p->progname ) fprintf( stderr, "%s: ", p->progname );
+			fprintf( stderr, "Cannot open %s\n", filename );
+			exit( EXIT_FAILURE );
+		}
+		err = bibl_load( b, fp );
+	} else {
+		err = bibl_read( b, fp, filename, p );
+	}
+	if ( err ) bibl_reporterr( err );
+	fclose( fp );
+}
+
+static void
+bibprog_write_save( bibl *b, param *p )
+{
+	FILE *fp;
+	int err;
+
+	fp = fopen( savefile, "wb" );
+	if ( !fp ) {
+		if( p->progname ) fprintf( stderr, "%s: ", p->progname );
+		fprintf( stderr, "Cannot open --save file '%s'\n", savefile );
+		return;
+	}
+	err = bibl_save( b, fp );
+	if ( err ) bibl_reporterr( err );
+	fclose( fp );
+}
+
+static void
+bibprog_servererr( param *p, const char *msg )
+{
+	if( p->progname ) fprintf( stderr, "%s: ", p->progname );
+	fprintf( stderr, msg, server );
+}
+
+/* bibprog_serve()
+ *
+ * Returns 1 if the conversion was done by the server, or 0 if it
+ * should be done here; nothing has been read from the inputs then.
+ */
+static int
+bibprog_serve( int argc, char *argv[], param *p )
+{
+	FILE *in = NULL, *out = NULL, *fp;
+	int fd, i, status, saved = 0;
+	bibsock_request r;
+	long nrefs;
+
+	if ( savefile || p->singlerefperfile ) return 0;
+	if ( p->asis.names.n || p->corps.names.n ) return 0;
+
+	for ( i=1; i<argc && !saved; ++i ) {
+		fp = fopen( argv[i], "r" );
+		if ( !fp ) continue;
+		saved = bibl_issaved( fp );
+		fclose( fp );
+	}
+	if ( saved ) return 0;
+
+	fd = bibsock_connect( server );
+	if ( fd<0 ) {
+		bibprog_servererr( p, "Cannot connect to server '%s', converting here\n" );
+		return 0;
+	}
+
+	in  = fdopen( fd, "r" );
+	out = fdopen( dup( fd ), "w" );
+	if ( !in || !out ) {
+		bibprog_servererr( p, "Cannot connect to server '%s', converting here\n" );
+		if ( in ) fclose( in );
+		else close( fd );
+		if ( out ) fclose( out );
+		return 0;
+	}
+
+	bibsock_request_init( &r );
+	bibsock_request_setparams( &r, p );
+
+	status = BIBSOCK_OK;
+	if ( argc<2 ) {
+		status = bibsock_request_addinput( &r, "stdin", stdin );
+	} else {
+		for ( i=1; i<argc && status==BIBSOCK_OK; ++i ) {
+			fp = fopen( argv[i], "r" );
+			if ( !fp ) continue;
+			status = bibsock_request_addinput( &r, argv[i], fp );
+			fclose( fp );
+		}
+	}
+	if ( status==BIBSOCK_MEMERR ) bibl_reporterr( BIBL_ERR_MEMERR );
+	else if ( status!=BIBSOCK_OK ) bibl_reporterr( BIBL_ERR_BADINPUT );
+
+	if ( status==BIBSOCK_OK ) {
+		if ( bibsock_request_write( out, &r )!=BIBSOCK_OK ||
+		     bibsock_reply_read( in, &status, &nrefs, stdout )!=BIBSOCK_OK ) {
+			bibprog_servererr( p, "Lost connection to server '%s'\n" );
+			exit( EXIT_FAILURE );
+		}
+		fflush( stdout );
+		if ( status!=BIBL_OK ) bibl_reporterr( status );
+		if( p->progname ) fprintf( stderr, "%s: ", p->progname );
+		fprintf( stderr, "Processed %ld references.\n", nrefs );
+	}
+	bibsock_request_free( &r );
+	fclose( out );
+	fclose( in );
+
+	return 1;
+}
+
+static int
+bibprog_readall( FILE *fp, char **buf, unsigned long *len )
+{
+	int status;
+
+	status = source_readall( fp, buf, len, 0 );
+	if ( status==SOURCE_ERR_MEMERR ) return BIBL_ERR_MEMERR;
+	if ( status!=SOURCE_OK ) return BIBL_ERR_CANTOPEN;
+
+	return BIBL_OK;
+}
+
+static void
+bibprog_saveinc( biblinc *c, param *p )
+{
+	int err = BIBL_OK;
+	str tmp;
+	FILE *fp;
+
+	/* replace the old cache only once the new one is complete */
+	str_initstrsc( &tmp, incfile, ".tmp", NULL );
+	if ( str_memerr( &tmp ) ) {
+		bibl_reporterr( BIBL_ERR_MEMERR );
+		str_free( &tmp );
+		return;
+	}
+
+	fp = fopen( str_cstr( &tmp ), "wb" );
+	if ( fp ) {
+		err = biblinc_save( c, fp );
+		if ( fclose( fp ) && err==BIBL_OK ) err = BIBL_ERR_CANTOPEN;
+		if ( err==BIBL_OK && rename( str_cstr( &tmp ), incfile ) ) err = BIBL_ERR_CANTOPEN;
+		if ( err!=BIBL_OK ) remove( str_cstr( &tmp ) );
+	} else err = BIBL_ERR_CANTOPEN;
+
+	if ( err!=BIBL_OK ) {
+		if( p->progname ) fprintf( stderr, "%s: ", p->progname );
+		fprintf( stderr, "Cannot write --incremental file '%s'\n", incfile );
+	}
+
+	str_free( &tmp );
+}
+
+/* bibprog_convertinc()
+ *
+ * Returns 1 if the conversion was done incrementally, or 0 if it
+ * should be done as usual; nothing has been written then.
+ */
+static int
+bibprog_convertinc( int argc, char *argv[], param *p )
+{
+	int i, n = 0, err = BIBL_OK, saved = 0, done = 0;
+	long nrefs = 0, nreused = 0;
+	unsigned long *lens;
+	char **bufs, **names;
+	biblinc old, next;
+	FILE *fp;
+
+	if ( savefile || p->singlerefperfile ) return 0;
+
+	bufs  = ( char ** ) calloc( argc, sizeof( char * ) );
+	names = ( char ** ) calloc( argc, sizeof( char * ) );
+	lens  = ( unsigned long * ) calloc( argc, sizeof( unsigned long ) );
+	if ( !bufs || !names || !lens ) goto out;
+
+	if ( argc<2 ) {
+		names[n] = "stdin";
+		err = bibprog_readall( stdin, &(bufs[n]), &(lens[n]) );
+		n++;
+	} else {
+		for ( i=1; i<argc && err==BIBL_OK && !saved; ++i ) {
+			fp = fopen( argv[i], "r" );
+			if ( !fp ) continue;
+			saved = bibl_issaved( fp );
+			if ( !saved ) {
+				names[n] = argv[i];
+				err = bibprog_readall( fp, &(bufs[n]), &(lens[n]) );
+				n++;
+			}
+			fclose( fp );
+		}
+	}
+	if ( saved || err!=BIBL_OK ) goto out;
+
+	biblinc_init( &old );
+	biblinc_init( &next );
+
+	fp = fopen( incfile, "rb" );
+	if ( fp ) {
+		if ( biblinc_load( &old, fp )!=BIBL_OK ) {
+			if( p->progname ) fprintf( stderr, "%s: ", p->progname );
+			fprintf( stderr, "Ignoring --incremental file '%s', which is not usable\n", incfile );
+		}
+		fclose( fp );
+	}
+
+	err = bibl_convertinc( n, ( const char ** ) bufs, lens, names, stdout, &old, &next, p, &nrefs, &nreused );
+	fflush( stdout );
+	if ( err ) bibl_reporterr( err );
+	else bibprog_saveinc( &next, p );
+
+	if( p->progname ) fprintf( stderr, "%s: ", p->progname );
+	fprintf( stderr, "Processed %ld references, %ld unchanged.\n", nrefs, nreused );
+
+	biblinc_free( &old );
+	biblinc_free( &next );
+	done = 1;
+out:
+	for ( i=0; bufs && i<n; ++i )
+		if ( bufs[i] ) free( bufs[i] );
+	if ( bufs ) free( bufs );
+	if ( names ) free( names );
+	if ( lens ) free( lens );
+
+	return done;
+}
+
 void
 bibprog( int argc, char *argv[], param *p )
 {
@@ -17,6 +304,9 @@ bibprog( int argc, char *argv[], param *p )
 	bibl b;
 	int err, i;
 
+	if ( incfile && bibprog_convertinc( argc, argv, p ) ) return;
+	if ( server && bibprog_serve( argc, argv, p ) ) return;
+
 	bibl_init( &b );
 	if ( argc<2 ) {
 		err = bibl_read( &b, stdin, "stdin", p );
@@ -24,17 +314,15 @@ bibprog( int argc, char *argv[], param *p )
 	} else {
 		for ( i=1; i<argc; ++i ) {
 			fp = fopen( argv[i], "r" );
-			if ( fp ) {
-				err = bibl_read( &b, fp, argv[i], p );
-				if ( err ) bibl_reporterr( err );
-				fclose( fp );
-			}
+			if ( fp ) bibprog_read( &b, fp, argv[i], p );
 		} 
 	}
-	bibl_write( &b, stdout, p );
+	/* save before bibl_write() converts the references for output */
+	if ( savefile ) bibprog_write_save( &b, p );
+	err = bibl_write( &b, stdout, p );
+	if ( err ) bibl_reporterr( err );
 	fflush( stdout );
 	if( p->progname ) fprintf( stderr, "%s: ", p->progname );
 	fprintf( stderr, "Processed %ld references.\n", b.n );
 	bibl_free( &b );
 }
-
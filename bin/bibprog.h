@@ -12,5 +12,9 @@
 #include "bibutils.h"
 
 void bibprog( int argc, char *argv[], param *p );
+void bibprog_save( const char *filename );
+void bibprog_server( const char *path );
+void bibprog_incremental( const char *filename );
+void bibprog_read( bibl *b, FILE *fp, char *filename, param *p );
 
 #endif
@@ -0,0 +1,304 @@
+/*
+ * bibserve.c
+ *
+ * Copyright (c) Chris Putnam 2021
+ *
+ * Program and source code released under the GPL version 2
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <signal.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/socket.h>
+#include "bibutils.h"
+#include "bibformats.h"
+#include "macros.h"
+#include "args.h"
+#include "bibsock.h"
+
+char progname[] = "bibserve";
+
+#define NIN  ( BIBL_LASTIN  - BIBL_FIRSTIN  + 1 )
+#define NOUT ( BIBL_LASTOUT - BIBL_FIRSTOUT + 1 )
+
+/* One initialized param per input/output format pair, built at
+ * startup and only read afterwards; requests work on copies.
+ */
+static param pairs[NIN][NOUT];
+
+static int listenfd = -1;
+static const char *socketpath = NULL;
+
+void
+help( void )
+{
+	args_tellversion( progname );
+	fprintf( stderr, "Serves conversions to the bibutils programs over a Unix domain socket\n\n" );
+
+	fprintf( stderr, "usage: %s -S SOCKET\n\n", progname );
+	fprintf( stderr, "  the programs use the server when given --server SOCKET\n\n" );
+
+	fprintf( stderr, "-h, --help                display this help\n" );
+	fprintf( stderr, "-v, --version             display version\n" );
+	fprintf( stderr, "-S, --socket SOCKET       listen on the Unix domain socket SOCKET\n" );
+	fprintf( stderr, "-j, --threads N           serve N connections at once (default 4)\n" );
+	fprintf( stderr, "-c, --corporation-file    specify file of corporation names\n" );
+	fprintf( stderr, "-as, --asis               specify file of names that shouldn't be mangled\n" );
+	fprintf( stderr, "--verbose                 report connections\n" );
+	fprintf( stderr, "\n" );
+
+	exit( EXIT_FAILURE );
+}
+
+static void
+memerr( void )
+{
+	fprintf( stderr, "%s: Memory error. Exiting.\n", progname );
+	exit( EXIT_FAILURE );
+}
+
+static void
+read_namelist( namelist *nl, const char *filename, const char *what )
+{
+	int status;
+
+	status = namelist_fill( nl, filename );
+	if ( status==NAMELIST_MEMERR ) memerr();
+	if ( status==NAMELIST_CANTOPEN )
+		fprintf( stderr, "%s: Cannot read %s '%s'\n", progname, what, filename );
+}
+
+void
+process_args( int *argc, char *argv[], int *nthreads, int *verbose, namelist *asis, namelist *corps )
+{
+	int i;
+
+	for ( i=1; i<*argc; ++i ) {
+		if ( args_match( argv[i], "-h", "--help" ) ) {
+			help();
+		} else if ( args_match( argv[i], "-v", "--version" ) ) {
+			args_tellversion( progname );
+			exit( EXIT_SUCCESS );
+		} else if ( args_match( argv[i], "-S", "--socket" ) ) {
+			socketpath = args_next( *argc, argv, i, progname, "-S", "--socket" );
+			i++;
+		} else if ( args_match( argv[i], "-j", "--threads" ) ) {
+			*nthreads = atoi( args_next( *argc, argv, i, progname, "-j", "--threads" ) );
+			i++;
+		} else if ( args_match( argv[i], "-c", "--corporation-file" ) ) {
+			read_namelist( corps, args_next( *argc, argv, i, progname, "-c", "--corporation-file" ), "--corporation-file" );
+			i++;
+		} else if ( args_match( argv[i], "-as", "--asis" ) ) {
+			read_namelist( asis, args_next( *argc, argv, i, progname, "-as", "--asis" ), "--asis file" );
+			i++;
+		} else if ( args_match( argv[i], "--verbose", "" ) ) {
+			*verbose = 1;
+		} else {
+			fprintf( stderr, "%s: Unrecognized command-line argument '%s'. Exiting.\n", progname, argv[i] );
+			exit( EXIT_FAILURE );
+		}
+	}
+
+	if ( !socketpath ) help();
+	if ( *nthreads < 1 ) *nthreads = 1;
+}
+
+/* init_pairs()
+ *
+ * Initialize the param of every format pair, sharing one copy of the
+ * asis and corps lists, which are never changed once read.
+ */
+static void
+init_pairs( namelist *asis, namelist *corps )
+{
+	int i, j;
+
+	for ( i=0; i<NIN; ++i ) {
+		for ( j=0; j<NOUT; ++j ) {
+			if ( bibl_initparams( &(pairs[i][j]), BIBL_FIRSTIN+i, BIBL_FIRSTOUT+j, progname )!=BIBL_OK )
+				memerr();
+			pairs[i][j].asis  = *asis;
+			pairs[i][j].corps = *corps;
+		}
+	}
+}
+
+/* convert()
+ *
+ * Run the request r with the server's param for its format pair,
+ * appending the output to out.
+ */
+static int
+convert( bibsock_request *r, str *out, long *nrefs )
+{
+	int i, status = BIBL_OK;
+	macros strings;
+	param p;
+	bibl b;
+
+	*nrefs = 0;
+
+	if ( bibsock_request_check( r )!=BIBL_OK ) return BIBL_ERR_BADINPUT;
+
+	p = pairs[ r->p.readformat - BIBL_FIRSTIN ][ r->p.writeformat - BIBL_FIRSTOUT ];
+	bibsock_request_getparams( r, &p );
+	p.singlerefperfile = 0;
+	p.nthreads         = 0;
+
+	bibl_init( &b );
+
+	/* @STRING macros last for the request, not the server */
+	macros_init( &strings );
+	if ( p.strings ) p.strings = &strings;
+
+	for ( i=0; i<r->n && status==BIBL_OK; ++i )
+		status = bibl_read_mem( &b, r->data[i], r->len[i], r->names[i], &p );
+
+	if ( status==BIBL_OK ) status = bibl_write_mem( &b, out, &p );
+
+	*nrefs = b.n;
+	bibl_free( &b );
+	macros_free( &strings );
+
+	return status;
+}
+
+/* serve()
+ *
+ * Answer the requests on one connection until the client closes it.
+ */
+static void
+serve( int fd, int verbose )
+{
+	int status, n = 0;
+	bibsock_request r;
+	FILE *in, *out;
+	long nrefs;
+	str output;
+
+	in  = fdopen( fd, "r" );
+	out = fdopen( dup( fd ), "w" );
+	if ( !in || !out ) {
+		if ( in ) fclose( in );
+		else close( fd );
+		if ( out ) fclose( out );
+		return;
+	}
+
+	str_init( &output );
+
+	while ( 1 ) {
+		bibsock_request_init( &r );
+		status = bibsock_request_read( in, &r );
+		if ( status!=BIBSOCK_OK ) {
+			if ( status!=BIBSOCK_EOF )
+				fprintf( stderr, "%s: Dropping connection after a bad request\n", progname );
+			bibsock_request_free( &r );
+			break;
+		}
+
+		str_empty( &output );
+		status = convert( &r, &output, &nrefs );
+		bibsock_request_free( &r );
+		n++;
+
+		if ( bibsock_reply_write( out, status, nrefs, &output )!=BIBSOCK_OK ) break;
+		if ( status!=BIBL_OK ) bibl_reporterr( status );
+	}
+
+	if ( verbose ) fprintf( stderr, "%s: Served %d requests on a connection\n", progname, n );
+
+	str_free( &output );
+	fclose( in );
+	fclose( out );
+}
+
+/* worker()
+ *
+ * Accept and serve connections. Running out of descriptors or memory
+ * is waited out, rather than retried at once; any other failure of
+ * accept() ends the thread.
+ */
+static void *
+worker( void *arg )
+{
+	struct timespec pause = { 0, 100000000L };
+	int fd, verbose = *( int * ) arg;
+
+	while ( 1 ) {
+		fd = accept( listenfd, NULL, NULL );
+		if ( fd==-1 ) {
+			if ( errno==EINTR || errno==ECONNABORTED ) continue;
+			if ( errno==EMFILE || errno==ENFILE || errno==ENOBUFS || errno==ENOMEM ) {
+				nanosleep( &pause, NULL );
+				continue;
+			}
+			fprintf( stderr, "%s: Cannot accept connections: %s\n", progname, strerror( errno ) );
+			break;
+		}
+		serve( fd, verbose );
+	}
+
+	return NULL;
+}
+
+static void
+stop( int sig )
+{
+	unlink( socketpath );
+	_exit( EXIT_SUCCESS );
+}
+
+int
+main( int argc, char *argv[] )
+{
+	int i, nthreads = 4, verbose = 0;
+	namelist asis, corps;
+	pthread_t *threads;
+
+	namelist_init( &asis );
+	namelist_init( &corps );
+
+	process_args( &argc, argv, &nthreads, &verbose, &asis, &corps );
+
+	init_pairs( &asis, &corps );
+
+	listenfd = bibsock_listen( socketpath );
+	if ( listenfd==BIBSOCK_INUSE ) {
+		fprintf( stderr, "%s: A server is already listening on '%s'. Exiting.\n", progname, socketpath );
+		return EXIT_FAILURE;
+	} else if ( listenfd<0 ) {
+		fprintf( stderr, "%s: Cannot listen on '%s'. Exiting.\n", progname, socketpath );
+		return EXIT_FAILURE;
+	}
+
+	signal( SIGPIPE, SIG_IGN );
+	signal( SIGINT, stop );
+	signal( SIGTERM, stop );
+
+	threads = ( pthread_t * ) malloc( sizeof( pthread_t ) * nthreads );
+	if ( !threads ) memerr();
+
+	for ( i=0; i<nthreads; ++i ) {
+		if ( pthread_create( &(threads[i]), NULL, worker, &verbose ) ) {
+			fprintf( stderr, "%s: Cannot start thread. Exiting.\n", progname );
+			stop( 0 );
+		}
+	}
+
+	if ( verbose ) fprintf( stderr, "%s: Listening on '%s' with %d threads\n", progname, socketpath, nthreads );
+
+	/* the workers only return if accept() fails */
+	for ( i=0; i<nthreads; ++i )
+		pthread_join( threads[i], NULL );
+
+	unlink( socketpath );
+	free( threads );
+
+	return EXIT_FAILURE;
+}
@@ -0,0 +1,462 @@
+/*
+ * bibsock.c
+ *
+ * Copyright (c) Chris Putnam 2021
+ *
+ * Program and source code released under the GPL version 2
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stddef.h>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include "bibsock.h"
+
+/*****************************************************
+ PUBLIC: int bibsock_listen()
+*****************************************************/
+
+static int
+bibsock_address( struct sockaddr_un *addr, const char *path )
+{
+	if ( strlen( path ) >= sizeof( addr->sun_path ) ) return BIBSOCK_ERR;
+
+	memset( addr, 0, sizeof( *addr ) );
+	addr->sun_family = AF_UNIX;
+	strcpy( addr->sun_path, path );
+
+	return BIBSOCK_OK;
+}
+
+/* bibsock_listen()
+ *
+ * Return a socket listening on path, or BIBSOCK_INUSE if a server is
+ * already answering there, or BIBSOCK_ERR. A socket file left behind
+ * by a server that has gone is removed.
+ */
+int
+bibsock_listen( const char *path )
+{
+	struct sockaddr_un addr;
+	int fd, other;
+
+	if ( bibsock_address( &addr, path )!=BIBSOCK_OK ) return BIBSOCK_ERR;
+
+	fd = socket( AF_UNIX, SOCK_STREAM, 0 );
+	if ( fd==-1 ) return BIBSOCK_ERR;
+
+	if ( bind( fd, ( struct sockaddr * ) &addr, sizeof( addr ) )==-1 ) {
+		if ( errno!=EADDRINUSE ) goto err;
+		other = bibsock_connect( path );
+		if ( other>=0 ) {
+			close( other );
+			close( fd );
+			return BIBSOCK_INUSE;
+		}
+		unlink( path );
+		if ( bind( fd, ( struct sockaddr * ) &addr, sizeof( addr ) )==-1 ) goto err;
+	}
+
+	if ( listen( fd, 64 )==-1 ) goto err;
+
+	return fd;
+err:
+	close( fd );
+	return BIBSOCK_ERR;
+}
+
+/*****************************************************
+ PUBLIC: int bibsock_connect()
+*****************************************************/
+
+int
+bibsock_connect( const char *path )
+{
+	struct sockaddr_un addr;
+	int fd;
+
+	if ( bibsock_address( &addr, path )!=BIBSOCK_OK ) return BIBSOCK_ERR;
+
+	fd = socket( AF_UNIX, SOCK_STREAM, 0 );
+	if ( fd==-1 ) return BIBSOCK_ERR;
+
+	if ( connect( fd, ( struct sockaddr * ) &addr, sizeof( addr ) )==-1 ) {
+		close( fd );
+		return BIBSOCK_ERR;
+	}
+
+	return fd;
+}
+
+/*****************************************************
+ PUBLIC: void bibsock_request_init()
+*****************************************************/
+
+void
+bibsock_request_init( bibsock_request *r )
+{
+	memset( &(r->p), 0, sizeof( param ) );
+	r->n     = r->max = 0;
+	r->names = NULL;
+	r->data  = NULL;
+	r->len   = NULL;
+	r->bad   = 0;
+}
+
+void
+bibsock_request_free( bibsock_request *r )
+{
+	int i;
+
+	for ( i=0; i<r->n; ++i ) {
+		free( r->names[i] );
+		free( r->data[i] );
+	}
+	if ( r->names ) free( r->names );
+	if ( r->data )  free( r->data );
+	if ( r->len )   free( r->len );
+
+	bibsock_request_init( r );
+}
+
+/* bibsock_request_add()
+ *
+ * Add an input, taking over data, which has room for a '\0' at len.
+ */
+static int
+bibsock_request_add( bibsock_request *r, const char *name, char *data, unsigned long len )
+{
+	unsigned long *morelen;
+	char **more, *p;
+	int alloc;
+
+	if ( r->n == r->max ) {
+		alloc = ( r->max ) ? r->max * 2 : 4;
+		more = ( char ** ) realloc( r->names, sizeof( char * ) * alloc );
+		if ( !more ) return BIBSOCK_MEMERR;
+		r->names = more;
+		more = ( char ** ) realloc( r->data, sizeof( char * ) * alloc );
+		if ( !more ) return BIBSOCK_MEMERR;
+		r->data = more;
+		morelen = ( unsigned long * ) realloc( r->len, sizeof( unsigned long ) * alloc );
+		if ( !morelen ) return BIBSOCK_MEMERR;
+		r->len = morelen;
+		r->max = alloc;
+	}
+
+	r->names[ r->n ] = strdup( name );
+	if ( !r->names[ r->n ] ) return BIBSOCK_MEMERR;
+	for ( p=r->names[ r->n ]; *p; ++p )
+		if ( *p=='\n' ) *p = ' ';
+	data[ len ] = '\0';
+	r->data[ r->n ] = data;
+	r->len[ r->n ]  = len;
+	r->n++;
+
+	return BIBSOCK_OK;
+}
+
+/* bibsock_request_addinput()
+ *
+ * Read all of fp as an input named name.
+ */
+int
+bibsock_request_addinput( bibsock_request *r, const char *name, FILE *fp )
+{
+	unsigned long len;
+	char *data;
+	int status;
+
+	status = source_readall( fp, &data, &len, BIBSOCK_MAXINPUT );
+	if ( status==SOURCE_ERR_MEMERR ) return BIBSOCK_MEMERR;
+	if ( status!=SOURCE_OK ) return BIBSOCK_ERR;
+
+	status = bibsock_request_add( r, name, data, len );
+	if ( status!=BIBSOCK_OK ) free( data );
+
+	return status;
+}
+
+/*****************************************************
+ PUBLIC: void bibsock_request_setparams()
+*****************************************************/
+
+#define BIBSOCK_INT   (0)
+#define BIBSOCK_UCHAR (1)
+
+/* Charset fields hold CHARSET_UNICODE, CHARSET_GB18030, or a position
+ * in the charset table, whose size is only known at run time.
+ */
+#define BIBSOCK_CHARSET (-1000)
+
+/* every combination of the BIBL_FORMAT_* bits */
+#define BIBSOCK_ALLFORMATOPTS ( BIBL_FORMAT_MODSOUT_DROPKEY * 2 - 1 )
+
+static const struct {
+	const char *name;
+	size_t     offset;
+	int        type;
+	int        min, max;
+} wirefields[] = {
+	{ "readformat",     offsetof( param, readformat ),     BIBSOCK_INT,   BIBL_FIRSTIN, BIBL_LASTIN },
+	{ "writeformat",    offsetof( param, writeformat ),    BIBSOCK_INT,   BIBL_FIRSTOUT, BIBL_LASTOUT },
+	{ "charsetin",      offsetof( param, charsetin ),      BIBSOCK_INT,   BIBSOCK_CHARSET, BIBSOCK_CHARSET },
+	{ "charsetin_src",  offsetof( param, charsetin_src ),  BIBSOCK_UCHAR, BIBL_SRC_DEFAULT, BIBL_SRC_USER },
+	{ "latexin",        offsetof( param, latexin ),        BIBSOCK_UCHAR, 0, 1 },
+	{ "utf8in",         offsetof( param, utf8in ),         BIBSOCK_UCHAR, 0, 1 },
+	{ "xmlin",          offsetof( param, xmlin ),          BIBSOCK_UCHAR, 0, 1 },
+	{ "nosplittitle",   offsetof( param, nosplittitle ),   BIBSOCK_UCHAR, 0, 1 },
+	{ "charsetout",     offsetof( param, charsetout ),     BIBSOCK_INT,   BIBSOCK_CHARSET, BIBSOCK_CHARSET },
+	{ "charsetout_src", offsetof( param, charsetout_src ), BIBSOCK_UCHAR, BIBL_SRC_DEFAULT, BIBL_SRC_USER },
+	{ "latexout",       offsetof( param, latexout ),       BIBSOCK_UCHAR, 0, 1 },
+	{ "utf8out",        offsetof( param, utf8out ),        BIBSOCK_UCHAR, 0, 1 },
+	{ "utf8bom",        offsetof( param, utf8bom ),        BIBSOCK_UCHAR, 0, 1 },
+	{ "xmlout",         offsetof( param, xmlout ),         BIBSOCK_UCHAR, BIBL_XMLOUT_FALSE, BIBL_XMLOUT_ENTITIES },
+	{ "format_opts",    offsetof( param, format_opts ),    BIBSOCK_INT,   0, BIBSOCK_ALLFORMATOPTS },
+	{ "addcount",       offsetof( param, addcount ),       BIBSOCK_INT,   0, 1 },
+	{ "verbose",        offsetof( param, verbose ),        BIBSOCK_UCHAR, 0, 3 },
+};
+static const int nfields = sizeof( wirefields ) / sizeof( wirefields[0] );
+
+static int
+field_get( param *p, int i )
+{
+	char *q = ( char * ) p + wirefields[i].offset;
+
+	if ( wirefields[i].type==BIBSOCK_INT ) return *( int * ) q;
+	else return *( uchar * ) q;
+}
+
+static void
+field_set( param *p, int i, int value )
+{
+	char *q = ( char * ) p + wirefields[i].offset;
+
+	if ( wirefields[i].type==BIBSOCK_INT ) *( int * ) q = value;
+	else *( uchar * ) q = ( uchar ) value;
+}
+
+static int
+field_valid( int i, long value )
+{
+	if ( wirefields[i].min==BIBSOCK_CHARSET ) {
+		if ( value==CHARSET_UNICODE || value==CHARSET_GB18030 ) return 1;
+		return ( value>=0 && value<charset_count() );
+	}
+	return ( value>=wirefields[i].min && value<=wirefields[i].max );
+}
+
+/* bibsock_request_setparams()
+ *
+ * Take the format and option fields of p for the request.
+ */
+void
+bibsock_request_setparams( bibsock_request *r, param *p )
+{
+	int i;
+
+	for ( i=0; i<nfields; ++i )
+		field_set( &(r->p), i, field_get( p, i ) );
+}
+
+/* bibsock_request_getparams()
+ *
+ * Set the format and option fields of p from the request, leaving
+ * the rest of p alone.
+ */
+void
+bibsock_request_getparams( bibsock_request *r, param *p )
+{
+	int i;
+
+	for ( i=0; i<nfields; ++i )
+		field_set( p, i, field_get( &(r->p), i ) );
+}
+
+/* bibsock_request_check()
+ *
+ * Check every field of the request against the values it may take,
+ * before bibsock_request_getparams() hands them to the library.
+ * Returns BIBL_OK or BIBL_ERR_BADINPUT.
+ */
+int
+bibsock_request_check( bibsock_request *r )
+{
+	int i;
+
+	if ( r->bad ) return BIBL_ERR_BADINPUT;
+
+	for ( i=0; i<nfields; ++i )
+		if ( !field_valid( i, field_get( &(r->p), i ) ) ) return BIBL_ERR_BADINPUT;
+
+	return BIBL_OK;
+}
+
+/*****************************************************
+ PUBLIC: int bibsock_request_write()
+*****************************************************/
+
+int
+bibsock_request_write( FILE *out, bibsock_request *r )
+{
+	int i;
+
+	for ( i=0; i<nfields; ++i )
+		fprintf( out, "%s %d\n", wirefields[i].name, field_get( &(r->p), i ) );
+
+	for ( i=0; i<r->n; ++i ) {
+		fprintf( out, "input %lu %s\n", r->len[i], r->names[i] );
+		if ( r->len[i] ) fwrite( r->data[i], 1, r->len[i], out );
+	}
+
+	fprintf( out, "end\n" );
+	fflush( out );
+
+	return ( ferror( out ) ) ? BIBSOCK_ERR : BIBSOCK_OK;
+}
+
+/*****************************************************
+ PUBLIC: int bibsock_request_read()
+*****************************************************/
+
+/* read_line()
+ *
+ * Read one protocol line into buf, without its '\n'.
+ */
+static int
+read_line( FILE *in, char *buf, int bufsize )
+{
+	char *p;
+
+	if ( !fgets( buf, bufsize, in ) ) return BIBSOCK_EOF;
+
+	p = strchr( buf, '\n' );
+	if ( !p ) return BIBSOCK_ERR;
+	*p = '\0';
+
+	return BIBSOCK_OK;
+}
+
+static int
+read_input( FILE *in, bibsock_request *r, char *line )
+{
+	unsigned long len;
+	char *name, *data;
+	int status;
+
+	len = strtoul( line, &name, 10 );
+	if ( name==line || *name!=' ' || len > BIBSOCK_MAXINPUT ) return BIBSOCK_ERR;
+	name++;
+
+	data = ( char * ) malloc( len + 1 );
+	if ( !data ) return BIBSOCK_MEMERR;
+
+	if ( len && fread( data, 1, len, in )!=len ) {
+		free( data );
+		return BIBSOCK_ERR;
+	}
+
+	status = bibsock_request_add( r, name, data, len );
+	if ( status!=BIBSOCK_OK ) free( data );
+
+	return status;
+}
+
+/* bibsock_request_read()
+ *
+ * Read the next request into r, which should be empty. Returns
+ * BIBSOCK_EOF if the client closed the connection between requests.
+ */
+int
+bibsock_request_read( FILE *in, bibsock_request *r )
+{
+	int i, status, first = 1;
+	char line[1024], *value;
+	long n;
+
+	while ( 1 ) {
+
+		status = read_line( in, line, sizeof( line ) );
+		if ( status==BIBSOCK_EOF ) return ( first ) ? BIBSOCK_EOF : BIBSOCK_ERR;
+		if ( status!=BIBSOCK_OK ) return status;
+		first = 0;
+
+		if ( !strcmp( line, "end" ) ) return BIBSOCK_OK;
+
+		if ( !strncmp( line, "input ", 6 ) ) {
+			status = read_input( in, r, line + 6 );
+			if ( status!=BIBSOCK_OK ) return status;
+			continue;
+		}
+
+		value = strchr( line, ' ' );
+		if ( !value ) return BIBSOCK_ERR;
+		*value++ = '\0';
+
+		for ( i=0; i<nfields; ++i )
+			if ( !strcmp( line, wirefields[i].name ) ) break;
+		if ( i==nfields ) return BIBSOCK_ERR;
+
+		/* an out-of-range value, which would not survive field_set(),
+		 * fails the request but keeps the connection in step */
+		n = strtol( value, NULL, 10 );
+		if ( field_valid( i, n ) ) field_set( &(r->p), i, ( int ) n );
+		else r->bad = 1;
+	}
+}
+
+/*****************************************************
+ PUBLIC: int bibsock_reply_write()
+*****************************************************/
+
+int
+bibsock_reply_write( FILE *out, int status, long nrefs, str *output )
+{
+	unsigned long len = ( output ) ? output->len : 0;
+
+	fprintf( out, "status %d\n", status );
+	fprintf( out, "refs %ld\n", nrefs );
+	fprintf( out, "output %lu\n", len );
+	if ( len ) fwrite( output->data, 1, len, out );
+	fflush( out );
+
+	return ( ferror( out ) ) ? BIBSOCK_ERR : BIBSOCK_OK;
+}
+
+/*****************************************************
+ PUBLIC: int bibsock_reply_read()
+*****************************************************/
+
+/* bibsock_reply_read()
+ *
+ * Read a reply, copying its output to the output stream.
+ */
+int
+bibsock_reply_read( FILE *in, int *status, long *nrefs, FILE *output )
+{
+	unsigned long len;
+	char buf[8192];
+	size_t want;
+
+	if ( read_line( in, buf, sizeof( buf ) )!=BIBSOCK_OK ) return BIBSOCK_ERR;
+	if ( sscanf( buf, "status %d", status )!=1 ) return BIBSOCK_ERR;
+
+	if ( read_line( in, buf, sizeof( buf ) )!=BIBSOCK_OK ) return BIBSOCK_ERR;
+	if ( sscanf( buf, "refs %ld", nrefs )!=1 ) return BIBSOCK_ERR;
+
+	if ( read_line( in, buf, sizeof( buf ) )!=BIBSOCK_OK ) return BIBSOCK_ERR;
+	if ( sscanf( buf, "output %lu", &len )!=1 ) return BIBSOCK_ERR;
+
+	while ( len ) {
+		want = ( len < sizeof( buf ) ) ? len : sizeof( buf );
+		if ( fread( buf, 1, want, in )!=want ) return BIBSOCK_ERR;
+		fwrite( buf, 1, want, output );
+		len -= want;
+	}
+
+	return BIBSOCK_OK;
+}
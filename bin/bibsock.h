@@ -0,0 +1,61 @@
+/*
+ * bibsock.h
+ *
+ * Copyright (c) Chris Putnam 2021
+ *
+ * Program and source code released under the GPL version 2
+ *
+ */
+#ifndef BIBSOCK_H
+#define BIBSOCK_H
+
+#include <stdio.h>
+#include "bibutils.h"
+
+#define BIBSOCK_OK     (0)
+#define BIBSOCK_EOF    (1)
+#define BIBSOCK_ERR    (-1)
+#define BIBSOCK_MEMERR (-2)
+#define BIBSOCK_INUSE  (-3)
+
+/* Largest single input a request may carry */
+#define BIBSOCK_MAXINPUT (1024UL*1024UL*1024UL)
+
+/* A conversion request, as sent by a client program to bibserve over a
+ * Unix domain socket. Only the format and option fields of p travel
+ * with the request; the reader and writer functions, and the asis and
+ * corps lists, are those of the server.
+ *
+ * On the wire a request is a set of "name value" lines for the fields
+ * of p, an "input LEN NAME" line followed by LEN bytes for each input,
+ * and "end". The reply is "status N", "refs N", and "output LEN"
+ * followed by LEN bytes. A connection can carry several requests.
+ *
+ * A field sent with a value it cannot take sets bad; the server
+ * answers such a request with BIBL_ERR_BADINPUT.
+ */
+typedef struct bibsock_request {
+	param         p;
+	int           n, max;
+	char          **names;
+	char          **data;
+	unsigned long *len;
+	int           bad;
+} bibsock_request;
+
+int  bibsock_listen( const char *path );
+int  bibsock_connect( const char *path );
+
+void bibsock_request_init( bibsock_request *r );
+void bibsock_request_free( bibsock_request *r );
+int  bibsock_request_addinput( bibsock_request *r, const char *name, FILE *fp );
+void bibsock_request_setparams( bibsock_request *r, param *p );
+void bibsock_request_getparams( bibsock_request *r, param *p );
+int  bibsock_request_check( bibsock_request *r );
+int  bibsock_request_write( FILE *out, bibsock_request *r );
+int  bibsock_request_read( FILE *in, bibsock_request *r );
+
+int  bibsock_reply_write( FILE *out, int status, long nrefs, str *output );
+int  bibsock_reply_read( FILE *in, int *status, long *nrefs, FILE *output );
+
+#endif
@@ -30,6 +30,7 @@ args_tomods_help( char *progname, char *help1, char *help2 )
 	fprintf(stderr,"  -v, --version             display version\n");
 	fprintf(stderr,"  -a, --add-refcount        add \"_#\", where # is reference count to reference\n");
 	fprintf(stderr,"  -s, --single-refperfile   one reference per output file\n");
+	fprintf(stderr,"  -j, --threads N           format output with N threads\n");
 	fprintf(stderr,"  -i, --input-encoding      input character encoding\n");
 	fprintf(stderr,"  -o, --output-encoding     output character encoding\n");
 	fprintf(stderr,"  -u, --unicode-characters  DEFAULT: write unicode (not xml entities)\n");
@@ -40,6 +41,9 @@ args_tomods_help( char *progname, char *help1, char *help2 )
 	fprintf(stderr,"  -c, --corporation-file    specify file of corporation names\n");
 	fprintf(stderr,"  -as, --asis               specify file of names that shouldn't be mangled\n");
 	fprintf(stderr,"  -nt, --nosplit-title      don't split titles into TITLE/SUBTITLE pairs\n");
+	fprintf(stderr,"  --save FILE               also save the references read to FILE\n");
+	fprintf(stderr,"  --server SOCKET           convert with the bibserve at SOCKET\n");
+	fprintf(stderr,"  --incremental FILE        only convert records changed since FILE was written\n");
 	fprintf(stderr,"  --verbose                 report all warnings\n");
 	fprintf(stderr,"  --debug                   very verbose output\n\n");
 
@@ -75,6 +79,15 @@ tomods_processargs( int *argc, char *argv[], param *p,
 		} else if ( args_match( argv[i], "-a", "--add-refcount" ) ) {
 			p->addcount = 1;
 			subtract = 1;
+		} else if ( args_match( argv[i], NULL, "--save" ) ) {
+			bibprog_save( args_next( *argc, argv, i, p->progname, NULL, "--save" ) );
+			subtract = 2;
+		} else if ( args_match( argv[i], NULL, "--server" ) ) {
+			bibprog_server( args_next( *argc, argv, i, p->progname, NULL, "--server" ) );
+			subtract = 2;
+		} else if ( args_match( argv[i], NULL, "--incremental" ) ) {
+			bibprog_incremental( args_next( *argc, argv, i, p->progname, NULL, "--incremental" ) );
+			subtract = 2;
 		} else if ( args_match(argv[i], NULL, "--verbose" ) ) {
 			/* --debug + --verbose = --debug */
 			if ( p->verbose<1 ) p->verbose = 1;
@@ -90,6 +103,9 @@ tomods_processargs( int *argc, char *argv[], param *p,
 		} else if ( args_match( argv[i], "-s", "--single-refperfile" )){
 			p->singlerefperfile = 1;
 			subtract = 1;
+		} else if ( args_match( argv[i], "-j", "--threads" ) ) {
+			p->nthreads = atoi( args_next( *argc, argv, i, p->progname, "-j", "--threads" ) );
+			subtract = 2;
 		} else if ( args_match( argv[i], "-u", "--unicode-characters")){
 			p->utf8out = 1;
 			p->utf8bom = 1;
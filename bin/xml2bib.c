@@ -38,10 +38,14 @@ help( char *progname )
 	fprintf(stderr,"  -nb, --no-bom             do not write Byte Order Mark in UTF8 output\n");
 	fprintf(stderr,"  -U,  --uppercase          write bibtex tags/types in upper case\n" );
 	fprintf(stderr,"  -s,  --single-refperfile  one reference per output file\n");
+	fprintf(stderr,"  -j,  --threads N          format output with N threads\n");
 	fprintf(stderr,"  -i, --input-encoding      interpret input file with requested character set\n" );
 	fprintf(stderr,"                            (use argument for current list)\n");
 	fprintf(stderr,"  -o, --output-encoding     write output file with requested character set\n" );
 	fprintf(stderr,"                            (use argument for current list)\n");
+	fprintf(stderr,"  --save FILE               also save the references read to FILE\n" );
+	fprintf(stderr,"  --server SOCKET           convert with the bibserve at SOCKET\n" );
+	fprintf(stderr,"  --incremental FILE        only convert records changed since FILE was written\n" );
 	fprintf(stderr,"  --verbose                 for verbose\n" );
 	fprintf(stderr,"  --debug                   for debug output\n" );
 	fprintf(stderr,"\n");
@@ -69,6 +73,9 @@ process_args( int *argc, char *argv[], param *p )
 		} else if ( args_match( argv[i], "-s", "--single-refperfile" )){
 			p->singlerefperfile = 1;
 			subtract = 1;
+		} else if ( args_match( argv[i], "-j", "--threads" ) ) {
+			p->nthreads = atoi( args_next( *argc, argv, i, p->progname, "-j", "--threads" ) );
+			subtract = 2;
 		} else if ( args_match( argv[i], "-sd", "--singledash" ) ) {
 			p->format_opts |= BIBL_FORMAT_BIBOUT_SINGLEDASH;
 			subtract = 1;
@@ -96,6 +103,15 @@ process_args( int *argc, char *argv[], param *p )
 		} else if ( args_match( argv[i], "-d", "--drop-key" ) ) {
 			p->format_opts |= BIBL_FORMAT_BIBOUT_DROPKEY;
 			subtract = 1;
+		} else if ( args_match( argv[i], "--save", "" ) ) {
+			bibprog_save( args_next( *argc, argv, i, p->progname, NULL, "--save" ) );
+			subtract = 2;
+		} else if ( args_match( argv[i], "--server", "" ) ) {
+			bibprog_server( args_next( *argc, argv, i, p->progname, NULL, "--server" ) );
+			subtract = 2;
+		} else if ( args_match( argv[i], "--incremental", "" ) ) {
+			bibprog_incremental( args_next( *argc, argv, i, p->progname, NULL, "--incremental" ) );
+			subtract = 2;
 		} else if ( args_match( argv[i], "--verbose", "" ) ) {
 			p->verbose = 1;
 			subtract = 1;
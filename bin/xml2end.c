@@ -28,9 +28,13 @@ help( char *progname )
 	fprintf(stderr,"  -v, --version  display version\n\n");
 	fprintf(stderr,"  -nb, --no-bom   do not write Byte Order Mark in UTF8 output\n");
 	fprintf(stderr,"  -s, --single-refperfile one reference per output file\n");
+	fprintf(stderr,"  -j, --threads N         format output with N threads\n");
 	fprintf(stderr,"  -i, --input-encoding interpret input file with requested character set (use\n" );
 	fprintf(stderr,"                       argument for current list)\n");
 	fprintf(stderr,"  -o, --output-encoding interprest output file with requested character set\n" );
+	fprintf(stderr,"  --save FILE    also save the references read to FILE\n");
+	fprintf(stderr,"  --server SOCKET  convert with the bibserve at SOCKET\n");
+	fprintf(stderr,"  --incremental FILE  only convert records changed since FILE was written\n");
 	fprintf(stderr,"  --verbose      for verbose output\n");
 	fprintf(stderr,"  --debug        for debug output\n");
 
@@ -53,9 +57,21 @@ process_args( int *argc, char *argv[], param *p )
 		} else if ( args_match( argv[i], "-s", "--single-refperfile")){
 			p->singlerefperfile = 1;
 			subtract = 1;
+		} else if ( args_match( argv[i], "-j", "--threads" ) ) {
+			p->nthreads = atoi( args_next( *argc, argv, i, p->progname, "-j", "--threads" ) );
+			subtract = 2;
 		} else if ( args_match( argv[i], "-nb", "--no-bom" ) ) {
 			p->utf8bom = 0;
 			subtract = 1;
+		} else if ( args_match( argv[i], "--save", "" ) ) {
+			bibprog_save( args_next( *argc, argv, i, p->progname, NULL, "--save" ) );
+			subtract = 2;
+		} else if ( args_match( argv[i], "--server", "" ) ) {
+			bibprog_server( args_next( *argc, argv, i, p->progname, NULL, "--server" ) );
+			subtract = 2;
+		} else if ( args_match( argv[i], "--incremental", "" ) ) {
+			bibprog_incremental( args_next( *argc, argv, i, p->progname, NULL, "--incremental" ) );
+			subtract = 2;
 		} else if ( args_match( argv[i], "--verbose", "" ) ) {
 			p->verbose = 1;
 			subtract = 1;
@@ -8,8 +8,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-#include "hash.h"
-#include "uintlist.h"
+#include "mph_gen.h"
 
 const char *bu_genre[] = {
 	"academic journal",
@@ -45,169 +44,72 @@ const char *bu_genre[] = {
 const int nbu_genre = sizeof( bu_genre ) / sizeof( const char *);
 
 void
-memerr( const char *fn )
+hashify_write( FILE *fp, const char *list[], int nlist, const char *type, mph_gen *g )
 {
-	fprintf( stderr, "Memory error in %s()\n", fn );
-	exit( EXIT_FAILURE );
-}
-
-int
-hashify_test_size( const char *list[], int nlist, unsigned int HASH_SIZE, uintlist *u )
-{
-	unsigned int n;
-	int i, pos;
-//	int i, ok, pos;
-
-//	ok = 1;
-
-	uintlist_empty( u );
-
-	for ( i=0; i<nlist; ++i ) {
-
-		n = calculate_hash_char( list[i], HASH_SIZE );
-
-		pos = uintlist_find( u, n );
-
-		/* if position occupied, try next bucket */
-		if ( pos!=-1 ) {
-			n++;
-			pos = uintlist_find( u, n );
-		}
-
-		/* if both n and n+1 occupied, bail */
-		if ( pos!=-1 ) return 0;
-
-		uintlist_add( u, n );
-#if 0
-		fprintf( stderr, "i=%d nlist=%d\n",i,nlist );
-		{ int j;
-		for ( j=0; j<u.n; ++j ) fprintf( stderr, " %u", uintlist_get( &u, j ) );
-		fprintf( stderr, "\n" );
-		}
-#endif
-
-	}
-
-	return 1;
-}
-
-void
-hashify_write( FILE *fp, const char *list[], int nlist, const char *type, unsigned int HASH_SIZE, uintlist *u )
-{
-	unsigned n;
+	char name[256];
 	int i;
 
-	/* write hash */
+	snprintf( name, sizeof( name ), "bu_%s", type );
+
 	fprintf( fp, "/*\n" );
 	fprintf( fp, " * Bibutils %s hash\n", type );
 	fprintf( fp, " */\n" );
-	fprintf( fp, "static const unsigned int bu_%s_hash_size = %u;\n", type, HASH_SIZE );
-	fprintf( fp, "static const char *bu_%s[%u] = {\n", type, HASH_SIZE );
-	fprintf( fp, "\t[ 0 ... %u ] = NULL,\n", HASH_SIZE-1 );
-	for ( i=0; i<nlist; ++i ) {
-		n = uintlist_get( u, i );
-//		n = calculate_hash_char( list[i], HASH_SIZE );
-		fprintf( fp, "\t[ %3u ] = \"%s\",\n", n, list[i] );
-	}
-	fprintf( fp, "};\n\n" );
+	fprintf( fp, "static const char *%s[%d] = {\n", name, nlist );
+	for ( i=0; i<nlist; ++i )
+		fprintf( fp, "\t[ %3u ] = \"%s\",\n", g->slot[i], list[i] );
+	fprintf( fp, "};\n" );
+	mph_gen_write( fp, g, name );
 
 	fprintf( fp, "int\n" );
-	fprintf( fp, "is_bu_%s( const char *query )\n", type );
+	fprintf( fp, "is_%s( const char *query )\n", name );
 	fprintf( fp, "{\n" );
-	fprintf( fp, "\tunsigned int n;\n\n" );
-	fprintf( fp, "\tn = calculate_hash_char( query, bu_%s_hash_size );\n", type );
-	fprintf( fp, "\tif ( bu_%s[n]==NULL ) return 0;\n", type );
-	fprintf( fp, "\tif ( !strcmp( query, bu_%s[n] ) ) return 1;\n", type );
-	fprintf( fp, "\telse if ( bu_%s[n+1] && !strcmp( query, bu_%s[n+1] ) ) return 1;\n", type, type );
-	fprintf( fp, "\telse return 0;\n" );
+	fprintf( fp, "\treturn !strcmp( query, %s[ mph_slot( &%s_hash, query ) ] );\n", name, name );
 	fprintf( fp, "}\n" );
 }
 
-unsigned int
-hashify_size( const char *list[], int nlist, unsigned int max, uintlist *u )
-{
-	unsigned int HASH_SIZE = (unsigned int ) nlist;
-	int ok;
-
-	do {
-		ok = hashify_test_size( list, nlist, HASH_SIZE, u );
-		if ( ok ) break;
-		HASH_SIZE += 1;
-		if ( HASH_SIZE > max ) break;
-	} while ( 1 );
-
-	if ( !ok ) return 0;
-	else return HASH_SIZE;
-}
-
-void
+int
 hashify( const char *list[], int nlist, const char *type )
 {
-	unsigned int HASH_SIZE;
-	uintlist u;
+	mph_gen g;
+	int status;
+
+	mph_gen_init( &g );
 
-	uintlist_init( &u );
+	status = mph_gen_build( &g, list, nlist, MPH_CASE );
+	if ( status==MPH_GEN_OK )
+		hashify_write( stdout, list, nlist, type, &g );
+	else
+		fprintf( stderr, "hash_bu: cannot hash bu_%s: %s\n", type, mph_gen_errstr( status ) );
 
-	HASH_SIZE = hashify_size( list, nlist, 10000, &u );
-	if ( HASH_SIZE > 0 ) {
-		hashify_write( stdout, list, nlist, type, HASH_SIZE, &u );
-	}
-	else {
-		printf( "/* No valid HASH_SIZE for bu_%s up to %u */\n", type, 10000 );
-	}
+	mph_gen_free( &g );
 
-	uintlist_free( &u );
+	return ( status==MPH_GEN_OK );
 }
 
 void
 write_header( FILE *fp )
 {
 	fprintf( fp, "/*\n" );
-	fprintf( fp, " * bu_auth.c - Identify genre to be labeled with Bibutils authority/\n" );
+	fprintf( fp, " * bu_auth.c - Identify genre to be labeled with Bibutils authority\n" );
 	fprintf( fp, " *\n" );
- 	fprintf( fp, " * Copyright (c) Chris Putnam 2017-2020\n" );
+	fprintf( fp, " * Copyright (c) Chris Putnam 2017-2021\n" );
 	fprintf( fp, " *\n" );
 	fprintf( fp, " * Source code released under the GPL version 2\n" );
+	fprintf( fp, " *\n" );
+	fprintf( fp, " * Generated by bldhash/hash_bu; do not edit.\n" );
 	fprintf( fp, " */\n\n" );
 
 	fprintf( fp, "#include <stdlib.h>\n" );
 	fprintf( fp, "#include <string.h>\n" );
 	fprintf( fp, "#include \"bu_auth.h\"\n" );
-	fprintf( fp, "#include \"hash.h\"\n" );
-	fprintf( fp, "\n" );
-
-#if 0
-	fprintf( fp, "/*\n" );
-	fprintf( fp, " * Bob Jenkin's one-at-a-time hash\n" );
-	fprintf( fp, " */\n" );
+	fprintf( fp, "#include \"mph.h\"\n" );
 	fprintf( fp, "\n" );
-
-	fprintf( fp, "static unsigned int\n" );
-	fprintf( fp, "one_at_a_time_hash( const char *key, const unsigned int len, unsigned int HASH_SIZE )\n" );
-	fprintf( fp, "{\n" );
-	fprintf( fp, "\tunsigned int hash = 0, i;\n" );
-	fprintf( fp, "\tfor ( i=0; i<len; ++i ) {\n" );
-	fprintf( fp, "\t\thash += key[i];\n" );
-	fprintf( fp, "\t\thash += ( hash << 10 );\n" );
-	fprintf( fp, "\t\thash ^= ( hash >> 6 );\n" );
-	fprintf( fp, "\t}\n" );
-	fprintf( fp, "\thash += ( hash << 3 );\n" );
-	fprintf( fp, "\thash ^= ( hash >> 11 );\n" );
-	fprintf( fp, "\thash += ( hash << 15 );\n" );
-	fprintf( fp, "\treturn hash % ( HASH_SIZE - 1 );\n" );
-	fprintf( fp, "}\n\n" );
-
-	fprintf( fp, "static unsigned int\n" );
-	fprintf( fp, "calculate_hash_char( const char *key, unsigned int HASH_SIZE )\n" );
-	fprintf( fp, "{\n" );
-	fprintf( fp, "\treturn one_at_a_time_hash( key, strlen( key ), HASH_SIZE );\n" );
-	fprintf( fp, "}\n\n" );
-#endif
 }
 
 int
 main( int argc, char *argv[] )
 {
 	write_header( stdout );
-	hashify( bu_genre, nbu_genre, "genre" );
+	if ( !hashify( bu_genre, nbu_genre, "genre" ) ) return EXIT_FAILURE;
+	return EXIT_SUCCESS;
 }
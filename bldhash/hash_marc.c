@@ -10,8 +10,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-#include "hash.h"
-#include "uintlist.h"
+#include "mph_gen.h"
 
 static const char *marc_genre[] = {
 	"abstract or summary",
@@ -809,147 +808,66 @@ static const marc_trans marc_relators[] = {
 static const int nmarc_relators = sizeof( marc_relators ) / sizeof( marc_relators[0] );
 
 void
-memerr( const char *fn )
+hashify_marc_write( FILE *fp, const char *list[], int nlist, const char *type, mph_gen *g )
 {
-	fprintf( stderr, "Memory error in %s()\n", fn );
-	exit( EXIT_FAILURE );
-}
-
-int
-hashify_marc_test_size( const char *list[], int nlist, unsigned int HASH_SIZE, uintlist *u )
-{
-	unsigned int n;
-	int i, pos;
-
-	uintlist_empty( u );
-
-	for ( i=0; i<nlist; ++i ) {
-
-		n = calculate_hash_char( list[i], HASH_SIZE );
-
-		pos = uintlist_find( u, n );
-
-		/* position taken, try next bucket */
-		if ( pos!=-1 ) {
-			n++;
-			pos = uintlist_find( u, n );
-		}
-
-		/* hash is too full, exit */
-		if ( pos!=-1 ) return 0;
-
-		uintlist_add( u, n );
-
-	}
-
-	return 1;
-}
-
-void
-hashify_marc_write( FILE *fp, const char *list[], int nlist, const char *type, unsigned int HASH_SIZE, uintlist *u )
-{
-	unsigned int n;
+	char name[256];
 	int i;
 
-#if 0
-	/* write starting list to document hash info */
-	fprintf( fp, "#if 0\n\n" );
-	fprintf( fp, "/* starting MARC %s list */\n\n", type );
-	fprintf( fp, "static const char *marc_%s[] = {\n", type );
-	for ( i=0; i<nlist; ++i ) {
-		fprintf( fp, "\t\"%s\",\n", list[i] );
-	}
-	fprintf( fp, "};\n" );
-	fprintf( fp, "static const int nmarc_%s = sizeof( marc_%s ) / sizeof( const char* );\n", type, type );
-	fprintf( fp, "\n#endif\n\n" );
-#endif
+	snprintf( name, sizeof( name ), "marc_%s", type );
 
-	/* write hash */
 	fprintf( fp, "/*\n" );
 	fprintf( fp, " * MARC %s hash\n", type );
 	fprintf( fp, " */\n" );
-	fprintf( fp, "static const unsigned int marc_%s_hash_size = %u;\n", type, HASH_SIZE );
-	fprintf( fp, "static const char *marc_%s[%u] = {\n", type, HASH_SIZE );
-	fprintf( fp, "\t[ 0 ... %u ] = NULL,\n", HASH_SIZE-1 );
-	for ( i=0; i<nlist; ++i ) {
-		n = uintlist_get( u, i );
-		fprintf( fp, "\t[ %3u ] = \"%s\",\n", n, list[i] );
-	}
-	fprintf( fp, "};\n\n" );
+	fprintf( fp, "static const char *%s[%d] = {\n", name, nlist );
+	for ( i=0; i<nlist; ++i )
+		fprintf( fp, "\t[ %3u ] = \"%s\",\n", g->slot[i], list[i] );
+	fprintf( fp, "};\n" );
+	mph_gen_write( fp, g, name );
 
 	fprintf( fp, "int\n" );
-	fprintf( fp, "is_marc_%s( const char *query )\n", type );
+	fprintf( fp, "is_%s( const char *query )\n", name );
 	fprintf( fp, "{\n" );
-	fprintf( fp, "\tunsigned int n;\n\n" );
-	fprintf( fp, "\tn = calculate_hash_char( query, marc_%s_hash_size );\n", type );
-	fprintf( fp, "\tif ( marc_%s[n]==NULL ) return 0;\n", type );
-	fprintf( fp, "\tif ( !strcmp( query, marc_%s[n] ) ) return 1;\n", type );
-	fprintf( fp, "\telse if ( marc_%s[n+1] && !strcmp( query, marc_%s[n+1] ) ) return 1;\n", type, type );
-	fprintf( fp, "\telse return 0;\n" );
+	fprintf( fp, "\treturn !strcmp( query, %s[ mph_slot( &%s_hash, query ) ] );\n", name, name );
 	fprintf( fp, "}\n" );
 }
 
-unsigned int
-hashify_size( const char *list[], int nlist, unsigned int max, uintlist *u )
-{
-	unsigned int HASH_SIZE = (unsigned int ) nlist;
-	int ok;
-
-	do {
-		ok = hashify_marc_test_size( list, nlist, HASH_SIZE, u );
-		if ( ok ) break;
-		HASH_SIZE += 1;
-		if ( HASH_SIZE > max ) break;
-	} while ( 1 );
-
-	if ( !ok ) return 0;
-	else return HASH_SIZE;
-}
-
-void
+int
 hashify_marc( const char *list[], int nlist, const char *type )
 {
-	unsigned int HASH_SIZE;
-	uintlist u;
+	mph_gen g;
+	int status;
 
-	uintlist_init( &u );
+	mph_gen_init( &g );
 
-	HASH_SIZE = hashify_size( list, nlist, 10000, &u );
-	if ( HASH_SIZE > 0 ) {
-		hashify_marc_write( stdout, list, nlist, type, HASH_SIZE, &u );
-	}
-	else {
-		printf( "/* No valid HASH_SIZE for marc_%s up to %u */\n", type, 10000 );
-	}
+	status = mph_gen_build( &g, list, nlist, MPH_CASE );
+	if ( status==MPH_GEN_OK )
+		hashify_marc_write( stdout, list, nlist, type, &g );
+	else
+		fprintf( stderr, "hash_marc: cannot hash marc_%s: %s\n", type, mph_gen_errstr( status ) );
 
-	uintlist_free( &u );
+	mph_gen_free( &g );
+
+	return ( status==MPH_GEN_OK );
 }
 
 void
-hashify_marc_trans_write( FILE *fp, unsigned int HASH_SIZE, const marc_trans *trans, int ntrans, const char *label, const char *comment, uintlist *u )
+hashify_marc_trans_write( FILE *fp, const marc_trans *trans, int ntrans, const char *label, const char *comment, mph_gen *g )
 {
-	unsigned int n;
+	char name[256];
 	int i, j, len;
 
+	snprintf( name, sizeof( name ), "marc_%s", label );
+
 	fprintf( fp, "/*\n" );
 	fprintf( fp, " * MARC %s hash\n", label );
 	fprintf( fp, " */\n\n" );
 
 	if ( comment ) fprintf( fp, "/* %s */\n\n", comment );
-#if 0
-	fprintf( fp, "typedef struct marc_trans {\n" );
-	fprintf( fp, "\tchar *internal_name;\n" );
-	fprintf( fp, "\tchar *abbreviation;\n" );
-	fprintf( fp, "} marc_trans;\n\n" );
-#endif
 
-	fprintf( fp, "static const unsigned int marc_%s_hash_size = %u;\n", label, HASH_SIZE );
-	fprintf( fp, "static const marc_trans marc_%s[%u] = {\n", label, HASH_SIZE );
-	fprintf( fp, "\t[ 0 ... %u ] = { NULL, NULL },\n", HASH_SIZE-1 );
+	fprintf( fp, "static const marc_trans %s[%d] = {\n", name, ntrans );
 
 	for ( i=0; i<ntrans; ++i ) {
-		n = uintlist_get( u, i );
-		fprintf( fp, "\t[ %4u ] = { \"%s\", ", n, trans[i].internal_name );
+		fprintf( fp, "\t[ %4u ] = { \"%s\", ", g->slot[i], trans[i].internal_name );
 		len = strlen( trans[i].internal_name );
 		for ( j=len; j<35; ++j ) fprintf( fp, " " );
 		fprintf( fp, "\"%s\"", trans[i].abbreviation );
@@ -960,73 +878,74 @@ hashify_marc_trans_write( FILE *fp, unsigned int HASH_SIZE, const marc_trans *tr
 		fprintf( fp, "\n" );
 	}
 
-	fprintf( fp, "};\n\n" );
+	fprintf( fp, "};\n" );
+	mph_gen_write( fp, g, name );
 
 	fprintf( fp, "char *\n" );
 	fprintf( fp, "marc_convert_%s( const char *query )\n", label );
 	fprintf( fp, "{\n" );
 	fprintf( fp, "\tunsigned int n;\n\n" );
-
-	fprintf( fp, "\tn = calculate_hash_char( query, marc_%s_hash_size );\n", label );
-	fprintf( fp, "\tif ( marc_%s[n].abbreviation==NULL ) return NULL;\n", label );
-	fprintf( fp, "\tif ( !strcmp( query, marc_%s[n].abbreviation ) ) return marc_%s[n].internal_name;\n", label, label );
-	fprintf( fp, "\telse if ( marc_%s[n+1].abbreviation && !strcmp( query, marc_%s[n+1].abbreviation ) ) return marc_%s[n+1].internal_name;\n", label, label, label );
+	fprintf( fp, "\tn = mph_slot( &%s_hash, query );\n", name );
+	fprintf( fp, "\tif ( !strcmp( query, %s[n].abbreviation ) ) return %s[n].internal_name;\n", name, name );
 	fprintf( fp, "\telse return NULL;\n" );
 	fprintf( fp, "}\n" );
 }
 
-void
+int
 hashify_marc_trans( const marc_trans *trans, int ntrans, const char *label, const char *comment )
 {
-	unsigned int HASH_SIZE;
 	const char **list;
-	uintlist u;
-	int i;
+	mph_gen g;
+	int i, status;
 
 	list = (const char **) malloc( sizeof( const char * ) * ntrans );
-	if ( !list ) memerr( __FUNCTION__ );
-
-	uintlist_init( &u );
+	if ( !list ) {
+		fprintf( stderr, "hash_marc: memory error\n" );
+		return 0;
+	}
 
 	for ( i=0; i<ntrans; ++i )
 		list[i] = (const char*) trans[i].abbreviation;
 
-	HASH_SIZE = hashify_size( list, ntrans, 10000, &u );
-	if ( HASH_SIZE > 0 ) {
-		hashify_marc_trans_write( stdout, HASH_SIZE, trans, ntrans, label, comment, &u );
-	}
-	else {
-		printf( "/* No valid HASH_SIZE for marc_%s up to %u */\n", label, 10000 );
-	}
+	mph_gen_init( &g );
 
-	uintlist_free( &u );
+	status = mph_gen_build( &g, list, ntrans, MPH_CASE );
+	if ( status==MPH_GEN_OK )
+		hashify_marc_trans_write( stdout, trans, ntrans, label, comment, &g );
+	else
+		fprintf( stderr, "hash_marc: cannot hash marc_%s: %s\n", label, mph_gen_errstr( status ) );
+
+	mph_gen_free( &g );
 
 	free( list );
+
+	return ( status==MPH_GEN_OK );
 }
 
 void
 write_header( FILE *fp )
 {
 	fprintf( fp, "/*\n" );
-	fprintf( fp, " * marc_auth.c - Identify genre and resources to be labeled with MARC authority/\n" );
+	fprintf( fp, " * marc_auth.c - Identify genre and resources to be labeled with MARC authority\n" );
 	fprintf( fp, " *\n" );
 	fprintf( fp, " * MARC (MAchine-Readable Cataloging) 21 authority codes/values from the Library of Congress initiative\n" );
- 	fprintf( fp, " *\n" );
-	fprintf( fp, " * Copyright (c) Chris Putnam 2004-2020\n" );
 	fprintf( fp, " *\n" );
- 	fprintf( fp, " * Source code released under the GPL version 2\n" );
+	fprintf( fp, " * Copyright (c) Chris Putnam 2004-2021\n" );
+	fprintf( fp, " *\n" );
+	fprintf( fp, " * Source code released under the GPL version 2\n" );
 	fprintf( fp, " *\n" );
 	fprintf( fp, " * Because the string values belonging to the MARC authority\n" );
-	fprintf( fp, " * are constant, search for them in a pre-calculated hash to\n" );
-	fprintf( fp, " * reduce O(N) run-time linear searching of the list to O(1).\n" );
-	fprintf( fp, " * Note that hash size was set to ensure no collisions among\n" );
-	fprintf( fp, " * valid terms.\n" );
+	fprintf( fp, " * are constant, search for them through a pre-calculated\n" );
+	fprintf( fp, " * minimal perfect hash: every valid term has a slot of its\n" );
+	fprintf( fp, " * own, so a lookup is one hash and one string comparison.\n" );
+	fprintf( fp, " *\n" );
+	fprintf( fp, " * Generated by bldhash/hash_marc; do not edit.\n" );
 	fprintf( fp, " */\n" );
 	fprintf( fp, "\n" );
 
 	fprintf( fp, "#include <stdlib.h>\n" );
 	fprintf( fp, "#include <string.h>\n" );
-	fprintf( fp, "#include \"hash.h\"\n" );
+	fprintf( fp, "#include \"mph.h\"\n" );
 	fprintf( fp, "#include \"marc_auth.h\"\n" );
 	fprintf( fp, "\n" );
 
@@ -1034,47 +953,18 @@ write_header( FILE *fp )
 	fprintf( fp, "\tchar *internal_name;\n" );
 	fprintf( fp, "\tchar *abbreviation;\n" );
 	fprintf( fp, "} marc_trans;\n\n" );
-
-#if 0
-	fprintf( fp, "/*\n" );
-	fprintf( fp, " * Bob Jenkin's one-at-a-time hash\n" );
-	fprintf( fp, " */\n" );
-	fprintf( fp, "\n" );
-
-	fprintf( fp, "static unsigned int\n" );
-	fprintf( fp, "one_at_a_time_hash( const char *key, const unsigned int len, unsigned int HASH_SIZE )\n" );
-	fprintf( fp, "{\n" );
-	fprintf( fp, "\tunsigned int hash = 0, i;\n" );
-	fprintf( fp, "\tfor ( i=0; i<len; ++i ) {\n" );
-	fprintf( fp, "\t\thash += key[i];\n" );
-	fprintf( fp, "\t\thash += ( hash << 10 );\n" );
-	fprintf( fp, "\t\thash ^= ( hash >> 6 );\n" );
-	fprintf( fp, "\t}\n" );
-	fprintf( fp, "\thash += ( hash << 3 );\n" );
-	fprintf( fp, "\thash ^= ( hash >> 11 );\n" );
-	fprintf( fp, "\thash += ( hash << 15 );\n" );
-	fprintf( fp, "\treturn hash % ( HASH_SIZE - 1 );\n" );
-	fprintf( fp, "}\n\n" );
-
-	fprintf( fp, "static unsigned int\n" );
-	fprintf( fp, "calculate_hash_char( const char *key, unsigned int HASH_SIZE )\n" );
-	fprintf( fp, "{\n" );
-	fprintf( fp, "\treturn one_at_a_time_hash( key, strlen( key ), HASH_SIZE );\n" );
-	fprintf( fp, "}\n\n" );
-#endif
 }
 
 int
 main( int argc, char *argv[] )
 {
+	int ok = 1;
+
 	write_header( stdout );
-	fflush( NULL );
-	hashify_marc( marc_genre, nmarc_genre, "genre" );
-	fflush( NULL );
-	hashify_marc( marc_resource, nmarc_resource, "resource" );
-	fflush( NULL );
-	hashify_marc_trans( marc_relators, nmarc_relators, "relators", "www.loc.gov/marc/relators/relacode.html" );
-	fflush( NULL );
-	hashify_marc_trans( marc_country, nmarc_country, "country", "www.loc.gov/marc/countries/countries_code.html" );
-	fflush( NULL );
+	ok &= hashify_marc( marc_genre, nmarc_genre, "genre" );
+	ok &= hashify_marc( marc_resource, nmarc_resource, "resource" );
+	ok &= hashify_marc_trans( marc_relators, nmarc_relators, "relators", "www.loc.gov/marc/relators/relacode.html" );
+	ok &= hashify_marc_trans( marc_country, nmarc_country, "country", "www.loc.gov/marc/countries/countries_code.html" );
+
+	return ( ok ) ? EXIT_SUCCESS : EXIT_FAILURE;
 }
@@ -0,0 +1,244 @@
+/*
+ * mph_gen.c - build minimal perfect hash indices for bldhash generators
+ *
+ * Copyright (c) Chris Putnam 2021
+ *
+ * Source code released under the GPL version 2
+ *
+ * Hash, displace and compress: keys are split into about nkeys/3
+ * buckets, the buckets are placed largest first by searching for a
+ * seed that scatters all of their keys into free slots, and the
+ * buckets left with a single key are dropped into the remaining free
+ * slots directly. The runtime half lives in lib/mph.c.
+ */
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include "mph_gen.h"
+
+#define MPH_GEN_MAXSEED (1<<24)
+
+void
+mph_gen_init( mph_gen *g )
+{
+	g->h.nkeys    = 0;
+	g->h.nbuckets = 0;
+	g->h.disp     = NULL;
+	g->h.nocase   = MPH_CASE;
+	g->disp       = NULL;
+	g->slot       = NULL;
+}
+
+void
+mph_gen_free( mph_gen *g )
+{
+	if ( g->disp ) free( g->disp );
+	if ( g->slot ) free( g->slot );
+	mph_gen_init( g );
+}
+
+const char *
+mph_gen_errstr( int status )
+{
+	switch ( status ) {
+	case MPH_GEN_OK:        return "ok";
+	case MPH_GEN_MEMERR:    return "memory error";
+	case MPH_GEN_DUPLICATE: return "duplicate key";
+	case MPH_GEN_NOSEED:    return "no displacement found";
+	case MPH_GEN_BADINDEX:  return "index failed verification";
+	default:                return "unknown error";
+	}
+}
+
+static int
+mph_gen_samekey( mph_gen *g, const char *a, const char *b )
+{
+	if ( g->h.nocase ) return !strcasecmp( a, b );
+	else return !strcmp( a, b );
+}
+
+typedef struct {
+	unsigned int bucket;
+	int          n;
+	int          *keys;
+} mph_gen_bucket;
+
+static int
+mph_gen_bucket_cmp( const void *a, const void *b )
+{
+	const mph_gen_bucket *ba = a, *bb = b;
+	if ( ba->n != bb->n ) return bb->n - ba->n;
+	if ( ba->bucket < bb->bucket ) return -1;
+	if ( ba->bucket > bb->bucket ) return 1;
+	return 0;
+}
+
+/* mph_gen_place()
+ *
+ * Find the first seed sending every key of bucket b to a distinct free slot.
+ */
+static int
+mph_gen_place( mph_gen *g, const char *keys[], mph_gen_bucket *b, unsigned char *taken, unsigned int *trial )
+{
+	unsigned int seed, s;
+	int i, j, ok;
+
+	for ( seed=1; seed<MPH_GEN_MAXSEED; ++seed ) {
+		ok = 1;
+		for ( i=0; i<b->n && ok; ++i ) {
+			s = mph_hash( keys[b->keys[i]], strlen( keys[b->keys[i]] ), seed, g->h.nocase ) % g->h.nkeys;
+			if ( taken[s] ) ok = 0;
+			for ( j=0; j<i && ok; ++j )
+				if ( trial[j]==s ) ok = 0;
+			trial[i] = s;
+		}
+		if ( !ok ) continue;
+		for ( i=0; i<b->n; ++i ) {
+			taken[trial[i]] = 1;
+			g->slot[b->keys[i]] = trial[i];
+		}
+		g->disp[b->bucket] = (int) seed;
+		return MPH_GEN_OK;
+	}
+
+	return MPH_GEN_NOSEED;
+}
+
+static int
+mph_gen_place_all( mph_gen *g, const char *keys[], int nkeys, mph_gen_bucket *buckets, int *members )
+{
+	unsigned char *taken;
+	unsigned int *trial, free_slot = 0;
+	int i, j, k, status = MPH_GEN_OK;
+
+	taken = ( unsigned char * ) calloc( nkeys + 1, sizeof( unsigned char ) );
+	trial = ( unsigned int * ) calloc( nkeys + 1, sizeof( unsigned int ) );
+	if ( !taken || !trial ) { status = MPH_GEN_MEMERR; goto out; }
+
+	/* group keys by bucket */
+	for ( i=0; i<nkeys; ++i )
+		buckets[ mph_hash( keys[i], strlen( keys[i] ), 0, g->h.nocase ) % g->h.nbuckets ].n++;
+	for ( i=0, k=0; i<(int)g->h.nbuckets; ++i ) {
+		buckets[i].bucket = i;
+		buckets[i].keys   = &(members[k]);
+		k += buckets[i].n;
+		buckets[i].n = 0;
+	}
+	for ( i=0; i<nkeys; ++i ) {
+		mph_gen_bucket *b = &(buckets[ mph_hash( keys[i], strlen( keys[i] ), 0, g->h.nocase ) % g->h.nbuckets ]);
+		for ( j=0; j<b->n; ++j )
+			if ( mph_gen_samekey( g, keys[b->keys[j]], keys[i] ) ) {
+				fprintf( stderr, "mph_gen: duplicate key '%s'\n", keys[i] );
+				status = MPH_GEN_DUPLICATE;
+				goto out;
+			}
+		b->keys[b->n++] = i;
+	}
+
+	qsort( buckets, g->h.nbuckets, sizeof( mph_gen_bucket ), mph_gen_bucket_cmp );
+
+	for ( i=0; i<(int)g->h.nbuckets; ++i ) {
+		if ( buckets[i].n==0 ) break;
+		if ( buckets[i].n==1 ) {
+			while ( taken[free_slot] ) free_slot++;
+			taken[free_slot] = 1;
+			g->slot[buckets[i].keys[0]] = free_slot;
+			g->disp[buckets[i].bucket] = -(int)free_slot - 1;
+		} else {
+			status = mph_gen_place( g, keys, &(buckets[i]), taken, trial );
+			if ( status!=MPH_GEN_OK ) goto out;
+		}
+	}
+out:
+	if ( taken ) free( taken );
+	if ( trial ) free( trial );
+	return status;
+}
+
+/* mph_gen_build()
+ *
+ * Build an index over keys[0..nkeys-1]. Keys must be distinct
+ * (ignoring case if nocase is set); the result is always checked with
+ * mph_gen_verify().
+ */
+int
+mph_gen_build( mph_gen *g, const char *keys[], int nkeys, int nocase )
+{
+	mph_gen_bucket *buckets = NULL;
+	int *members = NULL;
+	int status;
+
+	mph_gen_free( g );
+
+	g->h.nkeys    = nkeys;
+	g->h.nbuckets = nkeys / 3 + 1;
+	g->h.nocase   = nocase;
+
+	g->disp  = ( int * ) calloc( g->h.nbuckets, sizeof( int ) );
+	g->slot  = ( unsigned int * ) calloc( nkeys + 1, sizeof( unsigned int ) );
+	buckets  = ( mph_gen_bucket * ) calloc( g->h.nbuckets, sizeof( mph_gen_bucket ) );
+	members  = ( int * ) calloc( nkeys + 1, sizeof( int ) );
+	if ( !g->disp || !g->slot || !buckets || !members ) {
+		status = MPH_GEN_MEMERR;
+		goto out;
+	}
+	g->h.disp = g->disp;
+
+	status = mph_gen_place_all( g, keys, nkeys, buckets, members );
+	if ( status==MPH_GEN_OK ) status = mph_gen_verify( g, keys, nkeys );
+out:
+	if ( buckets ) free( buckets );
+	if ( members ) free( members );
+	return status;
+}
+
+/* mph_gen_verify()
+ *
+ * Look every key up through the runtime code and check that the keys
+ * land exactly on the slots recorded at build time, one key per slot.
+ */
+int
+mph_gen_verify( mph_gen *g, const char *keys[], int nkeys )
+{
+	unsigned char *seen;
+	unsigned int s;
+	int i, status = MPH_GEN_OK;
+
+	if ( (unsigned int) nkeys != g->h.nkeys ) return MPH_GEN_BADINDEX;
+
+	seen = ( unsigned char * ) calloc( nkeys + 1, sizeof( unsigned char ) );
+	if ( !seen ) return MPH_GEN_MEMERR;
+
+	for ( i=0; i<nkeys && status==MPH_GEN_OK; ++i ) {
+		s = mph_slot( &(g->h), keys[i] );
+		if ( s >= g->h.nkeys || s != g->slot[i] || seen[s] ) {
+			fprintf( stderr, "mph_gen: key '%s' does not map to a slot of its own\n", keys[i] );
+			status = MPH_GEN_BADINDEX;
+		}
+		else seen[s] = 1;
+	}
+
+	free( seen );
+	return status;
+}
+
+/* mph_gen_write()
+ *
+ * Write the displacement table and mph struct as name_disp and name_hash.
+ */
+void
+mph_gen_write( FILE *fp, mph_gen *g, const char *name )
+{
+	unsigned int i;
+
+	fprintf( fp, "static const int %s_disp[%u] = {", name, g->h.nbuckets );
+	for ( i=0; i<g->h.nbuckets; ++i ) {
+		if ( i%10==0 ) fprintf( fp, "\n\t" );
+		else fprintf( fp, " " );
+		fprintf( fp, "%d,", g->disp[i] );
+	}
+	fprintf( fp, "\n};\n" );
+	fprintf( fp, "static const mph %s_hash = { %u, %u, %s_disp, %s };\n\n",
+		name, g->h.nkeys, g->h.nbuckets, name,
+		( g->h.nocase ) ? "MPH_NOCASE" : "MPH_CASE" );
+}
@@ -0,0 +1,36 @@
+/*
+ * mph_gen.h - build minimal perfect hash indices for bldhash generators
+ *
+ * Copyright (c) Chris Putnam 2021
+ *
+ * Source code released under the GPL version 2
+ */
+#ifndef MPH_GEN_H
+#define MPH_GEN_H
+
+#include <stdio.h>
+#include "mph.h"
+
+#define MPH_GEN_OK        (0)
+#define MPH_GEN_MEMERR    (-1)
+#define MPH_GEN_DUPLICATE (-2)
+#define MPH_GEN_NOSEED    (-3)
+#define MPH_GEN_BADINDEX  (-4)
+
+/* h describes the index (h.disp points into disp); slot[i] is the
+ * slot of the i-th key passed to mph_gen_build().
+ */
+typedef struct mph_gen {
+	mph          h;
+	int          *disp;
+	unsigned int *slot;
+} mph_gen;
+
+void mph_gen_init( mph_gen *g );
+void mph_gen_free( mph_gen *g );
+int  mph_gen_build( mph_gen *g, const char *keys[], int nkeys, int nocase );
+int  mph_gen_verify( mph_gen *g, const char *keys[], int nkeys );
+void mph_gen_write( FILE *fp, mph_gen *g, const char *name );
+const char *mph_gen_errstr( int status );
+
+#endif
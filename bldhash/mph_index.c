@@ -0,0 +1,221 @@
+/*
+ * mph_index.c
+ *
+ * Copyright (c) Chris Putnam 2021
+ *
+ * Source code released under the GPL version 2
+ *
+ * Write minimal perfect hash indices over the keys of tables that
+ * live in lib/ as C source:
+ *
+ *     mph_index iso639_1 > ../lib/iso639_1_index.c
+ *     mph_index iso639_2 > ../lib/iso639_2_index.c
+ *     mph_index iso639_3 > ../lib/iso639_3_index.c
+ *     mph_index adsout_journals > ../lib/adsout_journals_index.c
+ *
+ * Each index is NAME_pos[], the table position of the key in each
+ * slot, and NAME_hash; see mph_find() in lib/mph.c. The keys of these
+ * tables repeat, so only the first entry with a key is indexed.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include "mph_gen.h"
+
+#define ISO639_BLDINDEX
+#include "iso639_1.c"
+#include "iso639_2.c"
+#include "iso639_3.c"
+#include "adsout_journals.c"
+
+/* key of table entry n for the index being built */
+static const char *(*getkey)( int n );
+
+static const char *iso639_1_code( int n ) { return iso639_1[n].code; }
+static const char *iso639_1_lang( int n ) { return iso639_1[n].language; }
+static const char *iso639_2_code1( int n ) { return iso639_2[n].code1; }
+static const char *iso639_2_code2( int n ) { return iso639_2[n].code2; }
+static const char *iso639_2_lang( int n ) { return iso639_2[n].language; }
+static const char *iso639_3_code( int n ) { return iso639_3[n].code; }
+static const char *iso639_3_lang( int n ) { return iso639_3[n].language; }
+
+/* the journal name, past the five character abbreviation and space */
+static const char *journal_name( int n ) { return journals[n] + 6; }
+
+static int
+index_comp( const void *v1, const void *v2 )
+{
+	int n1 = *( const int * ) v1, n2 = *( const int * ) v2;
+	int n;
+
+	n = strcasecmp( getkey( n1 ), getkey( n2 ) );
+	if ( n ) return n;
+
+	/* keep equal keys in table order so the first entry is indexed */
+	return n1 - n2;
+}
+
+static void
+memerr( void )
+{
+	fprintf( stderr, "mph_index: memory error\n" );
+	exit( EXIT_FAILURE );
+}
+
+/* write_index()
+ *
+ * Index the keys of the table positions in list, case-insensitively.
+ */
+static void
+write_index( FILE *fp, const char *name, int *list, int nlist, const char *(*key)( int ) )
+{
+	const char **keys;
+	int i, n, status;
+	int *pos, *order;
+	mph_gen g;
+
+	getkey = key;
+	qsort( list, nlist, sizeof( int ), index_comp );
+
+	keys  = ( const char ** ) malloc( sizeof( char * ) * ( nlist + 1 ) );
+	pos   = ( int * ) malloc( sizeof( int ) * ( nlist + 1 ) );
+	order = ( int * ) malloc( sizeof( int ) * ( nlist + 1 ) );
+	if ( !keys || !pos || !order ) memerr();
+
+	for ( i=n=0; i<nlist; ++i ) {
+		if ( n && !strcasecmp( keys[n-1], key( list[i] ) ) ) continue;
+		keys[n] = key( list[i] );
+		pos[n]  = list[i];
+		n++;
+	}
+
+	mph_gen_init( &g );
+	status = mph_gen_build( &g, keys, n, MPH_NOCASE );
+	if ( status!=MPH_GEN_OK ) {
+		fprintf( stderr, "mph_index: cannot hash %s: %s\n", name, mph_gen_errstr( status ) );
+		exit( EXIT_FAILURE );
+	}
+
+	for ( i=0; i<n; ++i )
+		order[ g.slot[i] ] = pos[i];
+
+	fprintf( fp, "static const unsigned short %s_pos[%d] = {", name, n );
+	for ( i=0; i<n; ++i ) {
+		if ( i%10==0 ) fprintf( fp, "\n\t" );
+		else fprintf( fp, " " );
+		fprintf( fp, "%d,", order[i] );
+	}
+	fprintf( fp, "\n};\n" );
+	mph_gen_write( fp, &g, name );
+
+	mph_gen_free( &g );
+	free( order );
+	free( pos );
+	free( keys );
+}
+
+static int *
+index_alloc( int n )
+{
+	int *list;
+
+	list = ( int * ) malloc( sizeof( int ) * n );
+	if ( !list ) memerr();
+
+	return list;
+}
+
+static void
+write_header( FILE *fp, const char *table, const char *file )
+{
+	fprintf( fp, "/*\n" );
+	fprintf( fp, " * %s_index.c\n", file );
+	fprintf( fp, " *\n" );
+	fprintf( fp, " * Minimal perfect hash indices over the keys of %s[], for\n", table );
+	fprintf( fp, " * mph_find(); the first entry with a key wins.\n" );
+	fprintf( fp, " *\n" );
+	fprintf( fp, " * Generated by bldhash/mph_index; do not edit.\n" );
+	fprintf( fp, " */\n" );
+}
+
+static void
+write_iso639_1( FILE *fp )
+{
+	int i, *list = index_alloc( niso639_1 );
+
+	write_header( fp, "iso639_1", "iso639_1" );
+	for ( i=0; i<niso639_1; ++i ) list[i] = i;
+	write_index( fp, "iso639_1_bycode", list, niso639_1, iso639_1_code );
+	for ( i=0; i<niso639_1; ++i ) list[i] = i;
+	write_index( fp, "iso639_1_bylang", list, niso639_1, iso639_1_lang );
+
+	free( list );
+}
+
+static void
+write_iso639_2( FILE *fp )
+{
+	int i, n, *list = index_alloc( niso639_2 );
+
+	write_header( fp, "iso639_2", "iso639_2" );
+
+	/* only main entries are looked up by code */
+	for ( i=n=0; i<niso639_2; ++i )
+		if ( iso639_2[i].main ) list[n++] = i;
+	write_index( fp, "iso639_2_bycode1", list, n, iso639_2_code1 );
+	for ( i=n=0; i<niso639_2; ++i )
+		if ( iso639_2[i].main && iso639_2[i].code2[0]!='\0' ) list[n++] = i;
+	write_index( fp, "iso639_2_bycode2", list, n, iso639_2_code2 );
+
+	for ( i=0; i<niso639_2; ++i ) list[i] = i;
+	write_index( fp, "iso639_2_bylang", list, niso639_2, iso639_2_lang );
+
+	free( list );
+}
+
+static void
+write_iso639_3( FILE *fp )
+{
+	int i, *list = index_alloc( niso639_3 );
+
+	write_header( fp, "iso639_3", "iso639_3" );
+	for ( i=0; i<niso639_3; ++i ) list[i] = i;
+	write_index( fp, "iso639_3_bycode", list, niso639_3, iso639_3_code );
+	for ( i=0; i<niso639_3; ++i ) list[i] = i;
+	write_index( fp, "iso639_3_bylang", list, niso639_3, iso639_3_lang );
+
+	free( list );
+}
+
+static void
+write_adsout_journals( FILE *fp )
+{
+	int i, *list = index_alloc( njournals );
+
+	write_header( fp, "journals", "adsout_journals" );
+	for ( i=0; i<njournals; ++i ) list[i] = i;
+	write_index( fp, "journals_byname", list, njournals, journal_name );
+
+	free( list );
+}
+
+int
+main( int argc, char *argv[] )
+{
+	if ( argc!=2 ) {
+		fprintf( stderr, "usage: %s iso639_1|iso639_2|iso639_3|adsout_journals\n", argv[0] );
+		return EXIT_FAILURE;
+	}
+
+	if ( !strcmp( argv[1], "iso639_1" ) ) write_iso639_1( stdout );
+	else if ( !strcmp( argv[1], "iso639_2" ) ) write_iso639_2( stdout );
+	else if ( !strcmp( argv[1], "iso639_3" ) ) write_iso639_3( stdout );
+	else if ( !strcmp( argv[1], "adsout_journals" ) ) write_adsout_journals( stdout );
+	else {
+		fprintf( stderr, "%s: unknown table '%s'\n", argv[0], argv[1] );
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,168 @@
+/*
+ * mph_table.c - write a minimal perfect hash table for a list of strings
+ *
+ * Copyright (c) Chris Putnam 2021
+ *
+ * Source code released under the GPL version 2
+ *
+ * usage: mph_table [-i] [-t TYPE] name [file]
+ *
+ * Reads one key per line (optionally followed by a tab and a value)
+ * and writes name_keys[] (and name_values[]) in slot order plus the
+ * name_hash index, so that a lookup is
+ *
+ *     n = mph_slot( &name_hash, query );
+ *     if ( !strcmp( query, name_keys[n] ) ) ...
+ *
+ * -i builds a case-insensitive index (compare with strcasecmp()).
+ *
+ * -t TYPE writes the values as they are, as the initializers of a
+ * TYPE array, e.g. enum constants or "{ FLAG, "text" }" for a struct
+ * the including file defines; otherwise they are strings.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "mph_gen.h"
+
+static void
+memerr( void )
+{
+	fprintf( stderr, "mph_table: memory error\n" );
+	exit( EXIT_FAILURE );
+}
+
+static char *
+dupn( const char *p, size_t n )
+{
+	char *s = malloc( n + 1 );
+	if ( !s ) memerr();
+	memcpy( s, p, n );
+	s[n] = '\0';
+	return s;
+}
+
+static void
+write_cstring( FILE *fp, const char *s )
+{
+	fputc( '"', fp );
+	for ( ; *s; ++s ) {
+		if ( *s=='"' || *s=='\\' ) fputc( '\\', fp );
+		fputc( *s, fp );
+	}
+	fputc( '"', fp );
+}
+
+static void
+write_strings( FILE *fp, const char *name, const char *suffix, char **list, mph_gen *g )
+{
+	unsigned int i, *order;
+
+	order = malloc( sizeof( unsigned int ) * ( g->h.nkeys + 1 ) );
+	if ( !order ) memerr();
+	for ( i=0; i<g->h.nkeys; ++i )
+		order[ g->slot[i] ] = i;
+
+	fprintf( fp, "static const char *%s_%s[%u] = {\n", name, suffix, g->h.nkeys );
+	for ( i=0; i<g->h.nkeys; ++i ) {
+		fprintf( fp, "\t" );
+		write_cstring( fp, list[ order[i] ] );
+		fprintf( fp, ",\n" );
+	}
+	fprintf( fp, "};\n" );
+
+	free( order );
+}
+
+static void
+write_values( FILE *fp, const char *name, const char *type, char **list, mph_gen *g )
+{
+	unsigned int i, *order;
+
+	order = malloc( sizeof( unsigned int ) * ( g->h.nkeys + 1 ) );
+	if ( !order ) memerr();
+	for ( i=0; i<g->h.nkeys; ++i )
+		order[ g->slot[i] ] = i;
+
+	fprintf( fp, "static const %s %s_values[%u] = {\n", type, name, g->h.nkeys );
+	for ( i=0; i<g->h.nkeys; ++i )
+		fprintf( fp, "\t%s,\n", list[ order[i] ] );
+	fprintf( fp, "};\n" );
+
+	free( order );
+}
+
+int
+main( int argc, char *argv[] )
+{
+	char line[4096], **keys = NULL, **values = NULL, *tab;
+	int nocase = MPH_CASE, hasvalues = 0, n = 0, max = 0, len, status;
+	const char *name, *type = NULL;
+	FILE *fp = stdin;
+	mph_gen g;
+
+	while ( argc > 1 && argv[1][0]=='-' ) {
+		if ( !strcmp( argv[1], "-i" ) ) {
+			nocase = MPH_NOCASE;
+			argc--;
+			argv++;
+		} else if ( !strcmp( argv[1], "-t" ) && argc > 2 ) {
+			type = argv[2];
+			argc -= 2;
+			argv += 2;
+		} else break;
+	}
+	if ( argc < 2 || argc > 3 ) {
+		fprintf( stderr, "usage: mph_table [-i] [-t TYPE] name [file]\n" );
+		return EXIT_FAILURE;
+	}
+	name = argv[1];
+	if ( argc==3 ) {
+		fp = fopen( argv[2], "r" );
+		if ( !fp ) {
+			fprintf( stderr, "mph_table: cannot open %s\n", argv[2] );
+			return EXIT_FAILURE;
+		}
+	}
+
+	while ( fgets( line, sizeof( line ), fp ) ) {
+		len = strlen( line );
+		while ( len > 0 && ( line[len-1]=='\n' || line[len-1]=='\r' ) ) line[--len] = '\0';
+		if ( len==0 ) continue;
+		if ( n==max ) {
+			max = ( max ) ? max * 2 : 64;
+			keys   = realloc( keys, sizeof( char * ) * max );
+			values = realloc( values, sizeof( char * ) * max );
+			if ( !keys || !values ) memerr();
+		}
+		tab = strchr( line, '\t' );
+		if ( tab ) {
+			keys[n]   = dupn( line, tab - line );
+			values[n] = dupn( tab + 1, strlen( tab + 1 ) );
+			hasvalues = 1;
+		} else {
+			keys[n]   = dupn( line, len );
+			values[n] = dupn( "", 0 );
+		}
+		n++;
+	}
+	if ( fp!=stdin ) fclose( fp );
+
+	mph_gen_init( &g );
+
+	status = mph_gen_build( &g, (const char **) keys, n, nocase );
+	if ( status!=MPH_GEN_OK ) {
+		fprintf( stderr, "mph_table: cannot hash %s: %s\n", name, mph_gen_errstr( status ) );
+		return EXIT_FAILURE;
+	}
+
+	printf( "/* %d keys, generated by bldhash/mph_table; do not edit. */\n", n );
+	write_strings( stdout, name, "keys", keys, &g );
+	if ( hasvalues && type ) write_values( stdout, name, type, values, &g );
+	else if ( hasvalues ) write_strings( stdout, name, "values", values, &g );
+	mph_gen_write( stdout, &g, name );
+
+	mph_gen_free( &g );
+
+	return EXIT_SUCCESS;
+}
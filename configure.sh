@@ -330,6 +330,17 @@ else
 	POSTFIX=''
 fi
 
+#
+# Threaded output uses POSIX threads where available
+#
+if [ "$type" = "MinGW" ] ; then
+	THREADFLAGS=''
+	CFLAGS="${CFLAGS} -DBIBL_NO_THREADS"
+	CLIBFLAGS="${CLIBFLAGS} -DBIBL_NO_THREADS"
+else
+	THREADFLAGS='-pthread'
+fi
+
 #
 # Set up for dynamic or static libraries
 #
@@ -355,6 +366,7 @@ cat $INPUT_FILE | \
 sed "s/REPLACE_CC/${CC}/" | \
 sed "s/REPLACE_CFLAGS/${CFLAGS}/" | \
 sed "s/REPLACE_CLIBFLAGS/${CLIBFLAGS}/" | \
+sed "s/REPLACE_THREADFLAGS/${THREADFLAGS}/" | \
 sed "s/REPLACE_EXEEXT/${EXEEXT}/" | \
 sed "s/REPLACE_LIBTARGET/${LIBTARGET}/" | \
 sed "s/REPLACE_LIBEXT/${LIBEXT}/" | \
@@ -14,6 +14,7 @@
 #include <ctype.h>
 #include "utf8.h"
 #include "str.h"
+#include "mph.h"
 #include "fields.h"
 #include "append_easy.h"
 #include "generic.h"
@@ -28,7 +29,7 @@
  PUBLIC: int adsout_initparams()
 *****************************************************/
 
-static int adsout_write( fields *in, FILE *fp, param *p, unsigned long refnum );
+static int adsout_write( fields *in, sink *s, param *p, unsigned long refnum );
 static int adsout_assemble( fields *in, fields *out, param *pm, unsigned long refnum );
 
 int
@@ -46,6 +47,7 @@ adsout_initparams( param *pm, const char *progname )
 	pm->verbose          = 0;
 	pm->addcount         = 0;
 	pm->singlerefperfile = 0;
+	pm->nthreads         = 0;
 
 	if ( pm->charsetout == BIBL_CHARSET_UNICODE ) {
 		pm->utf8out = pm->utf8bom = 1;
@@ -310,6 +312,14 @@ append_date( fields *in, char *adstag, int level, fields *out, int *status )
 
 #include "adsout_journals.c"
 
+#include "adsout_journals_index.c"
+
+static const char *
+journal_name( int n )
+{
+	return journals[n] + 6;
+}
+
 static void
 output_4digit_value( char *pos, long long n )
 {
@@ -435,15 +445,12 @@ static int
 get_journalabbr( fields *in )
 {
 	char *jrnl;
-	int n, j;
+	int n;
 
 	n = fields_find( in, "TITLE", LEVEL_HOST );
 	if ( n!=FIELDS_NOTFOUND ) {
 		jrnl = fields_value( in, n, FIELDS_CHRP );
-		for ( j=0; j<njournals; j++ ) {
-			if ( !strcasecmp( jrnl, journals[j]+6 ) )
-				return j;
-		}
+		return mph_find( &journals_byname_hash, journals_byname_pos, jrnl, journal_name );
 	}
 	return -1;
 }
@@ -566,7 +573,7 @@ adsout_assemble( fields *in, fields *out, param *pm, unsigned long refnum )
 *****************************************************/
 
 static int
-adsout_write( fields *out, FILE *fp, param *p, unsigned long refnum )
+adsout_write( fields *out, sink *s, param *p, unsigned long refnum )
 {
 	const char *tag, *value;
 	int i;
@@ -574,10 +581,12 @@ adsout_write( fields *out, FILE *fp, param *p, unsigned long refnum )
 	for ( i=0; i<out->n; ++i ) {
 		tag   = fields_tag( out, i, FIELDS_CHRP );
 		value = fields_value( out, i, FIELDS_CHRP );
-		fprintf( fp, "%s %s\n", tag, value );
+		sink_puts( s, tag );
+		sink_putc( s, ' ' );
+		sink_puts( s, value );
+		sink_putc( s, '\n' );
 	}
 
-	fprintf( fp, "\n" );
-	fflush( fp );
+	sink_putc( s, '\n' );
 	return BIBL_OK;
 }
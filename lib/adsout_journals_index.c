@@ -0,0 +1,602 @@
+/*
+ * adsout_journals_index.c
+ *
+ * Minimal perfect hash indices over the keys of journals[], for
+ * mph_find(); the first entry with a key wins.
+ *
+ * Generated by bldhash/mph_index; do not edit.
+ */
+static const unsigned short journals_byname_pos[4407] = {
+	3688, 2448, 2862, 2488, 3557, 585, 3495, 3116, 320, 2678,
+	4277, 3665, 3377, 3919, 132, 2721, 1067, 1260, 2609, 2802,
+	356, 3995, 1674, 911, 2434, 3822, 2858, 1268, 1095, 3967,
+	4338, 3878, 2675, 895, 3606, 3331, 2820, 4203, 3844, 4275,
+	3281, 2137, 3500, 2085, 2413, 3695, 186, 4352, 3172, 3873,
+	3386, 3145, 4221, 2945, 2081, 332, 2992, 887, 3942, 642,
+	3561, 3370, 2999, 175, 2157, 4134, 88, 3408, 592, 1762,
+	3000, 1634, 1194, 2876, 82, 4212, 479, 1559, 807, 3633,
+	4231, 2668, 277, 2268, 3759, 962, 731, 1527, 282, 4038,
+	972, 812, 757, 1751, 1782, 4119, 453, 107, 13, 4181,
+	2661, 2651, 292, 3614, 1026, 1526, 4016, 1735, 1418, 4335,
+	1646, 299, 3225, 1553, 2599, 195, 3181, 3136, 2216, 1922,
+	683, 2400, 3404, 765, 2672, 1792, 3262, 2844, 1316, 3271,
+	3018, 2110, 978, 3955, 4070, 1821, 738, 3432, 648, 1275,
+	1582, 2016, 386, 2631, 3485, 486, 3983, 2854, 1365, 2530,
+	612, 2405, 793, 1405, 3226, 688, 2251, 763, 458, 3349,
+	697, 1992, 1915, 152, 4263, 531, 1325, 1951, 5, 2331,
+	3497, 1577, 1875, 4358, 1326, 733, 3415, 1985, 4324, 1909,
+	4117, 838, 1578, 2612, 862, 1595, 2618, 2990, 791, 2489,
+	341, 3689, 1977, 3811, 1822, 4210, 406, 2589, 1245, 1504,
+	2697, 371, 656, 1403, 1313, 4292, 1793, 441, 2442, 1104,
+	2528, 829, 2823, 3741, 1157, 2108, 3359, 2406, 3534, 1786,
+	626, 1705, 3785, 1383, 1038, 4056, 2725, 830, 3974, 2462,
+	2724, 2142, 3219, 1857, 240, 1493, 2926, 1531, 1995, 2260,
+	4046, 3524, 4302, 3839, 333, 915, 4199, 3986, 1653, 1681,
+	3941, 410, 3068, 681, 3286, 3740, 4385, 1706, 633, 1163,
+	470, 1897, 3645, 2991, 2171, 1015, 3782, 4419, 1872, 4327,
+	3775, 433, 2711, 146, 3224, 338, 1008, 776, 4409, 1760,
+	924, 1359, 3657, 3899, 1299, 2031, 2664, 3901, 3481, 1654,
+	4045, 1159, 455, 3831, 1683, 3723, 4061, 2752, 1590, 391,
+	1776, 1447, 36, 3450, 4390, 995, 2806, 284, 3308, 3053,
+	4003, 2674, 689, 92, 1721, 1041, 3403, 4115, 4157, 1671,
+	3078, 1432, 3975, 2553, 614, 3117, 435, 2239, 4036, 3757,
+	3460, 679, 423, 272, 4244, 3999, 1838, 4251, 4180, 104,
+	1108, 909, 2842, 3008, 3960, 30, 2156, 3182, 527, 3907,
+	2356, 3558, 2895, 3324, 2703, 2601, 2454, 2077, 2131, 1869,
+	167, 3644, 3060, 322, 2078, 4010, 533, 3530, 2299, 803,
+	4034, 3714, 2578, 3659, 3239, 373, 1902, 4396, 2254, 3835,
+	243, 1166, 3390, 1727, 528, 851, 3544, 3868, 4136, 3895,
+	3879, 2089, 988, 2471, 814, 2289, 3678, 1161, 2420, 2466,
+	1746, 2209, 1752, 2138, 1363, 283, 4370, 2970, 868, 3926,
+	231, 39, 2410, 4376, 1507, 587, 56, 3299, 211, 3424,
+	2976, 4094, 430, 134, 1686, 2811, 2877, 151, 2908, 3514,
+	727, 1851, 3923, 3726, 3384, 384, 1668, 1999, 2932, 3889,
+	1604, 1715, 4196, 854, 4130, 3798, 2972, 1101, 3310, 3932,
+	4106, 184, 3535, 1618, 4006, 2402, 288, 2789, 2105, 2595,
+	3851, 1320, 2649, 4249, 1948, 3823, 2106, 2698, 2133, 3080,
+	61, 1277, 3761, 3351, 2395, 411, 4321, 2965, 3658, 293,
+	2339, 678, 3783, 1238, 2192, 393, 3213, 4310, 2083, 1825,
+	3770, 2114, 1489, 2080, 2677, 1758, 2023, 3817, 2011, 123,
+	3138, 4262, 3189, 2550, 1702, 1880, 2797, 2716, 3809, 1533,
+	2459, 3144, 1212, 3921, 4123, 1223, 3099, 3656, 96, 3423,
+	934, 2933, 3957, 498, 535, 480, 3764, 1112, 1195, 3064,
+	2101, 1540, 2320, 4102, 3903, 4284, 1576, 2726, 715, 1079,
+	3227, 4076, 1413, 3162, 1813, 2311, 46, 2294, 1107, 875,
+	67, 394, 1109, 4138, 2052, 2332, 1535, 3669, 1190, 2180,
+	3024, 2075, 2964, 3886, 890, 2496, 563, 630, 620, 4156,
+	2518, 3082, 2284, 431, 420, 657, 1911, 4121, 2212, 3110,
+	4206, 1372, 3595, 1350, 4379, 1768, 2870, 611, 1639, 3508,
+	3503, 2814, 721, 3333, 1271, 26, 3730, 2587, 2967, 3767,
+	4377, 2713, 1285, 1814, 673, 3054, 4132, 2301, 2689, 138,
+	1655, 4069, 516, 3073, 2067, 2206, 2005, 948, 1417, 3494,
+	3625, 321, 2671, 3075, 1050, 2351, 848, 278, 1106, 4004,
+	4207, 38, 2256, 2357, 3936, 518, 3922, 2341, 1031, 3829,
+	3210, 422, 1446, 519, 1097, 2315, 1485, 4330, 4029, 1925,
+	3553, 1081, 16, 4420, 1184, 2208, 637, 2159, 1716, 135,
+	2863, 2389, 3840, 12, 741, 2127, 1128, 622, 1652, 1893,
+	781, 4179, 4057, 2364, 2040, 3650, 2855, 112, 1773, 1657,
+	59, 544, 799, 4286, 1958, 2630, 1246, 824, 1487, 3990,
+	1741, 3092, 3340, 1562, 3255, 3470, 2437, 129, 3994, 3447,
+	3108, 1931, 3084, 3412, 2020, 1831, 1833, 810, 2795, 1511,
+	3705, 1748, 2065, 568, 3396, 3694, 3071, 1082, 2545, 2202,
+	3709, 3363, 3113, 3909, 4253, 1198, 2029, 3754, 2645, 1341,
+	3291, 2794, 2231, 1845, 4170, 1027, 1160, 1093, 365, 1167,
+	483, 1185, 128, 3507, 286, 965, 712, 2407, 1378, 3344,
+	2048, 1293, 583, 2590, 3712, 140, 2758, 2989, 1300, 3608,
+	1479, 1856, 380, 652, 1993, 1406, 3781, 1436, 478, 882,
+	3198, 183, 2182, 3127, 3929, 3536, 10, 2502, 2229, 878,
+	17, 2548, 3676, 843, 1538, 415, 4007, 1391, 859, 1150,
+	2353, 2643, 4050, 2091, 3716, 2134, 2120, 3007, 1729, 3663,
+	34, 4235, 663, 571, 511, 4218, 1938, 3874, 2070, 3601,
+	2636, 4356, 3531, 1841, 1168, 342, 3129, 1311, 3537, 496,
+	3605, 145, 101, 2027, 1182, 2188, 4062, 4357, 4368, 3296,
+	2443, 3171, 1001, 4219, 291, 1570, 1141, 4334, 37, 2613,
+	2852, 954, 1380, 3341, 562, 968, 1040, 3635, 3640, 166,
+	3853, 801, 503, 265, 4013, 1332, 3711, 3724, 2056, 3339,
+	4227, 1492, 2812, 951, 450, 2388, 1138, 3638, 127, 464,
+	3153, 870, 4014, 1126, 312, 3893, 2822, 685, 2380, 1088,
+	1609, 3455, 2476, 2449, 580, 2841, 1669, 3413, 501, 223,
+	3777, 2817, 161, 3696, 1306, 1262, 1714, 2198, 606, 2768,
+	4148, 1317, 1695, 3533, 2344, 1415, 2559, 3222, 3820, 1462,
+	1724, 1766, 2796, 229, 2041, 1021, 551, 1398, 1781, 2439,
+	2622, 153, 331, 2753, 4118, 1169, 47, 2421, 1819, 524,
+	297, 1896, 1355, 4152, 4033, 1234, 1697, 1959, 4175, 4238,
+	1463, 1241, 1846, 2026, 404, 3888, 2949, 729, 3647, 569,
+	3158, 6, 3298, 2021, 1448, 1077, 4318, 4297, 62, 3160,
+	2019, 2896, 3193, 3673, 554, 2667, 4195, 1709, 2143, 1452,
+	317, 2219, 2954, 567, 664, 1506, 2524, 3547, 2498, 2872,
+	0, 1895, 2861, 217, 3949, 1083, 2391, 2109, 1065, 326,
+	3988, 874, 487, 2176, 4214, 1809, 2039, 2648, 2396, 3826,
+	1176, 2886, 4386, 4128, 4109, 1989, 1699, 1648, 3086, 2941,
+	3946, 4347, 2576, 2722, 1453, 2593, 1518, 4191, 98, 3319,
+	1476, 2682, 2121, 3258, 2950, 268, 2809, 1605, 1054, 444,
+	1429, 3091, 1205, 839, 3735, 3861, 3937, 4172, 925, 2427,
+	3610, 970, 290, 3426, 2355, 1723, 3697, 4035, 804, 4091,
+	2141, 1172, 2360, 426, 1935, 1967, 2828, 1248, 3526, 4242,
+	3906, 2226, 4350, 497, 4089, 174, 2755, 2997, 922, 1458,
+	3607, 188, 8, 306, 3249, 2998, 387, 2123, 3846, 3126,
+	1615, 3860, 2381, 222, 2670, 2665, 3490, 3463, 1692, 1508,
+	1944, 3190, 3105, 871, 1700, 3887, 2662, 3736, 783, 155,
+	156, 1080, 3628, 3293, 1982, 1904, 3375, 4103, 254, 3196,
+	2032, 1382, 3631, 1297, 4375, 208, 2747, 2845, 2003, 3713,
+	2529, 926, 35, 3232, 1658, 1486, 3834, 301, 4112, 3685,
+	4402, 795, 1625, 880, 1250, 2047, 359, 1367, 1374, 2458,
+	4145, 2696, 2534, 3355, 2889, 3570, 2987, 452, 97, 2435,
+	1794, 3303, 742, 4229, 1569, 3649, 3070, 124, 2333, 473,
+	2542, 3897, 4114, 1927, 2125, 1769, 2015, 1134, 891, 2412,
+	2606, 168, 4387, 3246, 659, 3556, 1842, 1979, 840, 3329,
+	2465, 617, 3700, 133, 2190, 1689, 1907, 3935, 1874, 2169,
+	2053, 4041, 2483, 691, 4380, 2013, 1084, 3326, 1921, 2525,
+	2986, 3251, 4410, 3947, 748, 2312, 2242, 3683, 3366, 2165,
+	608, 2767, 180, 3051, 2373, 1481, 2181, 1784, 4371, 1281,
+	3325, 4202, 2088, 226, 2304, 2762, 3100, 4037, 645, 1963,
+	2282, 401, 1844, 3917, 2620, 418, 3855, 2730, 4205, 3680,
+	2211, 1981, 3527, 1882, 1449, 3737, 3802, 173, 908, 3118,
+	2709, 2470, 4395, 3780, 421, 2431, 3833, 76, 2426, 1696,
+	977, 3170, 3376, 2830, 25, 3378, 3151, 2897, 361, 1588,
+	3819, 1960, 3996, 2912, 556, 1098, 782, 4032, 2093, 1620,
+	3800, 2136, 3979, 1148, 1202, 4367, 1647, 2921, 3058, 339,
+	3090, 2051, 3186, 3233, 1009, 2930, 3666, 552, 4254, 1115,
+	55, 2961, 1046, 1319, 2621, 2695, 1414, 3419, 577, 3164,
+	2857, 4027, 482, 3211, 2321, 1530, 3109, 4080, 989, 2943,
+	1742, 1678, 3289, 1339, 194, 4065, 1886, 2693, 148, 1247,
+	2942, 169, 1000, 2046, 716, 2257, 248, 3392, 2977, 3125,
+	560, 2826, 3857, 1599, 3517, 227, 454, 3934, 3478, 3739,
+	2342, 3639, 2683, 3166, 3617, 3192, 2036, 2785, 2117, 1969,
+	2532, 2363, 1047, 2808, 3031, 4406, 1431, 446, 3102, 3032,
+	3668, 905, 1565, 2392, 3132, 2478, 463, 2772, 1749, 4154,
+	1231, 305, 3621, 1214, 2759, 3690, 1450, 3816, 447, 3810,
+	2846, 865, 4264, 1416, 4009, 2095, 2130, 69, 2979, 2867,
+	3295, 4224, 3522, 1388, 3244, 3057, 2119, 451, 99, 3354,
+	1068, 1738, 540, 2511, 203, 3389, 2583, 489, 2160, 3972,
+	3773, 2428, 2673, 1871, 4307, 632, 1366, 362, 1608, 1703,
+	2982, 2633, 374, 1800, 2397, 1499, 2244, 1954, 2369, 499,
+	1201, 1310, 1881, 2821, 1788, 1598, 346, 4169, 4378, 3643,
+	609, 1165, 4304, 2699, 1419, 1289, 2971, 3322, 80, 3030,
+	2803, 1204, 2605, 992, 2748, 1571, 760, 582, 847, 893,
+	4309, 1755, 2555, 314, 1685, 2746, 3959, 298, 3572, 723,
+	3845, 3336, 3119, 2712, 2781, 2685, 1722, 2676, 2840, 668,
+	2112, 2798, 822, 3184, 1603, 3203, 2061, 1988, 3721, 710,
+	1044, 1691, 1978, 3318, 262, 2688, 3954, 2474, 2082, 1495,
+	235, 1061, 1303, 3671, 1891, 258, 3253, 1834, 2205, 4107,
+	2319, 929, 1029, 2792, 3464, 1519, 3722, 111, 164, 2365,
+	514, 4291, 1427, 93, 1632, 3623, 2899, 509, 774, 2378,
+	2436, 1058, 220, 1352, 3852, 2765, 2076, 3235, 2920, 3612,
+	787, 634, 1206, 397, 457, 2362, 3746, 3660, 3407, 3280,
+	1073, 958, 979, 4382, 251, 4026, 1510, 121, 4280, 2887,
+	1624, 2468, 340, 1139, 4273, 1235, 3771, 1711, 3838, 1497,
+	647, 1025, 197, 520, 1125, 1018, 2760, 1579, 927, 1616,
+	1376, 755, 4289, 3630, 434, 628, 1444, 287, 3074, 1189,
+	4079, 1460, 672, 1811, 233, 1855, 2851, 3124, 3632, 952,
+	353, 2203, 3066, 1057, 3204, 302, 193, 1545, 114, 1254,
+	1007, 3698, 3035, 3750, 3677, 1357, 2482, 1411, 686, 4298,
+	2042, 2155, 2519, 3041, 4331, 2303, 4025, 4092, 1209, 541,
+	4403, 4236, 917, 4343, 1428, 424, 4363, 2879, 1808, 3195,
+	3616, 1114, 2457, 3422, 1323, 2778, 2222, 3799, 417, 3414,
+	2864, 1219, 1852, 2522, 1928, 578, 53, 1899, 572, 943,
+	3496, 3452, 2058, 3894, 2687, 3587, 230, 3687, 388, 344,
+	947, 3532, 2903, 2815, 1890, 940, 699, 1146, 1682, 266,
+	805, 896, 2742, 3421, 2429, 3397, 3142, 2461, 3830, 888,
+	1785, 1480, 4245, 4183, 1265, 2807, 3539, 1384, 2379, 1322,
+	754, 2938, 3637, 170, 3661, 547, 2883, 3285, 960, 249,
+	936, 2317, 3914, 1196, 3104, 3512, 1069, 3431, 845, 1343,
+	704, 1470, 615, 1635, 942, 313, 2096, 2247, 2270, 3594,
+	1361, 901, 2865, 3992, 2952, 1566, 1264, 3748, 3707, 2269,
+	1122, 4141, 506, 2394, 1188, 4020, 3315, 405, 4166, 319,
+	1865, 2551, 1199, 1679, 3744, 1515, 1049, 2988, 1617, 1340,
+	414, 3152, 1370, 3294, 2195, 4421, 4279, 2323, 2377, 2494,
+	3103, 484, 2810, 1627, 3715, 349, 1358, 2118, 2055, 91,
+	2059, 439, 1734, 3014, 3052, 1964, 2749, 3622, 4359, 3862,
+	2849, 1200, 3982, 3180, 477, 3574, 2221, 162, 546, 3498,
+	3573, 3772, 2829, 9, 4086, 1795, 3236, 2774, 257, 41,
+	574, 866, 363, 2374, 3304, 3523, 2850, 3141, 3418, 2610,
+	3245, 1924, 3719, 2782, 2586, 1889, 1329, 3406, 1807, 1505,
+	3089, 1420, 1644, 2232, 3205, 1873, 3473, 3548, 945, 2669,
+	3808, 2387, 3157, 2322, 2230, 3841, 706, 115, 3794, 930,
+	2368, 1013, 2151, 1803, 1621, 2129, 3776, 2281, 4047, 1469,
+	2514, 2691, 3586, 835, 2086, 2727, 4411, 1347, 2493, 352,
+	3101, 228, 3122, 2527, 2224, 610, 1229, 621, 3654, 1278,
+	4194, 1468, 3593, 3185, 3791, 818, 3915, 3859, 623, 1503,
+	767, 2968, 1192, 594, 3259, 2414, 902, 44, 70, 564,
+	2512, 2936, 1456, 1345, 4150, 2, 1567, 2734, 3753, 3098,
+	676, 1970, 2666, 550, 472, 2856, 316, 3511, 2891, 1307,
+	1587, 2956, 2116, 122, 2604, 4067, 2569, 2298, 1187, 2694,
+	1131, 3790, 2890, 1583, 2259, 105, 3584, 429, 861, 1520,
+	1552, 2383, 1965, 3505, 2639, 1377, 1421, 2398, 4416, 1650,
+	3876, 3220, 2349, 4247, 1433, 1836, 4085, 1926, 4360, 196,
+	2981, 4140, 1892, 1284, 1269, 1523, 1941, 1062, 3551, 3148,
+	491, 3327, 3738, 590, 3969, 2922, 1661, 144, 581, 3168,
+	1175, 4225, 997, 2196, 3187, 2455, 350, 885, 4260, 898,
+	2566, 798, 1256, 919, 2707, 3112, 3047, 45, 1818, 1023,
+	4301, 1983, 165, 953, 1133, 2944, 1369, 1360, 351, 4246,
+	589, 3302, 1502, 4259, 3284, 4399, 2793, 2975, 2423, 2236,
+	171, 3564, 2544, 3062, 4417, 1885, 2993, 1548, 3815, 2064,
+	1105, 3583, 1680, 1670, 2629, 1975, 2632, 4059, 1996, 2128,
+	78, 1086, 2446, 913, 3626, 1004, 2001, 3933, 4190, 1330,
+	137, 3241, 2827, 4162, 4252, 2801, 1315, 3504, 279, 2652,
+	221, 250, 3806, 3725, 4325, 3175, 100, 959, 3106, 3059,
+	2490, 2923, 3927, 3279, 3383, 3549, 858, 4108, 4165, 833,
+	619, 481, 3760, 2574, 654, 2745, 2557, 4018, 4296, 3114,
+	1662, 4071, 1770, 532, 3756, 409, 2723, 4226, 1477, 2659,
+	400, 709, 2285, 1910, 3201, 3751, 3230, 939, 3944, 3765,
+	1516, 771, 4031, 4066, 3411, 588, 2184, 3559, 1513, 1424,
+	2642, 3891, 3787, 2764, 3491, 1396, 1457, 4283, 2507, 2974,
+	3006, 2775, 360, 1244, 2500, 3088, 2702, 2354, 1386, 1379,
+	1119, 2983, 1536, 1156, 2773, 261, 2223, 785, 3240, 3518,
+	4053, 4345, 920, 1451, 2884, 809, 778, 1952, 253, 2104,
+	636, 2805, 863, 2035, 3516, 4068, 1441, 3128, 719, 3493,
+	753, 3393, 259, 4364, 1336, 828, 703, 1731, 1816, 1210,
+	4186, 724, 3217, 734, 3459, 4049, 2014, 1392, 643, 613,
+	1600, 4164, 1387, 627, 3667, 4005, 2265, 2022, 1308, 1826,
+	780, 1884, 2024, 141, 2440, 2382, 2403, 2816, 1496, 1011,
+	3940, 300, 2547, 3870, 2401, 330, 2579, 3287, 2904, 2179,
+	1381, 399, 2097, 3568, 3433, 3962, 1543, 1641, 3256, 2255,
+	1642, 2596, 1074, 2175, 1534, 3963, 2146, 728, 751, 2766,
+	4303, 1066, 4051, 327, 3282, 3335, 15, 1704, 3795, 4019,
+	2907, 2450, 1713, 3664, 381, 4401, 466, 476, 1412, 467,
+	378, 2079, 966, 4241, 3428, 1295, 2646, 1220, 4096, 3980,
+	3545, 119, 2271, 510, 2025, 3065, 660, 396, 2597, 1690,
+	3596, 2714, 202, 4328, 3039, 1422, 1946, 3560, 3055, 66,
+	2848, 599, 2898, 2060, 2503, 635, 693, 1474, 894, 889,
+	3513, 2266, 1667, 368, 1437, 2541, 1236, 4142, 147, 3072,
+	2218, 4, 2334, 2980, 949, 856, 674, 3938, 1955, 3297,
+	3176, 1805, 2425, 817, 4314, 160, 1117, 440, 1130, 2571,
+	998, 2390, 3727, 1037, 3792, 495, 2073, 1181, 768, 4285,
+	2839, 827, 1145, 4234, 4288, 2625, 1226, 19, 1296, 2603,
+	2235, 2049, 3708, 3613, 1292, 3981, 684, 163, 1728, 3749,
+	3191, 3380, 653, 2245, 3467, 2194, 3290, 714, 4192, 4104,
+	3034, 4389, 961, 2640, 1078, 873, 2132, 462, 897, 3973,
+	759, 2126, 536, 4100, 1113, 2249, 665, 1135, 1905, 3620,
+	3342, 1575, 136, 1151, 2836, 2915, 3025, 4384, 1423, 2637,
+	841, 3097, 2305, 3978, 1385, 2894, 602, 529, 2280, 81,
+	2563, 4039, 3353, 494, 2859, 2663, 311, 2881, 3269, 1563,
+	468, 4185, 3890, 3880, 3674, 2731, 4351, 3484, 1640, 640,
+	852, 1879, 4329, 3863, 2892, 701, 3869, 1973, 1937, 382,
+	1862, 3538, 4200, 2286, 1787, 1110, 2009, 2240, 77, 2641,
+	310, 4171, 2580, 3704, 3401, 1394, 3272, 4198, 4012, 3482,
+	638, 493, 1984, 3177, 335, 3094, 3445, 1305, 3646, 4188,
+	3672, 3728, 1733, 3670, 4326, 2540, 2150, 75, 2568, 1581,
+	389, 2258, 3540, 1867, 1043, 224, 1939, 3461, 1914, 1211,
+	3381, 1613, 2007, 3884, 1312, 1033, 2139, 325, 1917, 2690,
+	3437, 2161, 867, 3717, 2638, 2002, 928, 1580, 3567, 2441,
+	508, 2644, 2619, 3275, 2189, 1024, 1677, 2692, 1123, 4290,
+	2660, 74, 4407, 2267, 3178, 2186, 4299, 1375, 744, 1974,
+	2929, 2963, 4311, 4064, 177, 1903, 4017, 4342, 2969, 3675,
+	1853, 1843, 238, 1660, 3742, 604, 3273, 3984, 717, 1173,
+	3049, 1638, 539, 190, 507, 187, 855, 79, 1039, 3391,
+	4306, 3702, 1230, 1102, 419, 1240, 2757, 976, 745, 1912,
+	1063, 219, 1541, 2491, 591, 2000, 218, 2213, 3768, 3453,
+	916, 1389, 1466, 213, 4361, 4008, 2627, 2201, 3221, 3788,
+	4287, 1643, 941, 2585, 2562, 2655, 471, 2486, 790, 3867,
+	1298, 1717, 1558, 1048, 1034, 3641, 3615, 2914, 3442, 3266,
+	246, 2173, 2704, 3430, 2978, 2567, 2469, 191, 3, 2153,
+	2481, 3847, 375, 2570, 1473, 2327, 2634, 3427, 1076, 4151,
+	3766, 3443, 4052, 3520, 869, 2044, 201, 1585, 255, 3026,
+	2600, 1561, 1439, 178, 3320, 2946, 1, 906, 2647, 54,
+	2030, 1342, 4197, 2325, 561, 3652, 2853, 2875, 1736, 3027,
+	994, 3555, 549, 1239, 4048, 625, 3849, 474, 1936, 2324,
+	2751, 1772, 3693, 1840, 548, 2252, 3997, 1183, 1213, 125,
+	1997, 1085, 1334, 2243, 1283, 2924, 2558, 2177, 3814, 3581,
+	3871, 2263, 2115, 2062, 1835, 2124, 3998, 2012, 1539, 2262,
+	565, 957, 2214, 3599, 1802, 2283, 4269, 2735, 2885, 2330,
+	18, 2275, 4400, 1348, 3943, 2054, 2538, 3365, 2925, 1272,
+	3454, 3989, 1651, 4228, 3130, 4208, 1584, 3395, 3420, 2227,
+	711, 1920, 4336, 842, 4113, 1243, 1767, 1957, 3069, 1225,
+	2296, 746, 2501, 60, 732, 465, 3257, 2510, 1719, 4111,
+	2741, 1144, 831, 522, 2210, 3939, 658, 3603, 4398, 4394,
+	2739, 1500, 2916, 1876, 1302, 2008, 1274, 1796, 2358, 2152,
+	1858, 3542, 456, 1324, 1191, 1765, 2492, 3720, 3970, 2122,
+	1443, 2520, 914, 4099, 677, 1525, 1010, 1586, 3456, 1258,
+	2824, 42, 212, 276, 275, 2318, 1445, 4030, 969, 1402,
+	2873, 3228, 1611, 1629, 3885, 4393, 3238, 108, 2090, 4372,
+	488, 3277, 3260, 2948, 3048, 1003, 176, 736, 3971, 3634,
+	1005, 4044, 2577, 1987, 3985, 87, 2737, 1753, 772, 102,
+	1693, 4295, 3332, 3458, 3143, 3292, 946, 1207, 1290, 3629,
+	1708, 3004, 3565, 2217, 3338, 3483, 1790, 295, 3968, 4131,
+	4075, 1607, 1710, 2338, 2598, 1591, 3499, 523, 740, 4146,
+	836, 756, 3468, 383, 1132, 2831, 4239, 3200, 1155, 2343,
+	2783, 2162, 2960, 2371, 4415, 2705, 3692, 2777, 52, 3813,
+	1701, 1092, 3165, 1056, 1877, 157, 1401, 722, 4135, 408,
+	2799, 1019, 3566, 1425, 3056, 3953, 530, 600, 707, 2706,
+	1149, 4414, 3734, 3254, 680, 3731, 1998, 2393, 1551, 811,
+	1014, 2456, 1304, 2909, 3374, 4332, 1933, 2953, 4015, 3371,
+	559, 3107, 3755, 1861, 3214, 1698, 1923, 1032, 2733, 3044,
+	1532, 357, 3784, 796, 3848, 1490, 4323, 4374, 4233, 4083,
+	2200, 3950, 834, 1832, 1888, 1918, 4281, 28, 3085, 750,
+	1675, 1022, 3369, 3001, 850, 3405, 825, 4222, 1020, 2708,
+	413, 1124, 631, 4294, 4272, 2399, 1353, 3832, 4073, 3964,
+	1488, 2780, 3699, 2409, 4240, 586, 749, 1837, 4060, 3346,
+	328, 64, 3440, 526, 2411, 1860, 624, 3479, 4369, 2834,
+	4160, 1435, 2947, 3590, 273, 2615, 1930, 4362, 2452, 500,
+	918, 1968, 2656, 2680, 3562, 2140, 3050, 3046, 2069, 1824,
+	1017, 1099, 1408, 2246, 4333, 3487, 3747, 2506, 3161, 2919,
+	2973, 395, 1404, 4339, 4365, 2100, 3012, 2763, 2911, 3216,
+	4093, 3900, 3096, 3169, 2183, 3435, 3139, 2306, 3385, 347,
+	4184, 2346, 1221, 938, 931, 3801, 1953, 3600, 3036, 3146,
+	4129, 2959, 2444, 899, 2940, 1127, 725, 1158, 576, 1812,
+	3930, 1116, 179, 348, 4189, 65, 50, 3462, 2185, 131,
+	1051, 336, 242, 40, 2337, 2310, 324, 4320, 304, 3681,
+	1147, 1994, 3580, 4155, 3444, 4161, 670, 4319, 864, 671,
+	1249, 1042, 984, 2277, 3474, 3501, 11, 3598, 3247, 2057,
+	1276, 1542, 27, 2415, 2718, 85, 205, 2769, 2818, 303,
+	3409, 1630, 3347, 215, 1318, 309, 1688, 2068, 4077, 1778,
+	3434, 1554, 4223, 1868, 3550, 385, 4055, 3896, 4087, 1397,
+	819, 3924, 3439, 3268, 808, 370, 2113, 3987, 3902, 3554,
+	1810, 2549, 1517, 23, 4317, 4316, 1849, 318, 4074, 308,
+	747, 4177, 3301, 1820, 1848, 2352, 884, 3745, 120, 2720,
+	1180, 2779, 651, 2686, 4250, 48, 448, 1028, 263, 3684,
+	2329, 1521, 2170, 3732, 3081, 4388, 3818, 2432, 345, 490,
+	2958, 1016, 1279, 2931, 4124, 538, 2087, 3812, 2717, 1224,
+	1597, 1478, 3154, 3079, 2314, 2602, 1740, 1827, 1346, 2917,
+	3283, 3111, 3779, 3321, 247, 3451, 2658, 206, 1364, 4422,
+	3199, 1593, 1666, 1664, 1732, 4063, 3472, 3063, 3506, 4282,
+	2207, 3002, 3394, 377, 3951, 2422, 3243, 1980, 1071, 597,
+	86, 1557, 3546, 4397, 71, 1592, 43, 1501, 367, 698,
+	2790, 4276, 402, 1288, 2592, 3525, 3438, 2880, 1908, 2901,
+	1549, 3173, 1636, 1263, 1338, 1764, 996, 3762, 1090, 1393,
+	2376, 3270, 4348, 68, 3223, 3197, 4213, 1619, 1494, 2419,
+	159, 669, 1612, 3174, 3789, 2800, 2573, 3016, 31, 4149,
+	975, 3575, 3480, 185, 436, 269, 1745, 1162, 1111, 2288,
+	3471, 2787, 1351, 2536, 3710, 109, 4081, 3653, 398, 2523,
+	116, 3828, 4101, 1801, 1120, 3307, 2018, 2416, 90, 784,
+	3543, 4120, 2635, 2164, 4211, 3061, 1522, 3875, 3864, 1537,
+	2167, 2335, 1633, 2348, 3589, 1491, 1594, 3619, 2473, 3115,
+	3842, 2791, 372, 1747, 3579, 646, 2313, 428, 3436, 4143,
+	4344, 3017, 256, 1337, 117, 525, 2148, 2608, 274, 4178,
+	907, 2556, 2624, 4349, 2220, 3911, 515, 2833, 903, 921,
+	3729, 2560, 4028, 3029, 1030, 2910, 881, 3642, 4095, 3263,
+	113, 1174, 2215, 245, 2684, 3476, 3807, 2006, 2316, 1035,
+	1137, 2837, 3552, 1426, 1075, 3345, 3348, 2878, 2191, 1798,
+	849, 543, 4322, 2487, 2832, 355, 802, 1136, 2111, 2516,
+	967, 2900, 991, 2847, 3733, 2460, 1830, 84, 1472, 57,
+	1783, 2287, 4204, 3379, 720, 1475, 4043, 1407, 3457, 1053,
+	189, 2743, 2145, 4412, 3597, 2508, 3357, 545, 1261, 379,
+	2584, 3908, 3576, 1282, 4125, 3399, 2715, 700, 558, 2928,
+	4270, 2994, 3043, 1743, 2533, 2813, 1442, 1371, 2770, 2385,
+	2874, 4024, 2293, 2564, 3609, 334, 1064, 4300, 1823, 3417,
+	3183, 1327, 1797, 1555, 1720, 3475, 3825, 1806, 3248, 758,
+	376, 3120, 3805, 199, 820, 4167, 2408, 390, 618, 3916,
+	2418, 427, 1560, 1656, 2513, 437, 504, 2375, 3093, 2650,
+	2616, 294, 2955, 2038, 3167, 1606, 2350, 644, 1976, 826,
+	343, 3011, 1252, 3330, 1273, 33, 1409, 1514, 1763, 743,
+	963, 2588, 2485, 1739, 2750, 110, 3207, 3515, 2361, 234,
+	2158, 158, 1528, 2554, 4267, 2937, 3912, 1934, 1143, 3361,
+	1216, 3123, 3045, 1942, 1512, 3920, 1574, 236, 832, 696,
+	1301, 1467, 2238, 2761, 3010, 3441, 2838, 876, 1152, 403,
+	1947, 4257, 2103, 3368, 3015, 469, 2187, 3821, 517, 3300,
+	280, 1434, 252, 1177, 1672, 1791, 2017, 542, 1866, 214,
+	900, 2291, 821, 1280, 3264, 3150, 3242, 1544, 4137, 956,
+	4182, 3592, 2918, 4022, 3931, 3237, 2681, 1663, 2326, 2347,
+	982, 432, 2451, 1012, 3679, 72, 3156, 944, 1197, 2241,
+	816, 1718, 3021, 264, 3866, 844, 2307, 443, 2274, 204,
+	2736, 3358, 579, 1726, 3449, 730, 4078, 181, 4058, 3521,
+	3991, 1850, 4040, 2710, 3140, 4266, 4413, 2740, 985, 2447,
+	3429, 2475, 1730, 1203, 650, 1623, 990, 2591, 3865, 3402,
+	3252, 1913, 296, 1956, 7, 4353, 285, 3229, 2278, 4072,
+	1779, 752, 3382, 1761, 3837, 1804, 2372, 2843, 595, 2575,
+	1171, 2614, 2572, 1331, 3976, 4366, 416, 3966, 1966, 154,
+	3466, 3013, 1498, 3261, 3843, 1208, 2345, 792, 1991, 2370,
+	4418, 1484, 2719, 2273, 662, 2701, 1659, 4230, 2913, 3188,
+	1573, 1707, 1774, 1291, 1750, 3965, 973, 1777, 3134, 460,
+	1129, 3651, 846, 596, 570, 4392, 1550, 1459, 1817, 857,
+	438, 2010, 94, 2309, 2328, 2234, 1759, 1943, 2043, 3215,
+	980, 3778, 1045, 2966, 3648, 2962, 3398, 2526, 1986, 3925,
+	3019, 1900, 4090, 2700, 1839, 260, 3288, 1628, 1233, 1684,
+	3448, 1390, 1859, 1883, 553, 2565, 2495, 4217, 3662, 1464,
+	4337, 777, 3206, 3701, 986, 4001, 2543, 2546, 3804, 329,
+	3042, 2582, 192, 3076, 3913, 4391, 737, 2225, 641, 1222,
+	2825, 4308, 4265, 1712, 2197, 1610, 3274, 713, 14, 3388,
+	815, 139, 1170, 3364, 1725, 2147, 950, 2617, 150, 1294,
+	1255, 4084, 649, 661, 1036, 1676, 2517, 786, 639, 4176,
+	2934, 459, 4216, 1321, 4383, 2552, 557, 1596, 3624, 2004,
+	485, 1737, 1471, 2445, 2728, 4097, 4110, 4243, 3067, 182,
+	2819, 3309, 1100, 1887, 2433, 95, 666, 3898, 3961, 1568,
+	4002, 3163, 209, 629, 1373, 3356, 3410, 695, 3618, 3387,
+	605, 4133, 1589, 1430, 337, 366, 2786, 2868, 1287, 1637,
+	3489, 4312, 1121, 1228, 2092, 3372, 1094, 4340, 4158, 2098,
+	2290, 2107, 1140, 1354, 2359, 1894, 1344, 566, 2237, 3276,
+	307, 2253, 2927, 4315, 3510, 3003, 2623, 987, 3343, 1454,
+	1270, 1410, 1863, 761, 2515, 1919, 4305, 766, 1399, 4405,
+	4042, 1673, 1829, 794, 3758, 4193, 1259, 126, 3952, 1286,
+	912, 1089, 3796, 2074, 1483, 225, 3743, 4293, 1455, 2178,
+	3602, 4209, 3133, 3486, 1864, 1060, 2264, 2472, 475, 2045,
+	2756, 271, 73, 4098, 3400, 521, 2788, 2905, 2084, 770,
+	3958, 3314, 1854, 3337, 575, 3328, 3892, 872, 2135, 3231,
+	3194, 1780, 775, 2154, 1251, 3367, 3569, 1153, 3877, 2453,
+	442, 4278, 2063, 1509, 3856, 3095, 3037, 4122, 1142, 4054,
+	1237, 806, 2804, 3212, 3582, 4153, 4215, 3682, 1614, 407,
+	2066, 933, 2835, 1687, 692, 3334, 3350, 2438, 2771, 4105,
+	2996, 4139, 3528, 3881, 2168, 3858, 241, 2657, 3706, 937,
+	358, 2738, 2539, 3038, 2776, 3563, 2144, 3469, 1314, 4258,
+	2261, 1395, 3854, 1754, 3636, 4232, 3209, 1103, 2071, 2463,
+	4220, 2028, 616, 1328, 3023, 2300, 3446, 198, 4088, 726,
+	3040, 3352, 1186, 2467, 2869, 2754, 1266, 2367, 2430, 2653,
+	172, 823, 3131, 103, 461, 537, 2480, 1253, 1564, 1898,
+	2957, 1626, 1645, 788, 4256, 983, 1232, 1916, 4173, 4248,
+	2308, 1059, 1878, 2497, 2860, 2050, 555, 4168, 2094, 675,
+	1529, 2199, 762, 20, 1438, 3311, 63, 3083, 4082, 2366,
+	1815, 904, 3502, 1799, 607, 142, 2628, 281, 1972, 1572,
+	3655, 369, 1744, 800, 4116, 2521, 694, 1368, 58, 2340,
+	3362, 4011, 1217, 879, 1631, 1227, 2033, 3179, 1178, 584,
+	2504, 1932, 1547, 2386, 4174, 3155, 3306, 2228, 232, 3703,
+	1072, 655, 1602, 502, 4163, 2163, 1309, 2531, 1218, 207,
+	3585, 1789, 1601, 3137, 3588, 573, 705, 3509, 3316, 1949,
+	735, 769, 2509, 789, 3305, 3202, 2882, 3416, 667, 425,
+	267, 2172, 910, 239, 24, 244, 3803, 2272, 3797, 3147,
+	2654, 106, 598, 1524, 3529, 3077, 3317, 4201, 3977, 3234,
+	3993, 2034, 860, 2037, 3360, 3009, 4271, 1465, 3786, 1052,
+	2581, 1961, 323, 4000, 2233, 2302, 702, 1164, 1945, 3218,
+	1756, 2561, 1193, 3149, 1828, 932, 3604, 593, 364, 1006,
+	2893, 143, 2276, 3956, 210, 3836, 3121, 2166, 892, 3774,
+	687, 3850, 2404, 130, 3135, 2479, 2985, 2072, 2499, 3827,
+	3323, 1440, 2174, 3020, 3686, 3488, 3904, 3591, 32, 1400,
+	4354, 2279, 4346, 2729, 4381, 601, 354, 2250, 1622, 3627,
+	2866, 1546, 974, 813, 2099, 971, 4021, 2297, 149, 513,
+	1775, 270, 412, 797, 3208, 993, 1118, 3033, 392, 2995,
+	981, 1002, 935, 315, 3578, 3691, 4127, 22, 877, 3492,
+	89, 2464, 3005, 1556, 2484, 773, 2607, 964, 2626, 3918,
+	3611, 1091, 883, 4373, 3373, 2951, 1971, 1257, 3883, 1757,
+	2295, 3541, 1929, 3250, 4126, 1154, 4147, 1962, 1771, 1906,
+	51, 3519, 1694, 4313, 1070, 2292, 603, 2417, 3882, 1665,
+	2336, 2149, 2102, 3278, 3265, 2535, 3577, 1990, 4408, 2611,
+	3477, 200, 1901, 3928, 2906, 2193, 1847, 237, 3267, 3752,
+	1461, 216, 853, 3718, 2935, 3022, 886, 2888, 708, 3313,
+	3571, 3312, 3763, 4255, 2537, 1242, 49, 923, 4341, 4023,
+	999, 1649, 3425, 690, 445, 2732, 2594, 4237, 534, 4274,
+	1482, 2248, 4355, 2505, 21, 2939, 289, 2679, 3793, 4268,
+	118, 2902, 2477, 682, 2384, 1870, 1349, 1055, 449, 1096,
+	3028, 1950, 1267, 4187, 3824, 1940, 1356, 4159, 3872, 718,
+	955, 3159, 1087, 2984, 1215, 1179, 4261, 83, 3769, 3905,
+	29, 3910, 3087, 2424, 4144, 2744, 3945,
+};
+static const int journals_byname_disp[1470] = {
+	6, 46, -28, -42, 10, 2, 4, 62, 7, 8,
+	8, -120, 17, -131, 5, -145, 17, 8, -167, 6,
+	0, 0, 0, 12, 4, -216, -223, 2, 6, -235,
+	26, 2, 8, 1, -282, 1, -300, 3, 9, 18,
+	3, 30, 4, 6, 2, 1, 28, 2, 3, -304,
+	3, 7, 13, 9, 14, 2, 0, 3, 2, 11,
+	52, 10, 3, 1, 1, -306, 0, 2, 0, -347,
+	4, 8, 13, 0, 13, 25, 1, 1, -348, 26,
+	1, -366, 15, 1, 10, 103, 4, 14, -397, 52,
+	1, 7, 63, 1, 23, 5, 99, 1, 1, -413,
+	9, -436, -455, -461, 5, 34, 1, 4, 7, -479,
+	16, 3, 4, 1, 38, -482, 168, -558, 8, 14,
+	-578, 2, 46, 2, 3, 7, 2, 2, -586, 6,
+	1, 2, 5, -590, 3, -609, 2, 0, -612, 1,
+	1, 0, 13, 9, 1, 26, 92, 4, 1, 3,
+	46, 4, 3, 15, 11, 3, 11, 24, 0, 7,
+	1, 1, 1, 1, 14, 7, 22, 14, 29, 1,
+	-649, -650, 1, 27, 8, -723, 5, 0, 17, 0,
+	26, 141, 0, 11, 3, 8, 3, 1, 1, 4,
+	1, 26, 138, 7, 21, -755, 22, 0, 22, 50,
+	8, -756, 8, 40, 11, 12, -833, 25, 1, 3,
+	-845, 16, 10, 2, 1, 37, 25, 7, 13, 16,
+	46, 7, 1, 1, 2, 28, 9, 3, 13, 3,
+	1, 1, 19, 12, 5, 2, 29, 8, 21, -867,
+	44, 1, 8, 12, 4, 1, 0, 40, 150, 52,
+	3, 1, 0, 49, -885, -888, 5, 1, 3, 29,
+	-898, 8, 0, 67, 13, 3, 20, 9, 3, -913,
+	5, 2, 19, 11, 2, 1, 1, 1, 5, 1,
+	-922, 7, 9, 5, 13, 2, 9, 13, 7, 1,
+	1, -962, -982, -1014, 3, 23, 34, 113, 91, 32,
+	2, 10, 1, 25, -1057, 1, 59, 3, 2, -1094,
+	1, 2, 8, -1099, 21, 19, 5, 2, 0, 10,
+	-1175, -1193, 40, 2, -1229, 1, 1, 2, 1, 7,
+	3, 59, 3, 4, 13, 2, 4, 11, 20, -1236,
+	19, 2, 2, 7, 76, 2, 1, 22, 9, 2,
+	35, 15, 1, 6, -1296, 1, 39, 3, 0, 34,
+	-1310, 2, 5, 27, 15, 5, 3, 88, 3, -1314,
+	-1327, -1328, 17, 11, 16, 37, -1340, 8, 37, 2,
+	5, 6, 27, 10, -1369, 12, 37, 85, -1373, 25,
+	62, 29, 3, 52, -1387, 5, 16, 7, 196, 1,
+	0, -1396, 9, 2, 6, 5, 8, 17, -1398, 17,
+	3, 1, -1406, -1482, 19, 97, -1489, 40, 7, 2,
+	83, 11, -1490, 61, 64, 1, 15, 30, 15, -1546,
+	79, -1575, 11, 0, 1, 0, 25, 35, 42, 5,
+	71, 1, 29, 94, 2, 36, -1594, 5, 29, 20,
+	59, 1, 19, 15, 6, 2, 72, 0, 5, 44,
+	8, 26, 0, 37, 88, 37, 1, 3, 1, 0,
+	12, 7, 3, -1619, 34, 6, 0, 24, 21, 12,
+	35, 127, 0, 17, -1621, 10, 1, 32, 29, 32,
+	9, 1, 24, 5, 9, 1, 4, 5, 40, 35,
+	3, 5, 1, 93, 21, 2, 7, 6, -1640, -1707,
+	40, 15, 43, 0, 77, 7, 4, 43, 96, 1,
+	38, 2, 12, -1762, 1, 23, -1793, 4, 18, 28,
+	2, 6, 13, 16, 1, 44, 6, 0, 20, 9,
+	15, 18, 24, -1862, 4, 8, 0, 9, 1, 0,
+	23, 1, 4, 1, -1885, -1904, 20, 28, 0, 1,
+	89, 5, 10, 2, 2, -1930, 4, 3, 20, 16,
+	26, -1961, -2011, 41, 3, 1, 8, 72, 3, 6,
+	0, 20, 27, 11, 7, 34, -2030, 11, 23, 6,
+	4, 0, -2115, 29, 2, 1, 5, 5, 15, 3,
+	-2123, 23, 52, 21, 2, 12, 1, 211, 11, 145,
+	50, 9, 6, 1, 48, 31, 11, 3, 3, 6,
+	-2126, 0, 0, 27, 6, 9, 1, 1, 0, 6,
+	-2155, 12, 1, 10, 0, 20, 2, 8, 2, -2185,
+	0, 1, -2217, 8, 80, 17, 68, 5, 14, 9,
+	0, 1, 3, 1, 2, 4, 138, 0, 52, 7,
+	14, 3, 15, 3, -2225, 4, 1, -2231, 23, 10,
+	-2238, 5, 1, -2257, 7, 59, 1, 5, 38, 5,
+	11, 1, 0, 1, 9, 2, 8, 12, -2288, 12,
+	100, 41, 2, 6, 1, 3, 4, -2299, 4, 32,
+	127, 9, 98, 7, 4, 1, -2315, 1, -2319, 53,
+	-2358, -2390, 5, 5, 0, 2, 43, 7, 6, 6,
+	26, 1, 5, 12, -2420, 7, 20, -2431, 34, 1,
+	2, -2437, 5, 58, -2448, -2456, -2461, 3, 26, 124,
+	157, 5, 59, 4, -2463, 7, 138, 15, 8, 78,
+	2, 201, 19, 137, -2466, 23, 0, 6, 181, 7,
+	35, 3, 1, 8, 54, 4, 1, 56, 7, 36,
+	36, 32, 25, -2470, 44, 11, 6, 6, 1, 1,
+	13, 16, -2475, 3, 13, 14, 2, -2485, -2520, 15,
+	-2527, 80, 3, 196, 89, 1, 40, 13, -2549, 14,
+	11, 5, 3, 60, 6, 17, 21, 0, 4, 47,
+	12, 5, -2566, 5, -2576, 1, 1, 29, 56, 3,
+	190, 2, 5, 37, -2591, 10, 36, 4, 120, 7,
+	93, 96, 7, 1, 1, -2624, 54, 0, 1, 73,
+	19, 1, -2635, 1, 25, 15, 4, 78, 12, -2671,
+	16, 1, 69, 4, 8, -2681, 3, 72, 0, 1,
+	49, 24, -2682, 16, 0, 20, 36, -2692, 11, 81,
+	47, -2739, 9, 61, 1, -2781, 5, 6, 1, -2782,
+	68, 48, 12, 17, 7, 31, 149, 30, 6, 38,
+	16, -2816, 40, 4, 3, 7, 0, 1, 558, 10,
+	2, 0, -2842, 15, 7, 71, 56, 10, 12, 1,
+	48, 1, 155, 21, 0, 6, 1, 0, 8, 10,
+	21, 8, 30, 2, 107, -2875, 1, 5, 132, 17,
+	63, 6, 77, 34, 287, -2876, 51, 15, 30, 4,
+	7, 60, 33, 2, 17, 5, 1, 27, 41, 3,
+	-2898, 127, 5, -2923, 72, 19, 22, 25, 62, 5,
+	22, 34, 9, 1, 53, -2995, 5, -3030, 36, 142,
+	52, 2, 5, 27, 99, 41, 7, 1, 1, 22,
+	22, 84, 377, 130, 1, -3033, 0, 177, 36, 3,
+	1, 5, 1, 22, 207, 7, 2, 489, 26, 34,
+	8, -3039, 36, 146, 24, 29, 1, 63, 23, 22,
+	0, 39, 86, 23, 137, 9, 131, 1, 1, 3,
+	35, 2, 19, -3041, -3078, 0, 1, 2, 1, 0,
+	-3091, 11, 0, -3094, 111, 50, 28, -3112, 4, -3114,
+	32, 5, 17, 1, 135, 79, 6, 50, 23, 13,
+	3, 121, 360, -3163, 107, 0, 0, 19, 62, 17,
+	62, 18, 13, -3238, 48, 2, 49, -3255, -3271, -3286,
+	18, -3304, 1, 154, -3308, 1, 14, 3, 18, 109,
+	1, 10, 95, 1, 19, -3327, 0, 7, 136, 121,
+	31, 5, 80, 439, 45, 196, 91, 28, -3358, 218,
+	1, 160, -3392, -3398, 82, 29, 24, 2, 36, -3431,
+	429, 365, 0, -3461, 0, 1, 130, 1, 4, 1,
+	95, 12, 7, 8, -3486, 36, 1, 18, 35, 29,
+	139, 12, 7, 5, 25, 8, 150, 207, 0, 407,
+	47, 4, 65, 125, 82, 20, 20, 155, 51, -3523,
+	133, -3534, 1, 1, 21, 87, 52, 181, 5, 8,
+	37, 97, 30, 5, 274, 244, 6, 6, 70, 225,
+	5, 10, 10, -3556, 415, 21, 8, 2, 19, 6,
+	77, 74, 1, 90, 1, 89, 23, 90, -3559, 10,
+	-3569, 10, 4, 1, 1, 22, 5, 79, 12, 17,
+	-3585, 1, 141, 25, -3594, 127, 8, 204, 618, 326,
+	1, 5, 30, 1, 212, 45, 7, 628, 4, 181,
+	23, -3640, 2, 13, 1, -3646, 39, 53, 251, 16,
+	183, 128, 1, 10, 41, -3650, 25, 42, 18, 1,
+	0, 3, 5, 13, 114, 1, 8, 119, 76, 19,
+	434, 230, 80, 2, 98, 9, -3652, 18, -3660, -3661,
+	2, 22, 27, -3730, 132, 215, 16, -3731, 117, 66,
+	13, 0, 86, 634, 302, 71, 11, 20, 122, 5,
+	659, 30, 2, 329, 19, 44, -3740, 1, 152, -3764,
+	7, -3789, 87, -3848, 16, 7, 79, 65, 8, -3862,
+	150, 75, 185, -3885, 8, 191, 484, 4, 0, 48,
+	96, 34, 0, 1072, 8, 60, 7, 121, -3886, 1,
+	7, 3, 6, 98, 60, 1, 35, 4, 199, 139,
+	123, 40, -3917, -3918, -3924, 6, 274, 1, 54, 143,
+	68, 153, 16, 429, 196, 277, 91, 60, 0, 25,
+	-3927, 63, 712, 19, 79, 5, 9, 10, -3973, 377,
+	88, -3995, 6, 404, 157, 213, 33, 68, -4017, 0,
+	0, 142, 0, 0, 97, 0, 11, 102, 17, 139,
+	373, 11, 11, 3, 159, -4036, 100, -4085, 7, 13,
+	-4111, 14, 0, 1, 4, 3, 114, 155, 2, 725,
+	54, 5, 312, -4124, -4178, -4209, 96, 5, 0, 1,
+	120, 2, 315, 0, 570, 286, 9, 105, 1, 698,
+	-4210, 0, 140, 155, 229, 54, 1514, 50, 219, 0,
+	1, 106, 191, -4272, 70, -4296, 710, 38, 351, 27,
+	197, 153, -4307, 2, 25, 61, 166, 1, 264, 3,
+	1, 960, 528, 133, 2, 34, 134, 0, 448, 16,
+	321, 1, 178, -4343, -4375, -4385, 12, 275, -4397, 2,
+};
+static const mph journals_byname_hash = { 4407, 1470, journals_byname_disp, MPH_NOCASE };
+
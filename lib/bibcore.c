@@ -8,13 +8,25 @@
  */
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <dirent.h>
+#ifndef BIBL_NO_THREADS
+#include <pthread.h>
+#endif
 #include "bibutils.h"
 
 /* internal includes */
 #include "reftypes.h"
+#include "name.h"
+#include "macros.h"
 #include "charsets.h"
 #include "str_conv.h"
 #include "is_ws.h"
+#include "intlist.h"
+#include "hash.h"
 
 /* illegal modes to pass in, but use internally for consistency */
 #define BIBL_INTERNALIN   (BIBL_LASTIN+1)
@@ -91,21 +103,18 @@ report_params( FILE *fp, const char *f, param *p )
 }
 
 /* bibl_duplicateparams()
+ *
+ * The working params borrow the asis and corps lists of op, which
+ * are only looked up during a read or write, rather than copying them
+ * for every call; free them with bibl_freeworkparams().
  *
  * Returns status of BIBL_OK or BIBL_ERR_MEMERR
  */
 static int
 bibl_duplicateparams( param *np, param *op )
 {
-	int status;
-
-	slist_init( &(np->asis) );
-	status = slist_copy( &(np->asis), &(op->asis ) );
-	if ( status!=SLIST_OK ) return BIBL_ERR_MEMERR;
-
-	slist_init( &(np->corps) );
-	status = slist_copy( &(np->corps), &(op->corps ) );
-	if ( status!=SLIST_OK ) return BIBL_ERR_MEMERR;
+	np->asis  = op->asis;
+	np->corps = op->corps;
 
 	if ( !op->progname ) np->progname = NULL;
 	else {
@@ -134,6 +143,7 @@ bibl_duplicateparams( param *np, param *op )
 	np->addcount         = op->addcount;
 	np->output_raw       = op->output_raw;
 	np->singlerefperfile = op->singlerefperfile;
+	np->nthreads         = op->nthreads;
 
 	np->readf     = op->readf;
 	np->processf  = op->processf;
@@ -148,6 +158,9 @@ bibl_duplicateparams( param *np, param *op )
 	np->all       = op->all;
 	np->nall      = op->nall;
 
+	np->names     = NULL;
+	np->strings   = op->strings;
+
 	return BIBL_OK;
 }
 
@@ -161,6 +174,8 @@ bibl_setreadparams( param *np, param *op )
 	int status;
 	status = bibl_duplicateparams( np, op );
 	if ( status == BIBL_OK ) {
+		/* the read's own cache; no cache if it can't be made */
+		np->names          = name_cache_new();
 		np->utf8out        = 1;
 		np->charsetout     = BIBL_CHARSET_UNICODE;
 		np->charsetout_src = BIBL_SRC_DEFAULT;
@@ -191,12 +206,30 @@ bibl_setwriteparams( param *np, param *op )
 	return status;
 }
 
+/* bibl_freeworkparams()
+ *
+ * Free params made by bibl_setreadparams() or bibl_setwriteparams(),
+ * leaving the borrowed asis and corps lists and strings table to their
+ * owner.
+ */
+static void
+bibl_freeworkparams( param *p )
+{
+	name_cache_delete( p->names );
+	p->names = NULL;
+	if ( p->progname ) free( p->progname );
+}
+
 void
 bibl_freeparams( param *p )
 {
 	if ( p ) {
-		slist_free( &(p->asis) );
-		slist_free( &(p->corps) );
+		namelist_free( &(p->asis) );
+		namelist_free( &(p->corps) );
+		name_cache_delete( p->names );
+		p->names = NULL;
+		macros_delete( p->strings );
+		p->strings = NULL;
 		if ( p->progname ) free( p->progname );
 	}
 }
@@ -209,10 +242,10 @@ bibl_readasis( param *p, char *f )
 	if ( !p ) return BIBL_ERR_BADINPUT;
 	if ( !f ) return BIBL_ERR_BADINPUT;
 
-	status = slist_fill( &(p->asis), f, 1 );
+	status = namelist_fill( &(p->asis), f );
 
-	if ( status == SLIST_ERR_CANTOPEN ) return BIBL_ERR_CANTOPEN;
-	else if ( status == SLIST_ERR_MEMERR ) return BIBL_ERR_MEMERR;
+	if ( status == NAMELIST_CANTOPEN ) return BIBL_ERR_CANTOPEN;
+	else if ( status == NAMELIST_MEMERR ) return BIBL_ERR_MEMERR;
 	return BIBL_OK;
 }
 
@@ -224,10 +257,10 @@ bibl_readcorps( param *p, char *f )
 	if ( !p ) return BIBL_ERR_BADINPUT;
 	if ( !f ) return BIBL_ERR_BADINPUT;
 
-	status = slist_fill( &(p->corps), f, 1 );
+	status = namelist_fill( &(p->corps), f );
 
-	if ( status == SLIST_ERR_CANTOPEN ) return BIBL_ERR_CANTOPEN;
-	else if ( status == 0 ) return BIBL_ERR_MEMERR;
+	if ( status == NAMELIST_CANTOPEN ) return BIBL_ERR_CANTOPEN;
+	else if ( status == NAMELIST_MEMERR ) return BIBL_ERR_MEMERR;
 	return BIBL_OK;
 }
 
@@ -243,9 +276,9 @@ bibl_addtoasis( param *p, char *d )
 	if ( !p ) return BIBL_ERR_BADINPUT;
 	if ( !d ) return BIBL_ERR_BADINPUT;
 
-	status = slist_addc( &(p->asis), d );
+	status = namelist_add( &(p->asis), d );
 
-	return ( status==SLIST_OK )? BIBL_OK : BIBL_ERR_MEMERR;
+	return ( status==NAMELIST_OK )? BIBL_OK : BIBL_ERR_MEMERR;
 }
 
 /* bibl_addtocorps()
@@ -260,9 +293,23 @@ bibl_addtocorps( param *p, char *d )
 	if ( !p ) return BIBL_ERR_BADINPUT;
 	if ( !d ) return BIBL_ERR_BADINPUT;
 
-	status = slist_addc( &(p->corps), d );
+	status = namelist_add( &(p->corps), d );
+
+	return ( status==NAMELIST_OK )? BIBL_OK : BIBL_ERR_MEMERR;
+}
 
-	return ( status==SLIST_OK )? BIBL_OK : BIBL_ERR_MEMERR;
+/* bibl_sinkstatus()
+ *
+ * Fold the status of an output sink into status, keeping the first
+ * error; a failed write (full disk, closed pipe) is BIBL_ERR_CANTOPEN.
+ */
+static int
+bibl_sinkstatus( int status, int sinkstatus )
+{
+	if ( status!=BIBL_OK ) return status;
+	if ( sinkstatus==SINK_ERR_MEMERR ) return BIBL_ERR_MEMERR;
+	if ( sinkstatus==SINK_ERR_WRITE ) return BIBL_ERR_CANTOPEN;
+	return BIBL_OK;
 }
 
 void
@@ -277,7 +324,7 @@ bibl_reporterr( int err )
 		case BIBL_ERR_MEMERR:
 			fprintf( stderr, "Memory error." ); break;
 		case BIBL_ERR_CANTOPEN:
-			fprintf( stderr, "Can't open." ); break;
+			fprintf( stderr, "Can't open or write." ); break;
 		default:
 			fprintf( stderr, "Cannot identify error code %d.", err ); break;
 	}
@@ -337,114 +384,176 @@ bibl_verbose( bibl *bin, const char *msg1, const char *msg2 )
 static int
 extract_tag_value( str *tag, str *value, char *p )
 {
+	char *q;
+
 	str_empty( tag );
-	while ( p && *p && *p!='|' ) {
-		str_addchar( tag, *p );
-		p++;
+	str_empty( value );
+
+	if ( !p ) return BIBL_OK;
+
+	q = strchr( p, '|' );
+	if ( !q ) {
+		str_strcpyc( tag, p );
+	} else {
+		str_segcpy( tag, p, q );
+		str_strcpyc( value, q+1 );
 	}
-	if ( str_memerr( tag ) ) return BIBL_ERR_MEMERR;
 
-	if ( p && *p=='|' ) p++;
+	if ( str_memerr( tag ) || str_memerr( value ) ) return BIBL_ERR_MEMERR;
 
-	str_empty( value );
-	while ( p && *p ) {
-		str_addchar( value, *p );
-		p++;
+	return BIBL_OK;
+}
+
+/* reftype_adds
+ *
+ * The ALWAYS and DEFAULT entries of one reference type, split out
+ * of their "TAG|value" strings once per bibl_read() instead of once
+ * for every reference converted.
+ */
+typedef struct {
+	slist   always_tags, always_values;
+	intlist always_levels;
+	slist   default_tags, default_values;
+	intlist default_levels;
+} reftype_adds;
+
+static void
+reftype_adds_free( reftype_adds *adds, int nall )
+{
+	int i;
+
+	if ( !adds ) return;
+
+	for ( i=0; i<nall; ++i ) {
+		slists_free( &(adds[i].always_tags), &(adds[i].always_values), &(adds[i].default_tags), &(adds[i].default_values), NULL );
+		intlist_free( &(adds[i].always_levels) );
+		intlist_free( &(adds[i].default_levels) );
 	}
-	if ( str_memerr( tag ) ) return BIBL_ERR_MEMERR;
 
+	free( adds );
+}
+
+static int
+reftype_adds_add( slist *tags, slist *values, intlist *levels, str *tag, str *value, int level )
+{
+	if ( slist_add( tags, tag )!=SLIST_OK ) return BIBL_ERR_MEMERR;
+	if ( slist_add( values, value )!=SLIST_OK ) return BIBL_ERR_MEMERR;
+	if ( intlist_add( levels, level )!=INTLIST_OK ) return BIBL_ERR_MEMERR;
 	return BIBL_OK;
 }
 
-/* process_defaultadd()
+/* reftype_adds_build()
  *
- * Add tag/value pairs that have "DEFAULT" processing
- * unless a tag/value pair with the same tag has already
- * been adding during reference processing.
+ * returns BIBL_OK or BIBL_ERR_MEMERR
  */
 static int
-process_defaultadd( fields *f, int reftype, param *r )
+reftype_adds_build( reftype_adds **padds, param *p )
 {
-	int i, n, process, level, status, ret = BIBL_OK;
+	int i, j, process, level, status = BIBL_OK;
+	reftype_adds *adds;
 	str tag, value;
-	char *p;
+	lookups *l;
+
+	*padds = NULL;
+
+	adds = ( reftype_adds * ) malloc( sizeof( reftype_adds ) * p->nall );
+	if ( !adds ) return BIBL_ERR_MEMERR;
+
+	for ( i=0; i<p->nall; ++i ) {
+		slists_init( &(adds[i].always_tags), &(adds[i].always_values), &(adds[i].default_tags), &(adds[i].default_values), NULL );
+		intlist_init( &(adds[i].always_levels) );
+		intlist_init( &(adds[i].default_levels) );
+	}
 
 	strs_init( &tag, &value, NULL );
 
-	for ( i=0; i<r->all[reftype].ntags; ++i ) {
+	for ( i=0; i<p->nall; ++i ) {
 
-		process = ((r->all[reftype]).tags[i]).processingtype;
-		if ( process!=DEFAULT ) continue;
+		for ( j=0; j<p->all[i].ntags; ++j ) {
 
-		level   = ((r->all[reftype]).tags[i]).level;
-		p       = ((r->all[reftype]).tags[i]).newstr;
+			l = &( p->all[i].tags[j] );
 
-		status = extract_tag_value( &tag, &value, p );
-		if ( status!=BIBL_OK ) {
-			ret = status;
-			goto out;
-		}
+			process = l->processingtype;
+			if ( process!=ALWAYS && process!=DEFAULT ) continue;
+
+			/* entries without a value would never be added */
+			if ( !l->newstr || !strchr( l->newstr, '|' ) ) continue;
+
+			level   = l->level;
+
+			status = extract_tag_value( &tag, &value, l->newstr );
+			if ( status!=BIBL_OK ) goto out;
+
+			if ( process==ALWAYS )
+				status = reftype_adds_add( &(adds[i].always_tags), &(adds[i].always_values), &(adds[i].always_levels), &tag, &value, level );
+			else
+				status = reftype_adds_add( &(adds[i].default_tags), &(adds[i].default_values), &(adds[i].default_levels), &tag, &value, level );
+			if ( status!=BIBL_OK ) goto out;
 
-		n = fields_find( f, tag.data, level );
-		if ( n==FIELDS_NOTFOUND ) {
-			status = fields_add( f, tag.data, value.data, level );
-			if ( status!=FIELDS_OK ) {
-				ret = BIBL_ERR_MEMERR;
-				goto out;
-			}
 		}
 
 	}
+
 out:
 	strs_free( &tag, &value, NULL );
 
-	return ret;
+	if ( status!=BIBL_OK ) reftype_adds_free( adds, p->nall );
+	else *padds = adds;
+
+	return status;
 }
 
-/* process_alwaysadd()
+/* process_defaultadd()
  *
- * Add tag/value pair to reference from the ALWAYS 
- * processing type without exception (the difference from
- * DEFAULT processing).
+ * Add tag/value pairs that have "DEFAULT" processing
+ * unless a tag/value pair with the same tag has already
+ * been adding during reference processing.
  */
 static int
-process_alwaysadd( fields *f, int reftype, param *r )
+process_defaultadd( fields *f, reftype_adds *adds )
 {
-	int i, process, level, status, ret = BIBL_OK;
-	str tag, value;
-	char *p;
-
-	strs_init( &tag, &value, NULL );
-
-	for ( i=0; i<r->all[reftype].ntags; ++i ) {
+	int i, n, level, status;
+	char *tag;
 
-		process = ((r->all[reftype]).tags[i]).processingtype;
-		if ( process!=ALWAYS ) continue;
+	for ( i=0; i<adds->default_tags.n; ++i ) {
 
-		level   = ((r->all[reftype]).tags[i]).level;
-		p       = ((r->all[reftype]).tags[i]).newstr;
+		tag   = slist_cstr( &(adds->default_tags), i );
+		level = intlist_get( &(adds->default_levels), i );
 
-		status = extract_tag_value( &tag, &value, p );
-		if ( status!=BIBL_OK ) {
-			ret = status;
-			goto out;
+		n = fields_find( f, tag, level );
+		if ( n==FIELDS_NOTFOUND ) {
+			status = fields_add( f, tag, slist_cstr( &(adds->default_values), i ), level );
+			if ( status!=FIELDS_OK ) return BIBL_ERR_MEMERR;
 		}
 
-		status = fields_add( f, tag.data, value.data, level );
-		if ( status!=FIELDS_OK ) {
-			ret = BIBL_ERR_MEMERR;
-			goto out;
-		}
 	}
 
-out:
-	strs_free( &tag, &value, NULL );
+	return BIBL_OK;
+}
 
-	return ret;
+/* process_alwaysadd()
+ *
+ * Add tag/value pair to reference from the ALWAYS 
+ * processing type without exception (the difference from
+ * DEFAULT processing).
+ */
+static int
+process_alwaysadd( fields *f, reftype_adds *adds )
+{
+	int i, status;
+
+	for ( i=0; i<adds->always_tags.n; ++i ) {
+		status = fields_add( f, slist_cstr( &(adds->always_tags), i ),
+		                        slist_cstr( &(adds->always_values), i ),
+		                        intlist_get( &(adds->always_levels), i ) );
+		if ( status!=FIELDS_OK ) return BIBL_ERR_MEMERR;
+	}
+
+	return BIBL_OK;
 }
 
 static int
-read_refs( FILE *fp, bibl *bin, char *filename, param *p )
+read_refs( source *src, bibl *bin, char *filename, param *p )
 {
 	int refnum = 0, bufpos = 0, ret=BIBL_OK, fcharset;/* = CHARSET_UNKNOWN;*/
 	str reference, line;
@@ -453,7 +562,7 @@ read_refs( FILE *fp, bibl *bin, char *filename, param *p )
 
 	str_init( &reference );
 	str_init( &line );
-	while ( p->readf( fp, buf, sizeof(buf), &bufpos, &line, &reference, &fcharset ) ) {
+	while ( p->readf( src, buf, sizeof(buf), &bufpos, &line, &reference, &fcharset ) ) {
 		if ( reference.len==0 ) continue;
 		ref = fields_new();
 		if ( !ref ) {
@@ -580,14 +689,18 @@ bibl_addcount( bibl *b )
 	return BIBL_OK;
 }
 
+/* authoryear_citekey()
+ *
+ * Set citekey from the first author and the year of f, without white
+ * space; returns 0 if f lacks either, leaving citekey empty.
+ */
 static int
-generate_citekey( fields *f, long nref )
+authoryear_citekey( fields *f, str *citekey )
 {
-	int n1, n2, status, ret;
-	char *p, buf[100];
-	str citekey;
+	int n1, n2;
+	char *p;
 
-	str_init( &citekey );
+	str_empty( citekey );
 
 	n1 = fields_find( f, "AUTHOR", LEVEL_MAIN );
 	if ( n1==FIELDS_NOTFOUND ) n1 = fields_find( f, "AUTHOR:ASIS", LEVEL_MAIN );
@@ -601,23 +714,33 @@ generate_citekey( fields *f, long nref )
 	if ( n2==FIELDS_NOTFOUND ) n2 = fields_find( f, "PARTDATE:YEAR", LEVEL_MAIN );
 	if ( n2==FIELDS_NOTFOUND ) n2 = fields_find( f, "PARTDATE:YEAR", LEVEL_ANY );
 
-	if ( n1!=FIELDS_NOTFOUND && n2!=FIELDS_NOTFOUND ) {
-
-		p = fields_value( f, n1, FIELDS_CHRP_NOUSE );
-		while ( p && *p && *p!='|' ) {
-			if ( !is_ws( *p ) ) str_addchar( &citekey, *p ); 
-			p++;
-		}
+	if ( n1==FIELDS_NOTFOUND || n2==FIELDS_NOTFOUND ) return 0;
 
-		p = fields_value( f, n2, FIELDS_CHRP_NOUSE );
-		while ( p && *p ) {
-			if ( !is_ws( *p ) ) str_addchar( &citekey, *p );
-			p++;
-		}
+	p = fields_value( f, n1, FIELDS_CHRP_NOUSE );
+	while ( p && *p && *p!='|' ) {
+		if ( !is_ws( *p ) ) str_addchar( citekey, *p ); 
+		p++;
+	}
 
+	p = fields_value( f, n2, FIELDS_CHRP_NOUSE );
+	while ( p && *p ) {
+		if ( !is_ws( *p ) ) str_addchar( citekey, *p );
+		p++;
 	}
 
-	else {
+	return 1;
+}
+
+static int
+generate_citekey( fields *f, long nref )
+{
+	int status, ret;
+	char buf[100];
+	str citekey;
+
+	str_init( &citekey );
+
+	if ( !authoryear_citekey( f, &citekey ) ) {
 		sprintf( buf, "ref%ld", nref );
 		str_strcpyc( &citekey, buf );
 	}
@@ -662,25 +785,38 @@ get_citekeys( bibl *bin, slist *citekeys )
 	return BIBL_OK;
 }
 
+/* identify_duplicates()
+ *
+ * Set dup[i] to the position of the first of the citekeys equal to
+ * citekey i, or to -1 if it has no equal. Returns the number of
+ * citekeys repeating an earlier one, or -1 on a memory error.
+ */
 static int
 identify_duplicates( slist *citekeys, int *dup )
 {
-	int i, j, ndup = 0;
+	int i, first, ndup = 0;
+	strhash seen;
+
+	strhash_init( &seen, STRHASH_CASE );
 
 	for ( i=0; i<citekeys->n; ++i ) dup[i] = -1;
 
-	for ( i=0; i<citekeys->n-1; ++i ) {
-		if ( dup[i]!=-1 ) continue;
-		for ( j=i+1; j<citekeys->n; ++j ) {
-			if ( !strcmp( slist_cstr( citekeys, i ),
-			              slist_cstr( citekeys, j ) ) ) {
-					dup[i] = i;
-					dup[j] = i;
-					ndup++;
+	for ( i=0; i<citekeys->n; ++i ) {
+		first = strhash_find( &seen, slist_cstr( citekeys, i ) );
+		if ( first==-1 ) {
+			if ( strhash_set( &seen, slist_cstr( citekeys, i ), i )!=STRHASH_OK ) {
+				ndup = -1;
+				break;
 			}
+		} else {
+			dup[first] = first;
+			dup[i] = first;
+			ndup++;
 		}
 	}
 
+	strhash_free( &seen );
+
 	return ndup;
 }
 
@@ -701,42 +837,47 @@ build_new_citekey( int nsame, str *old_citekey, str *new_citekey )
 	return ( str_memerr( new_citekey ) ) ? BIBL_ERR_MEMERR : BIBL_OK;
 }
 
+/* resolve_duplicates()
+ *
+ * Suffix each citekey of a group of duplicates, the first included,
+ * with a, b, ... in order. The new citekeys go to the REFNUMs of b, or
+ * back into citekeys if b is NULL.
+ */
 static int
 resolve_duplicates( bibl *b, slist *citekeys, int *dup )
 {
-	int nsame, n, i, j, status = BIBL_OK;
+	int *nsame, n, i, j, status = BIBL_OK;
 	str new_citekey, *ref_citekey;
 
-	str_init( &new_citekey );
-
-	for ( i=0; i<citekeys->n; ++i ) {
-
-		if ( dup[i]==-1 ) continue;
-
-		nsame = 0;
+	nsame = ( int * ) calloc( citekeys->n, sizeof( int ) );
+	if ( !nsame ) return BIBL_ERR_MEMERR;
 
-		for ( j=i; j<citekeys->n; ++j ) {
+	str_init( &new_citekey );
 
-			if ( dup[j]!=i ) continue;
+	for ( j=0; j<citekeys->n; ++j ) {
 
-			dup[j] = -1;
+		i = dup[j];
+		if ( i==-1 ) continue;
 
-			status = build_new_citekey( nsame, slist_str( citekeys, j ), &new_citekey );
-			if ( status!=BIBL_OK ) goto out;
+		status = build_new_citekey( nsame[i], slist_str( citekeys, j ), &new_citekey );
+		if ( status!=BIBL_OK ) goto out;
 
+		if ( b ) {
 			n = fields_find( b->ref[j], "REFNUM", LEVEL_ANY );
 			if ( n==FIELDS_NOTFOUND ) continue;
-
 			ref_citekey = fields_value( b->ref[j], n, FIELDS_STRP_NOUSE );
+		} else {
+			ref_citekey = slist_str( citekeys, j );
+		}
 
-			str_strcpy( ref_citekey, &new_citekey );
-			if ( str_memerr( ref_citekey ) ) { status = BIBL_ERR_MEMERR; goto out; }
+		str_strcpy( ref_citekey, &new_citekey );
+		if ( str_memerr( ref_citekey ) ) { status = BIBL_ERR_MEMERR; goto out; }
 
-			nsame++;
-		}
+		nsame[i]++;
 	}
 out:
 	str_free( &new_citekey );
+	free( nsame );
 	return status;
 }
 
@@ -745,12 +886,15 @@ identify_and_resolve_duplicate_citekeys( bibl *b, slist *citekeys )
 {
 	int *dup, ndup, status=BIBL_OK;
 
+	if ( citekeys->n==0 ) return BIBL_OK;
+
 	dup = ( int * ) malloc( sizeof( int ) * citekeys->n );
 	if ( !dup ) return BIBL_ERR_MEMERR;
 
 	ndup = identify_duplicates( citekeys, dup );
 
-	if ( ndup ) status = resolve_duplicates( b, citekeys, dup );
+	if ( ndup==-1 ) status = BIBL_ERR_MEMERR;
+	else if ( ndup ) status = resolve_duplicates( b, citekeys, dup );
 
 	free( dup );
 	return status;
@@ -783,47 +927,54 @@ clean_refs( bibl *bin, param *p )
 static int 
 convert_refs( bibl *bin, char *fname, bibl *bout, param *p )
 {
-	int reftype = 0, status;
+	int reftype = 0, status = BIBL_OK;
+	reftype_adds *adds = NULL;
 	fields *rin, *rout;
 	long i;
 
+	if ( p->all ) {
+		status = reftype_adds_build( &adds, p );
+		if ( status!=BIBL_OK ) return status;
+	}
+
 	for ( i=0; i<bin->n; ++i ) {
 
 		rin = bin->ref[i];
 
 		rout = fields_new();
-		if ( !rout ) return BIBL_ERR_MEMERR;
+		if ( !rout ) { status = BIBL_ERR_MEMERR; goto out; }
 
 		if ( p->typef ) reftype = p->typef( rin, fname, i+1, p );
 
 		status = p->convertf( rin, rout, reftype, p );
-		if ( status!=BIBL_OK ) return status;
 
-		if ( p->all ) {
-			status = process_alwaysadd( rout, reftype, p );
-			if ( status!=BIBL_OK ) return status;
-			status = process_defaultadd( rout, reftype, p );
-			if ( status!=BIBL_OK ) return status;
+		if ( status==BIBL_OK && adds ) {
+			status = process_alwaysadd( rout, &(adds[reftype]) );
+			if ( status==BIBL_OK )
+				status = process_defaultadd( rout, &(adds[reftype]) );
 		}
 
-		status = bibl_addref( bout, rout );
-		if ( status!=BIBL_OK ) return status;
+		if ( status==BIBL_OK )
+			status = bibl_addref( bout, rout );
+
+		if ( status!=BIBL_OK ) {
+			fields_delete( rout );
+			goto out;
+		}
 	}
 
-	return BIBL_OK;
+out:
+	reftype_adds_free( adds, p->nall );
+	return status;
 }
 
-int
-bibl_read( bibl *b, FILE *fp, char *filename, param *p )
+static int
+bibl_readsource( bibl *b, source *src, char *filename, param *p )
 {
 	int status = BIBL_OK;
 	param read_params;
 	bibl bin;
 
-	if ( !b )  return BIBL_ERR_BADINPUT;
-	if ( !fp ) return BIBL_ERR_BADINPUT;
-	if ( !p )  return BIBL_ERR_BADINPUT;
-
 	if ( bibl_illegalinmode( p->readformat ) ) {
 		if ( debug_set( p ) ) report_params( stderr, "bibl_read", p );
 		return BIBL_ERR_BADINPUT;
@@ -841,10 +992,10 @@ bibl_read( bibl *b, FILE *fp, char *filename, param *p )
 
 	bibl_init( &bin );
 
-	status = read_refs( fp, &bin, filename, &read_params );
+	status = read_refs( src, &bin, filename, &read_params );
 	if ( status!=BIBL_OK ) {
 		if ( debug_set( &read_params ) ) report_params( stderr, "bibl_read", &read_params );
-		bibl_freeparams( &read_params );
+		bibl_freeworkparams( &read_params );
 		return status;
 	}
 
@@ -888,148 +1039,1662 @@ bibl_read( bibl *b, FILE *fp, char *filename, param *p )
 
 out:
 	bibl_free( &bin );
-	bibl_freeparams( &read_params );
+	bibl_freeworkparams( &read_params );
 
 	return status;
 }
 
-static FILE *
-singlerefname( fields *reffields, long nref, int mode )
+int
+bibl_read( bibl *b, FILE *fp, char *filename, param *p )
 {
-	char outfile[2048];
-	char suffix[5] = "xml";
-	FILE *fp;
-	long count;
-	int  found;
-	if      ( mode==BIBL_ADSABSOUT )     strcpy( suffix, "ads" );
-	else if ( mode==BIBL_BIBTEXOUT )     strcpy( suffix, "bib" );
-	else if ( mode==BIBL_ENDNOTEOUT )    strcpy( suffix, "end" );
-	else if ( mode==BIBL_ISIOUT )        strcpy( suffix, "isi" );
-	else if ( mode==BIBL_MODSOUT )       strcpy( suffix, "xml" );
-	else if ( mode==BIBL_RISOUT )        strcpy( suffix, "ris" );
-	else if ( mode==BIBL_WORD2007OUT )   strcpy( suffix, "xml" );
-	found = fields_find( reffields, "REFNUM", LEVEL_MAIN );
-	/* find new filename based on reference */
-	if ( found!=-1 ) {
-		sprintf( outfile,"%s.%s",(char*)fields_value(reffields,found,FIELDS_CHRP_NOUSE), suffix );
-	} else  sprintf( outfile,"%ld.%s",nref, suffix );
-	count = 0;
-	fp = fopen( outfile, "r" );
-	while ( fp ) {
-		fclose(fp);
-		count++;
-		if ( count==60000 ) return NULL;
-		if ( found!=-1 )
-			sprintf( outfile, "%s_%ld.%s", (char*)fields_value( reffields, found, FIELDS_CHRP_NOUSE ), count, suffix );
-		else sprintf( outfile,"%ld_%ld.%s", nref, count, suffix );
-		fp = fopen( outfile, "r" );
-	}
-	return fopen( outfile, "w" );
+	source src;
+
+	if ( !b )  return BIBL_ERR_BADINPUT;
+	if ( !fp ) return BIBL_ERR_BADINPUT;
+	if ( !p )  return BIBL_ERR_BADINPUT;
+
+	source_init( &src, fp );
+
+	return bibl_readsource( b, &src, filename, p );
 }
 
-static int
-bibl_writeeachfp( FILE *fp, bibl *b, param *p )
+/* bibl_read_mem()
+ *
+ * As bibl_read(), for input held in buf[0..len), which need not be
+ * '\0'-terminated; lines are taken straight from buf.
+ */
+int
+bibl_read_mem( bibl *b, const char *buf, unsigned long len, char *filename, param *p )
 {
-	fields out, *use = &out;
-	int status;
-	long i;
+	source src;
 
-	fields_init( &out );
+	if ( !b ) return BIBL_ERR_BADINPUT;
+	if ( !buf && len ) return BIBL_ERR_BADINPUT;
+	if ( !p ) return BIBL_ERR_BADINPUT;
 
-	for ( i=0; i<b->n; ++i ) {
+	source_init_mem( &src, buf, len );
 
-		fp = singlerefname( b->ref[i], i, p->writeformat );
-		if ( !fp ) return BIBL_ERR_CANTOPEN;
+	return bibl_readsource( b, &src, filename, p );
+}
 
-		if ( p->headerf ) p->headerf( fp, p );
+/* bibl_scansource()
+ *
+ * Frame the references in src with p->readf one at a time and call f
+ * for each with the span of the input it was framed from. References
+ * are handed over converted, as bibl_read() would leave them but
+ * without the steps that need the whole file: p->cleanf, citekey
+ * generation and uniquification. Records that are not references,
+ * such as BibTeX @STRINGs, get a NULL ref. Spans follow one another,
+ * so that reading any run of them in order frames the same records.
+ *
+ * charset, if not NULL, is set to the character set found in the
+ * file, or CHARSET_UNKNOWN. A status other than BIBL_OK from f ends
+ * the scan and is returned.
+ */
+static int
+bibl_scansource( source *src, char *filename, param *p, int *charset, bibl_scanfn f, void *arg )
+{
+	int bufpos = 0, fcharset, reftype = 0, status = BIBL_OK;
+	reftype_adds *adds = NULL;
+	unsigned long start, next;
+	str reference, line;
+	fields *raw, *ref;
+	char rbuf[256]="";
+	param rp;
+	long nrec = 0, nref = 0;
 
-		if ( p->assemblef ) {
-			fields_free( &out );
-			status = p->assemblef( b->ref[i], &out, p, i );
-			if ( status!=BIBL_OK ) break;
-		} else {
-			use = b->ref[i];
-		}
+	if ( charset ) *charset = CHARSET_UNKNOWN;
 
-		status = p->writef( use, fp, p, i );
+	status = bibl_setreadparams( &rp, p );
+	if ( status!=BIBL_OK ) return status;
 
-		if ( p->footerf ) p->footerf( fp );
-		fclose( fp );
+	if ( rp.all && !rp.output_raw ) {
+		status = reftype_adds_build( &adds, &rp );
+		if ( status!=BIBL_OK ) {
+			bibl_freeworkparams( &rp );
+			return status;
+		}
+	}
 
-		if ( status!=BIBL_OK ) return status;
+	strs_init( &reference, &line, NULL );
+	raw = fields_new();
+	ref = fields_new();
+	if ( !raw || !ref ) {
+		status = BIBL_ERR_MEMERR;
+		goto out;
 	}
 
-	return BIBL_OK;
-}
+	start = 0;
 
-static int
-bibl_writefp( FILE *fp, bibl *b, param *p )
-{
-	int status = BIBL_OK;
-	fields out, *use = &out;
-	long i;
+	while ( rp.readf( src, rbuf, sizeof(rbuf), &bufpos, &line, &reference, &fcharset ) ) {
 
-	fields_init( &out );
+		next = source_tell( src, &line );
 
-	if ( debug_set( p ) && p->assemblef ) {
-		fprintf( stderr, "-------------------assemblef start for bibl_write\n");
-	}
+		if ( fcharset!=CHARSET_UNKNOWN ) {
+			if ( charset ) *charset = fcharset;
+			if ( rp.charsetin_src!=BIBL_SRC_USER ) {
+				rp.charsetin_src = BIBL_SRC_FILE;
+				rp.charsetin = fcharset;
+				if ( fcharset!=CHARSET_UNICODE ) rp.utf8in = 0;
+			}
+		}
+		if ( rp.charsetin==CHARSET_UNICODE ) rp.utf8in = 1;
 
-	if ( p->headerf ) p->headerf( fp, p );
-	for ( i=0; i<b->n; ++i ) {
+		if ( reference.len==0 ) {
+			start = next;
+			continue;
+		}
 
-		if ( p->assemblef ) {
-			fields_free( &out );
-			status = p->assemblef( b->ref[i], &out, p, i );
-			if ( status!=BIBL_OK ) break;
-			if ( debug_set( p ) ) bibl_verbose_reference( &out, "", i+1 );
+		fields_empty( raw );
+		if ( rp.processf( raw, reference.data, filename, nref+1, &rp ) ) {
+			if ( !rp.output_raw || ( rp.output_raw & BIBL_RAW_WITHCHARCONVERT ) ) {
+				status = bibl_fixcharsetdata( raw, &rp );
+				if ( status!=BIBL_OK ) goto out;
+			}
+			if ( !rp.output_raw ) {
+				fields_empty( ref );
+				if ( rp.typef ) reftype = rp.typef( raw, filename, nref+1, &rp );
+				status = rp.convertf( raw, ref, reftype, &rp );
+				if ( status==BIBL_OK && adds ) {
+					status = process_alwaysadd( ref, &(adds[reftype]) );
+					if ( status==BIBL_OK )
+						status = process_defaultadd( ref, &(adds[reftype]) );
+				}
+				if ( status!=BIBL_OK ) goto out;
+				status = f( nrec, start, next - start, ref, arg );
+			} else {
+				status = f( nrec, start, next - start, raw, arg );
+			}
+			nref++;
 		} else {
-			use = b->ref[i];
+			status = f( nrec, start, next - start, NULL, arg );
 		}
+		if ( status!=BIBL_OK ) goto out;
 
-		status = p->writef( use, fp, p, i );
-		if ( status!=BIBL_OK ) break;
-
+		nrec++;
+		start = next;
+		str_empty( &reference );
 	}
 
-	if ( debug_set( p ) && p->assemblef ) {
-		fprintf( stderr, "-------------------assemblef end for bibl_write\n");
-	}
+out:
+	if ( raw ) fields_delete( raw );
+	if ( ref ) fields_delete( ref );
+	strs_free( &reference, &line, NULL );
+	reftype_adds_free( adds, rp.nall );
+	bibl_freeworkparams( &rp );
 
-	if ( p->footerf ) p->footerf( fp );
 	return status;
 }
 
+/* bibl_scan()
+ *
+ * Scan buf[0..len) with bibl_scansource(); spans are offsets in buf.
+ */
 int
-bibl_write( bibl *b, FILE *fp, param *p )
+bibl_scan( const char *buf, unsigned long len, char *filename, param *p, int *charset,
+		bibl_scanfn f, void *arg )
 {
-	int status;
-	param lp;
-
-	if ( !b ) return BIBL_ERR_BADINPUT;
-	if ( !p ) return BIBL_ERR_BADINPUT;
-	if ( bibl_illegaloutmode( p->writeformat ) ) return BIBL_ERR_BADINPUT;
-	if ( !fp && !p->singlerefperfile ) return BIBL_ERR_BADINPUT;
+	source src;
 
-	status = bibl_setwriteparams( &lp, p );
-	if ( status!=BIBL_OK ) return status;
+	if ( !buf && len ) return BIBL_ERR_BADINPUT;
+	if ( !p || !f ) return BIBL_ERR_BADINPUT;
+	if ( bibl_illegalinmode( p->readformat ) ) return BIBL_ERR_BADINPUT;
 
-	if ( debug_set( p ) ) {
-		report_params( stderr, "bibl_write", &lp );
-		fflush( stdout );
-	}
+	source_init_mem( &src, buf, len );
 
-	if ( debug_set( p ) ) bibl_verbose( b, "raw_input", "for bibl_write" );
+	return bibl_scansource( &src, filename, p, charset, f, arg );
+}
 
-	status = bibl_fixcharsets( b, &lp );
+/* bibl_scanfile()
+ *
+ * Scan fp from where it is to its end with bibl_scansource(); spans are
+ * offsets from there. Only the longest line is held in memory at once.
+ */
+int
+bibl_scanfile( FILE *fp, char *filename, param *p, int *charset, bibl_scanfn f, void *arg )
+{
+	int status;
+	source src;
+
+	if ( !fp || !p || !f ) return BIBL_ERR_BADINPUT;
+	if ( bibl_illegalinmode( p->readformat ) ) return BIBL_ERR_BADINPUT;
+
+	source_init_file( &src, fp );
+
+	status = bibl_scansource( &src, filename, p, charset, f, arg );
+	if ( status==BIBL_OK ) {
+		if ( source_status( &src )==SOURCE_ERR_MEMERR ) status = BIBL_ERR_MEMERR;
+		else if ( source_status( &src )!=SOURCE_OK ) status = BIBL_ERR_CANTOPEN;
+	}
+
+	source_free( &src );
+
+	return status;
+}
+
+/* Single reference per file output
+ *
+ * Each reference goes to a file named after its REFNUM (or its
+ * number), with _1, _2, ... added to avoid existing files. The names
+ * in the directory are read once into a namelist that also collects
+ * the names handed out; new files are created with O_CREAT|O_EXCL so
+ * a file that appears after the scan is skipped, never overwritten.
+ */
+
+#define BIBL_MAXSINGLEREFNAMES (60000)
+
+static const char *
+singlerefsuffix( int mode )
+{
+	if      ( mode==BIBL_ADSABSOUT )     return "ads";
+	else if ( mode==BIBL_BIBTEXOUT )     return "bib";
+	else if ( mode==BIBL_ENDNOTEOUT )    return "end";
+	else if ( mode==BIBL_ISIOUT )        return "isi";
+	else if ( mode==BIBL_RISOUT )        return "ris";
+	else                                 return "xml";
+}
+
+static int
+singlerefnames_init( namelist *used )
+{
+	struct dirent *d;
+	DIR *dir;
+
+	namelist_init( used );
+
+	/* without a listing, O_EXCL alone still avoids overwriting */
+	dir = opendir( "." );
+	if ( !dir ) return BIBL_OK;
+
+	while ( ( d = readdir( dir ) ) ) {
+		if ( namelist_add( used, d->d_name )!=NAMELIST_OK ) {
+			closedir( dir );
+			return BIBL_ERR_MEMERR;
+		}
+	}
+
+	closedir( dir );
+
+	return BIBL_OK;
+}
+
+/* singlerefopen()
+ *
+ * Create a new file for reference nref, or return NULL and set
+ * *status.
+ */
+static FILE *
+singlerefopen( namelist *used, fields *reffields, long nref, int mode, int *status )
+{
+	const char *suffix = singlerefsuffix( mode );
+	char num[64];
+	FILE *fp = NULL;
+	str outfile;
+	int found, fd;
+	long count;
+
+	*status = BIBL_ERR_CANTOPEN;
+
+	found = fields_find( reffields, "REFNUM", LEVEL_MAIN );
+
+	str_init( &outfile );
+
+	for ( count=0; count<BIBL_MAXSINGLEREFNAMES; ++count ) {
+
+		if ( found!=-1 ) str_strcpyc( &outfile, fields_value( reffields, found, FIELDS_CHRP_NOUSE ) );
+		else {
+			sprintf( num, "%ld", nref );
+			str_strcpyc( &outfile, num );
+		}
+		if ( count ) {
+			sprintf( num, "_%ld", count );
+			str_strcatc( &outfile, num );
+		}
+		str_addchar( &outfile, '.' );
+		str_strcatc( &outfile, suffix );
+		if ( str_memerr( &outfile ) ) {
+			*status = BIBL_ERR_MEMERR;
+			break;
+		}
+
+		if ( namelist_findc( used, str_cstr( &outfile ) )!=-1 ) continue;
+
+		fd = open( str_cstr( &outfile ), O_WRONLY | O_CREAT | O_EXCL, 0666 );
+		if ( fd==-1 && errno!=EEXIST ) break;
+
+		if ( namelist_add( used, str_cstr( &outfile ) )!=NAMELIST_OK ) {
+			if ( fd!=-1 ) close( fd );
+			*status = BIBL_ERR_MEMERR;
+			break;
+		}
+
+		if ( fd==-1 ) continue;
+
+		fp = fdopen( fd, "w" );
+		if ( !fp ) close( fd );
+		else *status = BIBL_OK;
+		break;
+
+	}
+
+	str_free( &outfile );
+
+	return fp;
+}
+
+/* bibl_writeeachref()
+ *
+ * Write reference i to its own file fp, then close it.
+ */
+static int
+bibl_writeeachref( FILE *fp, bibl *b, long i, param *p, fields *out )
+{
+	fields *use = out;
+	int status;
+	sink s;
+
+	sink_init( &s, fp );
+
+	if ( p->headerf ) p->headerf( &s, p );
+
+	if ( p->assemblef ) {
+		fields_empty( out );
+		status = p->assemblef( b->ref[i], out, p, i );
+		if ( status!=BIBL_OK ) {
+			sink_free( &s );
+			fclose( fp );
+			return status;
+		}
+	} else {
+		use = b->ref[i];
+	}
+
+	status = p->writef( use, &s, p, i );
+
+	if ( p->footerf ) p->footerf( &s );
+	status = bibl_sinkstatus( status, sink_free( &s ) );
+	fclose( fp );
+
+	return status;
+}
+
+static int
+bibl_writeeachrefs( namelist *used, bibl *b, param *p )
+{
+	int status = BIBL_OK;
+	fields out;
+	FILE *fp;
+	long i;
+
+	fields_init( &out );
+
+	for ( i=0; i<b->n; ++i ) {
+
+		fp = singlerefopen( used, b->ref[i], i, p->writeformat, &status );
+		if ( !fp ) break;
+
+		status = bibl_writeeachref( fp, b, i, p, &out );
+		if ( status!=BIBL_OK ) break;
+
+	}
+
+	fields_free( &out );
+
+	return status;
+}
+
+#ifndef BIBL_NO_THREADS
+
+/* Threaded single reference per file output
+ *
+ * Workers claim references in order and pick each file name under
+ * the lock, so the names are the same as from a single thread; the
+ * assembling and writing of each file then runs in parallel. After
+ * the first error no further references are claimed.
+ */
+
+typedef struct {
+	bibl     *b;
+	param    *p;
+	namelist *used;
+	long     next;
+	int      status;
+	pthread_mutex_t lock;
+} bibl_writeeachjob;
+
+static void *
+bibl_writeeachworker( void *arg )
+{
+	bibl_writeeachjob *job = ( bibl_writeeachjob * ) arg;
+	fields out;
+	int status;
+	FILE *fp;
+	long i;
+
+	fields_init( &out );
+
+	while ( 1 ) {
+
+		pthread_mutex_lock( &(job->lock) );
+		if ( job->status!=BIBL_OK || job->next >= job->b->n ) {
+			pthread_mutex_unlock( &(job->lock) );
+			break;
+		}
+		i = job->next++;
+		fp = singlerefopen( job->used, job->b->ref[i], i, job->p->writeformat, &status );
+		if ( !fp ) job->status = status;
+		pthread_mutex_unlock( &(job->lock) );
+		if ( !fp ) break;
+
+		status = bibl_writeeachref( fp, job->b, i, job->p, &out );
+		if ( status!=BIBL_OK ) {
+			pthread_mutex_lock( &(job->lock) );
+			if ( job->status==BIBL_OK ) job->status = status;
+			pthread_mutex_unlock( &(job->lock) );
+			break;
+		}
+
+	}
+
+	fields_free( &out );
+
+	return NULL;
+}
+
+/* bibl_writeeachrefs_threaded()
+ *
+ * Returns -1 if no worker thread could be started, so the caller
+ * can fall back to bibl_writeeachrefs().
+ */
+static int
+bibl_writeeachrefs_threaded( namelist *used, bibl *b, param *p )
+{
+	int i, nthreads, started = 0;
+	bibl_writeeachjob job;
+	pthread_t *threads;
+
+	job.b      = b;
+	job.p      = p;
+	job.used   = used;
+	job.next   = 0;
+	job.status = BIBL_OK;
+
+	nthreads = p->nthreads;
+	if ( nthreads > b->n ) nthreads = b->n;
+
+	threads = ( pthread_t * ) malloc( sizeof( pthread_t ) * nthreads );
+	if ( !threads ) return BIBL_ERR_MEMERR;
+
+	pthread_mutex_init( &(job.lock), NULL );
+
+	for ( i=0; i<nthreads; ++i ) {
+		if ( pthread_create( &(threads[i]), NULL, bibl_writeeachworker, &job ) ) break;
+		started++;
+	}
+
+	for ( i=0; i<started; ++i )
+		pthread_join( threads[i], NULL );
+
+	pthread_mutex_destroy( &(job.lock) );
+	free( threads );
+
+	if ( !started ) return -1;
+
+	return job.status;
+}
+
+#endif
+
+static int
+bibl_writeeach( bibl *b, param *p )
+{
+	int status = -1;
+	namelist used;
+
+	if ( singlerefnames_init( &used )!=BIBL_OK ) {
+		namelist_free( &used );
+		return BIBL_ERR_MEMERR;
+	}
+
+#ifndef BIBL_NO_THREADS
+	if ( p->nthreads > 1 && b->n > 1 )
+		status = bibl_writeeachrefs_threaded( &used, b, p );
+#endif
+	if ( status==-1 ) status = bibl_writeeachrefs( &used, b, p );
+
+	namelist_free( &used );
+
+	return status;
+}
+
+/* bibl_writerefs()
+ *
+ * Assemble and write references [begin,end) to out.
+ */
+static int
+bibl_writerefs( sink *out, bibl *b, long begin, long end, param *p )
+{
+	int status = BIBL_OK;
+	fields assembled, *use = &assembled;
+	long i;
+
+	fields_init( &assembled );
+
+	for ( i=begin; i<end; ++i ) {
+
+		if ( p->assemblef ) {
+			fields_empty( &assembled );
+			status = p->assemblef( b->ref[i], &assembled, p, i );
+			if ( status!=BIBL_OK ) break;
+			if ( debug_set( p ) ) bibl_verbose_reference( &assembled, "", i+1 );
+		} else {
+			use = b->ref[i];
+		}
+
+		status = p->writef( use, out, p, i );
+		status = bibl_sinkstatus( status, sink_status( out ) );
+		if ( status!=BIBL_OK ) break;
+
+	}
+
+	fields_free( &assembled );
+
+	return status;
+}
+
+#ifndef BIBL_NO_THREADS
+
+/* Threaded output
+ *
+ * Worker threads claim chunks of BIBL_WRITECHUNK consecutive
+ * references in order, and assemble and write each chunk into a
+ * private str through a sink. The calling thread hands the finished
+ * buffers to the output strictly in reference order, so the output
+ * is the same as from a single thread. Workers run at most
+ * BIBL_WRITEAHEAD chunks per thread ahead of the writer to bound the
+ * memory held in buffers.
+ *
+ * This relies on assemblef/writef keeping no state between references
+ * and treating the param as read-only.
+ */
+
+#define BIBL_WRITECHUNK (64)
+#define BIBL_WRITEAHEAD (4)
+
+typedef struct {
+	str    out;
+	int    status;
+	int    done;
+} bibl_writechunk;
+
+typedef struct {
+	bibl  *b;
+	param *p;
+	bibl_writechunk *chunks;
+	long  nchunks;
+	long  next;      /* next chunk to be claimed by a worker */
+	long  flushed;   /* chunks already written to the output */
+	long  ahead;     /* limit on chunks claimed but not yet flushed */
+	int   stop;
+	pthread_mutex_t lock;
+	pthread_cond_t  done;   /* a worker finished a chunk */
+	pthread_cond_t  space;  /* the writer flushed a chunk or set stop */
+} bibl_writejob;
+
+static int
+bibl_writechunk_format( bibl_writejob *job, long c )
+{
+	bibl_writechunk *chunk = &(job->chunks[c]);
+	long begin, end;
+	int status;
+	sink mem;
+
+	sink_init_str( &mem, &(chunk->out) );
+
+	begin = c * BIBL_WRITECHUNK;
+	end   = begin + BIBL_WRITECHUNK;
+	if ( end > job->b->n ) end = job->b->n;
+
+	status = bibl_writerefs( &mem, job->b, begin, end, job->p );
+
+	status = bibl_sinkstatus( status, sink_free( &mem ) );
+
+	return status;
+}
+
+static void *
+bibl_writeworker( void *arg )
+{
+	bibl_writejob *job = ( bibl_writejob * ) arg;
+	int status;
+	long c;
+
+	pthread_mutex_lock( &(job->lock) );
+
+	while ( 1 ) {
+
+		while ( !job->stop && job->next < job->nchunks && job->next >= job->flushed + job->ahead )
+			pthread_cond_wait( &(job->space), &(job->lock) );
+		if ( job->stop || job->next >= job->nchunks ) break;
+
+		c = job->next++;
+		pthread_mutex_unlock( &(job->lock) );
+
+		status = bibl_writechunk_format( job, c );
+
+		pthread_mutex_lock( &(job->lock) );
+		job->chunks[c].status = status;
+		job->chunks[c].done   = 1;
+		pthread_cond_signal( &(job->done) );
+
+	}
+
+	pthread_mutex_unlock( &(job->lock) );
+
+	return NULL;
+}
+
+/* bibl_writerefs_threaded()
+ *
+ * Returns -1 if no worker thread could be started, so the caller
+ * can fall back to bibl_writerefs().
+ */
+static int
+bibl_writerefs_threaded( sink *out, bibl *b, param *p )
+{
+	int i, nthreads, started = 0, status = BIBL_OK;
+	bibl_writechunk *chunk;
+	pthread_t *threads;
+	bibl_writejob job;
+	long c;
+
+	job.b       = b;
+	job.p       = p;
+	job.nchunks = ( b->n + BIBL_WRITECHUNK - 1 ) / BIBL_WRITECHUNK;
+	job.next    = 0;
+	job.flushed = 0;
+	job.stop    = 0;
+
+	nthreads = p->nthreads;
+	if ( nthreads > job.nchunks ) nthreads = job.nchunks;
+	job.ahead = ( long ) nthreads * BIBL_WRITEAHEAD;
+
+	job.chunks = ( bibl_writechunk * ) calloc( job.nchunks, sizeof( bibl_writechunk ) );
+	threads    = ( pthread_t * ) malloc( sizeof( pthread_t ) * nthreads );
+	if ( !job.chunks || !threads ) {
+		if ( job.chunks ) free( job.chunks );
+		if ( threads ) free( threads );
+		return BIBL_ERR_MEMERR;
+	}
+
+	for ( c=0; c<job.nchunks; ++c )
+		str_init( &(job.chunks[c].out) );
+
+	pthread_mutex_init( &(job.lock), NULL );
+	pthread_cond_init( &(job.done), NULL );
+	pthread_cond_init( &(job.space), NULL );
+
+	for ( i=0; i<nthreads; ++i ) {
+		if ( pthread_create( &(threads[i]), NULL, bibl_writeworker, &job ) ) break;
+		started++;
+	}
+
+	if ( started ) {
+		for ( c=0; c<job.nchunks; ++c ) {
+
+			pthread_mutex_lock( &(job.lock) );
+			while ( !job.chunks[c].done )
+				pthread_cond_wait( &(job.done), &(job.lock) );
+			pthread_mutex_unlock( &(job.lock) );
+
+			chunk = &(job.chunks[c]);
+			sink_str( out, &(chunk->out) );
+			str_free( &(chunk->out) );
+			status = chunk->status;
+			status = bibl_sinkstatus( status, sink_status( out ) );
+			if ( status!=BIBL_OK ) break;
+
+			pthread_mutex_lock( &(job.lock) );
+			job.flushed = c + 1;
+			pthread_cond_broadcast( &(job.space) );
+			pthread_mutex_unlock( &(job.lock) );
+
+		}
+	}
+
+	pthread_mutex_lock( &(job.lock) );
+	job.stop = 1;
+	pthread_cond_broadcast( &(job.space) );
+	pthread_mutex_unlock( &(job.lock) );
+
+	for ( i=0; i<started; ++i )
+		pthread_join( threads[i], NULL );
+
+	for ( c=0; c<job.nchunks; ++c )
+		str_free( &(job.chunks[c].out) );
+
+	pthread_cond_destroy( &(job.space) );
+	pthread_cond_destroy( &(job.done) );
+	pthread_mutex_destroy( &(job.lock) );
+	free( threads );
+	free( job.chunks );
+
+	if ( !started ) return -1;
+
+	return status;
+}
+
+#endif
+
+static int
+bibl_writesink( sink *out, bibl *b, param *p )
+{
+	int status = -1;
+
+	if ( debug_set( p ) && p->assemblef ) {
+		fprintf( stderr, "-------------------assemblef start for bibl_write\n");
+	}
+
+	if ( p->headerf ) p->headerf( out, p );
+
+#ifndef BIBL_NO_THREADS
+	/* debug output of the assembled references stays in order */
+	if ( p->nthreads > 1 && b->n > BIBL_WRITECHUNK && !debug_set( p ) )
+		status = bibl_writerefs_threaded( out, b, p );
+#endif
+	if ( status==-1 ) status = bibl_writerefs( out, b, 0, b->n, p );
+
+	if ( debug_set( p ) && p->assemblef ) {
+		fprintf( stderr, "-------------------assemblef end for bibl_write\n");
+	}
+
+	if ( p->footerf ) p->footerf( out );
+
+	return status;
+}
+
+/* bibl_writeout()
+ *
+ * Write b to out, or to one file per reference if p asks for it.
+ */
+static int
+bibl_writeout( bibl *b, sink *out, param *p )
+{
+	int status;
+	param lp;
+
+	status = bibl_setwriteparams( &lp, p );
+	if ( status!=BIBL_OK ) return status;
+
+	if ( debug_set( p ) ) {
+		report_params( stderr, "bibl_write", &lp );
+		fflush( stdout );
+	}
+
+	if ( debug_set( p ) ) bibl_verbose( b, "raw_input", "for bibl_write" );
+
+	status = bibl_fixcharsets( b, &lp );
+	if ( status!=BIBL_OK ) goto out;
+
+	if ( debug_set( p ) ) bibl_verbose( b, "post-fixcharsets", "for bibl_write" );
+
+	if ( p->singlerefperfile ) status = bibl_writeeach( b, &lp );
+	else status = bibl_writesink( out, b, &lp );
+
+out:
+	bibl_freeworkparams( &lp );
+	return status;
+}
+
+int
+bibl_write( bibl *b, FILE *fp, param *p )
+{
+	int status;
+	sink out;
+
+	if ( !b ) return BIBL_ERR_BADINPUT;
+	if ( !p ) return BIBL_ERR_BADINPUT;
+	if ( bibl_illegaloutmode( p->writeformat ) ) return BIBL_ERR_BADINPUT;
+	if ( !fp && !p->singlerefperfile ) return BIBL_ERR_BADINPUT;
+
+	sink_init( &out, fp );
+
+	status = bibl_writeout( b, &out, p );
+
+	status = bibl_sinkstatus( status, sink_free( &out ) );
+
+	return status;
+}
+
+/* bibl_write_mem()
+ *
+ * As bibl_write(), appending the output to out. Single reference per
+ * file output is not supported here.
+ */
+int
+bibl_write_mem( bibl *b, str *out, param *p )
+{
+	int status;
+	sink s;
+
+	if ( !b ) return BIBL_ERR_BADINPUT;
+	if ( !out ) return BIBL_ERR_BADINPUT;
+	if ( !p ) return BIBL_ERR_BADINPUT;
+	if ( bibl_illegaloutmode( p->writeformat ) ) return BIBL_ERR_BADINPUT;
+	if ( p->singlerefperfile ) return BIBL_ERR_BADINPUT;
+
+	sink_init_str( &s, out );
+
+	status = bibl_writeout( b, &s, p );
+
+	status = bibl_sinkstatus( status, sink_free( &s ) );
+
+	return status;
+}
+
+/* Output from private copies
+ *
+ * bibl_writestore() and bibl_writemany() leave their references as
+ * they are: each reference is copied, charset-converted, assembled and
+ * written in turn, so only one copy per output exists at a time and
+ * several outputs can read the same references at once.
+ */
+
+typedef struct {
+	bibl      *b;      /* one of b or s holds the references */
+	biblstore *s;
+	FILE      *fp;
+	param     *p;
+	int       status;
+} bibl_output;
+
+static int
+bibl_output_check( bibl_output *o )
+{
+	if ( !o->b && !o->s ) return BIBL_ERR_BADINPUT;
+	if ( !o->p ) return BIBL_ERR_BADINPUT;
+	if ( !o->fp ) return BIBL_ERR_BADINPUT;
+	if ( bibl_illegaloutmode( o->p->writeformat ) ) return BIBL_ERR_BADINPUT;
+	if ( o->p->singlerefperfile ) return BIBL_ERR_BADINPUT;
+	return BIBL_OK;
+}
+
+static int
+bibl_output_getref( bibl_output *o, long i, fields *in )
+{
+	fields *ref;
+	int j;
+
+	if ( o->s ) return biblstore_getref( o->s, i, in );
+
+	ref = o->b->ref[i];
+	fields_empty( in );
+	for ( j=0; j<ref->n; ++j ) {
+		if ( _fields_add( in, str_cstr( &(ref->entries[j]->tag) ), str_cstr( &(ref->entries[j]->value) ),
+				str_cstr( &(ref->entries[j]->language) ), ref->entries[j]->level, FIELDS_CAN_DUP )!=FIELDS_OK )
+			return BIBL_ERR_MEMERR;
+	}
+
+	return BIBL_OK;
+}
+
+static void *
+bibl_output_write( void *arg )
+{
+	bibl_output *o = ( bibl_output * ) arg;
+	fields in, out, *use;
+	long i, n;
+	param lp;
+	int status;
+	sink s;
+
+	status = bibl_setwriteparams( &lp, o->p );
+	if ( status!=BIBL_OK ) {
+		o->status = status;
+		return NULL;
+	}
+
+	fields_init( &in );
+	fields_init( &out );
+
+	sink_init( &s, o->fp );
+
+	if ( lp.headerf ) lp.headerf( &s, &lp );
+
+	n = ( o->s ) ? o->s->n : o->b->n;
+	for ( i=0; i<n; ++i ) {
+
+		status = bibl_output_getref( o, i, &in );
+		if ( status!=BIBL_OK ) break;
+
+		status = bibl_fixcharsetdata( &in, &lp );
+		if ( status!=BIBL_OK ) break;
+
+		if ( lp.assemblef ) {
+			fields_empty( &out );
+			status = lp.assemblef( &in, &out, &lp, i );
+			if ( status!=BIBL_OK ) break;
+			use = &out;
+		} else {
+			use = &in;
+		}
+
+		status = lp.writef( use, &s, &lp, i );
+		status = bibl_sinkstatus( status, sink_status( &s ) );
+		if ( status!=BIBL_OK ) break;
+
+	}
+
+	if ( lp.footerf ) lp.footerf( &s );
+	status = bibl_sinkstatus( status, sink_free( &s ) );
+
+	fields_free( &in );
+	fields_free( &out );
+	bibl_freeworkparams( &lp );
+
+	o->status = status;
+
+	return NULL;
+}
+
+/* bibl_writestore()
+ *
+ * As bibl_write(), for references held in a biblstore, which is left
+ * unchanged. Single reference per file output is not supported here.
+ */
+int
+bibl_writestore( biblstore *s, FILE *fp, param *p )
+{
+	bibl_output o;
+
+	o.b  = NULL;
+	o.s  = s;
+	o.fp = fp;
+	o.p  = p;
+
+	o.status = bibl_output_check( &o );
+	if ( o.status==BIBL_OK ) bibl_output_write( &o );
+
+	return o.status;
+}
+
+#ifndef BIBL_NO_THREADS
+
+/* Concurrent outputs for bibl_writemany()
+ *
+ * Each worker claims the next unwritten output under the lock and
+ * writes all of it.
+ */
+
+typedef struct {
+	bibl_output *outs;
+	int         n, next;
+	pthread_mutex_t lock;
+} bibl_writemanyjob;
+
+static void *
+bibl_writemanyworker( void *arg )
+{
+	bibl_writemanyjob *job = ( bibl_writemanyjob * ) arg;
+	int k;
+
+	while ( 1 ) {
+		pthread_mutex_lock( &(job->lock) );
+		k = ( job->next < job->n ) ? job->next++ : -1;
+		pthread_mutex_unlock( &(job->lock) );
+		if ( k==-1 ) break;
+		bibl_output_write( &(job->outs[k]) );
+	}
+
+	return NULL;
+}
+
+/* bibl_writemany_threaded()
+ *
+ * Any outputs left when no more workers will start are written here.
+ */
+static void
+bibl_writemany_threaded( bibl_output *outs, int n, int nthreads )
+{
+	int i, started = 0;
+	bibl_writemanyjob job;
+	pthread_t *threads;
+
+	if ( nthreads > n ) nthreads = n;
+
+	job.outs = outs;
+	job.n    = n;
+	job.next = 0;
+
+	threads = ( pthread_t * ) malloc( sizeof( pthread_t ) * nthreads );
+	if ( threads ) {
+		pthread_mutex_init( &(job.lock), NULL );
+		for ( i=0; i<nthreads; ++i ) {
+			if ( pthread_create( &(threads[i]), NULL, bibl_writemanyworker, &job ) ) break;
+			started++;
+		}
+		for ( i=0; i<started; ++i )
+			pthread_join( threads[i], NULL );
+		pthread_mutex_destroy( &(job.lock) );
+		free( threads );
+	}
+
+	for ( i=job.next; i<n; ++i )
+		bibl_output_write( &(outs[i]) );
+}
+
+#endif
+
+/* bibl_writemany()
+ *
+ * Write b to each of the n outputs fps[k] with ps[k], so one read can
+ * feed several formats and charsets. b is not changed. If nthreads is
+ * above one, up to nthreads outputs are written at once. Returns the
+ * first error among the outputs.
+ */
+int
+bibl_writemany( bibl *b, int n, FILE *fps[], param *ps[], int nthreads )
+{
+	int k, status = BIBL_OK;
+	bibl_output *outs;
+
+	if ( !b || n<1 || !fps || !ps ) return BIBL_ERR_BADINPUT;
+
+	outs = ( bibl_output * ) malloc( sizeof( bibl_output ) * n );
+	if ( !outs ) return BIBL_ERR_MEMERR;
+
+	for ( k=0; k<n; ++k ) {
+		outs[k].b  = b;
+		outs[k].s  = NULL;
+		outs[k].fp = fps[k];
+		outs[k].p  = ps[k];
+		outs[k].status = bibl_output_check( &(outs[k]) );
+		if ( outs[k].status!=BIBL_OK ) {
+			free( outs );
+			return BIBL_ERR_BADINPUT;
+		}
+	}
+
+#ifndef BIBL_NO_THREADS
+	if ( nthreads > 1 && n > 1 ) bibl_writemany_threaded( outs, n, nthreads );
+	else
+#endif
+	for ( k=0; k<n; ++k )
+		bibl_output_write( &(outs[k]) );
+
+	for ( k=0; k<n && status==BIBL_OK; ++k )
+		status = outs[k].status;
+
+	free( outs );
+
+	return status;
+}
+
+/* Incremental conversion
+ *
+ * bibl_convertinc() writes the same output as reading its inputs into
+ * one bibl with bibl_read() and writing that with bibl_write(), but
+ * takes references whose records have not changed since the run that
+ * made the cache old from there: their output is copied, or rewritten
+ * from their saved fields if their citekey has to change, without
+ * parsing the record again.
+ *
+ * A record is fingerprinted by its text, the charset state it is
+ * processed and converted with, and the text of every record before it
+ * that was not a reference, as a BibTeX @STRING can change any record
+ * after it. Citekeys are made unique over all of the references as
+ * bibl_read() does, from the key kept for each. Inputs that need more
+ * than one record to convert a reference (crossrefs), or whose first
+ * REFNUM is not at the main level, are converted in full and leave
+ * nothing in the next cache.
+ */
+
+#define BIBL_INC_FULL (1)   /* internal status: convert in full */
+
+typedef struct {
+	int charsetin;
+	unsigned char charsetin_src, utf8in;
+} bibl_incstate;
+
+typedef struct {
+	uint64_t hash;
+	long     entry;    /* in the old cache, or -1 if converted here */
+	fields   *ref;     /* converted reference, if entry is -1 */
+} bibl_incslot;
+
+typedef struct {
+	biblinc      *old, *next;
+	int          makerefid;
+	uint64_t     ctx;        /* of the records so far that were not references */
+	bibl_incslot *slot;
+	long         n, max;
+	intlist      haskey;
+	slist        readkeys;   /* REFNUM read, author-year key, or "" */
+	slist        keys;       /* citekeys as made unique so far */
+	long         nreused;
+} bibl_incjob;
+
+/* bibl_incsettings()
+ *
+ * Fingerprint of the options that change the output, with the cache
+ * and library versions standing in for the converters themselves.
+ */
+static uint64_t
+bibl_incsettings( param *p )
+{
+	int v[18], i;
+	uint64_t h;
+
+	v[0]  = p->readformat;
+	v[1]  = p->writeformat;
+	v[2]  = p->charsetin;
+	v[3]  = p->charsetin_src;
+	v[4]  = p->latexin;
+	v[5]  = p->utf8in;
+	v[6]  = p->xmlin;
+	v[7]  = p->nosplittitle;
+	v[8]  = p->charsetout;
+	v[9]  = p->charsetout_src;
+	v[10] = p->latexout;
+	v[11] = p->utf8out;
+	v[12] = p->utf8bom;
+	v[13] = p->xmlout;
+	v[14] = p->format_opts;
+	v[15] = p->addcount;
+	v[16] = p->output_raw;
+	v[17] = BIBLINC_VERSION;
+
+	h = calculate_hash64( HASH64_INIT, v, sizeof( v ) );
+	h = calculate_hash64( h, CURR_VERSION, sizeof( CURR_VERSION ) );
+
+	for ( i=0; i<p->asis.names.n; ++i )
+		h = calculate_hash64( h, slist_cstr( &(p->asis.names), i ), slist_str( &(p->asis.names), i )->len + 1 );
+	h = calculate_hash64( h, "", 1 );
+	for ( i=0; i<p->corps.names.n; ++i )
+		h = calculate_hash64( h, slist_cstr( &(p->corps.names), i ), slist_str( &(p->corps.names), i )->len + 1 );
+
+	return h;
+}
+
+static uint64_t
+bibl_inchash( uint64_t ctx, uint64_t text, bibl_incstate *read, bibl_incstate *final )
+{
+	int v[6];
+	uint64_t h;
+
+	v[0] = read->charsetin;
+	v[1] = read->charsetin_src;
+	v[2] = read->utf8in;
+	v[3] = final->charsetin;
+	v[4] = final->charsetin_src;
+	v[5] = final->utf8in;
+
+	h = calculate_hash64( ctx, &text, sizeof( text ) );
+	return calculate_hash64( h, v, sizeof( v ) );
+}
+
+static void
+bibl_incgetstate( param *p, bibl_incstate *s )
+{
+	s->charsetin     = p->charsetin;
+	s->charsetin_src = p->charsetin_src;
+	s->utf8in        = p->utf8in;
+}
+
+static void
+bibl_incsetstate( param *p, bibl_incstate *s )
+{
+	p->charsetin     = s->charsetin;
+	p->charsetin_src = s->charsetin_src;
+	p->utf8in        = s->utf8in;
+}
+
+static int
+bibl_incaddslot( bibl_incjob *job, uint64_t hash, long entry, fields *ref, int haskey, const char *key )
+{
+	bibl_incslot *more;
+	long alloc;
+
+	if ( job->n == job->max ) {
+		alloc = ( job->max ) ? job->max * 2 : 1024;
+		more = ( bibl_incslot * ) realloc( job->slot, sizeof( bibl_incslot ) * alloc );
+		if ( !more ) return BIBL_ERR_MEMERR;
+		job->slot = more;
+		job->max  = alloc;
+	}
+
+	if ( intlist_add( &(job->haskey), haskey )!=INTLIST_OK ) return BIBL_ERR_MEMERR;
+	if ( slist_addc( &(job->readkeys), key )!=SLIST_OK ) return BIBL_ERR_MEMERR;
+
+	job->slot[ job->n ].hash  = hash;
+	job->slot[ job->n ].entry = entry;
+	job->slot[ job->n ].ref   = ref;
+	job->n++;
+
+	return BIBL_OK;
+}
+
+/* bibl_incconvert()
+ *
+ * Take the record just processed into *ref through the rest of
+ * bibl_read(), one reference at a time.
+ */
+static int
+bibl_incconvert( fields **ref, bibl *one, char *filename, long nref, param *p, reftype_adds *adds )
+{
+	int reftype = 0, status = BIBL_OK;
+	fields *out;
+
+	if ( !p->output_raw && p->cleanf ) {
+		if ( fields_find( *ref, "CROSSREF", LEVEL_ANY )!=FIELDS_NOTFOUND ) return BIBL_INC_FULL;
+		status = bibl_addref( one, *ref );
+		if ( status!=BIBL_OK ) return status;
+		status = p->cleanf( one, p );
+		one->n = 0;
+		if ( status!=BIBL_OK ) return status;
+	}
+
+	if ( !p->output_raw || ( p->output_raw & BIBL_RAW_WITHCHARCONVERT ) ) {
+		status = bibl_fixcharsetdata( *ref, p );
+		if ( status!=BIBL_OK ) return status;
+	}
+
+	if ( !p->output_raw ) {
+		out = fields_new();
+		if ( !out ) return BIBL_ERR_MEMERR;
+		if ( p->typef ) reftype = p->typef( *ref, filename, nref, p );
+		status = p->convertf( *ref, out, reftype, p );
+		if ( status==BIBL_OK && adds ) {
+			status = process_alwaysadd( out, &(adds[reftype]) );
+			if ( status==BIBL_OK )
+				status = process_defaultadd( out, &(adds[reftype]) );
+		}
+	} else {
+		out = fields_dupl( *ref );
+		if ( !out ) return BIBL_ERR_MEMERR;
+	}
+
+	if ( status!=BIBL_OK ) {
+		fields_delete( out );
+		return status;
+	}
+
+	fields_delete( *ref );
+	*ref = out;
+
+	return BIBL_OK;
+}
+
+/* bibl_inckey()
+ *
+ * Find the key ref is read with: its REFNUM, else its author-year key,
+ * else "" for the "ref#" key given by position. Returns BIBL_INC_FULL
+ * if uniqueify_citekeys() and bibl_addcount() would not change the
+ * same REFNUM, at the main level.
+ */
+static int
+bibl_inckey( fields *ref, int *haskey, str *key )
+{
+	int n;
+
+	n = fields_find( ref, "REFNUM", LEVEL_ANY );
+
+	if ( n!=FIELDS_NOTFOUND ) {
+		if ( fields_level( ref, n )!=LEVEL_MAIN ) return BIBL_INC_FULL;
+		*haskey = 1;
+		str_strcpy( key, fields_value( ref, n, FIELDS_STRP_NOUSE ) );
+	} else {
+		*haskey = 0;
+		if ( authoryear_citekey( ref, key ) && key->len==0 ) return BIBL_INC_FULL;
+	}
+
+	return ( str_memerr( key ) ) ? BIBL_ERR_MEMERR : BIBL_OK;
+}
+
+/* bibl_inckeys()
+ *
+ * Give the references from slot first on their keys, and make all the
+ * keys unique, as uniqueify_citekeys() and bibl_addcount() do after
+ * each bibl_read().
+ */
+static int
+bibl_inckeys( bibl_incjob *job, long first, param *p )
+{
+	char buf[512];
+	long i;
+	int status;
+
+	for ( i=first; i<job->n; ++i ) {
+		if ( intlist_get( &(job->haskey), i ) || slist_str( &(job->readkeys), i )->len )
+			status = slist_add( &(job->keys), slist_str( &(job->readkeys), i ) );
+		else {
+			sprintf( buf, "ref%ld", i+1 );
+			status = slist_addc( &(job->keys), buf );
+		}
+		if ( status!=SLIST_OK ) return BIBL_ERR_MEMERR;
+	}
+
+	status = identify_and_resolve_duplicate_citekeys( NULL, &(job->keys) );
+	if ( status!=BIBL_OK ) return status;
+
+	if ( p->addcount ) {
+		for ( i=0; i<job->n; ++i ) {
+			sprintf( buf, "_%ld", i+1 );
+			str_strcatc( slist_str( &(job->keys), i ), buf );
+			if ( str_memerr( slist_str( &(job->keys), i ) ) ) return BIBL_ERR_MEMERR;
+		}
+	}
+
+	return BIBL_OK;
+}
+
+/* bibl_incread()
+ *
+ * Frame all of the records of buf first, to know the charset state
+ * that bibl_read() converts them with, then process those not in the
+ * old cache.
+ */
+static int
+bibl_incread( bibl_incjob *job, const char *buf, unsigned long len, char *filename, param *p )
+{
+	int bufpos = 0, fcharset, haskey, isref, status = BIBL_OK;
+	bibl_incstate *state = NULL, *more, final;
+	long i, n = 0, max = 0, nref = 0, first = job->n, e;
+	reftype_adds *adds = NULL;
+	str reference, line, key;
+	char rbuf[256]="";
+	uint64_t text, h;
+	biblinc_ref r;
+	slist records;
+	fields *ref;
+	source src;
+	param rp;
+	bibl one;
+
+	status = bibl_setreadparams( &rp, p );
+	if ( status!=BIBL_OK ) return status;
+
+	strs_init( &reference, &line, &key, NULL );
+	slist_init( &records );
+	bibl_init( &one );
+
+	source_init_mem( &src, buf, len );
+
+	while ( rp.readf( &src, rbuf, sizeof(rbuf), &bufpos, &line, &reference, &fcharset ) ) {
+		if ( reference.len==0 ) continue;
+		if ( n == max ) {
+			max = ( max ) ? max * 2 : 1024;
+			more = ( bibl_incstate * ) realloc( state, sizeof( bibl_incstate ) * max );
+			if ( !more ) { status = BIBL_ERR_MEMERR; goto out; }
+			state = more;
+		}
+		bibl_incgetstate( &rp, &(state[n++]) );
+		if ( slist_add( &records, &reference )!=SLIST_OK ) { status = BIBL_ERR_MEMERR; goto out; }
+		str_empty( &reference );
+		if ( fcharset!=CHARSET_UNKNOWN ) {
+			if ( rp.charsetin_src!=BIBL_SRC_USER ) {
+				rp.charsetin_src = BIBL_SRC_FILE;
+				rp.charsetin = fcharset;
+				if ( fcharset!=CHARSET_UNICODE ) rp.utf8in = 0;
+			}
+		}
+	}
+	if ( rp.charsetin==CHARSET_UNICODE ) rp.utf8in = 1;
+	bibl_incgetstate( &rp, &final );
+
+	if ( rp.all && !rp.output_raw ) {
+		status = reftype_adds_build( &adds, &rp );
+		if ( status!=BIBL_OK ) goto out;
+	}
+
+	for ( i=0; i<n; ++i ) {
+
+		text = calculate_hash64( HASH64_INIT, slist_cstr( &records, i ), slist_str( &records, i )->len );
+		h = bibl_inchash( job->ctx, text, &(state[i]), &final );
+
+		e = ( job->old ) ? biblinc_find( job->old, h ) : -1;
+		if ( e!=-1 ) {
+			biblinc_get( job->old, e, &r );
+			status = bibl_incaddslot( job, h, e, NULL, r.haskey, r.key );
+			if ( status!=BIBL_OK ) goto out;
+			nref++;
+			continue;
+		}
+
+		ref = fields_new();
+		if ( !ref ) { status = BIBL_ERR_MEMERR; goto out; }
+
+		bibl_incsetstate( &rp, &(state[i]) );
+		isref = rp.processf( ref, slist_cstr( &records, i ), filename, nref+1, &rp );
+		bibl_incsetstate( &rp, &final );
+
+		if ( !isref ) {
+			fields_delete( ref );
+			job->ctx = calculate_hash64( job->ctx, &text, sizeof( text ) );
+			continue;
+		}
+		nref++;
+
+		status = bibl_incconvert( &ref, &one, filename, nref, &rp, adds );
+
+		haskey = 0;
+		str_empty( &key );
+		if ( status==BIBL_OK && job->makerefid )
+			status = bibl_inckey( ref, &haskey, &key );
+
+		if ( status==BIBL_OK )
+			status = bibl_incaddslot( job, h, -1, ref, haskey, str_cstr( &key ) ? str_cstr( &key ) : "" );
+
+		if ( status!=BIBL_OK ) {
+			fields_delete( ref );
+			goto out;
+		}
+	}
+
+	if ( job->makerefid ) status = bibl_inckeys( job, first, &rp );
+
+out:
+	if ( state ) free( state );
+	reftype_adds_free( adds, rp.nall );
+	bibl_free( &one );
+	slist_free( &records );
+	strs_free( &reference, &line, &key, NULL );
+	bibl_freeworkparams( &rp );
+
+	return status;
+}
+
+static int
+bibl_inccopyfields( fields *to, fields *from )
+{
+	fields_entry *e;
+	int i;
+
+	for ( i=0; i<from->n; ++i ) {
+		e = from->entries[i];
+		if ( _fields_add( to, e->tag.len ? str_cstr( &(e->tag) ) : "", e->value.len ? str_cstr( &(e->value) ) : "",
+				e->language.len ? str_cstr( &(e->language) ) : NULL, e->level, FIELDS_CAN_DUP )!=FIELDS_OK )
+			return BIBL_ERR_MEMERR;
+	}
+
+	return BIBL_OK;
+}
+
+/* bibl_incwriteref()
+ *
+ * Write slot i from its fields ref, converted but without its final
+ * citekey, and add it to the next cache.
+ */
+static int
+bibl_incwriteref( bibl_incjob *job, long i, fields *ref, int haskey, const char *key,
+		sink *out, str *buf, param *lp )
+{
+	fields use, assembled, *w;
+	const char *finalkey = "";
+	int n, status;
+	sink mem;
+
+	fields_init( &use );
+	fields_init( &assembled );
+	str_empty( buf );
+
+	status = bibl_inccopyfields( &use, ref );
 	if ( status!=BIBL_OK ) goto out;
 
-	if ( debug_set( p ) ) bibl_verbose( b, "post-fixcharsets", "for bibl_write" );
+	if ( job->makerefid ) {
+		finalkey = slist_cstr( &(job->keys), i );
+		n = fields_find( &use, "REFNUM", LEVEL_ANY );
+		if ( haskey && n!=FIELDS_NOTFOUND ) {
+			str_strcpyc( fields_value( &use, n, FIELDS_STRP_NOUSE ), finalkey );
+			if ( str_memerr( fields_value( &use, n, FIELDS_STRP_NOUSE ) ) ) { status = BIBL_ERR_MEMERR; goto out; }
+		} else if ( fields_add( &use, "REFNUM", finalkey, LEVEL_MAIN )!=FIELDS_OK ) {
+			status = BIBL_ERR_MEMERR;
+			goto out;
+		}
+	}
+
+	status = bibl_fixcharsetdata( &use, lp );
+	if ( status!=BIBL_OK ) goto out;
+
+	w = &use;
+	if ( lp->assemblef ) {
+		status = lp->assemblef( &use, &assembled, lp, i );
+		if ( status!=BIBL_OK ) goto out;
+		w = &assembled;
+	}
 
-	if ( p->singlerefperfile ) status = bibl_writeeachfp( fp, b, &lp );
-	else status = bibl_writefp( fp, b, &lp );
+	sink_init_str( &mem, buf );
+	status = lp->writef( w, &mem, lp, i );
+	status = bibl_sinkstatus( status, sink_free( &mem ) );
+	if ( status!=BIBL_OK ) goto out;
+
+	status = biblinc_add( job->next, job->slot[i].hash, haskey, key, finalkey, ref, buf->data, buf->len );
+	if ( status!=BIBL_OK ) goto out;
 
+	if ( buf->len ) sink_write( out, buf->data, buf->len );
 out:
-	bibl_freeparams( &lp );
+	fields_free( &use );
+	fields_free( &assembled );
+	return status;
+}
+
+static int
+bibl_incwrite( bibl_incjob *job, sink *out, param *p )
+{
+	const char *finalkey;
+	int status, haskey;
+	biblinc_ref r;
+	fields *ref;
+	param lp;
+	long i;
+	str buf;
+
+	status = bibl_setwriteparams( &lp, p );
+	if ( status!=BIBL_OK ) return status;
+
+	str_init( &buf );
+
+	if ( lp.headerf ) lp.headerf( out, &lp );
+
+	for ( i=0; i<job->n; ++i ) {
+
+		if ( job->slot[i].entry==-1 ) {
+			status = bibl_incwriteref( job, i, job->slot[i].ref, intlist_get( &(job->haskey), i ),
+					slist_cstr( &(job->readkeys), i ), out, &buf, &lp );
+			if ( status!=BIBL_OK ) break;
+			continue;
+		}
+
+		biblinc_get( job->old, job->slot[i].entry, &r );
+
+		finalkey = ( job->makerefid ) ? slist_cstr( &(job->keys), i ) : "";
+		if ( !strcmp( r.finalkey, finalkey ) ) {
+			sink_write( out, r.output, r.outlen );
+			status = biblinc_addcopy( job->next, job->old, job->slot[i].entry, job->slot[i].hash );
+			if ( status!=BIBL_OK ) break;
+			job->nreused++;
+			continue;
+		}
+
+		ref = fields_new();
+		if ( !ref ) { status = BIBL_ERR_MEMERR; break; }
+		haskey = r.haskey;
+		status = biblinc_getfields( &r, ref );
+		if ( status==BIBL_OK )
+			status = bibl_incwriteref( job, i, ref, haskey, r.key, out, &buf, &lp );
+		fields_delete( ref );
+		if ( status!=BIBL_OK ) break;
+		job->nreused++;
+	}
+
+	if ( lp.footerf ) lp.footerf( out );
+
+	status = bibl_sinkstatus( status, sink_status( out ) );
+
+	str_free( &buf );
+	bibl_freeworkparams( &lp );
+
+	return status;
+}
+
+static void
+bibl_incfree( bibl_incjob *job )
+{
+	long i;
+
+	for ( i=0; i<job->n; ++i )
+		if ( job->slot[i].ref ) fields_delete( job->slot[i].ref );
+	if ( job->slot ) free( job->slot );
+
+	intlist_free( &(job->haskey) );
+	slist_free( &(job->readkeys) );
+	slist_free( &(job->keys) );
+}
+
+static int
+bibl_convertfull( int n, const char *bufs[], unsigned long lens[], char *filenames[],
+		sink *out, param *p, long *nrefs )
+{
+	int k, status = BIBL_OK;
+	bibl b;
+
+	bibl_init( &b );
+
+	for ( k=0; k<n && status==BIBL_OK; ++k )
+		status = bibl_read_mem( &b, bufs[k], lens[k], filenames[k], p );
+
+	if ( status==BIBL_OK ) status = bibl_writeout( &b, out, p );
+
+	if ( nrefs ) *nrefs = b.n;
+
+	bibl_free( &b );
+
+	return status;
+}
+
+/* bibl_convertinc()
+ *
+ * Convert the n inputs bufs[k][0..lens[k]), named filenames[k], to fp
+ * with p, taking what it can from old, which may be NULL, and filling
+ * next for the next run. nrefs and nreused, if not NULL, are set to
+ * the number of references written and of those taken from old.
+ * Single reference per file output is not supported here.
+ */
+int
+bibl_convertinc( int n, const char *bufs[], unsigned long lens[], char *filenames[], FILE *fp,
+		biblinc *old, biblinc *next, param *p, long *nrefs, long *nreused )
+{
+	int k, status = BIBL_OK;
+	bibl_incjob job;
+	uint64_t settings;
+	sink out;
+
+	if ( n<0 || ( n && ( !bufs || !lens || !filenames ) ) ) return BIBL_ERR_BADINPUT;
+	if ( !fp || !next || !p ) return BIBL_ERR_BADINPUT;
+	if ( bibl_illegalinmode( p->readformat ) ) return BIBL_ERR_BADINPUT;
+	if ( bibl_illegaloutmode( p->writeformat ) ) return BIBL_ERR_BADINPUT;
+	if ( p->singlerefperfile ) return BIBL_ERR_BADINPUT;
+
+	settings = bibl_incsettings( p );
+
+	biblinc_free( next );
+	next->settings = settings;
+
+	job.old       = ( old && old->settings==settings ) ? old : NULL;
+	job.next      = next;
+	job.makerefid = !p->output_raw || ( p->output_raw & BIBL_RAW_WITHMAKEREFID );
+	job.ctx       = HASH64_INIT;
+	job.slot      = NULL;
+	job.n         = job.max = 0;
+	job.nreused   = 0;
+	intlist_init( &(job.haskey) );
+	slist_init( &(job.readkeys) );
+	slist_init( &(job.keys) );
+
+	for ( k=0; k<n && status==BIBL_OK; ++k ) {
+		if ( !bufs[k] && lens[k] ) status = BIBL_ERR_BADINPUT;
+		else status = bibl_incread( &job, bufs[k], lens[k], filenames[k], p );
+	}
+
+	sink_init( &out, fp );
+
+	if ( status==BIBL_OK ) {
+		status = bibl_incwrite( &job, &out, p );
+		if ( nrefs ) *nrefs = job.n;
+		if ( nreused ) *nreused = job.nreused;
+	} else if ( status==BIBL_INC_FULL ) {
+		status = bibl_convertfull( n, bufs, lens, filenames, &out, p, nrefs );
+		if ( nreused ) *nreused = 0;
+	}
+
+	status = bibl_sinkstatus( status, sink_free( &out ) );
+
+	bibl_incfree( &job );
+
+	if ( status!=BIBL_OK ) {
+		biblinc_free( next );
+		next->settings = settings;
+	}
+
 	return status;
 }
@@ -0,0 +1,545 @@
+/*
+ * bibindex.c
+ *
+ * Copyright (c) Chris Putnam 2021
+ *
+ * Source code released under the GPL version 2
+ *
+ * Saved indices use unsigned 32-bit little-endian integers, with 64-bit
+ * offsets as two of them, low word first:
+ *
+ *    "BIBINDEX" version format size(2) charset nrecs nkeys poolsize
+ *    nrecs x { start(2) len(2) isref }
+ *    nkeys x { rec type key }            key is a pool offset
+ *    pool                                the keys, '\0'-ended
+ *
+ * charset is in two's complement, so that CHARSET_UNKNOWN survives.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <limits.h>
+#include "bibindex.h"
+
+#define BIBINDEX_MAGIC    "BIBINDEX"
+#define BIBINDEX_MAGICLEN (8)
+#define BIBINDEX_VERSION  (1)
+#define BIBINDEX_HEADER   (BIBINDEX_MAGICLEN+8*4)
+
+void
+bibindex_init( bibindex *x )
+{
+	x->size    = 0;
+	x->format  = 0;
+	x->charset = CHARSET_UNKNOWN;
+	x->n       = x->max = 0;
+	x->start   = NULL;
+	x->len     = NULL;
+	x->isref   = NULL;
+	slist_init( &(x->keys) );
+	intlist_init( &(x->keyrec) );
+	intlist_init( &(x->keytype) );
+	intlist_init( &(x->keynext) );
+	strhash_init( &(x->index), STRHASH_NOCASE );
+}
+
+void
+bibindex_free( bibindex *x )
+{
+	if ( x->start ) free( x->start );
+	if ( x->len )   free( x->len );
+	if ( x->isref ) free( x->isref );
+	slist_free( &(x->keys) );
+	intlist_free( &(x->keyrec) );
+	intlist_free( &(x->keytype) );
+	intlist_free( &(x->keynext) );
+	strhash_free( &(x->index) );
+	bibindex_init( x );
+}
+
+static int
+bibindex_growrecs( bibindex *x, long alloc )
+{
+	unsigned long *start, *len;
+	unsigned char *isref;
+
+	start = ( unsigned long * ) realloc( x->start, sizeof( unsigned long ) * alloc );
+	if ( !start ) return BIBL_ERR_MEMERR;
+	x->start = start;
+
+	len = ( unsigned long * ) realloc( x->len, sizeof( unsigned long ) * alloc );
+	if ( !len ) return BIBL_ERR_MEMERR;
+	x->len = len;
+
+	isref = ( unsigned char * ) realloc( x->isref, sizeof( unsigned char ) * alloc );
+	if ( !isref ) return BIBL_ERR_MEMERR;
+	x->isref = isref;
+
+	x->max = alloc;
+
+	return BIBL_OK;
+}
+
+static int
+bibindex_addrec( bibindex *x, unsigned long start, unsigned long len, int isref )
+{
+	int status;
+
+	if ( x->n == x->max ) {
+		if ( x->n >= INT_MAX ) return BIBL_ERR_MEMERR;
+		status = bibindex_growrecs( x, ( x->max ) ? x->max * 2 : 1024 );
+		if ( status!=BIBL_OK ) return status;
+	}
+
+	x->start[ x->n ] = start;
+	x->len[ x->n ]   = len;
+	x->isref[ x->n ] = ( isref!=0 );
+	x->n++;
+
+	return BIBL_OK;
+}
+
+static int
+bibindex_addkey( bibindex *x, const char *key, long rec, int type )
+{
+	if ( slist_addc( &(x->keys), key )!=SLIST_OK ) return BIBL_ERR_MEMERR;
+	if ( intlist_add( &(x->keyrec), rec )!=INTLIST_OK ) return BIBL_ERR_MEMERR;
+	if ( intlist_add( &(x->keytype), type )!=INTLIST_OK ) return BIBL_ERR_MEMERR;
+	return BIBL_OK;
+}
+
+/* bibindex_hash()
+ *
+ * Index the keys and chain those with the same string in key order.
+ */
+static int
+bibindex_hash( bibindex *x )
+{
+	int k, head;
+
+	strhash_empty( &(x->index) );
+	intlist_empty( &(x->keynext) );
+	if ( x->keys.n==0 ) return BIBL_OK;
+	if ( intlist_fill( &(x->keynext), x->keys.n, -1 )!=INTLIST_OK ) return BIBL_ERR_MEMERR;
+
+	for ( k=x->keys.n-1; k>=0; --k ) {
+		head = strhash_find( &(x->index), slist_cstr( &(x->keys), k ) );
+		intlist_set( &(x->keynext), k, head );
+		if ( strhash_set( &(x->index), slist_cstr( &(x->keys), k ), k )!=STRHASH_OK )
+			return BIBL_ERR_MEMERR;
+	}
+
+	return BIBL_OK;
+}
+
+/*****************************************************
+ PUBLIC: int bibindex_build()
+*****************************************************/
+
+static struct {
+	char *tag;
+	int  type;
+} bibindex_tags[] = {
+	{ "REFNUM", BIBINDEX_CITEKEY },
+	{ "DOI",    BIBINDEX_DOI     },
+	{ "PMID",   BIBINDEX_PMID    },
+};
+
+static int
+bibindex_scanned( long nrec, unsigned long start, unsigned long len, fields *ref, void *arg )
+{
+	bibindex *x = ( bibindex * ) arg;
+	int i, j, status;
+	const char *value;
+
+	status = bibindex_addrec( x, start, len, ( ref!=NULL ) );
+	if ( status!=BIBL_OK || !ref ) return status;
+
+	for ( i=0; i<ref->n; ++i ) {
+		for ( j=0; j<sizeof( bibindex_tags ) / sizeof( bibindex_tags[0] ); ++j ) {
+			if ( bibindex_tags[j].type==BIBINDEX_CITEKEY && fields_level( ref, i )!=LEVEL_MAIN ) continue;
+			if ( strcasecmp( fields_tag( ref, i, FIELDS_CHRP_NOUSE ), bibindex_tags[j].tag ) ) continue;
+			value = fields_value( ref, i, FIELDS_CHRP_NOUSE );
+			if ( !value || value[0]=='\0' ) continue;
+			status = bibindex_addkey( x, value, nrec, bibindex_tags[j].type );
+			if ( status!=BIBL_OK ) return status;
+		}
+	}
+
+	return BIBL_OK;
+}
+
+static int
+bibindex_built( bibindex *x, int status, unsigned long size, param *p )
+{
+	if ( status==BIBL_OK ) status = bibindex_hash( x );
+	if ( status==BIBL_OK ) {
+		x->size   = size;
+		x->format = p->readformat;
+	} else bibindex_free( x );
+
+	return status;
+}
+
+/* bibindex_build()
+ *
+ * Index the len bytes of buf, the whole of the file filename, read
+ * with p->readformat. Any earlier contents of x are replaced.
+ */
+int
+bibindex_build( bibindex *x, const char *buf, unsigned long len, char *filename, param *p )
+{
+	int status;
+
+	if ( !x ) return BIBL_ERR_BADINPUT;
+
+	bibindex_free( x );
+
+	status = bibl_scan( buf, len, filename, p, &(x->charset), bibindex_scanned, x );
+
+	return bibindex_built( x, status, len, p );
+}
+
+/* bibindex_buildfile()
+ *
+ * As bibindex_build(), scanning the file filename as it is read rather
+ * than holding all of it.
+ */
+int
+bibindex_buildfile( bibindex *x, char *filename, param *p )
+{
+	unsigned long size = 0;
+	int status;
+	long end;
+	FILE *fp;
+
+	if ( !x || !filename ) return BIBL_ERR_BADINPUT;
+
+	fp = fopen( filename, "rb" );
+	if ( !fp ) return BIBL_ERR_CANTOPEN;
+
+	bibindex_free( x );
+
+	status = bibl_scanfile( fp, filename, p, &(x->charset), bibindex_scanned, x );
+	if ( status==BIBL_OK ) {
+		/* bibindex_read() checks the file against this */
+		end = ( fseek( fp, 0, SEEK_END ) ) ? -1 : ftell( fp );
+		if ( end < 0 ) status = BIBL_ERR_CANTOPEN;
+		else size = end;
+	}
+	fclose( fp );
+
+	return bibindex_built( x, status, size, p );
+}
+
+/*****************************************************
+ PUBLIC: int bibindex_save()
+*****************************************************/
+
+static void
+bibindex_put( FILE *fp, unsigned int v )
+{
+	putc( v & 0xff, fp );
+	putc( ( v >> 8 ) & 0xff, fp );
+	putc( ( v >> 16 ) & 0xff, fp );
+	putc( ( v >> 24 ) & 0xff, fp );
+}
+
+static void
+bibindex_put2( FILE *fp, unsigned long v )
+{
+	bibindex_put( fp, v & 0xffffffffUL );
+	bibindex_put( fp, ( v >> 16 ) >> 16 );
+}
+
+int
+bibindex_save( bibindex *x, FILE *fp )
+{
+	unsigned long pool = 0;
+	long i;
+	int k;
+
+	if ( !x || !fp ) return BIBL_ERR_BADINPUT;
+
+	for ( k=0; k<x->keys.n; ++k ) {
+		pool += slist_str( &(x->keys), k )->len + 1;
+		if ( pool > INT_MAX ) return BIBL_ERR_MEMERR;
+	}
+
+	fwrite( BIBINDEX_MAGIC, 1, BIBINDEX_MAGICLEN, fp );
+	bibindex_put( fp, BIBINDEX_VERSION );
+	bibindex_put( fp, x->format );
+	bibindex_put2( fp, x->size );
+	bibindex_put( fp, ( unsigned int ) x->charset );
+	bibindex_put( fp, x->n );
+	bibindex_put( fp, x->keys.n );
+	bibindex_put( fp, pool );
+
+	for ( i=0; i<x->n; ++i ) {
+		bibindex_put2( fp, x->start[i] );
+		bibindex_put2( fp, x->len[i] );
+		bibindex_put( fp, x->isref[i] );
+	}
+
+	pool = 0;
+	for ( k=0; k<x->keys.n; ++k ) {
+		bibindex_put( fp, intlist_get( &(x->keyrec), k ) );
+		bibindex_put( fp, intlist_get( &(x->keytype), k ) );
+		bibindex_put( fp, pool );
+		pool += slist_str( &(x->keys), k )->len + 1;
+	}
+
+	for ( k=0; k<x->keys.n; ++k )
+		fwrite( slist_cstr( &(x->keys), k ), 1, slist_str( &(x->keys), k )->len + 1, fp );
+
+	if ( fflush( fp ) || ferror( fp ) ) return BIBL_ERR_CANTOPEN;
+
+	return BIBL_OK;
+}
+
+/*****************************************************
+ PUBLIC: int bibindex_load()
+*****************************************************/
+
+static unsigned int
+bibindex_get( const unsigned char *p )
+{
+	return ( unsigned int ) p[0] | ( ( unsigned int ) p[1] << 8 ) |
+		( ( unsigned int ) p[2] << 16 ) | ( ( unsigned int ) p[3] << 24 );
+}
+
+static unsigned long
+bibindex_get2( const unsigned char *p )
+{
+	return ( unsigned long ) bibindex_get( p ) | ( ( ( unsigned long ) bibindex_get( p + 4 ) << 16 ) << 16 );
+}
+
+/* bibindex_check()
+ *
+ * Check every count and offset of the saved index in buf, so that
+ * loading cannot fail part way through except for lack of memory.
+ */
+static int
+bibindex_check( const unsigned char *buf, unsigned long len )
+{
+	unsigned long size, start, slen, left, i;
+	unsigned int nrecs, nkeys, pool;
+	const unsigned char *recs, *keys;
+	const char *strs;
+
+	if ( len < BIBINDEX_HEADER ) return BIBL_ERR_BADINPUT;
+	if ( memcmp( buf, BIBINDEX_MAGIC, BIBINDEX_MAGICLEN ) ) return BIBL_ERR_BADINPUT;
+	if ( bibindex_get( buf + 8 )!=BIBINDEX_VERSION ) return BIBL_ERR_BADINPUT;
+
+	size  = bibindex_get2( buf + 16 );
+	nrecs = bibindex_get( buf + 28 );
+	nkeys = bibindex_get( buf + 32 );
+	pool  = bibindex_get( buf + 36 );
+
+	left = len - BIBINDEX_HEADER;
+	if ( nrecs > INT_MAX || nrecs > left / 20 ) return BIBL_ERR_BADINPUT;
+	left -= nrecs * 20UL;
+	if ( nkeys > INT_MAX || nkeys > left / 12 ) return BIBL_ERR_BADINPUT;
+	left -= nkeys * 12UL;
+	if ( pool != left ) return BIBL_ERR_BADINPUT;
+
+	recs = buf + BIBINDEX_HEADER;
+	keys = recs + nrecs * 20UL;
+	strs = ( const char * ) ( keys + nkeys * 12UL );
+
+	if ( pool && strs[ pool - 1 ]!='\0' ) return BIBL_ERR_BADINPUT;
+
+	for ( i=0; i<nrecs; ++i ) {
+		start = bibindex_get2( recs + i*20 );
+		slen  = bibindex_get2( recs + i*20 + 8 );
+		if ( start > size || slen > size - start ) return BIBL_ERR_BADINPUT;
+		if ( bibindex_get( recs + i*20 + 16 ) > 1 ) return BIBL_ERR_BADINPUT;
+	}
+
+	for ( i=0; i<nkeys; ++i ) {
+		if ( bibindex_get( keys + i*12 ) >= nrecs ) return BIBL_ERR_BADINPUT;
+		if ( bibindex_get( keys + i*12 + 4 ) > BIBINDEX_PMID ) return BIBL_ERR_BADINPUT;
+		if ( bibindex_get( keys + i*12 + 8 ) >= pool ) return BIBL_ERR_BADINPUT;
+	}
+
+	return BIBL_OK;
+}
+
+static int
+bibindex_fill( bibindex *x, const unsigned char *buf )
+{
+	const unsigned char *recs, *keys;
+	unsigned int nrecs, nkeys, i;
+	const char *strs;
+	int status;
+
+	x->format  = ( int ) bibindex_get( buf + 12 );
+	x->size    = bibindex_get2( buf + 16 );
+	x->charset = ( int ) bibindex_get( buf + 24 );
+	nrecs      = bibindex_get( buf + 28 );
+	nkeys      = bibindex_get( buf + 32 );
+
+	recs = buf + BIBINDEX_HEADER;
+	keys = recs + nrecs * 20UL;
+	strs = ( const char * ) ( keys + nkeys * 12UL );
+
+	if ( nrecs ) {
+		status = bibindex_growrecs( x, nrecs );
+		if ( status!=BIBL_OK ) return status;
+	}
+
+	for ( i=0; i<nrecs; ++i ) {
+		x->start[i] = bibindex_get2( recs + i*20 );
+		x->len[i]   = bibindex_get2( recs + i*20 + 8 );
+		x->isref[i] = bibindex_get( recs + i*20 + 16 );
+	}
+	x->n = nrecs;
+
+	for ( i=0; i<nkeys; ++i ) {
+		status = bibindex_addkey( x, strs + bibindex_get( keys + i*12 + 8 ),
+				bibindex_get( keys + i*12 ), bibindex_get( keys + i*12 + 4 ) );
+		if ( status!=BIBL_OK ) return status;
+	}
+
+	return bibindex_hash( x );
+}
+
+/* bibindex_load()
+ *
+ * Replace the contents of x with an index saved by bibindex_save().
+ * Returns BIBL_ERR_BADINPUT for files that are not indices or are
+ * damaged.
+ */
+int
+bibindex_load( bibindex *x, FILE *fp )
+{
+	unsigned long len;
+	char *buf;
+	int status;
+
+	if ( !x || !fp ) return BIBL_ERR_BADINPUT;
+
+	bibindex_free( x );
+
+	status = source_readall( fp, &buf, &len, 0 );
+	if ( status==SOURCE_ERR_MEMERR ) return BIBL_ERR_MEMERR;
+	if ( status!=SOURCE_OK ) return BIBL_ERR_CANTOPEN;
+
+	status = bibindex_check( ( unsigned char * ) buf, len );
+	if ( status==BIBL_OK ) status = bibindex_fill( x, ( unsigned char * ) buf );
+	if ( status!=BIBL_OK ) bibindex_free( x );
+
+	free( buf );
+
+	return status;
+}
+
+/*****************************************************
+ PUBLIC: int bibindex_find()
+*****************************************************/
+
+/* bibindex_find()
+ *
+ * Add to recs the records that key, compared without regard to case,
+ * names. Returns the number added, or BIBL_ERR_MEMERR.
+ */
+int
+bibindex_find( bibindex *x, const char *key, intlist *recs )
+{
+	int k, n = 0;
+
+	if ( !x || !key || !recs ) return BIBL_ERR_BADINPUT;
+
+	k = strhash_find( &(x->index), key );
+	while ( k!=-1 ) {
+		if ( intlist_add( recs, intlist_get( &(x->keyrec), k ) )!=INTLIST_OK ) return BIBL_ERR_MEMERR;
+		n++;
+		k = intlist_get( &(x->keynext), k );
+	}
+
+	return n;
+}
+
+/*****************************************************
+ PUBLIC: int bibindex_read()
+*****************************************************/
+
+/* bibindex_read()
+ *
+ * Read the references of records recs from fp, the indexed file, into
+ * b as bibl_read() would, in file order and each once. The records
+ * before them that are not references are read too, so that BibTeX
+ * @STRINGs are defined. fp must be seekable and the size the index
+ * was built for, and p must read the format it was built with;
+ * BIBL_ERR_BADINPUT is returned otherwise. Citekeys made up for
+ * references without one, and the suffixes that make them unique, come
+ * from the references read and so can differ from a full read.
+ */
+int
+bibindex_read( bibindex *x, FILE *fp, intlist *recs, bibl *b, char *filename, param *p )
+{
+	unsigned long total = 0, pos = 0;
+	unsigned char *want = NULL;
+	char *buf = NULL;
+	long i, last = -1;
+	int r, status;
+	param rp;
+
+	if ( !x || !fp || !recs || !b || !p ) return BIBL_ERR_BADINPUT;
+	if ( p->readformat!=x->format ) return BIBL_ERR_BADINPUT;
+
+	if ( fseek( fp, 0, SEEK_END ) || ftell( fp )!=( long ) x->size ) return BIBL_ERR_BADINPUT;
+
+	if ( recs->n==0 ) return BIBL_OK;
+
+	want = ( unsigned char * ) calloc( x->n, sizeof( unsigned char ) );
+	if ( !want ) return BIBL_ERR_MEMERR;
+
+	for ( i=0; i<recs->n; ++i ) {
+		r = intlist_get( recs, i );
+		if ( r<0 || r>=x->n ) {
+			status = BIBL_ERR_BADINPUT;
+			goto out;
+		}
+		want[r] = 1;
+		if ( r > last ) last = r;
+	}
+
+	for ( i=0; i<=last; ++i ) {
+		if ( !x->isref[i] ) want[i] = 1;
+		if ( want[i] ) total += x->len[i];
+	}
+
+	buf = ( char * ) malloc( total + 1 );
+	if ( !buf ) {
+		status = BIBL_ERR_MEMERR;
+		goto out;
+	}
+
+	for ( i=0; i<=last; ++i ) {
+		if ( !want[i] ) continue;
+		if ( fseek( fp, ( long ) x->start[i], SEEK_SET ) ||
+		     fread( buf + pos, 1, x->len[i], fp )!=x->len[i] ) {
+			status = BIBL_ERR_CANTOPEN;
+			goto out;
+		}
+		pos += x->len[i];
+	}
+
+	/* the byte order mark or XML declaration is only in the first record */
+	rp = *p;
+	if ( x->charset!=CHARSET_UNKNOWN && rp.charsetin_src!=BIBL_SRC_USER ) {
+		rp.charsetin_src = BIBL_SRC_FILE;
+		rp.charsetin     = x->charset;
+		rp.utf8in        = ( x->charset==CHARSET_UNICODE );
+	}
+
+	status = bibl_read_mem( b, buf, total, filename, &rp );
+
+out:
+	if ( want ) free( want );
+	if ( buf )  free( buf );
+
+	return status;
+}
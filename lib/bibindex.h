@@ -0,0 +1,57 @@
+/*
+ * bibindex.h
+ *
+ * Copyright (c) Chris Putnam 2021
+ *
+ * Source code released under the GPL version 2
+ *
+ */
+#ifndef BIBINDEX_H
+#define BIBINDEX_H
+
+#include <stdio.h>
+#include "bibutils.h"
+#include "intlist.h"
+#include "slist.h"
+#include "strhash.h"
+
+#define BIBINDEX_CITEKEY (0)
+#define BIBINDEX_DOI     (1)
+#define BIBINDEX_PMID    (2)
+
+/* Byte offsets of the records of a bibliography file, found with one
+ * pass of bibl_scan(), and an index from citekeys, DOIs and PubMed ids
+ * to them. References are then read by seeking to their records and
+ * parsing only those.
+ *
+ * Record i is the span [start[i], start[i]+len[i]) of the file; isref[i]
+ * is zero for records that are not references (BibTeX @STRINGs and the
+ * like), which are read along with any reference that follows them.
+ * Key k names record keyrec[k]; keynext[k] chains the keys sharing a
+ * string, whose first key is found through index.
+ */
+typedef struct bibindex {
+	unsigned long size;      /* bytes in the indexed file */
+	int           format;    /* BIBL_ input mode it was read with */
+	int           charset;   /* found in the file, or CHARSET_UNKNOWN */
+	long          n, max;
+	unsigned long *start, *len;
+	unsigned char *isref;
+	slist         keys;
+	intlist       keyrec, keytype, keynext;
+	strhash       index;     /* key -> first position in keys */
+} bibindex;
+
+void bibindex_init( bibindex *x );
+void bibindex_free( bibindex *x );
+
+int  bibindex_build( bibindex *x, const char *buf, unsigned long len, char *filename, param *p );
+int  bibindex_buildfile( bibindex *x, char *filename, param *p );
+
+int  bibindex_save( bibindex *x, FILE *fp );
+int  bibindex_load( bibindex *x, FILE *fp );
+
+int  bibindex_find( bibindex *x, const char *key, intlist *recs );
+int  bibindex_read( bibindex *x, FILE *fp, intlist *recs, bibl *b, char *filename, param *p );
+
+#endif
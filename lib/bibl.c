@@ -122,3 +122,51 @@ bibl_findref( bibl *bin, const char *citekey )
 
 	return -1;
 }
+
+/* bibl_index_init()
+ *
+ * Index the references of b by citekey so bibl_index_find() gives the
+ * same answer as bibl_findref() in constant time; returns BIBL_OK or
+ * BIBL_ERR_MEMERR
+ */
+int
+bibl_index_init( bibl_index *bi, bibl *b )
+{
+	long i;
+	int n;
+
+	bi->b = b;
+	strhash_init( &(bi->keys), STRHASH_CASE );
+
+	for ( i=0; i<b->n; ++i ) {
+
+		n = fields_find( b->ref[i], "refnum", LEVEL_ANY );
+		if ( n==FIELDS_NOTFOUND ) continue;
+
+		/* ...first reference with a citekey wins, as in bibl_findref() */
+		if ( strhash_add_unique( &(bi->keys), fields_value( b->ref[i], n, FIELDS_CHRP_NOUSE ), i )!=STRHASH_OK ) {
+			bibl_index_free( bi );
+			return BIBL_ERR_MEMERR;
+		}
+
+	}
+
+	return BIBL_OK;
+}
+
+void
+bibl_index_free( bibl_index *bi )
+{
+	strhash_free( &(bi->keys) );
+	bi->b = NULL;
+}
+
+/* bibl_index_find()
+ *
+ * returns position of reference matching citekey, else -1
+ */
+long
+bibl_index_find( bibl_index *bi, const char *citekey )
+{
+	return strhash_find( &(bi->keys), citekey );
+}
@@ -13,6 +13,7 @@
 #include "str.h"
 #include "fields.h"
 #include "reftypes.h"
+#include "strhash.h"
 
 typedef struct {
 	long n;
@@ -20,11 +21,24 @@ typedef struct {
 	fields **ref;
 } bibl;
 
+/* citekey -> position index over a bibl; the keys are the refnum values
+ * themselves, so rebuild it if references are removed or their refnums
+ * change
+ */
+typedef struct {
+	bibl    *b;
+	strhash keys;
+} bibl_index;
+
 void bibl_init( bibl *b );
 int  bibl_addref( bibl *b, fields *ref );
 void bibl_free( bibl *b );
 int  bibl_copy( bibl *bout, bibl *bin );
 long bibl_findref( bibl *bin, const char *citekey );
 
+int  bibl_index_init( bibl_index *bi, bibl *b );
+void bibl_index_free( bibl_index *bi );
+long bibl_index_find( bibl_index *bi, const char *citekey );
+
 #endif
 
@@ -24,13 +24,12 @@
 #include "month.h"
 #include "name.h"
 #include "reftypes.h"
+#include "macros.h"
+#include "tokens.h"
 
 extern variants biblatex_all[];
 extern int biblatex_nall;
 
-static slist find    = { 0, 0, 0, NULL };
-static slist replace = { 0, 0, 0, NULL };
-
 /*****************************************************
  PUBLIC: void biblatexin_initparams()
 *****************************************************/
@@ -38,7 +37,7 @@ static slist replace = { 0, 0, 0, NULL };
 static int  biblatexin_convertf( fields *bibin, fields *info, int reftype, param *p );
 static int  biblatexin_processf( fields *bibin, const char *data, const char *filename, long nref, param *p );
 static int  biblatexin_cleanf( bibl *bin, param *p );
-static int  biblatexin_readf( FILE *fp, char *buf, int bufsize, int *bufpos, str *line, str *reference, int *fcharset );
+static int  biblatexin_readf( source *src, char *buf, int bufsize, int *bufpos, str *line, str *reference, int *fcharset );
 static int  biblatexin_typef( fields *bibin, const char *filename, int nrefs, param *p );
 
 int
@@ -63,8 +62,11 @@ biblatexin_initparams( param *pm, const char *progname )
 	pm->all      = biblatex_all;
 	pm->nall     = biblatex_nall;
 
-	slist_init( &(pm->asis) );
-	slist_init( &(pm->corps) );
+	namelist_init( &(pm->asis) );
+	namelist_init( &(pm->corps) );
+	pm->names = NULL;
+	pm->strings = macros_new();
+	if ( !pm->strings ) return BIBL_ERR_MEMERR;
 
 	if ( !progname ) pm->progname = NULL;
 	else {
@@ -88,10 +90,10 @@ biblatexin_initparams( param *pm, const char *progname )
  *
  */
 static int
-readmore( FILE *fp, char *buf, int bufsize, int *bufpos, str *line )
+readmore( source *src, char *buf, int bufsize, int *bufpos, str *line )
 {
 	if ( line->len ) return 1;
-	else return str_fget( fp, buf, bufsize, bufpos, line );
+	else return source_fget( src, buf, bufsize, bufpos, line );
 }
 
 /*
@@ -101,11 +103,11 @@ readmore( FILE *fp, char *buf, int bufsize, int *bufpos, str *line )
  * returns 1 if last reference in file, 2 if reference within file
  */
 static int
-biblatexin_readf( FILE *fp, char *buf, int bufsize, int *bufpos, str *line, str *reference, int *fcharset )
+biblatexin_readf( source *src, char *buf, int bufsize, int *bufpos, str *line, str *reference, int *fcharset )
 {
 	int haveref = 0;
 	const char *p;
-	while ( haveref!=2 && readmore( fp, buf, bufsize, bufpos, line ) ) {
+	while ( haveref!=2 && readmore( src, buf, bufsize, bufpos, line ) ) {
 		if ( line->len == 0 ) continue; /* blank line */
 		p = &(line->data[0]);
 		p = skip_ws( p );
@@ -183,15 +185,18 @@ biblatex_tag( const char *p, str *tag )
 	return skip_ws( p );
 }
 
+/* biblatex_data()
+ *
+ * Split the value after '=' into tokens that are spans of the buffer;
+ * nothing is copied here.
+ */
 static const char *
-biblatex_data( const char *p, fields *bibin, slist *tokens, long nref, param *pm )
+biblatex_data( const char *p, fields *bibin, tokens *toks, long nref, param *pm )
 {
 	unsigned int nbracket = 0, nquotes = 0;
-	const char *startp = p;
-	int status;
-	str tok;
+	const char *startp = p, *tok = NULL, *end = NULL;
+	int newlines = 0;
 
-	str_init( &tok );
 	while ( p && *p ) {
 		if ( !nquotes && !nbracket ) {
 			if ( *p==',' || *p=='=' || *p=='}' || *p==')' )
@@ -199,47 +204,49 @@ biblatex_data( const char *p, fields *bibin, slist *tokens, long nref, param *pm
 		}
 		if ( *p=='\"' && nbracket==0 && ( p==startp || *(p-1)!='\\' ) ) {
 			nquotes = !nquotes;
-			str_addchar( &tok, *p );
+			if ( !tok ) tok = p;
+			end = p + 1;
 			if ( !nquotes ) {
-				status = slist_add( tokens, &tok );
-				if ( status!=SLIST_OK ) { p = NULL; goto outerr; }
-				str_empty( &tok );
+				if ( tokens_add( toks, tok, end - tok, newlines )!=TOKENS_OK ) return NULL;
+				tok = NULL;
+				newlines = 0;
 			}
 		} else if ( *p=='#' && !nquotes && !nbracket ) {
-			if ( str_has_value( &tok ) ) {
-				status = slist_add( tokens, &tok );
-				if ( status!=SLIST_OK ) { p = NULL; goto outerr; }
+			if ( tok ) {
+				if ( tokens_add( toks, tok, end - tok, newlines )!=TOKENS_OK ) return NULL;
+				tok = NULL;
+				newlines = 0;
 			}
-			str_strcpyc( &tok, "#" );
-			status = slist_add( tokens, &tok );
-			if ( status!=SLIST_OK ) { p = NULL; goto outerr; }
-			str_empty( &tok );
+			if ( tokens_add( toks, p, 1, 0 )!=TOKENS_OK ) return NULL;
 		} else if ( *p=='{' && !nquotes && ( p==startp || *(p-1)!='\\' ) ) {
 			nbracket++;
-			str_addchar( &tok, *p );
+			if ( !tok ) tok = p;
+			end = p + 1;
 		} else if ( *p=='}' && !nquotes && ( p==startp || *(p-1)!='\\' ) ) {
 			nbracket--;
-			str_addchar( &tok, *p );
+			if ( !tok ) tok = p;
+			end = p + 1;
 			if ( nbracket==0 ) {
-				status = slist_add( tokens, &tok );
-				if ( status!=SLIST_OK ) { p = NULL; goto outerr; }
-				str_empty( &tok );
+				if ( tokens_add( toks, tok, end - tok, newlines )!=TOKENS_OK ) return NULL;
+				tok = NULL;
+				newlines = 0;
 			}
 		} else if ( !is_ws( *p ) || nquotes || nbracket ) {
-			if ( !is_ws( *p ) ) str_addchar( &tok, *p );
-			else {
-				if ( tok.len!=0 && *p!='\n' && *p!='\r' )
-					str_addchar( &tok, *p );
-				else if ( tok.len!=0 && (*p=='\n' || *p=='\r')) {
-					str_addchar( &tok, ' ' );
+			if ( !is_ws( *p ) ) {
+				if ( !tok ) tok = p;
+				end = p + 1;
+			} else if ( tok ) {
+				if ( *p=='\n' || *p=='\r' ) {
+					newlines = 1;
 					while ( is_ws( *(p+1) ) ) p++;
 				}
+				end = p + 1;
 			}
 		} else if ( is_ws( *p ) ) {
-			if ( str_has_value( &tok ) ) {
-				status = slist_add( tokens, &tok );
-				if ( status!=SLIST_OK ) { p = NULL; goto outerr; }
-				str_empty( &tok );
+			if ( tok ) {
+				if ( tokens_add( toks, tok, end - tok, newlines )!=TOKENS_OK ) return NULL;
+				tok = NULL;
+				newlines = 0;
 			}
 		}
 		p++;
@@ -251,12 +258,9 @@ out:
 	if ( nquotes!=0 ) {
 		fprintf( stderr, "%s: Mismatch in number of quotes in reference %ld\n", pm->progname, nref );
 	}
-	if ( str_has_value( &tok ) ) {
-		status = slist_add( tokens, &tok );
-		if ( status!=SLIST_OK ) p = NULL;
+	if ( tok ) {
+		if ( tokens_add( toks, tok, end - tok, newlines )!=TOKENS_OK ) return NULL;
 	}
-outerr:
-	str_free( &tok );
 	return p;
 }
 
@@ -267,17 +271,17 @@ outerr:
 static void
 replace_strings( slist *tokens, fields *bibin, long nref, param *pm )
 {
-	int i, n, ok;
+	int i, ok;
+	str *s, *t;
 	char *q;
-	str *s;
 	i = 0;
 	while ( i < tokens->n ) {
 		s = slist_str( tokens, i );
 		if ( !strcmp( s->data, "#" ) ) {
 		} else if ( s->data[0]!='\"' && s->data[0]!='{' ) {
-			n = slist_find( &find, s );
-			if ( n!=-1 ) {
-				str_strcpy( s, slist_str( &replace, n ) );
+			t = macros_find( pm->strings, s );
+			if ( t ) {
+				str_strcpy( s, t );
 			} else {
 				q = s->data;
 				ok = 1;
@@ -336,11 +340,41 @@ string_concatenate( slist *tokens, fields *bibin, long nref, param *pm )
 	return BIBL_OK;
 }
 
+static void
+warn_nonnumeric_tokens( tokens *toks, long nref, param *pm )
+{
+	unsigned long j;
+	token *t;
+	int i;
+
+	for ( i=0; i<toks->n; ++i ) {
+		t = &(toks->tok[i]);
+		if ( !token_is_bare( t ) ) continue;
+		for ( j=0; j<t->len; ++j )
+			if ( !isdigit( (unsigned char) t->p[j] ) ) break;
+		if ( j<t->len ) {
+			fprintf( stderr, "%s: Warning: Non-numeric "
+			   "BibTeX elements should be in quotations or "
+			   "curly brackets in reference %ld\n", pm->progname, nref );
+		}
+	}
+}
+
+static int
+token_strip( const char *p, unsigned long len, uchar stripquotes )
+{
+	if ( stripquotes && p[0]=='\"' && p[len-1]=='\"' ) return 1;
+	if ( p[0]=='{' && p[len-1]=='}' ) return 1;
+	return 0;
+}
+
 static const char *
 process_biblatexline( const char *p, str *tag, str *data, uchar stripquotes, long nref, param *pm )
 {
 	int i, status;
+	tokens toks;
 	slist tokens;
+	token *t;
 	str *s;
 
 	str_empty( data );
@@ -353,9 +387,30 @@ process_biblatexline( const char *p, str *tag, str *data, uchar stripquotes, lon
 		return p;
 	}
 
+	tokens_init( &toks );
 	slist_init( &tokens );
 
-	if ( *p=='=' ) p = biblatex_data( p+1, NULL, &tokens, nref, pm );
+	if ( *p=='=' ) {
+		p = biblatex_data( p+1, NULL, &toks, nref, pm );
+		if ( !p ) goto out;
+	}
+
+	/* ...literal values go straight from the buffer to data */
+	if ( tokens_are_literal( &toks, pm->strings ) ) {
+		warn_nonnumeric_tokens( &toks, nref, pm );
+		for ( i=0; i<toks.n; i++ ) {
+			t = &(toks.tok[i]);
+			if ( token_strip( t->p, t->len, stripquotes ) ) token_cat( data, t, 1, 1 );
+			else token_cat( data, t, 0, 0 );
+		}
+		if ( str_memerr( data ) ) p = NULL;
+		goto out;
+	}
+
+	if ( tokens_to_slist( &toks, &tokens )!=TOKENS_OK ) {
+		p = NULL;
+		goto out;
+	}
 
 	replace_strings( &tokens, NULL, nref, pm );
 
@@ -367,14 +422,14 @@ process_biblatexline( const char *p, str *tag, str *data, uchar stripquotes, lon
 
 	for ( i=0; i<tokens.n; i++ ) {
 		s = slist_str( &tokens, i );
-		if ( ( stripquotes && s->data[0]=='\"' && s->data[s->len-1]=='\"' ) ||
-		     ( s->data[0]=='{' && s->data[s->len-1]=='}' ) ) {
+		if ( token_strip( s->data, s->len, stripquotes ) ) {
 			str_trimbegin( s, 1 );
 			str_trimend( s, 1 );
 		}
 		str_strcat( data, slist_str( &tokens, i ) );
 	}
 out:
+	tokens_free( &toks );
 	slist_free( &tokens );
 	return p;
 }
@@ -427,8 +482,8 @@ out:
 static int
 process_string( const char *p, long nref, param *pm )
 {
-	int n, status = BIBL_OK;
-	str s1, s2, *s;
+	int status = BIBL_OK;
+	str s1, s2;
 	strs_init( &s1, &s2, NULL );
 	while ( *p && *p!='{' && *p!='(' ) p++;
 	if ( *p=='{' || *p=='(' ) p++;
@@ -440,17 +495,8 @@ process_string( const char *p, long nref, param *pm )
 		str_strcpyc( &s2, "" );
 	}
 	if ( str_has_value( &s1 ) ) {
-		n = slist_find( &find, &s1 );
-		if ( n==-1 ) {
-			status = slist_add_ret( &find, &s1, BIBL_OK, BIBL_ERR_MEMERR );
-			if ( status!=BIBL_OK ) goto out;
-			status = slist_add_ret( &replace, &s2, BIBL_OK, BIBL_ERR_MEMERR );
-			if ( status!=BIBL_OK ) goto out;
-		} else {
-			if ( str_has_value( &s2 ) ) s = slist_set( &replace, n, &s2 );
-			else s = slist_setc( &replace, n, "" );
-			if ( s==NULL ) { status = BIBL_ERR_MEMERR; goto out; }
-		}
+		if ( macros_add( pm->strings, &s1, &s2 )!=MACROS_OK )
+			status = BIBL_ERR_MEMERR;
 	}
 out:
 	strs_free( &s1, &s2, NULL );
@@ -572,23 +618,30 @@ biblatexin_crossref_oneref( fields *ref, fields *cross )
 static int
 biblatexin_crossref( bibl *bin, param *p )
 {
-	int n, ncross, status = BIBL_OK;
+	int n, ncross, indexed = 0, status = BIBL_OK;
 	fields *ref, *cross;
+	bibl_index index;
 	long i;
         for ( i=0; i<bin->n; ++i ) {
 		ref = bin->ref[i];
 		n = fields_find( ref, "CROSSREF", LEVEL_ANY );
 		if ( n==FIELDS_NOTFOUND ) continue;
 		fields_set_used( ref, n );
-		ncross = bibl_findref( bin, (char*) fields_value(ref,n, FIELDS_CHRP_NOUSE) );
+		if ( !indexed ) {
+			status = bibl_index_init( &index, bin );
+			if ( status!=BIBL_OK ) return status;
+			indexed = 1;
+		}
+		ncross = bibl_index_find( &index, (char*) fields_value(ref,n, FIELDS_CHRP_NOUSE) );
 		if ( ncross==-1 ) {
 			biblatexin_nocrossref( bin, i, n, p );
 			continue;
 		}
 		cross = bin->ref[ncross];
 		status = biblatexin_crossref_oneref( ref, cross );
-		if ( status!=BIBL_OK ) return status;
+		if ( status!=BIBL_OK ) break;
 	}
+	if ( indexed ) bibl_index_free( &index );
 	return status;
 }
 
@@ -805,36 +858,28 @@ out:
 
 
 static int
-biblatex_matches_list( fields *info, char *tag, char *suffix, str *data, int level, slist *names, int *match )
+biblatex_matches_list( fields *info, char *tag, char *suffix, str *data, int level, namelist *names, int *match )
 {
-	int i, fstatus, status = BIBL_OK;
+	int fstatus, status = BIBL_OK;
 	str newtag;
 
 	*match = 0;
-	if ( names->n==0 ) return status;
+	if ( namelist_find( names, data )==-1 ) return status;
 
 	str_init( &newtag );
 
-	for ( i=0; i<names->n; ++i ) {
-		if ( strcmp( str_cstr( data ), slist_cstr( names, i ) ) ) continue;
-		str_initstrc( &newtag, tag );
-		str_strcatc( &newtag, suffix );
-		fstatus = fields_add( info, str_cstr( &newtag ), str_cstr( data ), level );
-		if ( fstatus!=FIELDS_OK ) {
-			status = BIBL_ERR_MEMERR;
-			goto out;
-		}
-		*match = 1;
-		goto out;
-	}
+	str_initstrc( &newtag, tag );
+	str_strcatc( &newtag, suffix );
+	fstatus = fields_add( info, str_cstr( &newtag ), str_cstr( data ), level );
+	if ( fstatus!=FIELDS_OK ) status = BIBL_ERR_MEMERR;
+	else *match = 1;
 
-out:
 	str_free( &newtag );
 	return status;
 }
 
 static int
-biblatex_names( fields *info, char *tag, str *data, int level, slist *asis, slist *corps )
+biblatex_names( fields *info, char *tag, str *data, int level, namelist *asis, namelist *corps )
 {
 	int begin, end, n, etal, i, match, status = BIBL_OK;
 	slist tokens;
@@ -21,13 +21,14 @@
 #include "title.h"
 #include "type.h"
 #include "url.h"
+#include "sink.h"
 #include "bibformats.h"
 
 /*****************************************************
  PUBLIC: int biblatexout_initparams()
 *****************************************************/
 
-static int  biblatexout_write( fields *in, FILE *fp, param *p, unsigned long refnum );
+static int  biblatexout_write( fields *in, sink *s, param *p, unsigned long refnum );
 static int  biblatexout_assemble( fields *in, fields *out, param *pm, unsigned long refnum );
 
 int
@@ -45,6 +46,7 @@ biblatexout_initparams( param *pm, const char *progname )
 	pm->verbose          = 0;
 	pm->addcount         = 0;
 	pm->singlerefperfile = 0;
+	pm->nthreads         = 0;
 
 	pm->headerf   = generic_writeheader;
 	pm->footerf   = NULL;
@@ -835,71 +837,75 @@ biblatexout_assemble( fields *in, fields *out, param *pm, unsigned long refnum )
  PUBLIC: int biblatexout_write()
 *****************************************************/
 
+/* write tag, uppercased for BIBL_FORMAT_BIBOUT_UPPERCASE */
+static void
+biblatexout_write_tag( sink *s, const char *tag, int format_opts )
+{
+	if ( !tag ) return;
+	if ( !(format_opts & BIBL_FORMAT_BIBOUT_UPPERCASE) ) sink_puts( s, tag );
+	else {
+		for ( ; *tag; ++tag )
+			sink_putc( s, toupper( (unsigned char) *tag ) );
+	}
+}
+
+/* write value, turning unescaped double quotes into ``/'' pairs
+ * unless the value is going to be enclosed in brackets */
+static void
+biblatexout_write_value( sink *s, const char *value, int format_opts )
+{
+	const char *p, *q;
+	int nquotes = 0;
+
+	for ( p=q=value; *q; ++q ) {
+		if ( *q!='\"' ) continue;
+		sink_write( s, p, q-p );
+		if ( format_opts & BIBL_FORMAT_BIBOUT_BRACKETS || ( q>value && q[-1]=='\\' ) )
+			sink_putc( s, '\"' );
+		else {
+			if ( nquotes % 2 == 0 )
+				sink_write( s, "``", 2 );
+			else    sink_write( s, "\'\'", 2 );
+			nquotes++;
+		}
+		p = q + 1;
+	}
+	sink_write( s, p, q-p );
+}
+
 static int
-biblatexout_write( fields *out, FILE *fp, param *pm, unsigned long refnum )
+biblatexout_write( fields *out, sink *s, param *pm, unsigned long refnum )
 {
-	int i, j, len, nquotes, format_opts = pm->format_opts;
-	char *tag, *value, ch;
+	int j, format_opts = pm->format_opts;
 
 	/* ...output type information "@article{" */
-	value = ( char * ) fields_value( out, 0, FIELDS_CHRP );
-	if ( !(format_opts & BIBL_FORMAT_BIBOUT_UPPERCASE) ) fprintf( fp, "@%s{", value );
-	else {
-		len = (value) ? strlen( value ) : 0;
-		fprintf( fp, "@" );
-		for ( i=0; i<len; ++i )
-			fprintf( fp, "%c", toupper((unsigned char)value[i]) );
-		fprintf( fp, "{" );
-	}
+	sink_putc( s, '@' );
+	biblatexout_write_tag( s, ( char * ) fields_value( out, 0, FIELDS_CHRP ), format_opts );
+	sink_putc( s, '{' );
 
 	/* ...output refnum "Smith2001" */
-	value = ( char * ) fields_value( out, 1, FIELDS_CHRP );
-	fprintf( fp, "%s", value );
+	sink_puts( s, ( char * ) fields_value( out, 1, FIELDS_CHRP ) );
 
 	/* ...rest of the references */
 	for ( j=2; j<out->n; ++j ) {
-		nquotes = 0;
-		tag   = ( char * ) fields_tag( out, j, FIELDS_CHRP );
-		value = ( char * ) fields_value( out, j, FIELDS_CHRP );
-		fprintf( fp, ",\n" );
-		if ( format_opts & BIBL_FORMAT_BIBOUT_WHITESPACE ) fprintf( fp, "  " );
-		if ( !(format_opts & BIBL_FORMAT_BIBOUT_UPPERCASE ) ) fprintf( fp, "%s", tag );
-		else {
-			len = strlen( tag );
-			for ( i=0; i<len; ++i )
-				fprintf( fp, "%c", toupper((unsigned char)tag[i]) );
-		}
-		if ( format_opts & BIBL_FORMAT_BIBOUT_WHITESPACE ) fprintf( fp, " = \t" );
-		else fprintf( fp, "=" );
+		sink_write( s, ",\n", 2 );
+		if ( format_opts & BIBL_FORMAT_BIBOUT_WHITESPACE ) sink_write( s, "  ", 2 );
+		biblatexout_write_tag( s, ( char * ) fields_tag( out, j, FIELDS_CHRP ), format_opts );
+		if ( format_opts & BIBL_FORMAT_BIBOUT_WHITESPACE ) sink_write( s, " = \t", 4 );
+		else sink_putc( s, '=' );
 
-		if ( format_opts & BIBL_FORMAT_BIBOUT_BRACKETS ) fprintf( fp, "{" );
-		else fprintf( fp, "\"" );
+		if ( format_opts & BIBL_FORMAT_BIBOUT_BRACKETS ) sink_putc( s, '{' );
+		else sink_putc( s, '\"' );
 
-		len = strlen( value );
-		for ( i=0; i<len; ++i ) {
-			ch = value[i];
-			if ( ch!='\"' ) fprintf( fp, "%c", ch );
-			else {
-				if ( format_opts & BIBL_FORMAT_BIBOUT_BRACKETS || ( i>0 && value[i-1]=='\\' ) )
-					fprintf( fp, "\"" );
-				else {
-					if ( nquotes % 2 == 0 )
-						fprintf( fp, "``" );
-					else    fprintf( fp, "\'\'" );
-					nquotes++;
-				}
-			}
-		}
+		biblatexout_write_value( s, ( char * ) fields_value( out, j, FIELDS_CHRP ), format_opts );
 
-		if ( format_opts & BIBL_FORMAT_BIBOUT_BRACKETS ) fprintf( fp, "}" );
-		else fprintf( fp, "\"" );
+		if ( format_opts & BIBL_FORMAT_BIBOUT_BRACKETS ) sink_putc( s, '}' );
+		else sink_putc( s, '\"' );
 	}
 
 	/* ...finish reference */
-	if ( format_opts & BIBL_FORMAT_BIBOUT_FINALCOMMA ) fprintf( fp, "," );
-	fprintf( fp, "\n}\n\n" );
-
-	fflush( fp );
+	if ( format_opts & BIBL_FORMAT_BIBOUT_FINALCOMMA ) sink_putc( s, ',' );
+	sink_write( s, "\n}\n\n", 4 );
 
 	return BIBL_OK;
 }
@@ -0,0 +1,370 @@
+/*
+ * biblcache.c
+ *
+ * Copyright (c) Chris Putnam 2021
+ *
+ * Source code released under the GPL version 2
+ *
+ * Binary save/load of bibl references. All integers are unsigned
+ * 32-bit little-endian:
+ *
+ *    "BIBLSAVE" version nrefs ntags nfields poolsize
+ *    ntags   x { tag }                     pool offset of each tag
+ *    nrefs   x { n }                       number of fields per reference
+ *    nfields x { tagid level value lang }  level in two's complement,
+ *                                          value/lang are pool offsets,
+ *                                          lang BIBLCACHE_NOLANG if unset
+ *    pool                                  distinct strings, '\0'-ended
+ *
+ * Everything is found by offset, so the file can also be used in place
+ * (e.g. mapped) by other readers.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include "bibdefs.h"
+#include "intlist.h"
+#include "strhash.h"
+#include "biblcache.h"
+#include "source.h"
+
+#define BIBLCACHE_MAGIC    "BIBLSAVE"
+#define BIBLCACHE_MAGICLEN (8)
+#define BIBLCACHE_VERSION  (1)
+#define BIBLCACHE_HEADER   (BIBLCACHE_MAGICLEN+5*4)
+#define BIBLCACHE_NOLANG   (0xffffffffU)
+
+/*****************************************************
+ PUBLIC: int bibl_save()
+*****************************************************/
+
+/* biblcache_pool
+ *
+ * The distinct strings of a bibl in pool order. The keys of index are
+ * the data of the fields being saved, so nothing is copied.
+ */
+typedef struct {
+	strhash     index;   /* string -> pool offset */
+	const char  **strs;
+	unsigned int n, max;
+	unsigned int size;
+} biblcache_pool;
+
+static void
+biblcache_pool_init( biblcache_pool *pl )
+{
+	strhash_init( &(pl->index), STRHASH_CASE );
+	pl->strs = NULL;
+	pl->n    = pl->max = 0;
+	pl->size = 0;
+}
+
+static void
+biblcache_pool_free( biblcache_pool *pl )
+{
+	strhash_free( &(pl->index) );
+	if ( pl->strs ) free( pl->strs );
+}
+
+static int
+biblcache_pool_add( biblcache_pool *pl, const char *s, unsigned int *offset )
+{
+	unsigned int alloc;
+	const char **more;
+	size_t len;
+	int n;
+
+	n = strhash_find( &(pl->index), s );
+	if ( n!=-1 ) {
+		*offset = n;
+		return BIBL_OK;
+	}
+
+	/* offsets are kept as ints in the index */
+	len = strlen( s );
+	if ( len >= INT_MAX - pl->size ) return BIBL_ERR_MEMERR;
+
+	if ( pl->n == pl->max ) {
+		alloc = ( pl->max ) ? pl->max * 2 : 256;
+		more = ( const char ** ) realloc( pl->strs, sizeof( const char * ) * alloc );
+		if ( !more ) return BIBL_ERR_MEMERR;
+		pl->strs = more;
+		pl->max  = alloc;
+	}
+
+	if ( strhash_set( &(pl->index), s, pl->size )!=STRHASH_OK ) return BIBL_ERR_MEMERR;
+
+	pl->strs[ pl->n++ ] = s;
+	*offset = pl->size;
+	pl->size += len + 1;
+
+	return BIBL_OK;
+}
+
+static void
+biblcache_put( FILE *fp, unsigned int v )
+{
+	putc( v & 0xff, fp );
+	putc( ( v >> 8 ) & 0xff, fp );
+	putc( ( v >> 16 ) & 0xff, fp );
+	putc( ( v >> 24 ) & 0xff, fp );
+}
+
+/* biblcache_collect()
+ *
+ * Intern the strings of b and fill rec with the four words of each
+ * field record, tags with the pool offsets of the distinct tags.
+ */
+static int
+biblcache_collect( bibl *b, biblcache_pool *pl, intlist *tags, unsigned int *rec )
+{
+	unsigned int offset;
+	fields_entry *e;
+	strhash tagids;
+	long i, k = 0;
+	int j, id, status = BIBL_OK;
+
+	strhash_init( &tagids, STRHASH_CASE );
+
+	for ( i=0; i<b->n && status==BIBL_OK; ++i ) {
+		for ( j=0; j<b->ref[i]->n; ++j ) {
+
+			e = b->ref[i]->entries[j];
+
+			id = strhash_find( &tagids, str_cstr( &(e->tag) ) );
+			if ( id==-1 ) {
+				status = biblcache_pool_add( pl, str_cstr( &(e->tag) ), &offset );
+				if ( status!=BIBL_OK ) break;
+				id = tags->n;
+				if ( intlist_add( tags, offset )!=INTLIST_OK ||
+				     strhash_set( &tagids, str_cstr( &(e->tag) ), id )!=STRHASH_OK ) {
+					status = BIBL_ERR_MEMERR;
+					break;
+				}
+			}
+			rec[k++] = id;
+			rec[k++] = ( unsigned int ) e->level;
+
+			status = biblcache_pool_add( pl, str_cstr( &(e->value) ), &offset );
+			if ( status!=BIBL_OK ) break;
+			rec[k++] = offset;
+
+			if ( e->language.len ) {
+				status = biblcache_pool_add( pl, str_cstr( &(e->language) ), &offset );
+				if ( status!=BIBL_OK ) break;
+				rec[k++] = offset;
+			} else rec[k++] = BIBLCACHE_NOLANG;
+
+		}
+	}
+
+	strhash_free( &tagids );
+
+	return status;
+}
+
+int
+bibl_save( bibl *b, FILE *fp )
+{
+	unsigned int *rec = NULL;
+	unsigned long nfields = 0, k;
+	biblcache_pool pool;
+	intlist tags;
+	int status;
+	long i;
+
+	if ( !b || !fp ) return BIBL_ERR_BADINPUT;
+
+	for ( i=0; i<b->n; ++i )
+		nfields += b->ref[i]->n;
+	if ( b->n > INT_MAX || nfields > INT_MAX / 4 ) return BIBL_ERR_MEMERR;
+
+	biblcache_pool_init( &pool );
+	intlist_init( &tags );
+
+	if ( nfields ) {
+		rec = ( unsigned int * ) malloc( sizeof( unsigned int ) * 4 * nfields );
+		if ( !rec ) {
+			status = BIBL_ERR_MEMERR;
+			goto out;
+		}
+	}
+
+	status = biblcache_collect( b, &pool, &tags, rec );
+	if ( status!=BIBL_OK ) goto out;
+
+	fwrite( BIBLCACHE_MAGIC, 1, BIBLCACHE_MAGICLEN, fp );
+	biblcache_put( fp, BIBLCACHE_VERSION );
+	biblcache_put( fp, b->n );
+	biblcache_put( fp, tags.n );
+	biblcache_put( fp, nfields );
+	biblcache_put( fp, pool.size );
+
+	for ( i=0; i<tags.n; ++i )
+		biblcache_put( fp, intlist_get( &tags, i ) );
+	for ( i=0; i<b->n; ++i )
+		biblcache_put( fp, b->ref[i]->n );
+	for ( k=0; k<4*nfields; ++k )
+		biblcache_put( fp, rec[k] );
+	for ( k=0; k<pool.n; ++k )
+		fwrite( pool.strs[k], 1, strlen( pool.strs[k] ) + 1, fp );
+
+	if ( fflush( fp ) || ferror( fp ) ) status = BIBL_ERR_CANTOPEN;
+
+out:
+	if ( rec ) free( rec );
+	intlist_free( &tags );
+	biblcache_pool_free( &pool );
+
+	return status;
+}
+
+/*****************************************************
+ PUBLIC: int bibl_load()
+*****************************************************/
+
+static unsigned int
+biblcache_get( const unsigned char *p )
+{
+	return ( unsigned int ) p[0] | ( ( unsigned int ) p[1] << 8 ) |
+		( ( unsigned int ) p[2] << 16 ) | ( ( unsigned int ) p[3] << 24 );
+}
+
+typedef struct {
+	unsigned int nrefs, ntags, nfields, poolsize;
+	const unsigned char *tags, *counts, *rec;
+	const char *pool;
+} biblcache_file;
+
+/* biblcache_check()
+ *
+ * Locate the tables in buf and check every count and offset, so that
+ * loading cannot fail part way through except for lack of memory.
+ */
+static int
+biblcache_check( biblcache_file *f, const unsigned char *buf, unsigned long len )
+{
+	unsigned long left, i, sum = 0;
+	unsigned int v;
+
+	if ( len < BIBLCACHE_HEADER ) return BIBL_ERR_BADINPUT;
+	if ( memcmp( buf, BIBLCACHE_MAGIC, BIBLCACHE_MAGICLEN ) ) return BIBL_ERR_BADINPUT;
+	if ( biblcache_get( buf + 8 )!=BIBLCACHE_VERSION ) return BIBL_ERR_BADINPUT;
+
+	f->nrefs    = biblcache_get( buf + 12 );
+	f->ntags    = biblcache_get( buf + 16 );
+	f->nfields  = biblcache_get( buf + 20 );
+	f->poolsize = biblcache_get( buf + 24 );
+
+	left = len - BIBLCACHE_HEADER;
+	if ( f->ntags > left / 4 ) return BIBL_ERR_BADINPUT;
+	left -= f->ntags * 4UL;
+	if ( f->nrefs > left / 4 ) return BIBL_ERR_BADINPUT;
+	left -= f->nrefs * 4UL;
+	if ( f->nfields > left / 16 ) return BIBL_ERR_BADINPUT;
+	left -= f->nfields * 16UL;
+	if ( f->poolsize != left ) return BIBL_ERR_BADINPUT;
+
+	f->tags   = buf + BIBLCACHE_HEADER;
+	f->counts = f->tags + f->ntags * 4UL;
+	f->rec    = f->counts + f->nrefs * 4UL;
+	f->pool   = ( const char * ) ( f->rec + f->nfields * 16UL );
+
+	/* a terminated pool means every offset inside it is a string */
+	if ( f->poolsize && f->pool[ f->poolsize - 1 ]!='\0' ) return BIBL_ERR_BADINPUT;
+
+	for ( i=0; i<f->ntags; ++i )
+		if ( biblcache_get( f->tags + i*4 ) >= f->poolsize ) return BIBL_ERR_BADINPUT;
+
+	for ( i=0; i<f->nrefs; ++i ) {
+		v = biblcache_get( f->counts + i*4 );
+		if ( v > INT_MAX || v > f->nfields - sum ) return BIBL_ERR_BADINPUT;
+		sum += v;
+	}
+	if ( sum != f->nfields ) return BIBL_ERR_BADINPUT;
+
+	for ( i=0; i<f->nfields; ++i ) {
+		if ( biblcache_get( f->rec + i*16 ) >= f->ntags ) return BIBL_ERR_BADINPUT;
+		if ( biblcache_get( f->rec + i*16 + 8 ) >= f->poolsize ) return BIBL_ERR_BADINPUT;
+		v = biblcache_get( f->rec + i*16 + 12 );
+		if ( v!=BIBLCACHE_NOLANG && v >= f->poolsize ) return BIBL_ERR_BADINPUT;
+	}
+
+	return BIBL_OK;
+}
+
+static int
+biblcache_build( bibl *b, biblcache_file *f )
+{
+	const unsigned char *rec = f->rec;
+	const char *tag, *value, *lang;
+	unsigned int i, j, n, v;
+	fields *ref;
+	int level;
+
+	for ( i=0; i<f->nrefs; ++i ) {
+
+		ref = fields_new();
+		if ( !ref ) return BIBL_ERR_MEMERR;
+
+		n = biblcache_get( f->counts + i*4 );
+		for ( j=0; j<n; ++j, rec+=16 ) {
+			tag   = f->pool + biblcache_get( f->tags + biblcache_get( rec ) * 4UL );
+			level = ( int ) biblcache_get( rec + 4 );
+			value = f->pool + biblcache_get( rec + 8 );
+			v     = biblcache_get( rec + 12 );
+			lang  = ( v==BIBLCACHE_NOLANG ) ? NULL : f->pool + v;
+			if ( _fields_add( ref, tag, value, lang, level, FIELDS_CAN_DUP )!=FIELDS_OK ) {
+				fields_delete( ref );
+				return BIBL_ERR_MEMERR;
+			}
+		}
+
+		if ( bibl_addref( b, ref )!=BIBL_OK ) {
+			fields_delete( ref );
+			return BIBL_ERR_MEMERR;
+		}
+
+	}
+
+	return BIBL_OK;
+}
+
+int
+bibl_load( bibl *b, FILE *fp )
+{
+	biblcache_file f;
+	unsigned long len;
+	int status;
+	char *buf;
+
+	if ( !b || !fp ) return BIBL_ERR_BADINPUT;
+
+	status = source_readall( fp, &buf, &len, 0 );
+	if ( status==SOURCE_ERR_MEMERR ) return BIBL_ERR_MEMERR;
+	if ( status!=SOURCE_OK ) return BIBL_ERR_CANTOPEN;
+
+	status = biblcache_check( &f, ( unsigned char * ) buf, len );
+	if ( status==BIBL_OK ) status = biblcache_build( b, &f );
+
+	free( buf );
+
+	return status;
+}
+
+/*****************************************************
+ PUBLIC: int bibl_issaved()
+*****************************************************/
+
+int
+bibl_issaved( FILE *fp )
+{
+	char magic[BIBLCACHE_MAGICLEN];
+	size_t n;
+
+	n = fread( magic, 1, BIBLCACHE_MAGICLEN, fp );
+	rewind( fp );
+
+	return ( n==BIBLCACHE_MAGICLEN && !memcmp( magic, BIBLCACHE_MAGIC, BIBLCACHE_MAGICLEN ) );
+}
@@ -0,0 +1,29 @@
+/*
+ * biblcache.h
+ *
+ * Copyright (c) Chris Putnam 2021
+ *
+ * Source code released under the GPL version 2
+ *
+ */
+#ifndef BIBLCACHE_H
+#define BIBLCACHE_H
+
+#include <stdio.h>
+#include "bibl.h"
+
+/* Save the converted references of a bibl (as left by bibl_read(),
+ * before bibl_write()) to a binary file, and load them back without
+ * parsing the original input. bibl_load() appends to b, as bibl_read()
+ * does, and returns BIBL_ERR_BADINPUT for files it does not recognize
+ * or that are damaged.
+ */
+int bibl_save( bibl *b, FILE *fp );
+int bibl_load( bibl *b, FILE *fp );
+
+/* Peek at a seekable fp for the bibl_save() signature, leaving fp at
+ * its start.
+ */
+int bibl_issaved( FILE *fp );
+
+#endif
@@ -0,0 +1,498 @@
+/*
+ * biblinc.c
+ *
+ * Copyright (c) Chris Putnam 2021
+ *
+ * Source code released under the GPL version 2
+ *
+ * Saved caches use unsigned 32-bit little-endian integers, with 64-bit
+ * values as two of them, low word first:
+ *
+ *    "BIBLINC1" version settings(2) nentries datalen(2)
+ *    nentries x { hash(2) off(2) len(2) }
+ *    data
+ *
+ * and each entry's data is
+ *
+ *    haskey key finalkey nfields
+ *    nfields x { level tag value lang }   level in two's complement
+ *    outlen(2) output
+ *
+ * with the strings '\0'-ended.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bibdefs.h"
+#include "biblinc.h"
+
+#define BIBLINC_MAGIC    "BIBLINC1"
+#define BIBLINC_MAGICLEN (8)
+#define BIBLINC_HEADER   (BIBLINC_MAGICLEN+6*4)
+
+void
+biblinc_init( biblinc *c )
+{
+	c->settings = 0;
+	c->n        = c->max = 0;
+	c->hash     = NULL;
+	c->off      = NULL;
+	c->len      = NULL;
+	c->data     = NULL;
+	c->datalen  = c->datamax = 0;
+	c->sorted   = NULL;
+}
+
+void
+biblinc_free( biblinc *c )
+{
+	if ( c->hash )   free( c->hash );
+	if ( c->off )    free( c->off );
+	if ( c->len )    free( c->len );
+	if ( c->data )   free( c->data );
+	if ( c->sorted ) free( c->sorted );
+	biblinc_init( c );
+}
+
+static int
+biblinc_growentries( biblinc *c, long alloc )
+{
+	unsigned long *off, *len;
+	uint64_t *hash;
+
+	hash = ( uint64_t * ) realloc( c->hash, sizeof( uint64_t ) * alloc );
+	if ( !hash ) return BIBL_ERR_MEMERR;
+	c->hash = hash;
+
+	off = ( unsigned long * ) realloc( c->off, sizeof( unsigned long ) * alloc );
+	if ( !off ) return BIBL_ERR_MEMERR;
+	c->off = off;
+
+	len = ( unsigned long * ) realloc( c->len, sizeof( unsigned long ) * alloc );
+	if ( !len ) return BIBL_ERR_MEMERR;
+	c->len = len;
+
+	c->max = alloc;
+
+	return BIBL_OK;
+}
+
+static int
+biblinc_growdata( biblinc *c, unsigned long need )
+{
+	unsigned long alloc;
+	char *more;
+
+	if ( need <= c->datamax ) return BIBL_OK;
+
+	alloc = ( c->datamax ) ? c->datamax : 65536;
+	while ( alloc < need ) alloc *= 2;
+
+	more = ( char * ) realloc( c->data, alloc );
+	if ( !more ) return BIBL_ERR_MEMERR;
+
+	c->data    = more;
+	c->datamax = alloc;
+
+	return BIBL_OK;
+}
+
+/*****************************************************
+ PUBLIC: int biblinc_add()
+*****************************************************/
+
+static void
+biblinc_putword( char *p, unsigned int v )
+{
+	p[0] = v & 0xff;
+	p[1] = ( v >> 8 ) & 0xff;
+	p[2] = ( v >> 16 ) & 0xff;
+	p[3] = ( v >> 24 ) & 0xff;
+}
+
+static void
+biblinc_put( biblinc *c, unsigned int v )
+{
+	biblinc_putword( c->data + c->datalen, v );
+	c->datalen += 4;
+}
+
+static void
+biblinc_puts( biblinc *c, const char *s, unsigned long len )
+{
+	if ( len ) memcpy( c->data + c->datalen, s, len );
+	c->data[ c->datalen + len ] = '\0';
+	c->datalen += len + 1;
+}
+
+static int
+biblinc_addentry( biblinc *c, uint64_t hash, unsigned long off )
+{
+	int status;
+
+	if ( c->n == c->max ) {
+		status = biblinc_growentries( c, ( c->max ) ? c->max * 2 : 1024 );
+		if ( status!=BIBL_OK ) return status;
+	}
+
+	c->hash[ c->n ] = hash;
+	c->off[ c->n ]  = off;
+	c->len[ c->n ]  = c->datalen - off;
+	c->n++;
+
+	return BIBL_OK;
+}
+
+/* biblinc_add()
+ *
+ * Add an entry for the record with fingerprint hash, read into ref
+ * (before citekeys are made unique) and written as output.
+ */
+int
+biblinc_add( biblinc *c, uint64_t hash, int haskey, const char *key, const char *finalkey,
+		fields *ref, const char *output, unsigned long outlen )
+{
+	unsigned long off = c->datalen, need;
+	fields_entry *e;
+	int i, status;
+
+	need = 4 + strlen( key ) + 1 + strlen( finalkey ) + 1 + 4 + 8 + outlen;
+	for ( i=0; i<ref->n; ++i ) {
+		e = ref->entries[i];
+		need += 4 + e->tag.len + 1 + e->value.len + 1 + e->language.len + 1;
+	}
+
+	status = biblinc_growdata( c, c->datalen + need );
+	if ( status!=BIBL_OK ) return status;
+
+	biblinc_put( c, ( haskey!=0 ) );
+	biblinc_puts( c, key, strlen( key ) );
+	biblinc_puts( c, finalkey, strlen( finalkey ) );
+	biblinc_put( c, ref->n );
+	for ( i=0; i<ref->n; ++i ) {
+		e = ref->entries[i];
+		biblinc_put( c, ( unsigned int ) e->level );
+		biblinc_puts( c, str_cstr( &(e->tag) ), e->tag.len );
+		biblinc_puts( c, str_cstr( &(e->value) ), e->value.len );
+		biblinc_puts( c, str_cstr( &(e->language) ), e->language.len );
+	}
+	biblinc_put( c, outlen & 0xffffffffUL );
+	biblinc_put( c, ( outlen >> 16 ) >> 16 );
+	if ( outlen ) memcpy( c->data + c->datalen, output, outlen );
+	c->datalen += outlen;
+
+	return biblinc_addentry( c, hash, off );
+}
+
+/* biblinc_addcopy()
+ *
+ * Add entry i of from, unchanged, for the record with fingerprint hash.
+ */
+int
+biblinc_addcopy( biblinc *c, biblinc *from, long i, uint64_t hash )
+{
+	unsigned long off = c->datalen;
+	int status;
+
+	status = biblinc_growdata( c, c->datalen + from->len[i] );
+	if ( status!=BIBL_OK ) return status;
+
+	memcpy( c->data + c->datalen, from->data + from->off[i], from->len[i] );
+	c->datalen += from->len[i];
+
+	return biblinc_addentry( c, hash, off );
+}
+
+/*****************************************************
+ PUBLIC: void biblinc_get()
+*****************************************************/
+
+static unsigned int
+biblinc_get32( const char *p )
+{
+	const unsigned char *q = ( const unsigned char * ) p;
+	return ( unsigned int ) q[0] | ( ( unsigned int ) q[1] << 8 ) |
+		( ( unsigned int ) q[2] << 16 ) | ( ( unsigned int ) q[3] << 24 );
+}
+
+static unsigned long
+biblinc_get64( const char *p )
+{
+	return ( unsigned long ) biblinc_get32( p ) | ( ( ( unsigned long ) biblinc_get32( p + 4 ) << 16 ) << 16 );
+}
+
+/* biblinc_parse()
+ *
+ * Unpack the len bytes of an entry at p, checking that everything lies
+ * inside them; returns BIBL_ERR_BADINPUT if not.
+ */
+static int
+biblinc_parse( const char *p, unsigned long len, biblinc_ref *r )
+{
+	const char *end = p + len, *q;
+	unsigned int i, j;
+
+	if ( len < 4 ) return BIBL_ERR_BADINPUT;
+	r->haskey = biblinc_get32( p );
+	if ( r->haskey > 1 ) return BIBL_ERR_BADINPUT;
+	q = p + 4;
+
+	r->key = q;
+	q = memchr( q, '\0', end - q );
+	if ( !q ) return BIBL_ERR_BADINPUT;
+	r->finalkey = ++q;
+	q = memchr( q, '\0', end - q );
+	if ( !q ) return BIBL_ERR_BADINPUT;
+	q++;
+
+	if ( end - q < 4 ) return BIBL_ERR_BADINPUT;
+	r->nfields = biblinc_get32( q );
+	q += 4;
+	r->fields = q;
+	for ( i=0; i<r->nfields; ++i ) {
+		if ( end - q < 4 ) return BIBL_ERR_BADINPUT;
+		q += 4;
+		for ( j=0; j<3; ++j ) {
+			q = memchr( q, '\0', end - q );
+			if ( !q ) return BIBL_ERR_BADINPUT;
+			q++;
+		}
+	}
+
+	if ( end - q < 8 ) return BIBL_ERR_BADINPUT;
+	r->outlen = biblinc_get64( q );
+	q += 8;
+	if ( r->outlen != ( unsigned long ) ( end - q ) ) return BIBL_ERR_BADINPUT;
+	r->output = q;
+
+	return BIBL_OK;
+}
+
+void
+biblinc_get( biblinc *c, long i, biblinc_ref *r )
+{
+	/* entries were checked when they were added or loaded */
+	biblinc_parse( c->data + c->off[i], c->len[i], r );
+}
+
+int
+biblinc_getfields( biblinc_ref *r, fields *f )
+{
+	const char *q = r->fields, *tag, *value, *lang;
+	unsigned int i;
+	int level;
+
+	for ( i=0; i<r->nfields; ++i ) {
+		level = ( int ) biblinc_get32( q );
+		tag   = q + 4;
+		value = tag + strlen( tag ) + 1;
+		lang  = value + strlen( value ) + 1;
+		q     = lang + strlen( lang ) + 1;
+		if ( _fields_add( f, tag, value, ( lang[0] ) ? lang : NULL, level, FIELDS_CAN_DUP )!=FIELDS_OK )
+			return BIBL_ERR_MEMERR;
+	}
+
+	return BIBL_OK;
+}
+
+/*****************************************************
+ PUBLIC: long biblinc_find()
+*****************************************************/
+
+typedef struct {
+	uint64_t hash;
+	long     index;
+} biblinc_key;
+
+static int
+biblinc_cmp( const void *a, const void *b )
+{
+	const biblinc_key *ka = ( const biblinc_key * ) a;
+	const biblinc_key *kb = ( const biblinc_key * ) b;
+	if ( ka->hash < kb->hash ) return -1;
+	if ( ka->hash > kb->hash ) return 1;
+	if ( ka->index < kb->index ) return -1;
+	if ( ka->index > kb->index ) return 1;
+	return 0;
+}
+
+/* biblinc_sort()
+ *
+ * Sort {hash, index} pairs so the comparator needs no global state
+ * and concurrent loads cannot clobber each other.
+ */
+static int
+biblinc_sort( biblinc *c )
+{
+	biblinc_key *keys;
+	long i;
+
+	if ( c->sorted ) free( c->sorted );
+	c->sorted = NULL;
+	if ( c->n==0 ) return BIBL_OK;
+
+	keys = ( biblinc_key * ) malloc( sizeof( biblinc_key ) * c->n );
+	if ( !keys ) return BIBL_ERR_MEMERR;
+
+	c->sorted = ( long * ) malloc( sizeof( long ) * c->n );
+	if ( !c->sorted ) {
+		free( keys );
+		return BIBL_ERR_MEMERR;
+	}
+
+	for ( i=0; i<c->n; ++i ) {
+		keys[i].hash  = c->hash[i];
+		keys[i].index = i;
+	}
+
+	qsort( keys, c->n, sizeof( biblinc_key ), biblinc_cmp );
+
+	for ( i=0; i<c->n; ++i )
+		c->sorted[i] = keys[i].index;
+
+	free( keys );
+
+	return BIBL_OK;
+}
+
+/* biblinc_find()
+ *
+ * Return an entry with fingerprint hash, or -1. Only for loaded caches.
+ */
+long
+biblinc_find( biblinc *c, uint64_t hash )
+{
+	long lo = 0, hi = c->n - 1, mid;
+	uint64_t h;
+
+	if ( !c->sorted ) return -1;
+
+	while ( lo <= hi ) {
+		mid = lo + ( hi - lo ) / 2;
+		h = c->hash[ c->sorted[mid] ];
+		if ( h == hash ) return c->sorted[mid];
+		if ( h < hash ) lo = mid + 1;
+		else hi = mid - 1;
+	}
+
+	return -1;
+}
+
+/*****************************************************
+ PUBLIC: int biblinc_save()
+*****************************************************/
+
+static void
+biblinc_fput( FILE *fp, unsigned int v )
+{
+	char buf[4];
+	biblinc_putword( buf, v );
+	fwrite( buf, 1, 4, fp );
+}
+
+static void
+biblinc_fput2( FILE *fp, uint64_t v )
+{
+	biblinc_fput( fp, ( unsigned int ) ( v & 0xffffffffU ) );
+	biblinc_fput( fp, ( unsigned int ) ( v >> 32 ) );
+}
+
+int
+biblinc_save( biblinc *c, FILE *fp )
+{
+	long i;
+
+	if ( !c || !fp ) return BIBL_ERR_BADINPUT;
+	if ( c->n > 0xffffffffL ) return BIBL_ERR_MEMERR;
+
+	fwrite( BIBLINC_MAGIC, 1, BIBLINC_MAGICLEN, fp );
+	biblinc_fput( fp, BIBLINC_VERSION );
+	biblinc_fput2( fp, c->settings );
+	biblinc_fput( fp, c->n );
+	biblinc_fput2( fp, c->datalen );
+
+	for ( i=0; i<c->n; ++i ) {
+		biblinc_fput2( fp, c->hash[i] );
+		biblinc_fput2( fp, c->off[i] );
+		biblinc_fput2( fp, c->len[i] );
+	}
+
+	if ( c->datalen ) fwrite( c->data, 1, c->datalen, fp );
+
+	if ( fflush( fp ) || ferror( fp ) ) return BIBL_ERR_CANTOPEN;
+
+	return BIBL_OK;
+}
+
+/*****************************************************
+ PUBLIC: int biblinc_load()
+*****************************************************/
+
+static int
+biblinc_read( biblinc *c, FILE *fp )
+{
+	char head[BIBLINC_HEADER], rec[24];
+	unsigned long n, datalen, i;
+	biblinc_ref r;
+	int status;
+
+	if ( fread( head, 1, BIBLINC_HEADER, fp )!=BIBLINC_HEADER ) return BIBL_ERR_BADINPUT;
+	if ( memcmp( head, BIBLINC_MAGIC, BIBLINC_MAGICLEN ) ) return BIBL_ERR_BADINPUT;
+	if ( biblinc_get32( head + 8 )!=BIBLINC_VERSION ) return BIBL_ERR_BADINPUT;
+
+	c->settings = ( uint64_t ) biblinc_get32( head + 12 ) | ( ( uint64_t ) biblinc_get32( head + 16 ) << 32 );
+	n           = biblinc_get32( head + 20 );
+	datalen     = biblinc_get64( head + 24 );
+
+	/* grow as the file is read, so a damaged count cannot ask for more
+	 * memory than the file holds */
+	for ( i=0; i<n; ++i ) {
+		if ( fread( rec, 1, 24, fp )!=24 ) return BIBL_ERR_BADINPUT;
+		if ( c->n == c->max ) {
+			status = biblinc_growentries( c, ( c->max ) ? c->max * 2 : 1024 );
+			if ( status!=BIBL_OK ) return status;
+		}
+		c->hash[i] = ( uint64_t ) biblinc_get32( rec ) | ( ( uint64_t ) biblinc_get32( rec + 4 ) << 32 );
+		c->off[i]  = biblinc_get64( rec + 8 );
+		c->len[i]  = biblinc_get64( rec + 16 );
+		if ( c->off[i] > datalen || c->len[i] > datalen - c->off[i] ) return BIBL_ERR_BADINPUT;
+		c->n++;
+	}
+
+	while ( c->datalen < datalen ) {
+		i = datalen - c->datalen;
+		if ( i > 1048576 ) i = 1048576;
+		status = biblinc_growdata( c, c->datalen + i );
+		if ( status!=BIBL_OK ) return status;
+		if ( fread( c->data + c->datalen, 1, i, fp )!=i ) return BIBL_ERR_BADINPUT;
+		c->datalen += i;
+	}
+
+	for ( i=0; i<c->n; ++i ) {
+		status = biblinc_parse( c->data + c->off[i], c->len[i], &r );
+		if ( status!=BIBL_OK ) return status;
+	}
+
+	return biblinc_sort( c );
+}
+
+/* biblinc_load()
+ *
+ * Replace the contents of c with a cache saved by biblinc_save().
+ * Returns BIBL_ERR_BADINPUT for files that are not caches or are
+ * damaged, leaving c empty.
+ */
+int
+biblinc_load( biblinc *c, FILE *fp )
+{
+	int status;
+
+	if ( !c || !fp ) return BIBL_ERR_BADINPUT;
+
+	biblinc_free( c );
+
+	status = biblinc_read( c, fp );
+	if ( status!=BIBL_OK ) biblinc_free( c );
+
+	return status;
+}
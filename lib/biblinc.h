@@ -0,0 +1,69 @@
+/*
+ * biblinc.h
+ *
+ * Copyright (c) Chris Putnam 2021
+ *
+ * Source code released under the GPL version 2
+ *
+ */
+#ifndef BIBLINC_H
+#define BIBLINC_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include "fields.h"
+
+/* Version of the cache, saved in its header and part of the settings
+ * fingerprint. Bump it whenever the file layout or the output written
+ * for a reference can change, so that older caches are not reused.
+ */
+#define BIBLINC_VERSION (1)
+
+/* Cache of converted references for incremental conversion, kept in a
+ * file beside the output between runs.
+ *
+ * Entry i is for the input record with fingerprint hash[i], and holds
+ * data[off[i], off[i]+len[i]): the citekey the record was read with,
+ * the citekey it was written with, its converted fields and the output
+ * written for it. settings is a fingerprint of the conversion options;
+ * a cache is only used by runs with the same settings.
+ */
+typedef struct biblinc {
+	uint64_t      settings;
+	long          n, max;
+	uint64_t      *hash;
+	unsigned long *off, *len;
+	char          *data;
+	unsigned long datalen, datamax;
+	long          *sorted;     /* entries by hash, for biblinc_find() */
+} biblinc;
+
+/* An entry as unpacked by biblinc_get(); the pointers are into the
+ * cache. key is the REFNUM the record was read with if haskey, else
+ * the citekey made from its author and year, or "" if it has neither.
+ */
+typedef struct biblinc_ref {
+	int           haskey;
+	const char    *key;
+	const char    *finalkey;
+	const char    *fields;
+	unsigned int  nfields;
+	const char    *output;
+	unsigned long outlen;
+} biblinc_ref;
+
+void biblinc_init( biblinc *c );
+void biblinc_free( biblinc *c );
+
+int  biblinc_load( biblinc *c, FILE *fp );
+int  biblinc_save( biblinc *c, FILE *fp );
+
+long biblinc_find( biblinc *c, uint64_t hash );
+void biblinc_get( biblinc *c, long i, biblinc_ref *r );
+int  biblinc_getfields( biblinc_ref *r, fields *f );
+
+int  biblinc_add( biblinc *c, uint64_t hash, int haskey, const char *key, const char *finalkey,
+		fields *ref, const char *output, unsigned long outlen );
+int  biblinc_addcopy( biblinc *c, biblinc *from, long i, uint64_t hash );
+
+#endif
@@ -0,0 +1,251 @@
+/*
+ * biblstore.c
+ *
+ * Copyright (c) Chris Putnam 2021
+ *
+ * Source code released under the GPL version 2
+ *
+ */
+#include <stdlib.h>
+#include <string.h>
+#include "bibdefs.h"
+#include "biblstore.h"
+
+void
+biblstore_init( biblstore *s )
+{
+	s->n         = s->max = 0;
+	s->refstart  = NULL;
+	s->nfields   = s->maxfields = 0;
+	s->tag       = NULL;
+	s->level     = NULL;
+	s->lang      = NULL;
+	s->value     = NULL;
+	s->heap      = NULL;
+	s->heaplen   = s->heapmax = 0;
+	namelist_init( &(s->names) );
+}
+
+void
+biblstore_free( biblstore *s )
+{
+	if ( s->refstart ) free( s->refstart );
+	if ( s->tag )      free( s->tag );
+	if ( s->level )    free( s->level );
+	if ( s->lang )     free( s->lang );
+	if ( s->value )    free( s->value );
+	if ( s->heap )     free( s->heap );
+	namelist_free( &(s->names) );
+	biblstore_init( s );
+}
+
+static int
+biblstore_growrefs( biblstore *s )
+{
+	unsigned long *more;
+	long alloc;
+
+	alloc = ( s->max ) ? s->max * 2 : 1024;
+	more = ( unsigned long * ) realloc( s->refstart, sizeof( unsigned long ) * ( alloc + 1 ) );
+	if ( !more ) return BIBL_ERR_MEMERR;
+
+	if ( !s->refstart ) more[0] = 0;
+	s->refstart = more;
+	s->max      = alloc;
+
+	return BIBL_OK;
+}
+
+/* biblstore_growfields()
+ *
+ * Make room for at least n more fields. The columns are reallocated
+ * one by one, and only committed to maxfields once all have grown.
+ */
+static int
+biblstore_growfields( biblstore *s, unsigned long n )
+{
+	unsigned long alloc;
+	void *more;
+
+	if ( s->nfields + n <= s->maxfields ) return BIBL_OK;
+
+	alloc = ( s->maxfields ) ? s->maxfields * 2 : 8192;
+	while ( alloc < s->nfields + n ) alloc *= 2;
+
+	more = realloc( s->tag, sizeof( int ) * alloc );
+	if ( !more ) return BIBL_ERR_MEMERR;
+	s->tag = ( int * ) more;
+
+	more = realloc( s->level, sizeof( signed char ) * alloc );
+	if ( !more ) return BIBL_ERR_MEMERR;
+	s->level = ( signed char * ) more;
+
+	more = realloc( s->lang, sizeof( int ) * alloc );
+	if ( !more ) return BIBL_ERR_MEMERR;
+	s->lang = ( int * ) more;
+
+	more = realloc( s->value, sizeof( unsigned long ) * alloc );
+	if ( !more ) return BIBL_ERR_MEMERR;
+	s->value = ( unsigned long * ) more;
+
+	s->maxfields = alloc;
+
+	return BIBL_OK;
+}
+
+static int
+biblstore_addvalue( biblstore *s, str *value, unsigned long *offset )
+{
+	unsigned long alloc;
+	char *more;
+
+	if ( s->heaplen + value->len + 1 > s->heapmax ) {
+		alloc = ( s->heapmax ) ? s->heapmax * 2 : 65536;
+		while ( alloc < s->heaplen + value->len + 1 ) alloc *= 2;
+		more = ( char * ) realloc( s->heap, alloc );
+		if ( !more ) return BIBL_ERR_MEMERR;
+		s->heap    = more;
+		s->heapmax = alloc;
+	}
+
+	*offset = s->heaplen;
+	if ( value->len ) memcpy( s->heap + s->heaplen, value->data, value->len );
+	s->heaplen += value->len;
+	s->heap[ s->heaplen++ ] = '\0';
+
+	return BIBL_OK;
+}
+
+/* biblstore_intern()
+ *
+ * Return the id of name in s->names, adding it if needed, or -1 on a
+ * memory error.
+ */
+static int
+biblstore_intern( biblstore *s, str *name )
+{
+	int n;
+
+	n = namelist_find( &(s->names), name );
+	if ( n!=-1 ) return n;
+
+	if ( namelist_add( &(s->names), str_cstr( name ) )!=NAMELIST_OK ) return -1;
+
+	return s->names.names.n - 1;
+}
+
+/* biblstore_addref()
+ *
+ * Append a copy of ref. The used flags are not kept.
+ */
+int
+biblstore_addref( biblstore *s, fields *ref )
+{
+	unsigned long k, offset;
+	fields_entry *e;
+	int i, tag, lang;
+
+	if ( s->n == s->max && biblstore_growrefs( s )!=BIBL_OK ) return BIBL_ERR_MEMERR;
+	if ( biblstore_growfields( s, ref->n )!=BIBL_OK ) return BIBL_ERR_MEMERR;
+
+	k = s->nfields;
+
+	for ( i=0; i<ref->n; ++i ) {
+
+		e = ref->entries[i];
+		if ( e->level < -128 || e->level > 127 ) return BIBL_ERR_BADINPUT;
+
+		tag = biblstore_intern( s, &(e->tag) );
+		if ( tag==-1 ) return BIBL_ERR_MEMERR;
+
+		if ( e->language.len ) {
+			lang = biblstore_intern( s, &(e->language) );
+			if ( lang==-1 ) return BIBL_ERR_MEMERR;
+		} else lang = BIBLSTORE_NOLANG;
+
+		if ( biblstore_addvalue( s, &(e->value), &offset )!=BIBL_OK ) return BIBL_ERR_MEMERR;
+
+		s->tag[k]   = tag;
+		s->level[k] = ( signed char ) e->level;
+		s->lang[k]  = lang;
+		s->value[k] = offset;
+		k++;
+
+	}
+
+	/* commit the reference only once all of its fields are in */
+	s->nfields = k;
+	s->n++;
+	s->refstart[ s->n ] = k;
+
+	return BIBL_OK;
+}
+
+/* biblstore_addbibl()
+ *
+ * Move the references of b into s, freeing each as it goes so the two
+ * copies are never held at once; b is left empty.
+ */
+int
+biblstore_addbibl( biblstore *s, bibl *b )
+{
+	int status = BIBL_OK;
+	long i;
+
+	for ( i=0; i<b->n; ++i ) {
+		status = biblstore_addref( s, b->ref[i] );
+		if ( status!=BIBL_OK ) break;
+		fields_delete( b->ref[i] );
+		b->ref[i] = NULL;
+	}
+
+	/* keep any references not moved */
+	if ( i ) {
+		memmove( b->ref, b->ref + i, sizeof( fields * ) * ( b->n - i ) );
+		b->n -= i;
+	}
+
+	return status;
+}
+
+/* biblstore_getref()
+ *
+ * Fill out with reference i. out is emptied first, so one fields can
+ * be reused across references.
+ */
+int
+biblstore_getref( biblstore *s, long i, fields *out )
+{
+	const char *lang;
+	unsigned long k;
+	int status;
+
+	if ( i < 0 || i >= s->n ) return BIBL_ERR_BADINPUT;
+
+	fields_empty( out );
+
+	for ( k=s->refstart[i]; k<s->refstart[i+1]; ++k ) {
+		lang = ( s->lang[k]==BIBLSTORE_NOLANG ) ? NULL : slist_cstr( &(s->names.names), s->lang[k] );
+		status = _fields_add( out, slist_cstr( &(s->names.names), s->tag[k] ), s->heap + s->value[k],
+				lang, s->level[k], FIELDS_CAN_DUP );
+		if ( status!=FIELDS_OK ) return BIBL_ERR_MEMERR;
+	}
+
+	return BIBL_OK;
+}
+
+/* biblstore_size()
+ *
+ * Bytes allocated for the columns and heap, not counting the names.
+ */
+unsigned long
+biblstore_size( biblstore *s )
+{
+	unsigned long size;
+
+	size  = sizeof( unsigned long ) * ( s->max + ( s->refstart ? 1 : 0 ) );
+	size += ( sizeof( int ) * 2 + sizeof( signed char ) + sizeof( unsigned long ) ) * s->maxfields;
+	size += s->heapmax;
+
+	return size;
+}
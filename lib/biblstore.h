@@ -0,0 +1,49 @@
+/*
+ * biblstore.h
+ *
+ * Copyright (c) Chris Putnam 2021
+ *
+ * Source code released under the GPL version 2
+ *
+ */
+#ifndef BIBLSTORE_H
+#define BIBLSTORE_H
+
+#include "bibl.h"
+#include "fields.h"
+#include "namelist.h"
+
+#define BIBLSTORE_NOLANG (-1)
+
+/* Compact, column-wise store for large sets of converted references.
+ *
+ * Field k of the store belongs to reference i for refstart[i] <= k <
+ * refstart[i+1]. Tags and languages are interned in names and kept as
+ * ids; values are '\0'-terminated strings in heap. Readers and writers
+ * work on one reference at a time through biblstore_getref(), which
+ * fills an ordinary fields with the usual fields_*() accessors.
+ */
+typedef struct biblstore {
+	long          n, max;      /* references */
+	unsigned long *refstart;   /* n+1 entries */
+
+	unsigned long nfields, maxfields;
+	int           *tag;        /* id in names */
+	signed char   *level;
+	int           *lang;       /* id in names, or BIBLSTORE_NOLANG */
+	unsigned long *value;      /* offset in heap */
+
+	char          *heap;
+	unsigned long heaplen, heapmax;
+
+	namelist      names;
+} biblstore;
+
+void biblstore_init( biblstore *s );
+void biblstore_free( biblstore *s );
+int  biblstore_addref( biblstore *s, fields *ref );
+int  biblstore_addbibl( biblstore *s, bibl *b );
+int  biblstore_getref( biblstore *s, long i, fields *out );
+unsigned long biblstore_size( biblstore *s );
+
+#endif
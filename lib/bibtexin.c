@@ -25,9 +25,8 @@
 #include "latex_parse.h"
 #include "bibformats.h"
 #include "generic.h"
-
-static slist find    = { 0, 0, 0, NULL };
-static slist replace = { 0, 0, 0, NULL };
+#include "macros.h"
+#include "tokens.h"
 
 extern variants bibtex_all[];
 extern int bibtex_nall;
@@ -39,7 +38,7 @@ extern int bibtex_nall;
 static int bibtexin_convertf( fields *bibin, fields *info, int reftype, param *p );
 static int bibtexin_processf( fields *bibin, const char *data, const char *filename, long nref, param *p );
 static int bibtexin_cleanf( bibl *bin, param *p );
-static int bibtexin_readf( FILE *fp, char *buf, int bufsize, int *bufpos, str *line, str *reference, int *fcharset );
+static int bibtexin_readf( source *src, char *buf, int bufsize, int *bufpos, str *line, str *reference, int *fcharset );
 static int bibtexin_typef( fields *bibin, const char *filename, int nrefs, param *p );
 
 int
@@ -64,8 +63,11 @@ bibtexin_initparams( param *pm, const char *progname )
 	pm->all      = bibtex_all;
 	pm->nall     = bibtex_nall;
 
-	slist_init( &(pm->asis) );
-	slist_init( &(pm->corps) );
+	namelist_init( &(pm->asis) );
+	namelist_init( &(pm->corps) );
+	pm->names = NULL;
+	pm->strings = macros_new();
+	if ( !pm->strings ) return BIBL_ERR_MEMERR;
 
 	if ( !progname ) pm->progname = NULL;
 	else {
@@ -89,10 +91,10 @@ bibtexin_initparams( param *pm, const char *progname )
  *
  */
 static int
-readmore( FILE *fp, char *buf, int bufsize, int *bufpos, str *line )
+readmore( source *src, char *buf, int bufsize, int *bufpos, str *line )
 {
 	if ( line->len ) return 1;
-	else return str_fget( fp, buf, bufsize, bufpos, line );
+	else return source_fget( src, buf, bufsize, bufpos, line );
 }
 
 /*
@@ -102,12 +104,12 @@ readmore( FILE *fp, char *buf, int bufsize, int *bufpos, str *line )
  * returns 1 if last reference in file, 2 if reference within file
  */
 static int
-bibtexin_readf( FILE *fp, char *buf, int bufsize, int *bufpos, str *line, str *reference, int *fcharset )
+bibtexin_readf( source *src, char *buf, int bufsize, int *bufpos, str *line, str *reference, int *fcharset )
 {
 	int haveref = 0;
 	const char *p;
 	*fcharset = CHARSET_UNKNOWN;
-	while ( haveref!=2 && readmore( fp, buf, bufsize, bufpos, line ) ) {
+	while ( haveref!=2 && readmore( src, buf, bufsize, bufpos, line ) ) {
 		if ( line->len == 0 ) continue; /* blank line */
 		p = str_cstr( line );
 		/* Recognize UTF8 BOM */
@@ -142,6 +144,7 @@ typedef struct loc {
 	const char *progname;
 	const char *filename;
 	long nref;
+	macros *strings;
 } loc;
 
 /* process_bibtextype()
@@ -241,30 +244,17 @@ char_is_escaped( int nquotes, int nbraces )
 	return 0;
 }
 
-static int
-add_token( slist *tokens, str *token )
-{
-	int status;
-
-	if ( str_memerr( token ) ) return BIBL_ERR_MEMERR;
-
-	status = slist_add( tokens, token );
-	if ( status!=SLIST_OK ) return BIBL_ERR_MEMERR;
-
-	str_empty( token );
-
-	return BIBL_OK;
-}
-
+/* bibtex_data()
+ *
+ * Split the value after '=' into tokens: braced or quoted literals,
+ * bare words (macros or numbers), and the '#' concatenation operator.
+ * The tokens are spans of the buffer; nothing is copied here.
+ */
 static const char *
-bibtex_data( const char *p, slist *tokens, loc *currloc )
+bibtex_data( const char *p, tokens *toks, loc *currloc )
 {
-	int nbraces = 0, nquotes = 0;
-	const char *startp = p;
-	int status;
-	str token;
-
-	str_init( &token );
+	int nbraces = 0, nquotes = 0, newlines = 0;
+	const char *startp = p, *tok = NULL, *end = NULL;
 
 	while ( p && *p ) {
 
@@ -274,30 +264,35 @@ bibtex_data( const char *p, slist *tokens, loc *currloc )
 		}
 
 		if ( *p=='\"' ) {
-			str_addchar( &token, *p );
+			if ( !tok ) tok = p;
+			end = p + 1;
 			if ( !quotation_mark_is_escaped( nbraces, p, startp ) ) {
 				nquotes = !nquotes;
 				if ( nquotes==0 ) {
-					status = add_token( tokens, &token );
-					if ( status!=BIBL_OK ) { p=NULL; goto out0; }
+					if ( tokens_add( toks, tok, end - tok, newlines )!=TOKENS_OK ) return NULL;
+					tok = NULL;
+					newlines = 0;
 				}
 			}
 		}
 
 		else if ( *p=='{' ) {
-			str_addchar( &token, *p );
+			if ( !tok ) tok = p;
+			end = p + 1;
 			if ( !brace_is_escaped( nquotes, p, startp ) ) {
 				nbraces++;
 			}
 		}
 
 		else if ( *p=='}' ) {
-			str_addchar( &token, *p );
+			if ( !tok ) tok = p;
+			end = p + 1;
 			if ( !brace_is_escaped( nquotes, p, startp ) ) {
 				nbraces--;
 				if ( nbraces==0 ) {
-					status = add_token( tokens, &token );
-					if ( status!=BIBL_OK ) { p=NULL; goto out0; }
+					if ( tokens_add( toks, tok, end - tok, newlines )!=TOKENS_OK ) return NULL;
+					tok = NULL;
+					newlines = 0;
 				}
 				if ( nbraces<0 ) {
 					goto out;
@@ -307,16 +302,17 @@ bibtex_data( const char *p, slist *tokens, loc *currloc )
 
 		else if ( *p=='#' ) {
 			if ( char_is_escaped( nquotes, nbraces ) ) {
-				str_addchar( &token, *p );
+				if ( !tok ) tok = p;
+				end = p + 1;
 			}
 			/* ...this is a bibtex string concatentation token */
 			else {
-				if ( str_has_value( &token ) ) {
-					status = add_token( tokens, &token );
-					if ( status!=BIBL_OK ) { p=NULL; goto out0; }
+				if ( tok ) {
+					if ( tokens_add( toks, tok, end - tok, newlines )!=TOKENS_OK ) return NULL;
+					tok = NULL;
+					newlines = 0;
 				}
-				status = slist_addc( tokens, "#" );
-				if ( status!=SLIST_OK ) { p=NULL; goto out0; }
+				if ( tokens_add( toks, p, 1, 0 )!=TOKENS_OK ) return NULL;
 			}
 		}
 
@@ -324,24 +320,25 @@ bibtex_data( const char *p, slist *tokens, loc *currloc )
 		else if ( !is_ws( *p ) || char_is_escaped( nquotes, nbraces ) ) {
 			/* always add non-whitespace characters */
 			if ( !is_ws( *p ) ) {
-				str_addchar( &token, *p );
+				if ( !tok ) tok = p;
+				end = p + 1;
 			}
-			/* only add whitespace if token is non-empty; convert CR/LF to space */
-			else if ( token.len!=0 ) {
-				if ( *p!='\n' && *p!='\r' )
-					str_addchar( &token, *p );
-				else {
-					str_addchar( &token, ' ' );
+			/* only add whitespace if token is non-empty; CR/LF become a space */
+			else if ( tok ) {
+				if ( *p=='\n' || *p=='\r' ) {
+					newlines = 1;
 					while ( is_ws( *(p+1) ) ) p++;
 				}
+				end = p + 1;
 			}
 		}
 
 		/* ...unescaped white-space marks the end of a token */
 		else if ( is_ws( *p ) ) {
-			if ( token.len ) {
-				status = add_token( tokens, &token );
-				if ( status!=BIBL_OK ) { p=NULL; goto out0; }
+			if ( tok ) {
+				if ( tokens_add( toks, tok, end - tok, newlines )!=TOKENS_OK ) return NULL;
+				tok = NULL;
+				newlines = 0;
 			}
 		}
 
@@ -354,13 +351,9 @@ out:
 	if ( nquotes!=0 ) {
 		fprintf( stderr, "%s: Mismatch in number of quotes in file %s reference %ld.\n", currloc->progname, currloc->filename, currloc->nref );
 	}
-	if ( str_has_value( &token ) ) {
-		if ( str_memerr( &token ) ) { p = NULL; goto out; }
-		status = slist_add( tokens, &token );
-		if ( status!=SLIST_OK ) p = NULL;
+	if ( tok ) {
+		if ( tokens_add( toks, tok, end - tok, newlines )!=TOKENS_OK ) return NULL;
 	}
-out0:
-	str_free( &token );
 	return p;
 }
 
@@ -369,22 +362,28 @@ out0:
 #define ESCAPED_BRACES (2)
 
 static int
-token_is_escaped( str *s )
+span_is_escaped( const char *p, unsigned long len )
 {
-	if ( s->data[0]=='\"' && s->data[s->len-1]=='\"' ) return ESCAPED_QUOTES;
-	if ( s->data[0]=='{'  && s->data[s->len-1]=='}'  ) return ESCAPED_BRACES;
+	if ( p[0]=='\"' && p[len-1]=='\"' ) return ESCAPED_QUOTES;
+	if ( p[0]=='{'  && p[len-1]=='}'  ) return ESCAPED_BRACES;
 	return NOT_ESCAPED;
 }
 
+static int
+token_is_escaped( str *s )
+{
+	return span_is_escaped( s->data, s->len );
+}
+
 /* replace_strings()
  *
  * do bibtex string replacement for data tokens
  */
 static int
-replace_strings( slist *tokens )
+replace_strings( slist *tokens, macros *strings )
 {
-	int i, n;
-	str *s;
+	str *s, *t;
+	int i;
 
 	for ( i=0; i<tokens->n; ++i ) {
 
@@ -396,10 +395,10 @@ replace_strings( slist *tokens )
 		/* ...skip if token is string concatentation symbol */
 		if ( !str_strcmpc( s, "#" ) ) continue;
 
-		n = slist_find( &find, s );
-		if ( slist_wasnotfound( &find, n ) ) continue;
+		t = macros_find( strings, s );
+		if ( !t ) continue;
 
-		str_strcpy( s, slist_str( &replace, n ) );
+		str_strcpy( s, t );
 		if ( str_memerr( s ) ) return BIBL_ERR_MEMERR;
 
 	}
@@ -494,16 +493,65 @@ merge_tokens_into_data( str *data, slist *tokens, int stripquotes )
 	else return BIBL_OK;
 }
 
+static int
+merge_literal_tokens( str *data, tokens *toks, int stripquotes )
+{
+	int i, esc_s;
+	token *t;
+
+	for ( i=0; i<toks->n; ++i ) {
+
+		t     = &(toks->tok[i]);
+		esc_s = span_is_escaped( t->p, t->len );
+
+		if ( ( esc_s == ESCAPED_BRACES ) ||
+		     ( stripquotes == STRIP_QUOTES && esc_s == ESCAPED_QUOTES ) )
+			token_cat( data, t, 1, 1 );
+		else
+			token_cat( data, t, 0, 0 );
+
+	}
+
+	if ( str_memerr( data ) ) return BIBL_ERR_MEMERR;
+	else return BIBL_OK;
+}
+
+/* rewrite_tokens()
+ *
+ * Macro substitution and '#' concatenation work on copies of the tokens.
+ */
+static int
+rewrite_tokens( str *data, tokens *toks, int stripquotes, loc *currloc )
+{
+	slist tokens;
+	int status;
+
+	slist_init( &tokens );
+
+	if ( tokens_to_slist( toks, &tokens )!=TOKENS_OK ) { status = BIBL_ERR_MEMERR; goto out; }
+
+	status = replace_strings( &tokens, currloc->strings );
+	if ( status!=BIBL_OK ) goto out;
+
+	status = string_concatenate( &tokens, currloc );
+	if ( status!=BIBL_OK ) goto out;
+
+	status = merge_tokens_into_data( data, &tokens, stripquotes );
+out:
+	slist_free( &tokens );
+	return status;
+}
+
 /* return NULL on memory error */
 static const char *
 process_bibtexline( const char *p, str *tag, str *data, uchar stripquotes, loc *currloc )
 {
-	slist tokens;
+	tokens toks;
 	int status;
 
 	str_empty( data );
 
-	slist_init( &tokens );
+	tokens_init( &toks );
 
 	p = bibtex_tag( skip_ws( p ), tag );
 	if ( p ) {
@@ -514,26 +562,19 @@ process_bibtexline( const char *p, str *tag, str *data, uchar stripquotes, loc *
 	}
 
 	if ( p && *p=='=' ) {
-		p = bibtex_data( p+1, &tokens, currloc );
-	}
-
-	if ( p ) {
-		status = replace_strings( &tokens );
-		if ( status!=BIBL_OK ) p = NULL;
-	}
-
-	if ( p ) {
-		status = string_concatenate( &tokens, currloc );
-		if ( status!=BIBL_OK ) p = NULL;
+		p = bibtex_data( p+1, &toks, currloc );
 	}
 
 	if ( p ) {
-		status = merge_tokens_into_data( data, &tokens, stripquotes );
+		if ( tokens_are_literal( &toks, currloc->strings ) )
+			status = merge_literal_tokens( data, &toks, stripquotes );
+		else
+			status = rewrite_tokens( data, &toks, stripquotes, currloc );
 		if ( status!=BIBL_OK ) p = NULL;
 	}
 
 out:
-	slist_free( &tokens );
+	tokens_free( &toks );
 	return p;
 }
 
@@ -589,8 +630,8 @@ out:
 static int
 process_string( const char *p, loc *currloc )
 {
-	int n, status = BIBL_OK;
-	str s1, s2, *t;
+	int status = BIBL_OK;
+	str s1, s2;
 
 	strs_init( &s1, &s2, NULL );
 
@@ -607,16 +648,8 @@ process_string( const char *p, loc *currloc )
 	}
 
 	if ( str_has_value( &s1 ) ) {
-		n = slist_find( &find, &s1 );
-		if ( n==-1 ) {
-			status = slist_add_ret( &find,    &s1, BIBL_OK, BIBL_ERR_MEMERR );
-			if ( status!=BIBL_OK ) goto out;
-			status = slist_add_ret( &replace, &s2, BIBL_OK, BIBL_ERR_MEMERR );
-			if ( status!=BIBL_OK ) goto out;
-		} else {
-			t = slist_set( &replace, n, &s2 );
-			if ( t==NULL ) { status = BIBL_ERR_MEMERR; goto out; }
-		}
+		if ( macros_add( currloc->strings, &s1, &s2 )!=MACROS_OK )
+			status = BIBL_ERR_MEMERR;
 	}
 
 out:
@@ -636,6 +669,7 @@ bibtexin_processf( fields *bibin, const char *data, const char *filename, long n
 	currloc.progname = pm->progname;
 	currloc.filename = filename;
 	currloc.nref     = nref;
+	currloc.strings  = pm->strings;
 
 	if ( !strncasecmp( data, "@STRING", 7 ) ) {
 		process_string( data+7, &currloc );
@@ -696,15 +730,15 @@ out:
 }
 
 static int
-bibtex_matches_list( fields *bibout, char *tag, char *suffix, str *data, int level, slist *names, int *match )
+bibtex_matches_list( fields *bibout, char *tag, char *suffix, str *data, int level, namelist *names, int *match )
 {
 	int n, fstatus;
 	str mergedtag;
 
 	*match = 0;
 
-	n = slist_find( names, data );
-	if ( slist_wasfound( names, n ) ) {
+	n = namelist_find( names, data );
+	if ( n!=-1 ) {
 		str_initstrsc( &mergedtag, tag, suffix, NULL );
 		fstatus = fields_add( bibout, str_cstr( &mergedtag ), str_cstr( data ), level );
 		str_free( &mergedtag );
@@ -921,15 +955,21 @@ bibtexin_crossref_oneref( fields *bibref, fields *bibcross )
 static int
 bibtexin_crossref( bibl *bin, param *p )
 {
-	int i, n, ncross, status = BIBL_OK;
+	int i, n, ncross, indexed = 0, status = BIBL_OK;
 	fields *bibref, *bibcross;
+	bibl_index index;
 
 	for ( i=0; i<bin->n; ++i ) {
 		bibref = bin->ref[i];
 		n = fields_find( bibref, "CROSSREF", LEVEL_ANY );
 		if ( n==FIELDS_NOTFOUND ) continue;
 		fields_set_used( bibref, n );
-		ncross = bibl_findref( bin, (char*) fields_value( bibref, n, FIELDS_CHRP_NOUSE ) );
+		if ( !indexed ) {
+			status = bibl_index_init( &index, bin );
+			if ( status!=BIBL_OK ) return status;
+			indexed = 1;
+		}
+		ncross = bibl_index_find( &index, (char*) fields_value( bibref, n, FIELDS_CHRP_NOUSE ) );
 		if ( ncross==-1 ) {
 			bibtexin_nocrossref( bin, i, n, p );
 			continue;
@@ -939,6 +979,7 @@ bibtexin_crossref( bibl *bin, param *p )
 		if ( status!=BIBL_OK ) goto out;
 	}
 out:
+	if ( indexed ) bibl_index_free( &index );
 	return status;
 }
 
@@ -23,6 +23,7 @@ bibl_initparams( param *p, int readmode, int writemode, char *progname )
 	case BIBL_EBIIN:        status = ebiin_initparams     ( p, progname ); break;
 	case BIBL_ENDNOTEIN:    status = endin_initparams     ( p, progname ); break;
 	case BIBL_ENDNOTEXMLIN: status = endxmlin_initparams  ( p, progname ); break;
+	case BIBL_ISIIN:        status = isiin_initparams     ( p, progname ); break;
 	case BIBL_MEDLINEIN:    status = medin_initparams     ( p, progname ); break;
 	case BIBL_MODSIN:       status = modsin_initparams    ( p, progname ); break;
 	case BIBL_NBIBIN:       status = nbibin_initparams    ( p, progname ); break;
@@ -33,6 +34,9 @@ bibl_initparams( param *p, int readmode, int writemode, char *progname )
 
 	if ( status!=BIBL_OK ) return status;
 
+	/* index the tag tables now rather than on the first reference */
+	if ( !reftypes_index_build( p->all, p->nall ) ) return BIBL_ERR_MEMERR;
+
 	switch ( writemode ) {
 	case BIBL_ADSABSOUT:   status = adsout_initparams     ( p, progname ); break;
 	case BIBL_BIBTEXOUT:   status = bibtexout_initparams  ( p, progname ); break;
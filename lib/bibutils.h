@@ -16,7 +16,13 @@ extern "C" {
 #include <stdio.h>
 #include "bibdefs.h"
 #include "bibl.h"
+#include "biblcache.h"
+#include "biblstore.h"
+#include "biblinc.h"
 #include "slist.h"
+#include "namelist.h"
+#include "sink.h"
+#include "source.h"
 #include "charsets.h"
 #include "str_conv.h"
 
@@ -102,22 +108,25 @@ typedef struct param {
 	uchar output_raw;
 	uchar verbose;
 	uchar singlerefperfile;
+	int   nthreads;   /* If > 1, format output with this many threads */
 
-	slist asis;  /* Names that shouldn't be mangled */
-	slist corps; /* Names that shouldn't be mangled-MODS corporation type */
+	namelist asis;  /* Names that shouldn't be mangled */
+	namelist corps; /* Names that shouldn't be mangled-MODS corporation type */
+	struct name_cache *names; /* Parsed names, set for the duration of a read */
+	struct macros *strings;   /* BibTeX @STRING macros, kept across reads with this param */
 
 	char *progname;
 
 
-        int  (*readf)(FILE*,char*,int,int*,str*,str*,int*);
+        int  (*readf)(source*,char*,int,int*,str*,str*,int*);
         int  (*processf)(fields*,const char*,const char*,long,struct param*);
         int  (*cleanf)(bibl*,struct param*);
         int  (*typef) (fields*,const char*,int,struct param*);
         int  (*convertf)(fields*,fields*,int,struct param*);
-        void (*headerf)(FILE*,struct param*);
-        void (*footerf)(FILE*);
+        void (*headerf)(sink*,struct param*);
+        void (*footerf)(sink*);
 	int  (*assemblef)(fields*,fields*,struct param*,unsigned long);
-        int  (*writef)(fields*,FILE*,struct param*,unsigned long);
+        int  (*writef)(fields*,sink*,struct param*,unsigned long);
         variants *all;
         int  nall;
 
@@ -131,9 +140,19 @@ int  bibl_addtoasis( param *p, char *entry );
 int  bibl_readcorps( param *p, char *filename );
 int  bibl_addtocorps( param *p, char *entry );
 int  bibl_read( bibl *b, FILE *fp, char *filename, param *p );
+int  bibl_read_mem( bibl *b, const char *buf, unsigned long len, char *filename, param *p );
 int  bibl_write( bibl *b, FILE *fp, param *p );
+int  bibl_write_mem( bibl *b, str *out, param *p );
+int  bibl_writestore( biblstore *s, FILE *fp, param *p );
+int  bibl_writemany( bibl *b, int n, FILE *fps[], param *ps[], int nthreads );
+int  bibl_convertinc( int n, const char *bufs[], unsigned long lens[], char *filenames[], FILE *fp,
+		biblinc *old, biblinc *next, param *p, long *nrefs, long *nreused );
 void bibl_reporterr( int err );
 
+typedef int (*bibl_scanfn)( long nrec, unsigned long start, unsigned long len, fields *ref, void *arg );
+int  bibl_scan( const char *buf, unsigned long len, char *filename, param *p, int *charset, bibl_scanfn f, void *arg );
+int  bibl_scanfile( FILE *fp, char *filename, param *p, int *charset, bibl_scanfn f, void *arg );
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
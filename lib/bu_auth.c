@@ -4,58 +4,56 @@
  * Copyright (c) Chris Putnam 2017-2021
  *
  * Source code released under the GPL version 2
+ *
+ * Generated by bldhash/hash_bu; do not edit.
  */
 
 #include <stdlib.h>
 #include <string.h>
 #include "bu_auth.h"
-#include "hash.h"
+#include "mph.h"
 
 /*
  * Bibutils genre hash
  */
-static const unsigned int bu_genre_hash_size = 50;
-static const char *bu_genre[50] = {
-	[ 0 ... 49 ] = NULL,
-	[  11 ] = "academic journal",
-	[   6 ] = "airtel",
-	[  37 ] = "Airtel",
-	[  21 ] = "book chapter",
-	[  29 ] = "collection",
-	[   9 ] = "communication",
-	[  34 ] = "Diploma thesis",
-	[   8 ] = "Doctoral thesis",
-	[   7 ] = "electronic",
-	[   0 ] = "e-mail communication",
-	[  48 ] = "Habilitation thesis",
-	[  22 ] = "handwritten note",
-	[  10 ] = "hearing",
-	[  14 ] = "journal article",
-	[  17 ] = "Licentiate thesis",
+static const char *bu_genre[29] = {
+	[   5 ] = "academic journal",
+	[  17 ] = "airtel",
+	[  24 ] = "Airtel",
+	[  14 ] = "book chapter",
+	[  18 ] = "collection",
+	[   4 ] = "communication",
+	[   2 ] = "Diploma thesis",
+	[  16 ] = "Doctoral thesis",
+	[   8 ] = "electronic",
+	[  25 ] = "e-mail communication",
+	[  11 ] = "Habilitation thesis",
+	[  21 ] = "handwritten note",
+	[   0 ] = "hearing",
+	[  12 ] = "journal article",
+	[   9 ] = "Licentiate thesis",
 	[   3 ] = "magazine",
-	[  31 ] = "magazine article",
-	[  28 ] = "manuscript",
-	[  35 ] = "Masters thesis",
-	[  18 ] = "memo",
-	[  36 ] = "miscellaneous",
-	[  42 ] = "newspaper article",
-	[  19 ] = "pamphlet",
-	[   4 ] = "Ph.D. thesis",
-	[  13 ] = "press release",
-	[  16 ] = "teletype",
-	[  26 ] = "television broadcast",
-	[  45 ] = "unpublished",
-	[  12 ] = "web page",
+	[   7 ] = "magazine article",
+	[  13 ] = "manuscript",
+	[  19 ] = "Masters thesis",
+	[   6 ] = "memo",
+	[  23 ] = "miscellaneous",
+	[  22 ] = "newspaper article",
+	[  26 ] = "pamphlet",
+	[  28 ] = "Ph.D. thesis",
+	[  20 ] = "press release",
+	[  27 ] = "teletype",
+	[  15 ] = "television broadcast",
+	[  10 ] = "unpublished",
+	[   1 ] = "web page",
+};
+static const int bu_genre_disp[10] = {
+	10, 1, 29, 4, 5, 1, -1, 5, 0, 11,
 };
+static const mph bu_genre_hash = { 29, 10, bu_genre_disp, MPH_CASE };
 
 int
 is_bu_genre( const char *query )
 {
-	unsigned int n;
-
-	n = calculate_hash_char( query, bu_genre_hash_size );
-	if ( bu_genre[n]==NULL ) return 0;
-	if ( !strcmp( query, bu_genre[n] ) ) return 1;
-	else if ( bu_genre[n+1] && !strcmp( query, bu_genre[n+1] ) ) return 1;
-	else return 0;
+	return !strcmp( query, bu_genre[ mph_slot( &bu_genre_hash, query ) ] );
 }
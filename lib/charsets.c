@@ -34594,6 +34594,12 @@ charset_find( char *name )
 	return ret;
 }
 
+int
+charset_count( void )
+{
+	return nallcharconvert;
+}
+
 void
 charset_list_all( FILE *fp )
 {
@@ -18,6 +18,7 @@
 
 char * charset_get_xmlname( int n );
 int    charset_find( char *name );
+int    charset_count( void );
 void   charset_list_all( FILE *fp );
 unsigned int charset_lookupchar( int charsetin, char c );
 unsigned int charset_lookupuni( int charsetout, unsigned int unicode );
@@ -26,7 +26,7 @@ extern int copac_nall;
  PUBLIC: void copacin_initparams()
 *****************************************************/
 
-static int copacin_readf( FILE *fp, char *buf, int bufsize, int *bufpos, str *line, str *reference, int *fcharset );
+static int copacin_readf( source *src, char *buf, int bufsize, int *bufpos, str *line, str *reference, int *fcharset );
 static int copacin_processf( fields *bibin, const char *p, const char *filename, long nref, param *pm );
 static int copacin_convertf( fields *bibin, fields *info, int reftype, param *pm );
 
@@ -52,8 +52,10 @@ copacin_initparams( param *pm, const char *progname )
 	pm->all      = copac_all;
 	pm->nall     = copac_nall;
 
-	slist_init( &(pm->asis) );
-	slist_init( &(pm->corps) );
+	namelist_init( &(pm->asis) );
+	namelist_init( &(pm->corps) );
+	pm->names = NULL;
+	pm->strings = NULL;
 
 	if ( !progname ) pm->progname = NULL;
 	else {
@@ -86,19 +88,19 @@ copacin_istag( const char *buf )
 	return 1; 
 }
 static int
-readmore( FILE *fp, char *buf, int bufsize, int *bufpos, str *line )
+readmore( source *src, char *buf, int bufsize, int *bufpos, str *line )
 {
 	if ( line->len ) return 1;
-	else return str_fget( fp, buf, bufsize, bufpos, line );
+	else return source_fget( src, buf, bufsize, bufpos, line );
 }
 
 static int
-copacin_readf( FILE *fp, char *buf, int bufsize, int *bufpos, str *line, str *reference, int *fcharset )
+copacin_readf( source *src, char *buf, int bufsize, int *bufpos, str *line, str *reference, int *fcharset )
 {
 	int haveref = 0, inref=0;
 	char *p;
 	*fcharset = CHARSET_UNKNOWN;
-	while ( !haveref && readmore( fp, buf, bufsize, bufpos, line ) ) {
+	while ( !haveref && readmore( src, buf, bufsize, bufpos, line ) ) {
 		/* blank line separates */
 		if ( line->data==NULL ) continue;
 		if ( inref && line->len==0 ) haveref=1; 
@@ -225,9 +227,9 @@ copacin_person( fields *bibin, int n, str *intag, str *invalue, int level, param
 	str usename, *s;
 	slist tokens;
 
-	if ( slist_find( &(pm->asis),  invalue ) !=-1  ||
-	     slist_find( &(pm->corps), invalue ) !=-1 ) {
-		return add_name( bibout, outtag, str_cstr( invalue ), level, &(pm->asis), &(pm->corps) );
+	if ( namelist_find( &(pm->asis),  invalue ) !=-1  ||
+	     namelist_find( &(pm->corps), invalue ) !=-1 ) {
+		return add_name( bibout, outtag, str_cstr( invalue ), level, &(pm->asis), &(pm->corps), pm->names );
 	}
 
 	slist_init( &tokens );
@@ -260,7 +262,7 @@ copacin_person( fields *bibin, int n, str *intag, str *invalue, int level, param
 
 	slist_free( &tokens );
 
-	status = add_name( bibout, usetag, str_cstr( &usename ), level, &(pm->asis), &(pm->corps) );
+	status = add_name( bibout, usetag, str_cstr( &usename ), level, &(pm->asis), &(pm->corps), pm->names );
 
 	str_free( &usename );
 
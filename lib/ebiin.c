@@ -18,7 +18,7 @@
 #include "xml_encoding.h"
 #include "bibformats.h"
 
-static int ebiin_readf( FILE *fp, char *buf, int bufsize, int *bufpos, str *line, str *reference, int *fcharset );
+static int ebiin_readf( source *src, char *buf, int bufsize, int *bufpos, str *line, str *reference, int *fcharset );
 static int ebiin_processf( fields *ebiin, const char *data, const char *filename, long nref, param *p );
 
 
@@ -48,8 +48,10 @@ ebiin_initparams( param *pm, const char *progname )
 	pm->all      = NULL;
 	pm->nall     = 0;
 
-	slist_init( &(pm->asis) );
-	slist_init( &(pm->corps) );
+	namelist_init( &(pm->asis) );
+	namelist_init( &(pm->corps) );
+	pm->names = NULL;
+	pm->strings = NULL;
 
 	if ( !progname ) pm->progname = NULL;
 	else {
@@ -64,13 +66,13 @@ ebiin_initparams( param *pm, const char *progname )
  PUBLIC: int ebiin_readf()
 *****************************************************/
 static int
-ebiin_readf( FILE *fp, char *buf, int bufsize, int *bufpos, str *line, str *reference, int *fcharset )
+ebiin_readf( source *src, char *buf, int bufsize, int *bufpos, str *line, str *reference, int *fcharset )
 {
 	int haveref = 0, inref = 0, file_charset = CHARSET_UNKNOWN, m;
 	char *startptr = NULL, *endptr;
 	str tmp;
 	str_init( &tmp );
-	while ( !haveref && str_fget( fp, buf, bufsize, bufpos, line ) ) {
+	while ( !haveref && source_fget( src, buf, bufsize, bufpos, line ) ) {
 		if ( str_has_value( line ) ) {
 			m = xml_getencoding( line );
 			if ( m!=CHARSET_UNKNOWN ) file_charset = m;
@@ -90,6 +92,8 @@ ebiin_readf( FILE *fp, char *buf, int bufsize, int *bufpos, str *line, str *refe
 		}
 	}
 	str_free( &tmp );
+	/* nothing read is held over for the next reference */
+	str_empty( line );
 	*fcharset = file_charset;
 	return haveref;
 }
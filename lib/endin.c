@@ -27,7 +27,7 @@ extern int end_nall;
  PUBLIC: void endin_initparams()
 *****************************************************/
 
-static int endin_readf( FILE *fp, char *buf, int bufsize, int *bufpos, str *line, str *reference, int *fcharset );
+static int endin_readf( source *src, char *buf, int bufsize, int *bufpos, str *line, str *reference, int *fcharset );
 static int endin_processf( fields *endin, const char *p, const char *filename, long nref, param *pm );
 int endin_typef( fields *endin, const char *filename, int nrefs, param *p );
 int endin_convertf( fields *endin, fields *info, int reftype, param *p );
@@ -55,8 +55,10 @@ endin_initparams( param *pm, const char *progname )
 	pm->all      = end_all;
 	pm->nall     = end_nall;
 
-	slist_init( &(pm->asis) );
-	slist_init( &(pm->corps) );
+	namelist_init( &(pm->asis) );
+	namelist_init( &(pm->corps) );
+	pm->names = NULL;
+	pm->strings = NULL;
 
 	if ( !progname ) pm->progname = NULL;
 	else {
@@ -90,20 +92,20 @@ endin_istag( const char *buf )
 }
 
 static int
-readmore( FILE *fp, char *buf, int bufsize, int *bufpos, str *line )
+readmore( source *src, char *buf, int bufsize, int *bufpos, str *line )
 {
 	if ( line->len ) return 1;
-	else return str_fget( fp, buf, bufsize, bufpos, line );
+	else return source_fget( src, buf, bufsize, bufpos, line );
 }
 
 static int
-endin_readf( FILE *fp, char *buf, int bufsize, int *bufpos, str *line, str *reference, int *fcharset )
+endin_readf( source *src, char *buf, int bufsize, int *bufpos, str *line, str *reference, int *fcharset )
 {
 	int haveref = 0, inref = 0;
 	unsigned char *up;
 	char *p;
 	*fcharset = CHARSET_UNKNOWN;
-	while ( !haveref && readmore( fp, buf, bufsize, bufpos, line ) ) {
+	while ( !haveref && readmore( src, buf, bufsize, bufpos, line ) ) {
 
 		if ( !line->data ) continue;
 		p = &(line->data[0]);
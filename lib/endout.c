@@ -26,7 +26,7 @@
  PUBLIC: int endout_initparams()
 *****************************************************/
 
-static int endout_write( fields *in, FILE *fp, param *p, unsigned long refnum );
+static int endout_write( fields *in, sink *s, param *p, unsigned long refnum );
 static int endout_assemble( fields *in, fields *out, param *pm, unsigned long refnum );
 
 int
@@ -44,6 +44,7 @@ endout_initparams( param *pm, const char *progname )
 	pm->verbose          = 0;
 	pm->addcount         = 0;
 	pm->singlerefperfile = 0;
+	pm->nthreads         = 0;
 
 	if ( pm->charsetout == BIBL_CHARSET_UNICODE ) {
 		pm->utf8out = pm->utf8bom = 1;
@@ -727,18 +728,17 @@ endout_assemble( fields *in, fields *out, param *pm, unsigned long refnum )
 *****************************************************/
 
 static int
-endout_write( fields *out, FILE *fp, param *pm, unsigned long refnum )
+endout_write( fields *out, sink *s, param *pm, unsigned long refnum )
 {
 	int i;
 
 	for ( i=0; i<out->n; ++i ) {
-		fprintf( fp, "%s %s\n",
-			(char*) fields_tag( out, i, FIELDS_CHRP ),
-			(char*) fields_value( out, i, FIELDS_CHRP )
-		);
+		sink_puts( s, (char*) fields_tag( out, i, FIELDS_CHRP ) );
+		sink_putc( s, ' ' );
+		sink_puts( s, (char*) fields_value( out, i, FIELDS_CHRP ) );
+		sink_putc( s, '\n' );
 	}
 
-	fprintf( fp, "\n" );
-	fflush( fp );
+	sink_putc( s, '\n' );
 	return BIBL_OK;
 }
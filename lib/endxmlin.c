@@ -25,7 +25,7 @@ typedef struct {
 extern variants end_all[];
 extern int end_nall;
 
-static int endxmlin_readf( FILE *fp, char *buf, int bufsize, int *bufpos, str *line, str *reference, int *fcharset );
+static int endxmlin_readf( source *src, char *buf, int bufsize, int *bufpos, str *line, str *reference, int *fcharset );
 static int endxmlin_processf( fields *endin, const char *p, const char *filename, long nref, param *pm );
 extern int endin_typef( fields *endin, const char *filename, int nrefs, param *p );
 extern int endin_convertf( fields *endin, fields *info, int reftype, param *p );
@@ -57,8 +57,10 @@ endxmlin_initparams( param *pm, const char *progname )
 	pm->all      = end_all;
 	pm->nall     = end_nall;
 
-	slist_init( &(pm->asis) );
-	slist_init( &(pm->corps) );
+	namelist_init( &(pm->asis) );
+	namelist_init( &(pm->corps) );
+	pm->names = NULL;
+	pm->strings = NULL;
 
 	if ( !progname ) pm->progname = NULL;
 	else {
@@ -74,14 +76,14 @@ endxmlin_initparams( param *pm, const char *progname )
 *****************************************************/
 
 static int
-xml_readmore( FILE *fp, char *buf, int bufsize, int *bufpos )
+xml_readmore( source *src, char *buf, int bufsize, int *bufpos )
 {
-	if ( !feof( fp ) && fgets( buf, bufsize, fp ) ) return 0;
+	if ( !source_eof( src ) && source_gets( src, buf, bufsize ) ) return 0;
 	return 1;
 }
 
 static int
-endxmlin_readf( FILE *fp, char *buf, int bufsize, int *bufpos, str *line, str *reference, int *fcharset )
+endxmlin_readf( source *src, char *buf, int bufsize, int *bufpos, str *line, str *reference, int *fcharset )
 {
 	int haveref = 0, inref = 0, done = 0, file_charset = CHARSET_UNKNOWN, m;
 	char *startptr = NULL, *endptr = NULL;
@@ -92,7 +94,7 @@ endxmlin_readf( FILE *fp, char *buf, int bufsize, int *bufpos, str *line, str *r
 	while ( !haveref && !done ) {
 
 		if ( str_is_empty( line ) ) {
-			done = xml_readmore( fp, buf, bufsize, bufpos );
+			done = xml_readmore( src, buf, bufsize, bufpos );
 			str_strcatc( line, buf );
 		}
 
@@ -117,7 +119,7 @@ endxmlin_readf( FILE *fp, char *buf, int bufsize, int *bufpos, str *line, str *r
 
 		/* ...entire reference is not in line, read more */
 		if ( !startptr || !endptr ) {
-			done = xml_readmore( fp, buf, bufsize, bufpos );
+			done = xml_readmore( src, buf, bufsize, bufpos );
 			str_strcatc( line, buf );
 		}
 		/* ...we can reallocate in str_strcat; must re-find the tags */
@@ -81,14 +81,26 @@ fields_free( fields *f )
 {
 	int i;
 
-	for ( i=0; i<f->n; ++i )
-		fields_entry_delete( f->entries[i] );
+	for ( i=0; i<f->max; ++i )
+		if ( f->entries[i] ) fields_entry_delete( f->entries[i] );
 
 	if ( f->entries ) free( f->entries );
 
 	fields_init( f );
 }
 
+/* fields_empty()
+ *
+ * Drop all entries but keep them allocated; later adds refill them
+ * in place, so a fields reused for every reference stops allocating
+ * once it has seen the largest one.
+ */
+void
+fields_empty( fields *f )
+{
+	f->n = 0;
+}
+
 void
 fields_delete( fields *f )
 {
@@ -109,6 +121,7 @@ fields_remove( fields *f, int n )
 		f->entries[ i-1 ] = f->entries[ i ];
 
 	f->n -= 1;
+	f->entries[ f->n ] = NULL;
 
 	return FIELDS_OK;
 }
@@ -137,6 +150,8 @@ fields_realloc( fields *f )
 	more = ( fields_entry ** ) realloc( f->entries, sizeof( fields_entry * ) * alloc );
 	if ( !more ) return FIELDS_ERR_MEMERR;
 
+	memset( more + f->max, 0, sizeof( fields_entry * ) * ( alloc - f->max ) );
+
 	f->entries = more;
 	f->max     = alloc;
 
@@ -183,8 +198,16 @@ _fields_add( fields *f, const char *tag, const char *value, const char *lang, in
 	status = ensure_space( f );
 	if ( status!=FIELDS_OK ) return status;
 
-	e = fields_entry_new();
-	if ( !e ) return FIELDS_ERR_MEMERR;
+	/* reuse an entry left behind by fields_empty() */
+	e = f->entries[ f->n ];
+	if ( e ) {
+		e->used = 0;
+		str_empty( &(e->language) );
+	} else {
+		e = fields_entry_new();
+		if ( !e ) return FIELDS_ERR_MEMERR;
+		f->entries[ f->n ] = e;
+	}
 
 	e->level = level;
 	str_strcpyc( &(e->tag), tag );
@@ -192,6 +215,7 @@ _fields_add( fields *f, const char *tag, const char *value, const char *lang, in
 	if ( lang ) str_strcpyc( &(e->language), lang );
 
 	if ( str_memerr( &(e->tag) ) || str_memerr( &(e->value) ) ) {
+		f->entries[ f->n ] = NULL;
 		fields_entry_delete( e );
 		return FIELDS_ERR_MEMERR;
 	}
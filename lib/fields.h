@@ -43,6 +43,7 @@ fields *fields_new( void );
 fields *fields_dupl( fields *f );
 void    fields_delete( fields *f );
 void    fields_free( fields *f );
+void    fields_empty( fields *f );
 
 int     fields_remove( fields *f, int n );
 
@@ -46,7 +46,7 @@ generic_pages( fields *bibin, int n, str *intag, str *invalue, int level, param
 int
 generic_person( fields *bibin, int n, str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout )
 {
-        return add_name( bibout, outtag, str_cstr( invalue ), level, &(pm->asis), &(pm->corps) );
+        return add_name( bibout, outtag, str_cstr( invalue ), level, &(pm->asis), &(pm->corps), pm->names );
 }
 
 int
@@ -96,7 +96,7 @@ generic_genre( fields *bibin, int n, str *intag, str *invalue, int level, param
 }
 
 void
-generic_writeheader( FILE *outptr, param *pm )
+generic_writeheader( sink *out, param *pm )
 {
-	if ( pm->utf8bom ) utf8_writebom( outptr );
+	if ( pm->utf8bom ) utf8_writebom( out );
 }
@@ -22,6 +22,6 @@ int generic_skip    ( fields *bibin, int n, str *intag, str *invalue, int level,
 int generic_title   ( fields *bibin, int n, str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout );
 int generic_genre   ( fields *bibin, int n, str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout );
 
-void generic_writeheader( FILE *outptr, param *pm );
+void generic_writeheader( sink *out, param *pm );
 
 #endif
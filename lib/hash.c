@@ -8,6 +8,7 @@
 
 #include <stdlib.h>
 #include <string.h>
+#include <ctype.h>
 #include "hash.h"
 
 /*
@@ -34,3 +35,41 @@ calculate_hash_char( const char *key, unsigned int HASH_SIZE )
 {
 	return one_at_a_time_hash( key, strlen( key ), HASH_SIZE );
 }
+
+/*
+ * Same hash over the first len bytes of key without the modulus, for
+ * tables that size themselves; nocase folds ASCII case so that keys
+ * equal under strncasecmp() hash alike
+ */
+unsigned int
+calculate_hash_strn( const char *key, unsigned long len, int nocase )
+{
+	unsigned int hash = 0;
+	unsigned long i;
+	for ( i=0; i<len; ++i ) {
+		if ( nocase ) hash += (unsigned char) tolower( (unsigned char) key[i] );
+		else hash += key[i];
+		hash += ( hash << 10 );
+		hash ^= ( hash >> 6 );
+	}
+	hash += ( hash << 3 );
+	hash ^= ( hash >> 11 );
+	hash += ( hash << 15 );
+	return hash;
+}
+
+/*
+ * 64-bit FNV-1a over len bytes of key, continuing from hash (start
+ * with HASH64_INIT), for fingerprints of data too large to compare
+ */
+uint64_t
+calculate_hash64( uint64_t hash, const void *key, unsigned long len )
+{
+	const unsigned char *p = ( const unsigned char * ) key;
+	unsigned long i;
+	for ( i=0; i<len; ++i ) {
+		hash ^= p[i];
+		hash *= 1099511628211ULL;
+	}
+	return hash;
+}
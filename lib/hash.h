@@ -8,6 +8,12 @@
 #ifndef HASH_H
 #define HASH_H
 
+#include <stdint.h>
+
+#define HASH64_INIT (14695981039346656037ULL)
+
 unsigned int calculate_hash_char( const char *key, unsigned int HASH_SIZE );
+unsigned int calculate_hash_strn( const char *key, unsigned long len, int nocase );
+uint64_t     calculate_hash64( uint64_t hash, const void *key, unsigned long len );
 
 #endif
@@ -23,7 +23,7 @@
 extern variants isi_all[];
 extern int isi_nall;
 
-static int isiin_readf( FILE *fp, char *buf, int bufsize, int *bufpos, str *line, str *reference, int *fcharset );
+static int isiin_readf( source *src, char *buf, int bufsize, int *bufpos, str *line, str *reference, int *fcharset );
 static int isiin_typef( fields *isiin, const char *filename, int nref, param *p );
 static int isiin_convertf( fields *isiin, fields *info, int reftype, param *p );
 static int isiin_processf( fields *isiin, const char *p, const char *filename, long nref, param *pm );
@@ -54,8 +54,10 @@ isiin_initparams( param *pm, const char *progname )
 	pm->all      = isi_all;
 	pm->nall     = isi_nall;
 
-	slist_init( &(pm->asis) );
-	slist_init( &(pm->corps) );
+	namelist_init( &(pm->asis) );
+	namelist_init( &(pm->corps) );
+	pm->names = NULL;
+	pm->strings = NULL;
 
 	if ( !progname ) pm->progname = NULL;
 	else {
@@ -84,21 +86,21 @@ is_isi_tag( const char *buf )
 }
 
 static int
-readmore( FILE *fp, char *buf, int bufsize, int *bufpos, str *line )
+readmore( source *src, char *buf, int bufsize, int *bufpos, str *line )
 {
 	if ( line->len ) return 1;
-	else return str_fget( fp, buf, bufsize, bufpos, line );
+	else return source_fget( src, buf, bufsize, bufpos, line );
 }
 
 static int
-isiin_readf( FILE *fp, char *buf, int bufsize, int *bufpos, str *line, str *reference, int *fcharset )
+isiin_readf( source *src, char *buf, int bufsize, int *bufpos, str *line, str *reference, int *fcharset )
 {
 	int haveref = 0, inref = 0;
 	char *p;
 
 	*fcharset = CHARSET_UNKNOWN;
 
-	while ( !haveref && readmore( fp, buf, bufsize, bufpos, line ) ) {
+	while ( !haveref && readmore( src, buf, bufsize, bufpos, line ) ) {
 
 		if ( str_is_empty( line ) ) continue;
 
@@ -312,7 +314,7 @@ isiin_typef( fields *isiin, const char *filename, int nref, param *p )
 
 /* pull off authors first--use AF before AU */
 static int
-isiin_addauthors( fields *isiin, fields *info, int reftype, variants *all, int nall, slist *asis, slist *corps )
+isiin_addauthors( fields *isiin, fields *info, int reftype, variants *all, int nall, namelist *asis, namelist *corps, name_cache *cache )
 {
 	char *newtag, *authortype, use_af[]="AF", use_au[]="AU";
 	int level, i, n, has_af=0, has_au=0, nfields, status;
@@ -335,7 +337,7 @@ isiin_addauthors( fields *isiin, fields *info, int reftype, variants *all, int n
 		n = process_findoldtag( authortype, reftype, all, nall );
 		level = ((all[reftype]).tags[n]).level;
 		newtag = all[reftype].tags[n].newstr;
-		status = add_name( info, newtag, d->data, level, asis, corps );
+		status = add_name( info, newtag, d->data, level, asis, corps, cache );
 		if ( status!=BIBL_OK ) return status;
 	}
 	return BIBL_OK;
@@ -428,7 +430,7 @@ isiin_convertf( fields *bibin, fields *bibout, int reftype, param *p )
 	str *intag, *invalue;
 	char *outtag;
 
-	status = isiin_addauthors( bibin, bibout, reftype, p->all, p->nall, &(p->asis), &(p->corps) );
+	status = isiin_addauthors( bibin, bibout, reftype, p->all, p->nall, &(p->asis), &(p->corps), p->names );
 	if ( status!=BIBL_OK ) return status;
 
 	nfields = fields_num( bibin );
@@ -24,7 +24,7 @@
  PUBLIC: int isiout_initparams()
 *****************************************************/
 
-static int  isiout_write( fields *info, FILE *fp, param *p, unsigned long refnum );
+static int  isiout_write( fields *info, sink *s, param *p, unsigned long refnum );
 static int  isiout_assemble( fields *in, fields *out, param *pm, unsigned long refnum );
 
 int
@@ -42,6 +42,7 @@ isiout_initparams( param *pm, const char *progname )
 	pm->verbose          = 0;
 	pm->addcount         = 0;
 	pm->singlerefperfile = 0;
+	pm->nthreads         = 0;
 
 	if ( pm->charsetout == BIBL_CHARSET_UNICODE ) {
 		pm->utf8out = pm->utf8bom = 1;
@@ -308,17 +309,16 @@ isiout_assemble( fields *in, fields *out, param *pm, unsigned long refnum )
 *****************************************************/
 
 static int
-isiout_write( fields *out, FILE *fp, param *p, unsigned long refnum )
+isiout_write( fields *out, sink *s, param *p, unsigned long refnum )
 {
 	int i;
 
 	for ( i=0; i<out->n; ++i ) {
-		fprintf( fp, "%s %s\n",
-			( char * ) fields_tag  ( out, i, FIELDS_CHRP ),
-			( char * ) fields_value( out, i, FIELDS_CHRP )
-		);
+		sink_puts( s, ( char * ) fields_tag( out, i, FIELDS_CHRP ) );
+		sink_putc( s, ' ' );
+		sink_puts( s, ( char * ) fields_value( out, i, FIELDS_CHRP ) );
+		sink_putc( s, '\n' );
 	}
-        fprintf( fp, "ER\n\n" );
-        fflush( fp );
+	sink_write( s, "ER\n\n", 4 );
 	return BIBL_OK;
 }
@@ -0,0 +1,36 @@
+/*
+ * iso639.c
+ *
+ * Lookups across the ISO 639-1, 639-2 and 639-3 language tables
+ *
+ * Copyright (c) Chris Putnam 2021
+ *
+ * Source code released under the GPL version 2
+ *
+ */
+#include <string.h>
+#include "iso639.h"
+
+/* iso639_from_code()
+ *
+ * Return the language for a code of any of the three standards,
+ * preferring ISO 639-3, then 639-2, then 639-1, or NULL if unknown.
+ */
+char *
+iso639_from_code( const char *code )
+{
+	char *lang;
+
+	if ( !code ) return NULL;
+
+	switch ( strlen( code ) ) {
+	case 2:
+		return iso639_1_from_code( code );
+	case 3:
+		lang = iso639_3_from_code( code );
+		if ( lang ) return lang;
+		return iso639_2_from_code( code );
+	default:
+		return NULL;
+	}
+}
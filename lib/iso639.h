@@ -0,0 +1,20 @@
+/*
+ * iso639.h
+ *
+ * Lookups across the ISO 639-1, 639-2 and 639-3 language tables
+ *
+ * Copyright (c) Chris Putnam 2021
+ *
+ * Source code released under the GPL version 2
+ *
+ */
+#ifndef ISO639_H
+#define ISO639_H
+
+#include "iso639_1.h"
+#include "iso639_2.h"
+#include "iso639_3.h"
+
+char * iso639_from_code( const char *code );
+
+#endif
@@ -2,7 +2,8 @@
  * iso639_1.c
  */
 #include <string.h>
-#include "iso639_1.h"
+#include "iso639.h"
+#include "mph.h"
 
 typedef struct {
         char *code;
@@ -196,15 +197,42 @@ static iso639_1_t iso639_1[] = {
 	{ "zh", "Chinese" },
 	{ "zu", "Zulu" },
 };
+#ifdef ISO639_BLDINDEX
 static int niso639_1= sizeof( iso639_1 ) / sizeof( iso639_1[0] );
+#endif
+
+#ifndef ISO639_BLDINDEX
+
+#include "iso639_1_index.c"
+
+static const char *
+iso639_1_code( int n )
+{
+	return iso639_1[n].code;
+}
 
 char *
 iso639_1_from_code( const char *code )
 {
-	int i;
-	for ( i=0; i<niso639_1; ++i ) {
-		if ( !strcasecmp( iso639_1[i].code, code ) )
-			return iso639_1[i].language;
-	}
-	return NULL;
+	int n;
+	n = mph_find( &iso639_1_bycode_hash, iso639_1_bycode_pos, code, iso639_1_code );
+	if ( n==-1 ) return NULL;
+	return iso639_1[n].language;
 }
+
+static const char *
+iso639_1_lang( int n )
+{
+	return iso639_1[n].language;
+}
+
+char *
+iso639_1_from_language( const char *lang )
+{
+	int n;
+	n = mph_find( &iso639_1_bylang_hash, iso639_1_bylang_pos, lang, iso639_1_lang );
+	if ( n==-1 ) return NULL;
+	return iso639_1[n].code;
+}
+
+#endif
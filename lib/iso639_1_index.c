@@ -0,0 +1,72 @@
+/*
+ * iso639_1_index.c
+ *
+ * Minimal perfect hash indices over the keys of iso639_1[], for
+ * mph_find(); the first entry with a key wins.
+ *
+ * Generated by bldhash/mph_index; do not edit.
+ */
+static const unsigned short iso639_1_bycode_pos[185] = {
+	179, 16, 135, 8, 1, 3, 38, 173, 26, 175,
+	29, 62, 118, 56, 104, 32, 11, 110, 168, 21,
+	184, 176, 147, 24, 105, 74, 67, 65, 78, 172,
+	69, 108, 138, 145, 99, 77, 158, 46, 68, 102,
+	133, 160, 81, 93, 111, 148, 155, 85, 73, 53,
+	4, 83, 22, 84, 137, 162, 31, 19, 154, 112,
+	41, 57, 25, 45, 63, 71, 139, 9, 178, 141,
+	163, 49, 27, 134, 33, 10, 124, 35, 60, 7,
+	156, 180, 115, 5, 126, 96, 98, 2, 30, 76,
+	92, 58, 177, 14, 50, 90, 127, 43, 157, 48,
+	86, 34, 152, 103, 165, 28, 143, 132, 136, 125,
+	95, 13, 17, 121, 123, 55, 18, 37, 12, 106,
+	20, 114, 146, 97, 100, 6, 44, 122, 151, 116,
+	36, 79, 80, 164, 15, 150, 101, 82, 182, 167,
+	120, 174, 130, 149, 169, 142, 144, 166, 109, 70,
+	91, 181, 40, 128, 23, 94, 72, 170, 51, 113,
+	54, 159, 87, 61, 66, 42, 140, 47, 64, 131,
+	183, 117, 0, 59, 161, 107, 52, 129, 89, 75,
+	171, 39, 119, 88, 153,
+};
+static const int iso639_1_bycode_disp[62] = {
+	4, 0, 1, 6, 148, -14, -70, 26, 119, -71,
+	-116, 2, 8, 18, 4, 1, 58, 1, 95, 12,
+	15, 23, -130, 13, 3, 10, 17, -137, 3, 0,
+	18, 1, 3, 21, 20, 9, 40, 304, 71, 5,
+	11, 155, 1, 23, 11, 3, 188, 20, 3, -138,
+	303, 18, 58, 384, 345, 3, 295, 1, 3, -141,
+	-182, 90,
+};
+static const mph iso639_1_bycode_hash = { 185, 62, iso639_1_bycode_disp, MPH_NOCASE };
+
+static const unsigned short iso639_1_bylang_pos[185] = {
+	95, 87, 133, 119, 15, 78, 65, 135, 31, 112,
+	86, 136, 170, 159, 3, 82, 162, 151, 176, 46,
+	116, 174, 124, 5, 173, 36, 91, 59, 104, 84,
+	54, 113, 134, 4, 138, 40, 56, 43, 98, 156,
+	90, 125, 164, 166, 139, 11, 62, 23, 49, 48,
+	168, 44, 6, 57, 67, 74, 51, 71, 39, 177,
+	167, 141, 99, 120, 66, 115, 60, 148, 111, 142,
+	41, 27, 53, 171, 178, 69, 29, 47, 89, 72,
+	101, 22, 105, 85, 157, 30, 152, 160, 1, 13,
+	93, 180, 94, 181, 163, 158, 165, 20, 106, 179,
+	64, 34, 12, 42, 58, 118, 63, 129, 154, 0,
+	10, 149, 7, 73, 92, 102, 70, 77, 61, 76,
+	75, 55, 97, 96, 182, 21, 126, 33, 128, 146,
+	110, 45, 100, 117, 169, 68, 32, 80, 79, 24,
+	127, 25, 28, 26, 107, 37, 9, 123, 150, 140,
+	144, 145, 161, 137, 131, 109, 143, 83, 2, 14,
+	153, 38, 114, 52, 175, 172, 103, 184, 147, 130,
+	122, 88, 155, 132, 50, 108, 19, 8, 18, 35,
+	183, 81, 17, 121, 16,
+};
+static const int iso639_1_bylang_disp[62] = {
+	10, 18, 1, 3, 3, 2, 7, 5, 3, -1,
+	1, 1, 11, 20, 7, 16, -8, -30, 21, -39,
+	0, 1, 26, 2, 118, 105, 5, -41, 160, 2,
+	38, 25, 0, 10, 2, 101, 276, 8, 2, 89,
+	-46, -71, 5, 1, 42, 131, 14, 0, 18, 142,
+	251, 76, 609, 55, -87, 1, 647, 7, -111, -158,
+	-164, 1,
+};
+static const mph iso639_1_bylang_hash = { 185, 62, iso639_1_bylang_disp, MPH_NOCASE };
+
@@ -2,7 +2,8 @@
  * iso639-2 language codes
  */
 #include <string.h>
-#include "iso639_2.h"
+#include "iso639.h"
+#include "mph.h"
 
 typedef struct {
 	char *code1;
@@ -584,34 +585,60 @@ static iso639_2_t iso639_2[] = {
 	{ "zul", "",    1, "Zulu" },
 	{ "zun", "",    1, "Zuni" },
 };
+#if defined( ISO639_BLDINDEX ) || defined( TEST )
 static int niso639_2= sizeof( iso639_2 ) / sizeof( iso639_2[0] );
+#endif
+
+#ifndef ISO639_BLDINDEX
+
+#include "iso639_2_index.c"
+
+static const char *
+iso639_2_code1( int n )
+{
+	return iso639_2[n].code1;
+}
 
+static const char *
+iso639_2_code2( int n )
+{
+	return iso639_2[n].code2;
+}
+
+static const char *
+iso639_2_lang( int n )
+{
+	return iso639_2[n].language;
+}
+
+/* iso639_2_from_code()
+ *
+ * Match either code of the main entries; the earliest entry wins.
+ */
 char *
 iso639_2_from_code( const char *code )
 {
-	int i;
-	for ( i=0; i<niso639_2; ++i ) {
-		if ( !iso639_2[i].main ) continue;
-		if ( !strcasecmp( iso639_2[i].code1, code ) )
-			return iso639_2[i].language;
-		if ( iso639_2[i].code2[0]!='\0' && !strcasecmp( iso639_2[i].code2, code ) )
-			return iso639_2[i].language;
-	}
-	return NULL;
+	int n1, n2;
+
+	n1 = mph_find( &iso639_2_bycode1_hash, iso639_2_bycode1_pos, code, iso639_2_code1 );
+	n2 = mph_find( &iso639_2_bycode2_hash, iso639_2_bycode2_pos, code, iso639_2_code2 );
+	if ( n1==-1 || ( n2!=-1 && n2 < n1 ) ) n1 = n2;
+	if ( n1==-1 ) return NULL;
+
+	return iso639_2[n1].language;
 }
 
 char *
 iso639_2_from_language( const char *lang )
 {
-	int i, n;
-	for ( i=0; i<niso639_2; ++i ) {
-		n = strcasecmp( iso639_2[i].language, lang );
-		if ( n==0 ) return iso639_2[i].code1;
-		if ( n > 0 ) return NULL;
-	}
-	return NULL;
+	int n;
+	n = mph_find( &iso639_2_bylang_hash, iso639_2_bylang_pos, lang, iso639_2_lang );
+	if ( n==-1 ) return NULL;
+	return iso639_2[n].code1;
 }
 
+#endif
+
 #ifdef TEST
 
 #include <stdio.h>
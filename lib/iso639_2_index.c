@@ -0,0 +1,171 @@
+/*
+ * iso639_2_index.c
+ *
+ * Minimal perfect hash indices over the keys of iso639_2[], for
+ * mph_find(); the first entry with a key wins.
+ *
+ * Generated by bldhash/mph_index; do not edit.
+ */
+static const unsigned short iso639_2_bycode1_pos[479] = {
+	486, 544, 394, 355, 25, 352, 507, 474, 450, 115,
+	280, 221, 319, 227, 74, 211, 14, 441, 229, 212,
+	195, 13, 361, 3, 194, 300, 203, 254, 428, 139,
+	515, 569, 499, 320, 134, 224, 233, 210, 58, 364,
+	162, 351, 72, 36, 290, 357, 288, 119, 306, 109,
+	281, 492, 16, 99, 56, 563, 50, 208, 329, 108,
+	429, 261, 369, 93, 510, 567, 338, 270, 66, 264,
+	535, 168, 461, 113, 393, 308, 403, 20, 388, 512,
+	5, 214, 549, 493, 471, 60, 142, 562, 222, 411,
+	191, 435, 223, 163, 487, 506, 89, 516, 96, 508,
+	350, 245, 327, 249, 11, 298, 360, 253, 570, 235,
+	340, 307, 400, 343, 294, 519, 443, 528, 410, 78,
+	419, 21, 117, 248, 398, 32, 230, 197, 129, 500,
+	520, 511, 538, 171, 311, 64, 551, 146, 30, 399,
+	480, 116, 185, 82, 524, 158, 517, 183, 276, 503,
+	250, 130, 177, 501, 346, 275, 75, 433, 257, 114,
+	201, 41, 85, 558, 7, 312, 293, 215, 439, 1,
+	10, 23, 467, 193, 385, 453, 187, 490, 133, 15,
+	22, 529, 531, 522, 406, 475, 339, 157, 178, 548,
+	160, 206, 349, 240, 476, 145, 88, 209, 299, 502,
+	73, 59, 342, 125, 413, 170, 404, 100, 140, 353,
+	505, 409, 228, 175, 149, 550, 485, 243, 246, 279,
+	179, 127, 422, 412, 555, 68, 19, 326, 205, 155,
+	309, 271, 521, 356, 368, 478, 172, 48, 98, 362,
+	97, 345, 39, 156, 447, 423, 202, 473, 457, 126,
+	456, 494, 40, 376, 266, 232, 416, 458, 112, 546,
+	86, 53, 184, 444, 328, 335, 420, 325, 504, 31,
+	317, 46, 35, 62, 497, 90, 38, 540, 536, 313,
+	136, 217, 12, 460, 124, 135, 262, 331, 488, 236,
+	77, 272, 321, 424, 83, 49, 252, 186, 543, 468,
+	29, 527, 84, 547, 440, 79, 54, 445, 4, 267,
+	241, 472, 234, 330, 192, 43, 44, 374, 316, 370,
+	101, 182, 470, 302, 481, 277, 258, 71, 372, 76,
+	204, 123, 289, 265, 167, 304, 318, 225, 154, 180,
+	132, 469, 432, 65, 159, 151, 491, 378, 173, 446,
+	334, 484, 196, 437, 26, 110, 452, 81, 344, 395,
+	33, 483, 389, 430, 296, 465, 188, 0, 523, 220,
+	63, 219, 285, 509, 189, 51, 17, 251, 103, 561,
+	448, 348, 545, 278, 226, 150, 560, 144, 55, 425,
+	495, 176, 169, 9, 104, 247, 105, 557, 379, 534,
+	268, 434, 533, 556, 514, 564, 371, 121, 244, 28,
+	239, 207, 47, 174, 213, 87, 152, 199, 532, 347,
+	138, 231, 67, 137, 42, 283, 8, 94, 323, 559,
+	295, 111, 297, 106, 242, 526, 407, 373, 358, 61,
+	553, 498, 565, 518, 436, 462, 381, 118, 541, 455,
+	363, 513, 260, 477, 153, 70, 218, 401, 181, 464,
+	52, 122, 375, 380, 489, 92, 256, 442, 91, 24,
+	263, 315, 310, 366, 284, 200, 530, 322, 269,
+};
+static const int iso639_2_bycode1_disp[160] = {
+	6, 1, 5, 15, -4, -76, 22, -77, 1, 1,
+	4, 46, 6, 140, 5, 22, 2, 7, 62, 28,
+	29, 17, 3, 31, 17, 7, 27, -88, -95, -151,
+	0, -153, 69, 3, 6, 7, 27, 19, 3, 0,
+	11, 4, 17, 7, 50, 25, 0, -170, 108, 37,
+	1, 135, 68, 2, 96, 2, 6, 58, -176, 1,
+	1, 18, 6, -258, -266, 73, 19, 1, 15, 4,
+	17, -304, 52, 40, 1, 15, 22, 24, 164, 31,
+	0, 9, -334, 19, -371, 3, 13, 58, 28, 3,
+	9, 20, 9, 1, 176, 12, -405, 17, 0, 9,
+	-410, 4, 0, 1, 74, 123, 137, 3, 5, 6,
+	162, 21, 76, 57, 1, 98, 9, 42, 4, 12,
+	10, 23, 16, -433, 63, -451, 19, 39, 153, 4,
+	-453, 1, 45, 0, 51, 5, 123, 371, 148, 133,
+	1, 122, 36, -461, 67, 31, 2, 857, -464, 17,
+	0, -468, 3, 2, 49, 57, 216, 27, 5, 64,
+};
+static const mph iso639_2_bycode1_hash = { 479, 160, iso639_2_bycode1_disp, MPH_NOCASE };
+
+static const unsigned short iso639_2_bycode2_pos[19] = {
+	211, 416, 551, 31, 322, 509, 123, 78, 96, 433,
+	191, 306, 14, 163, 312, 179, 472, 55, 178,
+};
+static const int iso639_2_bycode2_disp[7] = {
+	-6, 1, 1, 32, 14, 20, -15,
+};
+static const mph iso639_2_bycode2_hash = { 19, 7, iso639_2_bycode2_disp, MPH_NOCASE };
+
+static const unsigned short iso639_2_bylang_pos[571] = {
+	62, 47, 529, 255, 263, 540, 422, 66, 52, 250,
+	32, 2, 182, 350, 299, 293, 403, 266, 176, 543,
+	67, 515, 387, 407, 344, 556, 545, 16, 150, 501,
+	19, 164, 308, 253, 431, 310, 185, 490, 445, 367,
+	460, 238, 414, 522, 231, 273, 154, 118, 167, 261,
+	295, 468, 271, 77, 459, 383, 241, 418, 36, 168,
+	472, 55, 204, 359, 1, 131, 51, 504, 363, 94,
+	524, 206, 457, 346, 396, 26, 384, 557, 262, 188,
+	471, 454, 290, 316, 141, 405, 99, 157, 40, 187,
+	447, 450, 531, 63, 532, 134, 84, 205, 249, 306,
+	340, 282, 121, 559, 291, 144, 103, 126, 486, 209,
+	393, 72, 258, 281, 570, 111, 97, 229, 0, 512,
+	502, 130, 265, 190, 104, 251, 240, 181, 151, 83,
+	65, 425, 562, 50, 78, 433, 24, 81, 197, 443,
+	356, 217, 542, 400, 160, 95, 235, 153, 358, 362,
+	566, 558, 132, 54, 48, 360, 279, 189, 330, 402,
+	516, 232, 357, 465, 105, 419, 352, 93, 284, 91,
+	223, 547, 224, 424, 399, 107, 410, 482, 416, 318,
+	214, 415, 166, 560, 503, 22, 473, 222, 361, 348,
+	25, 466, 337, 376, 221, 561, 397, 31, 267, 478,
+	148, 325, 322, 336, 437, 394, 35, 527, 69, 476,
+	245, 341, 119, 429, 244, 207, 321, 351, 458, 530,
+	228, 554, 412, 292, 14, 303, 552, 526, 380, 509,
+	41, 452, 270, 372, 56, 381, 139, 3, 133, 234,
+	296, 101, 494, 521, 523, 538, 548, 483, 320, 495,
+	342, 219, 481, 411, 508, 163, 192, 441, 392, 401,
+	567, 382, 417, 110, 79, 506, 331, 474, 194, 389,
+	280, 37, 317, 74, 11, 143, 329, 236, 453, 564,
+	68, 177, 513, 510, 145, 345, 298, 499, 289, 546,
+	115, 216, 45, 230, 520, 448, 328, 314, 227, 20,
+	446, 283, 355, 369, 511, 5, 178, 539, 451, 323,
+	309, 467, 565, 365, 455, 507, 479, 61, 162, 493,
+	324, 484, 208, 175, 313, 6, 368, 142, 53, 285,
+	338, 140, 117, 13, 203, 233, 112, 64, 199, 242,
+	272, 413, 18, 100, 210, 491, 536, 173, 569, 138,
+	180, 528, 113, 60, 462, 500, 169, 90, 98, 375,
+	537, 436, 89, 237, 73, 535, 268, 311, 246, 456,
+	252, 533, 171, 202, 480, 432, 332, 304, 59, 158,
+	212, 161, 488, 114, 196, 201, 147, 485, 395, 406,
+	225, 165, 378, 333, 288, 275, 301, 21, 215, 195,
+	385, 386, 475, 109, 85, 43, 541, 15, 469, 302,
+	496, 86, 243, 492, 44, 4, 327, 172, 136, 46,
+	379, 287, 371, 174, 7, 218, 449, 137, 525, 335,
+	254, 568, 300, 213, 27, 17, 439, 146, 179, 29,
+	420, 239, 388, 259, 370, 30, 555, 347, 106, 409,
+	8, 23, 191, 326, 339, 156, 87, 198, 444, 152,
+	551, 116, 553, 257, 374, 183, 377, 88, 305, 33,
+	487, 135, 274, 70, 307, 497, 312, 319, 49, 122,
+	71, 129, 96, 211, 519, 28, 39, 10, 200, 256,
+	430, 514, 477, 442, 423, 489, 102, 247, 264, 334,
+	58, 286, 193, 398, 563, 226, 364, 343, 408, 440,
+	128, 260, 470, 315, 42, 544, 391, 354, 9, 82,
+	277, 549, 149, 404, 38, 184, 92, 534, 517, 464,
+	76, 75, 12, 550, 124, 498, 34, 463, 390, 120,
+	186, 159, 125, 127, 297, 366, 123, 421, 278, 269,
+	427, 155, 518, 353, 276, 435, 294, 349, 505, 373,
+	108, 426, 248, 80, 434, 57, 220, 428, 461, 170,
+	438,
+};
+static const int iso639_2_bylang_disp[191] = {
+	36, 2, -5, -33, 16, 1, -78, 2, 6, 2,
+	21, 10, 18, -100, 10, 16, 48, 1, 4, -131,
+	15, 8, 10, 2, 1, 2, 52, -158, 2, 1,
+	14, 1, -164, -165, 11, 1, 4, -170, 1, -172,
+	23, 30, 84, 15, -208, 5, 81, 2, 44, 31,
+	-243, 13, 3, 3, 0, -251, 1, 1, 1, 10,
+	42, 4, 3, 6, 0, 40, 2, 26, 3, 2,
+	12, 21, 43, -258, 2, 38, 1, 1, 3, 1,
+	111, 4, 86, 13, 28, 110, 0, 5, 6, 14,
+	168, 18, 1, 1, 53, 6, 7, -267, 215, 44,
+	-295, -297, 1, 2, 30, 19, 76, 23, 155, 6,
+	15, 294, 2, 74, 4, 9, 94, 3, 39, -314,
+	18, -343, -391, 131, 149, 84, 35, 16, 17, 1,
+	1, 12, 1, -464, 45, 130, 5, -473, -485, 0,
+	0, 55, 12, 8, 3, -500, 3, 17, 155, 0,
+	20, 41, 89, 11, 130, 116, 115, 11, -509, 38,
+	4, 150, 2, 8, 0, 13, 8, 4, 75, 21,
+	2, 24, 18, -530, 1, 31, 5, 355, 86, -537,
+	51, 2, 39, 2, 159, 3, 0, 92, 0, 5,
+	46,
+};
+static const mph iso639_2_bylang_hash = { 571, 191, iso639_2_bylang_disp, MPH_NOCASE };
+
@@ -2,7 +2,8 @@
  * iso639_3.c
  */
 #include <string.h>
-#include "iso639_3.h"
+#include "iso639.h"
+#include "mph.h"
 
 typedef struct {
         char *code;
@@ -8405,26 +8406,42 @@ static iso639_3_t iso639_3[] = {
 	{ "zza", "Zaza" },
 	{ "zzj", "Zuojiang Zhuang" },
 };
+#ifdef ISO639_BLDINDEX
 static int niso639_3= sizeof( iso639_3 ) / sizeof( iso639_3[0] );
+#endif
+
+#ifndef ISO639_BLDINDEX
+
+#include "iso639_3_index.c"
+
+static const char *
+iso639_3_code( int n )
+{
+	return iso639_3[n].code;
+}
+
+static const char *
+iso639_3_lang( int n )
+{
+	return iso639_3[n].language;
+}
 
 char *
 iso639_3_from_code( const char *code )
 {
-	int i;
-	for ( i=0; i<niso639_3; ++i ) {
-		if ( !strcasecmp( iso639_3[i].code, code ) )
-			return iso639_3[i].language;
-	}
-	return NULL;
+	int n;
+	n = mph_find( &iso639_3_bycode_hash, iso639_3_bycode_pos, code, iso639_3_code );
+	if ( n==-1 ) return NULL;
+	return iso639_3[n].language;
 }
 
 char *
 iso639_3_from_name( const char *name )
 {
-	int i;
-	for ( i=0; i<niso639_3; ++i ) {
-		if ( !strcasecmp( iso639_3[i].language, name ) )
-			return iso639_3[i].code;
-	}
-	return NULL;
+	int n;
+	n = mph_find( &iso639_3_bylang_hash, iso639_3_bylang_pos, name, iso639_3_lang );
+	if ( n==-1 ) return NULL;
+	return iso639_3[n].code;
 }
+
+#endif
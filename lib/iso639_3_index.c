@@ -0,0 +1,2191 @@
+/*
+ * iso639_3_index.c
+ *
+ * Minimal perfect hash indices over the keys of iso639_3[], for
+ * mph_find(); the first entry with a key wins.
+ *
+ * Generated by bldhash/mph_index; do not edit.
+ */
+static const unsigned short iso639_3_bycode_pos[8394] = {
+	7903, 5726, 4420, 4011, 7587, 2419, 2427, 3831, 7723, 7065,
+	6785, 4144, 5760, 2907, 4886, 7939, 7967, 4444, 532, 7044,
+	5803, 777, 2573, 2955, 3875, 865, 6196, 2524, 6365, 5017,
+	2068, 952, 7094, 3532, 265, 6102, 6881, 6145, 1532, 7366,
+	1296, 2779, 8389, 229, 7006, 4463, 1683, 6753, 7665, 5781,
+	7982, 2715, 2547, 968, 2800, 5441, 6448, 6614, 6165, 1137,
+	1897, 6101, 6973, 5852, 3988, 6941, 948, 8034, 6572, 7822,
+	7091, 4750, 8382, 1472, 7080, 1325, 4513, 2251, 8102, 1413,
+	7051, 6041, 1871, 1709, 3424, 7292, 2769, 6681, 8248, 6082,
+	4307, 5173, 1047, 2213, 3068, 62, 146, 7155, 1430, 1541,
+	3570, 1749, 5370, 4593, 3908, 878, 7224, 2556, 8009, 6443,
+	3130, 5464, 7226, 5159, 7730, 2247, 1075, 4148, 7368, 3384,
+	3712, 8337, 2834, 852, 3899, 4897, 3419, 3597, 3180, 3629,
+	7926, 991, 1930, 516, 3512, 5626, 1687, 7743, 8285, 639,
+	388, 2535, 4817, 664, 871, 3933, 950, 8317, 3355, 8346,
+	3828, 3218, 3109, 743, 3508, 7106, 6882, 2528, 5255, 7969,
+	3317, 7551, 5401, 1600, 2316, 7593, 417, 4734, 5045, 1018,
+	2181, 5520, 7515, 335, 2620, 759, 2020, 1249, 2276, 4655,
+	1392, 1480, 2973, 2896, 7930, 4309, 1971, 4414, 2945, 5875,
+	424, 2167, 6756, 340, 4310, 1997, 1784, 1004, 1505, 2782,
+	3058, 1543, 3973, 1076, 5020, 1772, 6582, 7817, 7043, 7113,
+	1112, 5892, 3381, 4190, 1595, 3754, 5440, 8228, 5670, 5920,
+	1351, 7491, 4383, 5969, 4285, 1790, 1731, 6883, 513, 3017,
+	5097, 2, 4408, 2829, 1813, 2504, 3191, 5490, 7927, 7578,
+	698, 3123, 4582, 6329, 2734, 6027, 7025, 4304, 1001, 937,
+	7273, 5844, 1714, 8359, 8056, 436, 7494, 7995, 3055, 764,
+	5985, 3350, 4067, 2876, 7918, 7430, 3297, 5452, 655, 116,
+	5382, 2626, 5736, 463, 3800, 6691, 5794, 5742, 1862, 412,
+	663, 2275, 2811, 6287, 4465, 136, 1411, 4258, 7411, 1888,
+	5509, 474, 761, 1653, 7011, 7783, 3519, 5420, 6318, 1135,
+	5998, 7385, 7664, 4719, 2881, 4342, 1290, 4591, 7569, 1117,
+	3514, 6658, 1401, 1286, 2097, 7836, 2376, 7795, 5476, 8259,
+	4942, 3915, 7137, 5863, 6632, 1866, 2261, 5808, 7860, 4109,
+	2339, 5834, 7690, 7275, 2689, 2197, 3330, 2200, 366, 1622,
+	2477, 6025, 1745, 8032, 7088, 3662, 5990, 554, 2317, 2688,
+	4506, 4348, 5909, 2238, 4108, 6383, 1632, 2808, 157, 7475,
+	4745, 3484, 1415, 3255, 7314, 4093, 8109, 6046, 7845, 4904,
+	1239, 7101, 4231, 1786, 7713, 2755, 1207, 3014, 1161, 3914,
+	3199, 6195, 4772, 624, 6819, 8200, 848, 5461, 6871, 5082,
+	5519, 8187, 5719, 1048, 2295, 6169, 4162, 3596, 4875, 3767,
+	6487, 4096, 6826, 6053, 182, 14, 1597, 885, 789, 5555,
+	5356, 5167, 6378, 2361, 4718, 6377, 5251, 1934, 5225, 7421,
+	218, 5100, 1115, 7451, 5752, 8353, 4889, 3292, 2458, 5825,
+	7607, 6625, 2940, 6754, 7140, 4616, 6770, 5759, 7033, 734,
+	6114, 7597, 2603, 4169, 3671, 7425, 5389, 989, 5919, 7431,
+	7340, 5522, 4686, 2557, 4051, 6845, 8308, 7983, 8195, 2443,
+	727, 6667, 2602, 7218, 2599, 7775, 4066, 6100, 5848, 418,
+	1844, 168, 5627, 874, 787, 6429, 5302, 5150, 8075, 2399,
+	1902, 4355, 6284, 7021, 284, 3610, 3057, 6872, 795, 7746,
+	1395, 332, 6475, 5033, 8298, 6578, 295, 6608, 7863, 6744,
+	5815, 2884, 3309, 1726, 6727, 1879, 1081, 4069, 7532, 4948,
+	1382, 1016, 7222, 4460, 883, 2363, 7399, 2431, 2279, 8230,
+	4235, 6966, 5149, 5590, 119, 5057, 936, 8133, 828, 7456,
+	2110, 3465, 4319, 4994, 6207, 7869, 6293, 504, 7418, 6656,
+	4900, 1487, 8039, 7370, 150, 1185, 6069, 1744, 1975, 6767,
+	3322, 3162, 246, 3107, 5918, 4576, 1940, 4423, 3790, 4203,
+	1228, 6066, 7968, 8093, 7796, 7534, 5265, 2815, 6555, 5785,
+	7202, 4456, 7737, 4200, 981, 863, 7410, 6366, 4116, 6878,
+	1473, 1128, 2124, 4252, 4651, 4469, 7434, 6, 6032, 7887,
+	3442, 1638, 6255, 4453, 7206, 5431, 3188, 5656, 6270, 1584,
+	4056, 3193, 3214, 1148, 3464, 1368, 4229, 1215, 1386, 5926,
+	7040, 1102, 7357, 3210, 6361, 8192, 3003, 185, 7618, 7289,
+	8297, 2257, 7955, 7594, 7873, 3279, 2579, 7806, 3164, 5319,
+	2893, 6607, 1513, 632, 1377, 8062, 2865, 2701, 623, 6580,
+	7359, 7948, 2654, 1806, 5106, 6528, 7689, 8082, 2899, 5316,
+	728, 2493, 6577, 3462, 8049, 7606, 1414, 5000, 7188, 5654,
+	2853, 2827, 5190, 4130, 5263, 5746, 3246, 108, 922, 4364,
+	4920, 236, 5469, 4033, 3290, 6533, 875, 3204, 1211, 4297,
+	1977, 6499, 3212, 8316, 2173, 5372, 7452, 6537, 3147, 6179,
+	2332, 5035, 5960, 230, 2830, 4995, 7116, 2681, 4417, 4152,
+	5724, 7232, 1474, 5078, 1121, 2948, 7979, 3563, 1326, 7938,
+	5708, 1101, 132, 1080, 4603, 7301, 6629, 4226, 4986, 3766,
+	13, 2880, 8067, 4111, 106, 3409, 3156, 2383, 731, 7309,
+	4251, 254, 3751, 7702, 5242, 34, 5996, 1800, 4748, 3489,
+	1534, 2083, 4724, 1450, 4380, 140, 2392, 3466, 4743, 3352,
+	2777, 1944, 2672, 1369, 1443, 8305, 2959, 3608, 3840, 7643,
+	2642, 2482, 6483, 3878, 6919, 2000, 2756, 4396, 744, 343,
+	6134, 5188, 7686, 6523, 2784, 3347, 5566, 1875, 6750, 6898,
+	6188, 5586, 5371, 4529, 4409, 3028, 5515, 7474, 6221, 7319,
+	5694, 2584, 2580, 627, 4736, 4358, 413, 87, 2165, 6482,
+	190, 6926, 1935, 4599, 5541, 3425, 8050, 1327, 2234, 2842,
+	5427, 3874, 4934, 7704, 792, 1331, 4127, 4903, 867, 5479,
+	3736, 956, 5262, 4981, 5634, 4415, 929, 4341, 195, 3325,
+	4698, 3011, 3731, 4247, 6839, 5558, 1827, 3749, 849, 2433,
+	5457, 2543, 6326, 5982, 6328, 4001, 1073, 870, 1427, 2968,
+	6113, 4308, 1258, 4975, 573, 7871, 7561, 2571, 5488, 7283,
+	4561, 3067, 7315, 7447, 1268, 3069, 4795, 8287, 223, 4533,
+	2648, 7688, 1142, 8374, 668, 6399, 6433, 1454, 5581, 4253,
+	7122, 281, 5562, 3539, 207, 2858, 7642, 6201, 5305, 5072,
+	4892, 2832, 1650, 52, 2116, 1962, 2965, 1781, 4366, 438,
+	6232, 1685, 2953, 5450, 2698, 7798, 3820, 3257, 930, 2820,
+	383, 1508, 540, 1908, 1106, 3102, 5630, 3236, 1254, 2723,
+	4912, 503, 7696, 4702, 105, 7542, 2555, 4249, 6035, 3100,
+	2221, 2988, 3842, 5087, 6087, 6631, 893, 5494, 2281, 1157,
+	7609, 1554, 3893, 5266, 5613, 3145, 1026, 3071, 6486, 3747,
+	8076, 4908, 7804, 954, 3311, 3329, 2156, 7022, 1933, 5833,
+	723, 6657, 5824, 644, 1982, 196, 4588, 7484, 3726, 6445,
+	6008, 6472, 7042, 2762, 1151, 6075, 3557, 1639, 6056, 5887,
+	6556, 1010, 2033, 4305, 3497, 4172, 1925, 5885, 334, 7872,
+	6256, 2157, 7239, 2617, 5473, 717, 6890, 1426, 131, 1339,
+	4649, 869, 5050, 6449, 8114, 4461, 2958, 8387, 7526, 7358,
+	5686, 6131, 633, 1721, 3890, 8149, 4044, 6295, 3078, 5386,
+	2641, 3087, 362, 4086, 4250, 7651, 3049, 7238, 3377, 1242,
+	7061, 6413, 4346, 5860, 394, 2099, 3303, 7, 2916, 931,
+	1932, 3585, 944, 6322, 3690, 1256, 3081, 3326, 1558, 643,
+	1084, 5705, 2614, 2894, 5145, 7787, 3763, 1356, 3627, 267,
+	6465, 1492, 6154, 4997, 8326, 4809, 5952, 2015, 3819, 2180,
+	6698, 1281, 535, 8303, 1959, 4600, 7719, 5124, 217, 7847,
+	4473, 4960, 7571, 6541, 5438, 2365, 2561, 1958, 817, 8079,
+	7400, 4601, 685, 5186, 617, 5559, 4555, 6526, 3482, 1087,
+	3148, 2509, 8070, 7531, 2856, 7588, 6187, 4766, 7612, 6288,
+	1388, 1196, 1336, 8320, 928, 4849, 5513, 7669, 6403, 6230,
+	3036, 7733, 3947, 4606, 767, 3448, 6623, 1716, 3260, 7937,
+	676, 6247, 1089, 3938, 2042, 3480, 7769, 7176, 6292, 4153,
+	7934, 5894, 2423, 6373, 7765, 4789, 6423, 4219, 4134, 834,
+	9, 1092, 4887, 8281, 6677, 845, 7329, 6985, 992, 3403,
+	8293, 5933, 6792, 6308, 543, 4867, 7111, 4878, 1348, 5674,
+	2327, 4827, 4598, 2300, 7020, 1208, 5547, 1409, 6022, 2389,
+	8129, 4403, 2254, 7925, 1433, 5780, 3516, 6799, 7268, 1970,
+	6539, 5025, 1967, 3190, 211, 6737, 2146, 725, 4871, 8013,
+	4857, 3551, 7221, 8165, 3985, 7182, 3821, 4823, 1440, 482,
+	4613, 6565, 5341, 6915, 7866, 1707, 2031, 1667, 580, 6251,
+	3351, 7109, 1688, 3357, 141, 5843, 4471, 1966, 3902, 6427,
+	697, 4470, 7476, 1396, 3935, 3062, 367, 7809, 1911, 6857,
+	7605, 1623, 3964, 753, 4515, 3587, 7980, 7677, 3522, 1817,
+	6772, 1870, 1059, 2906, 5290, 7755, 1187, 2239, 2828, 5796,
+	287, 4850, 1741, 6991, 7485, 2253, 6810, 2029, 1562, 2548,
+	3413, 2202, 4386, 2318, 6348, 5446, 7780, 3470, 3783, 411,
+	4640, 5168, 6048, 2484, 1122, 1603, 5764, 4039, 3717, 5402,
+	1950, 4757, 2236, 1761, 4896, 6559, 5317, 1046, 6115, 6853,
+	2929, 7924, 6503, 774, 45, 7638, 220, 5665, 6409, 2368,
+	2673, 3314, 6801, 4730, 7398, 6939, 7653, 2801, 1719, 957,
+	1008, 3469, 3779, 8225, 7306, 6157, 4377, 2697, 4635, 135,
+	4303, 314, 4761, 4223, 2696, 1777, 4098, 1763, 1861, 2608,
+	5826, 6603, 7683, 6776, 3653, 3095, 259, 8268, 6686, 4771,
+	5477, 4806, 4289, 4566, 244, 1774, 6553, 2129, 5740, 5062,
+	4171, 4318, 5604, 6150, 4638, 6412, 555, 2628, 348, 2610,
+	1795, 5447, 2699, 1362, 2241, 4, 2206, 26, 6986, 2169,
+	458, 5022, 986, 6803, 4381, 6719, 5037, 1091, 7096, 3725,
+	3808, 7158, 8336, 4040, 4790, 6186, 2161, 7663, 2456, 2336,
+	6168, 1118, 3887, 467, 5954, 5595, 4176, 1860, 754, 7620,
+	6618, 7959, 1146, 1141, 4395, 2591, 1831, 6661, 6191, 1127,
+	1801, 6711, 6645, 7628, 1633, 3459, 2008, 5052, 7707, 4623,
+	4544, 5739, 2216, 4597, 4834, 5160, 5203, 778, 1839, 420,
+	4673, 3753, 1251, 1111, 5205, 3150, 7194, 5491, 3967, 3971,
+	7377, 6152, 443, 1857, 4347, 4441, 3796, 8057, 6051, 6411,
+	3769, 1253, 7363, 1649, 4057, 37, 6814, 3379, 1488, 4065,
+	130, 3538, 3525, 3930, 7062, 6174, 7092, 6376, 454, 1078,
+	5577, 1056, 4563, 4499, 419, 2375, 304, 406, 5895, 8097,
+	7758, 6777, 5318, 6246, 5487, 7762, 7174, 756, 5965, 1308,
+	1629, 7208, 7038, 5637, 4808, 2345, 5284, 3265, 8384, 3245,
+	2694, 3281, 7317, 581, 614, 6749, 1247, 8084, 194, 410,
+	8181, 4145, 2026, 1680, 6180, 4157, 765, 5297, 3792, 1969,
+	2872, 6903, 379, 6746, 5337, 4102, 4502, 2001, 3876, 1764,
+	5571, 5886, 7908, 5036, 5623, 2496, 6470, 7423, 846, 7409,
+	104, 5720, 4910, 1422, 1907, 4512, 1062, 5721, 5832, 3334,
+	3364, 1197, 4701, 4464, 6380, 4575, 4625, 3628, 4052, 7932,
+	5414, 8143, 7135, 5625, 165, 5912, 3897, 6229, 3504, 4709,
+	2633, 3333, 1545, 1165, 7291, 4705, 2517, 3920, 1841, 6652,
+	8157, 683, 7249, 423, 4821, 4713, 3718, 4269, 3611, 6426,
+	4829, 2758, 5510, 3986, 7420, 1848, 4611, 7257, 526, 4254,
+	2073, 2869, 2334, 8055, 7014, 7028, 6209, 7734, 608, 5498,
+	3388, 7631, 1727, 7933, 6000, 610, 99, 3996, 8036, 4636,
+	1559, 1877, 2491, 797, 2302, 4694, 810, 7805, 921, 2355,
+	3089, 3009, 2362, 1144, 2737, 6103, 7617, 6735, 2220, 4075,
+	847, 318, 5387, 7282, 7517, 3883, 7337, 4113, 3809, 6238,
+	2663, 2335, 693, 7549, 5, 4328, 3031, 6166, 747, 5853,
+	215, 7996, 4294, 2240, 3008, 4230, 1896, 7120, 5997, 5069,
+	7735, 5580, 2319, 1829, 1945, 1124, 8271, 6820, 6387, 7167,
+	5664, 1891, 5817, 1297, 7280, 4969, 876, 7299, 5610, 2518,
+	7827, 4654, 1370, 1973, 3822, 806, 2040, 4121, 1815, 88,
+	487, 1478, 6138, 2296, 202, 6981, 3672, 68, 4505, 6428,
+	2408, 3496, 5847, 964, 8168, 1833, 582, 5128, 4665, 4468,
+	2272, 919, 1923, 2395, 656, 5470, 7180, 1946, 6062, 4517,
+	597, 277, 3924, 4174, 6337, 2567, 2781, 3569, 6875, 1718,
+	6636, 7454, 8113, 4061, 1919, 5340, 4650, 3851, 3802, 3656,
+	6584, 2813, 7164, 3376, 6140, 6476, 4472, 4797, 7356, 8048,
+	7714, 237, 8136, 1468, 1531, 2994, 1149, 953, 6074, 6019,
+	962, 6963, 6345, 1055, 7234, 902, 783, 4375, 6123, 1740,
+	5151, 8274, 4695, 271, 6678, 5223, 2048, 5880, 5839, 158,
+	1921, 8127, 2891, 2533, 4688, 2713, 1496, 6834, 4393, 853,
+	3987, 3149, 6558, 3070, 2618, 8352, 4574, 228, 5157, 836,
+	2081, 5904, 7240, 255, 942, 6244, 2716, 4687, 5862, 144,
+	3688, 4087, 6766, 4163, 5478, 2011, 6518, 3387, 4498, 3422,
+	2692, 4107, 4391, 6712, 5127, 5576, 3295, 4334, 7444, 5774,
+	7219, 296, 1108, 1219, 1301, 1805, 8246, 3923, 5956, 4140,
+	4837, 5846, 6852, 3647, 161, 1123, 2043, 2529, 2572, 5837,
+	2613, 6897, 7712, 529, 7270, 5923, 1065, 7031, 737, 1023,
+	3111, 5098, 4787, 2707, 3174, 552, 3593, 5816, 6459, 5639,
+	1696, 2660, 3513, 3313, 6461, 5252, 8052, 1419, 8196, 2187,
+	696, 5174, 351, 5466, 7300, 898, 1905, 7269, 5642, 6888,
+	4092, 5777, 7975, 7034, 5615, 8191, 2259, 829, 5449, 4580,
+	5971, 4025, 7600, 8154, 8284, 5991, 227, 7058, 5545, 6593,
+	2559, 2137, 1347, 7604, 909, 5769, 1762, 3774, 6561, 3165,
+	6266, 4385, 27, 7169, 6601, 3732, 6355, 1181, 7304, 272,
+	2231, 6794, 5602, 7404, 6210, 5249, 8126, 4933, 8130, 2487,
+	719, 2150, 751, 2424, 7589, 8068, 2725, 6450, 3301, 7493,
+	684, 8072, 7424, 3602, 4166, 2676, 1882, 6710, 5161, 7513,
+	5930, 2127, 1658, 3393, 1992, 3944, 5804, 3848, 4323, 5055,
+	6488, 5945, 2826, 5544, 2847, 2903, 6080, 1519, 6092, 3427,
+	7679, 4626, 6391, 6933, 2646, 7615, 4727, 8115, 4184, 2017,
+	8031, 2346, 4210, 5379, 8024, 3030, 6063, 3648, 1014, 1954,
+	926, 2963, 3343, 3287, 6141, 5158, 4526, 850, 5663, 6336,
+	6604, 6419, 4477, 4840, 1451, 5938, 4261, 3581, 2393, 2435,
+	4620, 2390, 6988, 3121, 7518, 7195, 692, 7342, 70, 2900,
+	1412, 235, 3025, 7708, 784, 1675, 5195, 2148, 5330, 483,
+	8178, 3063, 6780, 1998, 6942, 3228, 8232, 6730, 2706, 7505,
+	2215, 7876, 1095, 321, 1206, 8363, 5940, 3171, 2264, 7067,
+	2199, 7879, 238, 7861, 1329, 7278, 4156, 6439, 1587, 5248,
+	7461, 7550, 736, 1713, 3738, 4494, 3528, 1437, 384, 3691,
+	4058, 2282, 2091, 2841, 3916, 7794, 3421, 5194, 320, 7373,
+	8095, 7433, 6484, 1643, 5361, 2749, 5692, 4571, 1403, 6599,
+	71, 7060, 7099, 2759, 7381, 6364, 1353, 4483, 5397, 714,
+	2092, 4218, 7335, 374, 5282, 2030, 7672, 2587, 4508, 7652,
+	5076, 74, 1854, 7701, 748, 5516, 2258, 4125, 5881, 7511,
+	3961, 5404, 1446, 2512, 5827, 378, 5435, 4114, 3430, 1497,
+	5879, 5748, 5222, 6424, 5113, 7999, 6217, 2193, 7049, 4411,
+	593, 3892, 3061, 5207, 2984, 2970, 5984, 2740, 8214, 4562,
+	8021, 4142, 274, 7173, 2951, 1237, 4151, 7246, 594, 7352,
+	5115, 1495, 1113, 224, 2385, 6807, 4862, 3302, 7160, 2905,
+	5539, 201, 4684, 2864, 8292, 4488, 8092, 7078, 7761, 5277,
+	822, 7087, 7647, 1460, 7580, 2244, 3531, 6554, 1200, 1391,
+	6036, 5056, 6542, 7888, 288, 8028, 1441, 2553, 5099, 6009,
+	4846, 3877, 823, 5358, 1300, 4589, 3451, 468, 2294, 7350,
+	1529, 1393, 4770, 2839, 5417, 2481, 603, 5024, 7019, 5338,
+	7466, 46, 2438, 5391, 6220, 7422, 6557, 8206, 7971, 4493,
+	2274, 3339, 6071, 3995, 5162, 6873, 81, 1516, 293, 2889,
+	4155, 5659, 4852, 5084, 2415, 4858, 2325, 1490, 7154, 5570,
+	2051, 3807, 7859, 5731, 5144, 8234, 5866, 2585, 2353, 6936,
+	7648, 2177, 2185, 3856, 7228, 2819, 7941, 5927, 5146, 7000,
+	1915, 1759, 7912, 5006, 2933, 4775, 3889, 6172, 139, 3936,
+	3037, 6757, 6994, 4361, 2500, 7573, 1535, 3863, 8371, 5197,
+	5672, 6620, 4564, 1423, 5139, 92, 3327, 4648, 111, 2983,
+	7349, 5437, 1750, 1233, 6485, 91, 7820, 6984, 6586, 149,
+	1267, 2134, 7920, 6444, 5552, 1684, 5591, 7577, 505, 2039,
+	1804, 1876, 8294, 2075, 7646, 3931, 3655, 8064, 2767, 2789,
+	4397, 6473, 6613, 738, 3192, 4459, 1020, 3664, 5865, 6059,
+	4739, 4428, 5010, 3554, 4178, 4213, 5715, 21, 2743, 0,
+	6724, 5005, 4043, 6879, 446, 1766, 1322, 3404, 6616, 4898,
+	1365, 6471, 2565, 7741, 1199, 107, 5975, 3397, 7437, 3827,
+	7524, 6015, 6617, 1340, 2380, 1765, 266, 1057, 2071, 5456,
+	7919, 1420, 3564, 7619, 4549, 2142, 5455, 3163, 4496, 4554,
+	1926, 4343, 6960, 3979, 8005, 5134, 3823, 7914, 1590, 3556,
+	2079, 5718, 4122, 4055, 6653, 4382, 7562, 3262, 6281, 5390,
+	8217, 3445, 7018, 6370, 5089, 6923, 5298, 5357, 6204, 1088,
+	8257, 4729, 5132, 3735, 3226, 2992, 7625, 1698, 3012, 7075,
+	7846, 1346, 4046, 3663, 1060, 5220, 2601, 4711, 5553, 7162,
+	8377, 3140, 4059, 7046, 3039, 8204, 4838, 6023, 2041, 3073,
+	5784, 3126, 1802, 802, 3704, 887, 934, 5368, 3906, 7157,
+	686, 3007, 4315, 1288, 6250, 2724, 8265, 7383, 176, 3734,
+	174, 918, 7916, 163, 4338, 4609, 3714, 8198, 1156, 2745,
+	1723, 1775, 6848, 2183, 4895, 4367, 5116, 4188, 1949, 1230,
+	911, 1366, 1103, 5657, 3540, 5237, 402, 8119, 574, 6600,
+	3724, 1405, 5709, 1262, 1856, 5475, 6692, 4977, 1384, 906,
+	6862, 3406, 3320, 2644, 6170, 7161, 6980, 8117, 5851, 1040,
+	4799, 3198, 5026, 2388, 3211, 5737, 2883, 7407, 3321, 7994,
+	6833, 5117, 1387, 3274, 2357, 4627, 5378, 4583, 776, 2971,
+	1717, 4198, 6529, 3992, 5937, 2003, 3917, 7016, 206, 1668,
+	5587, 5415, 5983, 5008, 5669, 5684, 3286, 638, 2349, 3949,
+	7083, 6371, 4559, 6850, 441, 275, 982, 5567, 3837, 788,
+	3574, 1886, 1270, 8233, 1210, 7134, 4115, 8046, 8221, 5693,
+	896, 6806, 3104, 5651, 8160, 3644, 5425, 2871, 3696, 5608,
+	7601, 4768, 1030, 2107, 6460, 584, 3743, 4954, 709, 29,
+	17, 7839, 3224, 3283, 3010, 3285, 279, 1961, 8310, 1583,
+	1565, 726, 7738, 4201, 5332, 4894, 6362, 7017, 1544, 2675,
+	1788, 3697, 3074, 7954, 5768, 4537, 5829, 1345, 8186, 7032,
+	3660, 7334, 2024, 331, 3891, 1550, 2934, 1432, 3954, 5310,
+	6020, 798, 2377, 2056, 2527, 6498, 1903, 916, 1996, 2513,
+	3998, 4841, 732, 6466, 7595, 6090, 4207, 3708, 4195, 6344,
+	710, 3635, 5550, 5989, 2331, 6953, 640, 5503, 4697, 1500,
+	750, 4474, 8007, 3122, 2700, 1439, 3365, 7698, 3437, 5609,
+	69, 7286, 6501, 2112, 819, 6863, 1812, 4950, 7183, 2449,
+	5605, 5778, 66, 7901, 3440, 4078, 109, 6338, 2470, 6111,
+	2508, 4953, 432, 3054, 6481, 2631, 5272, 5754, 4853, 1769,
+	2472, 8045, 7312, 1279, 6386, 7233, 7253, 842, 7514, 4363,
+	101, 1853, 469, 563, 2076, 6999, 2957, 1654, 5334, 2966,
+	3084, 4659, 11, 6987, 2289, 7779, 4421, 8212, 2057, 1569,
+	5877, 78, 310, 4856, 183, 7816, 4481, 3353, 222, 1191,
+	3034, 3363, 6401, 4443, 7811, 3909, 2678, 3500, 5680, 4360,
+	5095, 8279, 4722, 1192, 3323, 7110, 1811, 268, 5677, 8033,
+	7265, 4447, 6047, 3505, 4572, 2455, 6432, 1294, 1221, 8120,
+	5660, 5647, 6546, 6002, 1964, 7634, 4259, 2308, 7984, 3408,
+	3997, 7655, 1350, 4893, 1501, 4753, 6867, 7258, 5239, 6227,
+	1672, 7150, 5883, 4233, 7843, 7539, 3173, 6738, 5053, 6038,
+	291, 3959, 3804, 6705, 5434, 7469, 4407, 1175, 6120, 2943,
+	5888, 2412, 2824, 4431, 322, 3928, 4924, 7870, 93, 7906,
+	1657, 1702, 1548, 4546, 4150, 6886, 4402, 7379, 3176, 4035,
+	4340, 558, 8277, 8365, 661, 4189, 7490, 7931, 1898, 5384,
+	1491, 2503, 1074, 6414, 1458, 8342, 5191, 1314, 527, 2609,
+	2972, 339, 6885, 7235, 7682, 455, 3684, 1637, 7763, 4731,
+	7212, 3158, 6782, 6263, 1837, 15, 154, 1868, 3231, 5582,
+	1180, 1050, 4881, 6524, 2975, 923, 2263, 4089, 1955, 1244,
+	7660, 1606, 3592, 6464, 4677, 6421, 1154, 5979, 5288, 2551,
+	2502, 5208, 3903, 938, 1486, 7153, 7085, 1855, 1733, 8286,
+	6909, 4971, 5320, 399, 6764, 3818, 1275, 4714, 4754, 4814,
+	2914, 1198, 252, 4216, 5842, 4721, 4607, 7772, 3748, 1114,
+	6076, 4584, 4339, 6417, 4628, 1540, 7928, 3942, 8141, 1789,
+	6107, 6714, 2885, 8357, 3134, 5286, 5315, 1909, 4031, 2825,
+	6954, 359, 6219, 6218, 278, 4295, 1681, 7391, 3041, 8219,
+	2582, 4180, 2878, 2414, 1746, 300, 8243, 5122, 5392, 7976,
+	2490, 6751, 7323, 7343, 1616, 523, 5921, 6033, 1573, 4535,
+	7348, 4735, 4568, 1036, 7297, 6368, 1259, 6420, 4433, 7546,
+	7175, 1809, 5247, 6788, 3367, 6253, 1872, 3921, 232, 245,
+	7732, 7922, 6859, 248, 704, 4531, 4053, 6305, 1676, 8270,
+	1576, 1358, 6666, 1824, 294, 4278, 1140, 5611, 8004, 3695,
+	970, 2421, 5935, 8203, 404, 4602, 7559, 5200, 3881, 2372,
+	3382, 3038, 5671, 4479, 855, 1512, 8311, 7450, 3857, 2739,
+	6021, 5192, 4921, 6742, 6375, 6155, 7225, 401, 6037, 6959,
+	118, 1477, 4437, 6588, 5776, 3154, 7807, 1499, 1063, 2437,
+	5667, 2797, 1941, 6156, 1457, 2794, 4017, 8373, 3795, 6955,
+	5102, 7281, 6634, 3999, 7256, 4451, 1172, 5948, 894, 3885,
+	7076, 6708, 6324, 2065, 4425, 5699, 4202, 6479, 5972, 5813,
+	3572, 4956, 6916, 8393, 522, 8291, 1152, 700, 5077, 6775,
+	1214, 7436, 1276, 1171, 200, 5365, 7543, 1359, 333, 7168,
+	5761, 2190, 859, 5756, 3624, 2172, 4899, 5065, 7529, 4405,
+	3657, 3745, 3029, 1656, 6715, 4641, 5126, 2674, 7007, 4680,
+	4756, 7988, 7800, 427, 2094, 1691, 3894, 6576, 1182, 1980,
+	2352, 612, 6360, 2544, 3982, 1447, 8229, 1936, 4567, 7715,
+	4843, 3206, 5573, 5342, 996, 2100, 2338, 6084, 4112, 1389,
+	6425, 7944, 6957, 4300, 3625, 7360, 6841, 2473, 7458, 2442,
+	3787, 6513, 5294, 4006, 7205, 5655, 3491, 471, 3739, 7079,
+	1575, 65, 460, 7849, 5141, 1204, 1311, 2911, 2560, 914,
+	3438, 1006, 724, 6276, 7626, 4676, 1238, 3027, 2583, 350,
+	7103, 6574, 6535, 5049, 5978, 2764, 7324, 6013, 4590, 5339,
+	1987, 3918, 1591, 5958, 7519, 3854, 2351, 565, 1552, 2170,
+	6818, 3268, 5538, 7510, 8301, 7791, 7751, 276, 2816, 2625,
+	4374, 6633, 557, 83, 3233, 1756, 6813, 2105, 6789, 7128,
+	143, 6594, 5202, 6088, 3681, 2986, 142, 6741, 7231, 5782,
+	2836, 3912, 2534, 5234, 1417, 7956, 3044, 2125, 1169, 4812,
+	3225, 6721, 780, 477, 4642, 1724, 945, 2301, 2954, 631,
+	5745, 531, 7727, 5121, 2063, 8173, 1630, 5366, 6811, 5953,
+	4693, 4436, 2612, 2004, 3091, 5939, 3021, 6887, 6492, 6560,
+	7973, 3750, 264, 5156, 1984, 1202, 7535, 5569, 3043, 191,
+	3929, 5187, 5031, 3710, 1255, 7341, 3838, 2406, 55, 123,
+	679, 4389, 3374, 4883, 7570, 7812, 1203, 6855, 3153, 6552,
+	6743, 4758, 8162, 1881, 486, 6732, 5443, 2211, 8245, 5444,
+	3634, 5697, 7274, 3549, 1621, 5460, 5574, 6945, 2981, 7203,
+	6996, 7774, 8010, 3972, 5788, 4329, 4193, 3443, 8302, 7759,
+	5683, 6663, 1511, 5753, 5771, 1952, 1066, 2280, 6226, 3761,
+	2650, 4038, 6040, 6309, 8014, 4741, 4094, 7610, 2028, 345,
+	5418, 3770, 7705, 2476, 2271, 5088, 3830, 4578, 50, 7440,
+	3511, 2795, 907, 4779, 8335, 4181, 2195, 4179, 6130, 8080,
+	4373, 3692, 2741, 8325, 148, 940, 7649, 5363, 6497, 3240,
+	4973, 2025, 3501, 6654, 6575, 1332, 208, 4868, 4267, 2323,
+	512, 3434, 2196, 3974, 1808, 2665, 3337, 3242, 5407, 2765,
+	1665, 920, 5597, 8209, 6674, 3494, 4794, 8063, 3423, 4484,
+	4378, 8255, 5840, 3858, 2106, 5717, 5561, 5467, 4557, 1012,
+	6717, 7993, 4946, 6946, 7913, 4271, 5901, 2152, 4462, 263,
+	199, 4482, 8210, 8018, 4520, 2791, 1514, 1024, 2143, 4284,
+	6822, 6408, 6672, 7838, 4617, 3186, 6748, 1354, 5359, 7630,
+	4418, 4907, 4614, 716, 7778, 5485, 3640, 8350, 6929, 1188,
+	8358, 1069, 6300, 2729, 2153, 1686, 2045, 1773, 4691, 30,
+	3872, 1027, 5219, 3523, 5327, 2268, 7541, 653, 4273, 559,
+	5987, 1222, 1913, 7875, 3533, 6504, 1096, 5594, 6007, 415,
+	2326, 1758, 5855, 3429, 6260, 2731, 5323, 6374, 1466, 7960,
+	3125, 6259, 8376, 6935, 2371, 860, 5807, 4998, 897, 961,
+	5616, 6993, 5015, 8040, 6072, 2400, 5189, 4412, 7739, 7401,
+	8098, 2108, 7439, 6765, 5110, 5924, 3316, 4106, 1436, 7574,
+	3449, 6846, 8153, 7611, 1216, 6790, 1613, 8368, 1195, 7131,
+	18, 3755, 7997, 4928, 7874, 5016, 5994, 5941, 6294, 5661,
+	7126, 2592, 6835, 2680, 2475, 152, 6908, 4644, 5791, 1560,
+	8348, 4717, 2823, 6109, 4369, 2595, 2669, 7579, 4633, 425,
+	3115, 6948, 988, 1448, 7129, 7958, 1367, 1836, 6319, 5138,
+	4890, 3026, 2467, 2002, 521, 7477, 1852, 4182, 4283, 3673,
+	2855, 6268, 2652, 4657, 3371, 6971, 6700, 7864, 6914, 3788,
+	2923, 4532, 6836, 57, 1357, 8236, 5432, 6057, 8331, 3527,
+	3816, 8333, 4037, 2422, 4077, 1469, 6418, 7614, 2256, 3179,
+	2747, 1126, 6342, 5666, 2728, 4966, 752, 5543, 353, 3345,
+	7545, 3643, 2708, 7027, 4664, 2774, 4669, 4523, 6396, 3758,
+	7616, 5244, 2892, 2659, 864, 7736, 5727, 690, 6192, 8330,
+	6912, 1609, 1635, 6124, 7897, 6358, 2178, 8132, 5412, 5243,
+	1333, 3600, 5681, 5620, 7855, 2515, 282, 5238, 7840, 1572,
+	5369, 3119, 1028, 5267, 4349, 3258, 7184, 838, 741, 4952,
+	2219, 3006, 7848, 6589, 5521, 1269, 3342, 5495, 3289, 2761,
+	31, 5257, 912, 5698, 800, 6703, 4759, 2402, 5303, 7895,
+	6609, 2852, 2098, 8071, 826, 6781, 7680, 6258, 1090, 6598,
+	8273, 7868, 1748, 6907, 7244, 7886, 6089, 815, 3428, 3521,
+	8322, 598, 4205, 2420, 7325, 1619, 6133, 2445, 5091, 4652,
+	6595, 2621, 1832, 4010, 4321, 4720, 6489, 392, 634, 5250,
+	7586, 2835, 6548, 605, 2730, 2227, 7392, 5568, 7963, 2671,
+	7070, 2630, 6869, 2203, 4282, 7055, 4147, 8250, 1220, 2046,
+	3632, 6478, 5346, 949, 7050, 5508, 932, 7170, 1277, 3742,
+	1663, 6952, 3205, 4707, 476, 7089, 8385, 6446, 7460, 6265,
+	396, 6398, 1697, 4138, 5907, 762, 6137, 2918, 2330, 6545,
+	5518, 3550, 2542, 8309, 6549, 6709, 3919, 6060, 2522, 7047,
+	8184, 2101, 5563, 3649, 1429, 5291, 3798, 2249, 7064, 6507,
+	184, 2850, 371, 7754, 5213, 8283, 8112, 7851, 6463, 4208,
+	6562, 8253, 1017, 5876, 4777, 1119, 8091, 1041, 1068, 1542,
+	6206, 4095, 2687, 3729, 7123, 2138, 2937, 6061, 2549, 3395,
+	7486, 102, 2095, 4978, 7313, 380, 7097, 997, 1307, 1470,
+	6802, 607, 6405, 6164, 5355, 3237, 3605, 6435, 2895, 4008,
+	5913, 7384, 493, 799, 7482, 5765, 6697, 6436, 3485, 1732,
+	7909, 4191, 7378, 6544, 3543, 5071, 5499, 4874, 6827, 4446,
+	8264, 4926, 5019, 2578, 5458, 6314, 7946, 2510, 5314, 7726,
+	5534, 4292, 4570, 5899, 3418, 6847, 4495, 7828, 1899, 1557,
+	7661, 7271, 7197, 7264, 4427, 1064, 1218, 5416, 6438, 3604,
+	2312, 3304, 4762, 3721, 4678, 1252, 5304, 816, 4263, 3956,
+	7506, 3092, 1580, 4573, 7416, 8023, 7890, 4988, 8128, 5496,
+	428, 6128, 3797, 2298, 4605, 2908, 7608, 3641, 421, 2805,
+	491, 6493, 2005, 6693, 8147, 5394, 4798, 216, 665, 7771,
+	198, 270, 7393, 4592, 4013, 2541, 6924, 23, 5689, 4791,
+	3495, 6816, 8190, 8266, 1373, 5482, 1610, 3631, 2575, 435,
+	8355, 3483, 162, 6943, 4000, 8378, 6394, 6043, 3978, 5999,
+	3064, 365, 3589, 1011, 4063, 3288, 4744, 1598, 6455, 7756,
+	5051, 6050, 2653, 6641, 3227, 5306, 4503, 5484, 5109, 3261,
+	3016, 4084, 5977, 7371, 6779, 5916, 4539, 8174, 2733, 4788,
+	1002, 5236, 2684, 1539, 541, 766, 5043, 5706, 5453, 103,
+	6759, 3953, 5850, 7069, 5030, 3278, 243, 7321, 6254, 6341,
+	4260, 4236, 6673, 8260, 189, 1865, 7507, 6369, 2651, 6762,
+	4299, 5800, 3976, 414, 4595, 5066, 3793, 7575, 6382, 796,
+	6451, 5504, 2066, 2964, 6913, 4793, 6397, 6864, 808, 5961,
+	8288, 7408, 5676, 280, 5890, 3880, 8202, 3276, 3730, 1700,
+	5583, 3510, 3135, 7985, 4014, 1022, 4681, 5002, 3455, 3639,
+	8361, 6506, 3618, 2329, 6694, 812, 3380, 4951, 4860, 5955,
+	3024, 2870, 4047, 6202, 6774, 1869, 4242, 5537, 903, 3553,
+	1289, 3436, 5424, 8042, 635, 615, 33, 4656, 7213, 7750,
+	7856, 691, 6583, 809, 8307, 1929, 7674, 5762, 1612, 1052,
+	231, 900, 6024, 4618, 3705, 2118, 3175, 8041, 5345, 5749,
+	888, 8244, 2356, 2976, 1104, 2283, 4879, 3435, 5093, 1150,
+	7528, 805, 4831, 2919, 1624, 592, 1035, 4796, 349, 6961,
+	3113, 8282, 8137, 7657, 4819, 7632, 4419, 1003, 768, 1753,
+	8386, 3835, 1298, 5635, 5408, 6183, 1361, 2237, 7464, 6679,
+	5308, 3187, 2418, 2868, 7412, 3620, 3361, 7365, 7036, 3957,
+	98, 6512, 4275, 7442, 4434, 3603, 3105, 7568, 6213, 3166,
+	325, 7992, 5165, 3939, 1678, 2494, 2536, 6005, 2409, 3336,
+	3977, 3658, 1421, 1058, 2866, 976, 5410, 58, 857, 7824,
+	7455, 1993, 8304, 1968, 2607, 3370, 7445, 4828, 6415, 4220,
+	48, 1136, 346, 4666, 1265, 8180, 2147, 1690, 658, 6970,
+	1894, 5838, 6997, 7533, 2479, 2382, 7990, 6199, 4228, 1615,
+	4959, 8151, 2287, 2721, 5970, 5039, 2924, 2882, 8030, 3590,
+	5096, 3086, 3306, 3623, 8002, 673, 7681, 6964, 2069, 6920,
+	7209, 7784, 6597, 4331, 6065, 1506, 3817, 7112, 7950, 4159,
+	6139, 941, 5046, 5385, 2519, 6185, 6606, 7961, 4501, 517,
+	840, 1838, 2736, 4518, 2744, 6921, 760, 407, 167, 6096,
+	1985, 2849, 3633, 6303, 5423, 2709, 6630, 6918, 1243, 3398,
+	839, 155, 7923, 6519, 6612, 8015, 1546, 1039, 7163, 2131,
+	570, 3213, 5631, 44, 6895, 5070, 6793, 1979, 1335, 7361,
+	827, 595, 3700, 1272, 6516, 4661, 6566, 2804, 1302, 660,
+	2558, 5301, 1453, 2770, 1771, 4475, 1846, 4585, 368, 5976,
+	3801, 6858, 4399, 8194, 3583, 3298, 3970, 5245, 2035, 567,
+	7035, 6647, 1227, 7553, 3120, 7781, 6680, 3456, 4930, 5633,
+	5533, 5828, 5481, 6285, 1694, 5307, 2305, 6379, 4194, 7841,
+	6543, 4596, 4353, 7757, 3047, 5480, 1077, 3358, 1312, 42,
+	7639, 2695, 6442, 7880, 6877, 2405, 1593, 2058, 7090, 8345,
+	879, 6508, 2441, 4185, 3103, 5090, 4749, 5268, 3493, 1924,
+	6894, 2250, 7842, 779, 6569, 1589, 1785, 6416, 7152, 8272,
+	5193, 1250, 4500, 173, 6729, 356, 1553, 3284, 913, 3486,
+	1695, 713, 2126, 4248, 5641, 85, 459, 6786, 7082, 4128,
+	5232, 647, 4769, 730, 4048, 801, 4124, 1677, 1823, 1099,
+	5014, 3651, 2465, 8254, 5614, 4534, 2115, 6977, 6384, 4733,
+	7210, 1408, 2417, 7330, 2550, 5344, 2314, 562, 75, 3566,
+	591, 7596, 5428, 1884, 2539, 8347, 400, 5793, 480, 2859,
+	4023, 4553, 4164, 8017, 715, 3612, 5079, 6018, 6406, 3359,
+	4935, 3368, 6117, 3845, 1241, 2284, 6291, 1295, 3861, 4466,
+	7468, 1313, 4643, 7521, 3778, 7117, 1551, 7211, 16, 7390,
+	965, 256, 2084, 7678, 5105, 1626, 4105, 6830, 1965, 8381,
+	6934, 3369, 4902, 2637, 3040, 6975, 2778, 1328, 8026, 7724,
+	2426, 205, 4667, 239, 5928, 3950, 5007, 3481, 2611, 5648,
+	485, 3580, 8313, 4071, 5906, 6995, 5744, 3241, 2679, 3677,
+	6017, 4485, 1794, 3098, 8247, 7467, 5802, 1418, 214, 5348,
+	3253, 4521, 4362, 3733, 1072, 6713, 8085, 1093, 1509, 4972,
+	2837, 7189, 3529, 1999, 1145, 7797, 1158, 8242, 5011, 6434,
+	456, 3545, 959, 308, 3243, 7086, 3, 5217, 3216, 251,
+	6240, 6624, 1708, 4629, 5900, 3399, 588, 5849, 2391, 2788,
+	6456, 3617, 4542, 2879, 8267, 6922, 3270, 4965, 4384, 7372,
+	7483, 2726, 2645, 2176, 520, 5743, 7540, 1943, 1009, 7537,
+	5735, 86, 2956, 8107, 241, 1428, 2647, 4440, 6817, 720,
+	994, 7388, 3431, 5707, 1201, 7500, 3060, 7527, 1734, 1098,
+	4851, 4070, 2593, 7015, 8167, 1791, 187, 2163, 4160, 6509,
+	1364, 3542, 3094, 8241, 8099, 545, 2750, 2340, 6787, 6271,
+	7789, 1263, 1231, 3235, 566, 2379, 6006, 5172, 193, 6198,
+	286, 3905, 6095, 6236, 2785, 561, 7966, 3499, 51, 8193,
+	2913, 5871, 5870, 5882, 8012, 451, 1835, 2863, 4376, 577,
+	90, 1699, 5523, 5215, 3077, 4961, 364, 4480, 6034, 1963,
+	6030, 8078, 1983, 5280, 2566, 775, 7977, 4504, 4119, 939,
+	8090, 4683, 5757, 5185, 3139, 4214, 5622, 8086, 7143, 3669,
+	4398, 689, 1878, 8177, 2720, 6031, 8111, 1071, 7760, 1867,
+	7245, 533, 1341, 166, 2307, 3865, 4723, 1159, 7829, 7308,
+	5993, 1787, 4032, 8296, 6054, 4327, 6868, 2144, 1371, 4027,
+	877, 7172, 2230, 2130, 649, 475, 2160, 6701, 89, 6791,
+	6231, 2333, 3291, 5322, 4675, 2683, 7814, 2070, 3584, 6203,
+	6299, 5619, 2574, 2807, 7989, 4132, 1284, 2921, 8201, 7905,
+	439, 705, 311, 478, 1625, 249, 2634, 7624, 8327, 3711,
+	7098, 5216, 2209, 6447, 4426, 5312, 4984, 6585, 2798, 2754,
+	7773, 3866, 4604, 803, 4187, 5714, 6808, 7084, 32, 707,
+	8164, 4913, 3177, 8351, 2714, 1974, 5231, 79, 6143, 1138,
+	5040, 6333, 825, 1070, 5377, 7695, 4873, 6205, 2606, 2922,
+	3981, 1374, 7877, 7852, 4311, 7635, 5259, 8144, 3588, 8370,
+	7217, 6269, 5409, 472, 7508, 3223, 5354, 5209, 416, 6073,
+	2411, 7844, 5171, 1520, 3937, 1845, 8344, 6151, 569, 327,
+	3945, 4884, 6659, 5351, 95, 3676, 4274, 6112, 3349, 5169,
+	6901, 7557, 5511, 2010, 1459, 4807, 7576, 7572, 6655, 642,
+	814, 1305, 3559, 5426, 1007, 6505, 5373, 933, 7799, 4586,
+	7480, 7834, 457, 1217, 2191, 7353, 3137, 6547, 3249, 84,
+	3622, 3507, 872, 1939, 2278, 3335, 330, 3768, 4255, 8081,
+	3719, 718, 5710, 5445, 1337, 620, 1224, 2337, 7380, 5820,
+	5588, 2772, 3870, 8059, 6531, 385, 5653, 8340, 1153, 4002,
+	971, 4949, 3168, 3338, 8054, 5967, 1528, 6637, 7200, 935,
+	4833, 316, 3458, 5399, 6861, 5492, 5405, 6458, 5038, 1240,
+	1818, 1248, 4175, 2974, 6315, 39, 6550, 5798, 3615, 947,
+	1174, 6910, 1910, 5292, 4552, 4516, 4136, 128, 6159, 4818,
+	3548, 1556, 6892, 328, 6356, 5179, 8035, 1651, 3666, 6052,
+	1701, 7744, 2182, 2780, 7803, 2949, 8138, 2128, 377, 473,
+	8103, 3547, 733, 4489, 2655, 1338, 4012, 7364, 2787, 449,
+	297, 6003, 4974, 7802, 5884, 8379, 4042, 5285, 5462, 8134,
+	6938, 8135, 6722, 1049, 680, 6495, 4333, 4079, 5722, 8043,
+	5201, 8334, 137, 5643, 1166, 7429, 7881, 1, 7947, 6389,
+	5814, 712, 2760, 4547, 6353, 6431, 6316, 5638, 5224, 7023,
+	7882, 1782, 4262, 609, 466, 862, 5166, 3983, 3740, 1261,
+	1205, 6928, 4400, 159, 495, 2752, 3157, 891, 702, 995,
+	5799, 8179, 4438, 7241, 1013, 4746, 1783, 6805, 5893, 3461,
+	7548, 2742, 1604, 273, 1581, 5601, 2416, 1320, 2358, 3341,
+	192, 1434, 3683, 5685, 3207, 7499, 4312, 2662, 628, 3727,
+	5118, 5750, 2055, 4760, 7438, 2531, 3023, 8060, 3606, 5324,
+	613, 682, 4281, 8215, 2738, 4859, 791, 2447, 2052, 7857,
+	1538, 8318, 8226, 4137, 2373, 2552, 6282, 5691, 7936, 8341,
+	3780, 3803, 8073, 4211, 1858, 5381, 4784, 433, 7785, 422,
+	4076, 115, 6430, 2179, 2113, 5649, 2164, 5500, 7837, 711,
+	3709, 5738, 2888, 6390, 5763, 5459, 7538, 8159, 2201, 4556,
+	1627, 1212, 4173, 769, 4099, 7650, 3776, 974, 2428, 1863,
+	8121, 1524, 5395, 993, 6280, 4146, 7591, 5489, 4450, 1299,
+	2367, 5640, 6880, 3402, 7462, 782, 3277, 233, 7489, 4141,
+	5296, 5917, 5789, 3269, 4015, 5505, 1372, 5353, 5695, 3217,
+	8189, 5818, 7590, 1442, 1892, 8290, 8289, 6812, 7009, 7186,
+	2461, 221, 4712, 178, 4276, 1631, 3517, 8224, 7878, 3771,
+	4392, 8044, 1816, 841, 2398, 5810, 1735, 303, 1139, 2846,
+	2702, 2123, 22, 1916, 990, 2757, 7048, 3888, 3960, 4764,
+	5962, 4728, 20, 1160, 3124, 5108, 3682, 5313, 2174, 1737,
+	6310, 2452, 2530, 8011, 4631, 905, 3185, 7563, 3144, 8123,
+	6144, 5196, 7965, 1847, 2342, 5264, 2862, 1960, 5612, 6078,
+	6665, 3503, 587, 5483, 6125, 1739, 2016, 6477, 1830, 5911,
+	2993, 4545, 3884, 360, 3405, 337, 576, 6055, 7788, 7068,
+	1942, 2013, 3661, 6832, 3412, 2712, 549, 1162, 6116, 3001,
+	3578, 298, 2474, 2265, 6234, 6900, 5795, 1927, 3777, 3775,
+	6824, 8375, 4962, 2928, 7013, 6243, 2867, 2485, 6755, 6768,
+	387, 1937, 1416, 492, 6119, 6354, 35, 4842, 3170, 3108,
+	7054, 5711, 3833, 2851, 2640, 5471, 6004, 2154, 6891, 3991,
+	5154, 6784, 1399, 376, 837, 6642, 97, 6016, 4936, 2328,
+	6650, 5176, 4034, 4700, 1850, 41, 851, 8218, 4870, 703,
+	4569, 6184, 3254, 3065, 3128, 8029, 8372, 2691, 6372, 3568,
+	694, 3932, 2704, 5819, 4704, 1324, 4154, 1840, 363, 1978,
+	1956, 2775, 3752, 3463, 1661, 7041, 426, 1922, 2089, 4045,
+	1229, 7748, 5878, 4416, 6249, 3046, 6454, 3826, 2235, 6330,
+	8061, 4352, 3264, 8205, 7943, 6110, 3075, 6332, 336, 8263,
+	2273, 6277, 4170, 6289, 6327, 180, 6911, 583, 4905, 790,
+	1798, 6763, 2719, 5772, 515, 3477, 4449, 2818, 2605, 1634,
+	5530, 978, 3444, 757, 7362, 6778, 1309, 5074, 4370, 4457,
+	172, 5565, 4751, 3927, 1283, 1107, 6831, 6077, 2506, 4240,
+	5821, 7970, 7121, 5805, 7516, 3832, 5947, 5986, 3492, 5836,
+	1507, 794, 3385, 2649, 2109, 7684, 2982, 3900, 868, 2488,
+	1594, 6273, 156, 6474, 6099, 4227, 6736, 4073, 2149, 56,
+	7029, 5636, 5333, 3925, 2469, 1383, 2666, 7599, 1471, 4716,
+	7243, 7658, 2936, 1602, 2987, 4530, 2140, 2962, 1282, 4149,
+	1674, 7825, 7566, 6517, 8116, 3546, 5528, 181, 2732, 3652,
+	1232, 951, 6242, 6304, 6340, 7290, 370, 4639, 6951, 3132,
+	3943, 5112, 6571, 5028, 2897, 820, 4359, 3910, 6605, 1780,
+	3267, 7583, 7237, 975, 7057, 1381, 5951, 1582, 7894, 927,
+	8166, 4335, 1053, 5198, 3479, 1266, 7310, 4265, 6045, 5442,
+	3133, 8065, 7107, 3229, 7694, 3614, 4800, 6889, 6490, 7081,
+	4036, 210, 2192, 2324, 7547, 3799, 7296, 886, 3686, 6992,
+	43, 3962, 3200, 6086, 1611, 1163, 5678, 5241, 1033, 1155,
+	4811, 4689, 1912, 3238, 461, 4445, 2664, 4958, 7899, 681,
+	4940, 3642, 1526, 7673, 5279, 657, 395, 2267, 1842, 3096,
+	5673, 4594, 8156, 1330, 3670, 742, 7896, 2141, 6395, 4139,
+	5773, 3080, 1179, 4206, 447, 393, 4406, 1274, 8261, 4824,
+	7369, 6979, 4551, 7181, 4944, 7749, 2074, 3426, 5468, 8038,
+	2359, 925, 1671, 4511, 4257, 7504, 2950, 5603, 2096, 5120,
+	7666, 7262, 6731, 3315, 369, 5018, 2941, 59, 6323, 2038,
+	6274, 7185, 1278, 7502, 8213, 2492, 2303, 7151, 8251, 4872,
+	669, 7284, 3035, 6643, 621, 6825, 1504, 7479, 2252, 7981,
+	5164, 1648, 528, 110, 1689, 5910, 3478, 2151, 3541, 7832,
+	5281, 6283, 917, 835, 3344, 4379, 3613, 3280, 4387, 6843,
+	2290, 538, 1464, 3194, 4519, 5131, 2776, 6752, 1660, 133,
+	4685, 8124, 285, 824, 126, 1793, 2677, 3853, 4018, 7555,
+	1547, 1563, 6551, 1360, 1822, 2783, 225, 2378, 5801, 2998,
+	77, 2006, 1518, 4792, 596, 7119, 4993, 1038, 1323, 5486,
+	3250, 2802, 8051, 2313, 8258, 1664, 2102, 1037, 6761, 6664,
+	6940, 987, 2037, 3619, 7935, 5716, 2032, 6734, 1225, 7530,
+	1475, 1814, 3645, 7347, 3626, 7742, 6079, 4810, 2311, 7446,
+	2370, 1988, 3239, 3698, 175, 8383, 4825, 4492, 8388, 3471,
+	7622, 4290, 8100, 2208, 7465, 7346, 575, 4579, 8139, 551,
+	7554, 4074, 5701, 3131, 5233, 8131, 7972, 2568, 5335, 319,
+	24, 3913, 1646, 8172, 5548, 4117, 2061, 1397, 6689, 4435,
+	2343, 8321, 2848, 7303, 1849, 1264, 3248, 7520, 73, 4524,
+	4509, 3728, 8140, 6178, 5690, 4663, 3896, 7497, 4877, 5360,
+	361, 3879, 2117, 8237, 1670, 1045, 2939, 5723, 7166, 5867,
+	4885, 7953, 4277, 7629, 80, 6233, 3151, 317, 177, 6317,
+	269, 1779, 2444, 3076, 3221, 5421, 1742, 5278, 1462, 344,
+	4679, 6944, 3814, 7921, 7332, 5021, 4964, 2857, 530, 5400,
+	6682, 3555, 3867, 2366, 5889, 2217, 3675, 6592, 4747, 2425,
+	8155, 5554, 3773, 7403, 2047, 3490, 1778, 5175, 7443, 3781,
+	2656, 1213, 4525, 7199, 3859, 6190, 5915, 1363, 6422, 7382,
+	431, 3312, 1463, 7473, 2969, 6500, 619, 4783, 3116, 5204,
+	409, 1173, 4413, 4541, 5230, 7636, 4901, 7598, 901, 3720,
+	6716, 4690, 8058, 8276, 1820, 2478, 3871, 7862, 164, 5374,
+	3630, 3571, 3373, 578, 3836, 7037, 2374, 1900, 341, 4270,
+	4847, 1574, 6177, 8319, 4004, 302, 4287, 4612, 7133, 1452,
+	7405, 3577, 7287, 6014, 7071, 5246, 3013, 7338, 7623, 6702,
+	4354, 5101, 4803, 1094, 6457, 3220, 7987, 5830, 1601, 7722,
+	5704, 7230, 5822, 4368, 3468, 4703, 3994, 3271, 1537, 7687,
+	5950, 3178, 8235, 3032, 910, 1245, 5797, 4674, 372, 1125,
+	2054, 1143, 5221, 6085, 708, 2632, 60, 8142, 4782, 7293,
+	4316, 6829, 5206, 1596, 3951, 6573, 2085, 2446, 3114, 6837,
+	1931, 7453, 3195, 4805, 3117, 7957, 8145, 2404, 5059, 28,
+	3184, 2489, 3152, 7565, 3654, 4708, 755, 444, 7717, 179,
+	7709, 7331, 5593, 6126, 4256, 5153, 3715, 4692, 112, 1291,
+	7396, 3815, 3407, 5712, 2310, 4587, 2693, 2751, 4401, 3722,
+	2554, 6747, 1051, 1082, 5787, 502, 5606, 5514, 3650, 6160,
+	3310, 2354, 6167, 6175, 7964, 525, 2139, 4980, 3346, 2812,
+	2526, 6947, 844, 3679, 2577, 833, 3756, 514, 6407, 861,
+	4706, 6950, 7792, 7720, 5299, 3762, 2133, 7911, 100, 7700,
+	4802, 880, 7386, 4527, 1260, 257, 6108, 7564, 7052, 6083,
+	3447, 4478, 998, 7024, 7693, 4091, 117, 1722, 1728, 7790,
+	6564, 7898, 1607, 5980, 3201, 7770, 695, 3506, 3331, 1133,
+	4514, 2232, 7008, 3101, 5235, 1424, 3637, 4491, 7165, 2436,
+	6224, 979, 5872, 6983, 114, 7171, 972, 3813, 6176, 7974,
+	866, 3259, 4725, 7263, 1618, 2120, 8185, 7929, 8088, 6347,
+	6392, 1378, 6311, 2843, 2027, 2668, 4129, 3453, 2462, 7558,
+	793, 7146, 2639, 3000, 3197, 7387, 6049, 6515, 5929, 3022,
+	2341, 3452, 1605, 5898, 3299, 4976, 4869, 4765, 3389, 1257,
+	1132, 4118, 6097, 4022, 3202, 667, 5276, 773, 8207, 4003,
+	4237, 2486, 3383, 8069, 618, 3209, 4937, 355, 6728, 6279,
+	5436, 7850, 5271, 856, 3948, 2466, 1316, 4540, 625, 3502,
+	5240, 6012, 2844, 5525, 5227, 7692, 3460, 5104, 1981, 2809,
+	2242, 7191, 7740, 4786, 5981, 7501, 672, 599, 7645, 5429,
+	6494, 4264, 2309, 6896, 3118, 8146, 539, 524, 4740, 7831,
+	843, 1712, 2627, 4565, 5029, 3441, 3318, 3415, 5269, 3088,
+	1991, 6590, 6212, 4938, 1110, 4196, 4830, 6011, 6171, 8280,
+	3066, 3488, 1889, 5229, 4131, 7236, 7522, 8324, 3713, 3146,
+	6638, 2218, 7584, 7753, 1400, 3560, 1989, 122, 2023, 7192,
+	5734, 5564, 7567, 2887, 305, 6602, 977, 6028, 5256, 5585,
+	3099, 2773, 745, 2344, 1729, 1904, 4660, 2727, 6351, 4991,
+	2917, 7509, 1917, 3275, 7449, 2540, 3348, 5854, 5598, 606,
+	7470, 2792, 8306, 4239, 7793, 8089, 4558, 1693, 5755, 2790,
+	2397, 2270, 2468, 6683, 6635, 1317, 2387, 3744, 6058, 519,
+	3843, 553, 7326, 5430, 3234, 3741, 6208, 2786, 1890, 7159,
+	536, 3002, 4286, 7786, 170, 4212, 1352, 7893, 5560, 5943,
+	3638, 5658, 2226, 2168, 313, 7125, 5177, 3646, 72, 53,
+	6640, 3901, 2315, 7833, 3319, 2243, 5451, 6699, 2430, 1425,
+	4326, 3433, 6904, 8125, 7279, 7721, 2793, 6161, 1164, 6587,
+	2874, 542, 4209, 1380, 3694, 3048, 4888, 6989, 6189, 2188,
+	4670, 7012, 1972, 497, 5463, 2245, 3829, 7148, 1129, 7782,
+	2321, 5048, 1525, 8006, 3941, 3189, 650, 1134, 3984, 1883,
+	6527, 5770, 3609, 772, 3450, 6223, 3487, 2525, 7488, 4801,
+	1679, 6343, 4619, 1995, 250, 329, 2184, 5041, 1914, 4699,
+	7242, 5123, 8315, 5599, 3033, 1851, 3579, 4863, 2384, 1404,
+	547, 3142, 6684, 3362, 2260, 5646, 3882, 2861, 7267, 1183,
+	7656, 604, 5831, 5526, 1608, 5902, 5632, 1285, 8182, 8222,
+	3282, 2920, 6044, 6142, 2090, 2523, 7495, 5063, 5254, 2946,
+	6627, 6596, 890, 3082, 3594, 7215, 5668, 7333, 2576, 8211,
+	6538, 3558, 3439, 5329, 5023, 6248, 5806, 2093, 7318, 5274,
+	6194, 4917, 8354, 4861, 7124, 2292, 6237, 2194, 1938, 4165,
+	2910, 2155, 4350, 7139, 1402, 4528, 6725, 4658, 4645, 352,
+	209, 1000, 763, 546, 5060, 6797, 309, 7830, 7525, 6301,
+	1953, 2670, 1826, 5013, 4054, 6510, 2460, 2223, 6514, 7201,
+	641, 2364, 3701, 6525, 5347, 2322, 3052, 2912, 2293, 5212,
+	49, 3552, 7214, 3509, 6809, 2886, 677, 7472, 3678, 6298,
+	3530, 121, 5448, 7915, 2059, 7259, 5047, 6622, 2845, 7902,
+	260, 5540, 579, 4019, 5326, 7523, 5869, 6335, 1834, 1747,
+	4192, 7813, 5253, 6579, 6215, 4296, 4280, 5411, 6530, 1029,
+	2635, 3621, 7544, 4785, 5362, 6325, 7295, 7095, 7776, 1585,
+	3215, 980, 2248, 3791, 4241, 2589, 3138, 1193, 7691, 7207,
+	4970, 7102, 5725, 4662, 289, 6965, 6105, 2564, 6093, 5903,
+	1859, 958, 5133, 445, 7764, 7441, 4336, 4026, 1895, 6200,
+	1271, 4072, 2960, 4356, 5085, 6272, 3598, 2121, 3869, 3958,
+	6400, 7272, 4550, 7395, 203, 3536, 3263, 671, 1498, 3360,
+	5140, 3093, 7448, 3765, 6496, 821, 740, 586, 7826, 1043,
+	5027, 64, 3155, 6874, 1503, 5645, 8001, 5184, 234, 5293,
+	2394, 5352, 40, 3172, 6962, 7986, 4826, 4225, 391, 3256,
+	571, 6363, 4543, 213, 5003, 1449, 8087, 8122, 8047, 4467,
+	4268, 1549, 5859, 7728, 1494, 5932, 6122, 1906, 3181, 7294,
+	3411, 1655, 7045, 5688, 5607, 889, 481, 4345, 6064, 8269,
+	6958, 3862, 4855, 1561, 1170, 7255, 8231, 2044, 6453, 6563,
+	3420, 7777, 622, 5163, 1410, 659, 2291, 7581, 7867, 2050,
+	5081, 5728, 6876, 6462, 2014, 2348, 1481, 2369, 3354, 4123,
+	4009, 4372, 3432, 1986, 3247, 2657, 946, 5964, 3015, 3042,
+	2831, 2926, 2480, 6773, 4996, 7419, 4774, 983, 4222, 6949,
+	6854, 722, 6931, 5536, 2569, 4422, 490, 3968, 2360, 6842,
+	1476, 537, 7190, 7227, 6296, 4085, 4298, 6216, 3050, 8176,
+	2396, 6312, 904, 5922, 2768, 2996, 1705, 2103, 4987, 630,
+	2145, 1304, 4016, 2457, 6121, 4215, 4135, 3786, 1379, 7815,
+	3864, 3716, 831, 7127, 5702, 2562, 7810, 2546, 6976, 4820,
+	701, 4737, 2189, 4487, 6437, 5199, 4778, 1178, 7144, 7503,
+	585, 3591, 6214, 8300, 2622, 7808, 2877, 2233, 6262, 6668,
+	1190, 6402, 706, 3965, 670, 3475, 7592, 7889, 7710, 1533,
+	3394, 2432, 5068, 873, 6905, 688, 8037, 1054, 1318, 3702,
+	4246, 2686, 6570, 2034, 1303, 1120, 4929, 5779, 1776, 1177,
+	4168, 2600, 7487, 4880, 4985, 1226, 2463, 3293, 1109, 7026,
+	6927, 5130, 882, 5845, 408, 7376, 4767, 2297, 2186, 915,
+	6257, 8066, 1628, 645, 3159, 2114, 2009, 1194, 3219, 5572,
+	3576, 2667, 4050, 3324, 2410, 8216, 7640, 8188, 3922, 4088,
+	4097, 8332, 786, 1079, 4982, 4835, 7145, 6568, 5703, 5142,
+	7962, 2898, 2086, 4279, 899, 2833, 548, 94, 6149, 375,
+	3586, 5944, 96, 1755, 7457, 2350, 5758, 4560, 1431, 4992,
+	6163, 1021, 2067, 5034, 6381, 5942, 7010, 5454, 3372, 8106,
+	7177, 7351, 611, 4866, 2822, 1085, 3390, 3834, 654, 1483,
+	3980, 2985, 6094, 5687, 5295, 4238, 1385, 1147, 3454, 4696,
+	1321, 3805, 5001, 1061, 3850, 5896, 442, 4351, 1928, 2507,
+	2821, 4510, 3416, 54, 1273, 2838, 4486, 145, 699, 2860,
+	8343, 1390, 3963, 807, 2246, 4752, 6286, 5966, 4939, 3706,
+	1720, 8110, 6639, 6320, 292, 7659, 3946, 7389, 1880, 7063,
+	2942, 973, 5147, 6467, 602, 7030, 3806, 488, 204, 5974,
+	5311, 5275, 2012, 7066, 2210, 4844, 2995, 6998, 5512, 4813,
+	138, 5864, 2459, 5393, 8022, 3020, 3183, 3952, 134, 6671,
+	7556, 2763, 5009, 4822, 5058, 6925, 4610, 1105, 3940, 3565,
+	6704, 646, 6969, 5218, 3308, 2285, 6798, 7675, 4836, 6306,
+	6690, 6252, 2062, 5094, 8020, 4968, 2135, 7302, 7251, 2718,
+	1083, 2938, 1754, 6723, 6611, 3898, 3846, 2806, 6307, 6796,
+	2999, 5331, 6148, 1344, 955, 7910, 5535, 3079, 5506, 7492,
+	5730, 4371, 4320, 1293, 3161, 171, 7307, 2464, 3106, 2450,
+	2624, 8314, 1976, 8256, 5092, 6726, 1530, 6010, 4302, 5931,
+	3668, 4082, 3019, 5004, 1067, 7435, 113, 6404, 290, 3868,
+	4243, 675, 2228, 7991, 3391, 2122, 1025, 5841, 3849, 5592,
+	511, 7248, 1280, 6357, 2930, 2007, 7105, 4448, 590, 4816,
+	5080, 1692, 6899, 2429, 6823, 5497, 7644, 3083, 8183, 7179,
+	1489, 1994, 4522, 8323, 4732, 8220, 6334, 8262, 4158, 5891,
+	5897, 82, 4313, 1901, 3693, 7316, 7415, 2104, 6685, 3457,
+	5403, 3760, 5650, 3534, 4957, 2087, 2403, 6521, 5546, 2453,
+	8391, 2705, 7367, 4671, 8208, 5474, 1652, 258, 3703, 3595,
+	1864, 1116, 749, 7413, 3685, 8169, 7768, 386, 7747, 7885,
+	5741, 3582, 4028, 5908, 6313, 2498, 2166, 1640, 3307, 1666,
+	1874, 2947, 1564, 4322, 7676, 6264, 8148, 2514, 2471, 7603,
+	4167, 4288, 120, 924, 47, 7374, 7147, 7156, 1843, 3966,
+	2286, 8003, 324, 2563, 3759, 6930, 2967, 5413, 3860, 2136,
+	2520, 4630, 5364, 3907, 6660, 381, 6866, 253, 881, 6687,
+	1586, 6146, 6468, 985, 5766, 7417, 2077, 5874, 1521, 1821,
+	7731, 3401, 7729, 125, 6106, 2495, 8008, 7818, 6480, 462,
+	8163, 4330, 4476, 6441, 3400, 3990, 2735, 1736, 3252, 3090,
+	1456, 7641, 2222, 8380, 3689, 4021, 2771, 1176, 5032, 7250,
+	440, 2854, 4110, 299, 5767, 2989, 7277, 7216, 2088, 5380,
+	7093, 1515, 2902, 6972, 3018, 4931, 6739, 4344, 6039, 4581,
+	6350, 5531, 6783, 6771, 5143, 1167, 6917, 8238, 1100, 6162,
+	6646, 4186, 3045, 7108, 479, 3392, 7699, 3127, 6181, 1918,
+	4710, 4357, 2401, 8101, 4577, 2991, 5273, 1566, 854, 4911,
+	8077, 4314, 6828, 687, 6136, 7114, 4621, 1636, 7247, 5873,
+	3167, 771, 2932, 6884, 3515, 6649, 1770, 4454, 5349, 2505,
+	6042, 5733, 2796, 6720, 7821, 2454, 429, 1130, 484, 550,
+	1951, 7633, 2205, 3112, 8105, 7375, 1349, 3561, 4458, 261,
+	1555, 5557, 5054, 4773, 1517, 7854, 735, 3296, 3332, 3746,
+	3562, 4672, 7703, 5375, 506, 508, 7178, 5289, 3575, 7865,
+	6388, 1644, 1502, 4452, 629, 1920, 4780, 5012, 5783, 1947,
+	4234, 4876, 127, 2944, 4332, 5914, 2320, 4854, 830, 3300,
+	3852, 8392, 7512, 7130, 3687, 3969, 7394, 4325, 1803, 5936,
+	2810, 8328, 2022, 1599, 5419, 6815, 4891, 1990, 1577, 7266,
+	2766, 283, 3544, 6067, 6520, 1482, 63, 3665, 323, 5328,
+	2347, 5343, 966, 2935, 813, 3839, 6968, 6410, 6339, 7907,
+	7767, 1578, 1032, 1086, 6804, 6849, 721, 2661, 6026, 4317,
+	7402, 5336, 556, 4432, 3810, 2875, 1019, 8339, 3386, 8252,
+	2036, 5973, 4624, 4967, 357, 465, 2927, 1184, 2111, 2381,
+	1042, 453, 7073, 3143, 6745, 1438, 5959, 4647, 2710, 301,
+	5119, 496, 3607, 169, 6211, 7104, 1510, 2658, 652, 5946,
+	6733, 2799, 1885, 1292, 666, 963, 2159, 4005, 5321, 7884,
+	3169, 4337, 6718, 6147, 2997, 5995, 1711, 430, 7138, 2521,
+	8197, 7432, 4080, 758, 7196, 2901, 5125, 2748, 3498, 3251,
+	1568, 2931, 5136, 1743, 5507, 572, 6675, 4424, 7706, 1444,
+	4429, 4763, 5107, 2977, 5812, 5226, 3056, 1234, 5493, 8366,
+	6591, 2594, 636, 8152, 5775, 1034, 3886, 6440, 4538, 7187,
+	5584, 3208, 1799, 7718, 1807, 8118, 4301, 6644, 2623, 4410,
+	4390, 6860, 1334, 6769, 1479, 1523, 4232, 1673, 7220, 3305,
+	4548, 5214, 2207, 6851, 1461, 2119, 1828, 7668, 5111, 1465,
+	7355, 5957, 452, 147, 219, 326, 5700, 5433, 969, 358,
+	1306, 8025, 3110, 892, 8312, 3004, 2516, 7339, 7853, 2214,
+	7716, 7223, 5624, 4161, 403, 226, 7498, 804, 6393, 1703,
+	5925, 2501, 5527, 7900, 4915, 6359, 8360, 3272, 2890, 347,
+	4120, 5465, 3699, 6278, 1319, 1189, 518, 2304, 7414, 4049,
+	4608, 2711, 240, 389, 637, 3707, 2451, 2299, 448, 8362,
+	5629, 6153, 6990, 4497, 1485, 7141, 832, 5968, 7585, 6615,
+	7952, 4918, 6651, 2440, 5422, 5579, 3446, 7198, 3222, 7478,
+	306, 7074, 6290, 5786, 600, 7801, 568, 1527, 2597, 3789,
+	6135, 2021, 1445, 4245, 6795, 5502, 739, 7406, 818, 662,
+	3904, 129, 7745, 6241, 6865, 5652, 7149, 4963, 3895, 25,
+	3659, 1579, 4062, 4442, 7298, 3737, 4882, 3232, 2643, 7252,
+	2979, 7627, 3772, 2590, 2439, 6352, 6906, 5628, 6511, 3782,
+	160, 6619, 4682, 1893, 188, 5858, 1315, 1343, 6098, 8295,
+	397, 5406, 8027, 7662, 2132, 307, 5182, 38, 3955, 8356,
+	5398, 4989, 6081, 5644, 1435, 7427, 8170, 6967, 3051, 4632,
+	1588, 6502, 7077, 3196, 564, 5529, 5542, 4909, 2019, 3160,
+	674, 1209, 6740, 4941, 967, 7883, 3855, 3934, 5575, 5042,
+	5532, 2638, 5396, 197, 2682, 5178, 7602, 7536, 3926, 8349,
+	5675, 3414, 560, 2814, 2990, 509, 4634, 8150, 4955, 5857,
+	7426, 7004, 2961, 2053, 1642, 2277, 5618, 6844, 3993, 4244,
+	1760, 4906, 1704, 3520, 2204, 7305, 2952, 3417, 4204, 4020,
+	5181, 6978, 1235, 7003, 7819, 7001, 2288, 5367, 7613, 2581,
+	7949, 405, 4197, 76, 7336, 7397, 6029, 8299, 6491, 4064,
+	5044, 6706, 7322, 7496, 4845, 5792, 4943, 5103, 5556, 4060,
+	5228, 7276, 4999, 5383, 5751, 1005, 7752, 6536, 3129, 1223,
+	2570, 7835, 5325, 2386, 4923, 3085, 3680, 6567, 6245, 4177,
+	4804, 3674, 5439, 19, 2636, 4668, 5261, 5287, 8096, 5621,
+	5067, 7254, 2840, 5283, 3375, 6297, 7039, 7328, 7637, 1406,
+	2629, 895, 10, 2717, 6707, 1376, 8019, 500, 2212, 1662,
+	1768, 6870, 3794, 1375, 1797, 4293, 1015, 5388, 4100, 3601,
+	5589, 4324, 4646, 1467, 3473, 3873, 5152, 8199, 6856, 6676,
+	4221, 2537, 8000, 6275, 5732, 1571, 3072, 3053, 4439, 1484,
+	2545, 2915, 4104, 7002, 4637, 6267, 3911, 3356, 5210, 2225,
+	7858, 6129, 7428, 5211, 3526, 648, 4126, 8369, 884, 6628,
+	3230, 6688, 4536, 186, 6452, 2722, 6235, 4715, 6091, 498,
+	4932, 3472, 2817, 4306, 4742, 2586, 960, 338, 5350, 601,
+	6662, 1493, 2255, 3844, 4388, 2060, 470, 5856, 999, 544,
+	770, 7193, 3841, 7671, 4404, 6104, 5861, 6385, 2596, 943,
+	785, 7327, 5061, 616, 7978, 3812, 5696, 3136, 6670, 4083,
+	1825, 4916, 3059, 1455, 3203, 4455, 1715, 2690, 7260, 534,
+	6840, 3366, 8171, 6695, 1710, 4224, 6626, 7204, 2434, 4839,
+	6532, 1131, 3667, 1614, 5148, 7667, 8240, 8158, 7229, 7261,
+	5270, 6070, 4101, 4979, 1097, 212, 4738, 4291, 5551, 8227,
+	4133, 3396, 3266, 7951, 7725, 1767, 4029, 3847, 4755, 4266,
+	2198, 4615, 5835, 1536, 7344, 5988, 7654, 2082, 1792, 4507,
+	1659, 3599, 8161, 1567, 3811, 2499, 6197, 4622, 3005, 7582,
+	354, 450, 1757, 1310, 8338, 5868, 5809, 4041, 5086, 3294,
+	3273, 6621, 7481, 2904, 5963, 4272, 1641, 5790, 7053, 6522,
+	5376, 1819, 6228, 6331, 2448, 2413, 1810, 1738, 2080, 2483,
+	2511, 2175, 3518, 2049, 3723, 5517, 6838, 5578, 729, 3410,
+	6302, 8275, 4090, 1725, 3824, 6932, 437, 6902, 1342, 61,
+	5949, 6321, 6158, 2162, 7345, 3474, 5617, 3378, 8364, 373,
+	8223, 6469, 1645, 1669, 4914, 8053, 7005, 4199, 2703, 2685,
+	1522, 2873, 1873, 8249, 5129, 2018, 908, 7354, 4430, 6239,
+	7904, 7917, 7285, 3616, 7892, 6001, 4865, 7823, 151, 6610,
+	7471, 4983, 4947, 8367, 1394, 1957, 8083, 2224, 2407, 2306,
+	7942, 4143, 6127, 3785, 6132, 7891, 1168, 5729, 7288, 7459,
+	1246, 7072, 7998, 2158, 2078, 5596, 2538, 4776, 4081, 5549,
+	5600, 2598, 7100, 4394, 5073, 589, 3989, 1706, 1407, 2064,
+	3764, 501, 4365, 4848, 7132, 6648, 2909, 2588, 6581, 2616,
+	2604, 7059, 5747, 4653, 7711, 5472, 6222, 2266, 5713, 5180,
+	5501, 678, 6173, 3244, 6669, 36, 4726, 3141, 5170, 4832,
+	5811, 2497, 6261, 5155, 6696, 1592, 1796, 4217, 7320, 312,
+	4815, 4030, 247, 5309, 2978, 4490, 1682, 494, 6800, 8016,
+	1398, 5260, 3535, 4007, 6760, 1752, 510, 1730, 858, 8278,
+	3182, 4068, 7142, 6193, 6534, 6974, 153, 1355, 5137, 3524,
+	5905, 5682, 2619, 1948, 651, 5183, 7552, 5524, 3467, 8,
+	2171, 6893, 1647, 3476, 3975, 1236, 6118, 4024, 1620, 2980,
+	8390, 1570, 3328, 4919, 4925, 3825, 1287, 3567, 4945, 2269,
+	4864, 4183, 2615, 5679, 7056, 67, 3757, 262, 5064, 2072,
+	6982, 242, 1887, 1751, 342, 4922, 4781, 5258, 5992, 6540,
+	3573, 5823, 5934, 6346, 464, 746, 2803, 2262, 8104, 12,
+	1186, 626, 5135, 7766, 3340, 8175, 4103, 390, 6182, 7463,
+	5300, 507, 8074, 6937, 7621, 5114, 7940, 382, 315, 7945,
+	7560, 8239, 1617, 7311, 6068, 4990, 499, 5662, 7118, 7115,
+	8329, 489, 3097, 811, 5083, 2532, 7685, 5075, 6956, 398,
+	1031, 6821, 7136, 4927, 2746, 7670, 7697, 434, 6758, 8108,
+	1044, 6367, 781, 3636, 8094, 2229, 6225, 124, 3784, 2753,
+	2925, 984, 6349, 3537,
+};
+static const int iso639_3_bycode_disp[2799] = {
+	-76, 1, 15, 14, 3, 1, -135, 6, 17, 1,
+	1, 3, 2, 32, -149, -161, 0, 5, 15, -176,
+	11, 8, 9, 0, 4, -183, 46, -193, 16, 13,
+	19, 26, -203, -207, 49, 17, 7, -233, 11, 16,
+	17, 12, 13, 8, 15, 12, 3, 19, 68, -278,
+	4, 124, 15, 8, 6, 25, 2, 2, 19, 13,
+	0, 1, 7, 30, 0, 1, 2, 4, 1, 26,
+	29, 0, 10, -292, 42, 35, 153, 4, 26, 9,
+	1, 1, 29, 0, 55, -304, 20, 6, 20, -316,
+	1, 42, 18, 18, 33, -320, 65, -341, 141, 0,
+	3, 47, 11, 21, -361, 104, 1, 10, 63, 15,
+	1, 6, 12, 11, 2, 4, 4, 2, 54, 20,
+	5, 2, 85, -363, 29, 17, 50, 6, 90, -397,
+	61, 43, 10, 1, 2, 0, 64, 28, -431, 28,
+	80, 40, 15, 5, 28, 56, -432, -435, 6, 5,
+	6, -457, 21, 39, 20, 20, 1, 40, -464, 61,
+	31, 1, 40, 16, 44, 0, 54, 40, 22, 90,
+	3, 27, 42, 2, 1, 210, 1, 16, 31, 37,
+	26, -466, 0, 23, -531, -533, 70, 15, -545, 23,
+	24, 71, 15, 32, 26, 39, 10, 61, 34, 3,
+	9, 2, 58, 11, 27, 1, -549, 35, 6, 6,
+	1, 6, 7, 10, 15, 21, 2, 78, -566, 4,
+	0, 1, 113, 12, 34, -567, 1, -569, 47, 5,
+	56, 32, 36, 14, 3, -572, 26, 9, -605, 36,
+	55, 41, 30, 20, 36, 25, 54, 2, 37, -635,
+	47, -636, 3, 41, 190, 10, 1, 17, -650, 21,
+	2, 68, 36, -672, 2, -697, 2, -727, 53, 2,
+	87, 4, 4, 1, 71, 26, 1, 62, 28, 11,
+	1, 148, 146, 1, 6, 1, 21, 13, 1, 1,
+	-755, 3, 33, 20, 3, 1, 13, 30, -760, 42,
+	1, 23, 2, 2, 8, 13, 47, 26, 47, 23,
+	57, 40, 30, 21, 80, -779, 14, 25, 57, 85,
+	11, 1, 26, 1, -792, 14, 2, 22, 23, 25,
+	16, 0, 42, 8, 1, 3, 1, 45, 7, 87,
+	19, 50, -807, 35, -819, 2, 9, 1, 15, 1,
+	18, 3, 6, 5, 2, 17, 26, 19, 0, 34,
+	4, 18, 22, 1, 11, 25, 58, 11, 56, 4,
+	-830, 37, 5, 22, -836, 5, 30, 24, 13, 2,
+	59, 1, 30, 28, 9, 0, -890, 28, 44, 41,
+	2, 2, 5, 3, 11, 16, -924, 4, 19, 15,
+	5, 1, 4, 43, 2, 11, 0, 7, -945, 5,
+	7, 27, 2, 18, 26, 21, 36, 3, 0, 1,
+	4, 29, 1, 20, 1, 34, 3, 45, 68, 2,
+	-980, 33, 6, 1, 23, 18, 90, 4, -993, 56,
+	11, 22, 0, 0, 4, 3, 1, 84, 30, 22,
+	57, 38, 1, 37, 1, 32, 64, -1060, 42, 62,
+	5, 1, 18, 1, 5, 18, 12, 49, 26, 3,
+	48, 2, 20, 0, 2, 24, -1117, 26, 3, 223,
+	14, -1153, 1, 0, 15, 70, 8, 20, -1191, 47,
+	0, 2, 0, 17, 12, 15, 23, 75, 36, 1,
+	3, 50, 3, 16, 47, 5, 32, -1205, 13, 40,
+	67, 4, 14, 7, 43, 28, 2, 30, 6, -1211,
+	12, 1, 6, -1230, 5, 20, 3, 22, 12, 11,
+	11, 173, 47, 3, 39, 4, 10, 55, -1236, 66,
+	55, -1251, 1, 38, -1255, 1, 3, 26, -1274, -1292,
+	7, 117, 11, 1, 3, 63, 13, 6, 2, -1321,
+	-1322, 53, 0, 20, -1348, -1407, 37, 7, 35, 32,
+	80, -1408, 64, -1454, -1455, 26, 7, 23, 12, 5,
+	22, 84, 78, 16, -1472, 32, 3, 89, 73, 3,
+	-1490, 6, 5, -1491, 20, 1, 7, 39, 1, 0,
+	8, 2, 57, 14, -1493, 40, 142, 18, 51, -1498,
+	66, 61, 7, 0, 13, 7, 9, -1510, 5, 76,
+	61, 53, 6, -1547, 31, 11, 21, 24, 4, 21,
+	8, -1564, 1, 10, -1616, 3, -1648, 4, 63, 2,
+	13, 117, 1, -1656, 26, -1666, 17, 19, 7, -1685,
+	-1707, 2, 6, 0, 52, -1711, 4, -1726, 24, -1733,
+	-1774, 33, 68, 35, 62, 0, 11, -1807, 25, 13,
+	4, -1816, 7, -1828, 0, 58, 24, 31, 108, -1836,
+	89, 40, 1, 31, 50, 68, 30, 8, 6, 1,
+	12, 3, 31, 18, 30, -1867, 12, 20, 50, -1905,
+	3, 47, 1, 1, 21, 51, 11, -1910, 71, 47,
+	-1919, -1938, 1, 1, 33, 0, -1950, 27, 16, 19,
+	28, -1976, 18, 0, 35, -1992, 7, 24, 226, -2009,
+	-2035, 88, 41, 2, 120, 0, 1, 57, 97, 11,
+	45, 81, 26, -2065, -2070, -2087, 5, 232, -2118, 1,
+	15, -2120, 31, 6, 45, -2128, 67, -2139, 37, 5,
+	60, 2, 1, 3, 7, 1, -2153, 16, 10, 10,
+	51, 7, 1, 1, 20, 100, 74, 5, -2204, 19,
+	-2213, 39, 71, 2, 47, -2224, 71, 10, 57, 10,
+	10, 1, 63, 140, -2263, -2336, 32, 1, 26, -2357,
+	10, 110, 36, 6, 86, -2365, 58, 99, 1, 104,
+	30, 2, 4, -2381, 25, 46, 81, 18, 15, 4,
+	45, 10, 32, 17, 7, 35, -2407, 2, 4, 2,
+	-2416, 2, -2474, 67, 0, 31, 26, 109, -2501, 0,
+	57, 4, 0, 3, 11, 8, 47, 1, 0, 41,
+	-2512, 45, 4, 1, 6, 17, 1, 16, -2528, 70,
+	178, 26, -2540, 39, 14, -2601, 15, 174, 12, 37,
+	174, 1, 38, 21, 26, 11, 64, -2627, -2640, 189,
+	29, -2652, 44, 27, 59, -2654, 4, 4, 27, 0,
+	81, 4, 7, 10, 36, 63, 26, 41, 52, 4,
+	3, 40, 0, 0, 23, 1, 21, -2674, 5, -2679,
+	18, 1, 9, 25, 37, 3, -2685, 27, 7, 32,
+	32, 27, 25, 5, 66, 38, 32, 17, 24, 1,
+	2, 44, 119, 30, 0, 2, 11, -2701, 2, 8,
+	58, 43, -2743, 57, 1, 17, 65, 62, 74, 118,
+	36, 2, 22, 11, 91, 64, 29, 24, 133, 30,
+	4, 11, 5, 6, 26, -2756, 2, 50, 15, 3,
+	58, 6, 9, -2766, 52, 1, 73, 28, 10, 90,
+	3, 39, 0, 21, 28, 13, 12, 24, -2771, 30,
+	42, 2, 1, 83, 0, 34, -2777, 12, 7, 11,
+	14, 27, 309, 44, 112, 40, 104, 20, 28, 115,
+	118, 1, 24, 27, 7, 0, 74, 15, 107, 42,
+	16, -2786, -2829, 53, -2880, 48, 50, 84, 1, 31,
+	0, 23, 1, 6, 82, 38, 3, -2941, 29, -2965,
+	0, 38, 12, 2, 83, 36, 113, 48, 31, 17,
+	87, 59, 68, -2980, -2989, 0, 147, 1, 17, 128,
+	42, 10, 1, 9, 37, 21, 9, 13, -3003, 5,
+	107, -3011, -3018, 62, 0, 48, 19, 13, 42, 24,
+	43, 29, 31, 8, -3023, 1, 32, 1, 5, 52,
+	-3038, 25, 1, -3081, 55, 30, -3090, 2, 3, 9,
+	1, 40, 24, 53, 2, 1, 9, 1, 67, 78,
+	32, -3092, -3100, 2, 30, 143, 8, 5, 3, 0,
+	26, 103, 6, 32, 1, 5, 33, -3101, 66, 23,
+	2, 14, 27, 22, 14, 4, 2, 187, 90, 10,
+	1, -3151, 0, 2, -3181, 1, 48, 8, 42, 139,
+	24, 1, 35, 17, 44, 7, 28, 121, 4, 167,
+	-3207, 6, 39, -3210, 63, 5, -3214, 94, 44, 23,
+	166, 70, 89, 71, 73, 29, 38, 12, 50, 38,
+	72, 68, -3225, 2, 17, 27, 1, 0, 42, 55,
+	-3320, 42, 23, 29, 92, 27, 25, 8, 0, -3333,
+	1, 2, 1, 93, -3334, 3, 7, 40, 57, 35,
+	9, -3361, 86, 25, 44, -3412, 0, 18, 1, 18,
+	12, 99, 171, 90, 13, 39, 22, 126, 39, 3,
+	3, 140, 14, 7, 2, 130, 57, 10, 35, 70,
+	25, -3453, 5, 2, 10, 1, 7, 114, 10, 41,
+	-3458, 10, 44, 0, 1, 28, 92, 31, 27, 68,
+	45, 3, 10, 38, 20, -3461, 15, 10, 16, 37,
+	2, 2, -3476, -3488, 151, 13, 1, 2, 135, -3566,
+	1, 42, 55, 101, -3573, 48, 123, 70, 48, 26,
+	-3576, 23, 47, -3577, 218, 125, -3585, 0, 46, 172,
+	-3632, 133, 44, 60, -3678, -3687, 36, 0, 28, 121,
+	111, 0, 115, 124, -3752, -3757, -3765, 170, -3768, 5,
+	7, 47, 44, 114, -3779, -3801, 22, 30, -3826, 214,
+	16, 38, -3845, 56, 50, 1, -3856, 75, 25, 21,
+	3, 50, 9, 5, 113, 34, 110, 12, 7, 35,
+	10, 6, 7, -3876, 54, 11, 63, 45, 25, 2,
+	2, 115, 6, 47, 49, 17, -3921, 0, 22, 183,
+	-3946, 141, 45, 21, 40, 98, 231, 108, 70, 38,
+	14, -3952, 35, -3965, -3979, 20, 1, 0, 10, 17,
+	1, 23, 69, 47, 0, 15, 1, -4003, 2, -4032,
+	-4062, 49, 0, 145, 39, 1, 11, 21, 0, 83,
+	0, -4068, 5, 106, 6, 15, 40, 2, 2, 532,
+	26, 1, 1, 0, 23, 1, 1, -4125, 8, 28,
+	45, 50, -4128, 143, -4148, 15, 8, -4207, -4245, 0,
+	0, 0, 1, 49, -4268, -4270, 17, 118, 60, 45,
+	9, -4316, 3, 64, 45, 9, 15, 8, 3, 93,
+	30, 17, 0, 123, 7, 21, 2, 185, 27, 2,
+	4, 14, 5, 37, 60, 17, -4325, 34, 16, 8,
+	10, 63, 39, 5, 20, 4, 1, -4331, 34, 37,
+	0, 242, 3, 1, 34, 30, 0, 39, 56, 26,
+	5, 43, 3, 53, -4334, 61, 1, 140, 4, 15,
+	61, 50, 12, 3, 8, 2, 76, 9, -4402, 29,
+	-4407, -4459, 16, -4460, 84, 201, 3, 3, 2, 33,
+	2, 122, -4479, 0, -4501, 42, -4516, 23, 22, 23,
+	38, 4, 149, 10, 124, 21, 64, -4568, 109, 96,
+	4, 6, 46, -4625, 11, 6, 76, 3, 20, 38,
+	3, 1, 1, 43, 2, 55, 53, 73, 3, 110,
+	3, 3, 27, 2, 18, 100, -4654, 39, 250, 208,
+	51, 188, 0, 54, 5, -4681, 43, 34, 81, 58,
+	61, 29, 47, 64, 63, 0, 33, 26, 189, 77,
+	131, 67, 56, 32, -4682, 146, 30, 7, 58, 9,
+	296, 7, 25, -4692, 2, 265, 133, -4693, 62, 46,
+	49, 1, 113, -4698, -4744, 3, 60, 7, 22, 1,
+	55, 0, 4, 66, 4, -4749, 1, 42, 39, 68,
+	57, 23, 0, 14, 20, 78, 79, 22, 14, 46,
+	63, -4800, 70, 1, 38, 0, 2, 39, 0, 14,
+	144, 33, -4806, -4824, 0, 67, 51, -4863, 22, -4888,
+	118, 11, 73, 119, 25, 146, 8, 6, 7, -4896,
+	19, 4, 45, -4899, 12, 115, -4928, -4971, 276, -4989,
+	48, -5023, 0, -5030, 16, 1, 62, -5039, 29, 48,
+	22, 61, 77, 34, 4, 177, 2, 44, 73, 48,
+	7, 26, 36, 1, 97, 94, -5040, 17, 53, 59,
+	183, -5067, 6, -5125, 30, 86, 6, 8, 64, 184,
+	134, 4, -5150, -5163, 125, -5166, 2, -5185, 78, 189,
+	104, 120, 34, 71, 41, 14, 0, 144, 6, 110,
+	60, 62, 6, 57, 109, -5197, 61, 21, 32, 18,
+	43, 1, 29, 1, 47, 42, 421, -5201, 40, 12,
+	170, -5256, 177, 72, 86, 308, -5283, 17, 16, 69,
+	2, 21, 65, 3, 83, 79, 267, 7, -5346, -5375,
+	355, 13, 66, 175, 61, 35, 1, 10, 1, 2,
+	0, 84, -5376, 0, 42, 14, 14, 110, 0, 22,
+	32, 69, 1, 6, 54, 8, 8, 128, 1, 133,
+	163, 59, 101, 10, 23, 71, 0, 196, 64, 9,
+	328, 1, 143, 1, 1, 58, 35, 22, -5399, 35,
+	1, 1, 122, 207, 0, 70, 59, 0, -5442, 54,
+	3, 16, 84, 12, 233, 30, 76, 165, 132, 74,
+	-5527, 31, 100, 50, 5, -5544, 0, 105, 71, 127,
+	89, 32, 66, 102, 296, 23, 83, 134, 13, 48,
+	17, 5, 26, 10, 1, 25, 0, 6, 143, 0,
+	2, 91, 39, 150, 4, 32, 300, 11, 0, -5564,
+	156, -5566, 146, -5569, 5, 69, 36, 42, -5574, 7,
+	86, -5575, 3, -5600, -5610, 21, -5634, -5650, -5655, -5656,
+	126, 0, -5702, 436, 1, 1, 0, -5727, 24, 126,
+	112, 2, 0, 15, 606, 62, 8, 277, 156, 249,
+	2, 0, -5763, 31, 1, -5766, 27, 1, 0, 11,
+	33, 72, 25, -5793, -5804, 108, 2, -5817, 46, 113,
+	10, 38, 12, 143, 81, 87, 65, -5823, 4, 27,
+	5, 261, -5827, 0, 154, 88, 115, 1, 12, 146,
+	60, 32, 21, 1, 3, 161, 13, 159, 47, 3,
+	40, -5829, -5843, 150, 17, 470, 222, -5844, 30, 33,
+	90, 184, -5908, 16, 0, 54, 121, 0, 70, 8,
+	193, -5928, 150, 237, -5950, 349, 12, 5, 2, 67,
+	0, 394, 302, 6, 56, 13, 0, 170, 45, 2,
+	-5975, 0, 49, -6017, -6052, 36, 167, 34, 66, 68,
+	295, 164, 3, 81, 68, 2, 189, 66, 63, 21,
+	56, 197, 1, 8, 0, 13, 4, 6, 166, -6070,
+	140, -6076, 53, 60, 34, -6120, 13, 41, 0, 2,
+	30, 69, 37, 16, -6135, 49, 58, 67, 290, 9,
+	12, 23, 60, 144, 0, 33, 85, 1, 10, -6144,
+	103, -6170, 0, 481, -6175, 99, 1, 109, 9, 16,
+	-6185, 117, 22, 32, 0, 11, 141, 2, 16, 159,
+	16, 108, 0, 25, 13, 257, 146, 187, 60, -6188,
+	150, 82, 10, 0, 15, -6210, -6221, -6320, 36, 41,
+	18, 44, 103, 60, 35, 133, 33, 48, 25, 41,
+	4, 214, 101, 47, -6350, 3, 89, 48, 200, 39,
+	14, 119, 115, 10, 10, -6356, 53, 202, 0, 1,
+	23, -6363, 77, 30, 113, 132, 128, 412, 18, 48,
+	22, -6383, 161, 34, 279, 30, 24, 30, 137, -6416,
+	3, 55, 46, 59, 48, 140, 34, 0, 16, 59,
+	38, 21, 4, -6420, 1, 92, 137, 257, 512, 159,
+	-6444, 4, 496, 91, 148, 3, 165, 46, 150, 2,
+	78, 158, 1, 8, -6446, -6457, 0, 40, 26, 43,
+	248, 45, 358, -6485, -6490, 19, 20, 61, 5, -6512,
+	-6514, 3, 170, 163, 44, 17, 43, 8, 19, 481,
+	1, -6533, -6585, 13, 100, 181, 4, 14, 76, 103,
+	-6589, 9, 238, 55, 55, 33, 1, 287, 307, 535,
+	4, 9, 35, -6614, 64, 25, 104, 25, 9, 70,
+	37, -6638, 7, 519, 267, 6, 259, 4, -6642, 24,
+	-6697, 235, 451, 21, 4, -6742, -6745, 29, 2, 9,
+	438, 179, -6746, 133, -6765, 19, 52, -6773, -6840, 5,
+	96, 125, 0, 6, 11, 55, 1, 152, 143, 1,
+	-6862, 129, -6866, 10, 22, 1, 32, 10, 123, 191,
+	146, 0, 60, 2, 0, 109, 140, 3, -6881, 0,
+	135, 45, 14, 32, 89, -6890, 150, 17, 109, 108,
+	28, 49, 52, 16, 198, 15, 5, 2, 86, 104,
+	72, 156, -6923, 9, 60, 3, 1, 11, 3, 9,
+	8, 66, 30, 63, 26, 5, 183, 20, -6928, 27,
+	-6935, 114, 101, 109, 7, 40, 22, 68, -6936, 5,
+	-6955, 2, 1, 340, 9, 1, 89, 9, 1, -6969,
+	0, 288, 4, 0, 0, 113, -6980, 30, 2, 315,
+	36, 9, 38, 89, 9, 462, 3, 32, -6990, 30,
+	-7006, 0, 545, 11, 31, 123, 171, 2, 356, 976,
+	179, 138, 16, 442, -7042, 75, 224, 22, 126, 45,
+	-7044, 1, -7059, 4, -7117, 127, 10, 28, 2, 9,
+	144, 9, 34, 14, 6, 567, 266, 338, 153, 281,
+	87, -7126, 71, 1, 43, 11, 93, -7160, 60, 122,
+	14, 4, -7172, 467, -7183, 1, 18, -7210, -7239, 120,
+	60, -7279, -7297, 10, 4, -7313, -7314, 0, 181, 48,
+	3, 498, 0, 53, 8, -7326, 23, 201, 431, 188,
+	30, 99, -7351, 18, 965, -7353, 32, 1, 77, 86,
+	102, -7417, 43, 165, -7431, 103, -7446, 73, 0, 209,
+	52, 163, 155, 56, 15, 5, 28, 166, 8, -7465,
+	11, -7481, 30, 3, 50, 2, 125, -7498, 9, -7510,
+	0, 63, 39, 212, 89, 142, 128, 64, 13, 153,
+	50, 423, 122, 52, 272, 25, 31, 4, 1, 1,
+	0, 21, 188, 24, 174, 23, 269, 127, 0, 217,
+	-7609, 39, 0, 22, 4, 359, 48, 276, 251, 0,
+	1, 0, 7, 24, 9, 1, 126, 158, 208, 384,
+	-7638, 65, 204, 166, 680, 180, 135, 636, -7649, 108,
+	0, 217, 846, 65, 4, 1, 339, 71, 0, -7696,
+	3, 1, 14, 68, 83, 0, 25, 53, 98, 9,
+	26, 16, 106, 61, 1013, 82, 708, 40, 1, 6,
+	385, 0, 7, 40, 193, -7715, 101, -7726, 34, 180,
+	23, 18, 504, -7748, 58, 172, -7767, 27, 177, 204,
+	296, 0, 229, 95, 80, 4, 812, 18, -7771, 368,
+	124, 4, -7806, 1, 53, 2, 27, 148, -7875, -7887,
+	16, -7904, 278, 5, 5, -7909, -7915, 411, 163, 53,
+	1, 260, 27, 9, 1010, 4, 464, 150, 35, 45,
+	-7949, 20, 1, 49, 40, 341, 7, 711, 3, 238,
+	55, 3, 2, 50, 92, -7970, 3, 47, 1, 28,
+	2, 12, 0, 1, 82, 66, 19, 24, -7981, 1939,
+	19, 189, 39, 232, 0, 98, 45, 172, -7992, 30,
+	-8012, 24, -8134, 82, 412, 61, 0, 7, 47, 34,
+	71, 375, 211, 1, 109, 5, 0, 2358, 7, -8165,
+	-8230, 10, 9, 17, 63, 282, 237, 37, 464, 154,
+	6, -8244, 48, 0, 124, 114, 762, 105, 4, -8260,
+	134, 1, 33, 50, 362, 139, -8277, 161, 117, 154,
+	182, -8278, -8282, 105, 469, -8324, 238, 970, -8342, 247,
+	-8347, 34, 10, 55, 0, -8360, 30, 0, -8367, 301,
+	1, 0, 97, -8368, 283, 41, 0, 95, -8379,
+};
+static const mph iso639_3_bycode_hash = { 8394, 2799, iso639_3_bycode_disp, MPH_NOCASE };
+
+static const unsigned short iso639_3_bylang_pos[7874] = {
+	3543, 6395, 4530, 4409, 4851, 8390, 3266, 5198, 559, 7475,
+	3166, 7811, 1800, 7784, 352, 4988, 5280, 1017, 1159, 6600,
+	4104, 4702, 1914, 3028, 8165, 1253, 4146, 4893, 790, 6131,
+	1498, 4888, 7127, 7470, 8100, 2731, 1755, 4979, 2270, 6451,
+	6034, 6559, 6226, 4311, 2440, 3651, 8209, 1505, 674, 7620,
+	1541, 7664, 4083, 1857, 4526, 3192, 4268, 319, 7662, 1249,
+	3737, 3780, 1964, 6116, 7575, 1101, 8379, 6798, 158, 1366,
+	4969, 2532, 1172, 2078, 4864, 225, 2223, 193, 1568, 4244,
+	3650, 2119, 2280, 1773, 7450, 1512, 2222, 4703, 3421, 6716,
+	4725, 2595, 1138, 1164, 2857, 4537, 3003, 3253, 6437, 231,
+	7505, 7922, 1309, 140, 3777, 2568, 6328, 541, 8377, 195,
+	7256, 3146, 2343, 4983, 1833, 2133, 7264, 6810, 4487, 7977,
+	3488, 5289, 6724, 23, 5112, 2620, 4778, 3593, 5321, 6037,
+	572, 2281, 966, 7611, 999, 4276, 6306, 1827, 2233, 4587,
+	1212, 6263, 7280, 229, 3015, 4735, 1482, 5077, 701, 254,
+	5981, 5391, 6259, 3371, 8257, 1334, 1116, 2799, 2779, 7892,
+	6788, 1978, 4639, 7684, 5375, 2113, 2154, 2168, 6344, 5242,
+	1526, 4496, 6132, 374, 7618, 4245, 2201, 4321, 4994, 557,
+	7579, 925, 3529, 652, 7525, 731, 7902, 4079, 4309, 4541,
+	6553, 7314, 4170, 1772, 1275, 2255, 4627, 1799, 1018, 3113,
+	2340, 2513, 4873, 745, 4201, 4127, 4773, 3039, 5241, 7158,
+	7501, 5104, 1606, 6663, 2836, 1228, 1794, 1102, 6160, 7091,
+	1419, 5151, 3838, 6193, 7649, 1432, 3994, 4942, 453, 3756,
+	3290, 316, 7145, 816, 6473, 4916, 3133, 3215, 961, 6889,
+	7018, 2309, 6733, 3959, 4062, 2387, 3337, 1154, 8175, 2221,
+	1494, 2627, 114, 2427, 5456, 4517, 4387, 4434, 5263, 8241,
+	7644, 1556, 8206, 1951, 6919, 6787, 620, 2607, 7351, 2982,
+	4938, 6289, 7492, 7478, 858, 2546, 1073, 2106, 1276, 7259,
+	1316, 227, 6725, 3469, 4473, 8348, 3971, 4002, 2211, 1240,
+	4707, 6021, 3961, 3775, 697, 3609, 6401, 2814, 6181, 7404,
+	4595, 2386, 1651, 262, 2391, 7214, 857, 7313, 4620, 4118,
+	2230, 5088, 6079, 4790, 6430, 7241, 5353, 1337, 6572, 8278,
+	2755, 3564, 1628, 612, 963, 3956, 4290, 8067, 4360, 4125,
+	8269, 4631, 160, 6652, 4112, 3432, 3612, 1729, 109, 4605,
+	4137, 6950, 3964, 606, 7405, 3265, 761, 7227, 3779, 1011,
+	2203, 3364, 8056, 3760, 1026, 2757, 8167, 4876, 3534, 192,
+	6696, 8172, 7246, 2835, 3048, 3508, 3313, 529, 8129, 4891,
+	4934, 8012, 7895, 5419, 8330, 4783, 7169, 261, 4879, 4066,
+	3446, 6262, 7740, 2516, 5298, 2318, 680, 3866, 690, 7535,
+	2385, 8093, 6885, 7713, 4950, 8126, 2611, 4044, 3515, 6342,
+	407, 4767, 4331, 2071, 3386, 401, 8063, 6809, 6650, 3001,
+	2265, 1151, 3607, 4213, 1031, 4548, 2226, 8352, 1636, 2105,
+	1661, 3064, 8187, 1470, 4040, 7255, 1058, 2262, 3904, 6347,
+	2609, 2671, 7301, 2719, 4787, 7122, 6522, 7523, 2104, 2010,
+	177, 7530, 4728, 2998, 3437, 1510, 1554, 1655, 8253, 6833,
+	4782, 2711, 1261, 762, 2529, 6996, 7918, 2017, 7958, 6767,
+	1813, 7056, 2643, 3322, 6869, 7561, 8191, 155, 503, 1012,
+	6831, 3484, 4430, 6029, 6103, 6938, 3898, 6095, 3239, 171,
+	8220, 7569, 2935, 7443, 6454, 8282, 2624, 168, 8340, 7843,
+	2144, 1645, 7540, 5096, 8091, 1963, 1168, 7623, 8034, 6818,
+	8013, 5199, 6590, 7287, 412, 7786, 6091, 7220, 696, 983,
+	4106, 2895, 2559, 7737, 4586, 4163, 788, 1353, 7690, 5157,
+	4698, 4055, 1499, 3563, 1506, 6695, 3917, 3818, 260, 8306,
+	4733, 4429, 2908, 1830, 6391, 2910, 705, 2312, 8189, 4748,
+	4963, 3475, 5363, 3157, 984, 4215, 1217, 4486, 3085, 3414,
+	3089, 1495, 7656, 5352, 3131, 2497, 8097, 2166, 2297, 7504,
+	1573, 803, 2499, 127, 2638, 2005, 1273, 2273, 3790, 5,
+	3885, 4418, 7333, 1699, 8127, 6405, 7052, 8359, 6209, 2975,
+	7305, 4802, 2404, 4616, 786, 6682, 7175, 8096, 2073, 1587,
+	357, 7427, 935, 2618, 1798, 3200, 6548, 5413, 2134, 7368,
+	4765, 7836, 866, 3877, 3841, 6389, 6500, 2864, 1672, 1262,
+	845, 4550, 3108, 666, 8376, 4462, 6638, 2317, 2514, 361,
+	1360, 4947, 3402, 2840, 5432, 6392, 6130, 2717, 2457, 3498,
+	7038, 6410, 4824, 3677, 48, 4722, 2438, 7186, 5301, 1460,
+	7946, 4677, 162, 2542, 6750, 6493, 1299, 3820, 5076, 660,
+	645, 2817, 1376, 7634, 7956, 2566, 3567, 6582, 3577, 3282,
+	2303, 2674, 5071, 2762, 4111, 6402, 6109, 1358, 4697, 6265,
+	153, 2994, 6583, 2830, 7997, 709, 8366, 2850, 7864, 3026,
+	6539, 7510, 3747, 3528, 484, 1103, 8375, 6812, 902, 2357,
+	4396, 7779, 2525, 7941, 6749, 7790, 3822, 2599, 6048, 7331,
+	174, 2511, 4540, 4837, 4635, 384, 3309, 1479, 3893, 695,
+	336, 4665, 6785, 3162, 3542, 4709, 6093, 8312, 5231, 1704,
+	4613, 5013, 2325, 5311, 1707, 6974, 1569, 1206, 1386, 6983,
+	395, 4271, 4361, 3675, 2547, 4640, 440, 5411, 7218, 3988,
+	8068, 5225, 7072, 575, 263, 4304, 532, 4256, 7714, 2867,
+	1617, 1866, 5144, 2593, 8391, 6799, 5101, 7708, 1044, 7671,
+	3943, 8273, 5376, 635, 882, 7481, 3445, 5125, 6086, 7252,
+	4033, 6501, 5308, 4554, 7559, 3510, 3787, 7239, 3664, 5366,
+	1847, 587, 1211, 7605, 5452, 2433, 8207, 1461, 1350, 4115,
+	538, 2623, 6354, 3293, 390, 4552, 502, 7599, 6647, 1231,
+	6881, 6282, 7238, 4836, 1279, 7960, 3880, 1109, 855, 7583,
+	2809, 1663, 2844, 4967, 7272, 3373, 4383, 2462, 3823, 595,
+	93, 6148, 1118, 6145, 7466, 782, 8326, 5278, 2363, 7291,
+	4272, 3185, 7955, 3095, 3644, 1454, 4298, 1084, 7353, 6811,
+	4939, 6890, 2155, 308, 7182, 4401, 2482, 3900, 1428, 3066,
+	3526, 2597, 6853, 1237, 6642, 1935, 8297, 1944, 4012, 7306,
+	2839, 3830, 5428, 7417, 4937, 7652, 3442, 6672, 1257, 4086,
+	7989, 1688, 5084, 7053, 8148, 6657, 6106, 6861, 3627, 6602,
+	2666, 3083, 1165, 2748, 1004, 4065, 5160, 1524, 4980, 2842,
+	6608, 1610, 2964, 8078, 2944, 2819, 1872, 1008, 64, 3754,
+	6312, 8266, 419, 455, 5180, 2622, 7666, 6739, 5206, 7948,
+	6622, 6141, 2114, 6699, 1825, 2930, 8388, 7039, 4628, 1263,
+	2259, 3554, 5007, 1251, 3772, 5093, 2893, 3311, 3635, 1343,
+	1960, 482, 2075, 1877, 3361, 4109, 3068, 6330, 2125, 3109,
+	3738, 7003, 1898, 8364, 5044, 5246, 8349, 2421, 6498, 6393,
+	7203, 3315, 1911, 6535, 4318, 3594, 3077, 3763, 1177, 3482,
+	515, 4291, 3148, 2004, 6144, 79, 959, 4734, 67, 6968,
+	2351, 6303, 765, 3631, 8238, 6546, 2685, 7273, 6684, 6529,
+	8180, 7637, 5155, 2454, 1029, 3217, 7493, 1329, 3582, 6118,
+	7834, 1624, 5029, 7153, 523, 2228, 3628, 7152, 5999, 8045,
+	4990, 8354, 7549, 655, 4333, 1930, 3165, 1634, 4150, 4452,
+	2336, 4220, 2632, 3657, 7485, 2410, 2903, 2282, 2207, 1581,
+	1946, 3354, 6746, 8276, 4691, 6047, 2812, 3611, 1314, 7073,
+	6762, 8239, 1716, 2488, 2829, 2691, 6925, 5065, 4376, 327,
+	2635, 4614, 5192, 2412, 2458, 1478, 4729, 5070, 6795, 5132,
+	916, 641, 1795, 2408, 2826, 6008, 2849, 5008, 7120, 1502,
+	2598, 2753, 4604, 4293, 3864, 2453, 778, 3105, 4289, 5269,
+	7812, 869, 2437, 4573, 3216, 2409, 2784, 2531, 7552, 8201,
+	2752, 7739, 4539, 957, 6027, 7482, 1123, 42, 2780, 1832,
+	2394, 8130, 7384, 8196, 6714, 2631, 7014, 404, 4981, 1137,
+	1509, 6435, 6566, 6442, 6845, 2945, 1066, 1863, 2972, 4989,
+	3332, 5319, 1894, 3927, 719, 643, 3730, 639, 7224, 2,
+	1274, 1382, 1626, 355, 1612, 8114, 321, 539, 7928, 1576,
+	2630, 206, 4013, 5023, 237, 891, 1824, 3572, 827, 2180,
+	2298, 2311, 4054, 1167, 6470, 2150, 2677, 5994, 4924, 2432,
+	2769, 8267, 5379, 979, 3480, 3503, 3892, 2413, 7428, 4096,
+	2025, 1077, 6133, 630, 325, 476, 7106, 334, 4828, 3128,
+	5168, 3156, 6531, 7926, 7008, 6625, 2355, 2894, 4074, 354,
+	2485, 2813, 6142, 7880, 2950, 4700, 2395, 139, 1842, 4107,
+	6589, 7745, 5079, 1346, 4312, 4399, 2477, 86, 4905, 8319,
+	7991, 8216, 499, 6447, 3622, 2549, 111, 7335, 340, 1269,
+	385, 6152, 5399, 4973, 7075, 1131, 542, 6438, 2560, 5017,
+	1886, 785, 4390, 142, 3271, 4421, 123, 6839, 3819, 7019,
+	8042, 7707, 8371, 4132, 974, 7344, 4468, 7813, 8031, 3793,
+	8245, 2986, 3624, 1184, 289, 4325, 4575, 465, 3660, 3378,
+	3852, 3648, 347, 880, 1318, 4909, 1298, 3440, 161, 7105,
+	4101, 3278, 2530, 3865, 6537, 1538, 2127, 3663, 6605, 2322,
+	6585, 7134, 3869, 7210, 6547, 733, 7509, 7300, 2057, 7594,
+	220, 1230, 1594, 5393, 1141, 5030, 7782, 3690, 6533, 1395,
+	8082, 1100, 436, 562, 5085, 1453, 1289, 729, 1322, 6462,
+	7023, 6485, 1239, 4119, 1913, 852, 4520, 0, 6466, 6986,
+	1916, 1518, 1397, 1348, 6760, 381, 3512, 1975, 1675, 4001,
+	7329, 753, 7438, 7844, 5133, 1641, 1848, 6464, 7932, 4600,
+	8224, 4346, 461, 578, 1161, 8192, 4529, 8176, 3883, 3027,
+	7116, 4224, 3856, 2922, 2393, 99, 3112, 2026, 6072, 908,
+	1874, 3017, 4869, 802, 5073, 6373, 2527, 8387, 5039, 6567,
+	427, 2250, 3397, 738, 7310, 152, 7891, 3873, 774, 2055,
+	7512, 6102, 6759, 7763, 7429, 6769, 6913, 4059, 6198, 1003,
+	2079, 2615, 7321, 6949, 1163, 4038, 1570, 614, 1647, 3250,
+	6951, 76, 2459, 1294, 7832, 7524, 2664, 92, 5042, 1344,
+	7304, 2662, 5163, 1673, 629, 7007, 4327, 8316, 2651, 1637,
+	4746, 6581, 2023, 3870, 6012, 7357, 4761, 3007, 1548, 4818,
+	2556, 2059, 7988, 8333, 6510, 3592, 4792, 1061, 6421, 5134,
+	2330, 1135, 5061, 517, 7095, 7706, 7624, 2647, 3138, 1160,
+	6128, 301, 7459, 6177, 7015, 6045, 1757, 1885, 3536, 3761,
+	4456, 22, 6899, 3073, 8250, 5995, 6275, 1500, 1999, 5342,
+	7184, 7555, 3744, 4358, 5450, 1333, 1341, 1698, 6351, 7954,
+	4846, 6428, 2592, 8200, 7295, 1553, 898, 672, 5223, 1021,
+	6194, 7142, 6521, 6457, 7730, 445, 7049, 2985, 4512, 2018,
+	6940, 7437, 3853, 591, 2494, 2596, 1035, 3472, 3655, 6960,
+	7557, 6105, 1656, 234, 2670, 2801, 32, 876, 88, 7854,
+	59, 1733, 1884, 4776, 2613, 7635, 921, 3051, 2118, 6934,
+	7464, 4077, 3640, 5360, 2229, 322, 5020, 7987, 2508, 5229,
+	647, 7455, 5988, 5264, 549, 6477, 1385, 5043, 3257, 6458,
+	699, 2802, 3653, 967, 3173, 3241, 7699, 7247, 3845, 185,
+	8242, 8054, 2617, 2970, 2464, 4855, 1893, 7560, 7750, 1797,
+	317, 377, 8368, 1148, 1462, 3330, 2442, 2396, 820, 4930,
+	4366, 474, 1099, 4049, 2712, 807, 1384, 6646, 4235, 1896,
+	1282, 7701, 331, 8159, 1639, 2680, 1904, 4630, 6229, 1119,
+	4777, 4692, 3052, 7047, 4533, 2253, 470, 7290, 1095, 4087,
+	3710, 284, 3965, 2501, 2341, 7934, 1809, 585, 1613, 7162,
+	457, 5214, 6223, 4859, 1093, 6487, 861, 2152, 3363, 7840,
+	2747, 3785, 714, 8328, 1200, 727, 1928, 6019, 7778, 2997,
+	7242, 987, 1193, 2132, 2888, 1802, 4070, 3929, 4143, 6528,
+	7077, 7058, 5299, 2528, 4071, 5057, 1189, 8170, 7627, 2033,
+	653, 2775, 7104, 3100, 2210, 1642, 1840, 1745, 4752, 3224,
+	706, 3706, 3009, 8235, 7981, 926, 126, 4295, 2831, 1734,
+	7686, 8028, 1640, 684, 2236, 3669, 2001, 7705, 2919, 4416,
+	2100, 2308, 8149, 4609, 1243, 955, 1271, 1121, 3874, 267,
+	2575, 6897, 91, 7425, 4307, 4093, 6530, 7855, 1235, 6319,
+	4439, 8058, 8225, 4903, 2645, 5159, 5447, 607, 196, 491,
+	3875, 4638, 1677, 1051, 2978, 4642, 574, 3701, 561, 7596,
+	6286, 1519, 3423, 5386, 814, 7393, 2429, 7349, 8344, 6534,
+	6668, 2288, 5218, 1839, 4316, 306, 4135, 1469, 2724, 6801,
+	7679, 2684, 4236, 495, 2051, 877, 2304, 5005, 8153, 5252,
+	7616, 6127, 7683, 832, 703, 4353, 1759, 330, 65, 4153,
+	4660, 1435, 3088, 3926, 1979, 6325, 7746, 7646, 3124, 5046,
+	8361, 2196, 4918, 7372, 756, 2110, 6345, 4445, 4819, 793,
+	8252, 3759, 2912, 6416, 2260, 4827, 1742, 4739, 4705, 5377,
+	1458, 7805, 6704, 4404, 1034, 854, 6419, 3999, 4721, 4875,
+	3620, 1252, 2481, 5011, 7033, 3930, 4696, 3142, 2761, 7324,
+	1629, 7066, 7226, 6536, 7249, 8311, 7441, 6009, 5402, 791,
+	1037, 3976, 2628, 686, 7165, 7415, 8378, 7063, 3771, 4577,
+	4850, 4122, 7006, 6288, 4899, 7967, 6875, 4510, 4161, 2049,
+	428, 5982, 7378, 602, 8233, 12, 3646, 6059, 1776, 3520,
+	1618, 2435, 4114, 3281, 6284, 6236, 4832, 1543, 8081, 2858,
+	4165, 5108, 3357, 6341, 3069, 4634, 8215, 2699, 1750, 2060,
+	1720, 3453, 318, 4907, 212, 7959, 5403, 1882, 7472, 7320,
+	7578, 6560, 6721, 2486, 3154, 435, 5106, 3630, 914, 244,
+	2543, 6189, 1971, 7361, 3172, 5187, 3996, 1561, 4131, 128,
+	6083, 7674, 6123, 4388, 3704, 82, 6822, 2058, 4182, 4381,
+	1858, 1327, 513, 8177, 370, 4543, 3176, 628, 3194, 3721,
+	6478, 4807, 7374, 1792, 4844, 4619, 4862, 8299, 3491, 3654,
+	3294, 288, 3535, 1433, 7476, 7308, 6032, 552, 1213, 7943,
+	6909, 5431, 7861, 3249, 7115, 3143, 664, 6639, 3947, 4784,
+	2158, 2067, 5217, 4704, 6315, 3899, 3299, 7274, 8051, 2225,
+	2626, 4108, 3479, 4571, 4302, 4411, 55, 8074, 4727, 1396,
+	5441, 7950, 3341, 7603, 6028, 4921, 5993, 7551, 4669, 7999,
+	1514, 7534, 1598, 7725, 4171, 3871, 1496, 1897, 7738, 4260,
+	7640, 2062, 3486, 7629, 810, 5422, 4553, 7207, 7726, 183,
+	5015, 7408, 3733, 7117, 2555, 3243, 2116, 172, 6121, 8046,
+	7082, 3836, 6942, 6221, 20, 494, 6924, 8226, 2082, 3521,
+	6266, 8116, 1630, 393, 4644, 3193, 4359, 7440, 7139, 8274,
+	479, 3531, 3638, 2426, 8107, 2818, 2007, 2077, 2768, 187,
+	811, 1708, 3460, 6377, 2232, 918, 28, 8261, 264, 8026,
+	6873, 3859, 3203, 946, 2258, 4412, 6217, 4151, 5147, 6195,
+	1361, 4490, 7406, 2653, 3842, 6220, 1922, 4196, 3725, 3497,
+	5292, 6422, 4207, 3837, 4766, 6440, 4652, 7966, 7402, 1302,
+	5455, 7980, 6287, 8322, 3975, 6757, 189, 6523, 6068, 3111,
+	1491, 3306, 205, 6816, 2428, 1352, 4674, 2003, 8258, 6448,
+	1284, 3236, 447, 7365, 512, 6411, 1144, 8307, 4089, 971,
+	3796, 5053, 6670, 4253, 7927, 379, 417, 348, 2291, 3206,
+	1536, 6894, 5028, 3808, 1146, 4877, 5322, 6571, 6253, 2272,
+	3598, 7285, 6978, 7074, 715, 8329, 3684, 6365, 4199, 6356,
+	8181, 973, 2636, 4892, 3601, 4796, 3941, 2951, 1643, 1355,
+	7923, 6606, 25, 2061, 8017, 3303, 3016, 7848, 8285, 3062,
+	4216, 1378, 350, 1988, 4308, 2471, 5087, 5115, 1974, 5102,
+	2608, 4123, 3978, 2377, 7884, 1258, 1170, 1977, 7789, 3691,
+	3098, 2821, 4651, 475, 4527, 6412, 781, 7919, 4764, 1342,
+	4315, 4922, 2085, 5248, 7041, 6155, 1769, 6884, 4420, 4617,
+	298, 3817, 4069, 7765, 8133, 6227, 2577, 1625, 2976, 4715,
+	4952, 5107, 6308, 651, 6426, 8003, 3262, 7068, 5055, 746,
+	7556, 3895, 8304, 6775, 8313, 2873, 586, 6497, 2054, 51,
+	6277, 7057, 4285, 1828, 3436, 7495, 4597, 3231, 2348, 2102,
+	2198, 2979, 5985, 3465, 3169, 6187, 4953, 6398, 7615, 4336,
+	6669, 6618, 2743, 563, 1387, 4031, 7426, 3429, 5314, 662,
+	1852, 3054, 4680, 2939, 285, 4, 4000, 644, 3144, 2915,
+	8303, 2715, 3494, 4557, 7161, 1692, 8275, 1984, 5000, 438,
+	5435, 2503, 1740, 8087, 1601, 6313, 2600, 568, 371, 487,
+	3232, 6675, 7881, 6930, 1335, 1968, 7917, 1936, 6995, 2286,
+	274, 860, 2452, 1730, 2145, 5356, 6742, 3448, 5380, 4758,
+	1697, 4116, 1447, 2248, 2069, 2846, 4760, 8043, 2946, 8110,
+	1256, 4592, 243, 6947, 7962, 7337, 7275, 4804, 4157, 2333,
+	1287, 3251, 6932, 8086, 6385, 2948, 7900, 4025, 1446, 4588,
+	4523, 5098, 1952, 7229, 5153, 6584, 3228, 6449, 6794, 6791,
+	707, 1383, 4320, 4254, 4250, 1849, 8139, 4039, 1958, 7511,
+	1197, 2436, 3493, 442, 3906, 533, 7376, 4064, 8289, 305,
+	1218, 387, 4887, 887, 6143, 524, 4763, 1959, 944, 7890,
+	6595, 1250, 2688, 5398, 1876, 6690, 8386, 5062, 2277, 6234,
+	7753, 1788, 4329, 938, 5348, 1834, 3180, 8160, 2681, 7858,
+	8185, 5113, 2869, 4933, 6777, 5369, 143, 6367, 4574, 556,
+	2552, 3794, 7794, 3093, 2793, 342, 968, 7576, 3451, 8033,
+	2640, 4567, 4008, 1835, 6183, 2977, 7762, 7228, 2707, 6740,
+	2765, 5260, 3207, 8011, 3272, 2401, 1608, 4369, 7630, 7024,
+	6403, 3072, 6867, 6491, 1620, 1515, 2335, 1232, 6886, 960,
+	510, 5454, 1321, 2406, 4986, 3331, 4210, 2679, 8061, 2419,
+	3459, 8247, 1710, 7461, 3071, 1507, 4121, 7084, 1064, 7593,
+	7772, 1356, 3137, 8264, 216, 1705, 5388, 2578, 449, 1881,
+	6793, 1862, 5286, 2852, 7396, 3008, 477, 8296, 5031, 7886,
+	3983, 5344, 4872, 1431, 3034, 7748, 2122, 8020, 282, 3829,
+	3441, 4911, 1201, 3705, 4781, 8228, 7842, 4185, 2029, 366,
+	3256, 3221, 6453, 3074, 4477, 1014, 3833, 6588, 7334, 3269,
+	4459, 1921, 6850, 7869, 84, 5094, 2181, 947, 6138, 8331,
+	2352, 6737, 742, 6327, 3225, 7446, 1380, 7420, 581, 497,
+	1521, 6070, 6641, 2517, 3055, 5202, 5340, 1089, 1053, 6858,
+	359, 3263, 6309, 6956, 990, 5143, 5116, 4004, 2538, 5048,
+	669, 4372, 7029, 3377, 625, 2209, 3565, 151, 3273, 3454,
+	1076, 725, 4726, 4299, 8178, 1771, 4663, 2324, 4549, 4461,
+	766, 6747, 132, 2171, 6272, 6679, 4436, 3056, 4894, 2776,
+	2759, 8004, 3196, 2742, 7613, 4386, 6969, 4688, 3220, 4344,
+	471, 1094, 6480, 1426, 2668, 6871, 546, 5182, 2655, 6579,
+	7240, 4233, 4584, 7096, 5128, 4028, 5140, 954, 2163, 1132,
+	570, 2756, 4036, 4536, 3141, 2185, 2995, 5066, 2841, 842,
+	8050, 7401, 3078, 1727, 150, 5178, 4330, 19, 4621, 3647,
+	4169, 3776, 4488, 3439, 2856, 2321, 2732, 53, 5996, 771,
+	2827, 4255, 464, 7342, 496, 7424, 4878, 6594, 7107, 3161,
+	4310, 148, 1689, 4801, 4759, 3659, 4438, 3913, 6100, 4460,
+	4389, 1113, 865, 8327, 4987, 8248, 5250, 3410, 896, 2090,
+	6175, 7614, 3718, 1713, 356, 1542, 7736, 4785, 416, 4957,
+	6862, 3470, 6349, 1354, 3580, 6623, 257, 5421, 4356, 2430,
+	2882, 6157, 2491, 4178, 5313, 3424, 3464, 3375, 1301, 3811,
+	4139, 2326, 7463, 1152, 6904, 3233, 833, 6677, 4037, 2218,
+	226, 3289, 5290, 7718, 4009, 1545, 1784, 3902, 6685, 4469,
+	3786, 4228, 1129, 7451, 3116, 1268, 3061, 1715, 5389, 5417,
+	7852, 6842, 1695, 4524, 3942, 7729, 7283, 8117, 383, 444,
+	676, 2344, 6564, 3732, 8188, 6855, 7781, 759, 4931, 2293,
+	463, 2669, 3658, 5226, 2099, 7037, 1586, 911, 6065, 6697,
+	8106, 6829, 3977, 3821, 210, 4448, 4281, 4263, 6459, 8044,
+	1451, 7622, 1404, 3476, 3248, 323, 291, 4598, 6230, 2092,
+	1990, 693, 665, 7409, 5249, 2107, 1328, 7939, 7109, 3229,
+	492, 6379, 4935, 6271, 7114, 1969, 6976, 2240, 3686, 2913,
+	994, 7787, 1826, 2245, 5365, 181, 2702, 3722, 2958, 3302,
+	7581, 3320, 6864, 5409, 1577, 900, 6016, 4351, 3931, 668,
+	6575, 4699, 500, 8035, 7216, 7513, 748, 7548, 5215, 764,
+	1702, 4564, 3665, 6928, 2704, 3992, 2153, 6316, 7265, 1728,
+	1108, 588, 3740, 221, 7021, 6463, 3187, 3020, 7916, 3139,
+	7289, 6718, 6495, 7536, 1525, 7322, 1347, 3993, 7439, 1530,
+	3183, 3731, 2746, 3840, 7680, 2764, 3419, 4475, 3752, 7090,
+	1662, 2037, 2589, 7673, 6248, 6292, 7700, 1931, 3951, 3914,
+	1224, 795, 459, 7431, 7397, 4732, 596, 4623, 2955, 1368,
+	6153, 2417, 6274, 6488, 7113, 4183, 728, 2372, 3939, 6101,
+	388, 2825, 817, 2541, 4992, 4578, 1192, 646, 1195, 6381,
+	2307, 3713, 3485, 8023, 8077, 6781, 7268, 2791, 1325, 6991,
+	7859, 2249, 4067, 2960, 5426, 7414, 868, 5189, 7969, 1157,
+	4134, 294, 7532, 2089, 8335, 1777, 1477, 2923, 7100, 1724,
+	1006, 4910, 480, 7040, 8343, 8243, 8193, 7312, 7197, 6912,
+	6910, 6511, 6147, 3962, 564, 1147, 4251, 724, 4451, 7711,
+	754, 7364, 456, 3636, 8211, 8320, 1254, 7453, 4965, 2612,
+	7269, 4956, 2567, 7626, 7025, 2449, 4664, 4770, 535, 4898,
+	11, 4279, 1403, 7996, 4678, 4130, 976, 7422, 3280, 4080,
+	6860, 6496, 980, 1120, 5035, 3557, 8380, 4035, 4823, 6212,
+	5373, 4186, 7170, 3046, 7288, 2796, 7882, 981, 4410, 4925,
+	1040, 5361, 1005, 3719, 6359, 4248, 1604, 6335, 2771, 61,
+	5244, 5407, 4020, 6005, 2064, 1497, 1045, 700, 3801, 7951,
+	2424, 2808, 4884, 4755, 7195, 7359, 3032, 579, 6042, 1171,
+	1448, 7108, 1050, 6305, 6906, 7773, 1227, 8265, 4113, 3570,
+	1106, 1770, 7751, 2478, 2788, 5276, 7820, 3011, 2323, 1247,
+	2853, 1074, 4622, 6686, 1323, 8014, 7788, 5139, 8227, 2072,
+	799, 5444, 6076, 7570, 2933, 3847, 3030, 2992, 7480, 7045,
+	6311, 6604, 1464, 4858, 5049, 777, 6098, 2887, 4959, 165,
+	3618, 7728, 2039, 3519, 7467, 2455, 8217, 6432, 2254, 550,
+	4019, 3804, 2376, 7316, 7908, 6879, 5142, 4085, 7550, 4225,
+	2208, 1821, 1722, 2502, 2466, 1389, 489, 2660, 8070, 8260,
+	7938, 6599, 2637, 1020, 792, 2901, 3743, 2392, 7719, 8256,
+	6264, 939, 7398, 7721, 3937, 6120, 6518, 3576, 2138, 1234,
+	2749, 6626, 4633, 6898, 3789, 7345, 6954, 6736, 2652, 6290,
+	2015, 7850, 6843, 5213, 3267, 6988, 7002, 4495, 3186, 1836,
+	4203, 2962, 2621, 2467, 7747, 5318, 7386, 2822, 124, 3559,
+	3065, 6549, 7845, 2851, 4158, 1441, 812, 2586, 6099, 2766,
+	2872, 5401, 775, 7648, 3021, 6673, 2990, 821, 3755, 4542,
+	2741, 4945, 3096, 3882, 576, 37, 8053, 5103, 3546, 2422,
+	1534, 504, 2723, 7533, 1861, 3944, 5056, 5392, 4458, 5251,
+	6741, 7914, 6603, 2924, 5323, 3682, 4234, 6743, 4854, 9,
+	4222, 4582, 8338, 4658, 6074, 6941, 8154, 7271, 7137, 5036,
+	2460, 6390, 6868, 7060, 6654, 1001, 5438, 6648, 3477, 5183,
+	1607, 6870, 6252, 2041, 422, 6482, 271, 6117, 8353, 4949,
+	7213, 6378, 3212, 886, 2275, 3781, 3825, 2545, 6532, 2590,
+	5410, 3717, 3843, 1450, 5203, 3848, 3218, 8007, 4771, 7759,
+	1945, 198, 6632, 7394, 1790, 3019, 6361, 1174, 2720, 6846,
+	1927, 4501, 4943, 2690, 7284, 1682, 62, 8295, 8337, 74,
+	7899, 3334, 663, 3170, 6994, 7580, 801, 8027, 3106, 3798,
+	1947, 4615, 4206, 101, 7769, 2445, 6475, 4753, 136, 300,
+	6933, 8099, 2006, 7343, 4513, 4160, 7837, 4558, 2509, 6952,
+	6255, 2174, 4464, 6854, 4022, 1126, 776, 558, 1801, 6014,
+	8062, 6040, 837, 7022, 7846, 6358, 6551, 71, 493, 5179,
+	3699, 6429, 7208, 934, 4534, 4355, 3828, 57, 567, 89,
+	3045, 3998, 4095, 2989, 4081, 1246, 4453, 1562, 7507, 8183,
+	2126, 4314, 4391, 4531, 843, 744, 1854, 5124, 4789, 1176,
+	3118, 3711, 3059, 2176, 6140, 8301, 3909, 1995, 4443, 962,
+	5443, 6388, 2128, 245, 822, 4190, 166, 3408, 1178, 6666,
+	2881, 7937, 1439, 4885, 8358, 3101, 1463, 247, 4043, 521,
+	3919, 7577, 1880, 6087, 2966, 7564, 3327, 7387, 6080, 5119,
+	2816, 6702, 1658, 4373, 8025, 485, 4853, 4521, 1415, 7675,
+	1957, 7602, 2131, 6966, 2524, 6681, 7383, 1124, 4560, 7612,
+	3222, 3742, 4826, 4701, 3678, 3158, 1549, 4297, 520, 3516,
+	6249, 3270, 310, 6619, 4058, 4800, 1555, 6797, 8079, 7924,
+	4904, 3466, 4886, 4133, 2206, 1962, 4795, 7716, 3268, 2290,
+	3805, 3614, 2327, 600, 2425, 2999, 4991, 3862, 7905, 4779,
+	1760, 7889, 7245, 4673, 3595, 6146, 2470, 4659, 2189, 4278,
+	7132, 5341, 8251, 815, 2279, 3447, 1209, 3749, 7982, 7225,
+	7974, 7020, 6671, 4936, 6896, 1819, 3982, 5980, 8315, 5984,
+	2378, 6837, 3347, 286, 6414, 2665, 2774, 100, 831, 808,
+	2492, 3018, 6352, 222, 4267, 621, 7323, 3119, 1738, 3209,
+	3963, 839, 4504, 6380, 8104, 3989, 872, 3122, 2261, 2862,
+	1811, 888, 4834, 4589, 7546, 6355, 6593, 328, 6023, 3778,
+	7302, 941, 3903, 3406, 956, 3762, 8356, 4975, 302, 3527,
+	8281, 5092, 4449, 2728, 7086, 1503, 5059, 8047, 6126, 3029,
+	252, 3602, 2838, 4788, 8040, 4809, 1127, 4515, 1475, 6519,
+	826, 4284, 2641, 4606, 4736, 4720, 2476, 7894, 890, 8038,
+	1272, 3881, 4371, 4249, 4757, 4497, 8350, 458, 2170, 1972,
+	8292, 6172, 3696, 7565, 7010, 6562, 907, 5384, 3933, 993,
+	2794, 2149, 4585, 3948, 6424, 382, 1991, 6425, 6786, 4793,
+	5254, 7500, 1535, 266, 4914, 6232, 616, 2136, 1615, 203,
+	681, 3591, 2448, 7697, 3296, 3707, 34, 1540, 3766, 6082,
+	426, 4509, 4805, 1660, 7193, 2926, 2217, 2996, 3997, 5355,
+	6163, 3392, 7643, 1046, 3692, 1048, 2456, 525, 2697, 1907,
+	8001, 2052, 2287, 1033, 3135, 5445, 8088, 4867, 2518, 6624,
+	1937, 7237, 734, 7897, 7219, 829, 1331, 5317, 2506, 8169,
+	7119, 4607, 4762, 1133, 8323, 4857, 5983, 5265, 8022, 2192,
+	2120, 3518, 4657, 2619, 163, 3676, 77, 856, 2537, 3245,
+	1684, 7964, 8259, 6071, 8124, 1097, 2548, 1472, 228, 3177,
+	2081, 4345, 3396, 7677, 6708, 3393, 41, 6081, 3326, 201,
+	6586, 3912, 6161, 6439, 780, 7971, 6240, 2787, 5291, 3430,
+	7278, 879, 1365, 7389, 950, 2706, 4423, 1285, 6001, 443,
+	3204, 5992, 6971, 8000, 3080, 1746, 7990, 692, 3544, 7098,
+	1721, 1667, 176, 6911, 4563, 5164, 3736, 794, 747, 2390,
+	3849, 6297, 3260, 2329, 6469, 6771, 1028, 6461, 6806, 1761,
+	1281, 3966, 1490, 6036, 6640, 5253, 7542, 1288, 8199, 5240,
+	7199, 4136, 6033, 6052, 3067, 4479, 1043, 4100, 7609, 2565,
+	6165, 7160, 5302, 4324, 4682, 1248, 7978, 4966, 2520, 6965,
+	4305, 3517, 7819, 4565, 6779, 2725, 7539, 1736, 2833, 439,
+	3935, 7369, 7574, 3103, 3428, 6346, 3685, 7909, 2292, 5045,
+	8230, 7299, 1125, 928, 1445, 3049, 678, 2591, 4319, 2397,
+	276, 5281, 6728, 6513, 7174, 6415, 6880, 6888, 5986, 7663,
+	569, 1890, 2729, 4288, 4097, 6336, 4193, 7051, 2416, 4941,
+	1111, 4041, 755, 281, 1717, 344, 7009, 1954, 6353, 4339,
+	4258, 6998, 3795, 4162, 6066, 6550, 413, 4042, 2885, 2465,
+	1038, 3240, 8229, 7709, 5051, 919, 7992, 7907, 129, 2295,
+	3298, 341, 4503, 4294, 3012, 1616, 8246, 7585, 768, 6026,
+	7126, 4156, 1393, 1181, 4176, 2043, 6629, 899, 6929, 4815,
+	7155, 3887, 7610, 4402, 7479, 6703, 4286, 6340, 687, 7866,
+	6792, 1019, 2785, 6446, 1504, 1817, 184, 3681, 850, 7703,
+	1703, 6683, 5235, 2274, 4350, 2925, 7411, 2231, 4057, 5207,
+	4535, 5234, 4181, 1242, 1674, 3383, 6613, 1238, 5448, 4881,
+	7860, 1220, 2625, 3991, 6200, 6237, 5300, 7366, 6984, 4908,
+	6908, 4252, 6061, 3782, 4296, 3986, 4797, 7733, 1805, 1595,
+	7604, 594, 5383, 5058, 4814, 4102, 7678, 433, 7809, 8195,
+	1481, 6731, 106, 1096, 7957, 6119, 1292, 2213, 7688, 4686,
+	6350, 7078, 2493, 4569, 2244, 6692, 2610, 7243, 4505, 4718,
+	4056, 3734, 4747, 8120, 7244, 4484, 7151, 7774, 3355, 8270,
+	618, 5089, 5987, 14, 933, 4221, 380, 7657, 6310, 3276,
+	4474, 1400, 8174, 3342, 7432, 6865, 3211, 4063, 654, 2068,
+	3163, 6840, 8346, 8339, 7380, 2101, 345, 6154, 5991, 1169,
+	4547, 1305, 6374, 33, 5362, 4833, 1976, 6796, 3132, 4467,
+	3741, 7810, 6887, 7017, 38, 7720, 3949, 2012, 2585, 1444,
+	1566, 1778, 8279, 7400, 1042, 1609, 3590, 2739, 7847, 6945,
+	2722, 6844, 2500, 2381, 4441, 7692, 2446, 290, 895, 763,
+	6830, 3452, 2187, 6655, 6476, 2186, 24, 2124, 5006, 120,
+	5130, 6773, 1851, 2898, 467, 2362, 7826, 5309, 1680, 8136,
+	4435, 4689, 8393, 5395, 2879, 5149, 6269, 2441, 2159, 293,
+	6046, 6972, 4738, 7825, 4098, 2434, 6176, 5072, 8102, 2284,
+	6755, 1180, 8318, 4829, 3910, 5167, 299, 2523, 1215, 1528,
+	6092, 2256, 287, 2483, 1, 3867, 4624, 270, 1664, 3726,
+	4141, 4889, 7234, 6166, 5247, 1582, 8049, 2314, 7598, 2038,
+	4303, 7129, 4608, 2581, 6715, 6832, 986, 1574, 7910, 7760,
+	5228, 991, 7732, 5272, 2251, 6819, 3537, 4424, 1199, 5367,
+	7136, 943, 7519, 7309, 7181, 3380, 7297, 7641, 6552, 26,
+	7963, 8298, 797, 3079, 3420, 367, 7180, 910, 3694, 8055,
+	3091, 3308, 5111, 8071, 1466, 4026, 2890, 7702, 6768, 5238,
+	2302, 2420, 4142, 2439, 7572, 7469, 4822, 2988, 6324, 4478,
+	3104, 7253, 1442, 1210, 8254, 4611, 2371, 897, 2718, 7416,
+	688, 3540, 4711, 3395, 7761, 6384, 4437, 1016, 7286, 2148,
+	7587, 6208, 8342, 3586, 2554, 8223, 2193, 7715, 972, 3405,
+	230, 256, 6151, 7588, 3258, 259, 1139, 2300, 1340, 7407,
+	6202, 7448, 2505, 2557, 1900, 3274, 255, 712, 7544, 7876,
+	3541, 4335, 3356, 598, 5216, 149, 1706, 3668, 4976, 4880,
+	5127, 7163, 1372, 7067, 40, 5222, 4195, 2184, 4843, 949,
+	7676, 8137, 112, 3603, 3697, 7336, 1241, 2359, 1110, 4091,
+	7460, 3800, 4856, 5449, 3556, 2877, 7567, 7935, 1691, 3803,
+	7936, 4457, 6720, 2331, 1571, 269, 2349, 7212, 3683, 8203,
+	200, 597, 4556, 1644, 4995, 197, 8021, 6634, 5200, 4313,
+	7497, 223, 4226, 4105, 6011, 1584, 498, 6877, 8018, 1013,
+	4679, 6441, 4476, 617, 3002, 2911, 72, 4737, 4323, 2216,
+	119, 4731, 4370, 7200, 605, 849, 3765, 6591, 796, 958,
+	3458, 683, 8384, 2139, 4489, 599, 297, 7087, 806, 8240,
+	3301, 885, 5075, 3891, 8360, 44, 1551, 1764, 2721, 1903,
+	1529, 4198, 3255, 8324, 648, 1600, 863, 4408, 326, 4997,
+	2868, 8383, 4398, 1411, 6981, 1552, 2028, 1191, 7083, 4023,
+	649, 2164, 2383, 737, 6107, 7871, 2108, 608, 3094, 1925,
+	7853, 3687, 5221, 1194, 4168, 5329, 2954, 6238, 7879, 3671,
+	1080, 8237, 3656, 3060, 2190, 6041, 7777, 460, 8155, 6125,
+	130, 3360, 7211, 1668, 4400, 7338, 3589, 3340, 421, 2564,
+	175, 3661, 2084, 3433, 3346, 4428, 7035, 4772, 978, 6115,
+	4075, 4972, 1183, 1375, 4745, 1449, 1290, 1332, 6808, 3714,
+	6158, 3649, 1919, 3729, 3770, 6281, 3561, 5122, 235, 7983,
+	4717, 329, 682, 1850, 4519, 1985, 7435, 2066, 7196, 5347,
+	4337, 2278, 6332, 1057, 3641, 188, 507, 2368, 7633, 4482,
+	4847, 3126, 5117, 1970, 6631, 7442, 2594, 3604, 6667, 6580,
+	4197, 7173, 1737, 4154, 1996, 2400, 2399, 2195, 6661, 3174,
+	2271, 1036, 3826, 1808, 2941, 930, 3583, 2334, 841, 1875,
+	8373, 4649, 6075, 1723, 7385, 7537, 3504, 5064, 2866, 6851,
+	1374, 4237, 7146, 1687, 7998, 454, 5050, 3443, 7292, 1315,
+	6665, 6927, 6039, 784, 2790, 6460, 5414, 1844, 1203, 758,
+	4397, 8389, 3252, 1371, 4202, 6242, 2444, 3639, 7712, 7835,
+	3339, 2991, 2188, 1966, 7529, 4493, 4662, 3449, 804, 4656,
+	16, 6489, 2798, 5173, 4422, 3689, 5219, 4968, 5009, 6905,
+	4414, 8, 7191, 8287, 3416, 1686, 4580, 2266, 3189, 7356,
+	5333, 408, 3384, 8219, 875, 6243, 7093, 8208, 3288, 7143,
+	7573, 1513, 6246, 405, 4275, 5283, 2824, 6931, 7823, 6111,
+	6456, 6659, 3831, 8005, 1923, 8016, 13, 409, 219, 548,
+	7474, 31, 787, 1939, 2917, 4076, 3352, 7399, 2384, 805,
+	870, 7995, 1259, 1868, 7133, 4155, 8108, 7457, 1459, 8150,
+	7893, 2781, 7222, 7456, 6400, 1002, 6578, 1926, 4368, 4191,
+	1671, 1320, 6815, 3425, 3667, 1627, 936, 2219, 1098, 324,
+	3632, 2202, 534, 2602, 4200, 420, 5022, 4419, 1994, 4184,
+	3417, 2268, 4016, 6676, 4395, 7827, 4264, 6168, 8066, 1214,
+	7388, 530, 7770, 7303, 3878, 2953, 3075, 3140, 7489, 1516,
+	3434, 2167, 1007, 6285, 3431, 2165, 613, 7669, 392, 4794,
+	4427, 2002, 4845, 1410, 3769, 6507, 1949, 3797, 592, 398,
+	1804, 7061, 3259, 8321, 874, 7756, 3672, 1423, 3110, 555,
+	8095, 4538, 1599, 6555, 3773, 4261, 5307, 5052, 5266, 3310,
+	6204, 6167, 1363, 6159, 7317, 432, 6509, 6214, 4961, 5378,
+	4011, 1631, 7933, 2676, 3728, 4257, 6900, 6963, 8262, 2507,
+	95, 4946, 8382, 6712, 6296, 7423, 7205, 611, 1122, 6484,
+	4051, 1887, 3031, 1940, 871, 4061, 6445, 2032, 52, 1086,
+	3751, 4525, 5080, 942, 1785, 2463, 8309, 68, 478, 3040,
+	5069, 441, 4447, 1585, 5109, 3123, 6596, 4514, 7691, 7887,
+	6612, 2709, 2737, 2526, 7354, 698, 1225, 4287, 3851, 3014,
+	7945, 4232, 3374, 4982, 2751, 2539, 6863, 6013, 2654, 6561,
+	1280, 4932, 5332, 3884, 6802, 4590, 1438, 1774, 7764, 8083,
+	4610, 1950, 835, 6921, 5184, 2121, 7689, 3872, 8140, 469,
+	6527, 3275, 4926, 1105, 8039, 7069, 4470, 8073, 4906, 1860,
+	362, 713, 5068, 104, 6504, 4544, 6114, 2892, 3727, 6404,
+	7817, 5208, 2086, 2920, 2267, 6225, 1379, 893, 6543, 1339,
+	3427, 5060, 6196, 6273, 7986, 3468, 528, 671, 3952, 1104,
+	3812, 3082, 4799, 1476, 657, 194, 2580, 1059, 7915, 6776,
+	4174, 6210, 7099, 5095, 1082, 4433, 5977, 6043, 6191, 823,
+	1483, 7293, 8310, 7816, 1452, 760, 3307, 1747, 4189, 3945,
+	3335, 3850, 7081, 3973, 3366, 4912, 3806, 6471, 638, 4270,
+	1487, 4695, 6828, 2447, 7118, 7806, 6184, 50, 7670, 4713,
+	6907, 2370, 138, 3125, 3606, 3936, 4756, 4751, 1732, 7591,
+	7418, 7901, 8144, 6235, 6758, 622, 6396, 1983, 182, 828,
+	752, 4103, 273, 4014, 7261, 1597, 209, 4211, 2773, 4090,
+	2767, 723, 6174, 121, 3318, 6338, 272, 7062, 718, 6563,
+	7094, 6713, 847, 3411, 6020, 3532, 186, 6218, 8305, 2708,
+	365, 7681, 6756, 2576, 96, 1443, 4446, 7486, 7147, 1841,
+	694, 3680, 3573, 2959, 543, 2299, 8161, 917, 6280, 3164,
+	4492, 3150, 3507, 2048, 1782, 3038, 7528, 3621, 6568, 6664,
+	717, 2974, 1669, 1063, 2772, 7054, 2040, 18, 5063, 1725,
+	5343, 394, 7942, 8076, 1204, 3235, 8113, 7248, 7, 8249,
+	5110, 1467, 7131, 5137, 369, 7531, 4675, 7694, 6408, 6895,
+	7833, 5394, 1145, 7157, 7775, 4218, 56, 4017, 2289, 878,
+	6129, 1436, 7672, 15, 6680, 6050, 3950, 2098, 2736, 2993,
+	4003, 110, 8234, 6574, 4555, 6035, 6656, 6122, 6790, 6610,
+	5146, 770, 4394, 873, 2965, 4440, 8032, 7231, 3467, 1546,
+	1233, 7898, 7433, 1401, 1488, 7744, 2968, 2880, 883, 7695,
+	6372, 4417, 6278, 7377, 2398, 3415, 6049, 3390, 5026, 6205,
+	131, 601, 1961, 2247, 1932, 7042, 1856, 537, 2694, 2778,
+	4769, 2338, 6982, 1087, 527, 7030, 2151, 6073, 8341, 2076,
+	2367, 4048, 4647, 6644, 164, 8355, 5021, 7148, 375, 730,
+	6054, 1349, 1265, 7639, 5024, 7801, 7164, 3990, 2046, 6368,
+	83, 2339, 8332, 3918, 3495, 7752, 5169, 4668, 5001, 3558,
+	3643, 3788, 8052, 6231, 343, 6729, 1867, 2740, 4646, 1917,
+	7595, 8009, 1088, 5387, 4212, 4078, 2584, 2056, 122, 7110,
+	6250, 7367, 6094, 1603, 1787, 145, 4317, 1657, 5268, 4602,
+	2650, 3934, 1508, 1484, 5010, 7780, 1807, 386, 6520, 2305,
+	7044, 7696, 7168, 6764, 7735, 8302, 6064, 4147, 702, 4481,
+	7758, 3087, 4744, 1929, 1998, 1666, 7183, 997, 590, 3264,
+	1398, 7517, 5453, 5232, 3905, 6031, 4883, 3896, 2884, 3834,
+	7294, 7590, 4094, 3004, 3047, 2927, 313, 3090, 2703, 7856,
+	7685, 2934, 1816, 3121, 2815, 7449, 6502, 2178, 7818, 3890,
+	7636, 6257, 1652, 241, 2414, 1291, 3365, 6688, 3076, 3960,
+	7484, 2332, 2360, 3571, 3813, 1362, 8010, 6592, 4217, 4060,
+	5412, 396, 508, 6399, 3152, 6084, 6134, 2243, 1312, 1307,
+	1837, 6807, 4572, 7857, 2204, 8090, 7436, 6569, 783, 2115,
+	4742, 931, 7346, 4625, 1041, 7566, 46, 1457, 5255, 2734,
+	2407, 7903, 582, 60, 3953, 8293, 462, 1414, 5275, 3403,
+	3214, 609, 4806, 214, 6556, 4328, 85, 4897, 6611, 5261,
+	1965, 7868, 1700, 3238, 1986, 903, 6062, 6821, 7508, 4466,
+	3712, 4690, 296, 6744, 6770, 6643, 6526, 7979, 7659, 7516,
+	4405, 7360, 2364, 3907, 2320, 7050, 1711, 2754, 2949, 1918,
+	8168, 1424, 3954, 6171, 7888, 1920, 8284, 7262, 3044, 7638,
+	8363, 7792, 1822, 3716, 3353, 6687, 1895, 6302, 5440, 7742,
+	3418, 989, 167, 4032, 2143, 1222, 7076, 1394, 2135, 7743,
+	7381, 2074, 840, 1649, 3605, 8103, 6617, 3210, 6294, 6178,
+	4166, 8125, 2389, 97, 2264, 1158, 3946, 1079, 7961, 17,
+	2891, 1578, 233, 2257, 1025, 2786, 8164, 7209, 593, 6961,
+	4559, 7011, 3297, 2928, 8205, 2783, 1741, 7382, 2606, 5210,
+	5408, 7370, 137, 516, 3575, 4852, 5243, 2522, 3501, 2646,
+	2533, 3889, 2551, 3379, 6948, 7341, 5418, 3372, 430, 6067,
+	6834, 8132, 2461, 540, 6763, 7263, 2030, 4471, 472, 3739,
+	1575, 7797, 3984, 7085, 7807, 7236, 1533, 5123, 1748, 1718,
+	6382, 4084, 3413, 3846, 3608, 7125, 1391, 1067, 615, 4354,
+	7070, 1953, 4110, 5193, 739, 3149, 3702, 1619, 4502, 423,
+	7452, 544, 8163, 2738, 8115, 2347, 2183, 1416, 7379, 951,
+	3312, 3412, 8006, 536, 4018, 6363, 3768, 3145, 2011, 7952,
+	5205, 1766, 6993, 1749, 3295, 3057, 7206, 7632, 1605, 1948,
+	2562, 6653, 113, 7156, 1489, 1039, 7392, 6113, 7230, 8372,
+	5370, 2733, 5227, 4999, 2534, 8290, 830, 4750, 481, 5274,
+	7785, 2162, 5337, 996, 1319, 5315, 2744, 7972, 2967, 2906,
+	5171, 610, 5047, 2070, 2914, 3099, 6326, 2490, 5176, 1418,
+	1910, 6044, 6636, 4874, 3799, 1468, 7661, 6953, 116, 4273,
+	7488, 1229, 5416, 1539, 7920, 1557, 3613, 2234, 2418, 8015,
+	466, 3389, 4693, 2957, 5152, 378, 633, 4180, 767, 1149,
+	4863, 5091, 2137, 4866, 5434, 8092, 1989, 3435, 7541, 6772,
+	4561, 3815, 862, 1351, 6820, 1892, 1205, 6554, 2227, 2242,
+	8268, 6856, 2675, 8308, 4743, 2313, 7258, 6883, 8123, 1531,
+	2937, 1081, 304, 2402, 7048, 7034, 8029, 6022, 3478, 4007,
+	3291, 6006, 6614, 3698, 8272, 915, 6173, 4768, 4099, 2214,
+	6678, 3473, 415, 7755, 2310, 6823, 4841, 7608, 3637, 3036,
+	8101, 1676, 5131, 8263, 5385, 3932, 965, 452, 3035, 4714,
+	3283, 6137, 7571, 6918, 6597, 7768, 4472, 3181, 202, 7140,
+	7877, 2572, 2269, 2875, 8105, 7233, 4231, 8210, 2649, 349,
+	6565, 5371, 7710, 1054, 7913, 1982, 3401, 4385, 7731, 3616,
+	1023, 3857, 4374, 5400, 2603, 1440, 7607, 566, 4890, 1417,
+	5327, 1981, 8212, 1270, 3968, 1678, 173, 6849, 8362, 5346,
+	945, 3816, 1009, 7410, 2981, 1522, 7026, 7606, 5397, 884,
+	7885, 144, 1635, 5271, 2475, 5162, 3481, 623, 7906, 6645,
+	5004, 8347, 2034, 4050, 2639, 1501, 6261, 2179, 279, 6577,
+	8179, 6090, 7102, 975, 39, 4377, 4380, 5257, 8128, 6343,
+	2045, 8057, 3369, 7870, 3345, 7043, 1150, 5259, 6814, 5998,
+	1633, 7796, 8204, 1646, 159, 2605, 2658, 6301, 180, 1070,
+	4343, 2285, 659, 2016, 5074, 6745, 7498, 4581, 277, 4088,
+	6077, 1873, 4970, 4774, 1912, 4583, 2806, 6053, 1409, 7799,
+	27, 7454, 772, 2558, 3261, 5016, 7325, 2342, 6557, 6789,
+	1245, 7872, 1190, 1731, 2123, 3623, 6434, 3566, 2388, 8351,
+	7350, 1583, 5978, 8152, 953, 1870, 3861, 7012, 7621, 6698,
+	4917, 2963, 258, 2237, 4246, 2987, 3897, 6780, 4442, 5334,
+	7088, 2212, 1621, 6268, 6015, 3670, 5382, 8008, 30, 1175,
+	3399, 6705, 2024, 2147, 6753, 5312, 7821, 8202, 2374, 7080,
+	6987, 1182, 3285, 3175, 1679, 3615, 1812, 1623, 7940, 6215,
+	5331, 6935, 6964, 4868, 414, 2587, 1879, 2484, 1973, 927,
+	1052, 5330, 399, 1829, 6538, 998, 932, 7502, 2947, 8135,
+	1474, 5118, 1596, 6607, 6472, 7650, 5433, 6914, 7483, 8162,
+	5390, 7177, 2832, 5288, 1392, 2848, 547, 431, 3, 7391,
+	7128, 8291, 626, 6357, 2382, 2800, 1473, 4214, 1308, 5078,
+	3634, 6609, 6852, 6979, 353, 3398, 8173, 1069, 912, 3560,
+	7178, 6188, 7592, 6836, 4508, 6734, 2411, 7124, 1260, 2487,
+	4262, 3496, 1267, 952, 1938, 8146, 7235, 3757, 7727, 1072,
+	8037, 4754, 7326, 7522, 1434, 1030, 6970, 2971, 6874, 1589,
+	8171, 7071, 6295, 3970, 4551, 6824, 2854, 7973, 3695, 2758,
+	6169, 7296, 81, 3876, 6467, 3792, 5033, 7355, 3092, 3505,
+	4300, 265, 6817, 4230, 4835, 3673, 7266, 4341, 5161, 2661,
+	1303, 488, 8197, 1153, 1399, 7375, 4027, 2451, 1654, 5100,
+	170, 4292, 7601, 3523, 7204, 6920, 560, 278, 6689, 8190,
+	6003, 6321, 2050, 2498, 3568, 7027, 1317, 6206, 49, 1743,
+	3645, 2142, 3708, 3832, 773, 509, 6525, 238, 6805, 3652,
+	3530, 4528, 6707, 360, 2510, 2573, 6803, 3388, 7944, 6893,
+	2984, 1306, 7949, 1162, 798, 5002, 2886, 7682, 6691, 2696,
+	4242, 3750, 217, 1408, 3202, 3894, 5396, 3700, 1831, 3244,
+	3081, 4810, 4955, 2663, 1207, 2563, 4667, 6002, 1997, 7824,
+	8002, 1763, 7665, 6216, 1648, 7430, 468, 5121, 7250, 253,
+	6364, 650, 8109, 6406, 7776, 7390, 5099, 5324, 6112, 4024,
+	1156, 3188, 1558, 583, 5197, 6135, 2883, 1456, 1065, 7159,
+	4913, 6959, 1338, 6516, 7277, 1024, 2902, 736, 6492, 7883,
+	1789, 8064, 3043, 6977, 2561, 6298, 7994, 8365, 8357, 2157,
+	6866, 4483, 603, 4140, 7318, 1311, 3199, 4046, 6370, 6258,
+	2480, 118, 437, 7154, 1956, 1202, 5185, 4830, 3471, 6633,
+	4274, 3538, 7494, 554, 3827, 6334, 3980, 5326, 4322, 1186,
+	6417, 2588, 4839, 178, 7600, 7804, 3844, 425, 6182, 3746,
+	2117, 2473, 757, 1714, 7079, 7668, 8065, 1563, 2365, 2472,
+	10, 1622, 4901, 411, 4683, 6710, 5188, 4740, 6825, 1075,
+	5032, 6962, 4849, 704, 5083, 2316, 988, 8072, 4209, 6732,
+	6386, 4813, 1166, 6541, 6939, 604, 8059, 3549, 1188, 473,
+	4392, 571, 514, 800, 5310, 3391, 7815, 1406, 45, 6958,
+	3499, 2014, 4506, 1564, 3404, 6955, 4954, 3387, 4944, 6179,
+	3509, 2710, 1310, 2859, 5279, 6323, 6180, 6110, 8222, 1216,
+	4928, 1532, 2375, 3333, 107, 5186, 2469, 6999, 7130, 743,
+	853, 4053, 1517, 3115, 7465, 337, 5430, 6989, 7330, 5233,
+	6936, 6170, 3703, 2980, 1455, 3450, 21, 5404, 7543, 5336,
+	7371, 3130, 3114, 2644, 3160, 7065, 1430, 6542, 5135, 6621,
+	7403, 3227, 4632, 5446, 1696, 1208, 6719, 735, 3167, 2199,
+	7101, 7462, 8370, 7521, 309, 3205, 2468, 2235, 3134, 4820,
+	573, 6322, 7171, 5316, 3277, 825, 5230, 4681, 5190, 2504,
+	7829, 2328, 6662, 5034, 4920, 7004, 3151, 6784, 8084, 1060,
+	1547, 1859, 8138, 3524, 1865, 4238, 2860, 6219, 1901, 6055,
+	80, 4149, 5196, 3409, 5041, 246, 268, 1941, 8280, 3321,
+	2701, 1955, 108, 6304, 2220, 1735, 6010, 2918, 7340, 5306,
+	2380, 6096, 4172, 2735, 6813, 103, 7562, 4431, 1871, 2111,
+	634, 4654, 3376, 5120, 5138, 6407, 3037, 311, 1114, 4927,
+	6506, 5154, 102, 5349, 389, 4653, 3511, 1806, 207, 969,
+	2519, 4576, 6413, 5237, 3920, 5239, 7503, 2672, 6709, 4239,
+	6190, 894, 448, 3304, 6635, 6701, 218, 4719, 2878, 1614,
+	3422, 1140, 4964, 6587, 1590, 3325, 6916, 2616, 2905, 1846,
+	240, 6872, 4444, 1295, 147, 3839, 7802, 6136, 1330, 6207,
+	3619, 3969, 2194, 3735, 4177, 3385, 410, 4593, 7515, 7347,
+	8314, 518, 3102, 6514, 2177, 4073, 7931, 3097, 2373, 3219,
+	134, 6, 7016, 2450, 7111, 7232, 4375, 2283, 2579, 3506,
+	3955, 8374, 5194, 7005, 3854, 1027, 7123, 7838, 6800, 4148,
+	363, 2047, 8141, 6674, 1425, 3958, 846, 6761, 7327, 5427,
+	1388, 6056, 6598, 720, 1407, 3764, 2683, 4612, 732, 6256,
+	6108, 501, 1402, 6494, 73, 2112, 4342, 7724, 2246, 6937,
+	1791, 6088, 6524, 2306, 1198, 3967, 3578, 1196, 5090, 1751,
+	1869, 2705, 4730, 2379, 6752, 7518, 6783, 7839, 1786, 7545,
+	5338, 3514, 98, 7141, 1681, 3279, 3426, 3246, 1992, 7526,
+	7767, 4655, 2861, 913, 7189, 2103, 3995, 3987, 995, 275,
+	4650, 2358, 4406, 2847, 1815, 1579, 2865, 7723, 7830, 1117,
+	6512, 2479, 2682, 7589, 1471, 4708, 7985, 4144, 2921, 8069,
+	7013, 7135, 7800, 3005, 8080, 4403, 1565, 5220, 1550, 1752,
+	7653, 1221, 5191, 511, 7766, 3000, 6835, 125, 5990, 3553,
+	1754, 6876, 3153, 6444, 3487, 2897, 4951, 7176, 1567, 7851,
+	4052, 904, 970, 8381, 2319, 906, 7311, 2540, 4591, 1889,
+	7554, 6660, 6241, 5976, 6371, 6318, 4861, 2614, 7798, 7468,
+	7149, 135, 2027, 864, 1559, 2863, 6156, 7654, 4480, 3642,
+	376, 1701, 4637, 1010, 4332, 251, 1823, 901, 1085, 3513,
+	5423, 7348, 2689, 7849, 1345, 5224, 6245, 2909, 6499, 8134,
+	7865, 7930, 2804, 4454, 3023, 2629, 7867, 8392, 7298, 3063,
+	1820, 6738, 3349, 232, 7315, 1638, 5126, 2512, 881, 7036,
+	2095, 3814, 6030, 6394, 6139, 679, 2907, 4791, 5345, 4984,
+	1814, 6420, 5025, 3461, 7172, 4919, 5003, 6089, 418, 7520,
+	2871, 3925, 5086, 1421, 1390, 4379, 7471, 929, 6162, 2973,
+	2969, 721, 5354, 4712, 6990, 5245, 7339, 1255, 7332, 5357,
+	7904, 391, 2215, 4128, 8198, 2789, 6307, 3810, 4494, 2727,
+	5204, 632, 7771, 4283, 2036, 7698, 1367, 1588, 6544, 1520,
+	8213, 677, 4413, 1908, 6097, 6468, 6754, 6615, 7198, 213,
+	3490, 2087, 3343, 47, 2726, 2000, 1336, 656, 4247, 584,
+	1155, 4741, 8221, 4204, 4259, 5105, 2904, 2687, 1429, 6700,
+	3242, 2823, 1611, 4518, 7873, 2337, 7553, 6706, 5406, 2088,
+	4124, 7651, 7628, 4126, 1128, 8288, 3300, 3086, 4426, 6601,
+	4971, 1115, 3679, 446, 3168, 3120, 982, 373, 2900, 6293,
+	4694, 6063, 1593, 4915, 2140, 7188, 3596, 8118, 3562, 6299,
+	4786, 4749, 6765, 2097, 4382, 307, 1902, 7984, 4205, 63,
+	740, 7395, 154, 1022, 3041, 589, 5236, 4082, 3022, 924,
+	3748, 6722, 4280, 3457, 7734, 3444, 4522, 2053, 3368, 985,
+	1437, 117, 1493, 1891, 7201, 844, 5174, 58, 2197, 1055,
+	3525, 6774, 7363, 8317, 87, 4940, 1768, 6847, 156, 1090,
+	3213, 6882, 69, 2031, 4030, 4164, 3370, 3921, 5195, 2350,
+	2169, 851, 7795, 3492, 157, 3456, 7793, 7215, 7190, 4812,
+	1326, 2020, 3286, 4219, 2797, 3483, 1934, 2474, 1909, 3928,
+	2008, 4676, 8119, 2544, 4499, 7251, 1091, 7282, 4188, 3223,
+	3010, 8236, 3033, 673, 7279, 1179, 8194, 905, 2296, 1422,
+	3579, 7863, 8122, 7307, 5303, 4636, 4029, 4596, 522, 3050,
+	75, 4367, 1899, 1223, 4498, 6427, 6735, 7055, 5424, 749,
+	6616, 4010, 3709, 3316, 6418, 1781, 6922, 5170, 4138, 1796,
+	1381, 2182, 2807, 2496, 3972, 169, 7568, 2582, 7028, 5201,
+	2224, 4985, 6711, 5270, 7445, 8214, 133, 3084, 4129, 3545,
+	3610, 1369, 7112, 6164, 3323, 6247, 5350, 8030, 8147, 2792,
+	6007, 5156, 8283, 4687, 6486, 7741, 2489, 6923, 2940, 7808,
+	8334, 372, 2238, 7976, 5339, 5014, 1591, 8182, 6058, 4902,
+	5436, 5166, 3287, 1883, 5979, 6481, 1855, 5175, 6967, 708,
+	2065, 7419, 3599, 2356, 315, 2093, 1653, 7487, 3348, 346,
+	6339, 7257, 3922, 4463, 3463, 3551, 2693, 6649, 7352, 658,
+	2161, 824, 1300, 1480, 1980, 7631, 7373, 7929, 2361, 402,
+	248, 2175, 6244, 2205, 4870, 2129, 7328, 5165, 940, 7722,
+	6397, 8142, 6515, 6018, 3171, 2353, 7434, 769, 675, 6279,
+	6186, 2782, 6362, 3438, 179, 1413, 3107, 2855, 2604, 5141,
+	551, 2366, 6369, 7362, 2044, 3539, 3860, 3585, 1134, 4882,
+	7749, 2633, 5374, 7267, 7496, 8184, 7912, 4993, 199, 1078,
+	4021, 667, 2932, 7194, 3923, 3552, 8121, 3587, 7975, 1049,
+	2714, 8089, 4566, 3662, 1056, 4831, 2642, 6199, 7617, 90,
+	8277, 4840, 819, 6694, 4152, 4175, 7791, 5415, 3129, 6637,
+	977, 4672, 2656, 4347, 7187, 1359, 923, 859, 2146, 5019,
+	838, 2083, 7097, 8231, 640, 4568, 4661, 2983, 3254, 1283,
+	5114, 3058, 4432, 1967, 3197, 6149, 6004, 7597, 2160, 1130,
+	1373, 3155, 685, 5328, 66, 2803, 1762, 3006, 1780, 1427,
+	7001, 2916, 5364, 1818, 7968, 6150, 5018, 6892, 2692, 8094,
+	6748, 809, 236, 368, 4507, 4120, 1756, 909, 4192, 5097,
+	141, 4282, 4465, 8166, 6104, 8041, 6901, 1775, 3042, 6431,
+	6276, 3981, 6841, 937, 5437, 3753, 4579, 6267, 424, 4803,
+	4393, 6348, 5158, 1864, 2535, 4626, 2961, 7828, 4229, 3127,
+	5296, 1602, 4485, 577, 5405, 3195, 3666, 6224, 338, 490,
+	3117, 6915, 7947, 1015, 4159, 7862, 6997, 364, 3807, 5997,
+	6383, 2667, 6980, 3350, 2843, 6192, 115, 6848, 5358, 5420,
+	351, 3013, 7413, 8157, 7092, 2896, 6291, 5267, 1357, 6628,
+	2569, 4301, 6630, 249, 4960, 5442, 4545, 7717, 1765, 6331,
+	5304, 1304, 711, 486, 6727, 4978, 2369, 779, 4068, 4511,
+	2141, 6314, 7563, 3292, 7558, 716, 2695, 7965, 3940, 1580,
+	3879, 3351, 7254, 7538, 4929, 211, 332, 3381, 35, 78,
+	1838, 6057, 4685, 5262, 2571, 4532, 3024, 2870, 5177, 6857,
+	4227, 7803, 3674, 2811, 867, 3305, 1888, 3159, 4780, 6366,
+	7185, 4629, 4015, 3178, 2080, 3715, 2745, 4821, 3462, 7358,
+	7138, 3359, 3584, 2657, 3190, 7499, 2423, 6985, 4896, 6859,
+	4334, 6508, 7993, 3908, 7925, 6782, 7167, 7270, 7444, 7874,
+	397, 4996, 6943, 2022, 1942, 4365, 5256, 1803, 5136, 1670,
+	565, 7506, 7281, 8300, 6317, 4670, 1412, 3336, 1783, 6558,
+	4977, 3774, 6260, 2583, 2515, 2301, 8294, 3502, 3247, 922,
+	3314, 3745, 6270, 1244, 6185, 691, 4491, 4816, 6017, 2845,
+	4363, 204, 3581, 2876, 7754, 2673, 7582, 483, 5037, 4348,
+	2276, 920, 2294, 5351, 6465, 295, 8325, 6975, 1915, 8145,
+	2570, 4998, 6517, 6025, 4723, 8369, 2931, 333, 4516, 320,
+	6479, 7667, 5067, 8024, 689, 6573, 6730, 4838, 2009, 4208,
+	751, 4860, 3179, 4240, 2820, 4500, 215, 948, 3629, 5325,
+	2042, 4045, 1364, 6337, 3863, 1793, 4643, 3201, 7192, 7421,
+	6992, 3915, 7757, 4684, 1313, 3198, 637, 3588, 5038, 2634,
+	2899, 6254, 2156, 3835, 4716, 2021, 3394, 2252, 4706, 2698,
+	3455, 3886, 1694, 2315, 5012, 2929, 400, 2091, 8098, 3791,
+	3924, 3625, 789, 5082, 3555, 2952, 8143, 8345, 4266, 6433,
+	7704, 1266, 5368, 1187, 6000, 6726, 292, 5320, 2713, 4241,
+	2415, 7921, 6283, 3319, 1278, 5284, 4648, 283, 7645, 506,
+	6540, 5181, 7896, 3489, 3533, 2936, 4865, 6376, 7477, 4425,
+	3226, 7490, 6878, 4603, 2241, 7150, 54, 1690, 4562, 1810,
+	4645, 6826, 8232, 6751, 2686, 4194, 6838, 2770, 3824, 3809,
+	4900, 6360, 4570, 6228, 434, 5287, 6222, 2013, 1767, 3382,
+	7319, 1572, 3979, 1277, 7144, 7878, 3600, 5429, 6455, 1324,
+	4349, 4362, 1739, 6051, 2354, 7547, 8244, 505, 6545, 7655,
+	8385, 94, 2805, 3569, 1083, 750, 3136, 6124, 1492, 250,
+	1527, 4948, 1173, 3724, 2063, 818, 6891, 2172, 741, 5335,
+	2777, 1405, 7473, 3868, 6387, 450, 3783, 6474, 1297, 1226,
+	29, 6503, 670, 3802, 5145, 3407, 834, 3208, 1993, 2495,
+	2942, 2659, 5381, 7064, 2795, 3500, 1845, 6903, 1112, 6658,
+	6213, 4006, 3338, 191, 2239, 451, 4974, 7660, 2263, 4895,
+	1943, 1000, 4666, 8286, 242, 4848, 4817, 70, 1286, 5359,
+	7447, 1719, 3284, 2700, 4825, 6300, 6926, 1293, 6957, 3184,
+	6320, 6239, 208, 4775, 7841, 3230, 5172, 4005, 726, 5305,
+	2760, 631, 1683, 7642, 3938, 1906, 3548, 1712, 7783, 992,
+	6201, 1068, 3858, 2431, 1486, 531, 7202, 8255, 8186, 6620,
+	2191, 1107, 1062, 8271, 3474, 7491, 1219, 4407, 6766, 3633,
+	1853, 7031, 1843, 3358, 7584, 4594, 526, 2750, 1933, 8111,
+	545, 43, 8048, 1092, 1185, 6409, 4415, 403, 6505, 3855,
+	3182, 4223, 6197, 2521, 2096, 4187, 3367, 4179, 4842, 6375,
+	36, 3147, 6203, 4811, 7223, 6443, 1709, 5258, 6827, 4352,
+	3522, 3758, 6651, 7179, 3911, 7089, 624, 2574, 8336, 4072,
+	3344, 5273, 1537, 8060, 4962, 3317, 1560, 3237, 5211, 1878,
+	1685, 5285, 6038, 6917, 314, 1420, 7032, 5294, 4601, 5295,
+	836, 6946, 4798, 3767, 7458, 5129, 1779, 889, 1142, 8112,
+	6570, 722, 2094, 5277, 2938, 1511, 7166, 1236, 3626, 7831,
+	4306, 2648, 4173, 6490, 7911, 7103, 4340, 6723, 2716, 7260,
+	4641, 5027, 2837, 4546, 1544, 1693, 5054, 5150, 4378, 8075,
+	1987, 6251, 1632, 7221, 848, 892, 3597, 3025, 5209, 4047,
+	8085, 4338, 2109, 1071, 5989, 636, 8131, 2810, 4618, 6078,
+	7658, 6902, 146, 4167, 3574, 3693, 1047, 2405, 6452, 4450,
+	813, 5425, 2443, 4958, 964, 1924, 2403, 2536, 619, 1744,
+	5297, 7059, 2601, 3362, 5282, 4364, 280, 5040, 1370, 5293,
+	312, 6804, 4265, 2345, 3617, 6576, 7625, 8156, 3328, 4243,
+	6211, 2200, 1136, 6069, 5439, 580, 8019, 303, 2550, 4455,
+	7514, 4671, 3324, 4384, 3547, 4277, 8158, 4034, 3329, 6423,
+	1753, 627, 3550, 7687, 1650, 7970, 6085, 335, 5081, 1296,
+	4092, 2828, 2035, 1465, 7822, 3053, 3784, 7000, 7046, 7586,
+	2553, 406, 6233, 2346, 3234, 6329, 7527, 3916, 4923, 6717,
+	8036, 1523, 6333, 1758, 553, 6944, 358, 6778, 2678, 224,
+	6483, 4710, 519, 661, 190, 3957, 3191, 1264, 1485, 3901,
+	7276, 3723, 1905, 2763, 2019, 642, 5451, 4724, 339, 3688,
+	3400, 1592, 3070, 1032, 2956, 7217, 1143, 6436, 239, 1665,
+	7412, 3888, 5372, 6973, 4145, 3720, 429, 8367, 2889, 6693,
+	710, 4357, 4326, 2943, 2130, 2834, 5212, 4117, 1659, 4808,
+	2730, 2874, 7693, 3974, 5148, 7619, 4599, 4871, 7121, 7647,
+	6450, 8218, 8151, 6024, 7875, 105, 7814, 7953, 1726, 1377,
+	6060, 3985, 4269, 6627,
+};
+static const int iso639_3_bylang_disp[2625] = {
+	0, -42, 2, -66, 1, 2, 0, 49, 2, -72,
+	34, -80, 32, 7, 12, 9, 5, 3, 2, 2,
+	0, 7, 2, 13, 6, 35, 1, 13, 13, 1,
+	6, 7, 27, 4, 25, 11, 27, -90, 13, 0,
+	7, 37, -100, 1, 1, 0, 5, 4, 1, 3,
+	17, 14, 3, 9, 41, 5, 26, -109, 27, 48,
+	1, 6, 13, 0, 1, 1, 2, 0, 7, 2,
+	8, -113, 7, 6, 2, 1, 2, 1, 6, -127,
+	2, 17, 1, 6, 27, 2, 25, 19, 7, 1,
+	8, -156, -171, 2, 51, 7, 26, 14, 30, 1,
+	15, -173, 10, 3, 21, 9, 23, 6, 6, 0,
+	12, 6, 19, 1, 10, 23, 7, 3, 1, 1,
+	6, 2, -182, 1, 15, 24, 6, 2, 15, 3,
+	61, 22, 4, 4, 54, 5, 11, 31, 13, 1,
+	2, 1, -199, 22, 3, 8, 8, 1, 52, 0,
+	85, 2, 1, 32, 23, 6, 1, 4, -200, -213,
+	-233, -236, 3, 0, 4, 1, -265, 10, 5, 20,
+	1, -280, -292, 20, -306, 34, 4, 2, 3, 60,
+	1, 11, 10, 16, 13, 1, -322, 7, 48, 19,
+	8, 85, -327, 1, 14, 1, 4, 18, 22, 17,
+	1, 5, 1, 3, -355, 11, 5, -362, 5, 4,
+	6, 1, 40, -401, 0, 10, 1, 6, 4, 39,
+	4, -463, -490, 6, -530, 4, 9, 3, 24, 1,
+	38, 7, 19, 1, 33, 3, 4, 5, 1, 0,
+	0, 14, 45, 1, 19, 1, 13, 1, 32, 27,
+	4, 1, 0, 1, 4, 10, 1, 9, -570, 2,
+	1, 0, 4, 16, 3, 14, 7, 1, 73, 11,
+	12, 4, 3, 8, 2, 3, 3, -575, 1, 5,
+	64, 7, 27, -581, 1, 8, 5, 1, 6, 28,
+	27, 7, 7, 11, 4, 3, 1, 5, 18, 2,
+	88, 2, 7, 5, 67, -582, 0, 12, 0, 4,
+	-583, 9, 6, 1, -590, 6, -617, -622, 5, 2,
+	2, 0, 14, 1, 52, -699, 24, 8, 4, -720,
+	-723, 17, 15, 0, 5, 1, -742, 9, 27, 2,
+	-771, 2, 33, 1, 1, 5, 18, 5, 29, 1,
+	1, 3, -809, 7, 13, 9, 10, 1, 15, 2,
+	-817, 3, 2, 15, 5, 3, 0, 8, 65, 12,
+	9, -821, 60, 0, 1, -846, 4, 5, 7, 0,
+	5, -854, 17, -906, -916, 1, -924, 6, 1, 5,
+	0, 1, 0, 0, 17, 33, 2, 2, 2, 1,
+	3, 4, 10, 24, -927, 1, 25, 34, 0, 0,
+	-930, 6, 4, 7, 0, 1, 14, 5, -949, 2,
+	42, 1, 0, 12, 5, 1, 1, 1, -971, 2,
+	63, 9, 13, 7, -999, 4, 3, 1, 25, 8,
+	5, 44, -1004, 0, 5, 2, -1015, 3, -1017, 5,
+	49, 8, -1021, 2, 3, 41, 10, 5, 14, 18,
+	16, 3, 4, 15, 18, 0, -1075, 0, 33, 10,
+	20, 3, -1088, 4, 1, 9, 1, -1108, 17, 7,
+	8, 14, 7, 12, 29, 70, 6, 1, 2, -1109,
+	18, 1, 1, 5, 27, -1123, -1147, 2, 9, 2,
+	7, 5, 54, 3, 22, 8, 11, 10, -1154, 12,
+	3, -1162, 15, 29, 1, 4, -1186, 32, 1, 1,
+	23, 3, 49, 1, 2, 79, 58, 63, 16, 1,
+	4, 4, 51, -1196, 62, 1, 25, -1198, 4, 1,
+	68, 53, 4, 1, 19, -1208, 81, 18, 0, 1,
+	10, 1, 10, 20, 2, 2, 49, 7, 5, 2,
+	7, 7, 0, 165, 6, 15, -1220, 1, -1304, 12,
+	-1339, -1345, 8, 11, -1354, 4, 12, 16, -1387, 4,
+	8, 20, -1389, -1405, 6, 16, 32, 2, 28, 6,
+	4, 11, -1411, 1, 192, -1415, -1441, 2, -1496, 0,
+	4, 2, 4, 1, 25, 47, 15, 4, 45, 22,
+	1, 6, 11, 0, 53, 10, 1, 15, 8, -1532,
+	61, 2, 11, -1578, 1, 1, 42, 1, 17, 1,
+	18, 57, 40, 1, 0, -1620, 18, 2, -1627, 50,
+	-1647, 54, 9, 1, -1666, -1673, 1, 2, 3, 37,
+	66, 1, 32, 2, 3, 4, 35, 25, 9, 7,
+	34, 1, -1674, 0, 5, 9, -1726, 2, 6, 16,
+	-1776, 19, -1782, -1793, 2, 11, 25, 12, 33, 41,
+	6, 4, 28, 4, 3, -1799, 10, -1809, 7, 5,
+	99, 87, 0, 32, 1, 35, 37, 14, 13, 2,
+	80, 5, 89, 19, 2, 4, 5, -1815, 4, 2,
+	5, -1848, 62, 0, 120, 18, 0, 83, 12, 9,
+	20, 83, -1873, 0, -1908, 6, 27, -1936, -1937, -1957,
+	8, 0, 3, 45, 42, 3, 12, 0, 4, 43,
+	1, 4, 145, 8, 1, 2, -1963, 1, 3, 14,
+	5, 17, 2, 64, 34, 15, 13, -1987, -2013, -2086,
+	1, 5, -2095, 3, 1, -2097, 28, 26, 1, 9,
+	1, 4, 2, 178, 1, -2105, 18, 5, 13, 75,
+	32, 15, 14, 8, -2106, 70, 2, 26, 7, 4,
+	2, -2119, 2, 6, 10, 48, 1, 16, 23, 11,
+	6, 66, -2260, 8, -2291, 2, 9, 0, -2293, 0,
+	-2307, -2311, 14, 7, -2327, 11, 42, 9, -2369, -2372,
+	5, 30, 28, -2397, -2407, 14, 11, 1, 2, 10,
+	6, 2, 15, 6, 2, 4, 2, -2443, 59, 0,
+	8, 29, 2, 52, 0, 4, -2446, 82, 2, 47,
+	0, 33, 105, 14, 39, 20, 23, 65, 29, -2450,
+	75, 0, 11, 1, 23, 22, 1, -2456, 33, 90,
+	254, 3, 12, 80, 18, 0, 22, 3, 2, 5,
+	1, 29, -2478, 72, 41, 28, 1, -2537, 6, 30,
+	75, 36, 1, 17, 10, 1, -2563, -2573, 34, 13,
+	-2653, 3, 1, 8, 35, 30, 28, 43, 16, -2658,
+	6, 15, 1, 6, 2, 1, 44, 4, 13, -2677,
+	65, 56, 14, 0, 2, 2, 5, 56, 40, 31,
+	-2693, 2, 6, 11, 23, 8, 2, 4, 76, 3,
+	9, 10, 8, -2715, 177, 25, -2779, 40, 17, 4,
+	15, 51, 2, 13, 0, 24, 85, 1, 23, 23,
+	0, 1, 58, 51, 17, -2782, 22, 17, 9, 47,
+	10, 6, 34, 44, -2798, 0, 59, 7, -2807, 1,
+	18, 16, 25, 180, 54, 3, 6, -2872, 9, 0,
+	17, 1, 12, 5, 1, 5, 2, 1, 45, 16,
+	1, 5, -2885, -2888, 2, 15, -2928, 0, 3, 4,
+	31, 7, 2, 13, -2930, 46, 67, 160, 21, 2,
+	60, 20, 116, 1, 24, 33, 1, 2, 17, 3,
+	0, 0, 9, 48, 10, -2936, 1, 18, 8, 1,
+	24, 0, 6, 72, 0, 19, -2947, 8, 12, 64,
+	-2971, 7, 14, 13, 37, 6, 60, 6, -2982, 41,
+	108, 4, 14, 2, 12, 14, -3001, -3008, 9, 12,
+	3, 30, 1, 20, 23, -3098, 28, 1, 112, 1,
+	54, 50, -3110, 13, -3120, 17, -3178, 34, 6, 12,
+	2, 9, 36, 5, 16, -3188, 18, 9, 96, 0,
+	1, 0, 60, 21, -3189, 30, 1, 12, 50, 16,
+	8, 25, 7, 57, 5, 90, -3196, 6, 20, 0,
+	32, 43, 12, 10, 6, 7, 58, 73, 38, 2,
+	42, 24, 234, 38, -3215, -3261, 4, 42, -3264, -3272,
+	47, -3287, 0, 8, 2, 54, 2, 13, 74, 6,
+	38, 5, 6, 8, 102, 22, 3, 9, 150, -3292,
+	1, 0, -3305, -3333, 17, 1, 19, 4, 21, 2,
+	0, 3, 0, 5, 1, 10, 64, 33, 7, 6,
+	11, -3362, -3430, 1, 40, 69, 13, 5, 8, 2,
+	4, 13, -3446, -3450, 5, 68, 1, -3459, 1, -3471,
+	15, 116, 15, 26, 1, 31, -3498, 1, 23, -3509,
+	48, 42, 3, 35, -3532, 10, 0, 1, 37, 3,
+	25, 82, 8, 6, 0, 73, 31, 77, 113, 10,
+	-3533, 48, 2, -3534, 11, 13, 23, 26, 6, -3544,
+	1, 37, 14, 43, 83, 14, 15, 244, -3553, 63,
+	1, 3, 92, 2, -3555, 1, 53, -3560, 71, 1,
+	0, 80, 16, 5, 36, -3630, 94, 5, -3636, 24,
+	-3669, 2, 6, 2, 3, 14, -3672, -3696, 4, -3723,
+	-3724, 2, 41, 22, -3726, 8, 13, 5, 1, 64,
+	67, -3735, 44, 23, 9, 17, 1, 58, 6, 43,
+	2, 4, 1, 6, 44, -3742, -3762, -3773, -3779, -3784,
+	-3808, 24, -3816, 50, -3822, 3, 5, 0, -3825, 0,
+	29, 6, 15, 112, 3, 49, 1, 4, 67, 1,
+	1, 69, -3828, 31, 1, 2, 1, 0, 16, -3841,
+	5, 2, 1, 42, 2, 1, 26, -3859, 2, -3879,
+	4, 40, 9, 3, 5, 4, 10, 118, 74, 28,
+	5, 1, 136, 2, 14, 7, 24, 33, 0, 37,
+	36, 2, -3882, 5, 53, -3898, 149, 2, 75, 7,
+	38, 2, -3924, 1, 97, 85, 13, 0, -3932, 86,
+	0, 28, 18, 132, 1, 18, 39, 5, 90, 18,
+	4, 39, 261, 11, -3965, 115, 30, 16, 6, 1,
+	25, 11, 250, -4004, 24, -4024, 78, 48, 24, 25,
+	1, 1, -4026, 0, 38, 3, 1, -4028, -4045, 5,
+	7, -4052, 7, 106, 137, 7, 13, 56, 19, 43,
+	4, 2, 74, 14, 14, 5, -4069, 101, 82, 1,
+	3, 6, 2, 43, 47, 6, 1, 56, -4078, 8,
+	-4088, 1, 28, -4090, 1, 3, 54, 2, 6, 4,
+	2, 6, 1, 1, 1, 2, 13, 3, 3, 1,
+	104, 9, 202, 26, 6, -4136, 41, 1, 32, 9,
+	-4208, 30, 19, 219, 2, 12, 105, 3, 1, 23,
+	1, 3, 143, -4247, 21, 22, 54, 60, 1, 4,
+	4, 127, 77, 2, 0, 0, 29, 15, 8, -4259,
+	136, 5, 2, 23, 1, 3, 24, -4288, 250, -4304,
+	9, 154, 24, 13, -4328, -4355, 50, 1, 26, 8,
+	106, 38, 2, 15, 82, 63, 474, 4, 26, -4433,
+	0, 1, 10, 92, -4546, 2, -4557, -4573, 1, 30,
+	5, 72, 1, 28, -4579, 3, 20, 65, -4604, 1,
+	22, 7, 0, 16, 18, 53, 0, 12, 75, 133,
+	55, -4625, 77, 169, 0, 24, 105, 423, 73, -4659,
+	1, -4665, 44, 16, 8, 18, 1, 8, 1, 23,
+	-4683, 73, 425, 40, 4, 4, 1, 28, 149, -4693,
+	-4749, 50, 119, 322, 34, 7, 62, 1, 8, 4,
+	140, -4750, -4753, 102, 29, 148, 3, 32, 1, 28,
+	17, 6, 1, 3, 48, 1, -4798, 10, 6, 18,
+	3, 1, 41, 4, 49, 1, 1, 4, 39, 31,
+	7, 13, 8, 1, 12, 8, 3, -4802, 198, 52,
+	-4851, 2, 34, 43, 1, 59, -4858, -4863, 99, 3,
+	58, 4, 346, 6, 3, 9, 6, 134, 35, 89,
+	0, 55, 4, 4, 4, 87, 1, 9, 240, 2,
+	-4864, 90, 120, 15, 68, 9, 1, 54, 4, 138,
+	53, -4872, 190, 33, 6, 43, 8, 95, 26, -4894,
+	1, 25, 5, -4917, 27, 299, -4929, 321, 275, 3,
+	36, 30, 4, -4962, 110, 2, 145, 0, 272, 58,
+	0, -4969, 14, 2, 14, 5, -4984, -4985, 1, 2,
+	8, 15, 9, 28, 188, 11, 15, 3, 2, 20,
+	3, 40, 50, 185, 169, 374, 14, 0, 18, 26,
+	14, 29, 41, 125, 87, 42, 1, 6, 38, 16,
+	13, 17, -5021, 4, 1, 132, -5060, -5069, 60, 6,
+	15, 13, 7, -5079, 10, 0, 44, 2, 95, -5129,
+	27, 16, 46, -5187, -5188, 1, -5190, 160, 2, 6,
+	44, 3, 105, 6, 11, 108, -5209, 38, 18, 103,
+	3, 36, 44, 79, 10, 90, -5270, -5291, 70, 6,
+	2, 107, -5304, -5336, -5338, 6, 30, -5363, 49, 1,
+	39, 19, 138, 5, 36, 42, 25, -5389, 18, 44,
+	-5397, 1, 12, 35, 70, 52, 2, -5413, 13, 2,
+	86, 0, 85, 45, -5451, 89, 1, 0, -5455, 69,
+	48, 3, 20, 30, 102, 8, 1, 89, 10, 34,
+	175, 5, 19, -5460, 13, 44, 16, 6, 0, 18,
+	0, 170, 276, -5534, 11, 1, 40, 3, 112, 70,
+	2, 104, -5537, 2, 228, 116, 12, 10, 108, 26,
+	2, 7, 36, -5579, 35, 2, 1, -5584, 2, -5627,
+	-5638, 562, 145, 1, 112, 1, -5685, 40, -5687, 3,
+	29, 10, 5, -5693, -5702, 32, 1, 53, 135, 1,
+	36, 37, 17, 1, 3, -5732, 3, 1, 2, 48,
+	0, -5775, 118, -5787, -5810, 12, 111, 169, -5838, -5841,
+	19, -5851, 3, -5863, 157, -5872, 79, 12, -5885, -5918,
+	50, 57, 1, 5, -5947, 25, 67, 84, 193, -5996,
+	43, 144, 3, 53, 94, 33, 28, 1, 76, 8,
+	1, 3, 77, 117, 2, 19, 34, 205, 53, 39,
+	187, 7, 27, 1, 4, 28, -6005, 51, 7, 12,
+	-6020, -6030, 92, 16, 53, 189, 7, 128, -6031, 7,
+	191, 163, 129, 15, 4, 56, 7, -6066, -6085, 2,
+	59, 217, 5, 10, -6143, 1, 0, 296, 0, 42,
+	21, 21, 39, 109, 50, 214, 9, 280, 30, 1,
+	1, 29, 8, 1, 19, 24, 81, 1, 38, 33,
+	-6155, 20, 2, -6173, 21, 2, -6183, 3, 82, 33,
+	117, 3, 39, 60, 6, 27, 2, 67, 62, 38,
+	27, -6192, 6, 1, 5, 73, 121, 7, 53, 1,
+	68, 27, 48, 11, 71, 2, 165, 4, 61, 51,
+	582, 60, -6216, 1, 0, 58, 50, 189, 2, 4,
+	229, -6256, 24, 0, 84, 6, 250, 54, 76, 9,
+	15, 0, -6262, 7, 135, 36, 6, 130, 154, 18,
+	2, 0, 2, -6278, 30, 1, 25, 0, 106, 48,
+	-6286, 134, -6292, 3, 0, 3, -6355, 36, 3, 69,
+	164, 8, 1, 19, 0, 112, -6359, 3, 115, 359,
+	20, 628, 0, 54, 1, 39, 14, -6377, -6395, 57,
+	-6406, 82, 43, 1, 5, 1, 3, -6439, 0, 4,
+	5, 3, 2, -6448, 2, -6467, 34, 147, 3, 182,
+	205, 6, 24, 94, 25, 139, -6478, 8, 15, 0,
+	16, 19, 36, 129, 393, -6499, 83, 19, 50, 25,
+	0, 1, 10, 38, 95, 15, 123, 135, 50, 5,
+	20, -6504, 56, 100, 3, 311, 121, 11, 139, 11,
+	348, 48, 1, -6507, 165, 147, 48, 1, 0, -6514,
+	7, 146, 44, 47, 49, 30, 301, 26, 75, 0,
+	-6526, 0, 54, 196, 142, 6, 47, 10, 21, -6544,
+	202, -6558, 25, 1, -6568, 4, 107, 254, 49, 189,
+	-6577, 50, 43, 41, 37, 5, 41, 75, -6616, 0,
+	164, 437, 28, 241, -6654, 425, 80, -6680, 286, 7,
+	69, 168, 7, 49, 44, 20, 7, 0, 5, 8,
+	119, 1, 252, 38, 154, 216, 35, 0, -6759, -6761,
+	43, 124, 26, -6762, -6783, -6825, 13, 110, 11, -6869,
+	23, 26, 233, 46, 8, 64, 137, -6873, 24, 101,
+	4, 273, 183, 4, 28, 189, 91, 138, 2, -6888,
+	0, 98, 0, 28, 315, 184, 38, 5, 42, 1,
+	24, 86, 88, 20, 91, -6940, 0, -6957, 91, 44,
+	3, -6980, 159, 79, 5, 130, 213, 3, 14, 3,
+	14, 0, 1, 36, 56, -6988, 196, 1, 1290, -6992,
+	-6994, 818, 430, 204, 56, 27, -7018, -7023, 2, 1,
+	27, 46, 0, -7050, 163, 129, 574, 2, 19, 17,
+	11, 0, -7093, -7125, 19, 18, 34, 42, 249, 84,
+	105, 9, -7141, 6, 54, 2, 0, -7148, -7186, -7247,
+	2, 4, 714, 1, 10, 8, 24, 78, -7291, 137,
+	6, 4, 19, 4, 225, 147, 1090, 17, 34, 0,
+	1, 426, 78, 16, 438, 10, 429, 100, 56, 15,
+	51, 140, 30, 5, 106, 12, 74, 210, 314, 78,
+	-7295, 21, -7296, -7301, 1, 27, 104, 10, -7321, -7323,
+	6, -7326, 4, 1, 105, 16, 0, 5, 14, 20,
+	-7340, 32, 1, -7357, 96, 11, -7428, -7435, 109, 59,
+	40, 10, -7439, -7441, 1, -7446, 37, 71, 14, 3,
+	174, 243, 24, 0, 27, 29, 258, 56, -7461, 143,
+	10, 342, 732, -7472, 93, 118, 207, 9, 629, 617,
+	0, 1, 302, 149, 479, 100, 508, 1270, 172, 39,
+	1, 369, 29, 259, 1, 146, 41, 50, -7474, 122,
+	309, 28, 2, 338, 154, 233, 511, 65, 115, 2,
+	8, 1, 110, 241, -7478, 134, 6, 1, -7485, 0,
+	457, 108, 7, 11, 512, 125, 9, 1, -7487, 5,
+	23, 398, -7516, 5, 62, -7536, 19, 36, 21, 20,
+	330, 186, 154, 24, 285, 0, 109, 1007, 660, -7537,
+	1, -7587, -7601, 220, -7603, -7605, 105, 22, 614, 0,
+	1, -7734, 130, 51, 210, 24, 15, 510, 0, 41,
+	-7742, 44, -7749, 16, 53, 116, -7806, 2, 375, 696,
+	-7830, -7839, 6, 219, -7868, 0, 17, 256, 7, 906,
+	52, 10, 22, 1, 14,
+};
+static const mph iso639_3_bylang_hash = { 7874, 2625, iso639_3_bylang_disp, MPH_NOCASE };
+
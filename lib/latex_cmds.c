@@ -0,0 +1,54 @@
+/* 22 keys, generated by bldhash/mph_table; do not edit. */
+static const char *latex_cmds_keys[22] = {
+	"ln",
+	"textit",
+	"texttt",
+	"url",
+	"sin",
+	"textsf",
+	"emph",
+	"bf",
+	"small",
+	"rm",
+	"mbox",
+	"textrm",
+	"mkbibquote",
+	"textsl",
+	"LaTeX",
+	"mathrm",
+	"textbf",
+	"em",
+	"cos",
+	"it",
+	"textsc",
+	"tan",
+};
+static const latex_cmd latex_cmds_values[22] = {
+	{ LATEX_CMD_TEXT | LATEX_CMD_MATH, "ln" },
+	{ LATEX_CMD_TEXT, NULL },
+	{ LATEX_CMD_TEXT, NULL },
+	{ LATEX_CMD_TEXT, NULL },
+	{ LATEX_CMD_TEXT | LATEX_CMD_MATH, "sin" },
+	{ LATEX_CMD_TEXT, NULL },
+	{ LATEX_CMD_TEXT, NULL },
+	{ LATEX_CMD_TEXT, NULL },
+	{ LATEX_CMD_TEXT, NULL },
+	{ LATEX_CMD_MATH, "" },
+	{ LATEX_CMD_TEXT, NULL },
+	{ LATEX_CMD_TEXT, NULL },
+	{ LATEX_CMD_TEXT, NULL },
+	{ LATEX_CMD_TEXT, NULL },
+	{ LATEX_CMD_MATH, "LaTeX" },
+	{ LATEX_CMD_MATH, "" },
+	{ LATEX_CMD_TEXT, NULL },
+	{ LATEX_CMD_TEXT, NULL },
+	{ LATEX_CMD_TEXT | LATEX_CMD_MATH, "cos" },
+	{ LATEX_CMD_TEXT, NULL },
+	{ LATEX_CMD_TEXT, NULL },
+	{ LATEX_CMD_TEXT | LATEX_CMD_MATH, "tan" },
+};
+static const int latex_cmds_disp[8] = {
+	1, 7, 17, -6, 3, 73, 3, -16,
+};
+static const mph latex_cmds_hash = { 22, 8, latex_cmds_disp, MPH_CASE };
+
@@ -13,328 +13,195 @@
 #include <string.h>
 #include "bibdefs.h"
 #include "is_ws.h"
+#include "mph.h"
 #include "latex_parse.h"
 
-typedef struct latex_node {
-	struct latex_edge *next_edge;
-	struct latex_node *down_node;
-} latex_node;
+/*
+ * LaTeX commands that are dropped or rewritten, in latex_cmds.c as
+ * generated by bldhash/mph_table from bldhash/latex_cmds.txt
+ *
+ * LATEX_CMD_TEXT: text markup, "\it ABC" -> "ABC" and "\it{ABC}" -> "ABC"
+ * LATEX_CMD_MATH: "\sin" -> "sin", "\mathrm" -> "", also as a prefix
+ */
+#define LATEX_CMD_TEXT (1)
+#define LATEX_CMD_MATH (2)
 
-typedef struct latex_edge {
-	struct latex_node *next_node;
-	str text;
-} latex_edge;
+typedef struct latex_cmd {
+	int         flags;
+	const char *replace;
+} latex_cmd;
 
-static latex_edge *
-latex_edge_new( void )
-{
-	latex_edge *e;
-	e = ( latex_edge * ) calloc( 1, sizeof( latex_edge ) );
-	if ( e ) str_init( &(e->text) );
-	return e;
-}
+#define LATEX_CMD_MAXLEN (10)
 
-static void
-latex_edge_delete( latex_edge *e )
+#include "latex_cmds.c"
+
+static const latex_cmd *
+latex_cmd_find( const char *p, unsigned long len, int flags )
 {
-	str_free( &(e->text) );
-	free( e );
+	const char *name;
+	unsigned int n;
+
+	if ( len==0 || len > LATEX_CMD_MAXLEN ) return NULL;
+
+	n = mph_slotn( &latex_cmds_hash, p, len );
+	name = latex_cmds_keys[n];
+	if ( strncmp( name, p, len ) || name[len]!='\0' ) return NULL;
+	if ( !( latex_cmds_values[n].flags & flags ) ) return NULL;
+
+	return &( latex_cmds_values[n] );
 }
 
-static latex_node *
-latex_node_new( void )
+static unsigned long
+latex_cmd_namelen( const char *p )
 {
-	return ( latex_node * ) calloc( 1, sizeof( latex_node ) );
+	unsigned long n = 0;
+	while ( ( p[n]>='a' && p[n]<='z' ) || ( p[n]>='A' && p[n]<='Z' ) ) n++;
+	return n;
 }
 
+/* latex_addchar()
+ *
+ * Runs of spaces in the output collapse to one.
+ */
 static void
-latex_node_delete( latex_node *n )
+latex_addchar( str *out, char c )
 {
-	if ( n ) {
-		if ( n->down_node ) {
-			latex_node_delete( n->down_node );
-		}
-		if ( n->next_edge ) {
-			latex_node_delete( n->next_edge->next_node );
-			latex_edge_delete( n->next_edge );
-		}
-		free( n );
-	}
+	if ( c==' ' && out->len && out->data[ out->len-1 ]==' ' ) return;
+	str_addchar( out, c );
 }
 
-static int
-is_unescaped( char *p, unsigned long *offset, char c )
+/* latex_cat_segment()
+ *
+ * Clean the text between two braces (or math shifts) into out.
+ *
+ * A segment ending in a markup command, "ABC \it" from "ABC \it{DEF}",
+ * loses the command and keeps any other "\it " markup; otherwise every
+ * "\it " goes. Math functions are rewritten either way.
+ */
+static void
+latex_cat_segment( str *out, str *seg )
 {
-	if ( *p!=c ) return 0;
-	if ( *offset > 0 && *(p-1)=='\\' ) return 0;
-	return 1;
-}
+	unsigned long i, n, m, len = seg->len;
+	const latex_cmd *cmd;
+	int textcmds = 1;
+	char *p, *q;
 
-static int
-build_latex_graph_r( str *in, unsigned long *offset, int *mathmode, int depth, latex_node **node )
-{
-	latex_node *newnode, *downnode;
-	int status = BIBL_OK;
-	latex_edge *newedge;
-	char *p;
-
-	newnode = latex_node_new();
-	if ( !newnode ) return BIBL_ERR_MEMERR;
-
-	newedge = latex_edge_new();
-	if ( !newedge ) {
-		latex_node_delete( newnode );
-		return BIBL_ERR_MEMERR;
-	}
+	if ( len==0 ) return;
 
-	*node = newnode;
-
-	newnode->next_edge = newedge;
-
-	p = str_cstr( in ) + *offset;
-
-	while ( *p ) {
-		if ( is_unescaped( p, offset, '{' ) ) {
-			*offset += 1;
-			newnode = latex_node_new();
-			if ( !newnode ) { status = BIBL_ERR_MEMERR; goto out; }
-			newedge->next_node = newnode;
-			newedge = latex_edge_new();
-			if ( !newedge ) { status = BIBL_ERR_MEMERR; goto out; }
-			newnode->next_edge = newedge;
-			status = build_latex_graph_r( in, offset, mathmode, depth+1, &downnode );
-			if ( status!=BIBL_OK ) goto out;
-			newnode->down_node = downnode;
-			p = str_cstr( in ) + *offset;
-		}
-		else if ( is_unescaped( p, offset, '}' ) ) {
-			*offset += 1;
-			if ( depth==0 ) {
-				fprintf( stderr, "Unmatched '}' character in LaTeX encoding '%s'.\n", str_cstr( in ) );
-				p++;
-				continue;
-			}
-			goto out;
-		}
-		else if ( is_unescaped( p, offset, '$' ) ) {
-			*mathmode = !(*mathmode);
-			*offset += 1;
-			if ( *mathmode ) {
-				newnode = latex_node_new();
-				if ( !newnode ) { status = BIBL_ERR_MEMERR; goto out; }
-				newedge->next_node = newnode;
-				newedge = latex_edge_new();
-				if ( !newedge ) { status = BIBL_ERR_MEMERR; goto out; }
-				newnode->next_edge = newedge;
-				status = build_latex_graph_r( in, offset, mathmode, depth+1, &downnode );
-				if ( status!=BIBL_OK ) goto out;
-				newnode->down_node = downnode;
-				p = str_cstr( in ) + *offset;
-			}
-			else {
-				if ( depth==0 ) {
-					fprintf( stderr, "Unmatched '$' character in LaTeX encoding '%s'.\n", str_cstr( in ) );
-					p++;
-					continue;
-				}
-				goto out;
-			}
-		}
-		else {
-			str_addchar( &(newedge->text), *p );
-			p++;
-			*offset += 1;
-		}
-	}
+	p = str_cstr( seg );
 
-	if ( depth!=0 ) {
-		fprintf( stderr, "Unmatched '{' character in LaTeX encoding '%s'.\n", str_cstr( in ) );
+	q = strrchr( p, '\\' );
+	if ( q && latex_cmd_find( q+1, len - ( q+1-p ), LATEX_CMD_TEXT ) ) {
+		len = q - p;
+		textcmds = 0;
 	}
 
-out:
-	if ( status!=BIBL_OK || str_memerr( &(newedge->text) ) ) {
-		latex_node_delete( *node );
-		*node = NULL;
-		return BIBL_ERR_MEMERR;
-	}
+	i = 0;
+	while ( i < len ) {
 
-	return BIBL_OK;
-}
+		if ( p[i]!='\\' ) {
+			latex_addchar( out, p[i++] );
+			continue;
+		}
 
-int
-build_latex_graph( str *in, latex_node **start )
-{
-	unsigned long offset = 0;
-	int mathmode = 0;
-	
-	return build_latex_graph_r( in, &offset, &mathmode, 0, start );
-}
+		n = latex_cmd_namelen( p+i+1 );
+		if ( i+1+n > len ) n = len - i - 1;
 
-typedef struct {
-	const char *wbracket;
-	int wbracketsize;
-	const char *wobracket;
-	const char *toreplace;
-} latex_cmds_t;
-
-static const latex_cmds_t latex_cmds[] = {
-	{ "\\it",     3, "\\it ",     NULL },
-	{ "\\em",     3, "\\em ",     NULL },
-	{ "\\bf",     3, "\\bf ",     NULL },
-	{ "\\small",  6, "\\small ",  NULL },
-	/* 'textcomp' annotations */
-	{ "\\textit", 7, "\\textit ", NULL },
-	{ "\\textbf", 7, "\\textbf ", NULL },
-	{ "\\textrm", 7, "\\textrm ", NULL },
-	{ "\\textsl", 7, "\\textsl ", NULL },
-	{ "\\textsc", 7, "\\textsc ", NULL },
-	{ "\\textsf", 7, "\\textsf ", NULL },
-	{ "\\texttt", 7, "\\texttt ", NULL },
-	{ "\\emph",   5, "\\emph ",   NULL },
-	{ "\\url",    4, "\\url ",    NULL },
-	{ "\\mbox",   5, "\\mbox ",   NULL },
-	{ "\\mkbibquote", 11, "\\mkbibquote ", NULL },
-	/* math functions */
-	{ "\\ln",     3, "\\ln ",     "ln" },
-	{ "\\sin",    4, "\\sin ",    "sin" },
-	{ "\\cos",    4, "\\cos ",    "cos" },
-	{ "\\tan",    4, "\\tan ",    "tan" },
-};
-static const int nlatex_cmds = sizeof( latex_cmds ) / sizeof( latex_cmds[0] );
-
-static const latex_cmds_t math_cmds[] = {
-	{ "\\ln",     3, "\\ln ",     "ln" },
-	{ "\\sin",    4, "\\sin ",    "sin" },
-	{ "\\cos",    4, "\\cos ",    "cos" },
-	{ "\\tan",    4, "\\tan ",    "tan" },
-	{ "\\mathrm", 7, "\\mathrm ", ""    },
-	{ "\\rm",     3, "\\rm ",     ""    },
-	{ "\\LaTeX",  6, "\\LaTeX ",  "LaTeX" },
-};
-static const int nmath_cmds = sizeof( math_cmds ) / sizeof( math_cmds[0] );
-
-/* remove from "ABC \it{DEF}" --> parses to "ABC \it" */
-static int
-remove_latex_cmds_with_brackets( str *s )
-{
-	unsigned long offset;
-	int i;
-	for ( i=0; i<nlatex_cmds; ++i ) {
-		if ( s->len < latex_cmds[i].wbracketsize ) continue;
-		offset = s->len - latex_cmds[i].wbracketsize;
-		if ( !strcmp( str_cstr( s ) + offset, latex_cmds[i].wbracket ) ) {
-			str_trimend( s, latex_cmds[i].wbracketsize );
-			return 1;
+		if ( textcmds && i+1+n < len && p[i+1+n]==' ' ) {
+			if ( latex_cmd_find( p+i+1, n, LATEX_CMD_TEXT ) ) {
+				i += n + 2;
+				continue;
+			}
 		}
-	}
-	return 0;
-}
 
-/* remove from "{\it ABC}" */
-static void
-remove_latex_cmds_without_brackets( str *s )
-{
-	int i;
-	for ( i=0; i<nlatex_cmds; ++i ) {
-		str_findreplace( s, latex_cmds[i].wobracket, "" );
-	}
-}
+		cmd = NULL;
+		for ( m=1; m<=n && m<=LATEX_CMD_MAXLEN; ++m ) {
+			cmd = latex_cmd_find( p+i+1, m, LATEX_CMD_MATH );
+			if ( cmd ) break;
+		}
 
-static void
-remove_math_cmds( str *s )
-{
-	int i;
-	for ( i=0; i<nmath_cmds; ++i ) {
-		str_findreplace( s, math_cmds[i].wbracket, math_cmds[i].toreplace );
+		if ( cmd ) {
+			str_strcatc( out, cmd->replace );
+			i += m + 1;
+		} else {
+			latex_addchar( out, p[i++] );
+		}
 	}
 }
 
 static int
-collapse_latex_graph( latex_node *n, str *out )
+is_unescaped( const char *p, unsigned long offset, char c )
 {
-	latex_edge *e;
-	int status;
-
-	if ( n->down_node ) {
-		status = collapse_latex_graph( n->down_node, out );
-		if ( status!=BIBL_OK ) return status;
-	}
-
-	e = n->next_edge;
-	if ( e ) {
-		if ( !remove_latex_cmds_with_brackets( &(e->text) ) )
-			remove_latex_cmds_without_brackets( &(e->text) );
-		remove_math_cmds( &(e->text) );
-		str_strcat( out, &(e->text) );
-		if ( str_memerr( &(e->text) ) ) return BIBL_ERR_MEMERR;
-		if ( e->next_node ) {
-			status = collapse_latex_graph( e->next_node, out );
-			if ( status!=BIBL_OK ) return status;
-		}
-	}
-
-	return BIBL_OK;
+	if ( p[offset]!=c ) return 0;
+	if ( offset > 0 && p[offset-1]=='\\' ) return 0;
+	return 1;
 }
 
-static int
-string_from_latex_graph( latex_node *n, str *out )
+/* latex_parse()
+ *
+ * Strip braces, math shifts, and markup commands from LaTeX, in a single
+ * pass: each run of text between '{', '}', and '$' is cleaned as soon as
+ * it ends. A '}' (or the closing '$') ends the innermost group whichever
+ * character opened it.
+ */
+int
+latex_parse( str *in, str *out )
 {
-	int status;
-
-	status = collapse_latex_graph( n, out );
-	if ( status!=BIBL_OK ) return status;
-
-	while( str_findreplace( out, "  ", " " ) ) {}
+	int depth = 0, mathmode = 0, status = BIBL_OK;
+	unsigned long i;
+	const char *p;
+	str seg;
 
+	/* out is always a valid string, even when nothing is left */
+	str_strcpyc( out, "" );
 	if ( str_memerr( out ) ) return BIBL_ERR_MEMERR;
-	else return BIBL_OK;
-}
 
-#if 0
-static void
-write_latex_graph( latex_node *n )
-{
-	latex_edge *e;
+	if ( str_is_empty( in ) ) return BIBL_OK;
 
-	while ( n ) {
+	str_init( &seg );
 
-		if ( n->down_node ) {
-			printf( "+{" );
-			write_latex_graph( n->down_node );
-			printf( "}" );
-		}
-		else printf( "." );
+	p = str_cstr( in );
 
-		e = n->next_edge;
-		if ( e ) {
-			if ( str_has_value( &(e->text) ) ) printf( "%s", str_cstr( &(e->text) ) );
-			n = e->next_node;
+	for ( i=0; p[i]; ++i ) {
+		if ( is_unescaped( p, i, '{' ) ) {
+			latex_cat_segment( out, &seg );
+			str_empty( &seg );
+			depth++;
+		}
+		else if ( is_unescaped( p, i, '}' ) ) {
+			if ( depth==0 ) {
+				fprintf( stderr, "Unmatched '}' character in LaTeX encoding '%s'.\n", p );
+				continue;
+			}
+			latex_cat_segment( out, &seg );
+			str_empty( &seg );
+			depth--;
+		}
+		else if ( is_unescaped( p, i, '$' ) ) {
+			mathmode = !mathmode;
+			if ( !mathmode && depth==0 ) {
+				fprintf( stderr, "Unmatched '$' character in LaTeX encoding '%s'.\n", p );
+				continue;
+			}
+			latex_cat_segment( out, &seg );
+			str_empty( &seg );
+			if ( mathmode ) depth++;
+			else depth--;
+		}
+		else {
+			str_addchar( &seg, p[i] );
 		}
-		else n = NULL;
 	}
-}
-#endif
 
-int
-latex_parse( str *in, str *out )
-{
-	latex_node *n = NULL;
-	int status = BIBL_OK;
+	latex_cat_segment( out, &seg );
 
-	str_empty( out );
+	for ( ; depth>0; depth-- )
+		fprintf( stderr, "Unmatched '{' character in LaTeX encoding '%s'.\n", p );
 
-	if ( str_is_empty( in ) ) return BIBL_OK;
-
-	status = build_latex_graph( in, &n );
-	if ( status!=BIBL_OK ) goto out;
-
-	status = string_from_latex_graph( n, out );
-	if ( status!=BIBL_OK ) goto out;
+	if ( str_memerr( &seg ) || str_memerr( out ) ) status = BIBL_ERR_MEMERR;
+	else str_trimendingws( out );
 
-	str_trimendingws( out );
-
-out:
-	latex_node_delete( n );
+	str_free( &seg );
 
 	return status;
 }
@@ -0,0 +1,110 @@
+/*
+ * macros.c
+ *
+ * BibTeX @STRING macro table shared by bibtexin.c and biblatexin.c
+ *
+ * Copyright (c) Chris Putnam 2021
+ *
+ * Source code released under the GPL version 2
+ *
+ */
+#include <stdlib.h>
+#include "macros.h"
+
+void
+macros_init( macros *m )
+{
+	slist_init( &(m->names) );
+	slist_init( &(m->values) );
+	strhash_init( &(m->index), STRHASH_NOCASE );
+}
+
+void
+macros_free( macros *m )
+{
+	slist_free( &(m->names) );
+	slist_free( &(m->values) );
+	strhash_free( &(m->index) );
+}
+
+/* macros_new()
+ *
+ * Returns NULL on memory error.
+ */
+macros *
+macros_new( void )
+{
+	macros *m;
+
+	m = ( macros * ) malloc( sizeof( macros ) );
+	if ( m ) macros_init( m );
+
+	return m;
+}
+
+void
+macros_delete( macros *m )
+{
+	if ( !m ) return;
+	macros_free( m );
+	free( m );
+}
+
+/* macros_add()
+ *
+ * Define, or redefine, macro name. The index keys are the data of
+ * the strs in names, which stay put when the slist grows.
+ */
+int
+macros_add( macros *m, str *name, str *value )
+{
+	str *s;
+	int n;
+
+	n = strhash_findn( &(m->index), str_cstr( name ), name->len );
+	if ( n!=-1 ) {
+		s = slist_set( &(m->values), n, value );
+		if ( s==NULL ) return MACROS_MEMERR;
+		return MACROS_OK;
+	}
+
+	if ( slist_add( &(m->names), name )!=SLIST_OK ) return MACROS_MEMERR;
+	if ( slist_add( &(m->values), value )!=SLIST_OK ) {
+		m->names.n--;
+		return MACROS_MEMERR;
+	}
+
+	n = m->names.n - 1;
+	s = slist_str( &(m->names), n );
+	if ( strhash_setn( &(m->index), str_cstr( s ), s->len, n )!=STRHASH_OK ) {
+		m->names.n--;
+		m->values.n--;
+		return MACROS_MEMERR;
+	}
+
+	return MACROS_OK;
+}
+
+/* macros_findn()
+ *
+ * Return the value of the macro named by the len characters at name,
+ * or NULL if it is not defined.
+ */
+str *
+macros_findn( macros *m, const char *name, unsigned long len )
+{
+	int n;
+
+	if ( len==0 ) return NULL;
+
+	n = strhash_findn( &(m->index), name, len );
+	if ( n==-1 ) return NULL;
+
+	return slist_str( &(m->values), n );
+}
+
+str *
+macros_find( macros *m, str *name )
+{
+	return macros_findn( m, str_cstr( name ), name->len );
+}
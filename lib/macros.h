@@ -0,0 +1,40 @@
+/*
+ * macros.h
+ *
+ * BibTeX @STRING macro table shared by bibtexin.c and biblatexin.c
+ *
+ * Copyright (c) Chris Putnam 2021
+ *
+ * Source code released under the GPL version 2
+ *
+ */
+#ifndef MACROS_H
+#define MACROS_H
+
+#include "str.h"
+#include "slist.h"
+#include "strhash.h"
+
+#define MACROS_OK     (0)
+#define MACROS_MEMERR (-1)
+
+/* Macro names are case-insensitive, as in BibTeX, and redefining a
+ * macro replaces its value (the last definition wins).
+ */
+typedef struct macros {
+	slist   names;    /* as first defined */
+	slist   values;   /* parallel to names */
+	strhash index;    /* names -> position in names/values */
+} macros;
+
+#define MACROS_STATIC_INIT { { 0, 0, 0, NULL }, { 0, 0, 0, NULL }, { NULL, 0, 0, STRHASH_NOCASE } }
+
+void    macros_init( macros *m );
+void    macros_free( macros *m );
+macros *macros_new( void );
+void    macros_delete( macros *m );
+int     macros_add( macros *m, str *name, str *value );
+str    *macros_find( macros *m, str *name );
+str    *macros_findn( macros *m, const char *name, unsigned long len );
+
+#endif
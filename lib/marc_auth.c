@@ -1,5 +1,5 @@
 /*
- * marc_auth.c - Identify genre and resources to be labeled with MARC authority/
+ * marc_auth.c - Identify genre and resources to be labeled with MARC authority
  *
  * MARC (MAchine-Readable Cataloging) 21 authority codes/values from the Library of Congress initiative
  *
@@ -8,15 +8,16 @@
  * Source code released under the GPL version 2
  *
  * Because the string values belonging to the MARC authority
- * are constant, search for them in a pre-calculated hash to
- * reduce O(N) run-time linear searching of the list to O(1).
- * Note that hash size was set to ensure no collisions among
- * valid terms.
+ * are constant, search for them through a pre-calculated
+ * minimal perfect hash: every valid term has a slot of its
+ * own, so a lookup is one hash and one string comparison.
+ *
+ * Generated by bldhash/hash_marc; do not edit.
  */
 
 #include <stdlib.h>
 #include <string.h>
-#include "hash.h"
+#include "mph.h"
 #include "marc_auth.h"
 
 typedef struct marc_trans {
@@ -27,142 +28,137 @@ typedef struct marc_trans {
 /*
  * MARC genre hash
  */
-static const unsigned int marc_genre_hash_size = 360;
-static const char *marc_genre[360] = {
-	[ 0 ... 359 ] = NULL,
-	[  47 ] = "abstract or summary",
-	[ 104 ] = "art original",
-	[  88 ] = "art reproduction",
-	[  34 ] = "article",
-	[ 330 ] = "atlas",
-	[ 110 ] = "autobiography",
-	[ 343 ] = "bibliography",
-	[ 237 ] = "biography",
-	[ 222 ] = "book",
-	[ 140 ] = "calendar",
-	[ 130 ] = "catalog",
-	[  39 ] = "chart",
-	[  51 ] = "comic or graphic novel",
-	[ 192 ] = "comic strip",
-	[  46 ] = "conference publication",
-	[ 243 ] = "database",
-	[ 318 ] = "dictionary",
-	[  62 ] = "diorama",
-	[ 164 ] = "directory",
-	[   5 ] = "discography",
-	[ 267 ] = "drama",
-	[ 303 ] = "encyclopedia",
-	[ 268 ] = "essay",
-	[ 188 ] = "festschrift",
-	[  92 ] = "fiction",
-	[  28 ] = "filmography",
-	[   1 ] = "filmstrip",
-	[ 307 ] = "finding aid",
-	[  11 ] = "flash card",
-	[ 247 ] = "folktale",
-	[ 321 ] = "font",
-	[ 310 ] = "game",
-	[  16 ] = "government publication",
-	[ 167 ] = "graphic",
-	[ 319 ] = "globe",
-	[  99 ] = "handbook",
-	[ 187 ] = "history",
-	[ 230 ] = "humor, satire",
-	[  41 ] = "hymnal",
-	[  98 ] = "index",
-	[ 116 ] = "instruction",
-	[  27 ] = "interview",
-	[  32 ] = "issue",
-	[  18 ] = "journal",
-	[ 326 ] = "kit",
-	[ 285 ] = "language instruction",
-	[ 251 ] = "law report or digest",
-	[ 150 ] = "legal article",
-	[ 159 ] = "legal case and case notes",
-	[ 327 ] = "legislation",
-	[ 220 ] = "letter",
-	[ 229 ] = "loose-leaf",
-	[  35 ] = "map",
-	[  19 ] = "memoir",
-	[  83 ] = "microscope slide",
-	[ 123 ] = "model",
-	[ 344 ] = "motion picture",
-	[  93 ] = "multivolume monograph",
-	[  81 ] = "newspaper",
-	[ 113 ] = "novel",
-	[ 119 ] = "numeric data",
-	[ 314 ] = "offprint",
-	[  31 ] = "online system or service",
-	[ 288 ] = "patent",
-	[  54 ] = "periodical",
-	[ 322 ] = "picture",
-	[  48 ] = "poetry",
-	[ 114 ] = "programmed text",
-	[  63 ] = "realia",
-	[ 261 ] = "rehearsal",
-	[ 329 ] = "remote sensing image",
-	[ 126 ] = "reporting",
-	[ 121 ] = "review",
-	[  84 ] = "series",
-	[   2 ] = "short story",
-	[ 323 ] = "slide",
-	[  36 ] = "sound",
-	[ 196 ] = "speech",
-	[ 265 ] = "standard or specification",
-	[  20 ] = "statistics",
-	[ 215 ] = "survey of literature",
-	[ 165 ] = "technical drawing",
-	[ 209 ] = "technical report",
-	[  33 ] = "thesis",
-	[ 266 ] = "toy",
-	[ 195 ] = "transparency",
-	[ 308 ] = "treaty",
-	[  21 ] = "videorecording",
-	[ 118 ] = "web site",
-	[ 249 ] = "yearbook",
+static const char *marc_genre[90] = {
+	[   2 ] = "abstract or summary",
+	[  50 ] = "art original",
+	[   9 ] = "art reproduction",
+	[  10 ] = "article",
+	[   7 ] = "atlas",
+	[  83 ] = "autobiography",
+	[  58 ] = "bibliography",
+	[  60 ] = "biography",
+	[  35 ] = "book",
+	[   6 ] = "calendar",
+	[  14 ] = "catalog",
+	[  13 ] = "chart",
+	[  29 ] = "comic or graphic novel",
+	[  48 ] = "comic strip",
+	[  41 ] = "conference publication",
+	[  87 ] = "database",
+	[  46 ] = "dictionary",
+	[  16 ] = "diorama",
+	[  20 ] = "directory",
+	[  37 ] = "discography",
+	[  70 ] = "drama",
+	[   0 ] = "encyclopedia",
+	[  69 ] = "essay",
+	[  54 ] = "festschrift",
+	[   3 ] = "fiction",
+	[  85 ] = "filmography",
+	[  21 ] = "filmstrip",
+	[  84 ] = "finding aid",
+	[  61 ] = "flash card",
+	[  42 ] = "folktale",
+	[  53 ] = "font",
+	[  32 ] = "game",
+	[  77 ] = "government publication",
+	[  80 ] = "graphic",
+	[  72 ] = "globe",
+	[   4 ] = "handbook",
+	[  30 ] = "history",
+	[  65 ] = "humor, satire",
+	[  11 ] = "hymnal",
+	[  43 ] = "index",
+	[   1 ] = "instruction",
+	[  38 ] = "interview",
+	[  23 ] = "issue",
+	[  36 ] = "journal",
+	[   8 ] = "kit",
+	[  27 ] = "language instruction",
+	[  12 ] = "law report or digest",
+	[  64 ] = "legal article",
+	[  17 ] = "legal case and case notes",
+	[  31 ] = "legislation",
+	[  55 ] = "letter",
+	[  26 ] = "loose-leaf",
+	[  19 ] = "map",
+	[  74 ] = "memoir",
+	[  28 ] = "microscope slide",
+	[  82 ] = "model",
+	[  33 ] = "motion picture",
+	[  34 ] = "multivolume monograph",
+	[  89 ] = "newspaper",
+	[  59 ] = "novel",
+	[  25 ] = "numeric data",
+	[  63 ] = "offprint",
+	[  52 ] = "online system or service",
+	[  44 ] = "patent",
+	[  22 ] = "periodical",
+	[  47 ] = "picture",
+	[  78 ] = "poetry",
+	[  45 ] = "programmed text",
+	[  68 ] = "realia",
+	[  79 ] = "rehearsal",
+	[  81 ] = "remote sensing image",
+	[  73 ] = "reporting",
+	[  56 ] = "review",
+	[  76 ] = "series",
+	[  71 ] = "short story",
+	[  75 ] = "slide",
+	[  24 ] = "sound",
+	[  18 ] = "speech",
+	[  86 ] = "standard or specification",
+	[   5 ] = "statistics",
+	[  67 ] = "survey of literature",
+	[  51 ] = "technical drawing",
+	[  15 ] = "technical report",
+	[  39 ] = "thesis",
+	[  49 ] = "toy",
+	[  57 ] = "transparency",
+	[  88 ] = "treaty",
+	[  66 ] = "videorecording",
+	[  62 ] = "web site",
+	[  40 ] = "yearbook",
+};
+static const int marc_genre_disp[31] = {
+	3, -34, 2, 65, 32, 2, 29, -44, 20, 2,
+	-74, 37, 27, 55, 68, 16, 3, 4, 1, 1,
+	9, 7, 8, 1, 44, 27, 6, 250, 35, 162,
+	12,
 };
+static const mph marc_genre_hash = { 90, 31, marc_genre_disp, MPH_CASE };
 
 int
 is_marc_genre( const char *query )
 {
-	unsigned int n;
-
-	n = calculate_hash_char( query, marc_genre_hash_size );
-	if ( marc_genre[n]==NULL ) return 0;
-	if ( !strcmp( query, marc_genre[n] ) ) return 1;
-	else if ( marc_genre[n+1] && !strcmp( query, marc_genre[n+1] ) ) return 1;
-	else return 0;
+	return !strcmp( query, marc_genre[ mph_slot( &marc_genre_hash, query ) ] );
 }
 /*
  * MARC resource hash
  */
-static const unsigned int marc_resource_hash_size = 22;
-static const char *marc_resource[22] = {
-	[ 0 ... 21 ] = NULL,
-	[  15 ] = "cartographic",
-	[   1 ] = "kit",
-	[  10 ] = "mixed material",
-	[   9 ] = "moving image",
-	[   2 ] = "notated music",
-	[  16 ] = "software, multimedia",
-	[  12 ] = "sound recording",
-	[  20 ] = "sound recording - musical",
-	[   0 ] = "sound recording - nonmusical",
-	[   6 ] = "still image",
-	[  13 ] = "text",
+static const char *marc_resource[12] = {
+	[   1 ] = "cartographic",
+	[   8 ] = "kit",
+	[   0 ] = "mixed material",
+	[   6 ] = "moving image",
+	[   7 ] = "notated music",
+	[  10 ] = "software, multimedia",
+	[   2 ] = "sound recording",
+	[   9 ] = "sound recording - musical",
+	[   4 ] = "sound recording - nonmusical",
+	[   5 ] = "still image",
+	[  11 ] = "text",
 	[   3 ] = "three dimensional object",
 };
+static const int marc_resource_disp[5] = {
+	0, 16, -6, 2, 161,
+};
+static const mph marc_resource_hash = { 12, 5, marc_resource_disp, MPH_CASE };
 
 int
 is_marc_resource( const char *query )
 {
-	unsigned int n;
-
-	n = calculate_hash_char( query, marc_resource_hash_size );
-	if ( marc_resource[n]==NULL ) return 0;
-	if ( !strcmp( query, marc_resource[n] ) ) return 1;
-	else if ( marc_resource[n+1] && !strcmp( query, marc_resource[n+1] ) ) return 1;
-	else return 0;
+	return !strcmp( query, marc_resource[ mph_slot( &marc_resource_hash, query ) ] );
 }
 /*
  * MARC relators hash
@@ -170,299 +166,308 @@ is_marc_resource( const char *query )
 
 /* www.loc.gov/marc/relators/relacode.html */
 
-static const unsigned int marc_relators_hash_size = 1295;
-static const marc_trans marc_relators[1295] = {
-	[ 0 ... 1294 ] = { NULL, NULL },
-	[  424 ] = { "ABRIDGER",                            "abr"                                 },
-	[   23 ] = { "ART_COPYIST",                         "acp"                                 },
-	[  133 ] = { "ACTOR",                               "act"                                 },
-	[  404 ] = { "ART_DIRECTOR",                        "adi"                                 },
-	[ 1292 ] = { "ADAPTER",                             "adp"                                 },
-	[ 1138 ] = { "AFTERAUTHOR",                         "aft"                                 },
-	[ 1067 ] = { "ANALYST",                             "anl"                                 },
-	[  260 ] = { "ANIMATOR",                            "anm"                                 },
-	[ 1031 ] = { "ANNOTATOR",                           "ann"                                 },
-	[ 1045 ] = { "BIBLIOGRAPHIC_ANTECEDENT",            "ant"                                 },
-	[  813 ] = { "APPELLEE",                            "ape"                                 },
-	[  944 ] = { "APPELLANT",                           "apl"                                 },
-	[  147 ] = { "APPLICANT",                           "app"                                 },
-	[  923 ] = { "AUTHOR",                              "aqt"                                 },/* Author in quotations or text abstracts */
-	[  353 ] = { "ARCHITECT",                           "arc"                                 },
-	[  196 ] = { "ARTISTIC_DIRECTOR",                   "ard"                                 },
-	[  951 ] = { "ARRANGER",                            "arr"                                 },
-	[  286 ] = { "ARTIST",                              "art"                                 },
-	[  428 ] = { "ASSIGNEE",                            "asg"                                 },
-	[  734 ] = { "ASSOCIATED_NAME",                     "asn"                                 },
-	[ 1112 ] = { "AUTOGRAPHER",                         "ato"                                 },
-	[  699 ] = { "ATTRIBUTED_NAME",                     "att"                                 },
-	[  382 ] = { "AUCTIONEER",                          "auc"                                 },
-	[ 1249 ] = { "AUTHOR",                              "aud"                                 },/* Author of dialog */
-	[  478 ] = { "INTROAUTHOR",                         "aui"                                 },/* Author of introduction, etc. */
-	[  895 ] = { "AUTHOR",                              "aus"                                 },/* Screenwriter */
-	[  332 ] = { "AUTHOR",                              "aut"                                 },
-	[  354 ] = { "AUTHOR",                              "author"                              },
-	[  492 ] = { "AFTERAUTHOR",                         "author of afterword, colophon, etc." },
-	[  691 ] = { "INTROAUTHOR",                         "author of introduction, etc."        },
-	[  784 ] = { "BINDING_DESIGNER",                    "bdd"                                 },
-	[  570 ] = { "BOOKJACKET_DESIGNER",                 "bjd"                                 },
-	[  778 ] = { "BOOK_DESIGNER",                       "bkd"                                 },
-	[  836 ] = { "BOOK_PRODUCER",                       "bkp"                                 },
-	[  997 ] = { "AUTHOR",                              "blw"                                 },/* Blurb writer */
-	[  387 ] = { "BINDER",                              "bnd"                                 },
-	[ 1182 ] = { "BOOKPLATE_DESIGNER",                  "bpd"                                 },
-	[  437 ] = { "BROADCASTER",                         "brd"                                 },
-	[ 1226 ] = { "BRAILLE_EMBOSSER",                    "brl"                                 },
-	[ 1121 ] = { "BOOKSELLER",                          "bsl"                                 },
-	[  194 ] = { "CASTER",                              "cas"                                 },
-	[ 1168 ] = { "CONCEPTOR",                           "ccp"                                 },
-	[  831 ] = { "CHOREOGRAPHER",                       "chr"                                 },
-	[ 1282 ] = { "COLLABORATOR",                        "clb"                                 },
-	[  453 ] = { "CLIENT",                              "cli"                                 },
-	[  372 ] = { "CALLIGRAPHER",                        "cll"                                 },
-	[ 1287 ] = { "COLORIST",                            "clr"                                 },
-	[  758 ] = { "COLLOTYPER",                          "clt"                                 },
-	[ 1010 ] = { "COMMENTATOR",                         "cmm"                                 },
-	[   67 ] = { "COMPOSER",                            "cmp"                                 },
-	[ 1179 ] = { "COMPOSITOR",                          "cmt"                                 },
-	[  785 ] = { "CONDUCTOR",                           "cnd"                                 },
-	[  979 ] = { "CINEMATOGRAPHER",                     "cng"                                 },
-	[  283 ] = { "CENSOR",                              "cns"                                 },
-	[  379 ] = { "CONTESTANT-APPELLEE",                 "coe"                                 },
-	[ 1281 ] = { "COLLECTOR",                           "col"                                 },
-	[  955 ] = { "COMPILER",                            "com"                                 },
-	[  602 ] = { "CONSERVATOR",                         "con"                                 },
-	[  657 ] = { "COLLECTION_REGISTRAR",                "cor"                                 },
-	[  107 ] = { "CONTESTANT",                          "cos"                                 },
-	[ 1058 ] = { "CONTESTANT-APPELLANT",                "cot"                                 },
-	[  538 ] = { "COURT_GOVERNED",                      "cou"                                 },
-	[  202 ] = { "COVER_DESIGNER",                      "cov"                                 },
-	[ 1222 ] = { "COPYRIGHT_CLAIMANT",                  "cpc"                                 },
-	[ 1033 ] = { "COMPLAINANT-APPELLEE",                "cpe"                                 },
-	[  522 ] = { "COPYRIGHT_HOLDER",                    "cph"                                 },
-	[  926 ] = { "COMPLAINANT",                         "cpl"                                 },
-	[  251 ] = { "COMPLAINANT-APPELLANT",               "cpt"                                 },
-	[  746 ] = { "AUTHOR",                              "cre"                                 },/* Creator */
-	[  780 ] = { "AUTHOR",                              "creator"                             },/* Creator */
-	[  461 ] = { "CORRESPONDENT",                       "crp"                                 },
-	[  266 ] = { "CORRECTOR",                           "crr"                                 },
-	[ 1269 ] = { "COURT_REPORTER",                      "crt"                                 },
-	[  533 ] = { "CONSULTANT",                          "csl"                                 },
-	[ 1291 ] = { "CONSULTANT",                          "csp"                                 },/* Consultant to a project */
-	[  761 ] = { "COSTUME_DESIGNER",                    "cst"                                 },
-	[ 1205 ] = { "CONTRIBUTOR",                         "ctb"                                 },
-	[ 1110 ] = { "CONTESTEE-APPELLEE",                  "cte"                                 },
-	[  516 ] = { "CARTOGRAPHER",                        "ctg"                                 },
-	[  273 ] = { "CONTRACTOR",                          "ctr"                                 },
-	[  695 ] = { "CONTESTEE",                           "cts"                                 },
-	[  487 ] = { "CONTESTEE-APPELLANT",                 "ctt"                                 },
-	[  851 ] = { "CURATOR",                             "cur"                                 },
-	[  704 ] = { "COMMENTATOR",                         "cwt"                                 },/* Commentator for written text */
-	[  683 ] = { "DISTRIBUTION_PLACE",                  "dbp"                                 },
-	[  481 ] = { "DEGREEGRANTOR",                       "degree grantor"                      },/* Degree granting institution */
-	[  999 ] = { "DEFENDANT",                           "dfd"                                 },
-	[  197 ] = { "DEFENDANT-APPELLEE",                  "dfe"                                 },
-	[  553 ] = { "DEFENDANT-APPELLANT",                 "dft"                                 },
-	[  662 ] = { "DEGREEGRANTOR",                       "dgg"                                 },/* Degree granting institution */
-	[  894 ] = { "DEGREE_SUPERVISOR",                   "dgs"                                 },
-	[  534 ] = { "DISSERTANT",                          "dis"                                 },
-	[    6 ] = { "DELINEATOR",                          "dln"                                 },
-	[ 1113 ] = { "DANCER",                              "dnc"                                 },
-	[  771 ] = { "DONOR",                               "dnr"                                 },
-	[   46 ] = { "DEPICTED",                            "dpc"                                 },
-	[ 1210 ] = { "DEPOSITOR",                           "dpt"                                 },
-	[  762 ] = { "DRAFTSMAN",                           "drm"                                 },
-	[  203 ] = { "DIRECTOR",                            "drt"                                 },
-	[  953 ] = { "DESIGNER",                            "dsr"                                 },
-	[ 1254 ] = { "DISTRIBUTOR",                         "dst"                                 },
-	[  366 ] = { "DATA_CONTRIBUTOR",                    "dtc"                                 },
-	[  613 ] = { "DEDICATEE",                           "dte"                                 },
-	[  978 ] = { "DATA_MANAGER",                        "dtm"                                 },
-	[  383 ] = { "DEDICATOR",                           "dto"                                 },
-	[  738 ] = { "AUTHOR",                              "dub"                                 },/* Dubious author */
-	[ 1143 ] = { "EDITOR",                              "edc"                                 },/* Editor of compilation */
-	[  567 ] = { "EDITOR",                              "edm"                                 },/* Editor of moving image work */
-	[  956 ] = { "EDITOR",                              "edt"                                 },
-	[  945 ] = { "ENGRAVER",                            "egr"                                 },
-	[  874 ] = { "ELECTRICIAN",                         "elg"                                 },
-	[  682 ] = { "ELECTROTYPER",                        "elt"                                 },
-	[  703 ] = { "ENGINEER",                            "eng"                                 },
-	[  129 ] = { "ENACTING_JURISDICTION",               "enj"                                 },
-	[  433 ] = { "ETCHER",                              "etr"                                 },
-	[  940 ] = { "EVENT_PLACE",                         "evp"                                 },
-	[  493 ] = { "EXPERT",                              "exp"                                 },
-	[ 1169 ] = { "FACSIMILIST",                         "fac"                                 },
-	[  191 ] = { "FILM_DISTRIBUTOR",                    "fds"                                 },
-	[  314 ] = { "FIELD_DIRECTOR",                      "fld"                                 },
-	[  794 ] = { "EDITOR",                              "flm"                                 },/* Film editor */
-	[ 1184 ] = { "DIRECTOR",                            "fmd"                                 },/* Film director */
-	[  906 ] = { "FILMMAKER",                           "fmk"                                 },
-	[    1 ] = { "FORMER_OWNER",                        "fmo"                                 },
-	[  614 ] = { "PRODUCER",                            "fmp"                                 },/* Film producer */
-	[  288 ] = { "FUNDER",                              "fnd"                                 },
-	[  430 ] = { "FIRST_PARTY",                         "fpy"                                 },
-	[   81 ] = { "FORGER",                              "frg"                                 },
-	[ 1087 ] = { "GEOGRAPHIC_INFORMATION_SPECIALIST",   "gis"                                 },
-	[  275 ] = { "GRAPHIC_TECHNICIAN",                  "grt"                                 },
-	[ 1152 ] = { "HOST_INSTITUTION",                    "his"                                 },
-	[  580 ] = { "HONOREE",                             "hnr"                                 },
-	[  113 ] = { "HOST",                                "hst"                                 },
-	[  603 ] = { "ILLUSTRATOR",                         "ill"                                 },
-	[  882 ] = { "ILLUMINATOR",                         "ilu"                                 },
-	[  620 ] = { "INSCRIBER",                           "ins"                                 },
-	[  590 ] = { "INVENTOR",                            "inv"                                 },
-	[  814 ] = { "ISSUING_BODY",                        "isb"                                 },
-	[  508 ] = { "MUSICIAN",                            "itr"                                 },/* Instrumentalist */
-	[  578 ] = { "INTERVIEWEE",                         "ive"                                 },
-	[ 1195 ] = { "INTERVIEWER",                         "ivr"                                 },
-	[  716 ] = { "JUDGE",                               "jud"                                 },
-	[ 1225 ] = { "JURISDICTION_GOVERNED",               "jug"                                 },
-	[  873 ] = { "LABORATORY",                          "lbr"                                 },
-	[  395 ] = { "AUTHOR",                              "lbt"                                 },/* Librettist */
-	[  299 ] = { "LABORATORY_DIRECTOR",                 "ldr"                                 },
-	[  927 ] = { "LEAD",                                "led"                                 },
-	[  455 ] = { "LIBELEE-APPELLEE",                    "lee"                                 },
-	[  865 ] = { "LIBELEE",                             "lel"                                 },
-	[  552 ] = { "LENDER",                              "len"                                 },
-	[   66 ] = { "LIBELEE-APPELLANT",                   "let"                                 },
-	[  847 ] = { "LIGHTING_DESIGNER",                   "lgd"                                 },
-	[  625 ] = { "LIBELANT-APPELLEE",                   "lie"                                 },
-	[  722 ] = { "LIBELANT",                            "lil"                                 },
-	[  308 ] = { "LIBELANT-APPELLANT",                  "lit"                                 },
-	[  143 ] = { "LANDSCAPE_ARCHITECT",                 "lsa"                                 },
-	[   11 ] = { "LICENSEE",                            "lse"                                 },
-	[  700 ] = { "LICENSOR",                            "lso"                                 },
-	[  165 ] = { "LITHOGRAPHER",                        "ltg"                                 },
-	[  788 ] = { "AUTHOR",                              "lyr"                                 },/* Lyricist */
-	[  514 ] = { "MUSIC_COPYIST",                       "mcp"                                 },
-	[  131 ] = { "METADATA_CONTACT",                    "mdc"                                 },
-	[   29 ] = { "MEDIUM",                              "med"                                 },
-	[  645 ] = { "MANUFACTURE_PLACE",                   "mfp"                                 },
-	[  164 ] = { "MANUFACTURER",                        "mfr"                                 },
-	[  173 ] = { "MODERATOR",                           "mod"                                 },
-	[ 1132 ] = { "THESIS_EXAMINER",                     "mon"                                 },/* Monitor */
-	[ 1146 ] = { "MARBLER",                             "mrb"                                 },
-	[ 1141 ] = { "EDITOR",                              "mrk"                                 },/* Markup editor */
-	[  715 ] = { "MUSICAL_DIRECTOR",                    "msd"                                 },
-	[  498 ] = { "METAL-ENGRAVER",                      "mte"                                 },
-	[  518 ] = { "MINUTE_TAKER",                        "mtk"                                 },
-	[  103 ] = { "MUSICIAN",                            "mus"                                 },
-	[  348 ] = { "NARRATOR",                            "nrt"                                 },
-	[  112 ] = { "THESIS_OPPONENT",                     "opn"                                 },/* Opponent */
-	[  420 ] = { "ORIGINATOR",                          "org"                                 },
-	[  804 ] = { "ORGANIZER",                           "organizer of meeting"                },
-	[   12 ] = { "ORGANIZER",                           "orm"                                 },
-	[   34 ] = { "ONSCREEN_PRESENTER",                  "osp"                                 },
-	[  148 ] = { "THESIS_OTHER",                        "oth"                                 },/* Other */
-	[  411 ] = { "OWNER",                               "own"                                 },
-	[ 1038 ] = { "PANELIST",                            "pan"                                 },
-	[  144 ] = { "PATRON",                              "pat"                                 },
-	[ 1001 ] = { "ASSIGNEE",                            "patent holder"                       },
-	[  386 ] = { "PUBLISHING_DIRECTOR",                 "pbd"                                 },
-	[  828 ] = { "PUBLISHER",                           "pbl"                                 },
-	[  334 ] = { "PROJECT_DIRECTOR",                    "pdr"                                 },
-	[  811 ] = { "PROOFREADER",                         "pfr"                                 },
-	[  496 ] = { "PHOTOGRAPHER",                        "pht"                                 },
-	[  597 ] = { "PLATEMAKER",                          "plt"                                 },
-	[  124 ] = { "PERMITTING_AGENCY",                   "pma"                                 },
-	[ 1092 ] = { "PRODUCTION_MANAGER",                  "pmn"                                 },
-	[  792 ] = { "PRINTER_OF_PLATES",                   "pop"                                 },
-	[  924 ] = { "PAPERMAKER",                          "ppm"                                 },
-	[  104 ] = { "PUPPETEER",                           "ppt"                                 },
-	[  958 ] = { "PRAESES",                             "pra"                                 },
-	[   31 ] = { "PROCESS_CONTRACT",                    "prc"                                 },
-	[  901 ] = { "PRODUCTION_PERSONNEL",                "prd"                                 },
-	[  450 ] = { "PRESENTER",                           "pre"                                 },
-	[  936 ] = { "PERFORMER",                           "prf"                                 },
-	[   58 ] = { "AUTHOR",                              "prg"                                 },/* Programmer */
-	[  859 ] = { "PRINTMAKER",                          "prm"                                 },
-	[ 1042 ] = { "PRODUCTION_COMPANY",                  "prn"                                 },
-	[  872 ] = { "PRODUCER",                            "pro"                                 },
-	[  867 ] = { "PRODUCTION_PLACE",                    "prp"                                 },
-	[  988 ] = { "PRODUCTION_DESIGNER",                 "prs"                                 },
-	[  678 ] = { "PRINTER",                             "prt"                                 },
-	[  701 ] = { "PROVIDER",                            "prv"                                 },
-	[  264 ] = { "PATENT_APPLICANT",                    "pta"                                 },
-	[   68 ] = { "PLAINTIFF-APPELLEE",                  "pte"                                 },
-	[ 1202 ] = { "PLAINTIFF",                           "ptf"                                 },
-	[  581 ] = { "ASSIGNEE",                            "pth"                                 },/* Patent holder */
-	[  840 ] = { "PLAINTIFF-APPELLANT",                 "ptt"                                 },
-	[ 1061 ] = { "PUBLICATION_PLACE",                   "pup"                                 },
-	[  254 ] = { "RUBRICATOR",                          "rbr"                                 },
-	[  838 ] = { "RECORDIST",                           "rcd"                                 },
-	[ 1274 ] = { "RECORDING_ENGINEER",                  "rce"                                 },
-	[  421 ] = { "ADDRESSEE",                           "rcp"                                 },/* Recipient */
-	[  339 ] = { "RADIO_DIRECTOR",                      "rdd"                                 },
-	[   50 ] = { "REDAKTOR",                            "red"                                 },
-	[  375 ] = { "RENDERER",                            "ren"                                 },
-	[   75 ] = { "RESEARCHER",                          "res"                                 },
-	[  504 ] = { "REVIEWER",                            "rev"                                 },
-	[  400 ] = { "RADIO_PRODUCER",                      "rpc"                                 },
-	[ 1070 ] = { "REPOSITORY",                          "rps"                                 },
-	[ 1260 ] = { "REPORTER",                            "rpt"                                 },
-	[  497 ] = { "RESPONSIBLE_PARTY",                   "rpy"                                 },
-	[ 1129 ] = { "RESPONDENT-APPELLEE",                 "rse"                                 },
-	[  427 ] = { "RESTAGER",                            "rsg"                                 },
-	[  290 ] = { "RESPONDENT",                          "rsp"                                 },
-	[  269 ] = { "RESTORATIONIST",                      "rsr"                                 },
-	[  766 ] = { "RESPONDENT-APPELLANT",                "rst"                                 },
-	[  243 ] = { "RESEARCH_TEAM_HEAD",                  "rth"                                 },
-	[  573 ] = { "RESEARCH_TEAM_MEMBER",                "rtm"                                 },
-	[  937 ] = { "SCIENTIFIC_ADVISOR",                  "sad"                                 },
-	[  623 ] = { "SCENARIST",                           "sce"                                 },
-	[  376 ] = { "SCULPTOR",                            "scl"                                 },
-	[  892 ] = { "SCRIBE",                              "scr"                                 },
-	[  747 ] = { "SOUND_DESIGNER",                      "sds"                                 },
-	[  914 ] = { "SECRETARY",                           "sec"                                 },
-	[  806 ] = { "STAGE_DIRECTOR",                      "sgd"                                 },
-	[  919 ] = { "SIGNER",                              "sgn"                                 },
-	[  913 ] = { "SUPPORTING_HOST",                     "sht"                                 },
-	[  816 ] = { "SELLER",                              "sll"                                 },
-	[  377 ] = { "SINGER",                              "sng"                                 },
-	[  696 ] = { "SPEAKER",                             "spk"                                 },
-	[  756 ] = { "SPONSOR",                             "spn"                                 },
-	[ 1026 ] = { "SECOND_PARTY",                        "spy"                                 },
-	[  510 ] = { "SURVEYOR",                            "srv"                                 },
-	[  330 ] = { "SET_DESIGNER",                        "std"                                 },
-	[  486 ] = { "SETTING",                             "stg"                                 },
-	[  109 ] = { "STORYTELLER",                         "stl"                                 },
-	[  893 ] = { "STAGE_MANAGER",                       "stm"                                 },
-	[  802 ] = { "STANDARDS_BODY",                      "stn"                                 },
-	[  462 ] = { "STEREOTYPER",                         "str"                                 },
-	[  908 ] = { "TECHNICAL_DIRECTOR",                  "tcd"                                 },
-	[  929 ] = { "TEACHER",                             "tch"                                 },
-	[  130 ] = { "THESIS_ADVISOR",                      "ths"                                 },
-	[  883 ] = { "TELEVISION_DIRECTOR",                 "tld"                                 },
-	[   24 ] = { "TELEVISION_PRODUCER",                 "tlp"                                 },
-	[ 1204 ] = { "TRANSCRIBER",                         "trc"                                 },
-	[ 1153 ] = { "TRANSLATOR",                          "translator"                          },
-	[  195 ] = { "TRANSLATOR",                          "trl"                                 },
-	[  748 ] = { "TYPE_DIRECTOR",                       "tyd"                                 },
-	[  284 ] = { "TYPOGRAPHER",                         "tyg"                                 },
-	[   40 ] = { "UNIVERSITY_PLACE",                    "uvp"                                 },
-	[   25 ] = { "VOICE_ACTOR",                         "vac"                                 },
-	[  336 ] = { "VIDEOGRAPHER",                        "vdg"                                 },
-	[ 1283 ] = { "VOCALIST",                            "voc"                                 },
-	[ 1007 ] = { "AUTHOR",                              "wac"                                 },/* Writer of added commentary */
-	[  436 ] = { "AUTHOR",                              "wal"                                 },/* Writer of added lyrics */
-	[ 1123 ] = { "AUTHOR",                              "wam"                                 },/* Writer of accompanying material */
-	[  960 ] = { "AUTHOR",                              "wat"                                 },/* Writer of added text */
-	[  852 ] = { "WOODCUTTER",                          "wdc"                                 },
-	[  550 ] = { "WOOD_ENGRAVER",                       "wde"                                 },
-	[  974 ] = { "INTROAUTHOR",                         "win"                                 },/* Writer of introduction */
-	[  134 ] = { "WITNESS",                             "wit"                                 },
-	[  825 ] = { "INTROAUTHOR",                         "wpr"                                 },/* Writer of preface */
-	[  105 ] = { "AUTHOR",                              "wst"                                 },/* Writer of supplementary textual content */
+static const marc_trans marc_relators[279] = {
+	[  182 ] = { "ABRIDGER",                            "abr"                                 },
+	[  140 ] = { "ART_COPYIST",                         "acp"                                 },
+	[   55 ] = { "ACTOR",                               "act"                                 },
+	[  254 ] = { "ART_DIRECTOR",                        "adi"                                 },
+	[  158 ] = { "ADAPTER",                             "adp"                                 },
+	[   34 ] = { "AFTERAUTHOR",                         "aft"                                 },
+	[   90 ] = { "ANALYST",                             "anl"                                 },
+	[  136 ] = { "ANIMATOR",                            "anm"                                 },
+	[  242 ] = { "ANNOTATOR",                           "ann"                                 },
+	[  266 ] = { "BIBLIOGRAPHIC_ANTECEDENT",            "ant"                                 },
+	[  217 ] = { "APPELLEE",                            "ape"                                 },
+	[  174 ] = { "APPELLANT",                           "apl"                                 },
+	[  128 ] = { "APPLICANT",                           "app"                                 },
+	[  232 ] = { "AUTHOR",                              "aqt"                                 },/* Author in quotations or text abstracts */
+	[   19 ] = { "ARCHITECT",                           "arc"                                 },
+	[  100 ] = { "ARTISTIC_DIRECTOR",                   "ard"                                 },
+	[   97 ] = { "ARRANGER",                            "arr"                                 },
+	[  154 ] = { "ARTIST",                              "art"                                 },
+	[  229 ] = { "ASSIGNEE",                            "asg"                                 },
+	[  270 ] = { "ASSOCIATED_NAME",                     "asn"                                 },
+	[   78 ] = { "AUTOGRAPHER",                         "ato"                                 },
+	[   91 ] = { "ATTRIBUTED_NAME",                     "att"                                 },
+	[  184 ] = { "AUCTIONEER",                          "auc"                                 },
+	[  127 ] = { "AUTHOR",                              "aud"                                 },/* Author of dialog */
+	[  148 ] = { "INTROAUTHOR",                         "aui"                                 },/* Author of introduction, etc. */
+	[  150 ] = { "AUTHOR",                              "aus"                                 },/* Screenwriter */
+	[  142 ] = { "AUTHOR",                              "aut"                                 },
+	[    6 ] = { "AUTHOR",                              "author"                              },
+	[  186 ] = { "AFTERAUTHOR",                         "author of afterword, colophon, etc." },
+	[  121 ] = { "INTROAUTHOR",                         "author of introduction, etc."        },
+	[  251 ] = { "BINDING_DESIGNER",                    "bdd"                                 },
+	[   66 ] = { "BOOKJACKET_DESIGNER",                 "bjd"                                 },
+	[  265 ] = { "BOOK_DESIGNER",                       "bkd"                                 },
+	[   76 ] = { "BOOK_PRODUCER",                       "bkp"                                 },
+	[  244 ] = { "AUTHOR",                              "blw"                                 },/* Blurb writer */
+	[  171 ] = { "BINDER",                              "bnd"                                 },
+	[  132 ] = { "BOOKPLATE_DESIGNER",                  "bpd"                                 },
+	[   92 ] = { "BROADCASTER",                         "brd"                                 },
+	[  276 ] = { "BRAILLE_EMBOSSER",                    "brl"                                 },
+	[  126 ] = { "BOOKSELLER",                          "bsl"                                 },
+	[  238 ] = { "CASTER",                              "cas"                                 },
+	[  185 ] = { "CONCEPTOR",                           "ccp"                                 },
+	[  161 ] = { "CHOREOGRAPHER",                       "chr"                                 },
+	[  248 ] = { "COLLABORATOR",                        "clb"                                 },
+	[   30 ] = { "CLIENT",                              "cli"                                 },
+	[   59 ] = { "CALLIGRAPHER",                        "cll"                                 },
+	[  218 ] = { "COLORIST",                            "clr"                                 },
+	[   56 ] = { "COLLOTYPER",                          "clt"                                 },
+	[  172 ] = { "COMMENTATOR",                         "cmm"                                 },
+	[  160 ] = { "COMPOSER",                            "cmp"                                 },
+	[   84 ] = { "COMPOSITOR",                          "cmt"                                 },
+	[   54 ] = { "CONDUCTOR",                           "cnd"                                 },
+	[  114 ] = { "CINEMATOGRAPHER",                     "cng"                                 },
+	[  129 ] = { "CENSOR",                              "cns"                                 },
+	[  190 ] = { "CONTESTANT-APPELLEE",                 "coe"                                 },
+	[   43 ] = { "COLLECTOR",                           "col"                                 },
+	[  113 ] = { "COMPILER",                            "com"                                 },
+	[  137 ] = { "CONSERVATOR",                         "con"                                 },
+	[   50 ] = { "COLLECTION_REGISTRAR",                "cor"                                 },
+	[  157 ] = { "CONTESTANT",                          "cos"                                 },
+	[  230 ] = { "CONTESTANT-APPELLANT",                "cot"                                 },
+	[  101 ] = { "COURT_GOVERNED",                      "cou"                                 },
+	[  200 ] = { "COVER_DESIGNER",                      "cov"                                 },
+	[   95 ] = { "COPYRIGHT_CLAIMANT",                  "cpc"                                 },
+	[  191 ] = { "COMPLAINANT-APPELLEE",                "cpe"                                 },
+	[  240 ] = { "COPYRIGHT_HOLDER",                    "cph"                                 },
+	[  181 ] = { "COMPLAINANT",                         "cpl"                                 },
+	[  204 ] = { "COMPLAINANT-APPELLANT",               "cpt"                                 },
+	[  115 ] = { "AUTHOR",                              "cre"                                 },/* Creator */
+	[  196 ] = { "AUTHOR",                              "creator"                             },/* Creator */
+	[   37 ] = { "CORRESPONDENT",                       "crp"                                 },
+	[   44 ] = { "CORRECTOR",                           "crr"                                 },
+	[  146 ] = { "COURT_REPORTER",                      "crt"                                 },
+	[  155 ] = { "CONSULTANT",                          "csl"                                 },
+	[  273 ] = { "CONSULTANT",                          "csp"                                 },/* Consultant to a project */
+	[   79 ] = { "COSTUME_DESIGNER",                    "cst"                                 },
+	[  104 ] = { "CONTRIBUTOR",                         "ctb"                                 },
+	[  179 ] = { "CONTESTEE-APPELLEE",                  "cte"                                 },
+	[  125 ] = { "CARTOGRAPHER",                        "ctg"                                 },
+	[  262 ] = { "CONTRACTOR",                          "ctr"                                 },
+	[  236 ] = { "CONTESTEE",                           "cts"                                 },
+	[  261 ] = { "CONTESTEE-APPELLANT",                 "ctt"                                 },
+	[  222 ] = { "CURATOR",                             "cur"                                 },
+	[   96 ] = { "COMMENTATOR",                         "cwt"                                 },/* Commentator for written text */
+	[  271 ] = { "DISTRIBUTION_PLACE",                  "dbp"                                 },
+	[   29 ] = { "DEGREEGRANTOR",                       "degree grantor"                      },/* Degree granting institution */
+	[  169 ] = { "DEFENDANT",                           "dfd"                                 },
+	[  253 ] = { "DEFENDANT-APPELLEE",                  "dfe"                                 },
+	[   99 ] = { "DEFENDANT-APPELLANT",                 "dft"                                 },
+	[  228 ] = { "DEGREEGRANTOR",                       "dgg"                                 },/* Degree granting institution */
+	[  162 ] = { "DEGREE_SUPERVISOR",                   "dgs"                                 },
+	[   18 ] = { "DISSERTANT",                          "dis"                                 },
+	[  177 ] = { "DELINEATOR",                          "dln"                                 },
+	[  188 ] = { "DANCER",                              "dnc"                                 },
+	[  227 ] = { "DONOR",                               "dnr"                                 },
+	[  111 ] = { "DEPICTED",                            "dpc"                                 },
+	[   85 ] = { "DEPOSITOR",                           "dpt"                                 },
+	[   10 ] = { "DRAFTSMAN",                           "drm"                                 },
+	[  213 ] = { "DIRECTOR",                            "drt"                                 },
+	[  122 ] = { "DESIGNER",                            "dsr"                                 },
+	[  176 ] = { "DISTRIBUTOR",                         "dst"                                 },
+	[  206 ] = { "DATA_CONTRIBUTOR",                    "dtc"                                 },
+	[  239 ] = { "DEDICATEE",                           "dte"                                 },
+	[   16 ] = { "DATA_MANAGER",                        "dtm"                                 },
+	[  139 ] = { "DEDICATOR",                           "dto"                                 },
+	[   47 ] = { "AUTHOR",                              "dub"                                 },/* Dubious author */
+	[  274 ] = { "EDITOR",                              "edc"                                 },/* Editor of compilation */
+	[    5 ] = { "EDITOR",                              "edm"                                 },/* Editor of moving image work */
+	[  209 ] = { "EDITOR",                              "edt"                                 },
+	[  156 ] = { "ENGRAVER",                            "egr"                                 },
+	[   36 ] = { "ELECTRICIAN",                         "elg"                                 },
+	[   70 ] = { "ELECTROTYPER",                        "elt"                                 },
+	[  268 ] = { "ENGINEER",                            "eng"                                 },
+	[  272 ] = { "ENACTING_JURISDICTION",               "enj"                                 },
+	[  193 ] = { "ETCHER",                              "etr"                                 },
+	[  168 ] = { "EVENT_PLACE",                         "evp"                                 },
+	[  207 ] = { "EXPERT",                              "exp"                                 },
+	[  263 ] = { "FACSIMILIST",                         "fac"                                 },
+	[   35 ] = { "FILM_DISTRIBUTOR",                    "fds"                                 },
+	[   38 ] = { "FIELD_DIRECTOR",                      "fld"                                 },
+	[  123 ] = { "EDITOR",                              "flm"                                 },/* Film editor */
+	[  252 ] = { "DIRECTOR",                            "fmd"                                 },/* Film director */
+	[  102 ] = { "FILMMAKER",                           "fmk"                                 },
+	[  212 ] = { "FORMER_OWNER",                        "fmo"                                 },
+	[  175 ] = { "PRODUCER",                            "fmp"                                 },/* Film producer */
+	[   23 ] = { "FUNDER",                              "fnd"                                 },
+	[  208 ] = { "FIRST_PARTY",                         "fpy"                                 },
+	[  124 ] = { "FORGER",                              "frg"                                 },
+	[  199 ] = { "GEOGRAPHIC_INFORMATION_SPECIALIST",   "gis"                                 },
+	[   51 ] = { "GRAPHIC_TECHNICIAN",                  "grt"                                 },
+	[    0 ] = { "HOST_INSTITUTION",                    "his"                                 },
+	[   86 ] = { "HONOREE",                             "hnr"                                 },
+	[  249 ] = { "HOST",                                "hst"                                 },
+	[  233 ] = { "ILLUSTRATOR",                         "ill"                                 },
+	[  120 ] = { "ILLUMINATOR",                         "ilu"                                 },
+	[   89 ] = { "INSCRIBER",                           "ins"                                 },
+	[  110 ] = { "INVENTOR",                            "inv"                                 },
+	[  183 ] = { "ISSUING_BODY",                        "isb"                                 },
+	[  189 ] = { "MUSICIAN",                            "itr"                                 },/* Instrumentalist */
+	[   11 ] = { "INTERVIEWEE",                         "ive"                                 },
+	[   42 ] = { "INTERVIEWER",                         "ivr"                                 },
+	[  219 ] = { "JUDGE",                               "jud"                                 },
+	[   93 ] = { "JURISDICTION_GOVERNED",               "jug"                                 },
+	[  210 ] = { "LABORATORY",                          "lbr"                                 },
+	[  153 ] = { "AUTHOR",                              "lbt"                                 },/* Librettist */
+	[  202 ] = { "LABORATORY_DIRECTOR",                 "ldr"                                 },
+	[  166 ] = { "LEAD",                                "led"                                 },
+	[   75 ] = { "LIBELEE-APPELLEE",                    "lee"                                 },
+	[   14 ] = { "LIBELEE",                             "lel"                                 },
+	[  117 ] = { "LENDER",                              "len"                                 },
+	[  215 ] = { "LIBELEE-APPELLANT",                   "let"                                 },
+	[  221 ] = { "LIGHTING_DESIGNER",                   "lgd"                                 },
+	[  131 ] = { "LIBELANT-APPELLEE",                   "lie"                                 },
+	[  241 ] = { "LIBELANT",                            "lil"                                 },
+	[  260 ] = { "LIBELANT-APPELLANT",                  "lit"                                 },
+	[  205 ] = { "LANDSCAPE_ARCHITECT",                 "lsa"                                 },
+	[  224 ] = { "LICENSEE",                            "lse"                                 },
+	[  203 ] = { "LICENSOR",                            "lso"                                 },
+	[   27 ] = { "LITHOGRAPHER",                        "ltg"                                 },
+	[  259 ] = { "AUTHOR",                              "lyr"                                 },/* Lyricist */
+	[   40 ] = { "MUSIC_COPYIST",                       "mcp"                                 },
+	[  250 ] = { "METADATA_CONTACT",                    "mdc"                                 },
+	[   80 ] = { "MEDIUM",                              "med"                                 },
+	[   24 ] = { "MANUFACTURE_PLACE",                   "mfp"                                 },
+	[  130 ] = { "MANUFACTURER",                        "mfr"                                 },
+	[  152 ] = { "MODERATOR",                           "mod"                                 },
+	[    7 ] = { "THESIS_EXAMINER",                     "mon"                                 },/* Monitor */
+	[  225 ] = { "MARBLER",                             "mrb"                                 },
+	[  105 ] = { "EDITOR",                              "mrk"                                 },/* Markup editor */
+	[  165 ] = { "MUSICAL_DIRECTOR",                    "msd"                                 },
+	[  275 ] = { "METAL-ENGRAVER",                      "mte"                                 },
+	[   81 ] = { "MINUTE_TAKER",                        "mtk"                                 },
+	[   73 ] = { "MUSICIAN",                            "mus"                                 },
+	[  170 ] = { "NARRATOR",                            "nrt"                                 },
+	[  258 ] = { "THESIS_OPPONENT",                     "opn"                                 },/* Opponent */
+	[   57 ] = { "ORIGINATOR",                          "org"                                 },
+	[   83 ] = { "ORGANIZER",                           "organizer of meeting"                },
+	[  159 ] = { "ORGANIZER",                           "orm"                                 },
+	[  256 ] = { "ONSCREEN_PRESENTER",                  "osp"                                 },
+	[  197 ] = { "THESIS_OTHER",                        "oth"                                 },/* Other */
+	[  107 ] = { "OWNER",                               "own"                                 },
+	[  223 ] = { "PANELIST",                            "pan"                                 },
+	[  143 ] = { "PATRON",                              "pat"                                 },
+	[  133 ] = { "ASSIGNEE",                            "patent holder"                       },
+	[    3 ] = { "PUBLISHING_DIRECTOR",                 "pbd"                                 },
+	[    8 ] = { "PUBLISHER",                           "pbl"                                 },
+	[  108 ] = { "PROJECT_DIRECTOR",                    "pdr"                                 },
+	[  255 ] = { "PROOFREADER",                         "pfr"                                 },
+	[  216 ] = { "PHOTOGRAPHER",                        "pht"                                 },
+	[  198 ] = { "PLATEMAKER",                          "plt"                                 },
+	[   61 ] = { "PERMITTING_AGENCY",                   "pma"                                 },
+	[   32 ] = { "PRODUCTION_MANAGER",                  "pmn"                                 },
+	[   31 ] = { "PRINTER_OF_PLATES",                   "pop"                                 },
+	[  211 ] = { "PAPERMAKER",                          "ppm"                                 },
+	[    4 ] = { "PUPPETEER",                           "ppt"                                 },
+	[   68 ] = { "PRAESES",                             "pra"                                 },
+	[  247 ] = { "PROCESS_CONTRACT",                    "prc"                                 },
+	[  118 ] = { "PRODUCTION_PERSONNEL",                "prd"                                 },
+	[   72 ] = { "PRESENTER",                           "pre"                                 },
+	[   94 ] = { "PERFORMER",                           "prf"                                 },
+	[  119 ] = { "AUTHOR",                              "prg"                                 },/* Programmer */
+	[  192 ] = { "PRINTMAKER",                          "prm"                                 },
+	[  220 ] = { "PRODUCTION_COMPANY",                  "prn"                                 },
+	[  267 ] = { "PRODUCER",                            "pro"                                 },
+	[   26 ] = { "PRODUCTION_PLACE",                    "prp"                                 },
+	[  134 ] = { "PRODUCTION_DESIGNER",                 "prs"                                 },
+	[   60 ] = { "PRINTER",                             "prt"                                 },
+	[   21 ] = { "PROVIDER",                            "prv"                                 },
+	[  231 ] = { "PATENT_APPLICANT",                    "pta"                                 },
+	[  109 ] = { "PLAINTIFF-APPELLEE",                  "pte"                                 },
+	[   49 ] = { "PLAINTIFF",                           "ptf"                                 },
+	[   45 ] = { "ASSIGNEE",                            "pth"                                 },/* Patent holder */
+	[   25 ] = { "PLAINTIFF-APPELLANT",                 "ptt"                                 },
+	[   82 ] = { "PUBLICATION_PLACE",                   "pup"                                 },
+	[   20 ] = { "RUBRICATOR",                          "rbr"                                 },
+	[   17 ] = { "RECORDIST",                           "rcd"                                 },
+	[  147 ] = { "RECORDING_ENGINEER",                  "rce"                                 },
+	[   46 ] = { "ADDRESSEE",                           "rcp"                                 },/* Recipient */
+	[  195 ] = { "RADIO_DIRECTOR",                      "rdd"                                 },
+	[  234 ] = { "REDAKTOR",                            "red"                                 },
+	[    1 ] = { "RENDERER",                            "ren"                                 },
+	[   88 ] = { "RESEARCHER",                          "res"                                 },
+	[   98 ] = { "REVIEWER",                            "rev"                                 },
+	[  194 ] = { "RADIO_PRODUCER",                      "rpc"                                 },
+	[  246 ] = { "REPOSITORY",                          "rps"                                 },
+	[  269 ] = { "REPORTER",                            "rpt"                                 },
+	[   15 ] = { "RESPONSIBLE_PARTY",                   "rpy"                                 },
+	[   62 ] = { "RESPONDENT-APPELLEE",                 "rse"                                 },
+	[   33 ] = { "RESTAGER",                            "rsg"                                 },
+	[  164 ] = { "RESPONDENT",                          "rsp"                                 },
+	[  103 ] = { "RESTORATIONIST",                      "rsr"                                 },
+	[  245 ] = { "RESPONDENT-APPELLANT",                "rst"                                 },
+	[  141 ] = { "RESEARCH_TEAM_HEAD",                  "rth"                                 },
+	[   67 ] = { "RESEARCH_TEAM_MEMBER",                "rtm"                                 },
+	[  237 ] = { "SCIENTIFIC_ADVISOR",                  "sad"                                 },
+	[   22 ] = { "SCENARIST",                           "sce"                                 },
+	[  144 ] = { "SCULPTOR",                            "scl"                                 },
+	[  135 ] = { "SCRIBE",                              "scr"                                 },
+	[  145 ] = { "SOUND_DESIGNER",                      "sds"                                 },
+	[   77 ] = { "SECRETARY",                           "sec"                                 },
+	[  106 ] = { "STAGE_DIRECTOR",                      "sgd"                                 },
+	[  257 ] = { "SIGNER",                              "sgn"                                 },
+	[  178 ] = { "SUPPORTING_HOST",                     "sht"                                 },
+	[  277 ] = { "SELLER",                              "sll"                                 },
+	[  173 ] = { "SINGER",                              "sng"                                 },
+	[   64 ] = { "SPEAKER",                             "spk"                                 },
+	[   12 ] = { "SPONSOR",                             "spn"                                 },
+	[   87 ] = { "SECOND_PARTY",                        "spy"                                 },
+	[   48 ] = { "SURVEYOR",                            "srv"                                 },
+	[  201 ] = { "SET_DESIGNER",                        "std"                                 },
+	[  151 ] = { "SETTING",                             "stg"                                 },
+	[  235 ] = { "STORYTELLER",                         "stl"                                 },
+	[    2 ] = { "STAGE_MANAGER",                       "stm"                                 },
+	[  116 ] = { "STANDARDS_BODY",                      "stn"                                 },
+	[  180 ] = { "STEREOTYPER",                         "str"                                 },
+	[   71 ] = { "TECHNICAL_DIRECTOR",                  "tcd"                                 },
+	[  187 ] = { "TEACHER",                             "tch"                                 },
+	[   28 ] = { "THESIS_ADVISOR",                      "ths"                                 },
+	[   63 ] = { "TELEVISION_DIRECTOR",                 "tld"                                 },
+	[  149 ] = { "TELEVISION_PRODUCER",                 "tlp"                                 },
+	[   65 ] = { "TRANSCRIBER",                         "trc"                                 },
+	[  264 ] = { "TRANSLATOR",                          "translator"                          },
+	[   52 ] = { "TRANSLATOR",                          "trl"                                 },
+	[   74 ] = { "TYPE_DIRECTOR",                       "tyd"                                 },
+	[   53 ] = { "TYPOGRAPHER",                         "tyg"                                 },
+	[   39 ] = { "UNIVERSITY_PLACE",                    "uvp"                                 },
+	[  214 ] = { "VOICE_ACTOR",                         "vac"                                 },
+	[  243 ] = { "VIDEOGRAPHER",                        "vdg"                                 },
+	[  112 ] = { "VOCALIST",                            "voc"                                 },
+	[  138 ] = { "AUTHOR",                              "wac"                                 },/* Writer of added commentary */
+	[   58 ] = { "AUTHOR",                              "wal"                                 },/* Writer of added lyrics */
+	[  167 ] = { "AUTHOR",                              "wam"                                 },/* Writer of accompanying material */
+	[   13 ] = { "AUTHOR",                              "wat"                                 },/* Writer of added text */
+	[  163 ] = { "WOODCUTTER",                          "wdc"                                 },
+	[   41 ] = { "WOOD_ENGRAVER",                       "wde"                                 },
+	[  226 ] = { "INTROAUTHOR",                         "win"                                 },/* Writer of introduction */
+	[    9 ] = { "WITNESS",                             "wit"                                 },
+	[   69 ] = { "INTROAUTHOR",                         "wpr"                                 },/* Writer of preface */
+	[  278 ] = { "AUTHOR",                              "wst"                                 },/* Writer of supplementary textual content */
 };
+static const int marc_relators_disp[94] = {
+	9, 64, 24, 7, 14, 4, -4, 4, 42, 3,
+	5, -46, 4, 27, 71, -94, 19, 3, 3, 0,
+	2, 15, 79, 1, 1, 4, 11, 1, 12, -142,
+	2, 18, 3, 264, 19, 1, 13, -147, 3, 0,
+	4, 31, 30, 15, 36, 5, 2, 9, 67, 36,
+	27, 4, 29, 284, 283, 22, 12, 2, 45, -158,
+	129, 6, 3, 31, 6, -203, 133, 0, -221, -223,
+	6, 0, 3, 35, 305, 100, 108, 64, 7, -273,
+	0, 1, 16, 218, 72, 45, 4, 2, 88, 27,
+	-278, 1, 5, 133,
+};
+static const mph marc_relators_hash = { 279, 94, marc_relators_disp, MPH_CASE };
 
 char *
 marc_convert_relators( const char *query )
 {
 	unsigned int n;
 
-	n = calculate_hash_char( query, marc_relators_hash_size );
-	if ( marc_relators[n].abbreviation==NULL ) return NULL;
+	n = mph_slot( &marc_relators_hash, query );
 	if ( !strcmp( query, marc_relators[n].abbreviation ) ) return marc_relators[n].internal_name;
-	else if ( marc_relators[n+1].abbreviation && !strcmp( query, marc_relators[n+1].abbreviation ) ) return marc_relators[n+1].internal_name;
 	else return NULL;
 }
 /*
@@ -471,399 +476,411 @@ marc_convert_relators( const char *query )
 
 /* www.loc.gov/marc/countries/countries_code.html */
 
-static const unsigned int marc_country_hash_size = 2018;
-static const marc_trans marc_country[2018] = {
-	[ 0 ... 2017 ] = { NULL, NULL },
-	[ 1131 ] = { "Albania",                             "aa"                                  },
-	[ 2015 ] = { "Alberta",                             "abc"                                 },
-	[ 1252 ] = { "Ashmore and Cartier Islands",         "ac"                                  },/* discontinued */
-	[ 1697 ] = { "Australian Capital Territory",        "aca"                                 },
-	[ 1514 ] = { "Algeria",                             "ae"                                  },
-	[ 1807 ] = { "Afghanistan",                         "af"                                  },
-	[ 1677 ] = { "Argentina",                           "ag"                                  },
-	[  737 ] = { "Armenia (Republic)",                  "ai"                                  },
-	[  579 ] = { "Armenian S.S.R.",                     "air"                                 },/* discontinued */
-	[ 1477 ] = { "Azerbaijan",                          "aj"                                  },
-	[  350 ] = { "Azerbaijan S.S.R.",                   "ajr"                                 },/* discontinued */
-	[ 1069 ] = { "Alaska",                              "aku"                                 },
-	[  702 ] = { "Alabama",                             "alu"                                 },
-	[  747 ] = { "Anguilla",                            "am"                                  },
-	[ 1438 ] = { "Andorra",                             "an"                                  },
-	[  529 ] = { "Angola",                              "ao"                                  },
-	[  816 ] = { "Antigua and Barbuda",                 "aq"                                  },
-	[ 1755 ] = { "Arkansas",                            "aru"                                 },
-	[ 1661 ] = { "American Samoa",                      "as"                                  },
-	[ 1321 ] = { "Australia",                           "at"                                  },
-	[  722 ] = { "Austria",                             "au"                                  },
-	[ 1865 ] = { "Aruba",                               "aw"                                  },
-	[ 1395 ] = { "Antarctica",                          "ay"                                  },
-	[  742 ] = { "Arizona",                             "azu"                                 },
-	[ 1314 ] = { "Bahrain",                             "ba"                                  },
-	[ 1346 ] = { "Barbados",                            "bb"                                  },
-	[   88 ] = { "British Columbia",                    "bcc"                                 },
-	[ 1976 ] = { "Burundi",                             "bd"                                  },
-	[ 1427 ] = { "Belgium",                             "be"                                  },
-	[  238 ] = { "Bahamas",                             "bf"                                  },
-	[ 1201 ] = { "Bangladesh",                          "bg"                                  },
-	[ 1315 ] = { "Belize",                              "bh"                                  },
-	[  527 ] = { "British Indian Ocean Territory",      "bi"                                  },
-	[  178 ] = { "Brazil",                              "bl"                                  },
-	[  980 ] = { "Bermuda Islands",                     "bm"                                  },
-	[ 1761 ] = { "Bosnia and Herezegovina",             "bn"                                  },
-	[ 1333 ] = { "Bolivia",                             "bo"                                  },
-	[ 1032 ] = { "Solomon Islands",                     "bp"                                  },
-	[ 1635 ] = { "Burma",                               "br"                                  },
-	[  808 ] = { "Botswana",                            "bs"                                  },
-	[ 1730 ] = { "Bhutan",                              "bt"                                  },
-	[ 1125 ] = { "Bulgaria",                            "bu"                                  },
-	[ 1036 ] = { "Bouvet Island",                       "bv"                                  },
-	[  367 ] = { "Belarus",                             "bw"                                  },
-	[ 1493 ] = { "Byelorussian S.S.R",                  "bwr"                                 },/* discontinued */
-	[ 1373 ] = { "Brunei",                              "bx"                                  },
-	[  395 ] = { "Caribbean Netherlands",               "ca"                                  },
-	[ 1318 ] = { "California",                          "cau"                                 },
-	[ 1329 ] = { "Cambodia",                            "cb"                                  },
-	[ 1418 ] = { "China",                               "cc"                                  },
-	[  778 ] = { "Chad",                                "cd"                                  },
-	[ 1844 ] = { "Sri Lanka",                           "ce"                                  },
-	[  885 ] = { "Congo (Brazzaville)",                 "cf"                                  },
-	[ 1749 ] = { "Congo (Democratic Republic)",         "cg"                                  },
-	[  218 ] = { "China (Republic : 1949- )",           "ch"                                  },
-	[ 1335 ] = { "Croatia",                             "ci"                                  },
-	[  720 ] = { "Cayman Islands",                      "cj"                                  },
-	[  399 ] = { "Colombia",                            "ck"                                  },
-	[  584 ] = { "Chile",                               "cl"                                  },
-	[  817 ] = { "Cameroon",                            "cm"                                  },
-	[  710 ] = { "Canada",                              "cn"                                  },/* discontinued */
-	[  580 ] = { "Curacao",                             "co"                                  },
-	[ 1989 ] = { "Colorado",                            "cou"                                 },
-	[  404 ] = { "Canton and Enderbury Islands",        "cp"                                  },/* discontinued */
-	[  650 ] = { "Comoros",                             "cq"                                  },
-	[  944 ] = { "Costa Rica",                          "cr"                                  },
-	[ 1485 ] = { "Czechoslovakia",                      "cs"                                  },/* discontinued */
-	[ 1960 ] = { "Connecticut",                         "ctu"                                 },
-	[  275 ] = { "Cuba",                                "cu"                                  },
-	[ 1876 ] = { "Cabo Verde",                          "cv"                                  },
-	[ 1056 ] = { "Cook Islands",                        "cw"                                  },
-	[ 1642 ] = { "Central African Republic",            "cx"                                  },
-	[ 1512 ] = { "Cyprus",                              "cy"                                  },
-	[  242 ] = { "Canal Zone",                          "cz"                                  },/* discontinued */
-	[  613 ] = { "District of Columbia",                "dcu"                                 },
-	[ 1070 ] = { "Delaware",                            "deu"                                 },
-	[ 1124 ] = { "Denmark",                             "dk"                                  },
-	[  368 ] = { "Benin",                               "dm"                                  },
-	[ 1286 ] = { "Dominica",                            "dq"                                  },
-	[ 1614 ] = { "Dominican Republic",                  "dr"                                  },
-	[  792 ] = { "Eritrea",                             "ea"                                  },
-	[ 1988 ] = { "Ecuador",                             "ec"                                  },
-	[  462 ] = { "Equatorial Guinea",                   "eg"                                  },
-	[  469 ] = { "Timor-Leste",                         "em"                                  },
-	[ 1695 ] = { "England",                             "enk"                                 },
-	[ 1482 ] = { "Estonia",                             "er"                                  },
-	[  859 ] = { "Estonia",                             "err"                                 },/* discontinued */
-	[ 1419 ] = { "El Salvador",                         "es"                                  },
-	[ 1473 ] = { "Ethiopia",                            "et"                                  },
-	[  820 ] = { "Faroe Islands",                       "fa"                                  },
-	[  840 ] = { "French Guiana",                       "fg"                                  },
-	[ 1412 ] = { "Finland",                             "fi"                                  },
-	[  562 ] = { "Fiji",                                "fj"                                  },
-	[ 1857 ] = { "Falkland Islands",                    "fk"                                  },
-	[ 1927 ] = { "Florida",                             "flu"                                 },
-	[ 1543 ] = { "Micronesia (Federated States)",       "fm"                                  },
-	[  188 ] = { "French Polynesia",                    "fp"                                  },
-	[ 1302 ] = { "France",                              "fr"                                  },
-	[  149 ] = { "Terres australes et antarctiques francaises", "fs"                                  },
-	[  632 ] = { "Djibouti",                            "ft"                                  },
-	[  818 ] = { "Georgia",                             "gau"                                 },
-	[   39 ] = { "Kiribati",                            "gb"                                  },
-	[ 1859 ] = { "Grenada",                             "gd"                                  },
-	[ 1159 ] = { "East Germany",                        "ge"                                  },/* discontinued */
-	[  658 ] = { "Guernsey",                            "gg"                                  },
-	[ 1996 ] = { "Ghana",                               "gh"                                  },
-	[  753 ] = { "Gibraltar",                           "gi"                                  },
-	[ 1376 ] = { "Greenland",                           "gl"                                  },
-	[ 1962 ] = { "Gambia",                              "gm"                                  },
-	[ 1445 ] = { "Gilbert and Ellice Islands",          "gn"                                  },/* discontinued */
-	[ 1066 ] = { "Gabon",                               "go"                                  },
-	[  193 ] = { "Guadeloupe",                          "gp"                                  },
-	[ 1290 ] = { "Greece",                              "gr"                                  },
-	[ 1826 ] = { "Georgia (Republic)",                  "gs"                                  },
-	[  714 ] = { "Georgian S.S.R",                      "gsr"                                 },/* discontinued */
-	[  546 ] = { "Guatemala",                           "gt"                                  },
-	[  559 ] = { "Guam",                                "gu"                                  },
-	[ 1862 ] = { "Guinea",                              "gv"                                  },
-	[  150 ] = { "Germany",                             "gw"                                  },
-	[ 1941 ] = { "Guyana",                              "gy"                                  },
-	[  973 ] = { "Gaza Strip",                          "gz"                                  },
-	[  221 ] = { "Hawaii",                              "hiu"                                 },
-	[ 1692 ] = { "Hong Kong",                           "hk"                                  },/* discontinued */
-	[  883 ] = { "Heard and McDonald Islands",          "hm"                                  },
-	[ 1577 ] = { "Honduras",                            "ho"                                  },
-	[ 1298 ] = { "Haiti",                               "ht"                                  },
-	[ 1306 ] = { "Hungary",                             "hu"                                  },
-	[ 1609 ] = { "Iowa",                                "iau"                                 },
-	[  987 ] = { "Iceland",                             "ic"                                  },
-	[ 1379 ] = { "Idaho",                               "idu"                                 },
-	[ 1987 ] = { "Ireland",                             "ie"                                  },
-	[ 1643 ] = { "India",                               "ii"                                  },
-	[    3 ] = { "Illinois",                            "ilu"                                 },
-	[ 1149 ] = { "Isle of Man",                         "im"                                  },
-	[ 1089 ] = { "Indiana",                             "inu"                                 },
-	[  796 ] = { "Indonesia",                           "io"                                  },
-	[ 1883 ] = { "Iraq",                                "iq"                                  },
-	[  312 ] = { "Iran",                                "ir"                                  },
-	[ 1884 ] = { "Israel",                              "is"                                  },
-	[  699 ] = { "Italy",                               "it"                                  },
-	[  829 ] = { "Israel-Syria Demilitarized Zones",    "iu"                                  },/* discontinued */
-	[ 1838 ] = { "Cote d'Ivoire",                       "iv"                                  },
-	[ 1535 ] = { "Isreal-Jordan Demilitarized Zones",   "iw"                                  },/* discontinued */
-	[ 1456 ] = { "Iraq-Saudi Arabia Neutral Zone",      "iy"                                  },
-	[ 1037 ] = { "Japan",                               "ja"                                  },
-	[  746 ] = { "Jersey",                              "je"                                  },
-	[ 1190 ] = { "Johnston Atoll",                      "ji"                                  },
-	[ 1580 ] = { "Jamaica",                             "jm"                                  },
-	[  283 ] = { "Jan Mayen",                           "jn"                                  },/* discontinued */
-	[ 1011 ] = { "Jordan",                              "jo"                                  },
-	[  607 ] = { "Kenya",                               "ke"                                  },
-	[  349 ] = { "Kyrgyzstan",                          "kg"                                  },
-	[ 1926 ] = { "Kirghiz S.S.R.",                      "kgr"                                 },
-	[ 1389 ] = { "North Korea",                         "kn"                                  },
-	[ 1068 ] = { "South Korea",                         "ko"                                  },
-	[ 1155 ] = { "Kansas",                              "ksu"                                 },
-	[ 1496 ] = { "Kuwait",                              "ku"                                  },
-	[ 1917 ] = { "Kosovo",                              "kv"                                  },
-	[ 1429 ] = { "Kentucky",                            "kyu"                                 },
-	[ 1038 ] = { "Kazakhstan",                          "kz"                                  },
-	[  266 ] = { "Kazakh S.S.R.",                       "kzr"                                 },/* discontinued */
-	[  672 ] = { "Louisiana",                           "lau"                                 },
-	[ 1898 ] = { "Liberia",                             "lb"                                  },
-	[   25 ] = { "Lebanon",                             "le"                                  },
-	[ 1925 ] = { "Liechtenstein",                       "lh"                                  },
-	[ 1803 ] = { "Lithuania",                           "li"                                  },
-	[ 1603 ] = { "Lithuania",                           "lir"                                 },/* discontinued */
-	[ 1768 ] = { "Central and Southern Line Islands",   "ln"                                  },/* discontinued */
-	[ 1735 ] = { "Lesotho",                             "lo"                                  },
-	[  227 ] = { "Laos",                                "ls"                                  },
-	[ 1780 ] = { "Luxembourg",                          "lu"                                  },
-	[ 1355 ] = { "Latvia",                              "lv"                                  },
-	[  444 ] = { "Latvia",                              "lvr"                                 },/* discontinued */
-	[   17 ] = { "Libya",                               "ly"                                  },
-	[  854 ] = { "Massachusetts",                       "mau"                                 },
-	[ 1639 ] = { "Manitoba",                            "mbc"                                 },
-	[  646 ] = { "Monaco",                              "mc"                                  },
-	[  287 ] = { "Maryland",                            "mdu"                                 },
-	[ 1230 ] = { "Maine",                               "meu"                                 },
-	[  922 ] = { "Mauritius",                           "mf"                                  },
-	[  298 ] = { "Madagascar",                          "mg"                                  },
-	[  422 ] = { "Macao",                               "mh"                                  },/* discontinued */
-	[ 1819 ] = { "Michigan",                            "miu"                                 },
-	[  862 ] = { "Montserrat",                          "mj"                                  },
-	[  219 ] = { "Oman",                                "mk"                                  },
-	[ 1717 ] = { "Mali",                                "ml"                                  },
-	[  774 ] = { "Malta",                               "mm"                                  },
-	[   41 ] = { "Minnesota",                           "mnu"                                 },
-	[ 1541 ] = { "Montenegro",                          "mo"                                  },
-	[ 1553 ] = { "Missouri",                            "mou"                                 },
-	[  112 ] = { "Mongolia",                            "mp"                                  },
-	[  954 ] = { "Martinique",                          "mq"                                  },
-	[  411 ] = { "Morocco",                             "mr"                                  },
-	[ 1504 ] = { "Mississippi",                         "msu"                                 },
-	[ 1820 ] = { "Montana",                             "mtu"                                 },
-	[  568 ] = { "Mauritania",                          "mu"                                  },
-	[   51 ] = { "Moldova",                             "mv"                                  },
-	[ 1231 ] = { "Moldavian S.S.R.",                    "mvr"                                 },/* discontinued */
-	[  869 ] = { "Malawi",                              "mw"                                  },
-	[ 1364 ] = { "Mexico",                              "mx"                                  },
-	[  327 ] = { "Malaysia",                            "my"                                  },
-	[ 1720 ] = { "Mozambique",                          "mz"                                  },
-	[  893 ] = { "Netherlands Antilles",                "na"                                  },/* discontinued */
-	[ 1830 ] = { "Nebraska",                            "nbu"                                 },
-	[  950 ] = { "North Carolina",                      "ncu"                                 },
-	[ 1168 ] = { "North Dakota",                        "ndu"                                 },
-	[ 1200 ] = { "Netherlands",                         "ne"                                  },
-	[ 1912 ] = { "Newfoundland and Labrador",           "nfc"                                 },
-	[  262 ] = { "Niger",                               "ng"                                  },
-	[  222 ] = { "New Hampshire",                       "nhu"                                 },
-	[ 1679 ] = { "Northern Ireland",                    "nik"                                 },
-	[ 1872 ] = { "New Jersey",                          "nju"                                 },
-	[ 1751 ] = { "New Brunswick",                       "nkc"                                 },
-	[ 1959 ] = { "New Caledonia",                       "nl"                                  },
-	[ 1825 ] = { "Northern Mariana Islands",            "nm"                                  },/* discontinued */
-	[ 1742 ] = { "New Mexico",                          "nmu"                                 },
-	[  752 ] = { "Vanuatu",                             "nn"                                  },
-	[ 1467 ] = { "Norway",                              "no"                                  },
-	[ 1775 ] = { "Nepal",                               "np"                                  },
-	[ 1086 ] = { "Nicaragua",                           "nq"                                  },
-	[   42 ] = { "Nigeria",                             "nr"                                  },
-	[ 1262 ] = { "Nova Scotia",                         "nsc"                                 },
-	[ 1956 ] = { "Northwest Territories",               "ntc"                                 },
-	[  934 ] = { "Nauru",                               "nu"                                  },
-	[ 1928 ] = { "Nunavut",                             "nuc"                                 },
-	[  270 ] = { "Nevada",                              "nvu"                                 },
-	[ 1509 ] = { "Northern Mariana Islands",            "nw"                                  },
-	[  999 ] = { "Norfolk Island",                      "nx"                                  },
-	[  200 ] = { "New York",                            "nyu"                                 },
-	[  530 ] = { "New Zealand",                         "nz"                                  },
-	[  220 ] = { "Ohio",                                "ohu"                                 },
-	[ 1980 ] = { "Oklahoma",                            "oku"                                 },
-	[  427 ] = { "Ontario",                             "onc"                                 },
-	[ 1021 ] = { "Oregon",                              "oru"                                 },
-	[  970 ] = { "Mayotte",                             "ot"                                  },
-	[ 1180 ] = { "Pennsylvania",                        "pau"                                 },
-	[  606 ] = { "Pitcairn Island",                     "pc"                                  },
-	[ 1693 ] = { "Peru",                                "pe"                                  },
-	[  482 ] = { "Paracel Islands",                     "pf"                                  },
-	[ 1186 ] = { "Guinea-Bissau",                       "pg"                                  },
-	[ 1331 ] = { "Philippines",                         "ph"                                  },
-	[  515 ] = { "Prince Edward Island",                "pic"                                 },
-	[ 1823 ] = { "Pakistan",                            "pk"                                  },
-	[  564 ] = { "Poland",                              "pl"                                  },
-	[ 1958 ] = { "Panama",                              "pn"                                  },
-	[ 2016 ] = { "Portugal",                            "po"                                  },
-	[  184 ] = { "Papua New Guinea",                    "pp"                                  },
-	[ 1529 ] = { "Puerto Rico",                         "pr"                                  },
-	[  138 ] = { "Portuguese Timor",                    "pt"                                  },
-	[   78 ] = { "Palau",                               "pw"                                  },
-	[  381 ] = { "Paraguay",                            "py"                                  },
-	[   10 ] = { "Qatar",                               "qa"                                  },
-	[  359 ] = { "Queensland",                          "qea"                                 },
-	[ 1289 ] = { "Quebec",                              "quc"                                 },
-	[ 1071 ] = { "Serbia",                              "rb"                                  },
-	[ 1450 ] = { "Reunion",                             "re"                                  },
-	[ 1330 ] = { "Zimbabwe",                            "rh"                                  },
-	[   97 ] = { "Romania",                             "rm"                                  },
-	[  864 ] = { "Russian Federation",                  "ru"                                  },
-	[ 1387 ] = { "Russian S.F.S.R",                     "rur"                                 },/* discontinued */
-	[  228 ] = { "Rwanda",                              "rw"                                  },
-	[  377 ] = { "Southern Ryukyu Islands",             "ry"                                  },/* discontinued */
-	[ 1558 ] = { "South Africa",                        "sa"                                  },
-	[ 1770 ] = { "Svalbard",                            "sb"                                  },/* discontinued */
-	[ 1694 ] = { "Saint_Barthelemy",                    "sc"                                  },
-	[ 1198 ] = { "South Carolina",                      "scu"                                 },
-	[  586 ] = { "South Sudan",                         "sd"                                  },
-	[ 1397 ] = { "Seychelles",                          "se"                                  },
-	[   27 ] = { "Sao Tome and Principe",               "sf"                                  },
-	[  335 ] = { "Senegal",                             "sg"                                  },
-	[ 1861 ] = { "Spanish North Africa",                "sh"                                  },
-	[    5 ] = { "Singapore",                           "si"                                  },
-	[  126 ] = { "Sudan",                               "sj"                                  },
-	[  430 ] = { "Sikkim",                              "sk"                                  },/* discontinued */
-	[  667 ] = { "Sierra Leone",                        "sl"                                  },
-	[ 1129 ] = { "San Marino",                          "sm"                                  },
-	[  647 ] = { "Sint Maarten",                        "sn"                                  },
-	[  107 ] = { "Saskatchewan",                        "snc"                                 },
-	[ 1567 ] = { "Somalia",                             "so"                                  },
-	[   65 ] = { "Spain",                               "sp"                                  },
-	[ 1019 ] = { "Eswatini",                            "sq"                                  },
-	[  656 ] = { "Surinam",                             "sr"                                  },
-	[ 1022 ] = { "Western Sahara",                      "ss"                                  },
-	[  609 ] = { "Saint-Martin",                        "st"                                  },
-	[ 1478 ] = { "Scotland",                            "stk"                                 },
-	[ 1323 ] = { "Saudi Arabia",                        "su"                                  },
-	[   47 ] = { "Swan Islands",                        "sv"                                  },
-	[ 1233 ] = { "Sweden",                              "sw"                                  },
-	[  338 ] = { "Namibia",                             "sx"                                  },
-	[  961 ] = { "Syria",                               "sy"                                  },
-	[ 1719 ] = { "Switzerland",                         "sz"                                  },
-	[   66 ] = { "Tajikistan",                          "ta"                                  },
-	[  259 ] = { "Tajik S.S.R",                         "tar"                                 },/* discontinued */
-	[  948 ] = { "Turks and Caicos Islands",            "tc"                                  },
-	[ 1790 ] = { "Togo",                                "tg"                                  },
-	[   46 ] = { "Thailand",                            "th"                                  },
-	[  804 ] = { "Tunisia",                             "ti"                                  },
-	[  572 ] = { "Turkmenistan",                        "tk"                                  },
-	[  425 ] = { "Turkmen S.S.R.",                      "tkr"                                 },/* discontinued */
-	[ 1877 ] = { "Tokelau",                             "tl"                                  },
-	[  909 ] = { "Tasmania",                            "tma"                                 },
-	[ 1501 ] = { "Tennessee",                           "tnu"                                 },
-	[  578 ] = { "Tonga",                               "to"                                  },
-	[  373 ] = { "Trinidad and Tobago",                 "tr"                                  },
-	[ 1061 ] = { "United Arab Emirates",                "ts"                                  },
-	[  120 ] = { "Trust Territory of the Pacific Islands", "tt"                                  },/* discontinued */
-	[  375 ] = { "Turkey",                              "tu"                                  },
-	[ 1359 ] = { "Tuvalu",                              "tv"                                  },
-	[  489 ] = { "Texas",                               "txu"                                 },
-	[ 1117 ] = { "Tanzania",                            "tz"                                  },
-	[  151 ] = { "Egypt",                               "ua"                                  },
-	[ 1885 ] = { "United States Misc. Caribbean Islands", "uc"                                  },
-	[  307 ] = { "Uganda",                              "ug"                                  },
-	[   87 ] = { "United Kingdom Misc. Islands",        "ui"                                  },/* discontinued */
-	[ 1671 ] = { "United Kingdom Misc. Islands",        "uik"                                 },/* discontinued */
-	[  438 ] = { "United Kingdom",                      "uk"                                  },/* discontinued */
-	[  723 ] = { "Ukraine",                             "un"                                  },
-	[ 1593 ] = { "Ukraine",                             "unr"                                 },/* discontinued */
-	[ 1878 ] = { "United States Misc. Pacific Islands", "up"                                  },
-	[   58 ] = { "Soviet Union",                        "ur"                                  },/* discontinued */
-	[ 1713 ] = { "United States",                       "us"                                  },/* discontinued */
-	[  985 ] = { "Utah",                                "utu"                                 },
-	[ 1637 ] = { "Burkina Faso",                        "uv"                                  },
-	[ 1040 ] = { "Uruguay",                             "uy"                                  },
-	[  156 ] = { "Uzbekistan",                          "uz"                                  },
-	[ 1067 ] = { "Uzbek S.S.R.",                        "uzr"                                 },/* discontinued */
-	[ 1325 ] = { "Virginia",                            "vau"                                 },
-	[   63 ] = { "British Virgin Islands",              "vb"                                  },
-	[ 1970 ] = { "Vatican City",                        "vc"                                  },
-	[ 1963 ] = { "Venezuela",                           "ve"                                  },
-	[ 1234 ] = { "Virgin Islands of the United States", "vi"                                  },
-	[   59 ] = { "Vietnam",                             "vm"                                  },
-	[ 1984 ] = { "North Vietnam",                       "vn"                                  },/* discontinued */
-	[ 1080 ] = { "Various places",                      "vp"                                  },
-	[ 1400 ] = { "Victoria",                            "vra"                                 },
-	[ 1199 ] = { "South Vietnam",                       "vs"                                  },
-	[ 1815 ] = { "Vermont",                             "vtu"                                 },
-	[  994 ] = { "Washington",                          "wau"                                 },
-	[ 1858 ] = { "West Berlin",                         "wb"                                  },
-	[ 1341 ] = { "Western Australia",                   "wea"                                 },
-	[ 1457 ] = { "Wallis and Futuna",                   "wf"                                  },
-	[   29 ] = { "Wisconsin",                           "wiu"                                 },
-	[  655 ] = { "West Bank of the Jordan River",       "wj"                                  },
-	[  173 ] = { "Wake Island",                         "wk"                                  },
-	[ 1312 ] = { "Wales",                               "wlk"                                 },
-	[ 1481 ] = { "Samoa",                               "ws"                                  },
-	[ 1402 ] = { "West Virginia",                       "wvu"                                 },
-	[  265 ] = { "Wyoming",                             "wyu"                                 },
-	[  936 ] = { "Christmas Island (Indian Ocean)",     "xa"                                  },
-	[ 1039 ] = { "Cocus (Keeling) Islands",             "xb"                                  },
+static const marc_trans marc_country[380] = {
+	[  237 ] = { "Albania",                             "aa"                                  },
+	[   75 ] = { "Alberta",                             "abc"                                 },
+	[   96 ] = { "Ashmore and Cartier Islands",         "ac"                                  },/* discontinued */
+	[   42 ] = { "Australian Capital Territory",        "aca"                                 },
+	[  204 ] = { "Algeria",                             "ae"                                  },
+	[   58 ] = { "Afghanistan",                         "af"                                  },
+	[  298 ] = { "Argentina",                           "ag"                                  },
+	[  245 ] = { "Armenia (Republic)",                  "ai"                                  },
+	[  240 ] = { "Armenian S.S.R.",                     "air"                                 },/* discontinued */
+	[  334 ] = { "Azerbaijan",                          "aj"                                  },
+	[  136 ] = { "Azerbaijan S.S.R.",                   "ajr"                                 },/* discontinued */
+	[  152 ] = { "Alaska",                              "aku"                                 },
+	[  154 ] = { "Alabama",                             "alu"                                 },
+	[  210 ] = { "Anguilla",                            "am"                                  },
+	[   66 ] = { "Andorra",                             "an"                                  },
+	[  333 ] = { "Angola",                              "ao"                                  },
+	[   22 ] = { "Antigua and Barbuda",                 "aq"                                  },
+	[   34 ] = { "Arkansas",                            "aru"                                 },
+	[  323 ] = { "American Samoa",                      "as"                                  },
+	[  339 ] = { "Australia",                           "at"                                  },
+	[  304 ] = { "Austria",                             "au"                                  },
+	[   48 ] = { "Aruba",                               "aw"                                  },
+	[  269 ] = { "Antarctica",                          "ay"                                  },
+	[  130 ] = { "Arizona",                             "azu"                                 },
+	[  137 ] = { "Bahrain",                             "ba"                                  },
+	[  309 ] = { "Barbados",                            "bb"                                  },
+	[  256 ] = { "British Columbia",                    "bcc"                                 },
+	[   21 ] = { "Burundi",                             "bd"                                  },
+	[  371 ] = { "Belgium",                             "be"                                  },
+	[  207 ] = { "Bahamas",                             "bf"                                  },
+	[  128 ] = { "Bangladesh",                          "bg"                                  },
+	[  175 ] = { "Belize",                              "bh"                                  },
+	[  241 ] = { "British Indian Ocean Territory",      "bi"                                  },
+	[  280 ] = { "Brazil",                              "bl"                                  },
+	[  113 ] = { "Bermuda Islands",                     "bm"                                  },
+	[   78 ] = { "Bosnia and Herezegovina",             "bn"                                  },
+	[  174 ] = { "Bolivia",                             "bo"                                  },
+	[  228 ] = { "Solomon Islands",                     "bp"                                  },
+	[  341 ] = { "Burma",                               "br"                                  },
+	[  189 ] = { "Botswana",                            "bs"                                  },
+	[  222 ] = { "Bhutan",                              "bt"                                  },
+	[  217 ] = { "Bulgaria",                            "bu"                                  },
+	[  347 ] = { "Bouvet Island",                       "bv"                                  },
+	[  162 ] = { "Belarus",                             "bw"                                  },
+	[   10 ] = { "Byelorussian S.S.R",                  "bwr"                                 },/* discontinued */
+	[  199 ] = { "Brunei",                              "bx"                                  },
+	[   79 ] = { "Caribbean Netherlands",               "ca"                                  },
+	[  150 ] = { "California",                          "cau"                                 },
+	[  149 ] = { "Cambodia",                            "cb"                                  },
+	[    5 ] = { "China",                               "cc"                                  },
+	[  358 ] = { "Chad",                                "cd"                                  },
+	[  357 ] = { "Sri Lanka",                           "ce"                                  },
+	[   92 ] = { "Congo (Brazzaville)",                 "cf"                                  },
+	[    3 ] = { "Congo (Democratic Republic)",         "cg"                                  },
+	[  270 ] = { "China (Republic : 1949- )",           "ch"                                  },
+	[  144 ] = { "Croatia",                             "ci"                                  },
+	[  262 ] = { "Cayman Islands",                      "cj"                                  },
+	[   23 ] = { "Colombia",                            "ck"                                  },
+	[  376 ] = { "Chile",                               "cl"                                  },
+	[  251 ] = { "Cameroon",                            "cm"                                  },
+	[  221 ] = { "Canada",                              "cn"                                  },/* discontinued */
+	[  250 ] = { "Curacao",                             "co"                                  },
+	[  375 ] = { "Colorado",                            "cou"                                 },
+	[  167 ] = { "Canton and Enderbury Islands",        "cp"                                  },/* discontinued */
+	[  299 ] = { "Comoros",                             "cq"                                  },
+	[  212 ] = { "Costa Rica",                          "cr"                                  },
+	[   28 ] = { "Czechoslovakia",                      "cs"                                  },/* discontinued */
+	[  296 ] = { "Connecticut",                         "ctu"                                 },
+	[  243 ] = { "Cuba",                                "cu"                                  },
+	[  338 ] = { "Cabo Verde",                          "cv"                                  },
+	[  224 ] = { "Cook Islands",                        "cw"                                  },
+	[  326 ] = { "Central African Republic",            "cx"                                  },
+	[   90 ] = { "Cyprus",                              "cy"                                  },
+	[  132 ] = { "Canal Zone",                          "cz"                                  },/* discontinued */
+	[  297 ] = { "District of Columbia",                "dcu"                                 },
+	[  320 ] = { "Delaware",                            "deu"                                 },
+	[  190 ] = { "Denmark",                             "dk"                                  },
+	[   35 ] = { "Benin",                               "dm"                                  },
+	[   14 ] = { "Dominica",                            "dq"                                  },
+	[  232 ] = { "Dominican Republic",                  "dr"                                  },
+	[  233 ] = { "Eritrea",                             "ea"                                  },
+	[  213 ] = { "Ecuador",                             "ec"                                  },
+	[  311 ] = { "Equatorial Guinea",                   "eg"                                  },
+	[   20 ] = { "Timor-Leste",                         "em"                                  },
+	[   95 ] = { "England",                             "enk"                                 },
+	[  106 ] = { "Estonia",                             "er"                                  },
+	[   72 ] = { "Estonia",                             "err"                                 },/* discontinued */
+	[  353 ] = { "El Salvador",                         "es"                                  },
+	[  293 ] = { "Ethiopia",                            "et"                                  },
+	[  317 ] = { "Faroe Islands",                       "fa"                                  },
+	[   93 ] = { "French Guiana",                       "fg"                                  },
+	[  200 ] = { "Finland",                             "fi"                                  },
+	[  271 ] = { "Fiji",                                "fj"                                  },
+	[  182 ] = { "Falkland Islands",                    "fk"                                  },
+	[  109 ] = { "Florida",                             "flu"                                 },
+	[  140 ] = { "Micronesia (Federated States)",       "fm"                                  },
+	[  356 ] = { "French Polynesia",                    "fp"                                  },
+	[   30 ] = { "France",                              "fr"                                  },
+	[   64 ] = { "Terres australes et antarctiques francaises", "fs"                                  },
+	[  254 ] = { "Djibouti",                            "ft"                                  },
+	[  186 ] = { "Georgia",                             "gau"                                 },
+	[  305 ] = { "Kiribati",                            "gb"                                  },
+	[   55 ] = { "Grenada",                             "gd"                                  },
+	[  285 ] = { "East Germany",                        "ge"                                  },/* discontinued */
+	[   46 ] = { "Guernsey",                            "gg"                                  },
+	[   15 ] = { "Ghana",                               "gh"                                  },
+	[    7 ] = { "Gibraltar",                           "gi"                                  },
+	[  188 ] = { "Greenland",                           "gl"                                  },
+	[  187 ] = { "Gambia",                              "gm"                                  },
+	[  103 ] = { "Gilbert and Ellice Islands",          "gn"                                  },/* discontinued */
+	[  291 ] = { "Gabon",                               "go"                                  },
+	[  278 ] = { "Guadeloupe",                          "gp"                                  },
+	[   85 ] = { "Greece",                              "gr"                                  },
+	[  282 ] = { "Georgia (Republic)",                  "gs"                                  },
+	[  111 ] = { "Georgian S.S.R",                      "gsr"                                 },/* discontinued */
+	[  148 ] = { "Guatemala",                           "gt"                                  },
+	[    6 ] = { "Guam",                                "gu"                                  },
+	[  165 ] = { "Guinea",                              "gv"                                  },
+	[  161 ] = { "Germany",                             "gw"                                  },
+	[  133 ] = { "Guyana",                              "gy"                                  },
+	[  363 ] = { "Gaza Strip",                          "gz"                                  },
+	[  362 ] = { "Hawaii",                              "hiu"                                 },
+	[  223 ] = { "Hong Kong",                           "hk"                                  },/* discontinued */
+	[   57 ] = { "Heard and McDonald Islands",          "hm"                                  },
+	[   71 ] = { "Honduras",                            "ho"                                  },
+	[   27 ] = { "Haiti",                               "ht"                                  },
+	[  215 ] = { "Hungary",                             "hu"                                  },
+	[  372 ] = { "Iowa",                                "iau"                                 },
+	[   89 ] = { "Iceland",                             "ic"                                  },
+	[  351 ] = { "Idaho",                               "idu"                                 },
+	[  349 ] = { "Ireland",                             "ie"                                  },
+	[  277 ] = { "India",                               "ii"                                  },
+	[  180 ] = { "Illinois",                            "ilu"                                 },
+	[  281 ] = { "Isle of Man",                         "im"                                  },
+	[   73 ] = { "Indiana",                             "inu"                                 },
+	[  268 ] = { "Indonesia",                           "io"                                  },
+	[  302 ] = { "Iraq",                                "iq"                                  },
+	[  153 ] = { "Iran",                                "ir"                                  },
+	[  255 ] = { "Israel",                              "is"                                  },
+	[  337 ] = { "Italy",                               "it"                                  },
+	[  141 ] = { "Israel-Syria Demilitarized Zones",    "iu"                                  },/* discontinued */
+	[  178 ] = { "Cote d'Ivoire",                       "iv"                                  },
+	[  170 ] = { "Isreal-Jordan Demilitarized Zones",   "iw"                                  },/* discontinued */
+	[  330 ] = { "Iraq-Saudi Arabia Neutral Zone",      "iy"                                  },
+	[    0 ] = { "Japan",                               "ja"                                  },
+	[  192 ] = { "Jersey",                              "je"                                  },
+	[  306 ] = { "Johnston Atoll",                      "ji"                                  },
+	[  373 ] = { "Jamaica",                             "jm"                                  },
+	[  294 ] = { "Jan Mayen",                           "jn"                                  },/* discontinued */
+	[   68 ] = { "Jordan",                              "jo"                                  },
+	[   40 ] = { "Kenya",                               "ke"                                  },
+	[  216 ] = { "Kyrgyzstan",                          "kg"                                  },
+	[   29 ] = { "Kirghiz S.S.R.",                      "kgr"                                 },
+	[  236 ] = { "North Korea",                         "kn"                                  },
+	[   38 ] = { "South Korea",                         "ko"                                  },
+	[   81 ] = { "Kansas",                              "ksu"                                 },
+	[  307 ] = { "Kuwait",                              "ku"                                  },
+	[  242 ] = { "Kosovo",                              "kv"                                  },
+	[  257 ] = { "Kentucky",                            "kyu"                                 },
+	[   24 ] = { "Kazakhstan",                          "kz"                                  },
+	[  288 ] = { "Kazakh S.S.R.",                       "kzr"                                 },/* discontinued */
+	[   70 ] = { "Louisiana",                           "lau"                                 },
+	[  235 ] = { "Liberia",                             "lb"                                  },
+	[  169 ] = { "Lebanon",                             "le"                                  },
+	[  267 ] = { "Liechtenstein",                       "lh"                                  },
+	[   98 ] = { "Lithuania",                           "li"                                  },
+	[   16 ] = { "Lithuania",                           "lir"                                 },/* discontinued */
+	[   59 ] = { "Central and Southern Line Islands",   "ln"                                  },/* discontinued */
+	[  142 ] = { "Lesotho",                             "lo"                                  },
+	[   61 ] = { "Laos",                                "ls"                                  },
+	[  321 ] = { "Luxembourg",                          "lu"                                  },
+	[  229 ] = { "Latvia",                              "lv"                                  },
+	[   74 ] = { "Latvia",                              "lvr"                                 },/* discontinued */
+	[  350 ] = { "Libya",                               "ly"                                  },
+	[  319 ] = { "Massachusetts",                       "mau"                                 },
+	[  122 ] = { "Manitoba",                            "mbc"                                 },
+	[  120 ] = { "Monaco",                              "mc"                                  },
+	[  147 ] = { "Maryland",                            "mdu"                                 },
+	[  104 ] = { "Maine",                               "meu"                                 },
+	[  194 ] = { "Mauritius",                           "mf"                                  },
+	[  310 ] = { "Madagascar",                          "mg"                                  },
+	[  181 ] = { "Macao",                               "mh"                                  },/* discontinued */
+	[   41 ] = { "Michigan",                            "miu"                                 },
+	[  272 ] = { "Montserrat",                          "mj"                                  },
+	[  292 ] = { "Oman",                                "mk"                                  },
+	[  139 ] = { "Mali",                                "ml"                                  },
+	[   99 ] = { "Malta",                               "mm"                                  },
+	[  284 ] = { "Minnesota",                           "mnu"                                 },
+	[   17 ] = { "Montenegro",                          "mo"                                  },
+	[  368 ] = { "Missouri",                            "mou"                                 },
+	[  184 ] = { "Mongolia",                            "mp"                                  },
+	[  179 ] = { "Martinique",                          "mq"                                  },
+	[  105 ] = { "Morocco",                             "mr"                                  },
+	[  276 ] = { "Mississippi",                         "msu"                                 },
+	[  360 ] = { "Montana",                             "mtu"                                 },
+	[  364 ] = { "Mauritania",                          "mu"                                  },
+	[  289 ] = { "Moldova",                             "mv"                                  },
+	[   56 ] = { "Moldavian S.S.R.",                    "mvr"                                 },/* discontinued */
+	[  156 ] = { "Malawi",                              "mw"                                  },
+	[  145 ] = { "Mexico",                              "mx"                                  },
+	[   43 ] = { "Malaysia",                            "my"                                  },
+	[  118 ] = { "Mozambique",                          "mz"                                  },
+	[  290 ] = { "Netherlands Antilles",                "na"                                  },/* discontinued */
+	[  308 ] = { "Nebraska",                            "nbu"                                 },
+	[   31 ] = { "North Carolina",                      "ncu"                                 },
+	[   86 ] = { "North Dakota",                        "ndu"                                 },
+	[   44 ] = { "Netherlands",                         "ne"                                  },
+	[  374 ] = { "Newfoundland and Labrador",           "nfc"                                 },
+	[  220 ] = { "Niger",                               "ng"                                  },
+	[  198 ] = { "New Hampshire",                       "nhu"                                 },
+	[  129 ] = { "Northern Ireland",                    "nik"                                 },
+	[    9 ] = { "New Jersey",                          "nju"                                 },
+	[  354 ] = { "New Brunswick",                       "nkc"                                 },
+	[   13 ] = { "New Caledonia",                       "nl"                                  },
+	[  335 ] = { "Northern Mariana Islands",            "nm"                                  },/* discontinued */
+	[   36 ] = { "New Mexico",                          "nmu"                                 },
+	[   69 ] = { "Vanuatu",                             "nn"                                  },
+	[  117 ] = { "Norway",                              "no"                                  },
+	[  172 ] = { "Nepal",                               "np"                                  },
+	[  370 ] = { "Nicaragua",                           "nq"                                  },
+	[  234 ] = { "Nigeria",                             "nr"                                  },
+	[  312 ] = { "Nova Scotia",                         "nsc"                                 },
+	[   19 ] = { "Northwest Territories",               "ntc"                                 },
+	[  164 ] = { "Nauru",                               "nu"                                  },
+	[   97 ] = { "Nunavut",                             "nuc"                                 },
+	[  246 ] = { "Nevada",                              "nvu"                                 },
+	[  183 ] = { "Northern Mariana Islands",            "nw"                                  },
+	[  197 ] = { "Norfolk Island",                      "nx"                                  },
+	[  340 ] = { "New York",                            "nyu"                                 },
+	[  127 ] = { "New Zealand",                         "nz"                                  },
+	[   94 ] = { "Ohio",                                "ohu"                                 },
+	[   45 ] = { "Oklahoma",                            "oku"                                 },
+	[  365 ] = { "Ontario",                             "onc"                                 },
+	[  131 ] = { "Oregon",                              "oru"                                 },
+	[   88 ] = { "Mayotte",                             "ot"                                  },
+	[  173 ] = { "Pennsylvania",                        "pau"                                 },
+	[  283 ] = { "Pitcairn Island",                     "pc"                                  },
+	[  329 ] = { "Peru",                                "pe"                                  },
+	[  146 ] = { "Paracel Islands",                     "pf"                                  },
+	[   12 ] = { "Guinea-Bissau",                       "pg"                                  },
+	[   84 ] = { "Philippines",                         "ph"                                  },
+	[  331 ] = { "Prince Edward Island",                "pic"                                 },
+	[  377 ] = { "Pakistan",                            "pk"                                  },
+	[   25 ] = { "Poland",                              "pl"                                  },
+	[   87 ] = { "Panama",                              "pn"                                  },
+	[  126 ] = { "Portugal",                            "po"                                  },
+	[  328 ] = { "Papua New Guinea",                    "pp"                                  },
+	[  264 ] = { "Puerto Rico",                         "pr"                                  },
+	[  159 ] = { "Portuguese Timor",                    "pt"                                  },
+	[  303 ] = { "Palau",                               "pw"                                  },
+	[  300 ] = { "Paraguay",                            "py"                                  },
+	[  119 ] = { "Qatar",                               "qa"                                  },
+	[  138 ] = { "Queensland",                          "qea"                                 },
+	[  260 ] = { "Quebec",                              "quc"                                 },
+	[    4 ] = { "Serbia",                              "rb"                                  },
+	[  313 ] = { "Reunion",                             "re"                                  },
+	[  177 ] = { "Zimbabwe",                            "rh"                                  },
+	[  238 ] = { "Romania",                             "rm"                                  },
+	[   76 ] = { "Russian Federation",                  "ru"                                  },
+	[  343 ] = { "Russian S.F.S.R",                     "rur"                                 },/* discontinued */
+	[   18 ] = { "Rwanda",                              "rw"                                  },
+	[  209 ] = { "Southern Ryukyu Islands",             "ry"                                  },/* discontinued */
+	[  244 ] = { "South Africa",                        "sa"                                  },
+	[  225 ] = { "Svalbard",                            "sb"                                  },/* discontinued */
+	[  176 ] = { "Saint_Barthelemy",                    "sc"                                  },
+	[   33 ] = { "South Carolina",                      "scu"                                 },
+	[  230 ] = { "South Sudan",                         "sd"                                  },
+	[  348 ] = { "Seychelles",                          "se"                                  },
+	[  379 ] = { "Sao Tome and Principe",               "sf"                                  },
+	[  125 ] = { "Senegal",                             "sg"                                  },
+	[   32 ] = { "Spanish North Africa",                "sh"                                  },
+	[  315 ] = { "Singapore",                           "si"                                  },
+	[  108 ] = { "Sudan",                               "sj"                                  },
+	[  143 ] = { "Sikkim",                              "sk"                                  },/* discontinued */
+	[  196 ] = { "Sierra Leone",                        "sl"                                  },
+	[  163 ] = { "San Marino",                          "sm"                                  },
+	[  123 ] = { "Sint Maarten",                        "sn"                                  },
+	[  166 ] = { "Saskatchewan",                        "snc"                                 },
+	[  361 ] = { "Somalia",                             "so"                                  },
+	[  273 ] = { "Spain",                               "sp"                                  },
+	[  155 ] = { "Eswatini",                            "sq"                                  },
+	[  110 ] = { "Surinam",                             "sr"                                  },
+	[  287 ] = { "Western Sahara",                      "ss"                                  },
+	[  318 ] = { "Saint-Martin",                        "st"                                  },
+	[  344 ] = { "Scotland",                            "stk"                                 },
+	[  314 ] = { "Saudi Arabia",                        "su"                                  },
+	[  218 ] = { "Swan Islands",                        "sv"                                  },
+	[    1 ] = { "Sweden",                              "sw"                                  },
+	[  211 ] = { "Namibia",                             "sx"                                  },
+	[  258 ] = { "Syria",                               "sy"                                  },
+	[  203 ] = { "Switzerland",                         "sz"                                  },
+	[  160 ] = { "Tajikistan",                          "ta"                                  },
+	[  116 ] = { "Tajik S.S.R",                         "tar"                                 },/* discontinued */
+	[  193 ] = { "Turks and Caicos Islands",            "tc"                                  },
+	[  286 ] = { "Togo",                                "tg"                                  },
+	[  124 ] = { "Thailand",                            "th"                                  },
+	[  191 ] = { "Tunisia",                             "ti"                                  },
+	[   52 ] = { "Turkmenistan",                        "tk"                                  },
+	[    8 ] = { "Turkmen S.S.R.",                      "tkr"                                 },/* discontinued */
+	[   39 ] = { "Tokelau",                             "tl"                                  },
+	[   65 ] = { "Tasmania",                            "tma"                                 },
+	[  239 ] = { "Tennessee",                           "tnu"                                 },
+	[   82 ] = { "Tonga",                               "to"                                  },
+	[  115 ] = { "Trinidad and Tobago",                 "tr"                                  },
+	[   49 ] = { "United Arab Emirates",                "ts"                                  },
+	[  279 ] = { "Trust Territory of the Pacific Islands", "tt"                                  },/* discontinued */
+	[  266 ] = { "Turkey",                              "tu"                                  },
+	[   54 ] = { "Tuvalu",                              "tv"                                  },
+	[  301 ] = { "Texas",                               "txu"                                 },
+	[   60 ] = { "Tanzania",                            "tz"                                  },
+	[   80 ] = { "Egypt",                               "ua"                                  },
+	[  322 ] = { "United States Misc. Caribbean Islands", "uc"                                  },
+	[   63 ] = { "Uganda",                              "ug"                                  },
+	[  316 ] = { "United Kingdom Misc. Islands",        "ui"                                  },/* discontinued */
+	[  369 ] = { "United Kingdom Misc. Islands",        "uik"                                 },/* discontinued */
+	[  214 ] = { "United Kingdom",                      "uk"                                  },/* discontinued */
+	[  158 ] = { "Ukraine",                             "un"                                  },
+	[  332 ] = { "Ukraine",                             "unr"                                 },/* discontinued */
+	[  324 ] = { "United States Misc. Pacific Islands", "up"                                  },
+	[   37 ] = { "Soviet Union",                        "ur"                                  },/* discontinued */
+	[  253 ] = { "United States",                       "us"                                  },/* discontinued */
+	[  342 ] = { "Utah",                                "utu"                                 },
+	[  157 ] = { "Burkina Faso",                        "uv"                                  },
+	[  247 ] = { "Uruguay",                             "uy"                                  },
+	[   51 ] = { "Uzbekistan",                          "uz"                                  },
+	[   47 ] = { "Uzbek S.S.R.",                        "uzr"                                 },/* discontinued */
+	[  135 ] = { "Virginia",                            "vau"                                 },
+	[  201 ] = { "British Virgin Islands",              "vb"                                  },
+	[   53 ] = { "Vatican City",                        "vc"                                  },
+	[  101 ] = { "Venezuela",                           "ve"                                  },
+	[  378 ] = { "Virgin Islands of the United States", "vi"                                  },
+	[  226 ] = { "Vietnam",                             "vm"                                  },
+	[  195 ] = { "North Vietnam",                       "vn"                                  },/* discontinued */
+	[  263 ] = { "Various places",                      "vp"                                  },
+	[  168 ] = { "Victoria",                            "vra"                                 },
+	[  205 ] = { "South Vietnam",                       "vs"                                  },
+	[  107 ] = { "Vermont",                             "vtu"                                 },
+	[  367 ] = { "Washington",                          "wau"                                 },
+	[  252 ] = { "West Berlin",                         "wb"                                  },
+	[   50 ] = { "Western Australia",                   "wea"                                 },
+	[  202 ] = { "Wallis and Futuna",                   "wf"                                  },
+	[  248 ] = { "Wisconsin",                           "wiu"                                 },
+	[  219 ] = { "West Bank of the Jordan River",       "wj"                                  },
+	[  206 ] = { "Wake Island",                         "wk"                                  },
+	[   67 ] = { "Wales",                               "wlk"                                 },
+	[  121 ] = { "Samoa",                               "ws"                                  },
+	[  100 ] = { "West Virginia",                       "wvu"                                 },
+	[  295 ] = { "Wyoming",                             "wyu"                                 },
+	[  227 ] = { "Christmas Island (Indian Ocean)",     "xa"                                  },
+	[  265 ] = { "Cocus (Keeling) Islands",             "xb"                                  },
 	[  346 ] = { "Maldives",                            "xc"                                  },
-	[ 1938 ] = { "Saint Kitts-Nevis",                   "xd"                                  },
-	[ 1736 ] = { "Marshall Islands",                    "xe"                                  },
-	[ 1337 ] = { "Midway Islands",                      "xf"                                  },
-	[  243 ] = { "Coral Sea Islands Territory",         "xga"                                 },
-	[  860 ] = { "Niue",                                "xh"                                  },
-	[ 1320 ] = { "Saint Kitts-Nevis-Anguilla",          "xi"                                  },/* discontinued */
-	[  593 ] = { "Saint Helena",                        "xj"                                  },
-	[  705 ] = { "Saint Lucia",                         "xk"                                  },
-	[  211 ] = { "Saint Pierre and Miquelon",           "xl"                                  },
-	[  684 ] = { "Saint Vincent and the Grenadines",    "xm"                                  },
-	[  129 ] = { "North Macedonia",                     "xn"                                  },
-	[ 1800 ] = { "New South Wales",                     "xna"                                 },
-	[  249 ] = { "Slovakia",                            "xo"                                  },
-	[ 1235 ] = { "Northern Territory",                  "xoa"                                 },
-	[  657 ] = { "Spratly Island",                      "xp"                                  },
-	[ 1299 ] = { "Czech Republic",                      "xr"                                  },
-	[  279 ] = { "South Australia",                     "xra"                                 },
-	[  284 ] = { "South Georgia and the South Sandwich Islands", "xs"                                  },
-	[ 1340 ] = { "Slovenia",                            "xv"                                  },
-	[ 1971 ] = { "No place, unknown, or undetermined",  "xx"                                  },
-	[ 1568 ] = { "Canada",                              "xxc"                                 },
-	[  668 ] = { "United Kingdom",                      "xxk"                                 },
-	[ 1483 ] = { "Soviet Union",                        "xxr"                                 },/* discontinued */
-	[ 1875 ] = { "United States",                       "xxu"                                 },
-	[  697 ] = { "Yemen",                               "ye"                                  },
-	[  902 ] = { "Yukon Territory",                     "ykc"                                 },
-	[ 1569 ] = { "Yemen (People's Democratic Republic)", "ys"                                  },/* discontinued */
-	[ 1447 ] = { "Serbia and Montenegro",               "yu"                                  },/* discontinued */
-	[ 1827 ] = { "Zambia",                              "za"                                  },
+	[  134 ] = { "Saint Kitts-Nevis",                   "xd"                                  },
+	[  102 ] = { "Marshall Islands",                    "xe"                                  },
+	[   77 ] = { "Midway Islands",                      "xf"                                  },
+	[  171 ] = { "Coral Sea Islands Territory",         "xga"                                 },
+	[   26 ] = { "Niue",                                "xh"                                  },
+	[   91 ] = { "Saint Kitts-Nevis-Anguilla",          "xi"                                  },/* discontinued */
+	[  249 ] = { "Saint Helena",                        "xj"                                  },
+	[  325 ] = { "Saint Lucia",                         "xk"                                  },
+	[  366 ] = { "Saint Pierre and Miquelon",           "xl"                                  },
+	[  185 ] = { "Saint Vincent and the Grenadines",    "xm"                                  },
+	[   83 ] = { "North Macedonia",                     "xn"                                  },
+	[   11 ] = { "New South Wales",                     "xna"                                 },
+	[  259 ] = { "Slovakia",                            "xo"                                  },
+	[  231 ] = { "Northern Territory",                  "xoa"                                 },
+	[  359 ] = { "Spratly Island",                      "xp"                                  },
+	[    2 ] = { "Czech Republic",                      "xr"                                  },
+	[  345 ] = { "South Australia",                     "xra"                                 },
+	[  112 ] = { "South Georgia and the South Sandwich Islands", "xs"                                  },
+	[  114 ] = { "Slovenia",                            "xv"                                  },
+	[  261 ] = { "No place, unknown, or undetermined",  "xx"                                  },
+	[  355 ] = { "Canada",                              "xxc"                                 },
+	[  274 ] = { "United Kingdom",                      "xxk"                                 },
+	[  208 ] = { "Soviet Union",                        "xxr"                                 },/* discontinued */
+	[  336 ] = { "United States",                       "xxu"                                 },
+	[  327 ] = { "Yemen",                               "ye"                                  },
+	[  275 ] = { "Yukon Territory",                     "ykc"                                 },
+	[   62 ] = { "Yemen (People's Democratic Republic)", "ys"                                  },/* discontinued */
+	[  151 ] = { "Serbia and Montenegro",               "yu"                                  },/* discontinued */
+	[  352 ] = { "Zambia",                              "za"                                  },
+};
+static const int marc_country_disp[127] = {
+	7, 22, 7, 7, 6, 47, 25, 3, 4, 2,
+	34, 3, 89, 35, -67, 2, 19, 6, 16, 36,
+	13, 14, 60, 35, -70, 10, -72, 14, 71, 48,
+	4, 65, 16, 0, 3, 10, -152, 66, 4, -171,
+	-174, 50, 31, 3, 0, 307, 5, 6, 1, 60,
+	-176, 178, 5, 48, 1, 0, 56, 29, 38, 43,
+	4, 0, 2, 106, 42, 97, 81, 0, 214, 252,
+	172, 437, 1, 168, 0, 19, 0, 93, 27, 3,
+	5, 5, 0, 67, 69, 3, 0, -225, 56, 75,
+	141, 16, 514, 1, 0, 65, 1, -269, 0, -272,
+	12, 64, 1, 668, 30, 58, 6, 271, 108, 129,
+	-283, 894, -291, -313, 13, 171, 10, 5, -339, -368,
+	-374, -376, -380, 1, 0, 45, 21,
 };
+static const mph marc_country_hash = { 380, 127, marc_country_disp, MPH_CASE };
 
 char *
 marc_convert_country( const char *query )
 {
 	unsigned int n;
 
-	n = calculate_hash_char( query, marc_country_hash_size );
-	if ( marc_country[n].abbreviation==NULL ) return NULL;
+	n = mph_slot( &marc_country_hash, query );
 	if ( !strcmp( query, marc_country[n].abbreviation ) ) return marc_country[n].internal_name;
-	else if ( marc_country[n+1].abbreviation && !strcmp( query, marc_country[n+1].abbreviation ) ) return marc_country[n+1].internal_name;
 	else return NULL;
 }
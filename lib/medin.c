@@ -19,7 +19,7 @@
 #include "bibutils.h"
 #include "bibformats.h"
 
-static int medin_readf( FILE *fp, char *buf, int bufsize, int *bufpos, str *line, str *reference, int *fcharset );
+static int medin_readf( source *src, char *buf, int bufsize, int *bufpos, str *line, str *reference, int *fcharset );
 static int medin_processf( fields *medin, const char *data, const char *filename, long nref, param *p );
 
 
@@ -49,8 +49,10 @@ medin_initparams( param *pm, const char *progname )
 	pm->all      = NULL;
 	pm->nall     = 0;
 
-	slist_init( &(pm->asis) );
-	slist_init( &(pm->corps) );
+	namelist_init( &(pm->asis) );
+	namelist_init( &(pm->corps) );
+	pm->names = NULL;
+	pm->strings = NULL;
 
 	if ( !progname ) pm->progname = NULL;
 	else {
@@ -93,13 +95,13 @@ medin_findendwrapper( char *buf, int ntype )
 }
 
 static int
-medin_readf( FILE *fp, char *buf, int bufsize, int *bufpos, str *line, str *reference, int *fcharset )
+medin_readf( source *src, char *buf, int bufsize, int *bufpos, str *line, str *reference, int *fcharset )
 {
 	str tmp;
 	char *startptr = NULL, *endptr;
 	int haveref = 0, inref = 0, file_charset = CHARSET_UNKNOWN, m, type = -1;
 	str_init( &tmp );
-	while ( !haveref && str_fget( fp, buf, bufsize, bufpos, line ) ) {
+	while ( !haveref && source_fget( src, buf, bufsize, bufpos, line ) ) {
 		if ( line->data ) {
 			m = xml_getencoding( line );
 			if ( m!=CHARSET_UNKNOWN ) file_charset = m;
@@ -121,6 +123,8 @@ medin_readf( FILE *fp, char *buf, int bufsize, int *bufpos, str *line, str *refe
 		}
 	}
 	str_free( &tmp );
+	/* nothing read is held over for the next reference */
+	str_empty( line );
 	*fcharset = file_charset;
 	return haveref;
 }
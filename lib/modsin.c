@@ -23,13 +23,11 @@
 #include "bu_auth.h"
 #include "marc_auth.h"
 #include "url.h"
-#include "iso639_1.h"
-#include "iso639_2.h"
-#include "iso639_3.h"
+#include "iso639.h"
 #include "bibutils.h"
 #include "bibformats.h"
 
-static int modsin_readf( FILE *fp, char *buf, int bufsize, int *bufpos, str *line, str *reference, int *fcharset );
+static int modsin_readf( source *src, char *buf, int bufsize, int *bufpos, str *line, str *reference, int *fcharset );
 static int modsin_processf( fields *medin, const char *data, const char *filename, long nref, param *p );
 
 /*****************************************************
@@ -50,6 +48,7 @@ modsin_initparams( param *pm, const char *progname )
 	pm->verbose          = 0;
 	pm->addcount         = 0;
 	pm->singlerefperfile = 0;
+	pm->nthreads         = 0;
 	pm->output_raw       = BIBL_RAW_WITHMAKEREFID |
 	                      BIBL_RAW_WITHCHARCONVERT;
 
@@ -61,8 +60,10 @@ modsin_initparams( param *pm, const char *progname )
 	pm->all      = NULL;
 	pm->nall     = 0;
 
-	slist_init( &(pm->asis) );
-	slist_init( &(pm->corps) );
+	namelist_init( &(pm->asis) );
+	namelist_init( &(pm->corps) );
+	pm->names = NULL;
+	pm->strings = NULL;
 
 	if ( !progname ) pm->progname = NULL;
 	else {
@@ -96,13 +97,7 @@ modsin_get_lang_attribute( xml *node )
 
 	lang = str_cstr( langtag );
 
-	expand = iso639_3_from_code( lang );
-	if ( expand ) return expand;
-
-	expand = iso639_2_from_code( lang );
-	if ( expand ) return expand;
-
-	expand = iso639_1_from_code( lang );
+	expand = iso639_from_code( lang );
 	if ( expand ) return expand;
 
 	return lang;
@@ -1327,7 +1322,7 @@ modsin_endptr( char *p )
 }
 
 static int
-modsin_readf( FILE *fp, char *buf, int bufsize, int *bufpos, str *line, str *reference, int *fcharset )
+modsin_readf( source *src, char *buf, int bufsize, int *bufpos, str *line, str *reference, int *fcharset )
 {
 	str tmp;
 	int m, file_charset = CHARSET_UNKNOWN;
@@ -1348,7 +1343,7 @@ modsin_readf( FILE *fp, char *buf, int bufsize, int *bufpos, str *line, str *ref
 			str_segcpy( reference, startptr, endptr );
 			str_strcpyc( line, endptr );
 		}
-	} while ( !endptr && str_fget( fp, buf, bufsize, bufpos, line ) );
+	} while ( !endptr && source_fget( src, buf, bufsize, bufpos, line ) );
 
 	str_free( &tmp );
 	*fcharset = file_charset;
@@ -20,15 +20,16 @@
 #include "modstypes.h"
 #include "bu_auth.h"
 #include "marc_auth.h"
+#include "sink.h"
 #include "bibformats.h"
 
 /*****************************************************
  PUBLIC: int modsout_initparams()
 *****************************************************/
 
-static void modsout_writeheader( FILE *outptr, param *p );
-static void modsout_writefooter( FILE *outptr );
-static int  modsout_write( fields *info, FILE *outptr, param *p, unsigned long numrefs );
+static void modsout_writeheader( sink *out, param *p );
+static void modsout_writefooter( sink *out );
+static int  modsout_write( fields *info, sink *out, param *p, unsigned long numrefs );
 
 int
 modsout_initparams( param *pm, const char *progname )
@@ -45,6 +46,7 @@ modsout_initparams( param *pm, const char *progname )
 	pm->verbose          = 0;
 	pm->addcount         = 0;
 	pm->singlerefperfile = 0;
+	pm->nthreads         = 0;
 
 	pm->headerf   = modsout_writeheader;
 	pm->footerf   = modsout_writefooter;
@@ -84,28 +86,39 @@ modsout_initparams( param *pm, const char *progname )
 #define TAG_NEWLINE   (16)
 
 static void
-output_tag_core( FILE *outptr, int nindents, const char *tag, const char *data, unsigned char mode, va_list *attrs )
+output_tag_core( sink *out, int nindents, const char *tag, const char *data, unsigned char mode, va_list *attrs )
 {
 	const char *attr, *val;
-	int i;
 
-	for ( i=0; i<nindents; ++i ) fprintf( outptr, "    " );
+	sink_spaces( out, 4 * nindents );
 
-	if ( mode & TAG_CLOSE ) fprintf( outptr, "</%s", tag );
-	else                    fprintf( outptr, "<%s",  tag );
+	if ( mode & TAG_CLOSE ) sink_write( out, "</", 2 );
+	else                    sink_putc( out, '<' );
+	sink_puts( out, tag );
 
 	do {
 		attr = va_arg( *attrs, const char * );
 		if ( attr ) val  = va_arg( *attrs, const char * );
-		if ( attr && val ) fprintf( outptr, " %s=\"%s\"", attr, val );
+		if ( attr && val ) {
+			sink_putc( out, ' ' );
+			sink_puts( out, attr );
+			sink_write( out, "=\"", 2 );
+			sink_puts( out, val );
+			sink_putc( out, '\"' );
+		}
 	} while ( attr && val );
 
-	if ( mode & TAG_SELFCLOSE ) fprintf( outptr, "/>" );
-	else                        fprintf( outptr, ">" );
+	if ( mode & TAG_SELFCLOSE ) sink_write( out, "/>", 2 );
+	else                        sink_putc( out, '>' );
 
-	if ( mode & TAG_OPENCLOSE ) fprintf( outptr, "%s</%s>", data, tag );
+	if ( mode & TAG_OPENCLOSE ) {
+		sink_puts( out, data );
+		sink_write( out, "</", 2 );
+		sink_puts( out, tag );
+		sink_putc( out, '>' );
+	}
 
-	if ( mode & TAG_NEWLINE   ) fprintf( outptr, "\n" );
+	if ( mode & TAG_NEWLINE   ) sink_putc( out, '\n' );
 }
 
 /* output_tag()
@@ -118,12 +131,12 @@ output_tag_core( FILE *outptr, int nindents, const char *tag, const char *data,
  * will be output in the tag
  */
 static void
-output_tag( FILE *outptr, int nindents, const char *tag, const char *value, unsigned char mode, ... )
+output_tag( sink *out, int nindents, const char *tag, const char *value, unsigned char mode, ... )
 {
 	va_list attrs;
 
 	va_start( attrs, mode );
-	output_tag_core( outptr, nindents, tag, value, mode, &attrs );
+	output_tag_core( out, nindents, tag, value, mode, &attrs );
 	va_end( attrs );
 }
 
@@ -134,7 +147,7 @@ output_tag( FILE *outptr, int nindents, const char *tag, const char *value, unsi
  * mode     = [ TAG_OPEN | TAG_CLOSE | TAG_OPENCLOSE | TAG_SELFCLOSE | TAG_NEWLINE ]
  */
 static void
-output_fil( FILE *outptr, int nindents, const char *tag, fields *f, int n, unsigned char mode, ... )
+output_fil( sink *out, int nindents, const char *tag, fields *f, int n, unsigned char mode, ... )
 {
 	va_list attrs;
 	char *value;
@@ -143,7 +156,7 @@ output_fil( FILE *outptr, int nindents, const char *tag, fields *f, int n, unsig
 
 	value = (char *) fields_value( f, n, FIELDS_CHRP );
 	va_start( attrs, mode );
-	output_tag_core( outptr, nindents, tag, value, mode, &attrs );
+	output_tag_core( out, nindents, tag, value, mode, &attrs );
 	va_end( attrs );
 }
 
@@ -155,7 +168,7 @@ output_fil( FILE *outptr, int nindents, const char *tag, fields *f, int n, unsig
  */
 
 static void
-output_vpl( FILE *outptr, int nindents, const char *tag, vplist *values, unsigned char mode, ... )
+output_vpl( sink *out, int nindents, const char *tag, vplist *values, unsigned char mode, ... )
 {
 	vplist_index i;
 	va_list attrs;
@@ -165,7 +178,7 @@ output_vpl( FILE *outptr, int nindents, const char *tag, vplist *values, unsigne
 	for ( i=0; i<values->n; ++i ) {
 		va_start( attrs, mode );
 		value = vplist_get( values, i );
-		output_tag_core( outptr, nindents, tag, value, mode, &attrs );
+		output_tag_core( out, nindents, tag, value, mode, &attrs );
 		va_end( attrs );
 	}
 }
@@ -196,7 +209,7 @@ incr_level( int level, int amount )
 }
 
 static void
-output_title( FILE *outptr, fields *f, int level )
+output_title( sink *out, fields *f, int level )
 {
 	int ttl    = fields_find( f, "TITLE", level );
 	int subttl = fields_find( f, "SUBTITLE", level );
@@ -211,16 +224,16 @@ output_title( FILE *outptr, fields *f, int level )
 
 
 	/* output main title */
-	output_tag( outptr, indent1, "titleInfo", NULL,      TAG_OPEN      | TAG_NEWLINE, NULL );
-	output_fil( outptr, indent2, "title",     f, ttl,    TAG_OPENCLOSE | TAG_NEWLINE, NULL );
-	output_fil( outptr, indent2, "subTitle",  f, subttl, TAG_OPENCLOSE | TAG_NEWLINE, NULL );
-	output_fil( outptr, indent2, "partName",  f, parttl, TAG_OPENCLOSE | TAG_NEWLINE, NULL );
+	output_tag( out, indent1, "titleInfo", NULL,      TAG_OPEN      | TAG_NEWLINE, NULL );
+	output_fil( out, indent2, "title",     f, ttl,    TAG_OPENCLOSE | TAG_NEWLINE, NULL );
+	output_fil( out, indent2, "subTitle",  f, subttl, TAG_OPENCLOSE | TAG_NEWLINE, NULL );
+	output_fil( out, indent2, "partName",  f, parttl, TAG_OPENCLOSE | TAG_NEWLINE, NULL );
 
 	/* MODS output doesn't verify if we don't at least have a <title/> element */
 	if ( ttl==FIELDS_NOTFOUND && subttl==FIELDS_NOTFOUND && parttl==FIELDS_NOTFOUND )
-		output_tag( outptr, indent2, "title", NULL,  TAG_SELFCLOSE | TAG_NEWLINE, NULL );
+		output_tag( out, indent2, "title", NULL,  TAG_SELFCLOSE | TAG_NEWLINE, NULL );
 
-	output_tag( outptr, indent1, "titleInfo", NULL,      TAG_CLOSE     | TAG_NEWLINE, NULL );
+	output_tag( out, indent1, "titleInfo", NULL,      TAG_CLOSE     | TAG_NEWLINE, NULL );
 
 
 	/* output shorttitle if it's different from normal title */
@@ -228,14 +241,14 @@ output_title( FILE *outptr, fields *f, int level )
 
 	val = (char *) fields_value( f, shrttl, FIELDS_CHRP );
 	if ( ttl==FIELDS_NOTFOUND || subttl!=FIELDS_NOTFOUND || strcmp(fields_value(f,ttl,FIELDS_CHRP),val) ) {
-		output_tag( outptr, indent1, "titleInfo", NULL, TAG_OPEN      | TAG_NEWLINE, "type", "abbreviated", NULL );
-		output_tag( outptr, indent2, "title",     val,  TAG_OPENCLOSE | TAG_NEWLINE, NULL );
-		output_tag( outptr, indent1, "titleInfo", NULL, TAG_CLOSE     | TAG_NEWLINE, NULL );
+		output_tag( out, indent1, "titleInfo", NULL, TAG_OPEN      | TAG_NEWLINE, "type", "abbreviated", NULL );
+		output_tag( out, indent2, "title",     val,  TAG_OPENCLOSE | TAG_NEWLINE, NULL );
+		output_tag( out, indent1, "titleInfo", NULL, TAG_CLOSE     | TAG_NEWLINE, NULL );
 	}
 }
 
 static void
-output_name( FILE *outptr, char *p, int level )
+output_name( sink *out, char *p, int level )
 {
 	str family, part, suffix;
 	int n=0;
@@ -254,8 +267,8 @@ output_name( FILE *outptr, char *p, int level )
 				part.data[1]='\0';
 			}
 			if ( n==0 )
-				output_tag( outptr, lvl2indent(level), "name", NULL, TAG_OPEN | TAG_NEWLINE, "type", "personal", NULL );
-			output_tag( outptr, lvl2indent(incr_level(level,1)), "namePart", part.data, TAG_OPENCLOSE | TAG_NEWLINE, "type", "given", NULL );
+				output_tag( out, lvl2indent(level), "name", NULL, TAG_OPEN | TAG_NEWLINE, "type", "personal", NULL );
+			output_tag( out, lvl2indent(incr_level(level,1)), "namePart", part.data, TAG_OPENCLOSE | TAG_NEWLINE, "type", "given", NULL );
 			n++;
 		}
 		if ( *p=='|' ) {
@@ -270,15 +283,15 @@ output_name( FILE *outptr, char *p, int level )
 
 	if ( family.len ) {
 		if ( n==0 )
-			output_tag( outptr, lvl2indent(level), "name", NULL, TAG_OPEN | TAG_NEWLINE, "type", "personal", NULL );
-		output_tag( outptr, lvl2indent(incr_level(level,1)), "namePart", family.data, TAG_OPENCLOSE | TAG_NEWLINE, "type", "family", NULL );
+			output_tag( out, lvl2indent(level), "name", NULL, TAG_OPEN | TAG_NEWLINE, "type", "personal", NULL );
+		output_tag( out, lvl2indent(incr_level(level,1)), "namePart", family.data, TAG_OPENCLOSE | TAG_NEWLINE, "type", "family", NULL );
 		n++;
 	}
 
 	if ( suffix.len ) {
 		if ( n==0 )
-			output_tag( outptr, lvl2indent(level), "name", NULL, TAG_OPEN | TAG_NEWLINE, "type", "personal", NULL );
-		output_tag( outptr, lvl2indent(incr_level(level,1)), "namePart", suffix.data, TAG_OPENCLOSE | TAG_NEWLINE, "type", "suffix", NULL );
+			output_tag( out, lvl2indent(level), "name", NULL, TAG_OPEN | TAG_NEWLINE, "type", "personal", NULL );
+		output_tag( out, lvl2indent(incr_level(level,1)), "namePart", suffix.data, TAG_OPENCLOSE | TAG_NEWLINE, "type", "suffix", NULL );
 	}
 
 	strs_free( &part, &family, &suffix, NULL );
@@ -302,7 +315,7 @@ output_name( FILE *outptr, char *p, int level )
 #define MARC_AUTHORITY (1)
 
 static void
-output_names( FILE *outptr, fields *f, int level )
+output_names( sink *out, fields *f, int level )
 {
 	convert2   names[] = {
 	  { "author",                              "AUTHOR",          0, MARC_AUTHORITY },
@@ -356,24 +369,24 @@ output_names( FILE *outptr, fields *f, int level )
 			if ( strcasecmp( role.data, names[n].internal ) )
 				continue;
 			if ( f_asis ) {
-				output_tag( outptr, lvl2indent(level),               "name",     NULL, TAG_OPEN      | TAG_NEWLINE, NULL );
-				output_fil( outptr, lvl2indent(incr_level(level,1)), "namePart", f, i, TAG_OPENCLOSE | TAG_NEWLINE, NULL );
+				output_tag( out, lvl2indent(level),               "name",     NULL, TAG_OPEN      | TAG_NEWLINE, NULL );
+				output_fil( out, lvl2indent(incr_level(level,1)), "namePart", f, i, TAG_OPENCLOSE | TAG_NEWLINE, NULL );
 			} else if ( f_corp ) {
-				output_tag( outptr, lvl2indent(level),               "name",     NULL, TAG_OPEN      | TAG_NEWLINE, "type", "corporate", NULL );
-				output_fil( outptr, lvl2indent(incr_level(level,1)), "namePart", f, i, TAG_OPENCLOSE | TAG_NEWLINE, NULL );
+				output_tag( out, lvl2indent(level),               "name",     NULL, TAG_OPEN      | TAG_NEWLINE, "type", "corporate", NULL );
+				output_fil( out, lvl2indent(incr_level(level,1)), "namePart", f, i, TAG_OPENCLOSE | TAG_NEWLINE, NULL );
 			} else if ( f_conf ) {
-				output_tag( outptr, lvl2indent(level),               "name",     NULL, TAG_OPEN      |  TAG_NEWLINE, "type", "conference", NULL );
-				output_fil( outptr, lvl2indent(incr_level(level,1)), "namePart", f, i, TAG_OPENCLOSE | TAG_NEWLINE, NULL );
+				output_tag( out, lvl2indent(level),               "name",     NULL, TAG_OPEN      |  TAG_NEWLINE, "type", "conference", NULL );
+				output_fil( out, lvl2indent(incr_level(level,1)), "namePart", f, i, TAG_OPENCLOSE | TAG_NEWLINE, NULL );
 			} else {
-				output_name(outptr, fields_value( f, i, FIELDS_CHRP ), level);
+				output_name(out, fields_value( f, i, FIELDS_CHRP ), level);
 			}
-			output_tag( outptr, lvl2indent(incr_level(level,1)), "role", NULL, TAG_OPEN | TAG_NEWLINE, NULL );
+			output_tag( out, lvl2indent(incr_level(level,1)), "role", NULL, TAG_OPEN | TAG_NEWLINE, NULL );
 			if ( names[n].code & MARC_AUTHORITY )
-				output_tag( outptr, lvl2indent(incr_level(level,2)), "roleTerm", names[n].mods, TAG_OPENCLOSE | TAG_NEWLINE, "authority", "marcrelator", "type", "text", NULL );
+				output_tag( out, lvl2indent(incr_level(level,2)), "roleTerm", names[n].mods, TAG_OPENCLOSE | TAG_NEWLINE, "authority", "marcrelator", "type", "text", NULL );
 			else
-				output_tag( outptr, lvl2indent(incr_level(level,2)), "roleTerm", names[n].mods, TAG_OPENCLOSE | TAG_NEWLINE, "type", "text", NULL );
-			output_tag( outptr, lvl2indent(incr_level(level,1)), "role", NULL, TAG_CLOSE | TAG_NEWLINE, NULL );
-			output_tag( outptr, lvl2indent(level),               "name", NULL, TAG_CLOSE | TAG_NEWLINE, NULL );
+				output_tag( out, lvl2indent(incr_level(level,2)), "roleTerm", names[n].mods, TAG_OPENCLOSE | TAG_NEWLINE, "type", "text", NULL );
+			output_tag( out, lvl2indent(incr_level(level,1)), "role", NULL, TAG_CLOSE | TAG_NEWLINE, NULL );
+			output_tag( out, lvl2indent(level),               "name", NULL, TAG_CLOSE | TAG_NEWLINE, NULL );
 			fields_set_used( f, i );
 		}
 	}
@@ -441,21 +454,21 @@ find_dateinfo( fields *f, int level, int datepos[ NUM_DATE_TYPES ] )
 }
 
 static void
-output_datepieces( fields *f, FILE *outptr, int pos[ NUM_DATE_TYPES ] )
+output_datepieces( fields *f, sink *out, int pos[ NUM_DATE_TYPES ] )
 {
 	str *s;
 	int i;
 
 	for ( i=0; i<3 && pos[i]!=-1; ++i ) {
-		if ( i>0 ) fprintf( outptr, "-" );
+		if ( i>0 ) sink_putc( out, '-' );
 		/* zero pad month or days written as "1", "2", "3" ... */
 		if ( i==DATE_MONTH || i==DATE_DAY ) {
 			s = fields_value( f, pos[i], FIELDS_STRP_NOUSE );
 			if ( s->len==1 ) {
-				fprintf( outptr, "0" );
+				sink_putc( out, '0' );
 			}
 		}
-		fprintf( outptr, "%s", (char *) fields_value( f, pos[i], FIELDS_CHRP ) );
+		sink_puts( out, (char *) fields_value( f, pos[i], FIELDS_CHRP ) );
 	}
 }
 
@@ -465,19 +478,19 @@ output_datepieces( fields *f, FILE *outptr, int pos[ NUM_DATE_TYPES ] )
  * <dateIssued>DateAll</dateIssued>
  */
 static void
-output_dateissued( fields *f, FILE *outptr, int level, int pos[ NUM_DATE_TYPES ] )
+output_dateissued( fields *f, sink *out, int level, int pos[ NUM_DATE_TYPES ] )
 {
-	output_tag( outptr, lvl2indent(incr_level(level,1)), "dateIssued", NULL, TAG_OPEN, NULL );
+	output_tag( out, lvl2indent(incr_level(level,1)), "dateIssued", NULL, TAG_OPEN, NULL );
 	if ( pos[ DATE_YEAR ]!=-1 || pos[ DATE_MONTH ]!=-1 || pos[ DATE_DAY ]!=-1 ) {
-		output_datepieces( f, outptr, pos );
+		output_datepieces( f, out, pos );
 	} else {
-		fprintf( outptr, "%s", (char *) fields_value( f, pos[ DATE_ALL ], FIELDS_CHRP ) );
+		sink_puts( out, (char *) fields_value( f, pos[ DATE_ALL ], FIELDS_CHRP ) );
 	}
-	output_tag( outptr, 0, "dateIssued", NULL, TAG_CLOSE | TAG_NEWLINE, NULL );
+	output_tag( out, 0, "dateIssued", NULL, TAG_CLOSE | TAG_NEWLINE, NULL );
 }
 
 static void
-output_origin( FILE *outptr, fields *f, int level )
+output_origin( sink *out, fields *f, int level )
 {
 	convert2 parts[] = {
 		{ "issuance",	  "ISSUANCE",          0, 0 },
@@ -501,15 +514,15 @@ output_origin( FILE *outptr, fields *f, int level )
 	indent1 = lvl2indent( incr_level( level, 1 ) );
 	indent2 = lvl2indent( incr_level( level, 2 ) );
 
-	output_tag( outptr, indent0, "originInfo", NULL, TAG_OPEN | TAG_NEWLINE, NULL );
+	output_tag( out, indent0, "originInfo", NULL, TAG_OPEN | TAG_NEWLINE, NULL );
 
 	/* issuance must precede date */
 	if ( parts[0].pos!=-1 )
-		output_fil( outptr, indent1, "issuance", f, parts[0].pos, TAG_OPENCLOSE | TAG_NEWLINE, NULL );
+		output_fil( out, indent1, "issuance", f, parts[0].pos, TAG_OPENCLOSE | TAG_NEWLINE, NULL );
 
 	/* date */
 	if ( datefound )
-		output_dateissued( f, outptr, level, datepos );
+		output_dateissued( f, out, level, datepos );
 
 	/* rest of the originInfo elements */
 	for ( i=1; i<nparts; i++ ) {
@@ -519,18 +532,18 @@ output_origin( FILE *outptr, fields *f, int level )
 
 		/* normal originInfo element */
 		if ( parts[i].code==0 ) {
-			output_fil( outptr, indent1, parts[i].mods, f, parts[i].pos, TAG_OPENCLOSE | TAG_NEWLINE, NULL );
+			output_fil( out, indent1, parts[i].mods, f, parts[i].pos, TAG_OPENCLOSE | TAG_NEWLINE, NULL );
 		}
 
 		/* originInfo with placeTerm info */
 		else {
-			output_tag( outptr, indent1, parts[i].mods, NULL,            TAG_OPEN      | TAG_NEWLINE, NULL );
-			output_fil( outptr, indent2, "placeTerm",   f, parts[i].pos, TAG_OPENCLOSE | TAG_NEWLINE, "type", "text", NULL );
-			output_tag( outptr, indent1, parts[i].mods, NULL,            TAG_CLOSE     | TAG_NEWLINE, NULL );
+			output_tag( out, indent1, parts[i].mods, NULL,            TAG_OPEN      | TAG_NEWLINE, NULL );
+			output_fil( out, indent2, "placeTerm",   f, parts[i].pos, TAG_OPENCLOSE | TAG_NEWLINE, "type", "text", NULL );
+			output_tag( out, indent1, parts[i].mods, NULL,            TAG_CLOSE     | TAG_NEWLINE, NULL );
 		}
 	}
 
-	output_tag( outptr, indent0, "originInfo", NULL, TAG_CLOSE | TAG_NEWLINE, NULL );
+	output_tag( out, indent0, "originInfo", NULL, TAG_CLOSE | TAG_NEWLINE, NULL );
 }
 
 /* output_language_core()
@@ -553,7 +566,7 @@ output_origin( FILE *outptr, fields *f, int level )
  *
  */
 static void
-output_language_core( fields *f, int n, FILE *outptr, const char *tag, int level )
+output_language_core( fields *f, int n, sink *out, const char *tag, int level )
 {
 	const char *term = "languageTerm";
 	const char *lang, *code;
@@ -565,13 +578,13 @@ output_language_core( fields *f, int n, FILE *outptr, const char *tag, int level
 	indent1 = lvl2indent( level );
 	indent2 = lvl2indent( incr_level( level, 1 ) );
 
-	output_tag( outptr, indent1, tag,  NULL, TAG_OPEN      | TAG_NEWLINE, NULL );
-	output_tag( outptr, indent2, term, lang, TAG_OPENCLOSE | TAG_NEWLINE, "type", "text", NULL );
+	output_tag( out, indent1, tag,  NULL, TAG_OPEN      | TAG_NEWLINE, NULL );
+	output_tag( out, indent2, term, lang, TAG_OPENCLOSE | TAG_NEWLINE, "type", "text", NULL );
 
 	if ( code )
-		output_tag( outptr, indent2, term, code, TAG_OPENCLOSE | TAG_NEWLINE, "type", "code", "authority", "iso639-2b", NULL );
+		output_tag( out, indent2, term, code, TAG_OPENCLOSE | TAG_NEWLINE, "type", "code", "authority", "iso639-2b", NULL );
 
-	output_tag( outptr, indent1, tag,  NULL, TAG_CLOSE     | TAG_NEWLINE, NULL );
+	output_tag( out, indent1, tag,  NULL, TAG_CLOSE     | TAG_NEWLINE, NULL );
 }
 
 /*
@@ -583,14 +596,14 @@ output_language_core( fields *f, int n, FILE *outptr, const char *tag, int level
  * </language>
  */
 static inline void
-output_language( FILE *outptr, fields *f, int level )
+output_language( sink *out, fields *f, int level )
 {
 	int n;
 	
 	n = fields_find( f, "LANGUAGE", level );
 	if ( n==FIELDS_NOTFOUND ) return;
 
-	output_language_core( f, n, outptr, "language", level );
+	output_language_core( f, n, out, "language", level );
 }
 
 /* output_description()
@@ -600,7 +613,7 @@ output_language( FILE *outptr, fields *f, int level )
  * </physicalDescription>
  */
 static void
-output_description( FILE *outptr, fields *f, int level )
+output_description( sink *out, fields *f, int level )
 {
 	int n, indent1, indent2;
 	const char *val;
@@ -613,9 +626,9 @@ output_description( FILE *outptr, fields *f, int level )
 	indent1 = lvl2indent( level );
 	indent2 = lvl2indent( incr_level( level, 1 ) );
 
-	output_tag( outptr, indent1, "physicalDescription", NULL, TAG_OPEN      | TAG_NEWLINE, NULL );
-	output_tag( outptr, indent2, "note",                val,  TAG_OPENCLOSE | TAG_NEWLINE, NULL );
-	output_tag( outptr, indent1, "physicalDescription", NULL, TAG_CLOSE     | TAG_NEWLINE, NULL );
+	output_tag( out, indent1, "physicalDescription", NULL, TAG_OPEN      | TAG_NEWLINE, NULL );
+	output_tag( out, indent2, "note",                val,  TAG_OPENCLOSE | TAG_NEWLINE, NULL );
+	output_tag( out, indent1, "physicalDescription", NULL, TAG_CLOSE     | TAG_NEWLINE, NULL );
 }
 
 /* output_toc()
@@ -623,7 +636,7 @@ output_description( FILE *outptr, fields *f, int level )
  * <tableOfContents>XXXX</tableOfContents>
  */
 static void
-output_toc( FILE *outptr, fields *f, int level )
+output_toc( sink *out, fields *f, int level )
 {
 	int n, indent;
 	char *val;
@@ -635,7 +648,7 @@ output_toc( FILE *outptr, fields *f, int level )
 
 	indent = lvl2indent( level );
 
-	output_tag( outptr, indent, "tableOfContents", val, TAG_OPENCLOSE | TAG_NEWLINE, NULL );
+	output_tag( out, indent, "tableOfContents", val, TAG_OPENCLOSE | TAG_NEWLINE, NULL );
 }
 
 /* detail output
@@ -645,7 +658,7 @@ output_toc( FILE *outptr, fields *f, int level )
  * <detail type="volume"><number>xxx</number></detail>
  */
 static void
-output_detail( FILE *outptr, fields *f, int n, char *item_name, int level )
+output_detail( sink *out, fields *f, int n, char *item_name, int level )
 {
 	int indent;
 
@@ -653,9 +666,9 @@ output_detail( FILE *outptr, fields *f, int n, char *item_name, int level )
 
 	indent = lvl2indent( incr_level( level, 1 ) );
 
-	output_tag( outptr, indent, "detail", NULL,  TAG_OPEN, "type", item_name, NULL );
-	output_fil( outptr, 0,      "number", f, n,  TAG_OPENCLOSE, NULL );
-	output_tag( outptr, 0,      "detail", NULL,  TAG_CLOSE | TAG_NEWLINE, NULL );
+	output_tag( out, indent, "detail", NULL,  TAG_OPEN, "type", item_name, NULL );
+	output_fil( out, 0,      "number", f, n,  TAG_OPENCLOSE, NULL );
+	output_tag( out, 0,      "detail", NULL,  TAG_CLOSE | TAG_NEWLINE, NULL );
 }
 
 /* extents output
@@ -666,7 +679,7 @@ output_detail( FILE *outptr, fields *f, int n, char *item_name, int level )
  * </extent>
  */
 static void
-output_extents( FILE *outptr, fields *f, int start, int end, int total, const char *type, int level )
+output_extents( sink *out, fields *f, int start, int end, int total, const char *type, int level )
 {
 	int indent1, indent2;
 	char *val;
@@ -674,34 +687,34 @@ output_extents( FILE *outptr, fields *f, int start, int end, int total, const ch
 	indent1 = lvl2indent( incr_level( level, 1 ) );
 	indent2 = lvl2indent( incr_level( level, 2 ) );
 
-	output_tag( outptr, indent1, "extent", NULL, TAG_OPEN | TAG_NEWLINE, "unit", type, NULL );
+	output_tag( out, indent1, "extent", NULL, TAG_OPEN | TAG_NEWLINE, "unit", type, NULL );
 	if ( start!=FIELDS_NOTFOUND ) {
 		val = (char *) fields_value( f, start, FIELDS_CHRP );
-		output_tag( outptr, indent2, "start", val, TAG_OPENCLOSE | TAG_NEWLINE, NULL );
+		output_tag( out, indent2, "start", val, TAG_OPENCLOSE | TAG_NEWLINE, NULL );
 	}
 	if ( end!=FIELDS_NOTFOUND ) {
 		val = (char *) fields_value( f, end, FIELDS_CHRP );
-		output_tag( outptr, indent2, "end",   val, TAG_OPENCLOSE | TAG_NEWLINE, NULL );
+		output_tag( out, indent2, "end",   val, TAG_OPENCLOSE | TAG_NEWLINE, NULL );
 	}
 	if ( total!=FIELDS_NOTFOUND ) {
 		val = (char *) fields_value( f, total, FIELDS_CHRP );
-		output_tag( outptr, indent2, "total", val, TAG_OPENCLOSE | TAG_NEWLINE, NULL );
+		output_tag( out, indent2, "total", val, TAG_OPENCLOSE | TAG_NEWLINE, NULL );
 	}
-	output_tag( outptr, indent1, "extent", NULL, TAG_CLOSE | TAG_NEWLINE, NULL );
+	output_tag( out, indent1, "extent", NULL, TAG_CLOSE | TAG_NEWLINE, NULL );
 }
 
 static void
-try_output_partheader( FILE *outptr, int wrote_header, int level )
+try_output_partheader( sink *out, int wrote_header, int level )
 {
 	if ( !wrote_header )
-		output_tag( outptr, lvl2indent(level), "part", NULL, TAG_OPEN | TAG_NEWLINE, NULL );
+		output_tag( out, lvl2indent(level), "part", NULL, TAG_OPEN | TAG_NEWLINE, NULL );
 }
 
 static void
-try_output_partfooter( FILE *outptr, int wrote_header, int level )
+try_output_partfooter( sink *out, int wrote_header, int level )
 {
 	if ( wrote_header )
-		output_tag( outptr, lvl2indent(level), "part", NULL, TAG_CLOSE | TAG_NEWLINE, NULL );
+		output_tag( out, lvl2indent(level), "part", NULL, TAG_CLOSE | TAG_NEWLINE, NULL );
 }
 
 /* part date output
@@ -710,7 +723,7 @@ try_output_partfooter( FILE *outptr, int wrote_header, int level )
  *
  */
 static int
-output_partdate( FILE *outptr, fields *f, int level, int wrote_header )
+output_partdate( sink *out, fields *f, int level, int wrote_header )
 {
 	convert2 parts[] = {
 		{ "",	"PARTDATE:YEAR",           0, 0 },
@@ -721,31 +734,33 @@ output_partdate( FILE *outptr, fields *f, int level, int wrote_header )
 
 	if ( !convert2_findallfields( f, parts, nparts, level ) ) return 0;
 
-	try_output_partheader( outptr, wrote_header, level );
+	try_output_partheader( out, wrote_header, level );
 
-	output_tag( outptr, lvl2indent(incr_level(level,1)), "date", NULL, TAG_OPEN, NULL );
+	output_tag( out, lvl2indent(incr_level(level,1)), "date", NULL, TAG_OPEN, NULL );
 
 	if ( parts[0].pos!=-1 ) {
-		fprintf( outptr, "%s", (char *) fields_value( f, parts[0].pos, FIELDS_CHRP ) );
-	} else fprintf( outptr, "XXXX" );
+		sink_puts( out, (char *) fields_value( f, parts[0].pos, FIELDS_CHRP ) );
+	} else sink_puts( out, "XXXX" );
 
 	if ( parts[1].pos!=-1 ) {
-		fprintf( outptr, "-%s", (char *) fields_value( f, parts[1].pos, FIELDS_CHRP ) );
+		sink_putc( out, '-' );
+		sink_puts( out, (char *) fields_value( f, parts[1].pos, FIELDS_CHRP ) );
 	}
 
 	if ( parts[2].pos!=-1 ) {
 		if ( parts[1].pos==-1 )
-			fprintf( outptr, "-XX" );
-		fprintf( outptr, "-%s", (char *) fields_value( f, parts[2].pos, FIELDS_CHRP ) );
+			sink_puts( out, "-XX" );
+		sink_putc( out, '-' );
+		sink_puts( out, (char *) fields_value( f, parts[2].pos, FIELDS_CHRP ) );
 	}
 
-	fprintf( outptr,"</date>\n");
+	sink_puts( out, "</date>\n" );
 
 	return 1;
 }
 
 static int
-output_partpages( FILE *outptr, fields *f, int level, int wrote_header )
+output_partpages( sink *out, fields *f, int level, int wrote_header )
 {
 	convert2 parts[] = {
 		{ "",  "PAGES:START",              0, 0 },
@@ -757,29 +772,29 @@ output_partpages( FILE *outptr, fields *f, int level, int wrote_header )
 
 	if ( !convert2_findallfields( f, parts, nparts, level ) ) return 0;
 
-	try_output_partheader( outptr, wrote_header, level );
+	try_output_partheader( out, wrote_header, level );
 
 	/* If PAGES:START or PAGES:STOP are undefined */
 	if ( parts[0].pos==-1 || parts[1].pos==-1 ) {
 		if ( parts[0].pos!=-1 )
-			output_detail ( outptr, f, parts[0].pos, "page", level );
+			output_detail ( out, f, parts[0].pos, "page", level );
 		if ( parts[1].pos!=-1 )
-			output_detail ( outptr, f, parts[1].pos, "page", level );
+			output_detail ( out, f, parts[1].pos, "page", level );
 		if ( parts[2].pos!=-1 )
-			output_detail ( outptr, f, parts[2].pos, "page", level );
+			output_detail ( out, f, parts[2].pos, "page", level );
 		if ( parts[3].pos!=-1 )
-			output_extents( outptr, f, FIELDS_NOTFOUND, FIELDS_NOTFOUND, parts[3].pos, "page", level );
+			output_extents( out, f, FIELDS_NOTFOUND, FIELDS_NOTFOUND, parts[3].pos, "page", level );
 	}
 	/* If both PAGES:START and PAGES:STOP are defined */
 	else {
-		output_extents( outptr, f, parts[0].pos, parts[1].pos, parts[3].pos, "page", level );
+		output_extents( out, f, parts[0].pos, parts[1].pos, parts[3].pos, "page", level );
 	}
 
 	return 1;
 }
 
 static int
-output_partelement( FILE *outptr, fields *f, int level, int wrote_header )
+output_partelement( sink *out, fields *f, int level, int wrote_header )
 {
 	convert2 parts[] = {
 		{ "",                "NUMVOLUMES",      0, 0 },
@@ -798,28 +813,28 @@ output_partelement( FILE *outptr, fields *f, int level, int wrote_header )
 
 	if ( !convert2_findallfields( f, parts, nparts, level ) ) return 0;
 
-	try_output_partheader( outptr, wrote_header, level );
+	try_output_partheader( out, wrote_header, level );
 
 	/* start loop at 1 to skip NUMVOLUMES */
 	for ( i=1; i<nparts; ++i ) {
 		if ( parts[i].pos==FIELDS_NOTFOUND ) continue;
-		output_detail( outptr, f, parts[i].pos, parts[i].mods, level );
+		output_detail( out, f, parts[i].pos, parts[i].mods, level );
 	}
 
 	if ( parts[0].pos!=FIELDS_NOTFOUND )
-		output_extents( outptr, f, FIELDS_NOTFOUND, FIELDS_NOTFOUND, parts[0].pos, "volumes", level );
+		output_extents( out, f, FIELDS_NOTFOUND, FIELDS_NOTFOUND, parts[0].pos, "volumes", level );
 
 	return 1;
 }
 
 static void
-output_part( FILE *outptr, fields *f, int level )
+output_part( sink *out, fields *f, int level )
 {
 	int wrote_hdr;
-	wrote_hdr  = output_partdate( outptr, f, level, 0 );
-	wrote_hdr += output_partelement( outptr, f, level, wrote_hdr );
-	wrote_hdr += output_partpages( outptr, f, level, wrote_hdr );
-	try_output_partfooter( outptr, wrote_hdr, level );
+	wrote_hdr  = output_partdate( out, f, level, 0 );
+	wrote_hdr += output_partelement( out, f, level, wrote_hdr );
+	wrote_hdr += output_partpages( out, f, level, wrote_hdr );
+	try_output_partfooter( out, wrote_hdr, level );
 }
 
 /* output_recordInfo()
@@ -832,7 +847,7 @@ output_part( FILE *outptr, fields *f, int level )
  * </recordInfo>
  */
 static void
-output_recordInfo( FILE *outptr, fields *f, int level )
+output_recordInfo( sink *out, fields *f, int level )
 {
 	int n, indent;
 
@@ -841,9 +856,9 @@ output_recordInfo( FILE *outptr, fields *f, int level )
 
 	indent = lvl2indent( level );
 
-	output_tag( outptr, indent, "recordInfo", NULL, TAG_OPEN  | TAG_NEWLINE, NULL );
-	output_language_core( f, n, outptr, "languageOfCataloging", incr_level(level,1) );
-	output_tag( outptr, indent, "recordInfo", NULL, TAG_CLOSE | TAG_NEWLINE, NULL );
+	output_tag( out, indent, "recordInfo", NULL, TAG_OPEN  | TAG_NEWLINE, NULL );
+	output_language_core( f, n, out, "languageOfCataloging", incr_level(level,1) );
+	output_tag( out, indent, "recordInfo", NULL, TAG_CLOSE | TAG_NEWLINE, NULL );
 }
 
 /* output_genre()
@@ -852,7 +867,7 @@ output_recordInfo( FILE *outptr, fields *f, int level )
  * <genre authority="bibutilsgt">Diploma thesis</genre>
  */
 static void
-output_genre( FILE *outptr, fields *f, int level )
+output_genre( sink *out, fields *f, int level )
 {
 	const char *authority="authority", *marcauth="marcgt", *buauth="bibutilsgt";
 	const char *attr = NULL, *attrvalue = NULL;
@@ -894,7 +909,7 @@ output_genre( FILE *outptr, fields *f, int level )
 			}
 		}
 
-		output_tag( outptr, lvl2indent(level), "genre", value, TAG_OPENCLOSE | TAG_NEWLINE, attr, attrvalue, NULL );
+		output_tag( out, lvl2indent(level), "genre", value, TAG_OPENCLOSE | TAG_NEWLINE, attr, attrvalue, NULL );
 
 	}
 }
@@ -906,7 +921,7 @@ output_genre( FILE *outptr, fields *f, int level )
  * Only output typeOfResources defined by MARC authority
  */
 static void
-output_resource( FILE *outptr, fields *f, int level )
+output_resource( sink *out, fields *f, int level )
 {
 	const char *value;
 	int n;
@@ -916,14 +931,14 @@ output_resource( FILE *outptr, fields *f, int level )
 
 	value = ( const char * ) fields_value( f, n, FIELDS_CHRP );
 	if ( is_marc_resource( value ) ) {
-		output_fil( outptr, lvl2indent(level), "typeOfResource", f, n, TAG_OPENCLOSE | TAG_NEWLINE, NULL );
+		output_fil( out, lvl2indent(level), "typeOfResource", f, n, TAG_OPENCLOSE | TAG_NEWLINE, NULL );
 	} else {
 		fprintf( stderr, "Illegal typeofResource = '%s'\n", value );
 	}
 }
 
 static void
-output_type( FILE *outptr, fields *f, int level )
+output_type( sink *out, fields *f, int level )
 {
 	int n;
 
@@ -931,8 +946,8 @@ output_type( FILE *outptr, fields *f, int level )
 	n = fields_find( f, "INTERNAL_TYPE", LEVEL_MAIN );
 	if ( n!=FIELDS_NOTFOUND ) fields_set_used( f, n );
 
-	output_resource( outptr, f, level );
-	output_genre( outptr, f, level );
+	output_resource( out, f, level );
+	output_genre( out, f, level );
 }
 
 /* output_abs()
@@ -940,16 +955,16 @@ output_type( FILE *outptr, fields *f, int level )
  * <abstract>xxxx</abstract>
  */
 static void
-output_abs( FILE *outptr, fields *f, int level )
+output_abs( sink *out, fields *f, int level )
 {
 	int n;
 
 	n = fields_find( f, "ABSTRACT", level );
-	output_fil( outptr, lvl2indent(level), "abstract", f, n, TAG_OPENCLOSE | TAG_NEWLINE, NULL );
+	output_fil( out, lvl2indent(level), "abstract", f, n, TAG_OPENCLOSE | TAG_NEWLINE, NULL );
 }
 
 static void
-output_notes( FILE *outptr, fields *f, int level )
+output_notes( sink *out, fields *f, int level )
 {
 	int i, n;
 	char *t;
@@ -959,19 +974,19 @@ output_notes( FILE *outptr, fields *f, int level )
 		if ( fields_level( f, i ) != level ) continue;
 		t = fields_tag( f, i, FIELDS_CHRP_NOUSE );
 		if ( !strcasecmp( t, "NOTES" ) )
-			output_fil( outptr, lvl2indent(level), "note", f, i, TAG_OPENCLOSE | TAG_NEWLINE, NULL );
+			output_fil( out, lvl2indent(level), "note", f, i, TAG_OPENCLOSE | TAG_NEWLINE, NULL );
 		else if ( !strcasecmp( t, "PUBSTATE" ) )
-			output_fil( outptr, lvl2indent(level), "note", f, i, TAG_OPENCLOSE | TAG_NEWLINE, "type", "publication status", NULL );
+			output_fil( out, lvl2indent(level), "note", f, i, TAG_OPENCLOSE | TAG_NEWLINE, "type", "publication status", NULL );
 		else if ( !strcasecmp( t, "ANNOTE" ) )
-			output_fil( outptr, lvl2indent(level), "bibtex-annote", f, i, TAG_OPENCLOSE | TAG_NEWLINE, NULL );
+			output_fil( out, lvl2indent(level), "bibtex-annote", f, i, TAG_OPENCLOSE | TAG_NEWLINE, NULL );
 		else if ( !strcasecmp( t, "TIMESCITED" ) )
-			output_fil( outptr, lvl2indent(level), "note", f, i, TAG_OPENCLOSE | TAG_NEWLINE, "type", "times cited", NULL );
+			output_fil( out, lvl2indent(level), "note", f, i, TAG_OPENCLOSE | TAG_NEWLINE, "type", "times cited", NULL );
 		else if ( !strcasecmp( t, "ANNOTATION" ) )
-			output_fil( outptr, lvl2indent(level), "note", f, i, TAG_OPENCLOSE | TAG_NEWLINE, "type", "annotation", NULL );
+			output_fil( out, lvl2indent(level), "note", f, i, TAG_OPENCLOSE | TAG_NEWLINE, "type", "annotation", NULL );
 		else if ( !strcasecmp( t, "ADDENDUM" ) )
-			output_fil( outptr, lvl2indent(level), "note", f, i, TAG_OPENCLOSE | TAG_NEWLINE, "type", "addendum", NULL );
+			output_fil( out, lvl2indent(level), "note", f, i, TAG_OPENCLOSE | TAG_NEWLINE, "type", "addendum", NULL );
 		else if ( !strcasecmp( t, "BIBKEY" ) )
-			output_fil( outptr, lvl2indent(level), "note", f, i, TAG_OPENCLOSE | TAG_NEWLINE, "type", "bibliography key", NULL );
+			output_fil( out, lvl2indent(level), "note", f, i, TAG_OPENCLOSE | TAG_NEWLINE, "type", "bibliography key", NULL );
 	}
 }
 
@@ -985,7 +1000,7 @@ output_notes( FILE *outptr, fields *f, int level )
  * </subject>
  */
 static void
-output_key( FILE *outptr, fields *f, int level )
+output_key( sink *out, fields *f, int level )
 {
 	int indent1, indent2;
 	vplist_index i;
@@ -1005,9 +1020,9 @@ output_key( FILE *outptr, fields *f, int level )
 
 	for ( i=0; i<keys.n; ++i ) {
 		value = vplist_get( &keys, i );
-		output_tag( outptr, indent1, "subject", NULL,  TAG_OPEN      | TAG_NEWLINE, NULL );
-		output_tag( outptr, indent2, "topic",   value, TAG_OPENCLOSE | TAG_NEWLINE, NULL );
-		output_tag( outptr, indent1, "subject", NULL,  TAG_CLOSE     | TAG_NEWLINE, NULL );
+		output_tag( out, indent1, "subject", NULL,  TAG_OPEN      | TAG_NEWLINE, NULL );
+		output_tag( out, indent2, "topic",   value, TAG_OPENCLOSE | TAG_NEWLINE, NULL );
+		output_tag( out, indent1, "subject", NULL,  TAG_CLOSE     | TAG_NEWLINE, NULL );
 	}
 
 	vplist_empty( &keys );
@@ -1019,10 +1034,10 @@ output_key( FILE *outptr, fields *f, int level )
 
 	for ( i=0; i<keys.n; ++i ) {
 		value = vplist_get( &keys, i );
-		output_tag( outptr, indent1, "subject", NULL,  TAG_OPEN      | TAG_NEWLINE, NULL );
-		output_tag( outptr, indent2, "topic",   value, TAG_OPENCLOSE | TAG_NEWLINE,
+		output_tag( out, indent1, "subject", NULL,  TAG_OPEN      | TAG_NEWLINE, NULL );
+		output_tag( out, indent2, "topic",   value, TAG_OPENCLOSE | TAG_NEWLINE,
 				"class", "primary", NULL );
-		output_tag( outptr, indent1, "subject", NULL,  TAG_CLOSE     | TAG_NEWLINE, NULL );
+		output_tag( out, indent1, "subject", NULL,  TAG_CLOSE     | TAG_NEWLINE, NULL );
 	}
 
 out:
@@ -1030,7 +1045,7 @@ out:
 }
 
 static void
-output_sn( FILE *outptr, fields *f, int level )
+output_sn( sink *out, fields *f, int level )
 {
 	convert sn_types[] = {
 		{ "isbn",      "ISBN",      },
@@ -1065,7 +1080,7 @@ output_sn( FILE *outptr, fields *f, int level )
 
 	/* output call number */
 	n = fields_find( f, "CALLNUMBER", level );
-	output_fil( outptr, indent, "classification", f, n, TAG_OPENCLOSE | TAG_NEWLINE, NULL );
+	output_fil( out, indent, "classification", f, n, TAG_OPENCLOSE | TAG_NEWLINE, NULL );
 
 	/* output all types of serial numbers */
 	for ( i=0; i<ntypes; ++i ) {
@@ -1073,7 +1088,7 @@ output_sn( FILE *outptr, fields *f, int level )
 		status = fields_findv_each( f, level, FIELDS_CHRP, &serialno, sn_types[i].internal );
 		if ( status!=FIELDS_OK ) goto out;
 
-		output_vpl( outptr, indent, "identifier", &serialno, TAG_OPENCLOSE | TAG_NEWLINE,
+		output_vpl( out, indent, "identifier", &serialno, TAG_OPENCLOSE | TAG_NEWLINE,
 				"type", sn_types[i].mods, NULL );
 
 		vplist_empty( &serialno );
@@ -1093,7 +1108,7 @@ out:
  * </location>
  */
 static void
-output_url( FILE *outptr, fields *f, int level )
+output_url( sink *out, fields *f, int level )
 {
 	vplist fileattach, location, pdflink, url;
 	int indent1, indent2, status;
@@ -1125,17 +1140,17 @@ output_url( FILE *outptr, fields *f, int level )
 	indent1 = lvl2indent( level );
 	indent2 = lvl2indent( incr_level( level, 1 ) );
 
-	output_tag( outptr, indent1, "location", NULL, TAG_OPEN | TAG_NEWLINE, NULL );
+	output_tag( out, indent1, "location", NULL, TAG_OPEN | TAG_NEWLINE, NULL );
 
-	output_vpl( outptr, indent2, "url", &url, TAG_OPENCLOSE | TAG_NEWLINE, NULL );
-	output_vpl( outptr, indent2, "url", &pdflink, TAG_OPENCLOSE | TAG_NEWLINE, NULL );
-	output_vpl( outptr, indent2, "url", &fileattach, TAG_OPENCLOSE | TAG_NEWLINE,
+	output_vpl( out, indent2, "url", &url, TAG_OPENCLOSE | TAG_NEWLINE, NULL );
+	output_vpl( out, indent2, "url", &pdflink, TAG_OPENCLOSE | TAG_NEWLINE, NULL );
+	output_vpl( out, indent2, "url", &fileattach, TAG_OPENCLOSE | TAG_NEWLINE,
 			"displayLabel", "Electronic full text",
 			"access",       "raw object",
 			NULL );
-	output_vpl( outptr, indent2, "physicalLocation", &location, TAG_OPENCLOSE | TAG_NEWLINE, NULL );
+	output_vpl( out, indent2, "physicalLocation", &location, TAG_OPENCLOSE | TAG_NEWLINE, NULL );
 
-	output_tag( outptr, indent1, "location", NULL, TAG_CLOSE | TAG_NEWLINE, NULL );
+	output_tag( out, indent1, "location", NULL, TAG_CLOSE | TAG_NEWLINE, NULL );
 
 out:
 	vplist_free( &fileattach );
@@ -1159,22 +1174,22 @@ original_items( fields *f, int level )
 }
 
 static void
-output_citeparts( FILE *outptr, fields *f, int level, int max )
+output_citeparts( sink *out, fields *f, int level, int max )
 {
 	int orig_level;
 
-	output_title      ( outptr, f, level );
-	output_names      ( outptr, f, level );
-	output_origin     ( outptr, f, level );
-	output_type       ( outptr, f, level );
-	output_language   ( outptr, f, level );
-	output_description( outptr, f, level );
+	output_title      ( out, f, level );
+	output_names      ( out, f, level );
+	output_origin     ( out, f, level );
+	output_type       ( out, f, level );
+	output_language   ( out, f, level );
+	output_description( out, f, level );
 
 	/* Recursively output relatedItems, which are host items like series for a book */
 	if ( level >= 0 && level < max ) {
-		output_tag( outptr, lvl2indent(level), "relatedItem", NULL, TAG_OPEN  | TAG_NEWLINE, "type", "host", NULL );
-		output_citeparts( outptr, f, incr_level(level,1), max );
-		output_tag( outptr, lvl2indent(level), "relatedItem", NULL, TAG_CLOSE | TAG_NEWLINE, NULL );
+		output_tag( out, lvl2indent(level), "relatedItem", NULL, TAG_OPEN  | TAG_NEWLINE, "type", "host", NULL );
+		output_citeparts( out, f, incr_level(level,1), max );
+		output_tag( out, lvl2indent(level), "relatedItem", NULL, TAG_CLOSE | TAG_NEWLINE, NULL );
 	}
 
 	/* Recursively output relatedItems that are original item, if they exist;
@@ -1182,19 +1197,19 @@ output_citeparts( FILE *outptr, fields *f, int level, int max )
 	 */
 	orig_level = original_items( f, level );
 	if ( orig_level ) {
-		output_tag( outptr, lvl2indent(level), "relatedItem", NULL, TAG_OPEN  | TAG_NEWLINE, "type", "original", NULL );
-		output_citeparts( outptr, f, orig_level, max );
-		output_tag( outptr, lvl2indent(level), "relatedItem", NULL, TAG_CLOSE | TAG_NEWLINE, NULL );
+		output_tag( out, lvl2indent(level), "relatedItem", NULL, TAG_OPEN  | TAG_NEWLINE, "type", "original", NULL );
+		output_citeparts( out, f, orig_level, max );
+		output_tag( out, lvl2indent(level), "relatedItem", NULL, TAG_CLOSE | TAG_NEWLINE, NULL );
 	}
 
-	output_abs       ( outptr, f, level );
-	output_notes     ( outptr, f, level );
-	output_toc       ( outptr, f, level );
-	output_key       ( outptr, f, level );
-	output_sn        ( outptr, f, level );
-	output_url       ( outptr, f, level );
-	output_part      ( outptr, f, level );
-	output_recordInfo( outptr, f, level );
+	output_abs       ( out, f, level );
+	output_notes     ( out, f, level );
+	output_toc       ( out, f, level );
+	output_key       ( out, f, level );
+	output_sn        ( out, f, level );
+	output_url       ( out, f, level );
+	output_part      ( out, f, level );
+	output_recordInfo( out, f, level );
 }
 
 static int
@@ -1269,49 +1284,48 @@ report_unused_tags( FILE *outptr, fields *f, param *p, unsigned long refnum )
 
 /* refnum should start with a non-number and not include spaces -- ignore this */
 static void
-output_refnum( FILE *outptr, fields *f, int n )
+output_refnum( sink *out, fields *f, int n )
 {
 	char *p = fields_value( f, n, FIELDS_CHRP_NOUSE );
 	while ( p && *p ) {
-		if ( !is_ws(*p) ) fprintf( outptr, "%c", *p );
+		if ( !is_ws(*p) ) sink_putc( out, *p );
 		p++;
 	}
 }
 
 static void
-output_head( FILE *outptr, fields *f, int dropkey )
+output_head( sink *out, fields *f, int dropkey )
 {
 	int n;
-	fprintf( outptr, "<mods");
+	sink_puts( out, "<mods" );
 	if ( !dropkey ) {
 		n = fields_find( f, "REFNUM", LEVEL_MAIN );
 		if ( n!=FIELDS_NOTFOUND ) {
-			fprintf( outptr, " ID=\"");
-			output_refnum( outptr, f, n );
-			fprintf( outptr, "\"");
+			sink_puts( out, " ID=\"" );
+			output_refnum( out, f, n );
+			sink_putc( out, '\"' );
 		}
 	}
-	fprintf( outptr, ">\n" );
+	sink_puts( out, ">\n" );
 }
 
 static inline void
-output_tail( FILE *outptr )
+output_tail( sink *out )
 {
-	fprintf( outptr, "</mods>\n" );
+	sink_puts( out, "</mods>\n" );
 }
 
 static int
-modsout_write( fields *f, FILE *outptr, param *p, unsigned long refnum )
+modsout_write( fields *f, sink *out, param *p, unsigned long refnum )
 {
 	int max, dropkey;
 
 	max = fields_maxlevel( f );
 	dropkey = ( p->format_opts & BIBL_FORMAT_MODSOUT_DROPKEY );
 
-	output_head( outptr, f, dropkey );
-	output_citeparts( outptr, f, LEVEL_MAIN, max );
-	output_tail( outptr );
-	fflush( outptr );
+	output_head( out, f, dropkey );
+	output_citeparts( out, f, LEVEL_MAIN, max );
+	output_tail( out );
 
 	report_unused_tags( stderr, f, p, refnum );
 
@@ -1323,12 +1337,12 @@ modsout_write( fields *f, FILE *outptr, param *p, unsigned long refnum )
 *****************************************************/
 
 static void
-modsout_writeheader( FILE *outptr, param *p )
+modsout_writeheader( sink *out, param *p )
 {
-	if ( p->utf8bom ) utf8_writebom( outptr );
-	fprintf(outptr,"<?xml version=\"1.0\" encoding=\"%s\"?>\n",
+	if ( p->utf8bom ) utf8_writebom( out );
+	sink_printf( out, "<?xml version=\"1.0\" encoding=\"%s\"?>\n",
 			charset_get_xmlname( p->charsetout ) );
-	fprintf(outptr,"<modsCollection xmlns=\"http://www.loc.gov/mods/v3\">\n");
+	sink_puts( out, "<modsCollection xmlns=\"http://www.loc.gov/mods/v3\">\n" );
 }
 
 /*****************************************************
@@ -1336,8 +1350,7 @@ modsout_writeheader( FILE *outptr, param *p )
 *****************************************************/
 
 static void
-modsout_writefooter( FILE *outptr )
+modsout_writefooter( sink *out )
 {
-	fprintf(outptr,"</modsCollection>\n");
-	fflush( outptr );
+	sink_puts( out, "</modsCollection>\n" );
 }
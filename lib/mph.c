@@ -0,0 +1,70 @@
+/*
+ * mph.c - minimal perfect hash lookups for generated tables
+ *
+ * Copyright (c) Chris Putnam 2021
+ *
+ * Source code released under the GPL version 2
+ *
+ */
+#include <string.h>
+#include <strings.h>
+#include <ctype.h>
+#include "mph.h"
+
+/*
+ * Bob Jenkin's one-at-a-time hash started from seed
+ */
+unsigned int
+mph_hash( const char *key, unsigned long len, unsigned int seed, int nocase )
+{
+	unsigned int hash = seed;
+	unsigned long i;
+	for ( i=0; i<len; ++i ) {
+		if ( nocase ) hash += (unsigned char) tolower( (unsigned char) key[i] );
+		else hash += (unsigned char) key[i];
+		hash += ( hash << 10 );
+		hash ^= ( hash >> 6 );
+	}
+	hash += ( hash << 3 );
+	hash ^= ( hash >> 11 );
+	hash += ( hash << 15 );
+	return hash;
+}
+
+/* mph_slotn()
+ *
+ * Return the only slot key could occupy; always less than h->nkeys
+ * (for an empty index, 0).
+ */
+unsigned int
+mph_slotn( const mph *h, const char *key, unsigned long len )
+{
+	unsigned int bucket;
+	int d;
+
+	if ( h->nkeys==0 ) return 0;
+
+	bucket = mph_hash( key, len, 0, h->nocase ) % h->nbuckets;
+	d = h->disp[bucket];
+
+	if ( d < 0 ) return (unsigned int)( -d - 1 );
+	else return mph_hash( key, len, (unsigned int) d, h->nocase ) % h->nkeys;
+}
+
+unsigned int
+mph_slot( const mph *h, const char *key )
+{
+	return mph_slotn( h, key, strlen( key ) );
+}
+
+int
+mph_find( const mph *h, const unsigned short *pos, const char *key, const char *(*getkey)( int ) )
+{
+	int n;
+
+	if ( !key || h->nkeys==0 ) return -1;
+
+	n = pos[ mph_slot( h, key ) ];
+	if ( h->nocase ) return ( strcasecmp( getkey( n ), key ) ) ? -1 : n;
+	else return ( strcmp( getkey( n ), key ) ) ? -1 : n;
+}
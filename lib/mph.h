@@ -0,0 +1,44 @@
+/*
+ * mph.h - minimal perfect hash lookups for generated tables
+ *
+ * Copyright (c) Chris Putnam 2021
+ *
+ * Source code released under the GPL version 2
+ *
+ */
+#ifndef MPH_H
+#define MPH_H
+
+#define MPH_CASE   (0)
+#define MPH_NOCASE (1)
+
+/* Hash-and-displace index over a fixed set of nkeys strings.
+ *
+ * A key first hashes into one of nbuckets buckets. A bucket whose
+ * disp[] entry is negative holds a single key stored in slot
+ * -disp-1; otherwise disp is the seed that scatters the keys of the
+ * bucket into distinct slots. Every key of the set maps to its own
+ * slot in [0,nkeys), so the table the index describes needs no empty
+ * entries. Strings outside the set still map to some slot and the
+ * caller must compare against the key stored there.
+ *
+ * The disp[] arrays are written by the generators in bldhash/.
+ */
+typedef struct mph {
+	unsigned int nkeys;
+	unsigned int nbuckets;
+	const int    *disp;
+	int          nocase;
+} mph;
+
+unsigned int mph_hash( const char *key, unsigned long len, unsigned int seed, int nocase );
+unsigned int mph_slotn( const mph *h, const char *key, unsigned long len );
+unsigned int mph_slot( const mph *h, const char *key );
+
+/* For tables indexed by bldhash/mph_index, pos[slot] is the position in
+ * the caller's table of the key in that slot and getkey( n ) is the key
+ * of table entry n. Returns the matching position or -1.
+ */
+int mph_find( const mph *h, const unsigned short *pos, const char *key, const char *(*getkey)( int ) );
+
+#endif
@@ -9,6 +9,7 @@
  *
  */
 #include <stdio.h>
+#include <stdlib.h>
 #include <ctype.h>
 #include <string.h>
 #include "bibdefs.h"
@@ -18,7 +19,8 @@
 #include "str.h"
 #include "fields.h"
 #include "slist.h"
-#include "intlist.h"
+#include "strhash.h"
+#include "tokens.h"
 #include "name.h"
 
 /* name_build_withcomma()
@@ -104,45 +106,100 @@ name_findetal( slist *tokens )
 #define THIRD     (8)
 #define FOURTH    (16)
 
+/* Names are split into tokens that are spans of the name being parsed,
+ * so nothing is copied until the output name is built.
+ */
+static int
+token_equals( token *t, const char *s )
+{
+	unsigned long i;
+
+	for ( i=0; i<t->len; ++i )
+		if ( s[i]!=t->p[i] ) return 0;
+
+	return ( s[i]=='\0' );
+}
+
+static int
+token_endswith_comma( token *t )
+{
+	return ( t->len && t->p[ t->len - 1 ]==',' );
+}
+
+static void
+token_append( str *s, token *t )
+{
+	if ( t->len ) str_segcat( s, (char *) t->p, (char *) t->p + t->len );
+}
+
+static unsigned short
+token_classify( token *t )
+{
+	return unicode_utf8_classify_strn( t->p, t->len );
+}
+
+/* name_tokenize()
+ *
+ * Split the len characters at p on spaces, ending a token after each
+ * comma as though it were followed by a space.
+ */
+static int
+name_tokenize( tokens *t, const char *p, unsigned long len )
+{
+	const char *end = p + len, *q;
+
+	while ( p < end ) {
+		while ( p < end && *p==' ' ) p++;
+		if ( p==end ) break;
+		q = p;
+		while ( q < end && *q!=' ' && *q!=',' ) q++;
+		if ( q < end && *q==',' ) q++;
+		if ( tokens_add( t, p, q - p, 0 )!=TOKENS_OK ) return 0;
+		p = q;
+	}
+
+	return 1;
+}
+
 typedef struct {
-	char *s;
+	const char *s;
 	unsigned short value;
 } suffix_value_t;
 
+static const suffix_value_t suffixes[] = {
+	{ "Jr."   ,   JUNIOR              },
+	{ "Jr"    ,   JUNIOR              },
+	{ "Jr.,"  ,   JUNIOR | WITHCOMMA  },
+	{ "Jr,"   ,   JUNIOR | WITHCOMMA  },
+	{ "Sr."   ,   SENIOR              },
+	{ "Sr"    ,   SENIOR              },
+	{ "Sr.,"  ,   SENIOR | WITHCOMMA  },
+	{ "Sr,"   ,   SENIOR | WITHCOMMA  },
+	{ "III"   ,   THIRD               },
+	{ "III,"  ,   THIRD  | WITHCOMMA  },
+	{ "IV"    ,   FOURTH              },
+	{ "IV,"   ,   FOURTH | WITHCOMMA  },
+};
+static const int nsuffixes = sizeof( suffixes ) / sizeof( suffixes[0] );
+
 static int
-identify_suffix( char *p )
-{
-	suffix_value_t suffixes[] = {
-		{ "Jr."   ,   JUNIOR              },
-		{ "Jr"    ,   JUNIOR              },
-		{ "Jr.,"  ,   JUNIOR | WITHCOMMA  },
-		{ "Jr,"   ,   JUNIOR | WITHCOMMA  },
-		{ "Sr."   ,   SENIOR              },
-		{ "Sr"    ,   SENIOR              },
-		{ "Sr.,"  ,   SENIOR | WITHCOMMA  },
-		{ "Sr,"   ,   SENIOR | WITHCOMMA  },
-		{ "III"   ,   THIRD               },
-		{ "III,"  ,   THIRD  | WITHCOMMA  },
-		{ "IV"    ,   FOURTH              },
-		{ "IV,"   ,   FOURTH | WITHCOMMA  },
-	};
-	int i, nsuffixes = sizeof( suffixes ) / sizeof( suffixes[0] );
+identify_suffix( token *t )
+{
+	int i;
 	for ( i=0; i<nsuffixes; ++i ) {
-		if ( !strcmp( p, suffixes[i].s ) )
+		if ( token_equals( t, suffixes[i].s ) )
 			return suffixes[i].value;
 	}
 	return 0;
 }
 
 static int
-has_suffix( slist *tokens, int begin, int end, int *suffixpos )
+has_suffix( tokens *t, int begin, int end, int *suffixpos )
 {
 	int i, ret;
-	str *s;
 
 	/* ...check last element, e.g. "H. F. Author, Sr." */
-	s = slist_str( tokens, end - 1 );
-	ret = identify_suffix( s->data );
+	ret = identify_suffix( &(t->tok[end-1]) );
 	if ( ret ) {
 		*suffixpos = end - 1;
 		return ret;
@@ -150,10 +207,8 @@ has_suffix( slist *tokens, int begin, int end, int *suffixpos )
 
 	/* ...try to find one after a comma, e.g. "Author, Sr., H. F." */
 	for ( i=begin; i<end-1; ++i ) {
-		s = slist_str( tokens, i );
-		if ( s->len && s->data[ s->len - 1 ]==',' ) {
-			s = slist_str( tokens, i+1 );
-			ret = identify_suffix( s->data );
+		if ( token_endswith_comma( &(t->tok[i]) ) ) {
+			ret = identify_suffix( &(t->tok[i+1]) );
 			if ( ret ) {
 				*suffixpos = i+1;
 				return ret;
@@ -165,26 +220,26 @@ has_suffix( slist *tokens, int begin, int end, int *suffixpos )
 }
 
 static int
-add_given_split( str *name, str *s )
+add_given_split( str *name, token *t )
 {
 	unsigned int unicode_char;
 	unsigned int pos = 0;
 	char utf8s[7];
-	while ( pos < s->len ) {
-		unicode_char = utf8_decode( s->data, &pos );
+	while ( pos < t->len ) {
+		unicode_char = utf8_decode_n( t->p, t->len, &pos );
 		if ( is_ws( (char) unicode_char ) ) continue;
 		else if ( unicode_char==(unsigned int)'.' ) {
-			if ( s->data[pos]=='-' ) {
+			if ( pos < t->len && t->p[pos]=='-' ) {
 				str_strcatc( name, ".-" );
 				pos += 1;
-				unicode_char = utf8_decode( s->data, &pos );
+				unicode_char = utf8_decode_n( t->p, t->len, &pos );
 				utf8_encode_str( unicode_char, utf8s );
 				str_strcatc( name, utf8s );
 				str_addchar( name, '.' );
 			}
 		} else if ( unicode_char==(unsigned int)'-' ) {
 			str_strcatc( name, ".-" );
-			unicode_char = utf8_decode( s->data, &pos );
+			unicode_char = utf8_decode_n( t->p, t->len, &pos );
 			utf8_encode_str( unicode_char, utf8s );
 			str_strcatc( name, utf8s );
 			str_addchar( name, '.' );
@@ -199,25 +254,48 @@ add_given_split( str *name, str *s )
 }
 
 static unsigned char
-token_has_no_upper( slist *tokens, int n )
+token_has_no_upper( tokens *t, int n )
 {
 	unsigned short m;
-	str *s;
-	s = slist_str( tokens, n );
-	m = unicode_utf8_classify_str( s );
+	m = token_classify( &(t->tok[n]) );
 	if ( m & UNICODE_UPPER ) return 0;
 	else return 1;
 }
 
 static unsigned char
-token_has_upper( slist *tokens, int n )
+token_has_upper( tokens *t, int n )
 {
-	if ( token_has_no_upper( tokens, n ) ) return 0;
+	if ( token_has_no_upper( t, n ) ) return 0;
 	else return 1;
 }
 
+/* Tokens making up the family and given names.
+ *
+ * Family names are tokens [family_begin,family_end) other than
+ * family_skip; given names are tokens [given_begin,given_end) other
+ * than given_skip or those already in the family name.
+ */
+typedef struct {
+	int family_begin, family_end, family_skip;
+	int given_begin, given_end, given_skip;
+} name_parts;
+
+static int
+name_is_family( name_parts *np, int i )
+{
+	return ( i>=np->family_begin && i<np->family_end && i!=np->family_skip );
+}
+
 static int
-name_multielement_nocomma( intlist *given, intlist *family, slist *tokens, int begin, int end, int suffixpos )
+name_is_given( name_parts *np, int i )
+{
+	if ( i==np->given_skip ) return 0;
+	if ( i>=np->family_begin && i<np->family_end ) return 0;
+	return 1;
+}
+
+static void
+name_multielement_nocomma( name_parts *np, tokens *t, int begin, int end, int suffixpos )
 {
 	int family_start, family_end;
 	int i, n;
@@ -231,73 +309,58 @@ name_multielement_nocomma( intlist *given, intlist *family, slist *tokens, int b
 	 * ..."Ludwig 'von Beethoven'"
 	 * ..."Johannes Diderik 'van der Waals'"
 	 * ..."Charles Louis Xavier Joseph 'de la Valla Poussin' */
-	if ( token_has_upper( tokens, family_start ) ) {
+	if ( token_has_upper( t, family_start ) ) {
 		i = family_start - 1;
 		n = -1;
-		while ( i >= begin && ( n==-1 || token_has_no_upper( tokens, i ) ) ) {
-			if ( token_has_no_upper( tokens, i ) ) n = i;
+		while ( i >= begin && ( n==-1 || token_has_no_upper( t, i ) ) ) {
+			if ( token_has_no_upper( t, i ) ) n = i;
 			i--;
 		}
 		if ( n != -1 ) family_start = n;
 	}
-	for ( i=family_start; i<family_end+1; i++ )
-		intlist_add( family, i );
+	np->family_begin = family_start;
+	np->family_end   = family_end + 1;
+	np->family_skip  = -1;
 
 	/* ...given names */
-	for ( i=begin; i<end-1; i++ ) {
-		if ( i>=family_start && i<=family_end ) continue;
-		if ( i==suffixpos ) continue;
-		intlist_add( given, i );
-	}
-
-	return 1;
+	np->given_begin = begin;
+	np->given_end   = end - 1;
+	np->given_skip  = suffixpos;
 }
 
-static int
-name_multielement_comma( intlist *given, intlist *family, slist *tokens, int begin, int end, int comma, int suffixpos )
+static void
+name_multielement_comma( name_parts *np, tokens *t, int begin, int end, int comma, int suffixpos )
 {
-	str *s;
-	int i;
-
 	/* ...family names */
-	for ( i=begin; i<comma; ++i ) {
-		if ( i==suffixpos ) continue;
-		intlist_add( family, i );
-	}
-	s = slist_str( tokens, comma );
-	str_trimend( s, 1 ); /* remove comma */
-	intlist_add( family, comma );
+	t->tok[comma].len--; /* remove comma */
+	np->family_begin = begin;
+	np->family_end   = comma + 1;
+	np->family_skip  = suffixpos;
 
 	/* ...given names */
-	for ( i=comma+1; i<end; ++i ) {
-		if ( i==suffixpos ) continue;
-		intlist_add( given, i );
-	}
-
-	return 1;
+	np->given_begin = comma + 1;
+	np->given_end   = end;
+	np->given_skip  = suffixpos;
 }
 
 static int
-name_mutlielement_build( str *name, intlist *given, intlist *family, slist *tokens )
+name_mutlielement_build( str *name, name_parts *np, tokens *t )
 {
 	unsigned short case_given = 0, case_family = 0, should_split = 0;
-	str *s;
-	int i, m;
+	int i, nfamily = 0;
 
 	/* ...copy and analyze family name */
-	for ( i=0; i<family->n; ++i ) {
-		m = intlist_get( family, i );
-		s = slist_str( tokens, m );
-		if ( i ) str_addchar( name, ' '  );
-		str_strcat( name, s );
-		case_family |= unicode_utf8_classify_str( s );
+	for ( i=np->family_begin; i<np->family_end; ++i ) {
+		if ( !name_is_family( np, i ) ) continue;
+		if ( nfamily++ ) str_addchar( name, ' '  );
+		token_append( name, &(t->tok[i]) );
+		case_family |= token_classify( &(t->tok[i]) );
 	}
 
 	/* ...check given name case */
-	for ( i=0; i<given->n; ++i ) {
-		m = intlist_get( given, i );
-		s = slist_str( tokens, m );
-		case_given |= unicode_utf8_classify_str( s );
+	for ( i=np->given_begin; i<np->given_end; ++i ) {
+		if ( !name_is_given( np, i ) ) continue;
+		case_given |= token_classify( &(t->tok[i]) );
 	}
 
 	if ( ( ( case_family & UNICODE_MIXEDCASE ) == UNICODE_MIXEDCASE ) &&
@@ -305,49 +368,43 @@ name_mutlielement_build( str *name, intlist *given, intlist *family, slist *toke
 		should_split = 1;
 	}
 
-	for ( i=0; i<given->n; ++i ) {
-		m = intlist_get( given, i );
-		s = slist_str( tokens, m );
+	for ( i=np->given_begin; i<np->given_end; ++i ) {
+		if ( !name_is_given( np, i ) ) continue;
 		if ( !should_split ) {
 			str_addchar( name, '|' );
-			str_strcat( name, s );
-		} else add_given_split( name, s );
+			token_append( name, &(t->tok[i]) );
+		} else add_given_split( name, &(t->tok[i]) );
 	}
 
 	return 1;
 }
 
 static int
-name_construct_multi( str *outname, slist *tokens, int begin, int end )
+name_construct_multi( str *outname, tokens *t, int begin, int end )
 {
 	int i, suffix, suffixpos=-1, comma=-1;
-	intlist given, family;
-	str *s;
-
-	intlist_init( &family );
-	intlist_init( &given );
+	name_parts np;
 
 	str_empty( outname );
 
-	suffix = has_suffix( tokens, begin, end, &suffixpos );
+	suffix = has_suffix( t, begin, end, &suffixpos );
 
 	for ( i=begin; i<end && comma==-1; i++ ) {
 		if ( i==suffixpos ) continue;
-		s = slist_str( tokens, i );
-		if ( s->data[ s->len - 1 ] == ',' ) {
+		if ( token_endswith_comma( &(t->tok[i]) ) ) {
 			if ( suffix && i==suffixpos-1 && !(suffix&WITHCOMMA) )
-				str_trimend( s, 1 );
+				t->tok[i].len--;
 			else
 				comma = i;
 		}
 	}
 
 	if ( comma != -1 )
-		name_multielement_comma( &given, &family, tokens, begin, end, comma, suffixpos );
+		name_multielement_comma( &np, t, begin, end, comma, suffixpos );
 	else
-		name_multielement_nocomma( &given, &family, tokens, begin, end, suffixpos );
+		name_multielement_nocomma( &np, t, begin, end, suffixpos );
 
-	name_mutlielement_build( outname, &given, &family, tokens );
+	name_mutlielement_build( outname, &np, t );
 
 	if ( suffix ) {
 		if ( suffix & JUNIOR ) str_strcatc( outname, "||Jr." );
@@ -356,9 +413,6 @@ name_construct_multi( str *outname, slist *tokens, int begin, int end )
 		if ( suffix & FOURTH ) str_strcatc( outname, "||IV"  );
 	}
 
-	intlist_free( &given );
-	intlist_free( &family );
-
 	return 1;
 }
 
@@ -367,19 +421,31 @@ name_construct_multi( str *outname, slist *tokens, int begin, int end )
  * Treat names as multiple tokens to be manipulated before adding
  */
 int
-add_name_multielement( fields *info, const char *tag, slist *tokens, int begin, int end, int level )
+add_name_multielement( fields *info, const char *tag, slist *tokens_in, int begin, int end, int level )
 {
-	int fstatus, status;
-	str name;
+	int i, fstatus, status;
+	tokens t;
+	str name, *s;
 
 	str_init( &name );
+	tokens_init( &t );
+
+	for ( i=begin; i<end; ++i ) {
+		s = slist_str( tokens_in, i );
+		if ( tokens_add( &t, str_cstr( s ), s->len, 0 )!=TOKENS_OK ) {
+			status = BIBL_ERR_MEMERR;
+			goto out;
+		}
+	}
 
-	name_construct_multi( &name, tokens, begin, end );
+	name_construct_multi( &name, &t, 0, t.n );
 
 	fstatus = fields_add_can_dup( info, tag, str_cstr( &name ), level );
 	if ( fstatus!=FIELDS_OK ) status = BIBL_ERR_MEMERR;
 	else status = BIBL_OK;
 
+out:
+	tokens_free( &t );
 	str_free( &name );
 
 	return status;
@@ -416,6 +482,58 @@ out:
 	return status;
 }
 
+/* name_copy_spaced()
+ *
+ * Copy a single-token name as it reads once every comma is followed
+ * by a space.
+ */
+static void
+name_copy_spaced( str *outname, const char *p, unsigned long len )
+{
+	unsigned long i;
+
+	for ( i=0; i<len; ++i ) {
+		str_addchar( outname, p[i] );
+		if ( p[i]==',' ) str_addchar( outname, ' ' );
+	}
+}
+
+/* name_parsen()
+ *
+ * Parse the len characters at p; see name_parse().
+ */
+static int
+name_parsen( str *outname, const char *p, unsigned long len, namelist *asis, namelist *corps )
+{
+	int ret = 1;
+	tokens t;
+
+	str_empty( outname );
+	if ( !len ) return ret;
+
+	if ( asis && namelist_findn( asis, p, len ) !=-1 ) {
+		str_segcpy( outname, (char *) p, (char *) p + len );
+		return 2;
+	} else if ( corps && namelist_findn( corps, p, len ) != -1 ) {
+		str_segcpy( outname, (char *) p, (char *) p + len );
+		return 3;
+	}
+
+	tokens_init( &t );
+
+	if ( !name_tokenize( &t, p, len ) || t.n<2 ) {
+		name_copy_spaced( outname, p, len );
+		ret = 2;
+	} else {
+		name_construct_multi( outname, &t, 0, t.n );
+		ret = 1;
+	}
+
+	tokens_free( &t );
+
+	return ret;
+}
+
 /*
  * Takes a single name in a string and parses it.
  * Skipped by bibtex/biblatex that come pre-parsed.
@@ -426,68 +544,192 @@ out:
  * Returns 3 on ok and name in corps list
  */
 int
-name_parse( str *outname, str *inname, slist *asis, slist *corps )
+name_parse( str *outname, str *inname, namelist *asis, namelist *corps )
 {
-	int status, ret = 1;
-	slist tokens;
+	if ( !inname || !inname->len ) {
+		str_empty( outname );
+		return 1;
+	}
+	return name_parsen( outname, str_cstr( inname ), inname->len, asis, corps );
+}
 
-	str_empty( outname );
-	if ( !inname || !inname->len ) return ret;
+/*
+ * Cache of name_parse() results for add_name()
+ *
+ * The same author strings recur throughout a bibliography, so keep the
+ * most recently parsed names in a bounded LRU list indexed by the raw
+ * name. Results depend on the asis/corps lists as well, so a cache is
+ * only used for one read, whose lists don't change; bibl_read() gives
+ * each read its own.
+ */
+static int namecache_size = NAME_CACHE_DEFAULT;
 
-	slist_init( &tokens );
+/* name_cache_setsize()
+ *
+ * Limit caches made from now on to maxnames entries; zero disables
+ * them. Set before any reading starts.
+ */
+void
+name_cache_setsize( int maxnames )
+{
+	namecache_size = ( maxnames > 0 ) ? maxnames : 0;
+}
 
-	if ( asis && slist_find( asis, inname ) !=-1 ) {
-		str_strcpy( outname, inname );
-		ret = 2;
-		goto out;
-	} else if ( corps && slist_find( corps, inname ) != -1 ) {
-		str_strcpy( outname, inname );
-		ret = 3;
-		goto out;
+/* name_cache_new()
+ *
+ * Returns NULL on memory error or if caching is disabled, which
+ * add_name() takes as no cache.
+ */
+name_cache *
+name_cache_new( void )
+{
+	name_cache *c;
+
+	if ( namecache_size==0 ) return NULL;
+
+	c = ( name_cache * ) malloc( sizeof( name_cache ) );
+	if ( !c ) return NULL;
+
+	c->entries = NULL;
+	c->n       = 0;
+	c->max     = namecache_size;
+	c->head    = c->tail = -1;
+	strhash_init( &(c->index), STRHASH_CASE );
+
+	return c;
+}
+
+void
+name_cache_delete( name_cache *c )
+{
+	int i;
+
+	if ( !c ) return;
+
+	for ( i=0; i<c->n; ++i )
+		strs_free( &(c->entries[i].raw), &(c->entries[i].parsed), NULL );
+	if ( c->entries ) free( c->entries );
+	strhash_free( &(c->index) );
+	free( c );
+}
+
+static void
+namecache_unlink( name_cache *c, int i )
+{
+	name_cache_entry *e = &(c->entries[i]);
+
+	if ( e->prev!=-1 ) c->entries[e->prev].next = e->next;
+	else c->head = e->next;
+	if ( e->next!=-1 ) c->entries[e->next].prev = e->prev;
+	else c->tail = e->prev;
+}
+
+static void
+namecache_pushfront( name_cache *c, int i )
+{
+	name_cache_entry *e = &(c->entries[i]);
+
+	e->prev = -1;
+	e->next = c->head;
+	if ( c->head!=-1 ) c->entries[c->head].prev = i;
+	c->head = i;
+	if ( c->tail==-1 ) c->tail = i;
+}
+
+/* namecache_find()
+ *
+ * Return the cached name type and fill outname, or 0 if not cached.
+ */
+static int
+namecache_find( name_cache *c, str *outname, const char *p, unsigned long len )
+{
+	int i;
+
+	if ( !c || len==0 ) return 0;
+
+	i = strhash_findn( &(c->index), p, len );
+	if ( i==-1 ) return 0;
+
+	str_strcpy( outname, &(c->entries[i].parsed) );
+	if ( str_memerr( outname ) ) return 0;
+
+	if ( c->head!=i ) {
+		namecache_unlink( c, i );
+		namecache_pushfront( c, i );
 	}
 
-	str_findreplace( inname, ",", ", " );
-	status = slist_tokenize( &tokens, inname, " ", 1 );
-	if ( status!=SLIST_OK ) {
-		str_strcpy( outname, inname );
-		ret = 2;
-		goto out;
+	return c->entries[i].type;
+}
+
+/* namecache_add()
+ *
+ * Remember a parsed name, reusing the least recently used entry when
+ * full. Failures only mean the name is not cached.
+ */
+static void
+namecache_add( name_cache *c, const char *p, unsigned long len, str *outname, int type )
+{
+	name_cache_entry *e;
+	int i;
+
+	if ( !c ) return;
+
+	if ( !c->entries ) {
+		c->entries = ( name_cache_entry * ) malloc( sizeof( name_cache_entry ) * c->max );
+		if ( !c->entries ) return;
 	}
 
-	if ( tokens.n==1 ) {
-		str_strcpy( outname, inname );
-		ret = 2;
+	if ( c->n < c->max ) {
+		i = c->n++;
+		strs_init( &(c->entries[i].raw), &(c->entries[i].parsed), NULL );
 	} else {
-		name_construct_multi( outname, &tokens, 0, tokens.n );
-		ret = 1;
+		i = c->tail;
+		namecache_unlink( c, i );
+		strhash_removen( &(c->index), c->entries[i].raw.data, c->entries[i].raw.len );
 	}
 
-out:
-
-	slist_free( &tokens );
-
-	return ret;
+	e = &(c->entries[i]);
+	str_segcpy( &(e->raw), (char *) p, (char *) p + len );
+	str_strcpy( &(e->parsed), outname );
+	e->type = type;
+	namecache_pushfront( c, i );
+
+	if ( str_memerr( &(e->raw) ) || str_memerr( &(e->parsed) ) ||
+	     strhash_setn( &(c->index), str_cstr( &(e->raw) ), e->raw.len, i )!=STRHASH_OK ) {
+		/* leave the entry unreachable; it is reused first */
+		namecache_unlink( c, i );
+		e->prev = c->tail;
+		e->next = -1;
+		if ( c->tail!=-1 ) c->entries[c->tail].next = i;
+		else c->head = i;
+		c->tail = i;
+		str_empty( &(e->raw) );
+	}
 }
 
+/* name_span()
+ *
+ * Find the next name in a '|' separated list without its surrounding
+ * whitespace and trailing commas, returning the start of the one after.
+ */
 static const char *
-name_copy( str *name, const char *p )
+name_span( const char *p, const char **start, unsigned long *len )
 {
-	const char *start, *end, *q;
+	const char *end;
 
-	str_empty( name );
+	*start = p = skip_ws( p );
 
-	start = p = skip_ws( p );
-
-	/* strip tailing whitespace and commas */
 	while ( *p && *p!='|' ) p++;
 
 	end = p;
-	while ( is_ws( *end ) || *end==',' || *end=='|' || *end=='\0' )
+	while ( end > *start && ( is_ws( *end ) || *end==',' || *end=='|' || *end=='\0' ) )
 		end--;
-	if ( *p=='|' ) p++;
+	if ( is_ws( *end ) || *end==',' || *end=='|' || *end=='\0' )
+		*len = 0;
+	else
+		*len = end - *start + 1;
 
-	for ( q=start; q<=end; q++ )
-		str_addchar( name, *q );
+	if ( *p=='|' ) p++;
 
 	return p;
 }
@@ -506,25 +748,31 @@ name_copy( str *name, const char *p )
  * for each personal name, send to appropriate algorithm depending
  * on if the author name is in the format "H. F. Author" or
  * "Author, H. F."
+ *
+ * cache, if not NULL, remembers parsed names for the rest of the read
  */
 int
-add_name( fields *info, const char *tag, const char *q, int level, slist *asis, slist *corps )
+add_name( fields *info, const char *tag, const char *q, int level, namelist *asis, namelist *corps, name_cache *cache )
 {
 	int status, nametype, ret = BIBL_OK;
-	str inname, outname;
-	slist tokens;
+	const char *name;
+	unsigned long len;
+	str outname;
 
 	if ( !q ) return BIBL_OK;
 
-	slist_init( &tokens );
-	strs_init( &inname, &outname, NULL );
+	str_init( &outname );
 
 	while ( *q ) {
 
-		q = name_copy( &inname, q );
+		q = name_span( q, &name, &len );
 
-		nametype = name_parse( &outname, &inname, asis, corps );
-		if ( !nametype ) { ret = BIBL_ERR_MEMERR; goto out; }
+		nametype = namecache_find( cache, &outname, name, len );
+		if ( !nametype ) {
+			nametype = name_parsen( &outname, name, len, asis, corps );
+			if ( !nametype ) { ret = BIBL_ERR_MEMERR; goto out; }
+			if ( len ) namecache_add( cache, name, len, &outname, nametype );
+		}
 
 		if ( nametype==1 ) {
 			status = fields_add_can_dup( info, tag, outname.data, level );
@@ -540,8 +788,7 @@ add_name( fields *info, const char *tag, const char *q, int level, slist *asis,
 	}
 
 out:
-	strs_free( &inname, &outname, NULL );
-	slist_free( &tokens );
+	str_free( &outname );
 
 	return ret;
 }
@@ -15,16 +15,39 @@
 #define NAME_ASIS   (1)
 #define NAME_CORP   (2)
 
+#define NAME_CACHE_DEFAULT (4096)
+
 #include "str.h"
 #include "slist.h"
+#include "namelist.h"
 #include "fields.h"
+#include "strhash.h"
+
+/* Recently parsed names, for add_name(); see name.c */
+typedef struct name_cache_entry {
+	str raw;
+	str parsed;
+	int type;
+	int prev, next;
+} name_cache_entry;
 
-int  add_name( fields *info, const char *tag, const char *q, int level, slist *asis, slist *corps );
+typedef struct name_cache {
+	name_cache_entry *entries;
+	int n, max;
+	int head, tail;
+	strhash index;
+} name_cache;
+
+int  add_name( fields *info, const char *tag, const char *q, int level, namelist *asis, namelist *corps, name_cache *cache );
 void name_build_withcomma( str *s, const char *p );
-int  name_parse( str *outname, str *inname, slist *asis, slist *corps );
+int  name_parse( str *outname, str *inname, namelist *asis, namelist *corps );
 int  add_name_singleelement( fields *info, const char *tag, const char *name, int level, int asiscorp );
 int  add_name_multielement( fields *info, const char *tag, slist *tokens, int begin, int end, int level );
 int  name_findetal( slist *tokens );
 
+void name_cache_setsize( int maxnames );
+name_cache *name_cache_new( void );
+void name_cache_delete( name_cache *c );
+
 #endif
 
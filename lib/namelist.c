@@ -0,0 +1,113 @@
+/*
+ * namelist.c
+ *
+ * Hash-indexed lists of names that shouldn't be mangled (asis/corps)
+ *
+ * Copyright (c) Chris Putnam 2021
+ *
+ * Source code released under the GPL version 2
+ *
+ */
+#include "namelist.h"
+
+void
+namelist_init( namelist *nl )
+{
+	slist_init( &(nl->names) );
+	strhash_init( &(nl->index), STRHASH_CASE );
+}
+
+void
+namelist_free( namelist *nl )
+{
+	slist_free( &(nl->names) );
+	strhash_free( &(nl->index) );
+}
+
+/* namelist_index()
+ *
+ * Index names[n]. The keys are the data of the strs in names, which
+ * stay put when the slist grows.
+ */
+static int
+namelist_index( namelist *nl, int n )
+{
+	str *s = slist_str( &(nl->names), n );
+
+	if ( s->len==0 ) return NAMELIST_OK;
+	if ( strhash_add_unique( &(nl->index), str_cstr( s ), n )!=STRHASH_OK )
+		return NAMELIST_MEMERR;
+
+	return NAMELIST_OK;
+}
+
+static int
+namelist_reindex( namelist *nl )
+{
+	int i;
+
+	strhash_empty( &(nl->index) );
+	for ( i=0; i<nl->names.n; ++i )
+		if ( namelist_index( nl, i )!=NAMELIST_OK ) return NAMELIST_MEMERR;
+
+	return NAMELIST_OK;
+}
+
+/* namelist_fill()
+ *
+ * Replace the list with the non-blank lines of filename.
+ */
+int
+namelist_fill( namelist *nl, const char *filename )
+{
+	int status;
+
+	status = slist_fill( &(nl->names), filename, 1 );
+	if ( status==SLIST_ERR_CANTOPEN ) return NAMELIST_CANTOPEN;
+
+	/* keep the index in step with whatever was read */
+	if ( namelist_reindex( nl )!=NAMELIST_OK ) return NAMELIST_MEMERR;
+	if ( status!=SLIST_OK ) return NAMELIST_MEMERR;
+
+	return NAMELIST_OK;
+}
+
+int
+namelist_add( namelist *nl, const char *name )
+{
+	if ( slist_addc( &(nl->names), name )!=SLIST_OK ) return NAMELIST_MEMERR;
+
+	if ( namelist_index( nl, nl->names.n - 1 )!=NAMELIST_OK ) {
+		nl->names.n--;
+		return NAMELIST_MEMERR;
+	}
+
+	return NAMELIST_OK;
+}
+
+int
+namelist_copy( namelist *to, namelist *from )
+{
+	if ( slist_copy( &(to->names), &(from->names) )!=SLIST_OK ) return NAMELIST_MEMERR;
+	return namelist_reindex( to );
+}
+
+int
+namelist_findc( namelist *nl, const char *name )
+{
+	if ( !name || name[0]=='\0' ) return -1;
+	return strhash_find( &(nl->index), name );
+}
+
+int
+namelist_findn( namelist *nl, const char *name, unsigned long len )
+{
+	if ( len==0 ) return -1;
+	return strhash_findn( &(nl->index), name, len );
+}
+
+int
+namelist_find( namelist *nl, str *name )
+{
+	return namelist_findn( nl, str_cstr( name ), name->len );
+}
@@ -0,0 +1,40 @@
+/*
+ * namelist.h
+ *
+ * Hash-indexed lists of names that shouldn't be mangled (asis/corps)
+ *
+ * Copyright (c) Chris Putnam 2021
+ *
+ * Source code released under the GPL version 2
+ *
+ */
+#ifndef NAMELIST_H
+#define NAMELIST_H
+
+#include "str.h"
+#include "slist.h"
+#include "strhash.h"
+
+#define NAMELIST_OK         (0)
+#define NAMELIST_MEMERR    (-1)
+#define NAMELIST_CANTOPEN  (-2)
+
+/* Names are matched exactly (case-sensitive); an empty name never
+ * matches. Lookups return the position of the first matching entry
+ * in names, or -1.
+ */
+typedef struct namelist {
+	slist   names;
+	strhash index;    /* names -> position of first occurrence */
+} namelist;
+
+void namelist_init( namelist *nl );
+void namelist_free( namelist *nl );
+int  namelist_fill( namelist *nl, const char *filename );
+int  namelist_add( namelist *nl, const char *name );
+int  namelist_copy( namelist *to, namelist *from );
+int  namelist_find( namelist *nl, str *name );
+int  namelist_findc( namelist *nl, const char *name );
+int  namelist_findn( namelist *nl, const char *name, unsigned long len );
+
+#endif
@@ -30,7 +30,7 @@ extern int nbib_nall;
  PUBLIC: void nbib_initparams()
 *****************************************************/
 
-static int nbib_readf( FILE *fp, char *buf, int bufsize, int *bufpos, str *line, str *reference, int *fcharset );
+static int nbib_readf( source *src, char *buf, int bufsize, int *bufpos, str *line, str *reference, int *fcharset );
 static int nbib_processf( fields *nbib, const char *p, const char *filename, long nref, param *pm );
 static int nbib_typef( fields *nbib, const char *filename, int nref, param *p );
 static int nbib_convertf( fields *nbib, fields *info, int reftype, param *p );
@@ -57,8 +57,10 @@ nbibin_initparams( param *pm, const char *progname )
 	pm->all      = nbib_all;
 	pm->nall     = nbib_nall;
 
-	slist_init( &(pm->asis) );
-	slist_init( &(pm->corps) );
+	namelist_init( &(pm->asis) );
+	namelist_init( &(pm->corps) );
+	pm->names = NULL;
+	pm->strings = NULL;
 
 	if ( !progname ) pm->progname = NULL;
 	else {
@@ -109,10 +111,10 @@ nbib_istag( const char *buf )
 }
 
 static int
-readmore( FILE *fp, char *buf, int bufsize, int *bufpos, str *line )
+readmore( source *src, char *buf, int bufsize, int *bufpos, str *line )
 {
 	if ( line->len ) return 1;
-	else return str_fget( fp, buf, bufsize, bufpos, line );
+	else return source_fget( src, buf, bufsize, bufpos, line );
 }
 
 static int
@@ -132,14 +134,14 @@ skip_utf8_bom( str *line, int *fcharset )
 }
 
 static int
-nbib_readf( FILE *fp, char *buf, int bufsize, int *bufpos, str *line, str *reference, int *fcharset )
+nbib_readf( source *src, char *buf, int bufsize, int *bufpos, str *line, str *reference, int *fcharset )
 {
 	int n, haveref = 0, inref = 0, readtoofar = 0;
 	char *p;
 
 	*fcharset = CHARSET_UNKNOWN;
 
-	while ( !haveref && readmore( fp, buf, bufsize, bufpos, line ) ) {
+	while ( !haveref && readmore( src, buf, bufsize, bufpos, line ) ) {
 
 		/* ...references are terminated by an empty line */
 		if ( str_is_empty( line ) ) {
@@ -25,7 +25,7 @@
  PUBLIC: int nbibout_initparams()
 *****************************************************/
 
-static int  nbibout_write( fields *info, FILE *fp, param *p, unsigned long refnum );
+static int  nbibout_write( fields *info, sink *s, param *p, unsigned long refnum );
 
 int
 nbibout_initparams( param *pm, const char *progname )
@@ -42,14 +42,16 @@ nbibout_initparams( param *pm, const char *progname )
 	pm->verbose          = 0;
 	pm->addcount         = 0;
 	pm->singlerefperfile = 0;
+	pm->nthreads         = 0;
 
 	if ( pm->charsetout == BIBL_CHARSET_UNICODE ) {
 		pm->utf8out = pm->utf8bom = 1;
 	}
 
-	pm->headerf = generic_writeheader;
-	pm->footerf = NULL;
-	pm->writef  = nbibout_write;
+	pm->headerf   = generic_writeheader;
+	pm->footerf   = NULL;
+	pm->assemblef = NULL;
+	pm->writef    = nbibout_write;
 
 	if ( !pm->progname ) {
 		if ( !progname ) pm->progname = NULL;
@@ -410,29 +412,28 @@ output_verbose( fields *f, const char *type, unsigned long refnum )
 }
 
 static void
-output_tag( FILE *fp, char *p )
+output_tag( sink *s, char *p )
 {
 	int i = 0;
 
 	while ( i < 4 && p && *p ) {
-		fprintf( fp, "%c", *p );
+		sink_putc( s, *p );
 		i++;
 		p++;
 	}
 
-	for ( ; i<4; ++i )
-		fprintf( fp, " " );
-	fprintf( fp, "- " );
+	sink_spaces( s, 4 - i );
+	sink_write( s, "- ", 2 );
 }
 
 static void
-output_value( FILE *fp, str *value )
+output_value( sink *s, str *value )
 {
 	char *p, *q, *lastws;
 	int n;
 
 	if ( value->len < 82 ) {
-		fprintf( fp, "%s", str_cstr( value ) );
+		sink_str( s, value );
 		return;
 	}
 
@@ -447,44 +448,36 @@ output_value( FILE *fp, str *value )
 			n++;
 		}
 		if ( *q && lastws ) {
-			while ( p!=lastws ) {
-				fprintf( fp, "%c", *p );
-				p++;
-			}
-			p++; /* skip ws separator */
+			sink_write( s, p, lastws - p );
+			p = lastws + 1; /* skip ws separator */
 		}
 		else {
-			while ( p!=q ) {
-				fprintf( fp, "%c", *p );
-				p++;
-			}
+			sink_write( s, p, q - p );
 			p = q;
 		}
 		if ( *p ) {
-			fprintf( fp, "\n" );
-			fprintf( fp, "      " );
+			sink_write( s, "\n      ", 7 );
 		}
 	}
 }
 
 static void
-output_reference( FILE *fp, fields *out )
+output_reference( sink *s, fields *out )
 {
 	int i;
 
 	for ( i=0; i<out->n; ++i ) {
 
-		output_tag( fp, ( char * ) fields_tag( out, i, FIELDS_CHRP ) );
-		output_value( fp, ( str * ) fields_value( out, i, FIELDS_STRP ) );
-		fprintf( fp, "\n" );
+		output_tag( s, ( char * ) fields_tag( out, i, FIELDS_CHRP ) );
+		output_value( s, ( str * ) fields_value( out, i, FIELDS_STRP ) );
+		sink_putc( s, '\n' );
 	}
 
-        fprintf( fp, "\n\n" );
-        fflush( fp );
+	sink_write( s, "\n\n", 2 );
 }
 
 static int
-nbibout_write( fields *in, FILE *fp, param *p, unsigned long refnum )
+nbibout_write( fields *in, sink *s, param *p, unsigned long refnum )
 {
 	int status;
 	fields out;
@@ -496,7 +489,7 @@ nbibout_write( fields *in, FILE *fp, param *p, unsigned long refnum )
 
 	status = append_data( in, &out );
 
-	if ( status==BIBL_OK ) output_reference( fp, &out );
+	if ( status==BIBL_OK ) output_reference( s, &out );
 
 	if ( p->format_opts & BIBL_FORMAT_VERBOSE )
 		output_verbose( &out, "OUT", refnum );
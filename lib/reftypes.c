@@ -7,23 +7,163 @@
  *
  */
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#ifndef BIBL_NO_THREADS
+#include <pthread.h>
+#endif
 #include "is_ws.h"
 #include "fields.h"
+#include "strhash.h"
 #include "reftypes.h"
 
+/*
+ * Case-insensitive indices over a variants table, kept in all[0].index
+ * for the life of the program (the tables themselves are static).
+ * Lookups fall back to the linear scans if an index cannot be built.
+ *
+ * bibl_initparams() builds the index for its tables up front, before
+ * any thread converts with them, so lookups read all[0].index without
+ * a lock; index_lock is only taken to build an index.
+ */
+typedef struct reftypes_index {
+	variants     *all;
+	int          nall;
+	unsigned int typelens;  /* bit n set if some type name has length n */
+	strhash      types;     /* type name -> first reftype */
+	strhash      *tags;     /* per reftype: oldstr -> first tag */
+} reftypes_index;
+
+#ifndef BIBL_NO_THREADS
+static pthread_mutex_t index_lock = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+static int
+reftypes_index_fill( reftypes_index *ri, variants *all, int nall )
+{
+	unsigned long len;
+	int i, j;
+
+	ri->all      = all;
+	ri->nall     = nall;
+	ri->typelens = 0;
+	strhash_init( &(ri->types), STRHASH_NOCASE );
+
+	ri->tags = ( strhash * ) malloc( sizeof( strhash ) * ( nall>0 ? nall : 1 ) );
+	if ( !ri->tags ) return 0;
+	for ( i=0; i<nall; ++i )
+		strhash_init( &(ri->tags[i]), STRHASH_NOCASE );
+
+	for ( i=0; i<nall; ++i ) {
+		len = strlen( all[i].type );
+		if ( len >= sizeof( all[i].type ) ) goto err;
+		ri->typelens |= ( 1U << len );
+		if ( strhash_add_unique( &(ri->types), all[i].type, i )!=STRHASH_OK ) goto err;
+		for ( j=0; j<all[i].ntags; ++j ) {
+			if ( strhash_add_unique( &(ri->tags[i]), all[i].tags[j].oldstr, j )!=STRHASH_OK ) goto err;
+		}
+	}
+
+	return 1;
+err:
+	for ( i=0; i<nall; ++i )
+		strhash_free( &(ri->tags[i]) );
+	free( ri->tags );
+	strhash_free( &(ri->types) );
+	return 0;
+}
+
+/* reftypes_index_get()
+ *
+ * The index for a variants table, built if need be; NULL on memory
+ * error, or if the table is used with a different nall.
+ */
+static reftypes_index *
+reftypes_index_get( variants *all, int nall )
+{
+	reftypes_index *ri;
+
+	if ( nall<1 ) return NULL;
+
+	ri = all[0].index;
+	if ( ri ) return ( ri->nall==nall ) ? ri : NULL;
+
+#ifndef BIBL_NO_THREADS
+	pthread_mutex_lock( &index_lock );
+#endif
+
+	ri = all[0].index;
+	if ( ri ) goto out;
+
+	ri = ( reftypes_index * ) malloc( sizeof( reftypes_index ) );
+	if ( !ri ) goto out;
+	if ( !reftypes_index_fill( ri, all, nall ) ) {
+		free( ri );
+		ri = NULL;
+		goto out;
+	}
+	all[0].index = ri;
+
+out:
+#ifndef BIBL_NO_THREADS
+	pthread_mutex_unlock( &index_lock );
+#endif
+	return ( ri && ri->nall==nall ) ? ri : NULL;
+}
+
+/* reftypes_index_build()
+ *
+ * Build the index for a variants table ahead of its first use, e.g. before
+ * any threads start converting; returns 1 on success, 0 on memory error.
+ */
+int
+reftypes_index_build( variants *all, int nall )
+{
+	if ( !all || nall<1 ) return 1;
+	return ( reftypes_index_get( all, nall )!=NULL );
+}
+
+/* get_reftype_index()
+ *
+ * A type matches if it is a case-insensitive prefix of p, and the first
+ * such type in the table wins; so look up every prefix of p whose length
+ * some type name has, and keep the lowest reftype.
+ */
+static int
+get_reftype_index( reftypes_index *ri, const char *p )
+{
+	unsigned long len;
+	int n, found = -1;
+
+	for ( len=0; len<32 && ( ri->typelens >> len ); ++len ) {
+		if ( len && p[len-1]=='\0' ) break;
+		if ( !( ri->typelens & ( 1U << len ) ) ) continue;
+		n = strhash_findn( &(ri->types), p, len );
+		if ( n!=-1 && ( found==-1 || n < found ) ) found = n;
+	}
+
+	return found;
+}
+
 int
 get_reftype( const char *p, long refnum, char *progname, variants *all, int nall, char *tag, int *is_default, int chattiness )
 {
+	reftypes_index *ri;
 	int i;
 
 	p = skip_ws( p );
 
 	*is_default = 0;
 
-	for ( i=0; i<nall; ++i ) {
-		if ( !strncasecmp( all[i].type, p, strlen(all[i].type) ) ) 
-			return i;
+	ri = reftypes_index_get( all, nall );
+	if ( ri ) {
+		i = get_reftype_index( ri, p );
+		if ( i!=-1 ) return i;
+	} else {
+		for ( i=0; i<nall; ++i ) {
+			if ( !strncasecmp( all[i].type, p, strlen(all[i].type) ) ) 
+				return i;
+		}
 	}
 
 	*is_default = 1;
@@ -40,9 +180,13 @@ get_reftype( const char *p, long refnum, char *progname, variants *all, int nall
 int
 process_findoldtag( const char *oldtag, int reftype, variants all[], int nall )
 {
+        reftypes_index *ri;
         variants *v;
         int i;
 
+        ri = reftypes_index_get( all, nall );
+        if ( ri ) return strhash_find( &(ri->tags[reftype]), oldtag );
+
         v = &(all[reftype]);
         for ( i=0; i<v->ntags; ++i ) {
                 if ( !strcasecmp( (v->tags[i]).oldstr, oldtag ) )
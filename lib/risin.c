@@ -29,7 +29,7 @@ extern int ris_nall;
  PUBLIC: void risin_initparams()
 *****************************************************/
 
-static int risin_readf( FILE *fp, char *buf, int bufsize, int *bufpos, str *line, str *reference, int *fcharset );
+static int risin_readf( source *src, char *buf, int bufsize, int *bufpos, str *line, str *reference, int *fcharset );
 static int risin_processf( fields *risin, const char *p, const char *filename, long nref, param *pm );
 static int risin_typef( fields *risin, const char *filename, int nref, param *p );
 static int risin_convertf( fields *risin, fields *info, int reftype, param *p );
@@ -56,8 +56,10 @@ risin_initparams( param *pm, const char *progname )
 	pm->all      = ris_all;
 	pm->nall     = ris_nall;
 
-	slist_init( &(pm->asis) );
-	slist_init( &(pm->corps) );
+	namelist_init( &(pm->asis) );
+	namelist_init( &(pm->corps) );
+	pm->names = NULL;
+	pm->strings = NULL;
 
 	if ( !progname ) pm->progname = NULL;
 	else {
@@ -130,21 +132,21 @@ is_ris_end_tag( char *p )
 }
 
 static int
-readmore( FILE *fp, char *buf, int bufsize, int *bufpos, str *line )
+readmore( source *src, char *buf, int bufsize, int *bufpos, str *line )
 {
 	if ( line->len ) return 1;
-	else return str_fget( fp, buf, bufsize, bufpos, line );
+	else return source_fget( src, buf, bufsize, bufpos, line );
 }
 
 static int
-risin_readf( FILE *fp, char *buf, int bufsize, int *bufpos, str *line, str *reference, int *fcharset )
+risin_readf( source *src, char *buf, int bufsize, int *bufpos, str *line, str *reference, int *fcharset )
 {
 	int haveref = 0, inref = 0, readtoofar = 0;
 	char *p;
 
 	*fcharset = CHARSET_UNKNOWN;
 
-	while ( !haveref && readmore( fp, buf, bufsize, bufpos, line ) ) {
+	while ( !haveref && readmore( src, buf, bufsize, bufpos, line ) ) {
 
 		if ( str_is_empty( line ) ) continue;
 
@@ -460,7 +462,7 @@ risin_person( fields *bibin, int n, str *intag, str *invalue, int level, param *
 			str_strcat( &name, slist_str( &tokens, i ) );
 		}
 
-		status = add_name( bibout, outtag, str_cstr( &name ), level, &(pm->asis), &(pm->corps) );
+		status = add_name( bibout, outtag, str_cstr( &name ), level, &(pm->asis), &(pm->corps), pm->names );
 		if ( status!=BIBL_OK ) goto out;
 
 		begin = end + 1;
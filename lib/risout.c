@@ -23,7 +23,7 @@
  PUBLIC: int risout_initparams()
 *****************************************************/
 
-static int  risout_write( fields *info, FILE *fp, param *p, unsigned long refnum );
+static int  risout_write( fields *info, sink *s, param *p, unsigned long refnum );
 static int  risout_assemble( fields *in, fields *out, param *pm, unsigned long refnum );
 
 int
@@ -41,6 +41,7 @@ risout_initparams( param *pm, const char *progname )
 	pm->verbose          = 0;
 	pm->addcount         = 0;
 	pm->singlerefperfile = 0;
+	pm->nthreads         = 0;
 
 	if ( pm->charsetout == BIBL_CHARSET_UNICODE ) {
 		pm->utf8out = pm->utf8bom = 1;
@@ -672,7 +673,7 @@ risout_assemble( fields *in, fields *out, param *pm, unsigned long refnum )
 *****************************************************/
 
 static int
-risout_write( fields *out, FILE *fp, param *p, unsigned long refnum )
+risout_write( fields *out, sink *s, param *p, unsigned long refnum )
 {
 	const char *tag, *value;
 	int i;
@@ -680,10 +681,12 @@ risout_write( fields *out, FILE *fp, param *p, unsigned long refnum )
 	for ( i=0; i<out->n; ++i ) {
 		tag   = fields_tag  ( out, i, FIELDS_CHRP );
 		value = fields_value( out, i, FIELDS_CHRP );
-		fprintf( fp, "%s  - %s\n", tag, value );
+		sink_puts( s, tag );
+		sink_write( s, "  - ", 4 );
+		sink_puts( s, value );
+		sink_putc( s, '\n' );
 	}
 
-	fprintf( fp, "ER  - \n" );
-	fflush( fp );
+	sink_write( s, "ER  - \n", 7 );
 	return BIBL_OK;
 }
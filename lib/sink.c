@@ -0,0 +1,166 @@
+/*
+ * sink.c
+ *
+ * buffered output sink for the writers
+ *
+ * Copyright (c) Chris Putnam 2021
+ *
+ * Source code released under the GPL version 2
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <string.h>
+#include "sink.h"
+
+#ifdef SINK_UNLOCKED_STDIO
+#define sink_fwrite fwrite_unlocked
+#else
+#define sink_fwrite fwrite
+#endif
+
+static const char spaces[] =
+	"                                                                ";
+
+void
+sink_init( sink *s, FILE *fp )
+{
+	s->fp     = fp;
+	s->out    = NULL;
+	s->len    = 0;
+	s->status = SINK_OK;
+}
+
+void
+sink_init_str( sink *s, str *out )
+{
+	s->fp     = NULL;
+	s->out    = out;
+	s->len    = 0;
+	s->status = SINK_OK;
+}
+
+/* sink_flush()
+ *
+ * Hand buffered output on to the FILE* or str; returns SINK_OK,
+ * SINK_ERR_MEMERR, or SINK_ERR_WRITE
+ */
+int
+sink_flush( sink *s )
+{
+	if ( s->len==0 || s->status!=SINK_OK ) goto out;
+
+	if ( s->fp ) {
+		if ( sink_fwrite( s->buf, 1, s->len, s->fp )!=s->len )
+			s->status = SINK_ERR_WRITE;
+	} else if ( s->out ) {
+		str_segcat( s->out, s->buf, s->buf + s->len );
+		if ( str_memerr( s->out ) ) s->status = SINK_ERR_MEMERR;
+	}
+
+	s->len = 0;
+out:
+	return s->status;
+}
+
+/* sink_free()
+ *
+ * Flush the sink; a FILE* that stdio has already seen fail makes
+ * this SINK_ERR_WRITE even if the last fwrite() went through.
+ */
+int
+sink_free( sink *s )
+{
+	sink_flush( s );
+	if ( s->fp && s->status==SINK_OK && ferror( s->fp ) )
+		s->status = SINK_ERR_WRITE;
+	return s->status;
+}
+
+int
+sink_status( sink *s )
+{
+	return s->status;
+}
+
+void
+sink_write( sink *s, const char *p, unsigned long n )
+{
+	unsigned long room;
+
+	while ( n ) {
+		room = SINK_BUFSIZE - s->len;
+		if ( room==0 ) {
+			if ( sink_flush( s )!=SINK_OK ) return;
+			room = SINK_BUFSIZE;
+		}
+		if ( room > n ) room = n;
+		memcpy( s->buf + s->len, p, room );
+		s->len += room;
+		p      += room;
+		n      -= room;
+	}
+}
+
+void
+sink_putc( sink *s, char c )
+{
+	if ( s->len==SINK_BUFSIZE && sink_flush( s )!=SINK_OK ) return;
+	s->buf[ s->len++ ] = c;
+}
+
+void
+sink_puts( sink *s, const char *p )
+{
+	if ( p ) sink_write( s, p, strlen( p ) );
+}
+
+void
+sink_str( sink *s, str *p )
+{
+	if ( p && p->len ) sink_write( s, p->data, p->len );
+}
+
+void
+sink_spaces( sink *s, unsigned long n )
+{
+	unsigned long m;
+
+	while ( n ) {
+		m = ( n < sizeof( spaces ) - 1 ) ? n : sizeof( spaces ) - 1;
+		sink_write( s, spaces, m );
+		n -= m;
+	}
+}
+
+void
+sink_printf( sink *s, const char *fmt, ... )
+{
+	char small[512], *p = small;
+	va_list ap;
+	int n;
+
+	va_start( ap, fmt );
+	n = vsnprintf( small, sizeof( small ), fmt, ap );
+	va_end( ap );
+	if ( n < 0 ) {
+		s->status = SINK_ERR_WRITE;
+		return;
+	}
+
+	if ( n >= (int) sizeof( small ) ) {
+		p = ( char * ) malloc( n + 1 );
+		if ( !p ) {
+			s->status = SINK_ERR_MEMERR;
+			return;
+		}
+		va_start( ap, fmt );
+		vsnprintf( p, n + 1, fmt, ap );
+		va_end( ap );
+	}
+
+	sink_write( s, p, n );
+
+	if ( p!=small ) free( p );
+}
@@ -0,0 +1,59 @@
+/*
+ * sink.h
+ *
+ * buffered output sink for the writers
+ *
+ * Copyright (c) Chris Putnam 2021
+ *
+ * Source code released under the GPL version 2
+ *
+ */
+#ifndef SINK_H
+#define SINK_H
+
+#include <stdio.h>
+#include "str.h"
+
+#define SINK_OK          (0)
+#define SINK_ERR_MEMERR (-1)
+#define SINK_ERR_WRITE  (-2)
+
+#define SINK_BUFSIZE (16384)
+
+/* Output is collected in buf[] and handed on in one piece when it
+ * fills or on sink_flush(); either to a FILE* with a single fwrite(),
+ * or appended to a str for sinks built with sink_init_str().
+ *
+ * The buffer lives inside the struct, so a sink on the stack costs
+ * no allocations at all.
+ */
+typedef struct sink {
+	FILE *fp;
+	str  *out;
+	unsigned long len;
+	int status;
+	char buf[ SINK_BUFSIZE ];
+} sink;
+
+void sink_init     ( sink *s, FILE *fp );
+void sink_init_str ( sink *s, str *out );
+int  sink_flush    ( sink *s );
+int  sink_free     ( sink *s );
+
+void sink_write    ( sink *s, const char *p, unsigned long n );
+void sink_putc     ( sink *s, char c );
+void sink_puts     ( sink *s, const char *p );
+void sink_str      ( sink *s, str *p );
+void sink_spaces   ( sink *s, unsigned long n );
+void sink_printf   ( sink *s, const char *fmt, ... );
+
+int  sink_status   ( sink *s );
+
+/* #define SINK_UNLOCKED_STDIO
+ *
+ * set to flush with fwrite_unlocked() where the C library provides
+ * it; the caller must then ensure no other thread uses the FILE*
+ * while a sink is writing to it
+ */
+
+#endif
@@ -0,0 +1,282 @@
+/*
+ * source.c
+ *
+ * input source for the readers
+ *
+ * Copyright (c) Chris Putnam 2021
+ *
+ * Source code released under the GPL version 2
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "source.h"
+
+void
+source_init( source *s, FILE *fp )
+{
+	source_init_mem( s, NULL, 0 );
+	s->fp  = fp;
+}
+
+void
+source_init_mem( source *s, const char *p, unsigned long len )
+{
+	s->fp  = NULL;
+	s->p   = p;
+	s->len = ( p ) ? len : 0;
+	s->pos = s->mark = 0;
+	s->eof = 0;
+	s->in  = NULL;
+	s->win = NULL;
+	s->winmax = s->base = 0;
+	s->status = SOURCE_OK;
+}
+
+/* source_init_file()
+ *
+ * Read fp from where it is. The window grows only to hold the longest
+ * line; free it with source_free().
+ */
+void
+source_init_file( source *s, FILE *fp )
+{
+	source_init_mem( s, NULL, 0 );
+	s->in = fp;
+}
+
+void
+source_free( source *s )
+{
+	if ( s->win ) free( s->win );
+	s->win = NULL;
+	s->p   = NULL;
+	s->winmax = s->len = s->pos = 0;
+}
+
+/* source_more()
+ *
+ * Drop the text before pos from the window and read more of the file
+ * after what is left. Returns 0 once nothing more can be read.
+ */
+static int
+source_more( source *s )
+{
+	unsigned long max, n;
+	char *win;
+
+	if ( !s->in ) return 0;
+
+	if ( s->pos ) {
+		memmove( s->win, s->win + s->pos, s->len - s->pos );
+		s->base += s->pos;
+		s->len  -= s->pos;
+		s->pos   = 0;
+	}
+
+	if ( s->len == s->winmax ) {
+		max = ( s->winmax ) ? s->winmax * 2 : SOURCE_WINDOW;
+		win = ( char * ) realloc( s->win, max );
+		if ( !win ) {
+			s->status = SOURCE_ERR_MEMERR;
+			s->in = NULL;
+			return 0;
+		}
+		s->win = win;
+		s->winmax = max;
+		s->p = s->win;
+	}
+
+	n = fread( s->win + s->len, 1, s->winmax - s->len, s->in );
+	if ( n==0 ) {
+		if ( ferror( s->in ) ) s->status = SOURCE_ERR_READ;
+		s->in = NULL;
+		return 0;
+	}
+	s->len += n;
+
+	return 1;
+}
+
+/* source_moreline()
+ *
+ * Read on until the window holds a whole line from pos, with a "\r\n"
+ * ending not split, or the rest of the file.
+ */
+static void
+source_moreline( source *s )
+{
+	unsigned long i = s->pos;
+
+	while ( s->in ) {
+		while ( i < s->len && s->p[i]!='\r' && s->p[i]!='\n' ) i++;
+		if ( i + 1 < s->len || ( i < s->len && s->p[i]=='\n' ) ) return;
+		i -= s->pos;
+		if ( !source_more( s ) ) return;
+	}
+}
+
+/* source_morebytes()
+ *
+ * Read on until the window holds n bytes from pos, a '\n', or the rest
+ * of the file.
+ */
+static void
+source_morebytes( source *s, unsigned long n )
+{
+	unsigned long i = s->pos;
+
+	while ( s->in && s->len - s->pos < n ) {
+		if ( i < s->len && memchr( s->p + i, '\n', s->len - i ) ) return;
+		i = s->len - s->pos;
+		if ( !source_more( s ) ) return;
+	}
+}
+
+/* source_fget()
+ *
+ * As str_fget(): put the next line, without its end characters, in
+ * line; returns 0 once the input is exhausted, 1 otherwise.
+ *
+ * For memory, "\r\n" ends a line as one unit and "\r" or "\n" alone
+ * as well, which is what str_fget() sees from files.
+ */
+int
+source_fget( source *s, char *buf, int bufsize, int *bufpos, str *line )
+{
+	const char *p, *q, *end;
+
+	if ( s->fp ) return str_fget( s->fp, buf, bufsize, bufpos, line );
+
+	str_empty( line );
+
+	if ( s->in ) source_moreline( s );
+
+	if ( s->pos >= s->len ) {
+		s->eof = 1;
+		return 0;
+	}
+
+	p = q = s->p + s->pos;
+	end = s->p + s->len;
+
+	while ( q < end && *q!='\r' && *q!='\n' ) q++;
+	str_segcpy( line, ( char * ) p, ( char * ) q );
+	s->mark = s->base + ( q - s->p );
+
+	if ( q + 1 < end && q[0]=='\r' && q[1]=='\n' ) q += 2;
+	else if ( q < end ) q += 1;
+
+	s->pos = q - s->p;
+
+	return 1;
+}
+
+/* source_gets()
+ *
+ * As fgets(): read up to bufsize-1 characters, stopping after a '\n',
+ * and return NULL with buf untouched if nothing is left.
+ */
+char *
+source_gets( source *s, char *buf, int bufsize )
+{
+	const char *p, *nl;
+	unsigned long n;
+
+	if ( s->fp ) return fgets( buf, bufsize, s->fp );
+
+	if ( bufsize < 1 ) return NULL;
+
+	if ( s->in ) source_morebytes( s, bufsize - 1 );
+
+	if ( s->pos >= s->len ) {
+		s->eof = 1;
+		return NULL;
+	}
+
+	p = s->p + s->pos;
+	n = s->len - s->pos;
+	if ( n > ( unsigned long ) bufsize - 1 ) n = bufsize - 1;
+
+	nl = memchr( p, '\n', n );
+	if ( nl ) n = nl - p + 1;
+
+	memcpy( buf, p, n );
+	buf[n] = '\0';
+	s->pos += n;
+	s->mark = s->base + s->pos;
+
+	/* like feof(), set once a read has run into the end */
+	if ( s->pos >= s->len && !nl && n < ( unsigned long ) bufsize - 1 ) s->eof = 1;
+
+	return buf;
+}
+
+int
+source_eof( source *s )
+{
+	if ( s->fp ) return feof( s->fp );
+	return s->eof;
+}
+
+int
+source_status( source *s )
+{
+	return s->status;
+}
+
+/* source_readall()
+ *
+ * Read the rest of fp into a new buffer, with a '\0' after the len
+ * bytes read. If max is not zero, inputs over max bytes are refused
+ * with SOURCE_ERR_SIZE. On error *buf is NULL and nothing is held.
+ */
+int
+source_readall( FILE *fp, char **buf, unsigned long *len, unsigned long max )
+{
+	unsigned long alloc = 0, n;
+	int status = SOURCE_OK;
+	char *more;
+
+	*buf = NULL;
+	*len = 0;
+
+	do {
+		if ( *len + 1 >= alloc ) {
+			alloc = ( alloc ) ? alloc * 2 : 65536;
+			more = ( char * ) realloc( *buf, alloc );
+			if ( !more ) { status = SOURCE_ERR_MEMERR; goto out; }
+			*buf = more;
+		}
+		n = fread( *buf + *len, 1, alloc - *len - 1, fp );
+		*len += n;
+		if ( max && *len > max ) { status = SOURCE_ERR_SIZE; goto out; }
+	} while ( n );
+
+	if ( ferror( fp ) ) status = SOURCE_ERR_READ;
+	else ( *buf )[ *len ] = '\0';
+
+out:
+	if ( status!=SOURCE_OK ) {
+		free( *buf );
+		*buf = NULL;
+		*len = 0;
+	}
+	return status;
+}
+
+/* source_tell()
+ *
+ * For memory and windowed file sources, the offset at which the input not yet used by
+ * a reader starts, given the text it holds over in pending (the
+ * "read too far" line of the readf functions): the end of the text
+ * last handed out, less pending, which is always its tail.
+ */
+unsigned long
+source_tell( source *s, str *pending )
+{
+	if ( pending->len==0 ) return s->base + s->pos;
+	if ( pending->len > s->mark ) return 0;
+	return s->mark - pending->len;
+}
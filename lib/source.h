@@ -0,0 +1,58 @@
+/*
+ * source.h
+ *
+ * input source for the readers
+ *
+ * Copyright (c) Chris Putnam 2021
+ *
+ * Source code released under the GPL version 2
+ *
+ */
+#ifndef SOURCE_H
+#define SOURCE_H
+
+#include <stdio.h>
+#include "str.h"
+
+#define SOURCE_OK          (0)
+#define SOURCE_ERR_MEMERR (-1)
+#define SOURCE_ERR_READ   (-2)
+#define SOURCE_ERR_SIZE   (-3)
+
+#define SOURCE_WINDOW (65536)
+
+/* Input for the readers, either from a FILE* or from a span of memory
+ * built with source_init_mem(), which need not be '\0'-terminated.
+ *
+ * Memory sources hand out lines straight from the span; the caller's
+ * buf/bufpos are then unused. source_init_file() reads a FILE* through
+ * a window of the source's own, handled as a span that starts at file
+ * offset base, so that source_tell() works as for memory.
+ */
+typedef struct source {
+	FILE *fp;
+	const char *p;
+	unsigned long len, pos;
+	unsigned long mark;   /* offset of the end of the text last handed out */
+	int eof;
+	FILE *in;             /* file the window is refilled from */
+	char *win;
+	unsigned long winmax, base;
+	int status;
+} source;
+
+void  source_init     ( source *s, FILE *fp );
+void  source_init_mem ( source *s, const char *p, unsigned long len );
+void  source_init_file( source *s, FILE *fp );
+void  source_free     ( source *s );
+
+int   source_fget     ( source *s, char *buf, int bufsize, int *bufpos, str *line );
+char *source_gets     ( source *s, char *buf, int bufsize );
+int   source_eof      ( source *s );
+int   source_status   ( source *s );
+
+unsigned long source_tell( source *s, str *pending );
+
+int   source_readall  ( FILE *fp, char **buf, unsigned long *len, unsigned long max );
+
+#endif
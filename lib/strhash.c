@@ -0,0 +1,222 @@
+/*
+ * strhash.c
+ *
+ * Copyright (c) Chris Putnam 2021
+ *
+ * Source code released under the GPL version 2
+ *
+ * Implements a string -> int index with linear probing
+ *
+ */
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include "hash.h"
+#include "strhash.h"
+
+#define STRHASH_MINALLOC (16)
+
+void
+strhash_init( strhash *h, int nocase )
+{
+	h->slots  = NULL;
+	h->n      = 0;
+	h->nslots = 0;
+	h->nocase = nocase;
+}
+
+void
+strhash_free( strhash *h )
+{
+	if ( h->slots ) free( h->slots );
+	strhash_init( h, h->nocase );
+}
+
+void
+strhash_empty( strhash *h )
+{
+	if ( h->slots ) memset( h->slots, 0, sizeof( strhash_entry ) * h->nslots );
+	h->n = 0;
+}
+
+strhash *
+strhash_new( int nocase )
+{
+	strhash *h;
+	h = ( strhash * ) malloc( sizeof( strhash ) );
+	if ( h ) strhash_init( h, nocase );
+	return h;
+}
+
+void
+strhash_delete( strhash *h )
+{
+	strhash_free( h );
+	free( h );
+}
+
+static int
+strhash_keymatch( strhash *h, strhash_entry *e, const char *key, unsigned long len, unsigned int hash )
+{
+	if ( e->hash!=hash || e->len!=len ) return 0;
+	if ( h->nocase ) return !strncasecmp( e->key, key, len );
+	else return !memcmp( e->key, key, len );
+}
+
+/* strhash_slot()
+ *
+ * Return the slot holding key, or the empty slot where it would go.
+ */
+static unsigned long
+strhash_slot( strhash *h, const char *key, unsigned long len, unsigned int hash )
+{
+	unsigned long mask = h->nslots - 1, i = hash & mask;
+
+	while ( h->slots[i].key ) {
+		if ( strhash_keymatch( h, &(h->slots[i]), key, len, hash ) ) break;
+		i = ( i + 1 ) & mask;
+	}
+
+	return i;
+}
+
+static int
+strhash_grow( strhash *h )
+{
+	strhash_entry *old = h->slots, *more;
+	unsigned long i, j, nold = h->nslots, nslots;
+
+	nslots = ( nold ) ? nold * 2 : STRHASH_MINALLOC;
+	more = ( strhash_entry * ) calloc( nslots, sizeof( strhash_entry ) );
+	if ( !more ) return STRHASH_MEMERR;
+
+	h->slots  = more;
+	h->nslots = nslots;
+
+	for ( i=0; i<nold; ++i ) {
+		if ( !old[i].key ) continue;
+		j = old[i].hash & ( nslots - 1 );
+		while ( more[j].key ) j = ( j + 1 ) & ( nslots - 1 );
+		more[j] = old[i];
+	}
+
+	if ( old ) free( old );
+
+	return STRHASH_OK;
+}
+
+static int
+strhash_insert( strhash *h, const char *key, unsigned long len, int value, int replace )
+{
+	unsigned int hash;
+	unsigned long i;
+	int status;
+
+	if ( ( h->n + 1 ) * 2 > h->nslots ) {
+		status = strhash_grow( h );
+		if ( status!=STRHASH_OK ) return status;
+	}
+
+	hash = calculate_hash_strn( key, len, h->nocase );
+	i = strhash_slot( h, key, len, hash );
+
+	if ( h->slots[i].key ) {
+		if ( replace ) h->slots[i].value = value;
+		return STRHASH_OK;
+	}
+
+	h->slots[i].key   = key;
+	h->slots[i].len   = len;
+	h->slots[i].hash  = hash;
+	h->slots[i].value = value;
+	h->n++;
+
+	return STRHASH_OK;
+}
+
+/* strhash_set()
+ *
+ * Add key, or replace the value of a key already present.
+ */
+int
+strhash_set( strhash *h, const char *key, int value )
+{
+	return strhash_insert( h, key, strlen( key ), value, 1 );
+}
+
+int
+strhash_setn( strhash *h, const char *key, unsigned long len, int value )
+{
+	return strhash_insert( h, key, len, value, 1 );
+}
+
+/* strhash_add_unique()
+ *
+ * Add key only if not already present, so the first value wins.
+ */
+int
+strhash_add_unique( strhash *h, const char *key, int value )
+{
+	return strhash_insert( h, key, strlen( key ), value, 0 );
+}
+
+/* strhash_findn()
+ *
+ * Return the value stored for key, or -1 if not present.
+ */
+int
+strhash_findn( strhash *h, const char *key, unsigned long len )
+{
+	unsigned long i;
+
+	if ( h->n==0 ) return -1;
+
+	i = strhash_slot( h, key, len, calculate_hash_strn( key, len, h->nocase ) );
+	if ( h->slots[i].key ) return h->slots[i].value;
+	else return -1;
+}
+
+int
+strhash_find( strhash *h, const char *key )
+{
+	return strhash_findn( h, key, strlen( key ) );
+}
+
+/* strhash_removen()
+ *
+ * Delete key, shifting back any later entries of the probe run so
+ * lookups never need tombstones. Returns the removed value or -1.
+ */
+int
+strhash_removen( strhash *h, const char *key, unsigned long len )
+{
+	unsigned long mask, i, j, k;
+	int value;
+
+	if ( h->n==0 ) return -1;
+
+	mask = h->nslots - 1;
+	i = strhash_slot( h, key, len, calculate_hash_strn( key, len, h->nocase ) );
+	if ( !h->slots[i].key ) return -1;
+
+	value = h->slots[i].value;
+	h->n--;
+
+	j = i;
+	while ( 1 ) {
+		h->slots[i].key = NULL;
+		do {
+			j = ( j + 1 ) & mask;
+			if ( !h->slots[j].key ) return value;
+			k = h->slots[j].hash & mask;
+		} while ( ( i <= j ) ? ( i < k && k <= j ) : ( i < k || k <= j ) );
+		h->slots[i] = h->slots[j];
+		i = j;
+	}
+}
+
+int
+strhash_remove( strhash *h, const char *key )
+{
+	return strhash_removen( h, key, strlen( key ) );
+}
@@ -0,0 +1,52 @@
+/*
+ * strhash.h
+ *
+ * Copyright (c) Chris Putnam 2021
+ *
+ * Source code released under the GPL version 2
+ *
+ */
+#ifndef STRHASH_H
+#define STRHASH_H
+
+#define STRHASH_OK     (0)
+#define STRHASH_MEMERR (-1)
+
+#define STRHASH_CASE   (0)
+#define STRHASH_NOCASE (1)
+
+/* Open-addressed index from strings to non-negative ints.
+ *
+ * Keys are not copied; the caller keeps the characters alive and
+ * unchanged for as long as they are in the table (typically they are
+ * the data of an slist, a static table, or a fields entry and the
+ * value is the index into it).
+ */
+typedef struct strhash_entry {
+	const char    *key;
+	unsigned long len;
+	unsigned int  hash;
+	int           value;
+} strhash_entry;
+
+typedef struct strhash {
+	strhash_entry *slots;
+	unsigned long n, nslots;
+	int nocase;
+} strhash;
+
+void     strhash_init( strhash *h, int nocase );
+void     strhash_free( strhash *h );
+void     strhash_empty( strhash *h );
+strhash *strhash_new( int nocase );
+void     strhash_delete( strhash *h );
+
+int      strhash_set( strhash *h, const char *key, int value );
+int      strhash_setn( strhash *h, const char *key, unsigned long len, int value );
+int      strhash_add_unique( strhash *h, const char *key, int value );
+int      strhash_find( strhash *h, const char *key );
+int      strhash_findn( strhash *h, const char *key, unsigned long len );
+int      strhash_remove( strhash *h, const char *key );
+int      strhash_removen( strhash *h, const char *key, unsigned long len );
+
+#endif
@@ -0,0 +1,168 @@
+/*
+ * tokens.c
+ *
+ * BibTeX/BibLaTeX value tokens as spans of the reference buffer
+ *
+ * Copyright (c) Chris Putnam 2021
+ *
+ * Source code released under the GPL version 2
+ *
+ */
+#include <stdlib.h>
+#include <string.h>
+#include "is_ws.h"
+#include "tokens.h"
+
+void
+tokens_init( tokens *t )
+{
+	t->n   = 0;
+	t->max = TOKENS_INLINE;
+	t->tok = t->tok_inline;
+}
+
+void
+tokens_free( tokens *t )
+{
+	if ( t->tok!=t->tok_inline ) free( t->tok );
+	tokens_init( t );
+}
+
+int
+tokens_add( tokens *t, const char *p, unsigned long len, int newlines )
+{
+	token *more;
+	int max;
+
+	if ( t->n==t->max ) {
+		max = t->max * 2;
+		if ( t->tok==t->tok_inline ) {
+			more = ( token * ) malloc( sizeof( token ) * max );
+			if ( more ) memcpy( more, t->tok_inline, sizeof( token ) * t->n );
+		} else {
+			more = ( token * ) realloc( t->tok, sizeof( token ) * max );
+		}
+		if ( !more ) return TOKENS_MEMERR;
+		t->tok = more;
+		t->max = max;
+	}
+
+	t->tok[ t->n ].p        = p;
+	t->tok[ t->n ].len      = len;
+	t->tok[ t->n ].newlines = newlines;
+	t->n++;
+
+	return TOKENS_OK;
+}
+
+/* token_is_concat()
+ *
+ * Is this the BibTeX string concatenation token '#'?
+ */
+int
+token_is_concat( token *t )
+{
+	return ( t->len==1 && t->p[0]=='#' );
+}
+
+/* token_is_bare()
+ *
+ * Tokens not opened by a quotation mark or curly bracket are macro names
+ * or numbers.
+ */
+int
+token_is_bare( token *t )
+{
+	return ( t->p[0]!='\"' && t->p[0]!='{' );
+}
+
+/* tokens_are_literal()
+ *
+ * Can the value be written straight from the buffer: no '#'
+ * concatenation and no bare word that names a macro in m?
+ */
+int
+tokens_are_literal( tokens *t, macros *m )
+{
+	token *tk;
+	int i;
+
+	for ( i=0; i<t->n; ++i ) {
+		tk = &(t->tok[i]);
+		if ( token_is_concat( tk ) ) return 0;
+		if ( !token_is_bare( tk ) ) continue;
+		if ( tk->newlines ) return 0;
+		if ( macros_findn( m, tk->p, tk->len ) ) return 0;
+	}
+
+	return 1;
+}
+
+int
+tokens_has_concat( tokens *t )
+{
+	int i;
+
+	for ( i=0; i<t->n; ++i )
+		if ( token_is_concat( &(t->tok[i]) ) ) return 1;
+
+	return 0;
+}
+
+/* token_cat()
+ *
+ * Append the token, less skipbegin characters at the front and skipend
+ * at the back, to s. Only tokens that span a line break are copied a
+ * character at a time.
+ */
+void
+token_cat( str *s, token *t, unsigned long skipbegin, unsigned long skipend )
+{
+	const char *p, *end;
+
+	if ( skipbegin + skipend >= t->len ) return;
+
+	p   = t->p + skipbegin;
+	end = t->p + t->len - skipend;
+
+	if ( !t->newlines ) {
+		str_segcat( s, ( char * ) p, ( char * ) end );
+		return;
+	}
+
+	while ( p < end ) {
+		if ( *p=='\n' || *p=='\r' ) {
+			str_addchar( s, ' ' );
+			while ( p+1 < end && is_ws( *(p+1) ) ) p++;
+		} else {
+			str_addchar( s, *p );
+		}
+		p++;
+	}
+}
+
+/* tokens_to_slist()
+ *
+ * Materialize the tokens for the passes that rewrite them.
+ */
+int
+tokens_to_slist( tokens *t, slist *out )
+{
+	str s;
+	int i;
+
+	str_init( &s );
+
+	for ( i=0; i<t->n; ++i ) {
+		str_empty( &s );
+		token_cat( &s, &(t->tok[i]), 0, 0 );
+		if ( str_memerr( &s ) || slist_add( out, &s )!=SLIST_OK ) {
+			str_free( &s );
+			return TOKENS_MEMERR;
+		}
+	}
+
+	str_free( &s );
+
+	return TOKENS_OK;
+}
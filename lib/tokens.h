@@ -0,0 +1,50 @@
+/*
+ * tokens.h
+ *
+ * BibTeX/BibLaTeX value tokens as spans of the reference buffer
+ *
+ * Copyright (c) Chris Putnam 2021
+ *
+ * Source code released under the GPL version 2
+ *
+ */
+#ifndef TOKENS_H
+#define TOKENS_H
+
+#include "str.h"
+#include "slist.h"
+#include "macros.h"
+
+#define TOKENS_OK     (0)
+#define TOKENS_MEMERR (-1)
+
+#define TOKENS_INLINE (8)
+
+/* A token is the characters p[0..len) of the buffer being parsed; if
+ * newlines is set, each CR/LF in it and the whitespace after it stand
+ * for a single space.
+ */
+typedef struct token {
+	const char    *p;
+	unsigned long len;
+	int           newlines;
+} token;
+
+typedef struct tokens {
+	int   n, max;
+	token *tok;
+	token tok_inline[ TOKENS_INLINE ];
+} tokens;
+
+void tokens_init( tokens *t );
+void tokens_free( tokens *t );
+int  tokens_add( tokens *t, const char *p, unsigned long len, int newlines );
+int  tokens_has_concat( tokens *t );
+int  tokens_to_slist( tokens *t, slist *out );
+int  tokens_are_literal( tokens *t, macros *m );
+
+int  token_is_concat( token *t );
+int  token_is_bare( token *t );
+void token_cat( str *s, token *t, unsigned long skipbegin, unsigned long skipend );
+
+#endif
@@ -317,13 +317,13 @@ unicode_utf8_classify( char *p )
 }
 
 unsigned short
-unicode_utf8_classify_str( str *s )
+unicode_utf8_classify_strn( const char *p, unsigned long len )
 {
 	unsigned int unicode_character, pos = 0;
 	unsigned short value = 0;
 	int n;
-	while ( pos < s->len ) {
-		unicode_character = utf8_decode( str_cstr( s ), &pos );
+	while ( pos < len ) {
+		unicode_character = utf8_decode_n( p, len, &pos );
 		n = unicode_find( unicode_character );
 		if ( n==-1 ) value |= UNICODE_SYMBOL;
 		else value |= unicodeinfo[n].info;
@@ -331,3 +331,9 @@ unicode_utf8_classify_str( str *s )
 	return value;
 }
 
+unsigned short
+unicode_utf8_classify_str( str *s )
+{
+	return unicode_utf8_classify_strn( str_cstr( s ), s->len );
+}
+
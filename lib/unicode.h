@@ -18,5 +18,6 @@
 
 unsigned short unicode_utf8_classify( char *p );
 unsigned short unicode_utf8_classify_str( str *s );
+unsigned short unicode_utf8_classify_strn( const char *p, unsigned long len );
 
 #endif
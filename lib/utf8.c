@@ -139,14 +139,33 @@ utf8_decode( const char *s, unsigned int *pi )
 	return c;
 }
 
+/* utf8_decode_n()
+ *
+ * As utf8_decode() for the first len bytes of s, which need not be
+ * nul-terminated; bytes past the end read as '\0'.
+ */
+unsigned int
+utf8_decode_n( const char *s, unsigned int len, unsigned int *pi )
+{
+	unsigned int c, i = *pi, j = 0;
+	char buf[7];
+
+	if ( i + 6 <= len ) return utf8_decode( s, pi );
+
+	memset( buf, 0, sizeof( buf ) );
+	if ( i < len ) memcpy( buf, s + i, len - i );
+	c = utf8_decode( buf, &j );
+	*pi = i + j;
+	return c;
+}
+
 void
-utf8_writebom( FILE *outptr )
+utf8_writebom( sink *out )
 {
-	int i, nc;
+	int nc;
 	unsigned char code[6];
 	nc = utf8_encode( 0xFEFF, code );
-	for ( i=0; i<nc; ++i )
-		fprintf(outptr,"%c",code[i]);
+	sink_write( out, ( char * ) code, nc );
 }
 
 int
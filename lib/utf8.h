@@ -10,11 +10,13 @@
 #define UTF8_H
 
 #include <stdio.h>
+#include "sink.h"
 
 int          utf8_encode( unsigned int value, unsigned char out[6] );
 void         utf8_encode_str( unsigned int value, char outstr[7] );
 unsigned int utf8_decode( const char *s, unsigned int *pi );
-void         utf8_writebom( FILE *outptr );
+unsigned int utf8_decode_n( const char *s, unsigned int len, unsigned int *pi );
+void         utf8_writebom( sink *out );
 int          utf8_is_bom( const char *p );
 int          utf8_is_emdash( const char *p );
 int          utf8_is_endash( const char *p );
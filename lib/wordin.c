@@ -17,7 +17,7 @@
 #include "xml_encoding.h"
 #include "bibformats.h"
 
-static int wordin_readf( FILE *fp, char *buf, int bufsize, int *bufpos, str *line, str *reference, int *fcharset );
+static int wordin_readf( source *src, char *buf, int bufsize, int *bufpos, str *line, str *reference, int *fcharset );
 static int wordin_processf( fields *wordin, const char *data, const char *filename, long nref, param *p );
 
 
@@ -48,8 +48,10 @@ wordin_initparams( param *pm, const char *progname )
 	pm->all      = NULL;
 	pm->nall     = 0;
 
-	slist_init( &(pm->asis) );
-	slist_init( &(pm->corps) );
+	namelist_init( &(pm->asis) );
+	namelist_init( &(pm->corps) );
+	pm->names = NULL;
+	pm->strings = NULL;
 
 	if ( !progname ) pm->progname = NULL;
 	else {
@@ -77,13 +79,13 @@ wordin_findendwrapper( char *buf, int ntype )
 }
 
 static int
-wordin_readf( FILE *fp, char *buf, int bufsize, int *bufpos, str *line, str *reference, int *fcharset )
+wordin_readf( source *src, char *buf, int bufsize, int *bufpos, str *line, str *reference, int *fcharset )
 {
 	str tmp;
 	char *startptr = NULL, *endptr;
 	int haveref = 0, inref = 0, file_charset = CHARSET_UNKNOWN, m, type = 1;
 	str_init( &tmp );
-	while ( !haveref && str_fget( fp, buf, bufsize, bufpos, line ) ) {
+	while ( !haveref && source_fget( src, buf, bufsize, bufpos, line ) ) {
 		if ( str_cstr( line ) ) {
 			m = xml_getencoding( line );
 			if ( m!=CHARSET_UNKNOWN ) file_charset = m;
@@ -105,6 +107,8 @@ wordin_readf( FILE *fp, char *buf, int bufsize, int *bufpos, str *line, str *ref
 		}
 	}
 	str_free( &tmp );
+	/* nothing read is held over for the next reference */
+	str_empty( line );
 	*fcharset = file_charset;
 	return haveref;
 }
@@ -16,14 +16,15 @@
 #include "month.h"
 #include "utf8.h"
 #include "bibformats.h"
+#include "mph.h"
 
 /*****************************************************
  PUBLIC: int wordout_initparams()
 *****************************************************/
 
-static void wordout_writeheader( FILE *outptr, param *p );
-static void wordout_writefooter( FILE *outptr );
-static int  wordout_write( fields *info, FILE *outptr, param *p, unsigned long numrefs );
+static void wordout_writeheader( sink *out, param *p );
+static void wordout_writefooter( sink *out );
+static int  wordout_write( fields *info, sink *out, param *p, unsigned long numrefs );
 
 int
 wordout_initparams( param *pm, const char *progname )
@@ -43,6 +44,7 @@ wordout_initparams( param *pm, const char *progname )
 	pm->verbose          = 0;
 	pm->addcount         = 0;
 	pm->singlerefperfile = 0;
+	pm->nthreads         = 0;
 
 	pm->headerf   = wordout_writeheader;
 	pm->footerf   = wordout_writefooter;
@@ -124,11 +126,9 @@ enum {
 };
 
 static void
-output_level( FILE *outptr, int level )
+output_level( sink *out, int level )
 {
-	int i;
-	for ( i=0; i<level; ++i )
-		fprintf( outptr, " " );
+	if ( level > 0 ) sink_spaces( out, level );
 }
 
 /* fixed output
@@ -136,10 +136,10 @@ output_level( FILE *outptr, int level )
  * <TAG>value</TAG>
  */
 static void
-output_fixed( FILE *outptr, const char *tag, const char *value, int level )
+output_fixed( sink *out, const char *tag, const char *value, int level )
 {
-	output_level( outptr, level );
-	fprintf( outptr, "<%s>%s</%s>\n", tag, value, tag );
+	output_level( out, level );
+	sink_printf( out, "<%s>%s</%s>\n", tag, value, tag );
 }
 
 /* detail output
@@ -147,11 +147,11 @@ output_fixed( FILE *outptr, const char *tag, const char *value, int level )
  * <TAG>value</TAG>
  */
 static void
-output_item( fields *info, FILE *outptr, const char *tag, const char *prefix, int item, int level )
+output_item( fields *info, sink *out, const char *tag, const char *prefix, int item, int level )
 {
 	if ( item!=-1 ) {
-		output_level( outptr, level );
-		fprintf( outptr, "<%s>%s%s</%s>\n",
+		output_level( out, level );
+		sink_printf( out, "<%s>%s%s</%s>\n",
 			tag,
 			prefix,
 			(char*) fields_value( info, item, FIELDS_CHRP ),
@@ -161,10 +161,10 @@ output_item( fields *info, FILE *outptr, const char *tag, const char *prefix, in
 }
 
 static void
-output_itemv( FILE *outptr, const char *tag, const char *item, int level )
+output_itemv( sink *out, const char *tag, const char *item, int level )
 {
-	output_level( outptr, level );
-	fprintf( outptr, "<%s>%s</%s>\n", tag, item, tag );
+	output_level( out, level );
+	sink_printf( out, "<%s>%s</%s>\n", tag, item, tag );
 }
 
 /* range output
@@ -173,37 +173,37 @@ output_itemv( FILE *outptr, const char *tag, const char *item, int level )
  *
  */
 static void
-output_nodash( FILE *outptr, const char *p )
+output_nodash( sink *out, const char *p )
 {
 	while ( *p ) {
 		/* -30 is the first character of a UTF8 em-dash and en-dash */
 		if ( *p==-30 && ( utf8_is_emdash( p ) || utf8_is_endash( p ) ) ) {
-			fprintf( outptr, "-" );
+			sink_puts( out, "-" );
 			p+=3;
 		} else {
-			fprintf( outptr, "%c", *p );
+			sink_putc( out, *p );
 			p+=1;
 		}
 	}
 }
 static void
-output_range( FILE *outptr, const char *tag, const char *start, const char *end, int level )
+output_range( sink *out, const char *tag, const char *start, const char *end, int level )
 {
 	if ( !start && !end ) return;
-	fprintf( outptr, "<%s>", tag );
-	if ( start ) output_nodash( outptr, start );
-	if ( start && end ) fprintf( outptr, "-" );
-	if ( end ) output_nodash( outptr, end );
-	fprintf( outptr, "</%s>\n", tag );
+	sink_printf( out, "<%s>", tag );
+	if ( start ) output_nodash( out, start );
+	if ( start && end ) sink_puts( out, "-" );
+	if ( end ) output_nodash( out, end );
+	sink_printf( out, "</%s>\n", tag );
 }
 
 static void
-output_list( fields *info, FILE *outptr, convert *c, int nc )
+output_list( fields *info, sink *out, convert *c, int nc )
 {
         int i, n;
         for ( i=0; i<nc; ++i ) {
                 n = fields_find( info, c[i].oldtag, c[i].code );
-                if ( n!=FIELDS_NOTFOUND ) output_item( info, outptr, c[i].newtag, c[i].prefix, n, 0 );
+                if ( n!=FIELDS_NOTFOUND ) output_item( info, out, c[i].newtag, c[i].prefix, n, 0 );
         }
 
 }
@@ -213,30 +213,9 @@ typedef struct outtype {
 	const char *out;
 } outtype;
 
-static
-outtype genres[] = {
-	{ TYPE_PATENT,           "patent" },
-	{ TYPE_REPORT,           "report" },
-	{ TYPE_REPORT,           "technical report" },
-	{ TYPE_CASE,             "legal case and case notes" },
-	{ TYPE_ART,              "art original" },
-	{ TYPE_ART,              "art reproduction" },
-	{ TYPE_ART,              "comic strip" },
-	{ TYPE_ART,              "diorama" },
-	{ TYPE_ART,              "graphic" },
-	{ TYPE_ART,              "model" },
-	{ TYPE_ART,              "picture" },
-	{ TYPE_ELECTRONICSOURCE, "electronic" },
-	{ TYPE_FILM,             "videorecording" },
-	{ TYPE_FILM,             "motion picture" },
-	{ TYPE_SOUNDRECORDING,   "sound" },
-	{ TYPE_PERFORMANCE,      "rehersal" },
-	{ TYPE_INTERNETSITE,     "web site" },
-	{ TYPE_INTERVIEW,        "interview" },
-	{ TYPE_INTERVIEW,        "communication" },
-	{ TYPE_MISC,             "misc" },
-};
-int ngenres = sizeof( genres ) / sizeof( genres[0] );
+/* genre names to types, in wordout_genres.c as generated by
+ * bldhash/mph_table from bldhash/wordout_genres.txt */
+#include "wordout_genres.c"
 
 static int
 get_type_from_genre( fields *info )
@@ -247,10 +226,9 @@ get_type_from_genre( fields *info )
 		tag = (const char *) fields_tag( info, i, FIELDS_CHRP );
 		if ( strcasecmp( tag, "GENRE:MARC" ) && strcasecmp( tag, "GENRE:BIBUTILS" ) && strcasecmp( tag, "GENRE:UNKNOWN" ) ) continue;
 		genre = (const char *) fields_value( info, i, FIELDS_CHRP );
-		for ( j=0; j<ngenres; ++j ) {
-			if ( !strcasecmp( genres[j].out, genre ) )
-				type = genres[j].value;
-		}
+		j = mph_slot( &wordout_genres_hash, genre );
+		if ( !strcasecmp( wordout_genres_keys[j], genre ) )
+			type = wordout_genres_values[j];
 		if ( type==TYPE_UNKNOWN ) {
 			level = fields_level( info, i );
 			if ( !strcasecmp( genre, "academic journal" ) ) {
@@ -309,31 +287,31 @@ get_type( fields *info )
 }
 
 static void
-output_titlebits( const char *mainttl, const char *subttl, FILE *outptr )
+output_titlebits( const char *mainttl, const char *subttl, sink *out )
 {
-	if ( mainttl ) fprintf( outptr, "%s", mainttl );
+	if ( mainttl ) sink_puts( out, mainttl );
 	if ( subttl ) {
 		if ( mainttl ) {
 			if ( mainttl[ strlen( mainttl ) - 1 ] != '?' )
-				fprintf( outptr, ": " );
-			else fprintf( outptr, " " );
+				sink_puts( out, ": " );
+			else sink_puts( out, " " );
 		}
-		fprintf( outptr, "%s", subttl );
+		sink_puts( out, subttl );
 	}
 }
 
 static void
-output_titleinfo( const char *mainttl, const char *subttl, FILE *outptr, const char *tag, int level )
+output_titleinfo( const char *mainttl, const char *subttl, sink *out, const char *tag, int level )
 {
 	if ( mainttl || subttl ) {
-		fprintf( outptr, "<%s>", tag );
-		output_titlebits( mainttl, subttl, outptr );
-		fprintf( outptr, "</%s>\n", tag );
+		sink_printf( out, "<%s>", tag );
+		output_titlebits( mainttl, subttl, out );
+		sink_printf( out, "</%s>\n", tag );
 	}
 }
 
 static void
-output_generaltitle( fields *info, FILE *outptr, const char *tag, int level )
+output_generaltitle( fields *info, sink *out, const char *tag, int level )
 {
 	const char *ttl       = fields_findv( info, level, FIELDS_CHRP, "TITLE" );
 	const char *subttl    = fields_findv( info, level, FIELDS_CHRP, "SUBTITLE" );
@@ -341,15 +319,15 @@ output_generaltitle( fields *info, FILE *outptr, const char *tag, int level )
 	const char *shrsubttl = fields_findv( info, level, FIELDS_CHRP, "SHORTSUBTITLE" );
 
 	if ( ttl ) {
-		output_titleinfo( ttl, subttl, outptr, tag, level );
+		output_titleinfo( ttl, subttl, out, tag, level );
 	}
 	else if ( shrttl ) {
-		output_titleinfo( shrttl, shrsubttl, outptr, tag, level );
+		output_titleinfo( shrttl, shrsubttl, out, tag, level );
 	}
 }
 
 static void
-output_maintitle( fields *info, FILE *outptr, int level )
+output_maintitle( fields *info, sink *out, int level )
 {
 	const char *ttl       = fields_findv( info, level, FIELDS_CHRP, "TITLE" );
 	const char *subttl    = fields_findv( info, level, FIELDS_CHRP, "SUBTITLE" );
@@ -357,32 +335,32 @@ output_maintitle( fields *info, FILE *outptr, int level )
 	const char *shrsubttl = fields_findv( info, level, FIELDS_CHRP, "SHORTSUBTITLE" );
 
 	if ( ttl ) {
-		output_titleinfo( ttl, subttl, outptr, "b:Title", level );
+		output_titleinfo( ttl, subttl, out, "b:Title", level );
 
 		/* output shorttitle if it's different from normal title */
 		if ( shrttl ) {
 			if ( !ttl || ( strcmp( shrttl, ttl ) || subttl ) ) {
-				fprintf( outptr,  " <b:ShortTitle>" );
-				output_titlebits( shrttl, shrsubttl, outptr );
-				fprintf( outptr, "</b:ShortTitle>\n" );
+				sink_puts( out, " <b:ShortTitle>" );
+				output_titlebits( shrttl, shrsubttl, out );
+				sink_puts( out, "</b:ShortTitle>\n" );
 			}
 		}
 	}
 	else if ( shrttl ) {
-		output_titleinfo( shrttl, shrsubttl, outptr, "b:Title", level );
+		output_titleinfo( shrttl, shrsubttl, out, "b:Title", level );
 	}
 }
 
 static void
-output_name_nomangle( FILE *outptr, const char *p )
+output_name_nomangle( sink *out, const char *p )
 {
-	fprintf( outptr, "<b:Person>" );
-	fprintf( outptr, "<b:Last>%s</b:Last>", p );
-	fprintf( outptr, "</b:Person>\n" );
+	sink_puts( out, "<b:Person>" );
+	sink_printf( out, "<b:Last>%s</b:Last>", p );
+	sink_puts( out, "</b:Person>\n" );
 }
 
 static void
-output_name( FILE *outptr, const char *p )
+output_name( sink *out, const char *p )
 {
 	str family, part;
 	int n=0, npart=0;
@@ -391,8 +369,8 @@ output_name( FILE *outptr, const char *p )
 	while ( *p && *p!='|' ) str_addchar( &family, *p++ );
 	if ( *p=='|' ) p++;
 	if ( str_has_value( &family ) ) {
-		fprintf( outptr, "<b:Person>" );
-		fprintf( outptr, "<b:Last>%s</b:Last>", str_cstr( &family ) );
+		sink_puts( out, "<b:Person>" );
+		sink_printf( out, "<b:Last>%s</b:Last>", str_cstr( &family ) );
 		n++;
 	}
 	str_free( &family );
@@ -401,11 +379,11 @@ output_name( FILE *outptr, const char *p )
 	while ( *p ) {
 		while ( *p && *p!='|' ) str_addchar( &part, *p++ );
 		if ( str_has_value( &part ) ) {
-			if ( n==0 ) fprintf( outptr, "<b:Person>" );
+			if ( n==0 ) sink_puts( out, "<b:Person>" );
 			if ( npart==0 ) 
-				fprintf( outptr, "<b:First>%s</b:First>", str_cstr( &part ) );
+				sink_printf( out, "<b:First>%s</b:First>", str_cstr( &part ) );
 			else
-				fprintf( outptr, "<b:Middle>%s</b:Middle>", str_cstr( &part ) );
+				sink_printf( out, "<b:Middle>%s</b:Middle>", str_cstr( &part ) );
 			n++;
 			npart++;
 		}
@@ -414,7 +392,7 @@ output_name( FILE *outptr, const char *p )
 			str_empty( &part );
 		}
 	}
-	if ( n ) fprintf( outptr, "</b:Person>\n" );
+	if ( n ) sink_puts( out, "</b:Person>\n" );
 
 	str_free( &part );
 }
@@ -435,7 +413,7 @@ extract_name_and_info( str *outtag, str *intag )
 }
 
 static void
-output_name_type( fields *info, FILE *outptr, int level, char *map[], int nmap, const char *tag )
+output_name_type( fields *info, sink *out, int level, char *map[], int nmap, const char *tag )
 {
 	str ntag;
 	int i, j, n=0, code, nfields;
@@ -446,21 +424,21 @@ output_name_type( fields *info, FILE *outptr, int level, char *map[], int nmap,
 			code = extract_name_and_info( &ntag, fields_tag( info, i, FIELDS_STRP ) );
 			if ( strcasecmp( str_cstr( &ntag ), map[j] ) ) continue;
 			if ( n==0 )
-				fprintf( outptr, "<%s><b:NameList>\n", tag );
+				sink_printf( out, "<%s><b:NameList>\n", tag );
 			if ( code != NAME )
-				output_name_nomangle( outptr, (char *) fields_value( info, i, FIELDS_CHRP ) );
+				output_name_nomangle( out, (char *) fields_value( info, i, FIELDS_CHRP ) );
 			else 
-				output_name( outptr, (char *) fields_value( info, i, FIELDS_CHRP ) );
+				output_name( out, (char *) fields_value( info, i, FIELDS_CHRP ) );
 			n++;
 		}
 	}
 	str_free( &ntag );
 	if ( n )
-		fprintf( outptr, "</b:NameList></%s>\n", tag );
+		sink_printf( out, "</b:NameList></%s>\n", tag );
 }
 
 static void
-output_names( fields *info, FILE *outptr, int level, int type )
+output_names( fields *info, sink *out, int level, int type )
 {
 	char *authors[] = { "AUTHOR", "WRITER", "ASSIGNEE", "ARTIST",
 		"CARTOGRAPHER", "INVENTOR", "ORGANIZER", "DIRECTOR",
@@ -477,14 +455,14 @@ output_names( fields *info, FILE *outptr, int level, int type )
 
 	if ( type == TYPE_PATENT ) author_type = inventor;
 
-	fprintf( outptr, "<b:Author>\n" );
-	output_name_type( info, outptr, level, authors, nauthors, author_type );
-	output_name_type( info, outptr, level, editors, neditors, "b:Editor" );
-	fprintf( outptr, "</b:Author>\n" );
+	sink_puts( out, "<b:Author>\n" );
+	output_name_type( info, out, level, authors, nauthors, author_type );
+	output_name_type( info, out, level, editors, neditors, "b:Editor" );
+	sink_puts( out, "</b:Author>\n" );
 }
 
 static void
-output_date( fields *info, FILE *outptr, int level )
+output_date( fields *info, sink *out, int level )
 {
 	const char *use;
 
@@ -494,37 +472,37 @@ output_date( fields *info, FILE *outptr, int level )
 			"PARTDATE:MONTH", "DATE:MONTH", NULL );
 	const char *day   = fields_findv_firstof( info, level, FIELDS_CHRP,
 			"PARTDATE:DAY", "DATE:DAY", NULL );
-	if ( year )  output_itemv( outptr, "b:Year", year, 0 );
+	if ( year )  output_itemv( out, "b:Year", year, 0 );
 	if ( month ) {
 		(void) number_to_full_month( month, &use );
-		output_itemv( outptr, "b:Month", use, 0 );
+		output_itemv( out, "b:Month", use, 0 );
 	}
-	if ( day )   output_itemv( outptr, "b:Day", day, 0 );
+	if ( day )   output_itemv( out, "b:Day", day, 0 );
 }
 
 static void
-output_pages( fields *info, FILE *outptr, int level )
+output_pages( fields *info, sink *out, int level )
 {
 	const char *sn = fields_findv( info, LEVEL_ANY, FIELDS_CHRP, "PAGES:START" );
 	const char *en = fields_findv( info, LEVEL_ANY, FIELDS_CHRP, "PAGES:STOP" );
 	const char *ar = fields_findv( info, LEVEL_ANY, FIELDS_CHRP, "ARTICLENUMBER" );
 	if ( sn || en )
-		output_range( outptr, "b:Pages", sn, en, level );
+		output_range( out, "b:Pages", sn, en, level );
 	else if ( ar )
-		output_range( outptr, "b:Pages", ar, NULL, level );
+		output_range( out, "b:Pages", ar, NULL, level );
 }
 
 static void
-output_includedin( fields *info, FILE *outptr, int type )
+output_includedin( fields *info, sink *out, int type )
 {
 	if ( type==TYPE_JOURNALARTICLE ) {
-		output_generaltitle( info, outptr, "b:JournalName", 1 );
+		output_generaltitle( info, out, "b:JournalName", 1 );
 	} else if ( type==TYPE_ARTICLEINAPERIODICAL ) {
-		output_generaltitle( info, outptr, "b:PeriodicalTitle", 1 );
+		output_generaltitle( info, out, "b:PeriodicalTitle", 1 );
 	} else if ( type==TYPE_BOOKSECTION ) {
-		output_generaltitle( info, outptr, "b:ConferenceName", 1 ); /*??*/
+		output_generaltitle( info, out, "b:ConferenceName", 1 ); /*??*/
 	} else if ( type==TYPE_PROCEEDINGS ) {
-		output_generaltitle( info, outptr, "b:ConferenceName", 1 );
+		output_generaltitle( info, out, "b:ConferenceName", 1 );
 	}
 }
 
@@ -540,15 +518,15 @@ type_is_thesis( int type )
 }
 
 static void
-output_thesisdetails( fields *info, FILE *outptr, int type )
+output_thesisdetails( fields *info, sink *out, int type )
 {
 	char *tag;
 	int i, n;
 
 	if ( type==TYPE_PHDTHESIS )
-		output_fixed( outptr, "b:ThesisType", "Ph.D. Thesis", 0 );
+		output_fixed( out, "b:ThesisType", "Ph.D. Thesis", 0 );
 	else if ( type==TYPE_MASTERSTHESIS ) 
-		output_fixed( outptr, "b:ThesisType", "Masters Thesis", 0 );
+		output_fixed( out, "b:ThesisType", "Masters Thesis", 0 );
 
 	n = fields_num( info );
 	for ( i=0; i<n; ++i ) {
@@ -557,7 +535,7 @@ output_thesisdetails( fields *info, FILE *outptr, int type )
 			strcasecmp( tag, "DEGREEGRANTOR:ASIS") &
 			strcasecmp( tag, "DEGREEGRANTOR:CORP"))
 				continue;
-		output_item( info, outptr, "b:Institution", "", i, 0 );
+		output_item( info, out, "b:Institution", "", i, 0 );
 	}
 }
 
@@ -586,27 +564,27 @@ static
 int ntypes = sizeof( types ) / sizeof( types[0] );
 
 static void
-output_type( fields *info, FILE *outptr, int type )
+output_type( fields *info, sink *out, int type )
 {
 	int i, found = 0;
-	fprintf( outptr, "<b:SourceType>" );
+	sink_puts( out, "<b:SourceType>" );
 	for ( i=0; i<ntypes && !found; ++i ) {
 		if ( types[i].value!=type ) continue;
 		found = 1;
-		fprintf( outptr, "%s", types[i].out );
+		sink_puts( out, types[i].out );
 	}
 	if ( !found ) {
-		if (  type_is_thesis( type ) ) fprintf( outptr, "Report" );
-		else fprintf( outptr, "Misc" );
+		if (  type_is_thesis( type ) ) sink_puts( out, "Report" );
+		else sink_puts( out, "Misc" );
 	}
-	fprintf( outptr, "</b:SourceType>\n" );
+	sink_puts( out, "</b:SourceType>\n" );
 
 	if ( type_is_thesis( type ) )
-		output_thesisdetails( info, outptr, type );
+		output_thesisdetails( info, out, type );
 }
 
 static void
-output_comments( fields *info, FILE *outptr, int level )
+output_comments( fields *info, sink *out, int level )
 {
 	const char *abs;
 	vplist_index i;
@@ -617,25 +595,25 @@ output_comments( fields *info, FILE *outptr, int level )
 	abs = fields_findv( info, level, FIELDS_CHRP, "ABSTRACT" );
 	fields_findv_each( info, level, FIELDS_CHRP, &notes, "NOTES" );
 
-	if ( abs || notes.n ) fprintf( outptr, "<b:Comments>" );
-	if ( abs ) fprintf( outptr, "%s", abs );
+	if ( abs || notes.n ) sink_puts( out, "<b:Comments>" );
+	if ( abs ) sink_puts( out, abs );
 	for ( i=0; i<notes.n; ++i )
-		fprintf( outptr, "%s", (char*)vplist_get( &notes, i ) );
-	if ( abs || notes.n ) fprintf( outptr, "</b:Comments>\n" );
+		sink_puts( out, (char*)vplist_get( &notes, i ) );
+	if ( abs || notes.n ) sink_puts( out, "</b:Comments>\n" );
 
 	vplist_free( &notes );
 }
 
 static void
-output_bibkey( fields *info, FILE *outptr )
+output_bibkey( fields *info, sink *out )
 {
 	const char *bibkey = fields_findv_firstof( info, LEVEL_ANY, FIELDS_CHRP,
 			"REFNUM", "BIBKEY", NULL );
-	if ( bibkey ) output_itemv( outptr, "b:Tag", bibkey, 0 );
+	if ( bibkey ) output_itemv( out, "b:Tag", bibkey, 0 );
 }
 
 static void
-output_citeparts( fields *info, FILE *outptr, int level, int max, int type )
+output_citeparts( fields *info, sink *out, int level, int max, int type )
 {
 	convert origin[] = {
 		{ "ADDRESS",	"b:City",	"", LEVEL_ANY },
@@ -661,29 +639,27 @@ output_citeparts( fields *info, FILE *outptr, int level, int max, int type )
 	};
 	int nparts=sizeof(parts)/sizeof(convert);
 	
-	output_bibkey( info, outptr );
-	output_type( info, outptr, type );
-	output_list( info, outptr, origin, norigin );
-	output_date( info, outptr, level );
-	output_includedin( info, outptr, type );
-	output_list( info, outptr, parts, nparts );
-	output_pages( info, outptr, level );
-	output_names( info, outptr, level, type );
-	output_maintitle( info, outptr, 0 );
-	output_comments( info, outptr, level );
+	output_bibkey( info, out );
+	output_type( info, out, type );
+	output_list( info, out, origin, norigin );
+	output_date( info, out, level );
+	output_includedin( info, out, type );
+	output_list( info, out, parts, nparts );
+	output_pages( info, out, level );
+	output_names( info, out, level, type );
+	output_maintitle( info, out, 0 );
+	output_comments( info, out, level );
 }
 
 static int
-wordout_write( fields *info, FILE *outptr, param *p, unsigned long numrefs )
+wordout_write( fields *info, sink *out, param *p, unsigned long numrefs )
 {
 	int max = fields_maxlevel( info );
 	int type = get_type( info );
 
-	fprintf( outptr, "<b:Source>\n" );
-	output_citeparts( info, outptr, -1, max, type );
-	fprintf( outptr, "</b:Source>\n" );
-
-	fflush( outptr );
+	sink_puts( out, "<b:Source>\n" );
+	output_citeparts( info, out, -1, max, type );
+	sink_puts( out, "</b:Source>\n" );
 
 	return BIBL_OK;
 }
@@ -693,13 +669,13 @@ wordout_write( fields *info, FILE *outptr, param *p, unsigned long numrefs )
 *****************************************************/
 
 static void
-wordout_writeheader( FILE *outptr, param *p )
+wordout_writeheader( sink *out, param *p )
 {
-	if ( p->utf8bom ) utf8_writebom( outptr );
-	fprintf(outptr,"<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n");
-	fprintf(outptr,"<b:Sources SelectedStyle=\"\" "
+	if ( p->utf8bom ) utf8_writebom( out );
+	sink_puts( out, "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n" );
+	sink_puts( out, "<b:Sources SelectedStyle=\"\" "
 		"xmlns:b=\"http://schemas.openxmlformats.org/officeDocument/2006/bibliography\" "
-		" xmlns=\"http://schemas.openxmlformats.org/officeDocument/2006/bibliography\" >\n");
+		" xmlns=\"http://schemas.openxmlformats.org/officeDocument/2006/bibliography\" >\n" );
 }
 
 /*****************************************************
@@ -707,8 +683,7 @@ wordout_writeheader( FILE *outptr, param *p )
 *****************************************************/
 
 static void
-wordout_writefooter( FILE *outptr )
+wordout_writefooter( sink *out )
 {
-	fprintf(outptr,"</b:Sources>\n");
-	fflush( outptr );
+	sink_puts( out, "</b:Sources>\n" );
 }
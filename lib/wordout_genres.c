@@ -0,0 +1,50 @@
+/* 20 keys, generated by bldhash/mph_table; do not edit. */
+static const char *wordout_genres_keys[20] = {
+	"communication",
+	"interview",
+	"rehersal",
+	"picture",
+	"patent",
+	"videorecording",
+	"electronic",
+	"diorama",
+	"sound",
+	"motion picture",
+	"legal case and case notes",
+	"misc",
+	"model",
+	"report",
+	"art reproduction",
+	"graphic",
+	"technical report",
+	"comic strip",
+	"web site",
+	"art original",
+};
+static const int wordout_genres_values[20] = {
+	TYPE_INTERVIEW,
+	TYPE_INTERVIEW,
+	TYPE_PERFORMANCE,
+	TYPE_ART,
+	TYPE_PATENT,
+	TYPE_FILM,
+	TYPE_ELECTRONICSOURCE,
+	TYPE_ART,
+	TYPE_SOUNDRECORDING,
+	TYPE_FILM,
+	TYPE_CASE,
+	TYPE_MISC,
+	TYPE_ART,
+	TYPE_REPORT,
+	TYPE_ART,
+	TYPE_ART,
+	TYPE_REPORT,
+	TYPE_ART,
+	TYPE_INTERNETSITE,
+	TYPE_ART,
+};
+static const int wordout_genres_disp[7] = {
+	8, 17, 2, 9, -2, -20, 13,
+};
+static const mph wordout_genres_hash = { 20, 7, wordout_genres_disp, MPH_NOCASE };
+
@@ -20,8 +20,9 @@ xml_init( xml *node )
 {
 	str_init( &(node->tag) );
 	str_init( &(node->value) );
-	slist_init( &(node->attributes) );
-	slist_init( &(node->attribute_values) );
+	node->nattrib   = 0;
+	node->maxattrib = XML_ATTRIB_INLINE;
+	node->attrib    = node->attrib_inline;
 	node->down = NULL;
 	node->next = NULL;
 }
@@ -44,10 +45,16 @@ xml_delete( xml *node )
 void
 xml_free( xml *node )
 {
+	int i;
+
 	str_free( &(node->tag) );
 	str_free( &(node->value) );
-	slist_free( &(node->attributes) );
-	slist_free( &(node->attribute_values) );
+	for ( i=0; i<node->nattrib; ++i )
+		if ( node->attrib[i].value_str ) str_delete( node->attrib[i].value_str );
+	if ( node->attrib!=node->attrib_inline ) free( node->attrib );
+	node->nattrib = 0;
+	node->maxattrib = XML_ATTRIB_INLINE;
+	node->attrib = node->attrib_inline;
 	if ( node->down ) xml_delete( node->down );
 	if ( node->next ) xml_delete( node->next );
 }
@@ -79,46 +86,63 @@ xml_is_terminator( const char *p, int *type )
 	return 0;
 }
 
+/* xml_add_attribute()
+ *
+ * Record name/value spans; if value_str is non-NULL, the node takes
+ * ownership of it and the value span points into it.
+ */
 static int
-xml_add_attribute( xml *node, char *attribute, char *attribute_value  )
+xml_add_attribute( xml *node, const char *name, unsigned int name_len,
+		const char *value, unsigned int value_len, str *value_str )
 {
-	int status;
+	xml_attrib *more;
+	int alloc;
+
+	if ( node->nattrib==node->maxattrib ) {
+		alloc = node->maxattrib * 2;
+		if ( node->attrib==node->attrib_inline ) {
+			more = ( xml_attrib * ) malloc( sizeof( xml_attrib ) * alloc );
+			if ( more ) memcpy( more, node->attrib_inline, sizeof( xml_attrib ) * node->nattrib );
+		} else {
+			more = ( xml_attrib * ) realloc( node->attrib, sizeof( xml_attrib ) * alloc );
+		}
+		if ( !more ) return 0;
+		node->attrib    = more;
+		node->maxattrib = alloc;
+	}
 
-	if ( attribute )
-		status = slist_addc( &(node->attributes), attribute );
-	else
-		status = slist_addc( &(node->attributes), "" );
-	if ( status!=SLIST_OK ) return 0;
+	node->attrib[ node->nattrib ].name      = name;
+	node->attrib[ node->nattrib ].name_len  = name_len;
+	node->attrib[ node->nattrib ].value     = value;
+	node->attrib[ node->nattrib ].value_len = value_len;
+	node->attrib[ node->nattrib ].value_str = value_str;
+	node->nattrib++;
 
-	if ( attribute_value )
-		status = slist_addc( &(node->attribute_values), attribute_value );
-	else
-		status = slist_addc( &(node->attribute_values), "" );
-	if ( status!=SLIST_OK ) {
-		(void) slist_remove( &(node->attributes), node->attributes.n-1 );
-		return 0;
-	}
 	return 1;
 }
 
+/* xml_processattrib()
+ *
+ * Values are almost always a single quoted run of characters and are
+ * recorded as a span; values split up by quote characters (a="x"y)
+ * are the rare case that has to be copied out.
+ */
 static const char *
 xml_processattrib( const char *p, xml *node, int *type )
 {
-	char quote_character = '\"';
-	int inquotes = 0;
-	str aname, aval;
-
-	str_init( &aname );
-	str_init( &aval );
+	const char *name, *value, *value_end;
+	unsigned int name_len;
+	char quote_character;
+	int inquotes;
+	str *aval;
 
 	while ( *p && !xml_is_terminator( p, type ) ) {
 
 		/* get attribute name */
 		while ( *p==' ' || *p=='\t' ) p++;
-		while ( *p && !strchr( "= \t", *p ) && !xml_is_terminator( p, type ) ){
-			str_addchar( &aname, *p );
-			p++;
-		}
+		name = p;
+		while ( *p && !strchr( "= \t", *p ) && !xml_is_terminator( p, type ) ) p++;
+		name_len = p - name;
 
 		/* equals sign */
 		while ( *p==' ' || *p=='\t' ) p++;
@@ -126,27 +150,37 @@ xml_processattrib( const char *p, xml *node, int *type )
 		while ( *p==' ' || *p=='\t' ) p++;
 
 		/* get attribute value */
+		quote_character = '\"';
+		inquotes = 0;
 		if ( *p=='\"' || *p=='\'' ) {
-			if ( *p=='\'' ) quote_character = *p;
+			quote_character = *p;
 			inquotes=1;
 			p++;
 		}
+		value = p;
 		while ( *p && ((!xml_is_terminator(p,type) && !strchr("= \t", *p ))||inquotes)){
 			if ( *p==quote_character ) inquotes=0;
-			else str_addchar( &aval, *p );
 			p++;
 		}
-		if ( str_has_value( &aname ) ) {
-			xml_add_attribute( node, str_cstr( &aname ), str_cstr( &aval ) );
+		value_end = p;
+		if ( value_end>value && *(value_end-1)==quote_character ) value_end--;
+
+		if ( name_len==0 ) continue;
+
+		if ( !memchr( value, quote_character, value_end - value ) ) {
+			xml_add_attribute( node, name, name_len, value, value_end - value, NULL );
+		} else {
+			aval = str_new();
+			if ( !aval ) continue;
+			str_strcpyc( aval, "" );
+			for ( ; value<p; value++ )
+				if ( *value!=quote_character ) str_addchar( aval, *value );
+			if ( str_memerr( aval ) || !xml_add_attribute( node, name, name_len,
+					str_cstr( aval ), aval->len, aval ) )
+				str_delete( aval );
 		}
-
-		str_empty( &aname );
-		str_empty( &aval );
 	}
 
-	str_free( &aname );
-	str_free( &aval );
-
 	return p;
 }
 
@@ -257,8 +291,7 @@ out:
 void
 xml_draw( xml *node, int n )
 {
-	slist_index j;
-	int i;
+	int i, j;
 
 	if ( !node ) return;
 
@@ -266,11 +299,11 @@ xml_draw( xml *node, int n )
 
 	printf("n=%d tag='%s' value='%s'\n", n, str_cstr( &(node->tag) ), str_cstr( &(node->value) ) );
 
-	for ( j=0; j<node->attributes.n; ++j ) {
+	for ( j=0; j<node->nattrib; ++j ) {
 		for ( i=0; i<n; ++i ) printf( "    " );
-		printf( "    attribute='%s' value='%s'\n",
-			slist_cstr( &(node->attributes), j ),
-			slist_cstr( &(node->attribute_values), j )
+		printf( "    attribute='%.*s' value='%.*s'\n",
+			(int) node->attrib[j].name_len,  node->attrib[j].name,
+			(int) node->attrib[j].value_len, node->attrib[j].value
 		);
 	}
 
@@ -353,17 +386,27 @@ xml_tag_matches_has_value( xml *node, const char *tag )
 	return 0;
 }
 
+static int
+xml_attrib_name_matches( xml_attrib *a, const char *attribute, unsigned int len )
+{
+	if ( a->name_len!=len ) return 0;
+	return !strncmp( a->name, attribute, len );
+}
+
 int
 xml_has_attribute( xml *node, const char *attribute, const char *attribute_value )
 {
-	slist_index i;
-	char *a, *v;
-
-	for ( i=0; i<node->attributes.n; ++i ) {
-		a = slist_cstr( &(node->attributes), i );
-		v = slist_cstr( &(node->attribute_values), i );
-		if ( !a || !v ) continue;
-		if ( !strcasecmp( a, attribute ) && !strcasecmp( v, attribute_value ) )
+	unsigned int alen, vlen;
+	xml_attrib *a;
+	int i;
+
+	alen = strlen( attribute );
+	vlen = strlen( attribute_value );
+
+	for ( i=0; i<node->nattrib; ++i ) {
+		a = &(node->attrib[i]);
+		if ( a->name_len!=alen || a->value_len!=vlen ) continue;
+		if ( !strncasecmp( a->name, attribute, alen ) && !strncasecmp( a->value, attribute_value, vlen ) )
 			return 1;
 	}
 
@@ -377,24 +420,53 @@ xml_tag_has_attribute( xml *node, const char *tag, const char *attribute, const
 	return xml_has_attribute( node, attribute, attribute_value );
 }
 
+static xml_attrib *
+xml_find_attrib( xml *node, const char *attribute )
+{
+	unsigned int len;
+	int i;
+
+	len = strlen( attribute );
+	for ( i=0; i<node->nattrib; ++i )
+		if ( xml_attrib_name_matches( &(node->attrib[i]), attribute, len ) )
+			return &(node->attrib[i]);
+
+	return NULL;
+}
+
 str *
 xml_attribute( xml *node, const char *attribute )
 {
-	slist_index n;
+	xml_attrib *a;
+
+	a = xml_find_attrib( node, attribute );
+	if ( !a ) return NULL;
+
+	if ( !a->value_str ) {
+		a->value_str = str_new();
+		if ( !a->value_str ) return NULL;
+		if ( a->value_len )
+			str_segcpy( a->value_str, (char *) a->value, (char *) a->value + a->value_len );
+		else
+			str_strcpyc( a->value_str, "" );
+		if ( str_memerr( a->value_str ) ) {
+			str_delete( a->value_str );
+			a->value_str = NULL;
+			return NULL;
+		}
+	}
 
-	n = slist_findc( &(node->attributes), attribute );
-	if ( slist_wasnotfound( &(node->attributes), n ) ) return NULL;
-	else return slist_str( &(node->attribute_values), n );
+	return a->value_str;
 }
 
 char *
 xml_attribute_cstr( xml *node, const char *attribute )
 {
-	slist_index n;
+	str *s;
 
-	n = slist_findc( &(node->attributes), attribute );
-	if ( slist_wasnotfound( &(node->attributes), n ) ) return NULL;
-	else return slist_cstr( &(node->attribute_values), n );
+	s = xml_attribute( node, attribute );
+	if ( !s ) return NULL;
+	else return str_cstr( s );
 }
 
 int
@@ -12,11 +12,27 @@
 #include "slist.h"
 #include "str.h"
 
+/* Attribute names and values are stored as spans into the buffer
+ * handed to xml_parse(), which must outlive the tree; a value is
+ * only copied into a str when xml_attribute() asks for one.
+ */
+typedef struct xml_attrib {
+	const char *name;
+	const char *value;
+	unsigned int name_len;
+	unsigned int value_len;
+	str *value_str;
+} xml_attrib;
+
+#define XML_ATTRIB_INLINE (3)
+
 typedef struct xml {
 	str tag;
 	str value;
-	slist attributes;
-	slist attribute_values;
+	int nattrib;
+	int maxattrib;
+	xml_attrib *attrib;
+	xml_attrib attrib_inline[ XML_ATTRIB_INLINE ];
 	struct xml *down;
 	struct xml *next;
 } xml;
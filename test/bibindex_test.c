@@ -0,0 +1,377 @@
+/*
+ * bibindex_test.c
+ *
+ * Copyright (c) 2021
+ *
+ * Source code released under the GPL version 2
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "bibutils.h"
+#include "bibindex.h"
+
+char progname[] = "bibindex_test";
+char version[] = "0.1";
+
+#define check( a, b ) { \
+	if ( !(a) ) { \
+		fprintf( stderr, "Failed %s (%s) in %s() line %d\n", #a, b, __FUNCTION__, __LINE__ );\
+		return 1; \
+	} \
+}
+
+static const char bib[] =
+	"@string{ jt = \"Journal of Tests\" }\n"
+	"\n"
+	"@article{first,\n"
+	"  author = {Smith, John},\n"
+	"  title = {The first title},\n"
+	"  journal = jt,\n"
+	"  year = 2001,\n"
+	"  doi = {10.1000/ABC}\n"
+	"}\n"
+	"\n"
+	"@book{second,\n"
+	"  author = {M{\\\"u}ller, Hans},\n"
+	"  title = {A second title},\n"
+	"  publisher = {Publisher},\n"
+	"  year = 1999\n"
+	"}\n"
+	"@string{ other = \"Other Journal\" }\n"
+	"@article{third,\n"
+	"  author = {Doe, Jane},\n"
+	"  title = {The third title},\n"
+	"  journal = other # { Letters},\n"
+	"  year = 2010\n"
+	"}\n";
+
+static const char ris[] =
+	"\xef\xbb\xbfTY  - JOUR\r\n"
+	"AU  - Smith, John\r\n"
+	"TI  - The first title\r\n"
+	"DO  - 10.1000/abc\r\n"
+	"ER  - \r\n"
+	"\r\n"
+	"TY  - BOOK\r\n"
+	"AU  - M\xc3\xbcller, Hans\r\n"
+	"TI  - A second title\r\n"
+	"ID  - second\r\n"
+	"ER  - \r\n"
+	"TY  - JOUR\r\n"
+	"AU  - Doe, Jane\r\n"
+	"TI  - The third title\r\n"
+	"ID  - third\r\n"
+	"ER  - ";
+
+static const char med[] =
+	"<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+	"<PubmedArticleSet>\n"
+	"<PubmedArticle><MedlineCitation><PMID>1001</PMID><Article>\n"
+	"<Journal><Title>J Test</Title><JournalIssue><PubDate><Year>2001</Year></PubDate></JournalIssue></Journal>\n"
+	"<AuthorList><Author><LastName>Smith</LastName></Author></AuthorList><ArticleTitle>The first title</ArticleTitle>\n"
+	"</Article></MedlineCitation></PubmedArticle>\n"
+	"<PubmedArticle><MedlineCitation><PMID>1002</PMID><Article>\n"
+	"<Journal><Title>J Test</Title><JournalIssue><PubDate><Year>1999</Year></PubDate></JournalIssue></Journal>\n"
+	"<AuthorList><Author><LastName>M\xc3\xbcller</LastName></Author></AuthorList><ArticleTitle>M\xc3\xbcller's second title</ArticleTitle>\n"
+	"</Article></MedlineCitation></PubmedArticle>\n"
+	"<PubmedArticle><MedlineCitation><PMID>1003</PMID><Article>\n"
+	"<Journal><Title>J Test</Title><JournalIssue><PubDate><Year>2010</Year></PubDate></JournalIssue></Journal>\n"
+	"<AuthorList><Author><LastName>Doe</LastName></Author></AuthorList><ArticleTitle>The third title</ArticleTitle>\n"
+	"</Article></MedlineCitation></PubmedArticle>\n"
+	"</PubmedArticleSet>\n";
+
+typedef struct {
+	const char *data;
+	int        format;
+	int        charset;    /* as found in the file */
+	const char *keys[3];   /* naming the three references in turn */
+} sample;
+
+static sample samples[] = {
+	{ bib, BIBL_BIBTEXIN,  CHARSET_UNKNOWN, { "10.1000/abc", "SECOND", "third" } },
+	{ ris, BIBL_RISIN,     CHARSET_UNICODE, { "10.1000/ABC", "second", "third" } },
+	{ med, BIBL_MEDLINEIN, CHARSET_UNICODE, { "1001",        "1002",   "1003"  } },
+};
+
+static FILE *
+tmpfile_with( const char *data, unsigned long len )
+{
+	FILE *fp = tmpfile();
+	if ( !fp ) return NULL;
+	if ( len ) fwrite( data, 1, len, fp );
+	rewind( fp );
+	return fp;
+}
+
+static int
+same_fields( fields *a, fields *b )
+{
+	int i;
+
+	if ( a->n!=b->n ) return 0;
+	for ( i=0; i<a->n; ++i ) {
+		if ( fields_level( a, i )!=fields_level( b, i ) ) return 0;
+		if ( strcmp( fields_tag( a, i, FIELDS_CHRP_NOUSE ), fields_tag( b, i, FIELDS_CHRP_NOUSE ) ) ) return 0;
+		if ( strcmp( fields_value( a, i, FIELDS_CHRP_NOUSE ), fields_value( b, i, FIELDS_CHRP_NOUSE ) ) ) return 0;
+	}
+
+	return 1;
+}
+
+/* the spans cover the file in order */
+int
+test_build( void )
+{
+	unsigned long next;
+	bibindex x;
+	param p;
+	int i;
+	long j;
+
+	bibindex_init( &x );
+
+	for ( i=0; i<sizeof(samples)/sizeof(samples[0]); ++i ) {
+		bibl_initparams( &p, samples[i].format, BIBL_MODSOUT, progname );
+		check( ( bibindex_build( &x, samples[i].data, strlen( samples[i].data ), "test", &p )==BIBL_OK ), "bibindex_build() should succeed" );
+		check( ( x.size==strlen( samples[i].data ) ), "the index should know the file size" );
+		check( ( x.format==samples[i].format ), "the index should know the file format" );
+		check( ( x.charset==samples[i].charset ), "the charset of the file should be found" );
+		next = 0;
+		for ( j=0; j<x.n; ++j ) {
+			check( ( x.start[j]==next ), "spans should follow one another" );
+			next = x.start[j] + x.len[j];
+		}
+		check( ( next<=x.size ), "spans should stay in the file" );
+		bibl_freeparams( &p );
+	}
+
+	/* two @strings in the BibTeX sample */
+	bibl_initparams( &p, BIBL_BIBTEXIN, BIBL_MODSOUT, progname );
+	check( ( bibindex_build( &x, bib, strlen( bib ), "test.bib", &p )==BIBL_OK ), "bibindex_build() should succeed" );
+	check( ( x.n==5 ), "every record should be indexed" );
+	check( ( !x.isref[0] && x.isref[1] && x.isref[2] && !x.isref[3] && x.isref[4] ), "@strings are not references" );
+
+	check( ( bibindex_build( &x, NULL, 0, "empty", &p )==BIBL_OK ), "an empty file should be indexed" );
+	check( ( x.n==0 && x.keys.n==0 && x.size==0 ), "an empty file has no records" );
+	bibl_freeparams( &p );
+
+	bibindex_free( &x );
+
+	return 0;
+}
+
+static int
+same_index( bibindex *x, bibindex *y )
+{
+	long j;
+	int k;
+
+	if ( x->size!=y->size || x->format!=y->format || x->charset!=y->charset ) return 0;
+	if ( x->n!=y->n || x->keys.n!=y->keys.n ) return 0;
+	for ( j=0; j<x->n; ++j ) {
+		if ( x->start[j]!=y->start[j] || x->len[j]!=y->len[j] ) return 0;
+		if ( x->isref[j]!=y->isref[j] ) return 0;
+	}
+	for ( k=0; k<x->keys.n; ++k ) {
+		if ( strcmp( slist_cstr( &(x->keys), k ), slist_cstr( &(y->keys), k ) ) ) return 0;
+		if ( intlist_get( &(x->keyrec), k )!=intlist_get( &(y->keyrec), k ) ) return 0;
+	}
+
+	return 1;
+}
+
+/* indexing the file as it is read should match indexing it in memory */
+int
+test_buildfile( void )
+{
+	char name[] = "/tmp/bibindex_testXXXXXX";
+	bibindex x, y;
+	FILE *fp;
+	param p;
+	int i, fd;
+
+	bibindex_init( &x );
+	bibindex_init( &y );
+
+	fd = mkstemp( name );
+	check( ( fd!=-1 ), "mkstemp() should succeed" );
+	close( fd );
+
+	for ( i=0; i<sizeof(samples)/sizeof(samples[0]); ++i ) {
+		fp = fopen( name, "wb" );
+		check( ( fp!=NULL ), "fopen() should succeed" );
+		fwrite( samples[i].data, 1, strlen( samples[i].data ), fp );
+		fclose( fp );
+
+		bibl_initparams( &p, samples[i].format, BIBL_MODSOUT, progname );
+		check( ( bibindex_build( &x, samples[i].data, strlen( samples[i].data ), name, &p )==BIBL_OK ), "bibindex_build() should succeed" );
+		check( ( bibindex_buildfile( &y, name, &p )==BIBL_OK ), "bibindex_buildfile() should succeed" );
+		check( ( same_index( &x, &y ) ), "file and memory indices should match" );
+		bibl_freeparams( &p );
+	}
+
+	unlink( name );
+
+	bibl_initparams( &p, BIBL_BIBTEXIN, BIBL_MODSOUT, progname );
+	check( ( bibindex_buildfile( &y, name, &p )==BIBL_ERR_CANTOPEN ), "a missing file should not be indexed" );
+	bibl_freeparams( &p );
+
+	bibindex_free( &x );
+	bibindex_free( &y );
+
+	return 0;
+}
+
+/* references read through the index should match those of a full read */
+int
+test_read( void )
+{
+	intlist recs;
+	bibindex x;
+	bibl all, b;
+	param p;
+	FILE *fp;
+	int i, k;
+
+	bibindex_init( &x );
+	intlist_init( &recs );
+
+	for ( i=0; i<sizeof(samples)/sizeof(samples[0]); ++i ) {
+
+		bibl_initparams( &p, samples[i].format, BIBL_MODSOUT, progname );
+		bibl_init( &all );
+		check( ( bibl_read_mem( &all, samples[i].data, strlen( samples[i].data ), "test", &p )==BIBL_OK ), "bibl_read_mem() should succeed" );
+		check( ( all.n==3 ), "the sample should hold three references" );
+		check( ( bibindex_build( &x, samples[i].data, strlen( samples[i].data ), "test", &p )==BIBL_OK ), "bibindex_build() should succeed" );
+
+		fp = tmpfile_with( samples[i].data, strlen( samples[i].data ) );
+		check( ( fp!=NULL ), "tmpfile() should succeed" );
+
+		for ( k=0; k<3; ++k ) {
+			intlist_empty( &recs );
+			check( ( bibindex_find( &x, samples[i].keys[k], &recs )==1 ), "each key should name one record" );
+			bibl_init( &b );
+			check( ( bibindex_read( &x, fp, &recs, &b, "test", &p )==BIBL_OK ), "bibindex_read() should succeed" );
+			check( ( b.n==1 ), "one reference should be read" );
+			check( ( same_fields( b.ref[0], all.ref[k] ) ), "the reference should match a full read" );
+			bibl_free( &b );
+		}
+
+		/* several keys, asked for out of order and twice */
+		intlist_empty( &recs );
+		bibindex_find( &x, samples[i].keys[2], &recs );
+		bibindex_find( &x, samples[i].keys[0], &recs );
+		bibindex_find( &x, samples[i].keys[2], &recs );
+		bibl_init( &b );
+		check( ( bibindex_read( &x, fp, &recs, &b, "test", &p )==BIBL_OK ), "bibindex_read() should succeed" );
+		check( ( b.n==2 ), "each record should be read once" );
+		check( ( same_fields( b.ref[0], all.ref[0] ) && same_fields( b.ref[1], all.ref[2] ) ), "references should come in file order" );
+		bibl_free( &b );
+
+		fclose( fp );
+
+		/* a file of another size is not the one indexed */
+		fp = tmpfile_with( samples[i].data, strlen( samples[i].data ) - 1 );
+		check( ( fp!=NULL ), "tmpfile() should succeed" );
+		bibl_init( &b );
+		check( ( bibindex_read( &x, fp, &recs, &b, "test", &p )==BIBL_ERR_BADINPUT ), "a changed file should be refused" );
+		bibl_free( &b );
+		fclose( fp );
+
+		bibl_free( &all );
+		bibl_freeparams( &p );
+	}
+
+	intlist_empty( &recs );
+	check( ( bibindex_find( &x, "nosuchkey", &recs )==0 && recs.n==0 ), "unknown keys should find nothing" );
+
+	intlist_free( &recs );
+	bibindex_free( &x );
+
+	return 0;
+}
+
+int
+test_saveload( void )
+{
+	unsigned char *buf;
+	bibindex x, y;
+	long i, len;
+	param p;
+	FILE *fp;
+	int k;
+
+	bibindex_init( &x );
+	bibindex_init( &y );
+
+	bibl_initparams( &p, BIBL_BIBTEXIN, BIBL_MODSOUT, progname );
+	check( ( bibindex_build( &x, bib, strlen( bib ), "test.bib", &p )==BIBL_OK ), "bibindex_build() should succeed" );
+	bibl_freeparams( &p );
+
+	fp = tmpfile();
+	check( ( fp!=NULL ), "tmpfile() should succeed" );
+	check( ( bibindex_save( &x, fp )==BIBL_OK ), "bibindex_save() should succeed" );
+	rewind( fp );
+	check( ( bibindex_load( &y, fp )==BIBL_OK ), "bibindex_load() should succeed" );
+
+	check( ( y.size==x.size && y.format==x.format && y.charset==x.charset && y.n==x.n ), "the header should survive" );
+	for ( i=0; i<x.n; ++i )
+		check( ( y.start[i]==x.start[i] && y.len[i]==x.len[i] && y.isref[i]==x.isref[i] ), "records should survive" );
+	check( ( y.keys.n==x.keys.n ), "keys should survive" );
+	for ( k=0; k<x.keys.n; ++k ) {
+		check( ( !strcmp( slist_cstr( &(y.keys), k ), slist_cstr( &(x.keys), k ) ) ), "key strings should survive" );
+		check( ( intlist_get( &(y.keyrec), k )==intlist_get( &(x.keyrec), k ) ), "key records should survive" );
+		check( ( intlist_get( &(y.keytype), k )==intlist_get( &(x.keytype), k ) ), "key types should survive" );
+	}
+
+	/* every truncation is refused */
+	fseek( fp, 0, SEEK_END );
+	len = ftell( fp );
+	buf = ( unsigned char * ) malloc( len );
+	check( ( buf!=NULL ), "malloc() should succeed" );
+	rewind( fp );
+	check( ( fread( buf, 1, len, fp )==len ), "the index should read back" );
+	fclose( fp );
+
+	for ( i=0; i<len; ++i ) {
+		fp = tmpfile_with( ( char * ) buf, i );
+		check( ( fp!=NULL ), "tmpfile() should succeed" );
+		check( ( bibindex_load( &y, fp )==BIBL_ERR_BADINPUT ), "a truncated index should be refused" );
+		check( ( y.n==0 && y.keys.n==0 ), "a refused index should be left empty" );
+		fclose( fp );
+	}
+
+	/* a record running past the file is refused */
+	buf[ 8 + 8*4 + 8 + 3 ] = 0xff;
+	fp = tmpfile_with( ( char * ) buf, len );
+	check( ( fp!=NULL ), "tmpfile() should succeed" );
+	check( ( bibindex_load( &y, fp )==BIBL_ERR_BADINPUT ), "a damaged index should be refused" );
+	fclose( fp );
+
+	free( buf );
+	bibindex_free( &x );
+	bibindex_free( &y );
+
+	return 0;
+}
+
+int
+main( int argc, char *argv[] )
+{
+	int failed = 0;
+
+	failed += test_build();
+	failed += test_buildfile();
+	failed += test_read();
+	failed += test_saveload();
+
+	if ( !failed ) {
+		printf( "%s: PASSED\n", progname );
+		return EXIT_SUCCESS;
+	} else {
+		printf( "%s: FAILED\n", progname );
+		return EXIT_FAILURE;
+	}
+}
@@ -0,0 +1,89 @@
+/*
+ * bibl_test.c
+ *
+ * Copyright (c) 2021
+ *
+ * Source code released under the GPL version 2
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bibdefs.h"
+#include "bibl.h"
+
+char progname[] = "bibl_test";
+char version[] = "0.1";
+
+#define check( a, b ) { \
+	if ( !(a) ) { \
+		fprintf( stderr, "Failed %s (%s) in %s() line %d\n", #a, b, __FUNCTION__, __LINE__ );\
+		return 1; \
+	} \
+}
+
+static int
+add_ref( bibl *b, const char *citekey )
+{
+	fields *ref;
+
+	ref = fields_new();
+	if ( !ref ) return BIBL_ERR_MEMERR;
+	fields_add( ref, "INTERNAL_TYPE", "ARTICLE", LEVEL_MAIN );
+	if ( citekey ) fields_add( ref, "REFNUM", citekey, LEVEL_MAIN );
+
+	return bibl_addref( b, ref );
+}
+
+int
+test_index( void )
+{
+	const char *keys[] = { "smith2000", "jones2001", NULL, "smith2000", "Smith2000", "doe" };
+	const int nkeys = sizeof( keys ) / sizeof( keys[0] );
+	bibl_index index;
+	char buf[32];
+	bibl b;
+	int i;
+
+	bibl_init( &b );
+	for ( i=0; i<nkeys; ++i )
+		check( ( add_ref( &b, keys[i] )==BIBL_OK ), "add_ref() should succeed" );
+	for ( i=0; i<2000; ++i ) {
+		sprintf( buf, "key%d", i );
+		check( ( add_ref( &b, buf )==BIBL_OK ), "add_ref() should succeed" );
+	}
+
+	check( ( bibl_index_init( &index, &b )==BIBL_OK ), "bibl_index_init() should succeed" );
+
+	for ( i=0; i<nkeys; ++i ) {
+		if ( !keys[i] ) continue;
+		check( ( bibl_index_find( &index, keys[i] )==bibl_findref( &b, keys[i] ) ), "index should match bibl_findref()" );
+	}
+	check( ( bibl_index_find( &index, "smith2000" )==0 ), "first duplicate citekey should win" );
+	check( ( bibl_index_find( &index, "Smith2000" )==4 ), "citekeys should be case-sensitive" );
+	check( ( bibl_index_find( &index, "missing" )==-1 ), "missing citekey should not be found" );
+	for ( i=0; i<2000; ++i ) {
+		sprintf( buf, "key%d", i );
+		check( ( bibl_index_find( &index, buf )==nkeys + i ), "every citekey should be found" );
+	}
+
+	bibl_index_free( &index );
+	bibl_free( &b );
+
+	return 0;
+}
+
+int
+main( int argc, char *argv[] )
+{
+	int failed = 0;
+
+	failed += test_index();
+
+	if ( !failed ) {
+		printf( "%s: PASSED\n", progname );
+		return EXIT_SUCCESS;
+	} else {
+		printf( "%s: FAILED\n", progname );
+		return EXIT_FAILURE;
+	}
+}
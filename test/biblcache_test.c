@@ -0,0 +1,195 @@
+/*
+ * biblcache_test.c
+ *
+ * Copyright (c) 2021
+ *
+ * Source code released under the GPL version 2
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bibdefs.h"
+#include "bibl.h"
+#include "biblcache.h"
+
+char progname[] = "biblcache_test";
+char version[] = "0.1";
+
+#define check( a, b ) { \
+	if ( !(a) ) { \
+		fprintf( stderr, "Failed %s (%s) in %s() line %d\n", #a, b, __FUNCTION__, __LINE__ );\
+		return 1; \
+	} \
+}
+
+static int
+build_bibl( bibl *b )
+{
+	char buf[64];
+	fields *ref;
+	int i;
+
+	for ( i=0; i<50; ++i ) {
+		ref = fields_new();
+		if ( !ref ) return BIBL_ERR_MEMERR;
+		if ( i!=10 ) {
+			sprintf( buf, "ref%d", i );
+			fields_add( ref, "REFNUM", buf, LEVEL_MAIN );
+			fields_add( ref, "TITLE", "The same title", LEVEL_MAIN );
+			fields_add_can_dup( ref, "AUTHOR", "Smith|John", LEVEL_MAIN );
+			fields_add_can_dup( ref, "AUTHOR", "Smith|John", LEVEL_MAIN );
+			fields_add( ref, "TITLE", "Journal", LEVEL_HOST );
+			fields_add_lang( ref, "TITLE", "Titre", "fre", LEVEL_ORIG );
+			fields_add( ref, "NOTES", "", LEVEL_SERIES );
+		}
+		if ( bibl_addref( b, ref )!=BIBL_OK ) return BIBL_ERR_MEMERR;
+	}
+
+	return BIBL_OK;
+}
+
+static int
+same_fields( fields *a, fields *b )
+{
+	fields_entry *ea, *eb;
+	int i;
+
+	if ( a->n!=b->n ) return 0;
+	for ( i=0; i<a->n; ++i ) {
+		ea = a->entries[i];
+		eb = b->entries[i];
+		if ( ea->level!=eb->level ) return 0;
+		if ( str_strcmp( &(ea->tag), &(eb->tag) ) ) return 0;
+		if ( str_strcmp( &(ea->value), &(eb->value) ) ) return 0;
+		if ( str_strcmp( &(ea->language), &(eb->language) ) ) return 0;
+	}
+
+	return 1;
+}
+
+int
+test_roundtrip( void )
+{
+	bibl b, c;
+	FILE *fp;
+	long i;
+
+	bibl_init( &b );
+	bibl_init( &c );
+	check( ( build_bibl( &b )==BIBL_OK ), "building references should succeed" );
+
+	fp = tmpfile();
+	check( ( fp!=NULL ), "tmpfile() should succeed" );
+	check( ( bibl_save( &b, fp )==BIBL_OK ), "bibl_save() should succeed" );
+
+	rewind( fp );
+	check( bibl_issaved( fp ), "bibl_issaved() should recognize the file" );
+	check( ( bibl_load( &c, fp )==BIBL_OK ), "bibl_load() should succeed" );
+
+	/* bibl_load() appends */
+	rewind( fp );
+	check( ( bibl_load( &c, fp )==BIBL_OK ), "second bibl_load() should succeed" );
+	fclose( fp );
+
+	check( ( c.n==2*b.n ), "bibl_load() should append every reference" );
+	for ( i=0; i<c.n; ++i )
+		check( same_fields( b.ref[i%b.n], c.ref[i] ), "loaded fields should match" );
+
+	bibl_free( &b );
+	bibl_free( &c );
+
+	return 0;
+}
+
+int
+test_empty( void )
+{
+	bibl b, c;
+	FILE *fp;
+
+	bibl_init( &b );
+	bibl_init( &c );
+
+	fp = tmpfile();
+	check( ( fp!=NULL ), "tmpfile() should succeed" );
+	check( ( bibl_save( &b, fp )==BIBL_OK ), "bibl_save() of nothing should succeed" );
+	rewind( fp );
+	check( ( bibl_load( &c, fp )==BIBL_OK && c.n==0 ), "bibl_load() of nothing should succeed" );
+	fclose( fp );
+
+	return 0;
+}
+
+int
+test_damaged( void )
+{
+	unsigned char *buf;
+	long len, i;
+	int status;
+	bibl b;
+	FILE *fp;
+
+	bibl_init( &b );
+	check( ( build_bibl( &b )==BIBL_OK ), "building references should succeed" );
+	fp = tmpfile();
+	check( ( fp!=NULL ), "tmpfile() should succeed" );
+	check( ( bibl_save( &b, fp )==BIBL_OK ), "bibl_save() should succeed" );
+	bibl_free( &b );
+
+	len = ftell( fp );
+	buf = ( unsigned char * ) malloc( len );
+	check( ( buf!=NULL ), "malloc() should succeed" );
+	rewind( fp );
+	check( ( fread( buf, 1, len, fp )==len ), "fread() should succeed" );
+	fclose( fp );
+
+	/* every truncation and every flipped byte must be refused or load cleanly */
+	for ( i=0; i<len; ++i ) {
+		fp = tmpfile();
+		fwrite( buf, 1, i, fp );
+		rewind( fp );
+		bibl_init( &b );
+		check( ( bibl_load( &b, fp )==BIBL_ERR_BADINPUT && b.n==0 ), "truncated file should be refused" );
+		fclose( fp );
+	}
+	for ( i=0; i<len; ++i ) {
+		fp = tmpfile();
+		buf[i] ^= 0x81;
+		fwrite( buf, 1, len, fp );
+		buf[i] ^= 0x81;
+		rewind( fp );
+		bibl_init( &b );
+		status = bibl_load( &b, fp );
+		check( ( status==BIBL_OK || ( status==BIBL_ERR_BADINPUT && b.n==0 ) ), "damaged file should be refused" );
+		bibl_free( &b );
+		fclose( fp );
+	}
+
+	fp = tmpfile();
+	fputs( "@article{key, title={Not saved}}\n", fp );
+	rewind( fp );
+	check( !bibl_issaved( fp ), "bibl_issaved() should not accept other files" );
+	fclose( fp );
+
+	free( buf );
+
+	return 0;
+}
+
+int
+main( int argc, char *argv[] )
+{
+	int failed = 0;
+
+	failed += test_roundtrip();
+	failed += test_empty();
+	failed += test_damaged();
+
+	if ( !failed ) {
+		printf( "%s: PASSED\n", progname );
+		return EXIT_SUCCESS;
+	} else {
+		printf( "%s: FAILED\n", progname );
+		return EXIT_FAILURE;
+	}
+}
@@ -0,0 +1,405 @@
+/*
+ * biblinc_test.c
+ *
+ * Copyright (c) 2021
+ *
+ * Source code released under the GPL version 2
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bibutils.h"
+
+char progname[] = "biblinc_test";
+char version[] = "0.1";
+
+#define check( a, b ) { \
+	if ( !(a) ) { \
+		fprintf( stderr, "Failed %s (%s) in %s() line %d\n", #a, b, __FUNCTION__, __LINE__ );\
+		return 1; \
+	} \
+}
+
+/* duplicate citekeys and @STRINGs */
+static const char bib[] =
+	"@string{ jt = \"Journal of Tests\" }\n"
+	"@article{smith,\n"
+	"  author = {Smith, John},\n"
+	"  title = {The first title},\n"
+	"  journal = jt,\n"
+	"  year = 2001\n"
+	"}\n"
+	"@book{muller,\n"
+	"  author = {M{\\\"u}ller, Hans},\n"
+	"  title = {A second title},\n"
+	"  year = 1999\n"
+	"}\n"
+	"@misc{smith,\n"
+	"  title = {No author}\n"
+	"}\n"
+	"@string{ other = \"Other Journal\" }\n"
+	"@article{smith,\n"
+	"  author = {Doe, Jane},\n"
+	"  title = {The third title},\n"
+	"  journal = other,\n"
+	"  year = 2010\n"
+	"}\n";
+
+/* references without citekeys, given them by author and year or
+ * by position */
+static const char ris[] =
+	"TY  - JOUR\n"
+	"AU  - Smith, John\n"
+	"TI  - The first title\n"
+	"PY  - 2001\n"
+	"ER  - \n"
+	"TY  - BOOK\n"
+	"TI  - No author\n"
+	"ER  - \n"
+	"TY  - JOUR\n"
+	"AU  - Smith, John\n"
+	"TI  - The second title\n"
+	"PY  - 2001\n"
+	"ER  - \n";
+
+static const char med[] =
+	"<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+	"<PubmedArticleSet>\n"
+	"<PubmedArticle><MedlineCitation><PMID>1001</PMID><Article>\n"
+	"<Journal><Title>J Test</Title><JournalIssue><PubDate><Year>2001</Year></PubDate></JournalIssue></Journal>\n"
+	"<AuthorList><Author><LastName>Smith</LastName></Author></AuthorList><ArticleTitle>The first title</ArticleTitle>\n"
+	"</Article></MedlineCitation></PubmedArticle>\n"
+	"<PubmedArticle><MedlineCitation><PMID>1002</PMID><Article>\n"
+	"<Journal><Title>J Test</Title><JournalIssue><PubDate><Year>2001</Year></PubDate></JournalIssue></Journal>\n"
+	"<AuthorList><Author><LastName>Smith</LastName></Author></AuthorList><ArticleTitle>M\xc3\xbcller's second title</ArticleTitle>\n"
+	"</Article></MedlineCitation></PubmedArticle>\n"
+	"</PubmedArticleSet>\n";
+
+/* full()
+ *
+ * Convert the inputs as the programs do without --incremental.
+ */
+static int
+full( int n, const char *bufs[], param *p, str *out )
+{
+	char *names[] = { "a", "b", "c" };
+	int k, status = BIBL_OK;
+	bibl b;
+
+	bibl_init( &b );
+	str_empty( out );
+	for ( k=0; k<n && status==BIBL_OK; ++k )
+		status = bibl_read_mem( &b, bufs[k], strlen( bufs[k] ), names[k], p );
+	if ( status==BIBL_OK ) status = bibl_write_mem( &b, out, p );
+	bibl_free( &b );
+
+	return status;
+}
+
+/* incremental()
+ *
+ * Convert the inputs with the cache c from the last run, replacing it
+ * with the cache for the next one, as saved and loaded again.
+ */
+static int
+incremental( int n, const char *bufs[], param *p, biblinc *c, str *out, long *nreused )
+{
+	char *names[] = { "a", "b", "c" };
+	unsigned long lens[3];
+	long nrefs, len;
+	biblinc next;
+	char *data;
+	FILE *fp;
+	int k, status;
+
+	for ( k=0; k<n; ++k )
+		lens[k] = strlen( bufs[k] );
+
+	biblinc_init( &next );
+	fp = tmpfile();
+	if ( !fp ) return BIBL_ERR_CANTOPEN;
+
+	status = bibl_convertinc( n, bufs, lens, names, fp, c, &next, p, &nrefs, nreused );
+
+	str_empty( out );
+	len = ftell( fp );
+	rewind( fp );
+	data = ( char * ) malloc( len + 1 );
+	if ( data && fread( data, 1, len, fp )==len ) {
+		data[len] = '\0';
+		str_strcpyc( out, data );
+	} else status = BIBL_ERR_MEMERR;
+	if ( data ) free( data );
+	fclose( fp );
+
+	fp = tmpfile();
+	if ( !fp ) return BIBL_ERR_CANTOPEN;
+	if ( status==BIBL_OK ) status = biblinc_save( &next, fp );
+	rewind( fp );
+	if ( status==BIBL_OK ) status = biblinc_load( c, fp );
+	fclose( fp );
+	biblinc_free( &next );
+
+	return status;
+}
+
+/* run()
+ *
+ * An incremental run should write what a full one does.
+ */
+static int
+run( int n, const char *bufs[], param *p, biblinc *c, long *nreused )
+{
+	str a, b;
+	int ok;
+
+	strs_init( &a, &b, NULL );
+	ok = ( full( n, bufs, p, &a )==BIBL_OK &&
+	       incremental( n, bufs, p, c, &b, nreused )==BIBL_OK &&
+	       a.len && !strcmp( str_cstr( &a ), str_cstr( &b ) ) );
+	strs_free( &a, &b, NULL );
+
+	return ok;
+}
+
+static char *
+replace( const char *s, const char *from, const char *to )
+{
+	const char *q = strstr( s, from );
+	char *out;
+
+	out = ( char * ) malloc( strlen( s ) + strlen( to ) + 1 );
+	if ( !out || !q ) return out;
+	memcpy( out, s, q - s );
+	strcpy( out + ( q - s ), to );
+	strcat( out, q + strlen( from ) );
+
+	return out;
+}
+
+int
+test_rerun( void )
+{
+	const char *in[1] = { bib };
+	long nreused;
+	biblinc c;
+	param p;
+
+	biblinc_init( &c );
+	bibl_initparams( &p, BIBL_BIBTEXIN, BIBL_BIBTEXOUT, progname );
+
+	check( run( 1, in, &p, &c, &nreused ), "the first run should match a full one" );
+	check( ( nreused==0 ), "the first run has nothing to reuse" );
+	check( ( c.n==4 ), "every reference should be cached" );
+
+	check( run( 1, in, &p, &c, &nreused ), "a rerun should match a full one" );
+	check( ( nreused==4 ), "a rerun should reuse every reference" );
+
+	bibl_freeparams( &p );
+	biblinc_free( &c );
+
+	return 0;
+}
+
+int
+test_changes( void )
+{
+	const char *in[1];
+	char *edited, *inserted, *string;
+	long nreused;
+	biblinc c;
+	param p;
+
+	edited   = replace( bib, "The third title", "The changed title" );
+	inserted = replace( bib, "@article{smith,\n  author = {Smith",
+			"@misc{smith, title = {Inserted}}\n@article{smith,\n  author = {Smith" );
+	string   = replace( bib, "Other Journal", "Another Journal" );
+	check( ( edited && inserted && string ), "replace() should succeed" );
+
+	biblinc_init( &c );
+	bibl_initparams( &p, BIBL_BIBTEXIN, BIBL_BIBTEXOUT, progname );
+
+	in[0] = bib;
+	check( run( 1, in, &p, &c, &nreused ), "the first run should match a full one" );
+
+	in[0] = edited;
+	check( run( 1, in, &p, &c, &nreused ), "a changed reference should match a full run" );
+	check( ( nreused==3 ), "only the changed reference should be converted" );
+
+	/* every smith moves on a letter */
+	in[0] = inserted;
+	check( run( 1, in, &p, &c, &nreused ), "an inserted duplicate should match a full run" );
+	check( ( nreused==3 ), "references whose citekeys change should be reused" );
+	check( ( c.n==5 ), "every reference should be cached" );
+
+	in[0] = string;
+	check( run( 1, in, &p, &c, &nreused ), "a changed @string should match a full run" );
+	check( ( nreused==3 ), "only references after the @string should be converted" );
+
+	p.addcount = 1;
+	check( run( 1, in, &p, &c, &nreused ), "a run with other settings should match a full one" );
+	check( ( nreused==0 ), "a cache made with other settings should not be used" );
+	check( run( 1, in, &p, &c, &nreused ), "a rerun with addcount should match a full one" );
+	check( ( nreused==4 ), "a rerun with addcount should reuse every reference" );
+
+	bibl_freeparams( &p );
+	biblinc_free( &c );
+	free( edited );
+	free( inserted );
+	free( string );
+
+	return 0;
+}
+
+int
+test_positions( void )
+{
+	const char *in[1] = { ris };
+	char *inserted;
+	long nreused;
+	biblinc c;
+	param p;
+
+	inserted = replace( ris, "TY  - BOOK", "TY  - JOUR\nTI  - Inserted\nER  - \nTY  - BOOK" );
+	check( ( inserted!=NULL ), "replace() should succeed" );
+
+	biblinc_init( &c );
+	bibl_initparams( &p, BIBL_RISIN, BIBL_BIBTEXOUT, progname );
+
+	check( run( 1, in, &p, &c, &nreused ), "the first run should match a full one" );
+	check( run( 1, in, &p, &c, &nreused ), "a rerun should match a full one" );
+	check( ( nreused==3 ), "a rerun should reuse every reference" );
+
+	/* "ref2" becomes "ref3" */
+	in[0] = inserted;
+	check( run( 1, in, &p, &c, &nreused ), "an inserted reference should match a full run" );
+	check( ( nreused==3 ), "references whose citekeys change should be reused" );
+
+	bibl_freeparams( &p );
+	biblinc_free( &c );
+	free( inserted );
+
+	return 0;
+}
+
+/* a second input continues the citekeys and positions of the first */
+int
+test_multiple( void )
+{
+	const char *in[2] = { bib, bib };
+	long nreused;
+	biblinc c;
+	param p;
+
+	biblinc_init( &c );
+	bibl_initparams( &p, BIBL_BIBTEXIN, BIBL_MODSOUT, progname );
+	p.addcount = 1;
+
+	check( run( 2, in, &p, &c, &nreused ), "the first run should match a full one" );
+	check( run( 2, in, &p, &c, &nreused ), "a rerun should match a full one" );
+	check( ( nreused==8 ), "a rerun should reuse every reference" );
+
+	bibl_freeparams( &p );
+	bibl_initparams( &p, BIBL_MEDLINEIN, BIBL_RISOUT, progname );
+	in[0] = in[1] = med;
+	check( run( 2, in, &p, &c, &nreused ), "raw input should match a full run" );
+	check( ( nreused==0 ), "the cache was made with other settings" );
+	check( run( 2, in, &p, &c, &nreused ), "a rerun of raw input should match a full one" );
+	check( ( nreused==4 ), "a rerun of raw input should reuse every reference" );
+
+	bibl_freeparams( &p );
+	biblinc_free( &c );
+
+	return 0;
+}
+
+/* crossrefs join references, so are converted in full */
+int
+test_crossref( void )
+{
+	const char *in[1];
+	char *crossed;
+	long nreused;
+	biblinc c;
+	param p;
+
+	crossed = replace( bib, "title = {No author}", "title = {No author}, crossref = {smith}" );
+	check( ( crossed!=NULL ), "replace() should succeed" );
+	in[0] = crossed;
+
+	biblinc_init( &c );
+	bibl_initparams( &p, BIBL_BIBTEXIN, BIBL_RISOUT, progname );
+
+	check( run( 1, in, &p, &c, &nreused ), "a crossref should match a full run" );
+	check( run( 1, in, &p, &c, &nreused ), "a crossref rerun should match a full run" );
+	check( ( nreused==0 && c.n==0 ), "input with a crossref should not be cached" );
+
+	bibl_freeparams( &p );
+	biblinc_free( &c );
+	free( crossed );
+
+	return 0;
+}
+
+int
+test_load( void )
+{
+	const char *in[1] = { bib };
+	unsigned char *buf;
+	long nreused, i, len;
+	biblinc c;
+	param p;
+	FILE *fp;
+
+	biblinc_init( &c );
+	bibl_initparams( &p, BIBL_BIBTEXIN, BIBL_MODSOUT, progname );
+	check( run( 1, in, &p, &c, &nreused ), "the first run should match a full one" );
+	bibl_freeparams( &p );
+
+	fp = tmpfile();
+	check( ( fp!=NULL ), "tmpfile() should succeed" );
+	check( ( biblinc_save( &c, fp )==BIBL_OK ), "biblinc_save() should succeed" );
+	len = ftell( fp );
+	buf = ( unsigned char * ) malloc( len );
+	check( ( buf!=NULL ), "malloc() should succeed" );
+	rewind( fp );
+	check( ( fread( buf, 1, len, fp )==len ), "the cache should read back" );
+	fclose( fp );
+
+	/* every truncation is refused */
+	for ( i=0; i<len; ++i ) {
+		fp = tmpfile();
+		check( ( fp!=NULL ), "tmpfile() should succeed" );
+		if ( i ) fwrite( buf, 1, i, fp );
+		rewind( fp );
+		check( ( biblinc_load( &c, fp )==BIBL_ERR_BADINPUT ), "a truncated cache should be refused" );
+		check( ( c.n==0 ), "a refused cache should be left empty" );
+		fclose( fp );
+	}
+
+	free( buf );
+	biblinc_free( &c );
+
+	return 0;
+}
+
+int
+main( int argc, char *argv[] )
+{
+	int failed = 0;
+
+	failed += test_rerun();
+	failed += test_changes();
+	failed += test_positions();
+	failed += test_multiple();
+	failed += test_crossref();
+	failed += test_load();
+
+	if ( !failed ) {
+		printf( "%s: PASSED\n", progname );
+		return EXIT_SUCCESS;
+	} else {
+		printf( "%s: FAILED\n", progname );
+		return EXIT_FAILURE;
+	}
+}
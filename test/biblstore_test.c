@@ -0,0 +1,240 @@
+/*
+ * biblstore_test.c
+ *
+ * Copyright (c) 2021
+ *
+ * Source code released under the GPL version 2
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bibutils.h"
+#include "bibformats.h"
+
+char progname[] = "biblstore_test";
+char version[] = "0.1";
+
+#define check( a, b ) { \
+	if ( !(a) ) { \
+		fprintf( stderr, "Failed %s (%s) in %s() line %d\n", #a, b, __FUNCTION__, __LINE__ );\
+		return 1; \
+	} \
+}
+
+/* entry n of f is tag=value at level, in language lang ("" for none) */
+static int
+has_entry( fields *f, int n, const char *tag, const char *value, const char *lang, int level )
+{
+	if ( n >= f->n ) return 0;
+	if ( fields_level( f, n )!=level ) return 0;
+	if ( strcmp( fields_tag( f, n, FIELDS_CHRP_NOUSE ), tag ) ) return 0;
+	if ( strcmp( fields_value( f, n, FIELDS_CHRP_NOUSE ), value ) ) return 0;
+	if ( f->entries[n]->language.len==0 ) return ( lang[0]=='\0' );
+	return !strcmp( str_cstr( &(f->entries[n]->language) ), lang );
+}
+
+/* levels at the ends of the signed char column, empty values and
+ * references, and repeated tags and languages
+ */
+int
+test_addget( void )
+{
+	fields ref, out;
+	biblstore s;
+
+	biblstore_init( &s );
+	fields_init( &ref );
+	fields_init( &out );
+
+	fields_add( &ref, "TITLE", "Lowest", -128 );
+	fields_add( &ref, "TITLE", "Highest", 127 );
+	fields_add( &ref, "NOTES", "", LEVEL_MAIN );
+	fields_add_lang( &ref, "TITLE", "Titre", "fre", LEVEL_ORIG );
+	fields_add_lang( &ref, "ABSTRACT", "Resume", "fre", LEVEL_MAIN );
+	check( ( biblstore_addref( &s, &ref )==BIBL_OK ), "biblstore_addref() should succeed" );
+
+	fields_empty( &ref );
+	check( ( biblstore_addref( &s, &ref )==BIBL_OK ), "an empty reference should be stored" );
+
+	fields_add_can_dup( &ref, "AUTHOR", "Smith|John", LEVEL_MAIN );
+	fields_add_can_dup( &ref, "AUTHOR", "Smith|John", LEVEL_MAIN );
+	check( ( biblstore_addref( &s, &ref )==BIBL_OK ), "biblstore_addref() should succeed" );
+
+	check( ( s.n==3 && s.nfields==7 ), "store should hold three references and seven fields" );
+
+	check( ( biblstore_getref( &s, 0, &out )==BIBL_OK ), "biblstore_getref() should succeed" );
+	check( ( out.n==5 ), "first reference should have five fields" );
+	check( has_entry( &out, 0, "TITLE", "Lowest", "", -128 ), "level -128 should survive" );
+	check( has_entry( &out, 1, "TITLE", "Highest", "", 127 ), "level 127 should survive" );
+	check( has_entry( &out, 2, "NOTES", "", "", LEVEL_MAIN ), "an empty value should survive" );
+	check( has_entry( &out, 3, "TITLE", "Titre", "fre", LEVEL_ORIG ), "the language should survive" );
+	check( has_entry( &out, 4, "ABSTRACT", "Resume", "fre", LEVEL_MAIN ), "the language should survive" );
+
+	check( ( biblstore_getref( &s, 1, &out )==BIBL_OK && out.n==0 ), "the empty reference should come back empty" );
+
+	check( ( biblstore_getref( &s, 2, &out )==BIBL_OK && out.n==2 ), "repeated fields should be kept" );
+	check( has_entry( &out, 1, "AUTHOR", "Smith|John", "", LEVEL_MAIN ), "repeated fields should match" );
+
+	check( ( biblstore_getref( &s, s.n, &out )==BIBL_ERR_BADINPUT ), "out of range reference should fail" );
+	check( ( biblstore_getref( &s, -1, &out )==BIBL_ERR_BADINPUT ), "negative reference should fail" );
+
+	/* tags and languages are interned once */
+	check( ( s.names.names.n==5 ), "store should hold four tags and one language" );
+
+	fields_free( &ref );
+	fields_free( &out );
+	biblstore_free( &s );
+
+	return 0;
+}
+
+/* a reference the store cannot hold is refused whole, and the
+ * references before and after it are unaffected
+ */
+int
+test_badlevel( void )
+{
+	unsigned long nfields;
+	fields ref, out;
+	biblstore s;
+
+	biblstore_init( &s );
+	fields_init( &ref );
+	fields_init( &out );
+
+	fields_add( &ref, "TITLE", "Kept", LEVEL_MAIN );
+	check( ( biblstore_addref( &s, &ref )==BIBL_OK ), "biblstore_addref() should succeed" );
+	nfields = s.nfields;
+
+	fields_add( &ref, "TITLE", "Too deep", 128 );
+	check( ( biblstore_addref( &s, &ref )==BIBL_ERR_BADINPUT ), "level 128 should be refused" );
+	check( ( s.n==1 && s.nfields==nfields ), "a refused reference should not be stored" );
+
+	fields_empty( &ref );
+	fields_add( &ref, "TITLE", "Kept", LEVEL_MAIN );
+	fields_add( &ref, "TITLE", "Too shallow", -129 );
+	check( ( biblstore_addref( &s, &ref )==BIBL_ERR_BADINPUT ), "level -129 should be refused" );
+	check( ( s.n==1 && s.nfields==nfields ), "a refused reference should not be stored" );
+
+	fields_empty( &ref );
+	fields_add( &ref, "TITLE", "After", LEVEL_HOST );
+	check( ( biblstore_addref( &s, &ref )==BIBL_OK ), "the store should take references after a refusal" );
+	check( ( s.n==2 ), "store should hold two references" );
+
+	check( ( biblstore_getref( &s, 0, &out )==BIBL_OK && out.n==1 ), "biblstore_getref() should succeed" );
+	check( has_entry( &out, 0, "TITLE", "Kept", "", LEVEL_MAIN ), "the first reference should be unchanged" );
+	check( ( biblstore_getref( &s, 1, &out )==BIBL_OK && out.n==1 ), "biblstore_getref() should succeed" );
+	check( has_entry( &out, 0, "TITLE", "After", "", LEVEL_HOST ), "the next reference should follow it" );
+
+	fields_free( &ref );
+	fields_free( &out );
+	biblstore_free( &s );
+
+	return 0;
+}
+
+/* write with bibl_write() or bibl_writestore() and read the result back */
+static int
+write_ris( bibl *b, biblstore *s, str *out )
+{
+	char buf[512];
+	int status;
+	FILE *fp;
+	param p;
+
+	modsin_initparams( &p, progname );
+	risout_initparams( &p, progname );
+
+	fp = tmpfile();
+	if ( !fp ) return BIBL_ERR_CANTOPEN;
+
+	if ( b ) status = bibl_write( b, fp, &p );
+	else status = bibl_writestore( s, fp, &p );
+	bibl_freeparams( &p );
+
+	rewind( fp );
+	str_empty( out );
+	while ( fgets( buf, sizeof( buf ), fp ) )
+		str_strcatc( out, buf );
+	fclose( fp );
+
+	return status;
+}
+
+/* enough articles to grow every column and the heap past their
+ * first allocations
+ */
+static int
+add_journal_refs( bibl *b, long n )
+{
+	char buf[64];
+	fields *ref;
+	long i;
+
+	for ( i=0; i<n; ++i ) {
+		ref = fields_new();
+		if ( !ref ) return BIBL_ERR_MEMERR;
+		sprintf( buf, "art%ld", i );
+		fields_add( ref, "REFNUM", buf, LEVEL_MAIN );
+		sprintf( buf, "Article %ld on the long title of a report", i );
+		fields_add( ref, "TITLE", buf, LEVEL_MAIN );
+		fields_add( ref, "TITLE", "Journal of Stores", LEVEL_HOST );
+		fields_add( ref, "GENRE:MARC", "periodical", LEVEL_HOST );
+		sprintf( buf, "%ld", 1 + i % 40 );
+		fields_add( ref, "VOLUME", buf, LEVEL_MAIN );
+		if ( bibl_addref( b, ref )!=BIBL_OK ) return BIBL_ERR_MEMERR;
+	}
+
+	return BIBL_OK;
+}
+
+int
+test_writestore( void )
+{
+	biblstore s;
+	str a, b2;
+	bibl b, c;
+
+	bibl_init( &b );
+	bibl_init( &c );
+	biblstore_init( &s );
+	strs_init( &a, &b2, NULL );
+
+	check( ( add_journal_refs( &b, 1500 )==BIBL_OK ), "building references should succeed" );
+	check( ( bibl_copy( &c, &b )==BIBL_OK ), "bibl_copy() should succeed" );
+	check( ( biblstore_addbibl( &s, &c )==BIBL_OK ), "biblstore_addbibl() should succeed" );
+	check( ( c.n==0 && s.n==b.n ), "biblstore_addbibl() should move every reference" );
+
+	check( ( write_ris( &b, NULL, &a )==BIBL_OK ), "bibl_write() should succeed" );
+	check( ( write_ris( NULL, &s, &b2 )==BIBL_OK ), "bibl_writestore() should succeed" );
+	check( ( a.len>0 && !strcmp( str_cstr( &a ), str_cstr( &b2 ) ) ), "bibl_writestore() should match bibl_write()" );
+
+	/* the store is not changed by writing */
+	check( ( write_ris( NULL, &s, &b2 )==BIBL_OK ), "second bibl_writestore() should succeed" );
+	check( ( !strcmp( str_cstr( &a ), str_cstr( &b2 ) ) ), "second bibl_writestore() should match" );
+
+	strs_free( &a, &b2, NULL );
+	biblstore_free( &s );
+	bibl_free( &b );
+	bibl_free( &c );
+
+	return 0;
+}
+
+int
+main( int argc, char *argv[] )
+{
+	int failed = 0;
+
+	failed += test_addget();
+	failed += test_badlevel();
+	failed += test_writestore();
+
+	if ( !failed ) {
+		printf( "%s: PASSED\n", progname );
+		return EXIT_SUCCESS;
+	} else {
+		printf( "%s: FAILED\n", progname );
+		return EXIT_FAILURE;
+	}
+}
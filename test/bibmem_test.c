@@ -0,0 +1,495 @@
+/*
+ * bibmem_test.c
+ *
+ * Copyright (c) 2021
+ *
+ * Source code released under the GPL version 2
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bibutils.h"
+#include "bibformats.h"
+
+char progname[] = "bibmem_test";
+char version[] = "0.1";
+
+#define check( a, b ) { \
+	if ( !(a) ) { \
+		fprintf( stderr, "Failed %s (%s) in %s() line %d\n", #a, b, __FUNCTION__, __LINE__ );\
+		return 1; \
+	} \
+}
+
+static const char *inputs[] = {
+	"",
+	"one line",
+	"one line\n",
+	"a\nb\n\nc",
+	"a\r\nb\r\n\r\nc\r\n",
+	"a\rb\r\rc",
+	"a\n\rb",
+	"\n\n\n",
+	"TY  - JOUR\nAU  - Smith, John\nTI  - A title that is long enough to be longer than the two hundred and fifty six bytes of buffer that bibl_read() hands to the readers, so that the line has to be put together from more than one fgets() when it is read from a file rather than from memory\nER  - \n",
+};
+
+static FILE *
+tmpfile_with( const char *data, unsigned long len )
+{
+	FILE *fp = tmpfile();
+	if ( !fp ) return NULL;
+	if ( len ) fwrite( data, 1, len, fp );
+	rewind( fp );
+	return fp;
+}
+
+/* memory sources should split lines as str_fget() does for files */
+int
+test_source_fget( void )
+{
+	int i, bufpos, rf, rm;
+	char buf[256];
+	str lf, lm;
+	source sf, sm;
+	FILE *fp;
+
+	strs_init( &lf, &lm, NULL );
+
+	for ( i=0; i<sizeof(inputs)/sizeof(inputs[0]); ++i ) {
+
+		fp = tmpfile_with( inputs[i], strlen( inputs[i] ) );
+		check( ( fp!=NULL ), "tmpfile() should succeed" );
+
+		source_init( &sf, fp );
+		source_init_mem( &sm, inputs[i], strlen( inputs[i] ) );
+
+		buf[0] = '\0';
+		bufpos = 0;
+		do {
+			rf = source_fget( &sf, buf, sizeof( buf ), &bufpos, &lf );
+			rm = source_fget( &sm, NULL, 0, NULL, &lm );
+			check( ( rf==rm ), "memory and file sources should end together" );
+			check( ( !rf || !strcmp( str_cstr( &lf ), str_cstr( &lm ) ) ), "memory and file lines should match" );
+		} while ( rf );
+
+		fclose( fp );
+	}
+
+	strs_free( &lf, &lm, NULL );
+
+	return 0;
+}
+
+/* source_gets() and source_eof() should follow fgets() and feof() */
+int
+test_source_gets( void )
+{
+	char bf[8], bm[8];
+	char *rf, *rm;
+	source sm;
+	FILE *fp;
+	int i;
+
+	for ( i=0; i<sizeof(inputs)/sizeof(inputs[0]); ++i ) {
+
+		fp = tmpfile_with( inputs[i], strlen( inputs[i] ) );
+		check( ( fp!=NULL ), "tmpfile() should succeed" );
+
+		source_init_mem( &sm, inputs[i], strlen( inputs[i] ) );
+
+		strcpy( bf, "x" );
+		strcpy( bm, "x" );
+		do {
+			check( ( !feof( fp )==!source_eof( &sm ) ), "source_eof() should match feof()" );
+			rf = fgets( bf, sizeof( bf ), fp );
+			rm = source_gets( &sm, bm, sizeof( bm ) );
+			check( ( !rf==!rm ), "source_gets() should end with fgets()" );
+			check( ( !strcmp( bf, bm ) ), "source_gets() should fill buf as fgets() does" );
+		} while ( rf );
+		check( ( !feof( fp )==!source_eof( &sm ) ), "source_eof() should match feof() at the end" );
+
+		fclose( fp );
+	}
+
+	return 0;
+}
+
+/* windowed file sources should hand out the lines and offsets of
+ * memory, across refills and with lines longer than the window */
+static char *
+make_long( unsigned long *len )
+{
+	static const char *ends[] = { "\r\n", "\n", "\r", "\n\r" };
+	unsigned long n = 0, max = 4 * SOURCE_WINDOW;
+	char *p;
+	int i;
+
+	p = ( char * ) malloc( max + 1 );
+	if ( !p ) return NULL;
+
+	for ( i=0; n + 64 < SOURCE_WINDOW * 3 / 2; ++i )
+		n += sprintf( p + n, "line %d%s", i, ends[ i % 4 ] );
+	while ( n < SOURCE_WINDOW * 3 ) p[n++] = 'x';
+	n += sprintf( p + n, "\r\nlast" );
+
+	*len = n;
+	return p;
+}
+
+int
+test_source_file( void )
+{
+	unsigned long len;
+	char bf[300], bm[300];
+	char *data, *rf, *rm;
+	int gf, gm;
+	source sf, sm;
+	str lf, lm;
+	FILE *fp;
+
+	strs_init( &lf, &lm, NULL );
+
+	data = make_long( &len );
+	check( ( data!=NULL ), "make_long() should succeed" );
+	fp = tmpfile_with( data, len );
+	check( ( fp!=NULL ), "tmpfile() should succeed" );
+
+	source_init_file( &sf, fp );
+	source_init_mem( &sm, data, len );
+	do {
+		gf = source_fget( &sf, NULL, 0, NULL, &lf );
+		gm = source_fget( &sm, NULL, 0, NULL, &lm );
+		check( ( gf==gm ), "windowed and memory sources should end together" );
+		check( ( !gf || !strcmp( str_cstr( &lf ), str_cstr( &lm ) ) ), "windowed and memory lines should match" );
+		check( ( source_tell( &sf, &lf )==source_tell( &sm, &lm ) ), "windowed and memory offsets should match" );
+	} while ( gf );
+	check( ( source_status( &sf )==SOURCE_OK ), "windowed source should read without error" );
+	source_free( &sf );
+
+	rewind( fp );
+	source_init_file( &sf, fp );
+	source_init_mem( &sm, data, len );
+	do {
+		rf = source_gets( &sf, bf, sizeof( bf ) );
+		rm = source_gets( &sm, bm, sizeof( bm ) );
+		check( ( !rf==!rm ), "windowed source_gets() should end with memory" );
+		check( ( !rf || !strcmp( bf, bm ) ), "windowed source_gets() should match memory" );
+		check( ( !source_eof( &sf )==!source_eof( &sm ) ), "windowed source_eof() should match memory" );
+	} while ( rf );
+	source_free( &sf );
+
+	fclose( fp );
+	free( data );
+	strs_free( &lf, &lm, NULL );
+
+	return 0;
+}
+
+int
+test_source_readall( void )
+{
+	unsigned long len, got;
+	char *data, *buf;
+	FILE *fp;
+
+	data = make_long( &len );
+	check( ( data!=NULL ), "make_long() should succeed" );
+	fp = tmpfile_with( data, len );
+	check( ( fp!=NULL ), "tmpfile() should succeed" );
+
+	check( ( source_readall( fp, &buf, &got, 0 )==SOURCE_OK ), "source_readall() should succeed" );
+	check( ( got==len && !memcmp( buf, data, len ) && buf[len]=='\0' ), "source_readall() should read all of the file" );
+	free( buf );
+
+	rewind( fp );
+	check( ( source_readall( fp, &buf, &got, len-1 )==SOURCE_ERR_SIZE ), "source_readall() should refuse a file over max" );
+	check( ( buf==NULL && got==0 ), "nothing should be held after an error" );
+
+	rewind( fp );
+	check( ( source_readall( fp, &buf, &got, len )==SOURCE_OK && got==len ), "a file of max bytes should be read" );
+	free( buf );
+	fclose( fp );
+
+	fp = tmpfile_with( "", 0 );
+	check( ( fp!=NULL ), "tmpfile() should succeed" );
+	check( ( source_readall( fp, &buf, &got, 0 )==SOURCE_OK ), "source_readall() of an empty file should succeed" );
+	check( ( got==0 && buf && buf[0]=='\0' ), "an empty file should read as an empty string" );
+	free( buf );
+	fclose( fp );
+
+	free( data );
+
+	return 0;
+}
+
+static const char ris[] =
+	"TY  - JOUR\r\n"
+	"AU  - Smith, John\r\n"
+	"AU  - Doe, Jane\r\n"
+	"TI  - The first title\r\n"
+	"JO  - Journal of Tests\r\n"
+	"PY  - 2001\r\n"
+	"SP  - 12\r\n"
+	"EP  - 19\r\n"
+	"ER  - \r\n"
+	"\r\n"
+	"TY  - BOOK\r\n"
+	"AU  - M\xc3\xbcller, Hans\r\n"
+	"TI  - A second title\r\n"
+	"PB  - Publisher\r\n"
+	"PY  - 1999\r\n"
+	"ER  - ";
+
+static int
+read_file( bibl *b, const char *data, unsigned long len )
+{
+	param p;
+	FILE *fp;
+	int status;
+
+	fp = tmpfile_with( data, len );
+	if ( !fp ) return BIBL_ERR_CANTOPEN;
+
+	bibl_initparams( &p, BIBL_RISIN, BIBL_MODSOUT, progname );
+	status = bibl_read( b, fp, "test.ris", &p );
+	bibl_freeparams( &p );
+	fclose( fp );
+
+	return status;
+}
+
+static int
+read_mem( bibl *b, const char *data, unsigned long len )
+{
+	param p;
+	int status;
+
+	bibl_initparams( &p, BIBL_RISIN, BIBL_MODSOUT, progname );
+	status = bibl_read_mem( b, data, len, "test.ris", &p );
+	bibl_freeparams( &p );
+
+	return status;
+}
+
+static int
+write_file( bibl *b, int nthreads, str *out )
+{
+	char buf[512];
+	int status;
+	param p;
+	FILE *fp;
+
+	fp = tmpfile();
+	if ( !fp ) return BIBL_ERR_CANTOPEN;
+
+	bibl_initparams( &p, BIBL_MODSIN, BIBL_MODSOUT, progname );
+	p.nthreads = nthreads;
+	status = bibl_write( b, fp, &p );
+	bibl_freeparams( &p );
+
+	rewind( fp );
+	str_empty( out );
+	while ( fgets( buf, sizeof( buf ), fp ) )
+		str_strcatc( out, buf );
+	fclose( fp );
+
+	return status;
+}
+
+static int
+write_mem( bibl *b, int nthreads, str *out )
+{
+	int status;
+	param p;
+
+	bibl_initparams( &p, BIBL_MODSIN, BIBL_MODSOUT, progname );
+	p.nthreads = nthreads;
+	str_empty( out );
+	status = bibl_write_mem( b, out, &p );
+	bibl_freeparams( &p );
+
+	return status;
+}
+
+int
+test_read_mem( void )
+{
+	unsigned long len = strlen( ris );
+	bibl bf, bm;
+	str of, om;
+
+	strs_init( &of, &om, NULL );
+	bibl_init( &bf );
+	bibl_init( &bm );
+
+	check( ( read_file( &bf, ris, len )==BIBL_OK ), "bibl_read() should succeed" );
+	check( ( read_mem( &bm, ris, len )==BIBL_OK ), "bibl_read_mem() should succeed" );
+	check( ( bf.n==2 && bm.n==2 ), "both reads should find two references" );
+
+	check( ( write_file( &bf, 0, &of )==BIBL_OK ), "bibl_write() should succeed" );
+	check( ( write_mem( &bm, 0, &om )==BIBL_OK ), "bibl_write_mem() should succeed" );
+	check( ( of.len>0 && !strcmp( str_cstr( &of ), str_cstr( &om ) ) ), "memory and file round trips should match" );
+	check( ( strstr( str_cstr( &om ), "A second title" )!=NULL ), "output should hold the last reference" );
+
+	/* the buffer is not read past len */
+	bibl_free( &bm );
+	bibl_init( &bm );
+	check( ( read_mem( &bm, ris, strstr( ris, "\r\n\r\n" ) - ris )==BIBL_OK ), "bibl_read_mem() of a prefix should succeed" );
+	check( ( bm.n==1 ), "a prefix should hold one reference" );
+
+	check( ( bibl_read_mem( &bm, NULL, 1, NULL, NULL )==BIBL_ERR_BADINPUT ), "bibl_read_mem() should check its arguments" );
+
+	bibl_free( &bf );
+	bibl_free( &bm );
+	strs_free( &of, &om, NULL );
+
+	return 0;
+}
+
+int
+test_write_mem( void )
+{
+	char title[64], refnum[64];
+	str seq, thr, out;
+	fields *ref;
+	param p;
+	bibl b;
+	long i;
+
+	strs_init( &seq, &thr, &out, NULL );
+	bibl_init( &b );
+
+	for ( i=0; i<1000; ++i ) {
+		ref = fields_new();
+		check( ( ref!=NULL ), "fields_new() should succeed" );
+		sprintf( refnum, "ref%ld", i );
+		sprintf( title, "Title number %ld", i );
+		fields_add( ref, "REFNUM", refnum, LEVEL_MAIN );
+		fields_add( ref, "TITLE", title, LEVEL_MAIN );
+		fields_add( ref, "AUTHOR", "Author|Anne", LEVEL_MAIN );
+		check( ( bibl_addref( &b, ref )==BIBL_OK ), "bibl_addref() should succeed" );
+	}
+
+	check( ( write_mem( &b, 0, &seq )==BIBL_OK ), "sequential bibl_write_mem() should succeed" );
+	check( ( write_mem( &b, 4, &thr )==BIBL_OK ), "threaded bibl_write_mem() should succeed" );
+	check( ( !strcmp( str_cstr( &seq ), str_cstr( &thr ) ) ), "threaded output should match" );
+	check( ( write_file( &b, 0, &out )==BIBL_OK ), "bibl_write() should succeed" );
+	check( ( !strcmp( str_cstr( &seq ), str_cstr( &out ) ) ), "memory output should match file output" );
+
+	/* output is appended */
+	str_strcpyc( &out, "<!-- before -->\n" );
+	bibl_initparams( &p, BIBL_MODSIN, BIBL_MODSOUT, progname );
+	check( ( bibl_write_mem( &b, &out, &p )==BIBL_OK ), "bibl_write_mem() should succeed" );
+	check( ( out.len==seq.len+16 && !strncmp( str_cstr( &out ), "<!-- before -->\n", 16 ) ), "bibl_write_mem() should append" );
+	p.singlerefperfile = 1;
+	check( ( bibl_write_mem( &b, &out, &p )==BIBL_ERR_BADINPUT ), "single reference per file output should be refused" );
+	bibl_freeparams( &p );
+
+	bibl_free( &b );
+	strs_free( &seq, &thr, &out, NULL );
+
+	return 0;
+}
+
+/* names parsed in one read must not be reused by a read with other
+ * asis/corps lists */
+static int
+read_asis( bibl *b, const char *asis )
+{
+	int status;
+	param p;
+
+	bibl_initparams( &p, BIBL_RISIN, BIBL_MODSOUT, progname );
+	status = bibl_addtoasis( &p, ( char * ) asis );
+	if ( status==BIBL_OK )
+		status = bibl_read_mem( b, ris, strlen( ris ), "test.ris", &p );
+	bibl_freeparams( &p );
+
+	return status;
+}
+
+int
+test_read_lists( void )
+{
+	bibl b;
+
+	bibl_init( &b );
+	check( ( read_asis( &b, "Smith, John" )==BIBL_OK ), "bibl_read_mem() should succeed" );
+	check( ( fields_find( b.ref[0], "AUTHOR:ASIS", LEVEL_MAIN )!=FIELDS_NOTFOUND ), "listed name should be kept as is" );
+	bibl_free( &b );
+
+	bibl_init( &b );
+	check( ( read_asis( &b, "Nobody Else" )==BIBL_OK ), "bibl_read_mem() should succeed" );
+	check( ( fields_find( b.ref[0], "AUTHOR:ASIS", LEVEL_MAIN )==FIELDS_NOTFOUND ), "name should not be kept as is" );
+	check( ( !strcmp( ( char * ) fields_findv( b.ref[0], LEVEL_MAIN, FIELDS_CHRP, "AUTHOR" ), "Smith|John" ) ), "name should be parsed" );
+	bibl_free( &b );
+
+	return 0;
+}
+
+/* @STRING macros last as long as the param they were read with */
+static const char bibstrings[] = "@STRING{tl = {Macro Title}}\n";
+static const char bibref[] = "@article{key,\n  author = {Smith, John},\n  title = tl,\n  year = 1999\n}\n";
+
+static int
+read_bib( bibl *b, const char *data, param *p )
+{
+	return bibl_read_mem( b, data, strlen( data ), "test.bib", p );
+}
+
+static const char *
+bib_title( bibl *b )
+{
+	if ( b->n < 1 ) return NULL;
+	return ( const char * ) fields_findv( b->ref[b->n-1], LEVEL_MAIN, FIELDS_CHRP, "TITLE" );
+}
+
+int
+test_read_strings( void )
+{
+	param p1, p2;
+	const char *t;
+	bibl b;
+
+	bibl_init( &b );
+	bibl_initparams( &p1, BIBL_BIBTEXIN, BIBL_MODSOUT, progname );
+	bibl_initparams( &p2, BIBL_BIBTEXIN, BIBL_MODSOUT, progname );
+
+	check( ( read_bib( &b, bibstrings, &p1 )==BIBL_OK ), "bibl_read_mem() should succeed" );
+	check( ( read_bib( &b, bibref, &p1 )==BIBL_OK ), "bibl_read_mem() should succeed" );
+	t = bib_title( &b );
+	check( ( t && !strcmp( t, "Macro Title" ) ), "macro should be kept for the next read with the param" );
+
+	check( ( read_bib( &b, bibref, &p2 )==BIBL_OK ), "bibl_read_mem() should succeed" );
+	t = bib_title( &b );
+	check( ( t && strcmp( t, "Macro Title" ) ), "macro should not be seen by another param" );
+
+	bibl_freeparams( &p1 );
+	bibl_freeparams( &p2 );
+	bibl_free( &b );
+
+	return 0;
+}
+
+int
+main( int argc, char *argv[] )
+{
+	int failed = 0;
+
+	failed += test_source_fget();
+	failed += test_source_gets();
+	failed += test_source_file();
+	failed += test_source_readall();
+	failed += test_read_mem();
+	failed += test_write_mem();
+	failed += test_read_lists();
+	failed += test_read_strings();
+
+	if ( !failed ) {
+		printf( "%s: PASSED\n", progname );
+		return EXIT_SUCCESS;
+	} else {
+		printf( "%s: FAILED\n", progname );
+		return EXIT_FAILURE;
+	}
+}
@@ -0,0 +1,199 @@
+/*
+ * bibwrite_test.c
+ *
+ * Copyright (c) 2021
+ *
+ * Source code released under the GPL version 2
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "bibutils.h"
+#include "bibformats.h"
+
+char progname[] = "bibwrite_test";
+char version[] = "0.1";
+
+#define check( a, b ) { \
+	if ( !(a) ) { \
+		fprintf( stderr, "Failed %s (%s) in %s() line %d\n", #a, b, __FUNCTION__, __LINE__ );\
+		return 1; \
+	} \
+}
+
+static int
+build_bibl( bibl *b, long n )
+{
+	char buf[64];
+	fields *ref;
+	long i;
+
+	for ( i=0; i<n; ++i ) {
+		ref = fields_new();
+		if ( !ref ) return BIBL_ERR_MEMERR;
+		sprintf( buf, "ref%ld", i );
+		fields_add( ref, "REFNUM", buf, LEVEL_MAIN );
+		sprintf( buf, "Title number %ld", i );
+		fields_add( ref, "TITLE", buf, LEVEL_MAIN );
+		sprintf( buf, "Author%ld|Anne", i );
+		fields_add( ref, "AUTHOR", buf, LEVEL_MAIN );
+		fields_add( ref, "GENRE:MARC", "periodical", LEVEL_HOST );
+		if ( i%3 ) fields_add( ref, "PAGES:START", "12", LEVEL_MAIN );
+		if ( bibl_addref( b, ref )!=BIBL_OK ) return BIBL_ERR_MEMERR;
+	}
+
+	return BIBL_OK;
+}
+
+static void
+init_params( param *p, int nthreads, int singlerefperfile )
+{
+	modsin_initparams( p, progname );
+	risout_initparams( p, progname );
+	p->nthreads = nthreads;
+	p->singlerefperfile = singlerefperfile;
+}
+
+/* write b with nthreads to a temporary file and read it back into out */
+static int
+write_bibl( bibl *b, int nthreads, str *out )
+{
+	char buf[512];
+	FILE *fp;
+	param p;
+	int status;
+
+	init_params( &p, nthreads, 0 );
+
+	fp = tmpfile();
+	if ( !fp ) return BIBL_ERR_CANTOPEN;
+
+	status = bibl_write( b, fp, &p );
+	bibl_freeparams( &p );
+
+	rewind( fp );
+	str_empty( out );
+	while ( fgets( buf, sizeof( buf ), fp ) )
+		str_strcatc( out, buf );
+	fclose( fp );
+
+	return status;
+}
+
+int
+test_threads( void )
+{
+	long sizes[] = { 0, 1, 63, 64, 65, 1000, 5000 };
+	int i, nthreads[] = { 2, 3, 16 };
+	str seq, thr;
+	int j, status;
+	bibl b;
+
+	strs_init( &seq, &thr, NULL );
+
+	for ( i=0; i<sizeof(sizes)/sizeof(sizes[0]); ++i ) {
+
+		bibl_init( &b );
+		check( ( build_bibl( &b, sizes[i] )==BIBL_OK ), "building references should succeed" );
+
+		status = write_bibl( &b, 0, &seq );
+		check( ( status==BIBL_OK ), "sequential bibl_write() should succeed" );
+		if ( sizes[i] ) check( ( strstr( str_cstr( &seq ), "Title number 0" )!=NULL ), "output should have first reference" );
+
+		for ( j=0; j<sizeof(nthreads)/sizeof(nthreads[0]); ++j ) {
+			status = write_bibl( &b, nthreads[j], &thr );
+			check( ( status==BIBL_OK ), "threaded bibl_write() should succeed" );
+			check( ( seq.len==thr.len ), "threaded output should be the same length" );
+			check( ( seq.len==0 || !strcmp( str_cstr( &seq ), str_cstr( &thr ) ) ), "threaded output should match" );
+		}
+
+		bibl_free( &b );
+	}
+
+	strs_free( &seq, &thr, NULL );
+
+	return 0;
+}
+
+static int
+file_matches( const char *filename, const char *title )
+{
+	char buf[512];
+	int found = 0;
+	FILE *fp;
+
+	fp = fopen( filename, "r" );
+	if ( !fp ) return 0;
+	while ( !found && fgets( buf, sizeof( buf ), fp ) )
+		if ( strstr( buf, title ) ) found = 1;
+	fclose( fp );
+
+	return found;
+}
+
+int
+test_singlerefperfile( void )
+{
+	char dir[] = "/tmp/bibwrite_testXXXXXX", cwd[4096], name[64], title[64];
+	int k, nthreads[] = { 0, 4 };
+	long i, n = 200;
+	param p;
+	bibl b;
+
+	check( ( getcwd( cwd, sizeof( cwd ) )!=NULL ), "getcwd() should succeed" );
+
+	bibl_init( &b );
+	check( ( build_bibl( &b, n )==BIBL_OK ), "building references should succeed" );
+
+	for ( k=0; k<sizeof(nthreads)/sizeof(nthreads[0]); ++k ) {
+
+		check( ( mkdtemp( dir )!=NULL ), "mkdtemp() should succeed" );
+		check( ( chdir( dir )==0 ), "chdir() should succeed" );
+
+		/* a file in the way, then two passes that must not overwrite */
+		fclose( fopen( "ref7.ris", "w" ) );
+		init_params( &p, nthreads[k], 1 );
+		check( ( bibl_write( &b, NULL, &p )==BIBL_OK ), "first single-ref bibl_write() should succeed" );
+		check( ( bibl_write( &b, NULL, &p )==BIBL_OK ), "second single-ref bibl_write() should succeed" );
+		bibl_freeparams( &p );
+
+		for ( i=0; i<n; ++i ) {
+			sprintf( title, "Title number %ld\n", i );
+			sprintf( name, ( i==7 ) ? "ref%ld_1.ris" : "ref%ld.ris", i );
+			check( file_matches( name, title ), "first pass should write ref<n>.ris" );
+			sprintf( name, ( i==7 ) ? "ref%ld_2.ris" : "ref%ld_1.ris", i );
+			check( file_matches( name, title ), "second pass should write ref<n>_1.ris" );
+			unlink( name );
+			sprintf( name, ( i==7 ) ? "ref%ld_1.ris" : "ref%ld.ris", i );
+			unlink( name );
+		}
+		check( ( access( "ref7.ris", F_OK )==0 && !file_matches( "ref7.ris", "Title" ) ), "existing file should be left alone" );
+		unlink( "ref7.ris" );
+
+		check( ( chdir( cwd )==0 ), "chdir() back should succeed" );
+		check( ( rmdir( dir )==0 ), "directory should hold only the expected files" );
+		strcpy( dir, "/tmp/bibwrite_testXXXXXX" );
+	}
+
+	bibl_free( &b );
+
+	return 0;
+}
+
+int
+main( int argc, char *argv[] )
+{
+	int failed = 0;
+
+	failed += test_threads();
+	failed += test_singlerefperfile();
+
+	if ( !failed ) {
+		printf( "%s: PASSED\n", progname );
+		return EXIT_SUCCESS;
+	} else {
+		printf( "%s: FAILED\n", progname );
+		return EXIT_FAILURE;
+	}
+}
@@ -1609,6 +1609,59 @@ test_findv( void )
 	return err;
 }
 
+int
+test_empty( void )
+{
+	char tag[512], value[512];
+	int i, status;
+	fields f;
+
+	fields_init( &f );
+
+	for ( i=0; i<50; ++i ) {
+		sprintf( tag, "TAG%d", i+1 );
+		sprintf( value, "VALUE%d", i+1 );
+		status = fields_add_lang( &f, tag, value, "eng", LEVEL_MAIN );
+		check( status==FIELDS_OK, "fields_add_lang() did not return FIELDS_OK" );
+	}
+	fields_set_used( &f, 0 );
+
+	fields_empty( &f );
+	check_len( &f, 0 );
+	check_entry_empty( &f, 0 );
+	check( ( fields_find( &f, "TAG1", LEVEL_ANY )==FIELDS_NOTFOUND ), "emptied fields should find nothing" );
+
+	/* refill fewer entries than before, reusing the old ones */
+	for ( i=0; i<10; ++i ) {
+		sprintf( tag, "NEW%d", i+1 );
+		sprintf( value, "NEWVALUE%d", i+1 );
+		status = fields_add( &f, tag, value, LEVEL_HOST );
+		check( status==FIELDS_OK, "fields_add() did not return FIELDS_OK" );
+	}
+	check_len( &f, 10 );
+	for ( i=0; i<10; ++i ) {
+		sprintf( tag, "NEW%d", i+1 );
+		sprintf( value, "NEWVALUE%d", i+1 );
+		check_entry( &f, i, tag, value, LEVEL_HOST );
+		check( ( f.entries[i]->language.len==0 ), "reused entry should not keep language" );
+	}
+	check( ( !fields_used( &f, 0 ) ), "reused entry should not keep used flag" );
+
+	/* remove and add again across the spare entries */
+	status = fields_remove( &f, 3 );
+	check( status==FIELDS_OK, "fields_remove() did not return FIELDS_OK" );
+	status = fields_add( &f, "LAST", "LASTVALUE", LEVEL_MAIN );
+	check( status==FIELDS_OK, "fields_add() did not return FIELDS_OK" );
+	check_len( &f, 10 );
+	check_entry( &f, 3, "NEW5", "NEWVALUE5", LEVEL_HOST );
+	check_entry( &f, 9, "LAST", "LASTVALUE", LEVEL_MAIN );
+
+	fields_free( &f );
+	check_len( &f, 0 );
+
+	return 0;
+}
+
 int
 main( int argc, char *argv[] )
 {
@@ -1625,6 +1678,7 @@ main( int argc, char *argv[] )
 	failed += test_replace_or_add();
 
 	failed += test_remove();
+	failed += test_empty();
 
 	failed += test_maxlevel();
 
@@ -0,0 +1,85 @@
+/*
+ * iso639_test.c
+ *
+ * Copyright (c) 2021
+ *
+ * Source code released under the GPL version 2
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "iso639.h"
+
+char progname[] = "iso639_test";
+char version[] = "0.1";
+
+#define check( a, b ) { \
+	if ( !(a) ) { \
+		fprintf( stderr, "Failed %s (%s) in %s() line %d\n", #a, b, __FUNCTION__, __LINE__ );\
+		return 1; \
+	} \
+}
+
+static int
+is( const char *s, const char *expected )
+{
+	if ( !s || !expected ) return ( s==expected );
+	return !strcmp( s, expected );
+}
+
+int
+test_codes( void )
+{
+	check( is( iso639_1_from_code( "fr" ), "French" ), "iso639-1 code" );
+	check( is( iso639_1_from_code( "FR" ), "French" ), "codes should ignore case" );
+	check( is( iso639_1_from_code( "zz" ), NULL ), "unknown iso639-1 code" );
+	check( is( iso639_2_from_code( "fre" ), "French" ), "iso639-2b code" );
+	check( is( iso639_2_from_code( "fra" ), "French" ), "iso639-2t code" );
+	check( is( iso639_3_from_code( "aaa" ), "Ghotuo" ), "first iso639-3 code" );
+	check( is( iso639_3_from_code( "zzj" ), "Zuojiang Zhuang" ), "last iso639-3 code" );
+	check( is( iso639_3_from_code( "q9q" ), NULL ), "unknown iso639-3 code" );
+	return 0;
+}
+
+int
+test_names( void )
+{
+	check( is( iso639_1_from_language( "french" ), "fr" ), "iso639-1 language" );
+	check( is( iso639_1_from_language( "Zulu" ), "zu" ), "last iso639-1 language" );
+	check( is( iso639_1_from_language( "Vulcan" ), NULL ), "unknown iso639-1 language" );
+	check( is( iso639_2_from_language( "french" ), "fre" ), "iso639-2 language" );
+	check( is( iso639_2_from_language( "Vulcan" ), NULL ), "unknown iso639-2 language" );
+	check( is( iso639_3_from_name( "Ghotuo" ), "aaa" ), "iso639-3 name" );
+	check( is( iso639_3_from_name( "ZUOJIANG ZHUANG" ), "zzj" ), "names should ignore case" );
+	return 0;
+}
+
+int
+test_any( void )
+{
+	check( is( iso639_from_code( "en" ), "English" ), "two letter code" );
+	check( is( iso639_from_code( "eng" ), "English" ), "three letter code" );
+	check( is( iso639_from_code( "fre" ), "French" ), "iso639-2b only code" );
+	check( is( iso639_from_code( "engl" ), NULL ), "too long" );
+	check( is( iso639_from_code( "" ), NULL ), "empty" );
+	check( is( iso639_from_code( NULL ), NULL ), "NULL" );
+	return 0;
+}
+
+int
+main( int argc, char *argv[] )
+{
+	int failed = 0;
+
+	failed += test_codes();
+	failed += test_names();
+	failed += test_any();
+
+	if ( !failed ) {
+		printf( "%s: PASSED\n", progname );
+		return EXIT_SUCCESS;
+	} else {
+		printf( "%s: FAILED\n", progname );
+		return EXIT_FAILURE;
+	}
+}
@@ -0,0 +1,91 @@
+/*
+ * latex_test.c
+ *
+ * Copyright (c) 2021
+ *
+ * Source code released under the GPL version 2
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bibdefs.h"
+#include "latex_parse.h"
+
+char progname[] = "latex_test";
+char version[] = "0.1";
+
+typedef struct {
+	const char *in;
+	const char *out;
+} test_t;
+
+int
+test_latex_parse( void )
+{
+	test_t tests[] = {
+		{ "A study of {X}-ray emission", "A study of X-ray emission" },
+		{ "{\\it Chandra} observations", "Chandra observations" },
+		{ "\\textit{Italic} text", "Italic text" },
+		{ "The $\\sin x$ and $\\mathrm{d}x$", "The x and dx" },
+		{ "{{NASA}}", "NASA" },
+		{ "a  b   c ", "a b c" },
+		{ "\\{escaped\\} braces", "\\{escaped\\} braces" },
+		{ "\\LaTeX\\ and \\ln", "LaTeX\\ and" },
+		{ "\\emph{a}\\textbf {b}", "ab" },
+		{ "x \\it y \\bf{z}", "x \\it y z" },
+		{ "\\url{http://x.org}", "http://x.org" },
+		{ "$\\cosh$ \\rmfamily", "cosh family" },
+		{ "\\textsc{a}\\textsf{b}\\texttt{c}\\mbox{d}\\mkbibquote{e}\\textsl{f}\\textrm{g}", "abcdefg" },
+		{ "{\\small s} {\\em e} {\\bf b}", "s e b" },
+		{ "\\em", "" },
+		{ "{\\it}", "" },
+		{ "", "" },
+	};
+	int ntests = sizeof( tests ) / sizeof( tests[0] );
+	int i, failed = 0;
+	str in, out;
+
+	str_init( &in );
+
+	/* a fresh out for each test, so a result that is never allocated
+	 * shows up as NULL */
+	for ( i=0; i<ntests; ++i ) {
+		str_init( &out );
+		str_strcpyc( &in, tests[i].in );
+		if ( latex_parse( &in, &out )!=BIBL_OK ) {
+			fprintf( stderr, "%s: latex_parse() failed for '%s'\n", progname, tests[i].in );
+			failed++;
+		}
+		else if ( !str_cstr( &out ) ) {
+			fprintf( stderr, "%s: '%s' parsed to a NULL string, expected '%s'\n", progname,
+				tests[i].in, tests[i].out );
+			failed++;
+		}
+		else if ( strcmp( str_cstr( &out ), tests[i].out ) ) {
+			fprintf( stderr, "%s: '%s' parsed to '%s', expected '%s'\n", progname,
+				tests[i].in, str_cstr( &out ), tests[i].out );
+			failed++;
+		}
+		str_free( &out );
+	}
+
+	str_free( &in );
+
+	return failed;
+}
+
+int
+main( int argc, char *argv[] )
+{
+	int failed = 0;
+
+	failed += test_latex_parse();
+
+	if ( !failed ) {
+		printf( "%s: PASSED\n", progname );
+		return EXIT_SUCCESS;
+	} else {
+		printf( "%s: FAILED\n", progname );
+		return EXIT_FAILURE;
+	}
+}
@@ -0,0 +1,129 @@
+/*
+ * macros_test.c
+ *
+ * Copyright (c) 2021
+ *
+ * Source code released under the GPL version 2
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "macros.h"
+
+char progname[] = "macros_test";
+char version[] = "0.1";
+
+#define check( a, b ) { \
+	if ( !(a) ) { \
+		fprintf( stderr, "Failed %s (%s) in %s() line %d\n", #a, b, __FUNCTION__, __LINE__ );\
+		return 1; \
+	} \
+}
+
+int
+test_macros( void )
+{
+	str name, value, *t;
+	macros m;
+
+	strs_init( &name, &value, NULL );
+	macros_init( &m );
+
+	str_strcpyc( &name, "jgr" );
+	str_strcpyc( &value, "J. Geophys. Res." );
+	check( ( macros_add( &m, &name, &value )==MACROS_OK ), "macros_add() should succeed" );
+
+	str_strcpyc( &name, "JGR" );
+	t = macros_find( &m, &name );
+	check( ( t && !strcmp( str_cstr( t ), "J. Geophys. Res." ) ), "macro names should ignore case" );
+
+	str_strcpyc( &value, "Journal of Geophysical Research" );
+	check( ( macros_add( &m, &name, &value )==MACROS_OK ), "macros_add() should succeed" );
+	str_strcpyc( &name, "Jgr" );
+	t = macros_find( &m, &name );
+	check( ( t && !strcmp( str_cstr( t ), "Journal of Geophysical Research" ) ), "last definition should win" );
+	check( ( m.names.n==1 ), "redefinition should not add a macro" );
+
+	str_strcpyc( &name, "apj" );
+	check( ( macros_find( &m, &name )==NULL ), "undefined macro should not be found" );
+	str_empty( &name );
+	check( ( macros_find( &m, &name )==NULL ), "empty name should not be found" );
+
+	macros_free( &m );
+	strs_free( &name, &value, NULL );
+
+	return 0;
+}
+
+int
+test_many( void )
+{
+	static macros m = MACROS_STATIC_INIT;
+	char buf[64];
+	str name, value, *t;
+	int i;
+
+	strs_init( &name, &value, NULL );
+
+	for ( i=0; i<3000; ++i ) {
+		sprintf( buf, "mac%d", i );
+		str_strcpyc( &name, buf );
+		sprintf( buf, "Value %d", i );
+		str_strcpyc( &value, buf );
+		check( ( macros_add( &m, &name, &value )==MACROS_OK ), "macros_add() should succeed" );
+	}
+	for ( i=0; i<3000; ++i ) {
+		sprintf( buf, "MAC%d", i );
+		str_strcpyc( &name, buf );
+		t = macros_find( &m, &name );
+		sprintf( buf, "Value %d", i );
+		check( ( t && !strcmp( str_cstr( t ), buf ) ), "every macro should be found" );
+	}
+
+	macros_free( &m );
+	strs_free( &name, &value, NULL );
+
+	return 0;
+}
+
+int
+test_new( void )
+{
+	str name, value, *t;
+	macros *m;
+
+	strs_init( &name, &value, NULL );
+	str_strcpyc( &name, "tl" );
+	str_strcpyc( &value, "Tetrahedron Lett." );
+
+	m = macros_new();
+	check( ( m!=NULL ), "macros_new() should succeed" );
+	check( ( macros_find( m, &name )==NULL ), "a new table should be empty" );
+	check( ( macros_add( m, &name, &value )==MACROS_OK ), "macros_add() should succeed" );
+	t = macros_find( m, &name );
+	check( ( t && !strcmp( str_cstr( t ), "Tetrahedron Lett." ) ), "macro should be found" );
+	macros_delete( m );
+	macros_delete( NULL );
+
+	strs_free( &name, &value, NULL );
+
+	return 0;
+}
+
+int
+main( int argc, char *argv[] )
+{
+	int failed = 0;
+
+	failed += test_macros();
+	failed += test_many();
+	failed += test_new();
+
+	if ( !failed ) {
+		printf( "%s: PASSED\n", progname );
+		return EXIT_SUCCESS;
+	} else {
+		printf( "%s: FAILED\n", progname );
+		return EXIT_FAILURE;
+	}
+}
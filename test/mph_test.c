@@ -0,0 +1,144 @@
+/*
+ * mph_test.c
+ *
+ * Copyright (c) 2021
+ *
+ * Source code released under the GPL version 2
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include "mph.h"
+
+char progname[] = "mph_test";
+char version[] = "0.1";
+
+#define check( a, b ) { \
+	if ( !(a) ) { \
+		fprintf( stderr, "Failed %s (%s) in %s() line %d\n", #a, b, __FUNCTION__, __LINE__ );\
+		return 1; \
+	} \
+}
+
+/* written by: bldhash/mph_table -i months */
+static const char *months_keys[12] = {
+	"January",
+	"May",
+	"February",
+	"March",
+	"April",
+	"October",
+	"September",
+	"June",
+	"November",
+	"December",
+	"August",
+	"July",
+};
+static const char *months_values[12] = {
+	"01",
+	"05",
+	"02",
+	"03",
+	"04",
+	"10",
+	"09",
+	"06",
+	"11",
+	"12",
+	"08",
+	"07",
+};
+static const int months_disp[5] = {
+	7, 2, 18, 1, 46,
+};
+static const mph months_hash = { 12, 5, months_disp, MPH_NOCASE };
+
+static const char *
+month_number( const char *query )
+{
+	unsigned int n = mph_slot( &months_hash, query );
+	if ( !strcasecmp( query, months_keys[n] ) ) return months_values[n];
+	else return NULL;
+}
+
+int
+test_members( void )
+{
+	const char *full[12] = { "January", "February", "March", "April", "May", "June",
+		"July", "August", "September", "October", "November", "December" };
+	char number[3];
+	unsigned int seen = 0, n;
+	const char *p;
+	int i;
+
+	for ( i=0; i<12; ++i ) {
+		n = mph_slot( &months_hash, full[i] );
+		check( ( n<12 ), "slot should be inside the table" );
+		check( ( !( seen & ( 1U<<n ) ) ), "each key should have a slot of its own" );
+		seen |= 1U<<n;
+		sprintf( number, "%02d", i+1 );
+		p = month_number( full[i] );
+		check( ( p && !strcmp( p, number ) ), "month should map to its number" );
+	}
+
+	return 0;
+}
+
+int
+test_nocase( void )
+{
+	const char *p;
+
+	p = month_number( "SEPTEMBER" );
+	check( ( p && !strcmp( p, "09" ) ), "nocase index should ignore case" );
+	p = month_number( "june" );
+	check( ( p && !strcmp( p, "06" ) ), "nocase index should ignore case" );
+	check( ( mph_slotn( &months_hash, "Mayday", 3 )==mph_slot( &months_hash, "MAY" ) ), "mph_slotn() should hash a span" );
+
+	return 0;
+}
+
+int
+test_nonmembers( void )
+{
+	const char *other[] = { "", "Jan", "Octobre", "Smarch", "January ", "12" };
+	int i;
+
+	for ( i=0; i<(int)(sizeof( other ) / sizeof( other[0] )); ++i ) {
+		check( ( mph_slot( &months_hash, other[i] )<12 ), "any string should map inside the table" );
+		check( ( month_number( other[i] )==NULL ), "strings outside the set should not match" );
+	}
+
+	return 0;
+}
+
+int
+test_empty( void )
+{
+	mph h = { 0, 0, NULL, MPH_CASE };
+
+	check( ( mph_slot( &h, "anything" )==0 ), "empty index should return slot 0" );
+
+	return 0;
+}
+
+int
+main( int argc, char *argv[] )
+{
+	int failed = 0;
+
+	failed += test_members();
+	failed += test_nocase();
+	failed += test_nonmembers();
+	failed += test_empty();
+
+	if ( !failed ) {
+		printf( "%s: PASSED\n", progname );
+		return EXIT_SUCCESS;
+	} else {
+		printf( "%s: FAILED\n", progname );
+		return EXIT_FAILURE;
+	}
+}
@@ -0,0 +1,167 @@
+/*
+ * name_test.c
+ *
+ * Copyright (c) 2021
+ *
+ * Source code released under the GPL version 2
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bibdefs.h"
+#include "fields.h"
+#include "slist.h"
+#include "namelist.h"
+#include "name.h"
+
+char progname[] = "name_test";
+char version[] = "0.1";
+
+#define check( a, b ) { \
+	if ( !(a) ) { \
+		fprintf( stderr, "Failed %s (%s) in %s() line %d\n", #a, b, __FUNCTION__, __LINE__ );\
+		return 1; \
+	} \
+}
+
+static const char *names = "Smith, John|Jane Q. Doe|Acme Corp|Prince|Smith, John";
+
+static int
+check_names( fields *f, namelist *corps )
+{
+	check( ( f->n==5 ), "five names should be added" );
+	check( ( !strcmp( fields_tag( f, 0, FIELDS_CHRP ), "AUTHOR" ) ), "name should be AUTHOR" );
+	check( ( !strcmp( fields_value( f, 0, FIELDS_CHRP ), "Smith|John" ) ), "comma name should parse" );
+	check( ( !strcmp( fields_value( f, 1, FIELDS_CHRP ), "Doe|Jane|Q." ) ), "plain name should parse" );
+	if ( corps ) {
+		check( ( !strcmp( fields_tag( f, 2, FIELDS_CHRP ), "AUTHOR:CORP" ) ), "corporation should be AUTHOR:CORP" );
+	} else {
+		check( ( !strcmp( fields_value( f, 2, FIELDS_CHRP ), "Corp|Acme" ) ), "non-corporation should parse" );
+	}
+	check( ( !strcmp( fields_tag( f, 3, FIELDS_CHRP ), "AUTHOR:ASIS" ) ), "single token should be AUTHOR:ASIS" );
+	check( ( !strcmp( fields_value( f, 3, FIELDS_CHRP ), "Prince" ) ), "single token should be unchanged" );
+	check( ( !strcmp( fields_value( f, 4, FIELDS_CHRP ), "Smith|John" ) ), "repeated name should parse" );
+	return 0;
+}
+
+int
+test_cache( int size )
+{
+	name_cache *cache;
+	namelist corps;
+	fields f;
+	int i;
+
+	name_cache_setsize( size );
+
+	namelist_init( &corps );
+	fields_init( &f );
+
+	cache = name_cache_new();
+	check( ( ( cache==NULL )==( size==0 ) ), "name_cache_new() should only give no cache when disabled" );
+	for ( i=0; i<3; ++i ) {
+		check( ( add_name( &f, "AUTHOR", names, 0, NULL, NULL, cache )==BIBL_OK ), "add_name() should succeed" );
+		if ( check_names( &f, NULL ) ) return 1;
+		fields_free( &f );
+	}
+	name_cache_delete( cache );
+
+	/* a cache belongs to one set of lists */
+	namelist_add( &corps, "Acme Corp" );
+	cache = name_cache_new();
+	for ( i=0; i<3; ++i ) {
+		check( ( add_name( &f, "AUTHOR", names, 0, NULL, &corps, cache )==BIBL_OK ), "add_name() should succeed" );
+		if ( check_names( &f, &corps ) ) return 1;
+		fields_free( &f );
+	}
+	name_cache_delete( cache );
+
+	namelist_free( &corps );
+	name_cache_setsize( NAME_CACHE_DEFAULT );
+
+	return 0;
+}
+
+static int
+parse_is( const char *in, const char *out, int type )
+{
+	str inname, outname;
+	int ret;
+
+	str_initstrc( &inname, in );
+	str_init( &outname );
+	ret = ( name_parse( &outname, &inname, NULL, NULL )==type && !strcmp( str_cstr( &outname ), out ) );
+	if ( !ret ) fprintf( stderr, "'%s' parsed to '%s'\n", in, str_cstr( &outname ) );
+	strs_free( &inname, &outname, NULL );
+
+	return ret;
+}
+
+int
+test_parse( void )
+{
+	check( parse_is( "H. F. Author", "Author|H|F", 1 ), "plain name" );
+	check( parse_is( "Author, H. F.", "Author|H|F", 1 ), "name with comma" );
+	check( parse_is( "Author,H.F.", "Author|H|F", 1 ), "comma without space" );
+	check( parse_is( "Author, H. F., Jr.", "Author|H|F||Jr.", 1 ), "trailing suffix" );
+	check( parse_is( "Author, Sr., H. F.", "Author|H|F||Sr.", 1 ), "suffix after comma" );
+	check( parse_is( "Ludwig von Beethoven", "von Beethoven|Ludwig", 1 ), "lowercase family prefix" );
+	check( parse_is( "Smith, JP", "Smith|J|P", 1 ), "uppercase initials should split" );
+	check( parse_is( "Smith, J-P", "Smith|J.-P.", 1 ), "hyphenated initials should split" );
+	check( parse_is( "Prince", "Prince", 2 ), "single token" );
+	check( parse_is( "Prince,", "Prince, ", 2 ), "single token with comma" );
+
+	return 0;
+}
+
+int
+test_namelist( void )
+{
+	namelist nl, cp;
+	str s;
+
+	namelist_init( &nl );
+	namelist_init( &cp );
+	str_initstrc( &s, "Acme Corp" );
+
+	check( ( namelist_find( &nl, &s )==-1 ), "empty list should find nothing" );
+	check( ( namelist_add( &nl, "Acme Corp" )==NAMELIST_OK ), "namelist_add() should succeed" );
+	check( ( namelist_add( &nl, "Widget Inc" )==NAMELIST_OK ), "namelist_add() should succeed" );
+	check( ( namelist_add( &nl, "Acme Corp" )==NAMELIST_OK ), "namelist_add() should succeed" );
+	check( ( namelist_find( &nl, &s )==0 ), "first entry should be found" );
+	check( ( namelist_findc( &nl, "Widget Inc" )==1 ), "second entry should be found" );
+	check( ( namelist_findc( &nl, "acme corp" )==-1 ), "matches should be case-sensitive" );
+	check( ( namelist_findc( &nl, "Acme" )==-1 ), "matches should be exact" );
+	check( ( namelist_findc( &nl, "" )==-1 ), "empty name should not match" );
+
+	check( ( namelist_copy( &cp, &nl )==NAMELIST_OK ), "namelist_copy() should succeed" );
+	check( ( namelist_findc( &cp, "Widget Inc" )==1 ), "copy should be indexed" );
+	check( ( namelist_fill( &cp, "/nonexistent/namelist" )==NAMELIST_CANTOPEN ), "missing file should fail" );
+
+	str_free( &s );
+	namelist_free( &nl );
+	namelist_free( &cp );
+
+	return 0;
+}
+
+int
+main( int argc, char *argv[] )
+{
+	int failed = 0;
+
+	failed += test_parse();
+	failed += test_namelist();
+	failed += test_cache( 0 );
+	failed += test_cache( 1 );
+	failed += test_cache( 2 );
+	failed += test_cache( NAME_CACHE_DEFAULT );
+
+	if ( !failed ) {
+		printf( "%s: PASSED\n", progname );
+		return EXIT_SUCCESS;
+	} else {
+		printf( "%s: FAILED\n", progname );
+		return EXIT_FAILURE;
+	}
+}
@@ -0,0 +1,142 @@
+/*
+ * sink_test.c
+ *
+ * Copyright (c) 2021
+ *
+ * Source code released under the GPL version 2
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sink.h"
+
+char progname[] = "sink_test";
+char version[] = "0.1";
+
+#define check( a, b ) { \
+	if ( !(a) ) { \
+		fprintf( stderr, "Failed %s (%s) in %s() line %d\n", #a, b, __FUNCTION__, __LINE__ );\
+		return 1; \
+	} \
+}
+
+int
+test_small( void )
+{
+	str out, s;
+	sink k;
+
+	str_init( &out );
+	str_init( &s );
+	str_strcpyc( &s, "str" );
+
+	sink_init_str( &k, &out );
+	sink_puts( &k, "<a>" );
+	sink_putc( &k, 'b' );
+	sink_write( &k, "cdef", 2 );
+	sink_str( &k, &s );
+	sink_spaces( &k, 3 );
+	sink_printf( &k, "%d-%s", 42, "x" );
+	sink_puts( &k, NULL );
+	check( ( out.len==0 ), "output should be buffered until flushed" );
+	check( ( sink_free( &k )==SINK_OK ), "sink_free() should return SINK_OK" );
+
+	check( ( !strcmp( str_cstr( &out ), "<a>bcdstr   42-x" ) ), "output should match" );
+
+	strs_free( &out, &s, NULL );
+
+	return 0;
+}
+
+int
+test_large( void )
+{
+	unsigned long i, n = 3 * SINK_BUFSIZE + 17;
+	char big[1000];
+	str out;
+	sink k;
+
+	str_init( &out );
+
+	sink_init_str( &k, &out );
+	for ( i=0; i<n; ++i )
+		sink_putc( &k, 'a' + i % 26 );
+	sink_spaces( &k, 200 );
+	memset( big, 'z', sizeof( big ) - 1 );
+	big[ sizeof( big ) - 1 ] = '\0';
+	sink_printf( &k, "[%s]", big );
+	check( ( sink_free( &k )==SINK_OK ), "sink_free() should return SINK_OK" );
+
+	check( ( out.len==n + 200 + sizeof( big ) + 1 ), "output length should match" );
+	for ( i=0; i<n; ++i )
+		check( ( out.data[i]=='a' + i % 26 ), "characters should be in order" );
+	for ( i=n; i<n+200; ++i )
+		check( ( out.data[i]==' ' ), "sink_spaces() should write spaces" );
+	check( ( out.data[n+200]=='[' && out.data[out.len-1]==']' ), "sink_printf() should write long strings" );
+
+	str_free( &out );
+
+	return 0;
+}
+
+int
+test_file( void )
+{
+	char buf[64];
+	FILE *fp;
+	sink k;
+
+	fp = tmpfile();
+	check( ( fp!=NULL ), "tmpfile() should succeed" );
+
+	sink_init( &k, fp );
+	sink_puts( &k, "<mods>\n" );
+	sink_spaces( &k, 4 );
+	sink_puts( &k, "</mods>\n" );
+	check( ( sink_free( &k )==SINK_OK ), "sink_free() should return SINK_OK" );
+
+	rewind( fp );
+	check( ( fgets( buf, sizeof( buf ), fp ) && !strcmp( buf, "<mods>\n" ) ), "first line should match" );
+	check( ( fgets( buf, sizeof( buf ), fp ) && !strcmp( buf, "    </mods>\n" ) ), "second line should match" );
+	fclose( fp );
+
+	return 0;
+}
+
+/* A stream that cannot be written, standing in for a full disk */
+int
+test_file_error( void )
+{
+	FILE *fp;
+	sink k;
+
+	fp = fopen( "/dev/null", "r" );
+	check( ( fp!=NULL ), "fopen() should succeed" );
+
+	sink_init( &k, fp );
+	sink_puts( &k, "<mods>\n" );
+	check( ( sink_status( &k )==SINK_OK ), "output should be buffered until flushed" );
+	check( ( sink_free( &k )==SINK_ERR_WRITE ), "sink_free() should return SINK_ERR_WRITE" );
+	fclose( fp );
+
+	return 0;
+}
+
+int
+main( int argc, char *argv[] )
+{
+	int failed = 0;
+
+	failed += test_small();
+	failed += test_large();
+	failed += test_file();
+	failed += test_file_error();
+
+	if ( !failed ) {
+		printf( "%s: PASSED\n", progname );
+		return EXIT_SUCCESS;
+	} else {
+		printf( "%s: FAILED\n", progname );
+		return EXIT_FAILURE;
+	}
+}
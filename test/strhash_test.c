@@ -0,0 +1,149 @@
+/*
+ * strhash_test.c
+ *
+ * Copyright (c) 2021
+ *
+ * Source code released under the GPL version 2
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "strhash.h"
+#include "reftypes.h"
+
+char progname[] = "strhash_test";
+char version[] = "0.1";
+
+#define check( a, b ) { \
+	if ( !(a) ) { \
+		fprintf( stderr, "Failed %s (%s) in %s() line %d\n", #a, b, __FUNCTION__, __LINE__ );\
+		return 1; \
+	} \
+}
+
+int
+test_set_find( void )
+{
+	strhash h;
+
+	strhash_init( &h, STRHASH_CASE );
+	check( ( strhash_find( &h, "a" )==-1 ), "empty hash should find nothing" );
+	check( ( strhash_set( &h, "a", 1 )==STRHASH_OK ), "strhash_set() should succeed" );
+	check( ( strhash_set( &h, "b", 2 )==STRHASH_OK ), "strhash_set() should succeed" );
+	check( ( strhash_find( &h, "a" )==1 ), "should find a" );
+	check( ( strhash_find( &h, "b" )==2 ), "should find b" );
+	check( ( strhash_find( &h, "A" )==-1 ), "case-sensitive hash should not find A" );
+	check( ( strhash_findn( &h, "abc", 1 )==1 ), "strhash_findn() should match a span" );
+
+	strhash_set( &h, "a", 3 );
+	check( ( strhash_find( &h, "a" )==3 ), "strhash_set() should replace" );
+	strhash_add_unique( &h, "a", 4 );
+	check( ( strhash_find( &h, "a" )==3 ), "strhash_add_unique() should keep first" );
+	check( ( h.n==2 ), "hash should have two entries" );
+
+	strhash_free( &h );
+
+	return 0;
+}
+
+int
+test_nocase( void )
+{
+	strhash h;
+
+	strhash_init( &h, STRHASH_NOCASE );
+	strhash_set( &h, "JournalName", 7 );
+	check( ( strhash_find( &h, "journalname" )==7 ), "nocase hash should ignore case" );
+	check( ( strhash_find( &h, "JOURNALNAME" )==7 ), "nocase hash should ignore case" );
+	check( ( strhash_find( &h, "journal" )==-1 ), "nocase hash should match full key" );
+	strhash_free( &h );
+
+	return 0;
+}
+
+int
+test_many( void )
+{
+	char keys[2000][8];
+	strhash h;
+	int i;
+
+	strhash_init( &h, STRHASH_CASE );
+	for ( i=0; i<2000; ++i ) {
+		sprintf( keys[i], "k%d", i );
+		check( ( strhash_set( &h, keys[i], i )==STRHASH_OK ), "strhash_set() should succeed" );
+	}
+	for ( i=0; i<2000; ++i )
+		check( ( strhash_find( &h, keys[i] )==i ), "should find every key" );
+
+	for ( i=0; i<2000; i+=2 )
+		check( ( strhash_remove( &h, keys[i] )==i ), "strhash_remove() should return value" );
+	check( ( h.n==1000 ), "half the keys should remain" );
+	for ( i=0; i<2000; ++i ) {
+		if ( i%2 ) check( ( strhash_find( &h, keys[i] )==i ), "odd keys should remain" )
+		else check( ( strhash_find( &h, keys[i] )==-1 ), "even keys should be gone" )
+	}
+	check( ( strhash_remove( &h, "k0" )==-1 ), "removing twice should return -1" );
+
+	strhash_free( &h );
+
+	return 0;
+}
+
+static lookups article[] = {
+	{ "AU", "AUTHOR",  PERSON, 0 },
+	{ "TI", "TITLE",   SIMPLE, 0 },
+	{ "au", "EDITOR",  PERSON, 0 },
+};
+static lookups book[] = {
+	{ "TI", "TITLE",   SIMPLE, 1 },
+};
+static variants all[] = {
+	{ "article", article, 3 },
+	{ "art",     book,    1 },
+	{ "book",    book,    1 },
+	{ "bookle",  book,    1 },
+};
+
+int
+test_reftypes( void )
+{
+	int n, process, level, is_default;
+	char *newtag;
+
+	n = get_reftype( "ARTICLE", 1, NULL, all, 4, NULL, &is_default, REFTYPE_SILENT );
+	check( ( n==0 && !is_default ), "ARTICLE should be the first type" );
+	n = get_reftype( "  artwork", 1, NULL, all, 4, NULL, &is_default, REFTYPE_SILENT );
+	check( ( n==1 ), "artwork should match type prefix art" );
+	n = get_reftype( "booklet", 1, NULL, all, 4, NULL, &is_default, REFTYPE_SILENT );
+	check( ( n==2 ), "booklet should match the earlier type book" );
+	n = get_reftype( "bo", 1, NULL, all, 4, NULL, &is_default, REFTYPE_SILENT );
+	check( ( n==0 && is_default ), "bo should default" );
+
+	check( ( process_findoldtag( "ti", 0, all, 4 )==1 ), "ti should be found" );
+	check( ( process_findoldtag( "AU", 0, all, 4 )==0 ), "first AU should win" );
+	check( ( process_findoldtag( "XX", 0, all, 4 )==-1 ), "XX should not be found" );
+	check( translate_oldtag( "ti", 1, all, 4, &process, &level, &newtag ), "ti should translate" );
+	check( ( level==1 && !strcmp( newtag, "TITLE" ) ), "ti should translate per reftype" );
+
+	return 0;
+}
+
+int
+main( int argc, char *argv[] )
+{
+	int failed = 0;
+
+	failed += test_set_find();
+	failed += test_nocase();
+	failed += test_many();
+	failed += test_reftypes();
+
+	if ( !failed ) {
+		printf( "%s: PASSED\n", progname );
+		return EXIT_SUCCESS;
+	} else {
+		printf( "%s: FAILED\n", progname );
+		return EXIT_FAILURE;
+	}
+}
@@ -0,0 +1,144 @@
+/*
+ * tokens_test.c
+ *
+ * Copyright (c) 2021
+ *
+ * Source code released under the GPL version 2
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "tokens.h"
+
+char progname[] = "tokens_test";
+char version[] = "0.1";
+
+#define check( a, b ) { \
+	if ( !(a) ) { \
+		fprintf( stderr, "Failed %s (%s) in %s() line %d\n", #a, b, __FUNCTION__, __LINE__ );\
+		return 1; \
+	} \
+}
+
+int
+test_token_cat( void )
+{
+	const char *buf = "{A title\n   over two lines}";
+	token t;
+	str s;
+
+	str_init( &s );
+
+	t.p        = buf;
+	t.len      = strlen( buf );
+	t.newlines = 1;
+
+	token_cat( &s, &t, 0, 0 );
+	check( ( !strcmp( str_cstr( &s ), "{A title over two lines}" ) ), "newlines should become one space" );
+
+	str_empty( &s );
+	token_cat( &s, &t, 1, 1 );
+	check( ( !strcmp( str_cstr( &s ), "A title over two lines" ) ), "token_cat() should skip the braces" );
+
+	str_empty( &s );
+	t.p = "\"";
+	t.len = 1;
+	t.newlines = 0;
+	token_cat( &s, &t, 1, 1 );
+	check( ( s.len==0 ), "skipping past the token should add nothing" );
+
+	str_free( &s );
+
+	return 0;
+}
+
+int
+test_tokens( void )
+{
+	const char *buf = "jgr # {x}";
+	char many[100];
+	tokens toks;
+	slist out;
+	int i;
+
+	tokens_init( &toks );
+	slist_init( &out );
+
+	check( ( tokens_add( &toks, buf, 3, 0 )==TOKENS_OK ), "tokens_add() should succeed" );
+	check( !tokens_has_concat( &toks ), "jgr is not a concatenation" );
+	check( ( tokens_add( &toks, buf+4, 1, 0 )==TOKENS_OK ), "tokens_add() should succeed" );
+	check( ( tokens_add( &toks, buf+6, 3, 0 )==TOKENS_OK ), "tokens_add() should succeed" );
+	check( tokens_has_concat( &toks ), "# is a concatenation" );
+
+	memset( many, 'a', sizeof( many ) );
+	for ( i=0; i<50; ++i )
+		check( ( tokens_add( &toks, many, i+1, 0 )==TOKENS_OK ), "tokens_add() should grow" );
+	check( ( toks.n==53 ), "tokens should hold every token" );
+
+	check( ( tokens_to_slist( &toks, &out )==TOKENS_OK ), "tokens_to_slist() should succeed" );
+	check( ( out.n==53 ), "slist should hold every token" );
+	check( ( !strcmp( slist_cstr( &out, 0 ), "jgr" ) ), "first token should be jgr" );
+	check( ( !strcmp( slist_cstr( &out, 1 ), "#" ) ), "second token should be #" );
+	check( ( !strcmp( slist_cstr( &out, 2 ), "{x}" ) ), "third token should be {x}" );
+	check( ( slist_str( &out, 52 )->len==50 ), "last token should be 50 characters" );
+
+	slist_free( &out );
+	tokens_free( &toks );
+
+	return 0;
+}
+
+int
+test_tokens_are_literal( void )
+{
+	const char *buf = "{Title} 1999 jgr \"x\"";
+	tokens toks;
+	macros m;
+	str name, value;
+
+	tokens_init( &toks );
+	macros_init( &m );
+	strs_init( &name, &value, NULL );
+
+	tokens_add( &toks, buf, 7, 0 );
+	tokens_add( &toks, buf+8, 4, 0 );
+	check( ( tokens_are_literal( &toks, &m ) ), "braces and numbers should be literal" );
+
+	tokens_add( &toks, buf+13, 3, 0 );
+	check( ( tokens_are_literal( &toks, &m ) ), "a bare word that is no macro should be literal" );
+
+	str_strcpyc( &name, "JGR" );
+	str_strcpyc( &value, "J. Geophys. Res." );
+	check( ( macros_add( &m, &name, &value )==MACROS_OK ), "macros_add() should succeed" );
+	check( ( !tokens_are_literal( &toks, &m ) ), "a macro name should not be literal" );
+
+	tokens_free( &toks );
+	tokens_add( &toks, buf+17, 3, 0 );
+	check( ( token_is_bare( &(toks.tok[0]) )==0 ), "a quoted token should not be bare" );
+	tokens_add( &toks, "#", 1, 0 );
+	check( ( !tokens_are_literal( &toks, &m ) ), "concatenation should not be literal" );
+
+	tokens_free( &toks );
+	macros_free( &m );
+	strs_free( &name, &value, NULL );
+
+	return 0;
+}
+
+int
+main( int argc, char *argv[] )
+{
+	int failed = 0;
+
+	failed += test_token_cat();
+	failed += test_tokens();
+	failed += test_tokens_are_literal();
+
+	if ( !failed ) {
+		printf( "%s: PASSED\n", progname );
+		return EXIT_SUCCESS;
+	} else {
+		printf( "%s: FAILED\n", progname );
+		return EXIT_FAILURE;
+	}
+}
@@ -0,0 +1,159 @@
+/*
+ * xml_test.c
+ *
+ * Copyright (c) 2021
+ *
+ * Source code released under the GPL version 2
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "xml.h"
+
+char progname[] = "xml_test";
+char version[] = "0.1";
+
+#define check( a, b ) { \
+	if ( !(a) ) { \
+		fprintf( stderr, "Failed %s (%s) in %s() line %d\n", #a, b, __FUNCTION__, __LINE__ );\
+		return 1; \
+	} \
+}
+
+#define check_attribute( a, b, c ) if ( !_check_attribute( a, b, c, __FUNCTION__, __LINE__ ) ) return 1;
+int
+_check_attribute( xml *node, const char *attribute, const char *expected, const char *fn, int line )
+{
+	char *value;
+
+	value = xml_attribute_cstr( node, attribute );
+	if ( !expected && !value ) return 1;
+	if ( expected && value && !strcmp( value, expected ) ) return 1;
+
+	fprintf( stderr, "Failed: %s() line %d: Expected attribute '%s' to be '%s', found '%s'\n",
+		fn, line, attribute, expected ? expected : "(null)", value ? value : "(null)" );
+	return 0;
+}
+
+int
+test_attributes( void )
+{
+	const char *buf = "<ArticleId IdType=\"doi\" Other='x y'>10.1/2</ArticleId>";
+	xml top, *node;
+
+	xml_init( &top );
+	xml_parse( buf, &top );
+
+	node = top.down;
+	check( ( node!=NULL ), "xml_parse() should create a node" );
+	check( xml_tag_matches( node, "ArticleId" ), "tag should be ArticleId" );
+	check( ( node->nattrib==2 ), "node should have two attributes" );
+	check_attribute( node, "IdType", "doi" );
+	check_attribute( node, "Other", "x y" );
+	check_attribute( node, "idtype", NULL );
+	check_attribute( node, "Missing", NULL );
+	check( ( !strcmp( xml_value_cstr( node ), "10.1/2" ) ), "value should be 10.1/2" );
+
+	check( xml_has_attribute( node, "idtype", "DOI" ), "xml_has_attribute() should ignore case" );
+	check( !xml_has_attribute( node, "IdType", "pmc" ), "xml_has_attribute() should compare value" );
+	check( !xml_has_attribute( node, "IdType", "do" ), "xml_has_attribute() should compare full value" );
+	check( xml_tag_has_attribute( node, "ArticleId", "IdType", "doi" ), "xml_tag_has_attribute() should match" );
+
+	xml_free( &top );
+
+	return 0;
+}
+
+int
+test_many_attributes( void )
+{
+	const char *buf = "<style face=\"normal\" font=\"default\" size=\"100%\" charset=\"0\" color=\"red\"/>";
+	xml top, *node;
+
+	xml_init( &top );
+	xml_parse( buf, &top );
+
+	node = top.down;
+	check( ( node!=NULL ), "xml_parse() should create a node" );
+	check( ( node->nattrib==5 ), "node should have five attributes" );
+	check_attribute( node, "face", "normal" );
+	check_attribute( node, "size", "100%" );
+	check_attribute( node, "color", "red" );
+
+	xml_free( &top );
+
+	return 0;
+}
+
+int
+test_odd_attributes( void )
+{
+	const char *buf = "<a empty=\"\" bare=yes split=\"x\"y mixed='1' after=\"2\"></a>";
+	xml top, *node;
+
+	xml_init( &top );
+	xml_parse( buf, &top );
+
+	node = top.down;
+	check( ( node!=NULL ), "xml_parse() should create a node" );
+	check_attribute( node, "empty", "" );
+	check_attribute( node, "bare", "yes" );
+	check_attribute( node, "split", "xy" );
+	check_attribute( node, "mixed", "1" );
+	check_attribute( node, "after", "2" );
+
+	xml_free( &top );
+
+	return 0;
+}
+
+int
+test_nested( void )
+{
+	const char *buf = "<?xml version=\"1.0\" encoding=\"UTF-8\"?>"
+		"<mods ID=\"key\"><name type=\"personal\"><namePart type=\"given\">A</namePart></name></mods>";
+	xml top, *node;
+
+	xml_init( &top );
+	xml_parse( buf, &top );
+
+	node = top.down;
+	check( ( node!=NULL ), "xml_parse() should create a descriptor node" );
+	check_attribute( node, "encoding", "UTF-8" );
+
+	node = node->next;
+	check( ( node!=NULL ), "xml_parse() should create a mods node" );
+	check_attribute( node, "ID", "key" );
+
+	node = node->down;
+	check( ( node!=NULL ), "xml_parse() should create a name node" );
+	check_attribute( node, "type", "personal" );
+
+	node = node->down;
+	check( ( node!=NULL ), "xml_parse() should create a namePart node" );
+	check_attribute( node, "type", "given" );
+	check( ( !strcmp( xml_value_cstr( node ), "A" ) ), "value should be A" );
+
+	xml_free( &top );
+
+	return 0;
+}
+
+int
+main( int argc, char *argv[] )
+{
+	int failed = 0;
+
+	failed += test_attributes();
+	failed += test_many_attributes();
+	failed += test_odd_attributes();
+	failed += test_nested();
+
+	if ( !failed ) {
+		printf( "%s: PASSED\n", progname );
+		return EXIT_SUCCESS;
+	} else {
+		printf( "%s: FAILED\n", progname );
+		return EXIT_FAILURE;
+	}
+}